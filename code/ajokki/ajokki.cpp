@@ -23,6 +23,7 @@
 #include "lisp/ajokki_console_callbacks.hpp"
 #include "code/ylikuutio/audio/audio_system.hpp"
 #include "code/ylikuutio/command_line/command_line_master.hpp"
+#include "code/ylikuutio/console/console_logic_module.hpp"
 #include "code/ylikuutio/core/application.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
 #include "code/ylikuutio/render/graphics_api_backend.hpp"
@@ -137,6 +138,8 @@ namespace ajokki
             "fullscreen",
             "desktop-fullscreen",
             "headless",
+            "headless-simulation",
+            "ticks-per-second",
             "window-width",
             "window-height",
             "framebuffer-width",
@@ -144,7 +147,8 @@ namespace ajokki
             "speed",
             "turbo-factor",
             "twin-turbo-factor",
-            "mouse-speed"
+            "mouse-speed",
+            "source"
         };
     }
 
@@ -184,6 +188,20 @@ namespace ajokki
             universe_struct.graphics_api_backend = yli::render::GraphicsApiBackend::HEADLESS;
         }
 
+        if (this->command_line_master.is_key("headless-simulation"))
+        {
+            // Run the headless simulation loop, driven by console commands from stdin.
+            universe_struct.graphics_api_backend = yli::render::GraphicsApiBackend::HEADLESS;
+            universe_struct.should_run_headless_simulation = true;
+        }
+
+        if (this->command_line_master.is_key("ticks-per-second") &&
+            yli::string::check_if_float_string<char>(this->command_line_master.get_value("ticks-per-second")))
+        {
+            universe_struct.headless_ticks_per_second =
+                    this->command_line_master.get_value_or_throw<float>("ticks-per-second");
+        }
+
         if (this->command_line_master.is_key("window-width") &&
             yli::string::check_if_unsigned_integer_string<char>(this->command_line_master.get_value("window-width")))
         {
@@ -566,6 +584,16 @@ namespace ajokki
         std::cout << "Setting up debug variables ...\n";
         yli::snippets::set_flight_mode(&this->get_universe(), true);
 
+        if (this->command_line_master.is_key("source"))
+        {
+            // Run a script of console commands before the simulation starts.
+            // The script may end the program by calling `quit`.
+            if (yli::console::ConsoleLogicModule::source(*my_console, this->command_line_master.get_value("source")).has_value())
+            {
+                return true;
+            }
+        }
+
         this->get_universe().start_simulation();
         return true;
     }
@@ -55,7 +55,7 @@ namespace ajokki
         PipelineStruct earth_pipeline_struct { Request(earth_ecosystem) };
         earth_pipeline_struct.global_name = "earth_pipeline";
         earth_pipeline_struct.local_name = "helsinki_regular_pipeline";
-        earth_pipeline_struct.vertex_shader = "standard_shading.vert";
+        earth_pipeline_struct.vertex_shader = "instanced_standard_shading.vert";
         earth_pipeline_struct.fragment_shader = "standard_shading.frag";
 
         std::cout << "Creating Pipeline* earth_pipeline ...\n";
@@ -84,75 +84,75 @@ namespace ajokki
         // Create the `CallbackEngine`s for the `MovableController`s.
         CallbackEngineStruct rest_callback_engine_struct;
         auto rest_callback_engine = this->core.entity_factory.create_callback_engine(rest_callback_engine_struct);
-        rest_callback_engine->create_callback_object(&yli::snippets::rest);
+        rest_callback_engine->create_movable_callback_object(&yli::snippets::rest);
 
         CallbackEngineStruct go_east_callback_engine_struct;
         auto go_east_callback_engine = this->core.entity_factory.create_callback_engine(go_east_callback_engine_struct);
-        go_east_callback_engine->create_callback_object(&yli::snippets::go_east);
+        go_east_callback_engine->create_movable_callback_object(&yli::snippets::go_east);
 
         CallbackEngineStruct go_west_callback_engine_struct;
         auto go_west_callback_engine = this->core.entity_factory.create_callback_engine(go_west_callback_engine_struct);
-        go_west_callback_engine->create_callback_object(&yli::snippets::go_west);
+        go_west_callback_engine->create_movable_callback_object(&yli::snippets::go_west);
 
         CallbackEngineStruct go_north_callback_engine_struct;
         auto go_north_callback_engine = this->core.entity_factory.create_callback_engine(
             go_north_callback_engine_struct);
-        go_north_callback_engine->create_callback_object(&yli::snippets::go_north);
+        go_north_callback_engine->create_movable_callback_object(&yli::snippets::go_north);
 
         CallbackEngineStruct go_south_callback_engine_struct;
         auto go_south_callback_engine = this->core.entity_factory.create_callback_engine(
             go_south_callback_engine_struct);
-        go_south_callback_engine->create_callback_object(&yli::snippets::go_south);
+        go_south_callback_engine->create_movable_callback_object(&yli::snippets::go_south);
 
         CallbackEngineStruct orient_to_east_callback_engine_struct;
         auto orient_to_east_callback_engine = this->core.entity_factory.create_callback_engine(
             orient_to_east_callback_engine_struct);
-        orient_to_east_callback_engine->create_callback_object(&yli::snippets::orient_to_east);
+        orient_to_east_callback_engine->create_movable_callback_object(&yli::snippets::orient_to_east);
 
         CallbackEngineStruct orient_to_west_callback_engine_struct;
         auto orient_to_west_callback_engine = this->core.entity_factory.create_callback_engine(
             orient_to_west_callback_engine_struct);
-        orient_to_west_callback_engine->create_callback_object(&yli::snippets::orient_to_west);
+        orient_to_west_callback_engine->create_movable_callback_object(&yli::snippets::orient_to_west);
 
         CallbackEngineStruct orient_to_north_callback_engine_struct;
         auto orient_to_north_callback_engine = this->core.entity_factory.create_callback_engine(
             orient_to_north_callback_engine_struct);
-        orient_to_north_callback_engine->create_callback_object(&yli::snippets::orient_to_north);
+        orient_to_north_callback_engine->create_movable_callback_object(&yli::snippets::orient_to_north);
 
         CallbackEngineStruct orient_to_south_callback_engine_struct;
         auto orient_to_south_callback_engine = this->core.entity_factory.create_callback_engine(
             orient_to_south_callback_engine_struct);
-        orient_to_south_callback_engine->create_callback_object(&yli::snippets::orient_to_south);
+        orient_to_south_callback_engine->create_movable_callback_object(&yli::snippets::orient_to_south);
 
         CallbackEngineStruct orient_and_go_east_callback_engine_struct;
         auto orient_and_go_east_callback_engine = this->core.entity_factory.create_callback_engine(
             orient_and_go_east_callback_engine_struct);
-        orient_and_go_east_callback_engine->create_callback_object(&yli::snippets::orient_and_go_east);
+        orient_and_go_east_callback_engine->create_movable_callback_object(&yli::snippets::orient_and_go_east);
 
         CallbackEngineStruct orient_and_go_west_callback_engine_struct;
         auto orient_and_go_west_callback_engine = this->core.entity_factory.create_callback_engine(
             orient_and_go_west_callback_engine_struct);
-        orient_and_go_west_callback_engine->create_callback_object(&yli::snippets::orient_and_go_west);
+        orient_and_go_west_callback_engine->create_movable_callback_object(&yli::snippets::orient_and_go_west);
 
         CallbackEngineStruct orient_and_go_north_callback_engine_struct;
         auto orient_and_go_north_callback_engine = this->core.entity_factory.create_callback_engine(
             orient_and_go_north_callback_engine_struct);
-        orient_and_go_north_callback_engine->create_callback_object(&yli::snippets::orient_and_go_north);
+        orient_and_go_north_callback_engine->create_movable_callback_object(&yli::snippets::orient_and_go_north);
 
         CallbackEngineStruct orient_and_go_south_callback_engine_struct;
         auto orient_and_go_south_callback_engine = this->core.entity_factory.create_callback_engine(
             orient_and_go_south_callback_engine_struct);
-        orient_and_go_south_callback_engine->create_callback_object(&yli::snippets::orient_and_go_south);
+        orient_and_go_south_callback_engine->create_movable_callback_object(&yli::snippets::orient_and_go_south);
 
         CallbackEngineStruct rotate_clockwise_callback_engine_struct;
         auto rotate_clockwise_callback_engine = this->core.entity_factory.create_callback_engine(
             rotate_clockwise_callback_engine_struct);
-        rotate_clockwise_callback_engine->create_callback_object(&yli::snippets::rotate_clockwise);
+        rotate_clockwise_callback_engine->create_movable_callback_object(&yli::snippets::rotate_clockwise);
 
         CallbackEngineStruct rotate_counterclockwise_callback_engine_struct;
         auto rotate_counterclockwise_callback_engine = this->core.entity_factory.create_callback_engine(
             rotate_counterclockwise_callback_engine_struct);
-        rotate_counterclockwise_callback_engine->create_callback_object(&yli::snippets::rotate_counterclockwise);
+        rotate_counterclockwise_callback_engine->create_movable_callback_object(&yli::snippets::rotate_counterclockwise);
 
         // Create the `MovableController`s.
 
@@ -0,0 +1,169 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// `AnyValue` micro-benchmarks.
+//
+// Constructs `n_values` `AnyValue`s of mixed datatypes, then copies them,
+// visits them with `AnyValue::visit` and converts them to text with `get_string`,
+// each `n_rounds` times, and prints nanoseconds per value for each operation.
+//
+// usage: benchmark_any_value [n_values] [n_rounds]
+
+#include "code/ylikuutio/data/any_value.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <chrono>      // std::chrono::duration, std::chrono::steady_clock
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int32_t, std::uint64_t
+#include <cstdlib>     // EXIT_SUCCESS, std::strtoull
+#include <iostream>    // std::cout
+#include <string>      // std::string
+#include <type_traits> // std::decay_t, std::is_arithmetic_v, std::is_same_v
+#include <vector>      // std::vector
+
+static yli::data::AnyValue create_any_value(const std::uint64_t value_i, const std::string& name, const glm::vec3& cartesian_coordinates)
+{
+    switch (value_i % 6)
+    {
+        case 0:
+            return yli::data::AnyValue(value_i % 2 == 0);
+        case 1:
+            return yli::data::AnyValue(static_cast<float>(value_i) * 0.5f);
+        case 2:
+            return yli::data::AnyValue(static_cast<double>(value_i) * 0.25);
+        case 3:
+            return yli::data::AnyValue(static_cast<std::int32_t>(value_i));
+        case 4:
+            return yli::data::AnyValue(name);
+        default:
+            return yli::data::AnyValue(cartesian_coordinates);
+    }
+}
+
+static void print_result(const std::string& name, const std::uint64_t n_values, const std::uint64_t n_rounds, const double elapsed)
+{
+    std::cout << name << ": " << elapsed / (n_values * n_rounds) * 1e9 << " ns per value\n";
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_values = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000);
+    const std::uint64_t n_rounds = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20);
+
+    const std::string name = "foo";
+    const glm::vec3 cartesian_coordinates(1.0f, 2.0f, 3.0f);
+
+    std::vector<yli::data::AnyValue> any_values(n_values);
+
+    // The checksum keeps the compiler from optimizing the loops away.
+    std::uint64_t checksum = 0;
+
+    {
+        const auto start_time = std::chrono::steady_clock::now();
+
+        for (std::uint64_t round_i = 0; round_i < n_rounds; round_i++)
+        {
+            for (std::uint64_t value_i = 0; value_i < n_values; value_i++)
+            {
+                any_values[value_i] = create_any_value(value_i + round_i, name, cartesian_coordinates);
+            }
+
+            checksum += any_values[round_i % n_values].get_type();
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        print_result("construct", n_values, n_rounds, elapsed.count());
+    }
+
+    {
+        std::vector<yli::data::AnyValue> copies(n_values);
+        const auto start_time = std::chrono::steady_clock::now();
+
+        for (std::uint64_t round_i = 0; round_i < n_rounds; round_i++)
+        {
+            for (std::uint64_t value_i = 0; value_i < n_values; value_i++)
+            {
+                copies[value_i] = any_values[(value_i + round_i) % n_values];
+            }
+
+            checksum += copies[round_i % n_values].get_type();
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        print_result("copy", n_values, n_rounds, elapsed.count());
+    }
+
+    {
+        const auto start_time = std::chrono::steady_clock::now();
+
+        for (std::uint64_t round_i = 0; round_i < n_rounds; round_i++)
+        {
+            double sum = 0.0;
+
+            for (const yli::data::AnyValue& any_value : any_values)
+            {
+                sum += any_value.visit(
+                        [](const auto& value) -> double
+                        {
+                            using T = std::decay_t<decltype(value)>;
+
+                            if constexpr (std::is_arithmetic_v<T>)
+                            {
+                                return static_cast<double>(value);
+                            }
+                            else if constexpr (std::is_same_v<T, glm::vec3>)
+                            {
+                                return value.x;
+                            }
+                            else
+                            {
+                                return 0.0;
+                            }
+                        });
+            }
+
+            checksum += static_cast<std::uint64_t>(sum);
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        print_result("visit", n_values, n_rounds, elapsed.count());
+    }
+
+    {
+        const auto start_time = std::chrono::steady_clock::now();
+
+        for (std::uint64_t round_i = 0; round_i < n_rounds; round_i++)
+        {
+            for (const yli::data::AnyValue& any_value : any_values)
+            {
+                checksum += any_value.get_string().size();
+            }
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        print_result("get_string", n_values, n_rounds, elapsed.count());
+    }
+
+    std::cout << "checksum " << checksum << "\n";
+    return EXIT_SUCCESS;
+}
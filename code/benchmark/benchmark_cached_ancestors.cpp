@@ -0,0 +1,149 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Cached ancestor benchmark.
+//
+// Resolves the `Scene` and the `Pipeline` of `n_objects` `Object`s and
+// the `Scene` of `n_objects` `ShapeshifterSequence`s, as rendering does
+// every frame, first by walking up the hierarchy with `get_scene` and
+// `get_pipeline` and then through `get_cached_scene` and
+// `get_cached_pipeline`. Prints the time per resolution.
+//
+// usage: benchmark_cached_ancestors [n_objects] [n_frames]
+
+#include "code/mock/mock_application.hpp"
+#include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/ontology/scene.hpp"
+#include "code/ylikuutio/ontology/pipeline.hpp"
+#include "code/ylikuutio/ontology/material.hpp"
+#include "code/ylikuutio/ontology/species.hpp"
+#include "code/ylikuutio/ontology/object.hpp"
+#include "code/ylikuutio/ontology/shapeshifter_transformation.hpp"
+#include "code/ylikuutio/ontology/shapeshifter_sequence.hpp"
+#include "code/ylikuutio/ontology/request.hpp"
+#include "code/ylikuutio/ontology/texture_file_format.hpp"
+#include "code/ylikuutio/ontology/scene_struct.hpp"
+#include "code/ylikuutio/ontology/pipeline_struct.hpp"
+#include "code/ylikuutio/ontology/material_struct.hpp"
+#include "code/ylikuutio/ontology/species_struct.hpp"
+#include "code/ylikuutio/ontology/object_struct.hpp"
+#include "code/ylikuutio/ontology/shapeshifter_transformation_struct.hpp"
+#include "code/ylikuutio/ontology/shapeshifter_sequence_struct.hpp"
+
+// Include standard headers
+#include <chrono>   // std::chrono::duration, std::chrono::steady_clock
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <cstdlib>  // EXIT_SUCCESS, std::strtoull
+#include <iostream> // std::cout
+#include <vector>   // std::vector
+
+template<typename Resolve>
+static double time_per_resolution(const Resolve& resolve, const std::size_t n_resolutions, const std::uint64_t n_frames)
+{
+    const auto start_time = std::chrono::steady_clock::now();
+
+    for (std::uint64_t frame_i = 0; frame_i < n_frames; frame_i++)
+    {
+        resolve();
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    return elapsed.count() / static_cast<double>(n_resolutions * n_frames) * 1e9;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_objects = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000);
+    const std::uint64_t n_frames = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 200);
+
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(scene) };
+    yli::ontology::Pipeline* const pipeline = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+
+    yli::ontology::MaterialStruct material_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(pipeline),
+            yli::ontology::TextureFileFormat::PNG };
+    yli::ontology::Material* const material = application.get_generic_entity_factory().create_material(
+            material_struct);
+
+    yli::ontology::SpeciesStruct species_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(material) };
+    yli::ontology::Species* const species = application.get_generic_entity_factory().create_species(
+            species_struct);
+
+    yli::ontology::ShapeshifterTransformationStruct shapeshifter_transformation_struct { yli::ontology::Request(material) };
+    yli::ontology::ShapeshifterTransformation* const shapeshifter_transformation = application.get_generic_entity_factory().create_shapeshifter_transformation(
+            shapeshifter_transformation_struct);
+
+    std::vector<yli::ontology::Object*> objects;
+    std::vector<yli::ontology::ShapeshifterSequence*> shapeshifter_sequences;
+
+    for (std::uint64_t i = 0; i < n_objects; i++)
+    {
+        yli::ontology::ObjectStruct object_struct { yli::ontology::Request(scene) };
+        object_struct.species_master = yli::ontology::Request(species);
+        objects.emplace_back(application.get_generic_entity_factory().create_object(object_struct));
+
+        yli::ontology::ShapeshifterSequenceStruct shapeshifter_sequence_struct { yli::ontology::Request(shapeshifter_transformation) };
+        shapeshifter_sequences.emplace_back(application.get_generic_entity_factory().create_shapeshifter_sequence(
+                    shapeshifter_sequence_struct));
+    }
+
+    std::uint64_t checksum = 0;
+
+    const double walked_object_time = time_per_resolution([&]() {
+            for (const yli::ontology::Object* const object : objects)
+            {
+                checksum += (object->get_scene() != nullptr) + (object->get_pipeline() != nullptr);
+            }
+        }, objects.size(), n_frames);
+
+    const double cached_object_time = time_per_resolution([&]() {
+            for (const yli::ontology::Object* const object : objects)
+            {
+                checksum += (object->get_cached_scene() != nullptr) + (object->get_cached_pipeline() != nullptr);
+            }
+        }, objects.size(), n_frames);
+
+    const double walked_sequence_time = time_per_resolution([&]() {
+            for (const yli::ontology::ShapeshifterSequence* const shapeshifter_sequence : shapeshifter_sequences)
+            {
+                checksum += (shapeshifter_sequence->get_scene() != nullptr);
+            }
+        }, shapeshifter_sequences.size(), n_frames);
+
+    const double cached_sequence_time = time_per_resolution([&]() {
+            for (const yli::ontology::ShapeshifterSequence* const shapeshifter_sequence : shapeshifter_sequences)
+            {
+                checksum += (shapeshifter_sequence->get_cached_scene() != nullptr);
+            }
+        }, shapeshifter_sequences.size(), n_frames);
+
+    std::cout << "`Object` `Scene` and `Pipeline`, walked: " << walked_object_time << " ns, cached: " << cached_object_time << " ns\n";
+    std::cout << "`ShapeshifterSequence` `Scene`, walked: " << walked_sequence_time << " ns, cached: " << cached_sequence_time << " ns\n";
+    std::cout << "checksum: " << checksum << "\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Console completion benchmark.
+//
+// Generates `n_names` names, partly as dotted local names of nested
+// entities, and types each of the queries one character at a time,
+// updating the matches and fetching the first page after each keystroke
+// as Tab completion does. Prints the time per keystroke.
+//
+// usage: benchmark_completion [n_names]
+
+#include "code/ylikuutio/console/completion_engine.hpp"
+
+// Include standard headers
+#include <algorithm>   // std::max
+#include <chrono>      // std::chrono::duration, std::chrono::steady_clock
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <cstdlib>     // EXIT_SUCCESS, std::strtoull
+#include <iostream>    // std::cout
+#include <string>      // std::string, std::to_string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+static std::vector<std::string> generate_names(const std::uint64_t n_names)
+{
+    std::vector<std::string> names;
+    names.reserve(n_names);
+
+    for (std::uint64_t name_i = 0; names.size() < n_names; name_i++)
+    {
+        const std::string scene = "scene_" + std::to_string(name_i);
+        names.emplace_back(scene);
+
+        for (std::uint64_t object_i = 0; object_i < 8 && names.size() < n_names; object_i++)
+        {
+            const std::string object = scene + ".turbo_polizei_" + std::to_string(object_i);
+            names.emplace_back(object);
+
+            if (names.size() < n_names)
+            {
+                names.emplace_back(object + ".cartesian_coordinates");
+            }
+        }
+    }
+
+    return names;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_names = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000);
+    constexpr std::size_t page_size = 24;
+
+    yli::console::CompletionEngine completion_engine;
+    completion_engine.set_candidates(generate_names(n_names));
+
+    const std::vector<std::string_view> queries { "scene_12", "scene_9999.turbo", "tpol7", "sc1.cart", "xyz" };
+
+    for (const std::string_view query : queries)
+    {
+        double total_time = 0.0;
+        double max_time = 0.0;
+        std::size_t n_matches = 0;
+
+        // The empty input is the first keystroke.
+        for (std::size_t length = 0; length <= query.size(); length++)
+        {
+            const auto start_time = std::chrono::steady_clock::now();
+
+            n_matches = completion_engine.update(query.substr(0, length));
+            completion_engine.get_page(0, page_size);
+
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+            total_time += elapsed.count();
+            max_time = std::max(max_time, elapsed.count());
+        }
+
+        std::cout << "\"" << query << "\": " << n_matches << " matches, "
+            << total_time / (query.size() + 1) * 1e6 << " us per keystroke, "
+            << max_time * 1e6 << " us max\n";
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,152 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Hirvi position fusion benchmark.
+//
+// Generates `n_reports` position reports, spread over `n_targets`
+// targets. Honest reports are the position of the target plus noise,
+// every tenth report is a lie. Prints the time per report and the mean
+// position error of `TrivialDataAnalyzer` and of `RobustDataAnalyzer`
+// on one thread and on all hardware threads, and of streaming in new
+// reports of 1% of the reporters of each target.
+//
+// usage: benchmark_data_analyzer [n_reports] [n_targets]
+
+#include "code/hirvi/data/data_analyzer.hpp"
+#include "code/hirvi/data/position_report.hpp"
+#include "code/hirvi/data/robust_data_analyzer.hpp"
+#include "code/hirvi/data/spatial_data.hpp"
+#include "code/hirvi/data/trivial_data_analyzer.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <chrono>   // std::chrono::duration, std::chrono::steady_clock
+#include <cmath>    // std::isfinite
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <cstdlib>  // EXIT_SUCCESS, std::strtoull
+#include <iostream> // std::cout
+#include <memory>   // std::make_unique, std::unique_ptr
+#include <random>   // std::mt19937, std::normal_distribution, std::uniform_real_distribution
+#include <string>   // std::string
+#include <thread>   // std::thread
+#include <vector>   // std::vector
+
+static double get_mean_error(
+        const std::vector<std::unique_ptr<hirvi::data::SpatialData>>& targets,
+        const std::vector<glm::vec3>& positions)
+{
+    double total_error = 0.0;
+
+    for (std::size_t target_i = 0; target_i < targets.size(); target_i++)
+    {
+        const glm::vec3& position = targets[target_i]->get_determined_position();
+        const float error = glm::length(position - positions[target_i]);
+        total_error += (std::isfinite(error) ? error : 1e6);
+    }
+
+    return total_error / static_cast<double>(targets.size());
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_reports = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000);
+    const std::uint64_t n_targets = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000);
+    const std::uint64_t n_reports_per_target = n_reports / n_targets;
+
+    std::mt19937 generator(2026);
+    std::uniform_real_distribution<float> position_distribution(-1000.0f, 1000.0f);
+    std::normal_distribution<float> noise_distribution(0.0f, 0.2f);
+
+    const auto generate_report = [&](const glm::vec3& position, const std::size_t reporter_id)
+    {
+        if (reporter_id % 10 == 9)
+        {
+            return hirvi::data::PositionReport {
+                glm::vec3(position_distribution(generator), position_distribution(generator), position_distribution(generator)),
+                reporter_id };
+        }
+
+        return hirvi::data::PositionReport {
+            position + glm::vec3(noise_distribution(generator), noise_distribution(generator), noise_distribution(generator)),
+            reporter_id };
+    };
+
+    std::vector<glm::vec3> positions;
+    std::vector<std::unique_ptr<hirvi::data::SpatialData>> targets;
+    std::vector<hirvi::data::SpatialData*> spatial_datas;
+
+    for (std::uint64_t target_i = 0; target_i < n_targets; target_i++)
+    {
+        positions.emplace_back(position_distribution(generator), position_distribution(generator), position_distribution(generator));
+        targets.emplace_back(std::make_unique<hirvi::data::SpatialData>());
+        spatial_datas.emplace_back(targets.back().get());
+
+        for (std::uint64_t reporter_id = 0; reporter_id < n_reports_per_target; reporter_id++)
+        {
+            targets.back()->add_report(generate_report(positions.back(), reporter_id));
+        }
+    }
+
+    const hirvi::data::TrivialDataAnalyzer trivial_data_analyzer;
+    const hirvi::data::RobustDataAnalyzer robust_data_analyzer(1.0f, 0.1f);
+    const std::uint64_t n_analyzed_reports = n_reports_per_target * n_targets;
+
+    const auto run = [&](const std::string& name, const hirvi::data::DataAnalyzer& data_analyzer, const std::size_t n_threads)
+    {
+        const auto start_time = std::chrono::steady_clock::now();
+        hirvi::data::SpatialData::determine_positions_and_detect_traitors(spatial_datas, data_analyzer, n_threads);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+
+        std::cout << name << elapsed.count() / n_analyzed_reports * 1e9 << " ns per report, "
+            << elapsed.count() * 1e3 << " ms total, mean error " << get_mean_error(targets, positions) << "\n";
+    };
+
+    const std::size_t n_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    std::cout << n_analyzed_reports << " reports of " << n_targets << " targets\n";
+    run("trivial, 1 thread: ", trivial_data_analyzer, 1);
+    run("robust, 1 thread:  ", robust_data_analyzer, 1);
+
+    // Unchanged targets are not analyzed again, so stream in new reports for each run.
+    const auto stream_reports = [&](const std::uint64_t n_new_reports_per_target)
+    {
+        for (std::uint64_t target_i = 0; target_i < n_targets; target_i++)
+        {
+            for (std::uint64_t report_i = 0; report_i < n_new_reports_per_target; report_i++)
+            {
+                const std::size_t reporter_id = (report_i * 97) % n_reports_per_target;
+                targets[target_i]->add_report(generate_report(positions[target_i], reporter_id));
+            }
+        }
+    };
+
+    stream_reports(1);
+    run("robust, " + std::to_string(n_threads) + " threads: ", robust_data_analyzer, n_threads);
+
+    const auto start_time = std::chrono::steady_clock::now();
+    stream_reports(n_reports_per_target / 100 + 1);
+    const std::chrono::duration<double> stream_time = std::chrono::steady_clock::now() - start_time;
+    std::cout << "streaming 1% new reports: " << stream_time.count() * 1e3 << " ms\n";
+    run("robust after streaming: ", robust_data_analyzer, n_threads);
+
+    return EXIT_SUCCESS;
+}
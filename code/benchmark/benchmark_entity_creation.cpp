@@ -0,0 +1,144 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+// `Entity` creation benchmark.
+//
+// Creates `n_objects` named `Object`s in one `Scene`, first one at a time
+// with `create_object`, then in a new `Universe` at once with
+// `create_objects`, which reserves the memory and the child slots up
+// front, adds the names to the completions once at the end, and defers
+// the `Variable`s of each `Object` to their first use. Prints the time
+// per `Object` of both, and the time of then using the `Variable`s of
+// every bulk created `Object`.
+//
+// usage: benchmark_entity_creation [n_objects]
+
+#include "code/mock/mock_application.hpp"
+#include "code/ylikuutio/ontology/generic_entity_factory.hpp"
+#include "code/ylikuutio/ontology/scene.hpp"
+#include "code/ylikuutio/ontology/pipeline.hpp"
+#include "code/ylikuutio/ontology/material.hpp"
+#include "code/ylikuutio/ontology/species.hpp"
+#include "code/ylikuutio/ontology/object.hpp"
+#include "code/ylikuutio/ontology/request.hpp"
+#include "code/ylikuutio/ontology/texture_file_format.hpp"
+#include "code/ylikuutio/ontology/scene_struct.hpp"
+#include "code/ylikuutio/ontology/pipeline_struct.hpp"
+#include "code/ylikuutio/ontology/material_struct.hpp"
+#include "code/ylikuutio/ontology/species_struct.hpp"
+#include "code/ylikuutio/ontology/object_struct.hpp"
+
+// Include standard headers
+#include <chrono>   // std::chrono::duration, std::chrono::steady_clock
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <cstdlib>  // EXIT_SUCCESS, std::strtoull
+#include <iostream> // std::cout
+#include <string>   // std::string, std::to_string
+#include <vector>   // std::vector
+
+static std::vector<yli::ontology::ObjectStruct> create_object_structs(
+        yli::ontology::GenericEntityFactory& entity_factory,
+        const std::uint64_t n_objects)
+{
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = entity_factory.create_scene(scene_struct);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(scene) };
+    yli::ontology::Pipeline* const pipeline = entity_factory.create_pipeline(pipeline_struct);
+
+    yli::ontology::MaterialStruct material_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(pipeline),
+            yli::ontology::TextureFileFormat::PNG };
+    yli::ontology::Material* const material = entity_factory.create_material(material_struct);
+
+    yli::ontology::SpeciesStruct species_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(material) };
+    yli::ontology::Species* const species = entity_factory.create_species(species_struct);
+
+    std::vector<yli::ontology::ObjectStruct> object_structs;
+    object_structs.reserve(n_objects);
+
+    for (std::uint64_t object_i = 0; object_i < n_objects; object_i++)
+    {
+        yli::ontology::ObjectStruct object_struct {
+                yli::ontology::Request(scene),
+                yli::ontology::Request(species) };
+        object_struct.local_name = "object_" + std::to_string(object_i);
+        object_struct.cartesian_coordinates = {
+                static_cast<float>(object_i % 1000), 0.0f, static_cast<float>(object_i / 1000) };
+        object_structs.emplace_back(object_struct);
+    }
+
+    return object_structs;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_objects = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000);
+
+    if (n_objects == 0)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    {
+        mock::MockApplication application;
+        yli::ontology::GenericEntityFactory& entity_factory = application.get_generic_entity_factory();
+        const std::vector<yli::ontology::ObjectStruct> object_structs =
+                create_object_structs(entity_factory, n_objects);
+
+        const auto start_time = std::chrono::steady_clock::now();
+
+        for (const yli::ontology::ObjectStruct& object_struct : object_structs)
+        {
+            entity_factory.create_object(object_struct);
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        std::cout << "create_object:  " << elapsed.count() * 1e3 << " ms, "
+            << elapsed.count() / n_objects * 1e6 << " us per Object\n";
+    }
+
+    {
+        mock::MockApplication application;
+        yli::ontology::GenericEntityFactory& entity_factory = application.get_generic_entity_factory();
+        const std::vector<yli::ontology::ObjectStruct> object_structs =
+                create_object_structs(entity_factory, n_objects);
+
+        const auto start_time = std::chrono::steady_clock::now();
+        const std::vector<yli::ontology::Object*> objects = entity_factory.create_objects(object_structs);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        std::cout << "create_objects: " << elapsed.count() * 1e3 << " ms, "
+            << elapsed.count() / n_objects * 1e6 << " us per Object\n";
+
+        const auto use_start_time = std::chrono::steady_clock::now();
+        std::size_t n_variables = 0;
+
+        for (const yli::ontology::Object* const object : objects)
+        {
+            n_variables += object->get_number_of_variables();
+        }
+
+        const std::chrono::duration<double> use_elapsed = std::chrono::steady_clock::now() - use_start_time;
+        std::cout << "first use of " << n_variables << " deferred Variables: "
+            << use_elapsed.count() * 1e3 << " ms, " << use_elapsed.count() / n_objects * 1e6 << " us per Object\n";
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,103 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Headless simulation benchmark.
+//
+// Measures how many simulation ticks per second a headless `Universe` runs
+// when `n_objects` `Object`s are driven by a `go_east` `MovableController`.
+// The simulation rate is uncapped, so the result is bound only by the CPU.
+//
+// usage: benchmark_headless_ticks [n_objects] [n_ticks]
+
+#include "code/mock/mock_application.hpp"
+#include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/ontology/callback_engine.hpp"
+#include "code/ylikuutio/ontology/scene.hpp"
+#include "code/ylikuutio/ontology/object.hpp"
+#include "code/ylikuutio/ontology/movable_controller.hpp"
+#include "code/ylikuutio/ontology/request.hpp"
+#include "code/ylikuutio/ontology/scene_struct.hpp"
+#include "code/ylikuutio/ontology/object_struct.hpp"
+#include "code/ylikuutio/ontology/callback_engine_struct.hpp"
+#include "code/ylikuutio/ontology/movable_controller_struct.hpp"
+#include "code/ylikuutio/ontology/headless_simulation_struct.hpp"
+#include "code/ylikuutio/ontology/input_parameters_and_any_value_to_any_value_callback_with_universe.hpp"
+#include "code/ylikuutio/snippets/movable_controller_snippets.hpp"
+
+// Include standard headers
+#include <chrono>   // std::chrono::duration, std::chrono::steady_clock
+#include <cstdint>  // std::uint64_t
+#include <cstdlib>  // EXIT_FAILURE, EXIT_SUCCESS, std::strtoull
+#include <iostream> // std::cout, std::cerr
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_objects = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000);
+    const std::uint64_t n_ticks   = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000);
+
+    if (n_ticks == 0) [[unlikely]]
+    {
+        std::cerr << "ERROR: `main`: `n_ticks` must be greater than 0!\n";
+        return EXIT_FAILURE;
+    }
+
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+    universe.set_active_scene(scene);
+
+    yli::ontology::InputParametersAndAnyValueToAnyValueCallbackWithUniverse callback = &yli::snippets::go_east;
+
+    yli::ontology::CallbackEngineStruct go_east_callback_engine_struct;
+    yli::ontology::CallbackEngine* const go_east_callback_engine = application.get_generic_entity_factory().create_callback_engine(
+            go_east_callback_engine_struct);
+    go_east_callback_engine->create_callback_object(callback);
+
+    yli::ontology::MovableControllerStruct go_east_movable_controller_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(go_east_callback_engine) };
+    yli::ontology::MovableController* const go_east_movable_controller = application.get_generic_entity_factory().create_movable_controller(
+            go_east_movable_controller_struct);
+
+    for (std::uint64_t i = 0; i < n_objects; i++)
+    {
+        yli::ontology::ObjectStruct object_struct {
+                yli::ontology::Request(scene),
+                yli::ontology::Request(go_east_movable_controller) };
+        object_struct.cartesian_coordinates = { static_cast<float>(i % 1000), static_cast<float>(i / 1000), 0.0f };
+        object_struct.orientation =           { 0.0f, 0.0f, 0.0f };
+        application.get_generic_entity_factory().create_object(object_struct);
+    }
+
+    yli::ontology::HeadlessSimulationStruct headless_simulation_struct;
+    headless_simulation_struct.n_ticks = n_ticks;
+    headless_simulation_struct.ticks_per_second = 0.0f; // Uncapped.
+
+    const auto start_time = std::chrono::steady_clock::now();
+    const std::uint64_t n_ticks_run = universe.start_headless_simulation(headless_simulation_struct);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+
+    const double ticks_per_second = (elapsed.count() > 0.0 ? n_ticks_run / elapsed.count() : 0.0);
+
+    std::cout << "headless ticks: " << n_objects << " objects, " << n_ticks_run << " ticks in "
+        << elapsed.count() << " s, " << ticks_per_second << " ticks/s\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,174 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Heightmap line of sight benchmark.
+//
+// Generates a hilly heightmap of `size` x `size` samples and `n_rays`
+// rays between points 2 units above the terrain, at most 256 samples
+// apart, as the line of sight checks of AIs are. Prints the time per
+// ray of the batched queries, of single queries, and for comparison of
+// marching each ray in fixed steps of half a sample. Then computes the
+// viewshed of one static observer and prints the time per cached query.
+//
+// usage: benchmark_heightmap_visibility [size] [n_rays]
+
+#include "code/ylikuutio/geometry/heightmap_visibility.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::clamp, std::max
+#include <chrono>    // std::chrono::duration, std::chrono::steady_clock
+#include <cmath>     // std::abs, std::cos, std::sin
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint8_t, std::uint32_t, std::uint64_t
+#include <cstdlib>   // EXIT_SUCCESS, std::strtoull
+#include <iostream>  // std::cout
+#include <random>    // std::mt19937, std::uniform_real_distribution
+#include <vector>    // std::vector
+
+static std::vector<float> generate_hills(const std::uint32_t size)
+{
+    std::vector<float> altitudes;
+    altitudes.reserve(static_cast<std::size_t>(size) * size);
+
+    for (std::uint32_t j = 0; j < size; j++)
+    {
+        for (std::uint32_t i = 0; i < size; i++)
+        {
+            const float x = static_cast<float>(i);
+            const float z = static_cast<float>(j);
+            altitudes.emplace_back(
+                    40.0f * std::sin(0.013f * x) * std::cos(0.017f * z) +
+                    12.0f * std::sin(0.061f * x + 1.0f) * std::sin(0.047f * z) +
+                    3.0f * std::cos(0.23f * x) * std::cos(0.19f * z + 2.0f));
+        }
+    }
+
+    return altitudes;
+}
+
+static bool is_line_of_sight_by_steps(
+        const yli::geometry::HeightmapVisibility& heightmap_visibility,
+        const glm::vec3& from,
+        const glm::vec3& to)
+{
+    const float length = std::max(std::abs(to.x - from.x), std::abs(to.z - from.z));
+    const std::size_t n_steps = static_cast<std::size_t>(length * 2.0f) + 1;
+
+    for (std::size_t step_i = 0; step_i <= n_steps; step_i++)
+    {
+        const glm::vec3 point = from + (static_cast<float>(step_i) / static_cast<float>(n_steps)) * (to - from);
+
+        if (heightmap_visibility.get_altitude(point.x, point.z) > point.y)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint32_t size = static_cast<std::uint32_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024);
+    const std::uint64_t n_rays = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100000);
+    constexpr float max_distance = 256.0f;
+    constexpr float eye_altitude = 2.0f;
+
+    const yli::geometry::HeightmapVisibility heightmap_visibility(generate_hills(size), size, size);
+    const float max_coordinate = static_cast<float>(size - 1);
+
+    std::mt19937 generator(2026);
+    std::uniform_real_distribution<float> coordinate_distribution(0.0f, max_coordinate);
+    std::uniform_real_distribution<float> offset_distribution(-max_distance, max_distance);
+
+    std::vector<glm::vec3> from;
+    std::vector<glm::vec3> to;
+
+    for (std::uint64_t ray_i = 0; ray_i < n_rays; ray_i++)
+    {
+        const float x1 = coordinate_distribution(generator);
+        const float z1 = coordinate_distribution(generator);
+        const float x2 = std::clamp(x1 + offset_distribution(generator), 0.0f, max_coordinate);
+        const float z2 = std::clamp(z1 + offset_distribution(generator), 0.0f, max_coordinate);
+        from.emplace_back(x1, heightmap_visibility.get_altitude(x1, z1) + eye_altitude, z1);
+        to.emplace_back(x2, heightmap_visibility.get_altitude(x2, z2) + eye_altitude, z2);
+    }
+
+    std::vector<std::uint8_t> results(n_rays);
+    std::uint64_t n_visible = 0;
+
+    auto start_time = std::chrono::steady_clock::now();
+    heightmap_visibility.are_lines_of_sight(from.data(), to.data(), from.size(), results.data());
+    const std::chrono::duration<double> batched_time = std::chrono::steady_clock::now() - start_time;
+
+    for (const std::uint8_t result : results)
+    {
+        n_visible += result;
+    }
+
+    start_time = std::chrono::steady_clock::now();
+    std::uint64_t n_single_visible = 0;
+
+    for (std::uint64_t ray_i = 0; ray_i < n_rays; ray_i++)
+    {
+        n_single_visible += (heightmap_visibility.is_line_of_sight(from[ray_i], to[ray_i]) ? 1 : 0);
+    }
+
+    const std::chrono::duration<double> single_time = std::chrono::steady_clock::now() - start_time;
+
+    start_time = std::chrono::steady_clock::now();
+    std::uint64_t n_steps_visible = 0;
+
+    for (std::uint64_t ray_i = 0; ray_i < n_rays; ray_i++)
+    {
+        n_steps_visible += (is_line_of_sight_by_steps(heightmap_visibility, from[ray_i], to[ray_i]) ? 1 : 0);
+    }
+
+    const std::chrono::duration<double> steps_time = std::chrono::steady_clock::now() - start_time;
+
+    std::cout << size << " x " << size << " heightmap, " << heightmap_visibility.get_number_of_levels() << " levels, "
+        << n_rays << " rays, " << n_visible << " visible (" << n_single_visible << " single, " << n_steps_visible << " by steps)\n";
+    std::cout << "batched: " << batched_time.count() / n_rays * 1e9 << " ns per ray\n";
+    std::cout << "single:  " << single_time.count() / n_rays * 1e9 << " ns per ray\n";
+    std::cout << "steps:   " << steps_time.count() / n_rays * 1e9 << " ns per ray\n";
+
+    const glm::vec3 observer = from.front();
+    start_time = std::chrono::steady_clock::now();
+    const yli::geometry::Viewshed viewshed = heightmap_visibility.compute_viewshed(observer);
+    const std::chrono::duration<double> viewshed_time = std::chrono::steady_clock::now() - start_time;
+
+    start_time = std::chrono::steady_clock::now();
+    std::uint64_t n_viewshed_visible = 0;
+
+    for (const glm::vec3& target : to)
+    {
+        n_viewshed_visible += (viewshed.is_visible(target) ? 1 : 0);
+    }
+
+    const std::chrono::duration<double> cached_time = std::chrono::steady_clock::now() - start_time;
+
+    std::cout << "viewshed: " << viewshed_time.count() * 1e3 << " ms to compute, "
+        << cached_time.count() / n_rays * 1e9 << " ns per cached query, " << n_viewshed_visible << " visible\n";
+
+    return EXIT_SUCCESS;
+}
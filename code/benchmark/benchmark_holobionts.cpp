@@ -0,0 +1,214 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+// `Holobiont` transform benchmark.
+//
+// Creates `n_holobionts` `Holobiont`s of `n_symbiont_species` `Biont`s
+// each, and moves every `Holobiont` every frame. Compares the former
+// per-`Biont` work, which copied the location to each `Biont` and
+// computed the model matrix and the MVP matrix of each `Biont`, against
+// `Symbiosis::collect_biont_instances`, which computes the model matrix
+// of each `Holobiont` once and offsets it for each `Biont`. Prints the
+// CPU time per frame. The batched `Biont`s are then drawn with one
+// instanced draw call per `SymbiontSpecies` instead of one draw call
+// per `Biont`.
+//
+// usage: benchmark_holobionts [n_holobionts] [n_symbiont_species] [n_frames]
+
+#include "code/mock/mock_application.hpp"
+#include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/ontology/scene.hpp"
+#include "code/ylikuutio/ontology/pipeline.hpp"
+#include "code/ylikuutio/ontology/symbiosis.hpp"
+#include "code/ylikuutio/ontology/symbiont_material.hpp"
+#include "code/ylikuutio/ontology/symbiont_species.hpp"
+#include "code/ylikuutio/ontology/holobiont.hpp"
+#include "code/ylikuutio/ontology/biont.hpp"
+#include "code/ylikuutio/ontology/cartesian_coordinates_module.hpp"
+#include "code/ylikuutio/ontology/request.hpp"
+#include "code/ylikuutio/ontology/scene_struct.hpp"
+#include "code/ylikuutio/ontology/pipeline_struct.hpp"
+#include "code/ylikuutio/ontology/symbiosis_struct.hpp"
+#include "code/ylikuutio/ontology/symbiont_material_struct.hpp"
+#include "code/ylikuutio/ontology/symbiont_species_struct.hpp"
+#include "code/ylikuutio/ontology/holobiont_struct.hpp"
+#include "code/ylikuutio/ontology/biont_struct.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+#ifndef __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#define __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#include <glm/gtc/matrix_transform.hpp>
+#endif
+
+#ifndef __GLM_GTC_QUATERNION_HPP_INCLUDED
+#define __GLM_GTC_QUATERNION_HPP_INCLUDED
+#include <glm/gtc/quaternion.hpp> // glm::quat
+#endif
+
+// Include standard headers
+#include <chrono>   // std::chrono::duration, std::chrono::steady_clock
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <cstdlib>  // EXIT_SUCCESS, std::strtoull
+#include <iostream> // std::cout
+#include <vector>   // std::vector
+
+// The former per-`Biont` work of `Biont::render_this_biont`, without the draw call.
+static float render_biont_the_former_way(const yli::ontology::Universe& universe, yli::ontology::Biont& biont)
+{
+    const auto* const holobiont = static_cast<const yli::ontology::Holobiont*>(biont.get_parent());
+
+    if (holobiont == nullptr || holobiont->get_symbiosis() == nullptr ||
+            biont.apprentice_of_symbiont_species.get_master() == nullptr) [[unlikely]]
+    {
+        return 0.0f;
+    }
+
+    glm::mat4 model_matrix { 1.0f };
+
+    for (std::size_t i = 0; i < biont.initial_rotate_vectors.size() && i < biont.initial_rotate_angles.size(); i++)
+    {
+        model_matrix = glm::rotate(model_matrix, biont.initial_rotate_angles[i], biont.initial_rotate_vectors[i]);
+    }
+
+    model_matrix = glm::scale(model_matrix, holobiont->get_scale() * biont.original_scale_vector);
+    const glm::vec3 euler_angles { holobiont->orientation.roll, -holobiont->orientation.pitch, holobiont->orientation.yaw };
+    model_matrix = glm::mat4_cast(glm::quat(euler_angles)) * model_matrix;
+    model_matrix[3][0] = holobiont->location.get_x();
+    model_matrix[3][1] = holobiont->location.get_y();
+    model_matrix[3][2] = holobiont->location.get_z();
+
+    const glm::mat4 mvp_matrix = universe.get_projection_matrix() * universe.get_view_matrix() * model_matrix;
+    return mvp_matrix[3][1];
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_holobionts = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000);
+    const std::uint64_t n_symbiont_species = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 8);
+    const std::uint64_t n_frames = (argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 100);
+
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(scene) };
+    yli::ontology::Pipeline* const pipeline = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+
+    yli::ontology::SymbiosisStruct symbiosis_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(pipeline) };
+    yli::ontology::Symbiosis* const symbiosis = application.get_generic_entity_factory().create_symbiosis(
+            symbiosis_struct);
+
+    yli::ontology::SymbiontMaterialStruct symbiont_material_struct { yli::ontology::Request(symbiosis) };
+    yli::ontology::SymbiontMaterial* const symbiont_material = application.get_generic_entity_factory().create_symbiont_material(
+            symbiont_material_struct);
+
+    std::vector<yli::ontology::SymbiontSpecies*> symbiont_species_vector;
+
+    for (std::uint64_t species_i = 0; species_i < n_symbiont_species; species_i++)
+    {
+        yli::ontology::SymbiontSpeciesStruct symbiont_species_struct { yli::ontology::Request(symbiont_material) };
+        symbiont_species_vector.push_back(application.get_generic_entity_factory().create_symbiont_species(
+                    symbiont_species_struct));
+    }
+
+    std::vector<yli::ontology::Holobiont*> holobionts;
+    std::vector<yli::ontology::Biont*> bionts;
+
+    for (std::uint64_t holobiont_i = 0; holobiont_i < n_holobionts; holobiont_i++)
+    {
+        yli::ontology::HolobiontStruct holobiont_struct {
+                yli::ontology::Request(scene),
+                yli::ontology::Request(symbiosis) };
+        holobiont_struct.cartesian_coordinates = yli::ontology::CartesianCoordinatesModule(
+                static_cast<float>(holobiont_i % 100), 0.0f, static_cast<float>(holobiont_i / 100));
+        yli::ontology::Holobiont* const holobiont = application.get_generic_entity_factory().create_holobiont(
+                holobiont_struct);
+        holobiont->should_render = true;
+        holobionts.push_back(holobiont);
+
+        for (yli::ontology::SymbiontSpecies* const symbiont_species : symbiont_species_vector)
+        {
+            yli::ontology::BiontStruct biont_struct {
+                    yli::ontology::Request(holobiont),
+                    yli::ontology::Request(scene),
+                    yli::ontology::Request(symbiont_species) };
+            biont_struct.local_offset = glm::vec3(0.0f, 0.5f * static_cast<float>(bionts.size() % n_symbiont_species), 0.0f);
+            bionts.push_back(application.get_generic_entity_factory().create_biont(biont_struct));
+        }
+    }
+
+    // Per-`Biont`: copy the location to each `Biont` and compute the model matrix of each `Biont`.
+    auto start_time = std::chrono::steady_clock::now();
+    float checksum = 0.0f;
+
+    for (std::uint64_t frame_i = 0; frame_i < n_frames; frame_i++)
+    {
+        const float y = 0.01f * static_cast<float>(frame_i);
+
+        for (yli::ontology::Holobiont* const holobiont : holobionts)
+        {
+            holobiont->location.set_y(y);
+
+            for (yli::ontology::Entity* const biont_entity : holobiont->parent_of_bionts.child_pointer_vector)
+            {
+                auto* const biont = static_cast<yli::ontology::Biont*>(biont_entity);
+                biont->location.set_y(y);
+                checksum += render_biont_the_former_way(application.get_universe(), *biont);
+            }
+        }
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    const double per_biont_frame_time = elapsed.count() / static_cast<double>(n_frames);
+
+    // Per-`Holobiont`: move only the `Holobiont`s and collect the `Biont`s by `SymbiontSpecies`.
+    start_time = std::chrono::steady_clock::now();
+    std::size_t n_instances = 0;
+
+    for (std::uint64_t frame_i = 0; frame_i < n_frames; frame_i++)
+    {
+        const float y = 0.01f * static_cast<float>(frame_i);
+
+        for (yli::ontology::Holobiont* const holobiont : holobionts)
+        {
+            holobiont->location.set_y(y);
+        }
+
+        n_instances = symbiosis->collect_biont_instances(scene);
+        checksum += symbiont_species_vector.front()->biont_instances.get_model_matrices().front()[3][1];
+    }
+
+    elapsed = std::chrono::steady_clock::now() - start_time;
+    const double per_holobiont_frame_time = elapsed.count() / static_cast<double>(n_frames);
+
+    std::cout << n_holobionts << " holobionts, " << bionts.size() << " bionts, checksum " << checksum << "\n";
+    std::cout << "per biont: " << per_biont_frame_time * 1e3 << " ms per frame, "
+        << bionts.size() << " draw calls per frame\n";
+    std::cout << "per holobiont: " << per_holobiont_frame_time * 1e3 << " ms per frame, "
+        << n_instances << " instances in " << n_symbiont_species << " draw calls per frame\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,142 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// YliLisp parser benchmark.
+//
+// Generates a script of `n_forms` top-level forms and parses it
+// `n_rounds` times with `Scanner` followed by `Parser`, and with `FlatParser`.
+// The time includes destroying the syntax trees.
+//
+// usage: benchmark_lisp_parser [n_forms] [n_rounds]
+
+#include "code/ylikuutio/lisp/scanner.hpp"
+#include "code/ylikuutio/lisp/parser.hpp"
+#include "code/ylikuutio/lisp/syntax_tree_list.hpp"
+#include "code/ylikuutio/lisp/expr.hpp"
+#include "code/ylikuutio/lisp/flat_parser.hpp"
+#include "code/ylikuutio/lisp/flat_syntax_tree.hpp"
+
+// Include standard headers
+#include <chrono>   // std::chrono::duration, std::chrono::steady_clock
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <cstdlib>  // EXIT_FAILURE, EXIT_SUCCESS, std::strtoull
+#include <iostream> // std::cout, std::cerr
+#include <string>   // std::string, std::to_string
+
+static std::string generate_script(const std::uint64_t n_forms)
+{
+    std::string script;
+
+    for (std::uint64_t form_i = 0; form_i < n_forms; form_i++)
+    {
+        const std::string i = std::to_string(form_i);
+        script += "; agent " + i + "\n";
+        script += "(defun agent_" + i + " (x y)\n";
+        script += "    (if (lt x " + i + ") (add x 1.5) (print \"agent " + i + "\" x -" + i + " (mul y y))))\n";
+    }
+
+    return script;
+}
+
+static std::size_t count_exprs(const yli::lisp::Expr& expr)
+{
+    std::size_t n_exprs = 1;
+
+    for (std::size_t child_i = 0; child_i < expr.get_number_of_children(); child_i++)
+    {
+        n_exprs += count_exprs(expr.at(child_i));
+    }
+
+    return n_exprs;
+}
+
+static void print_result(const std::string& name, const std::size_t n_bytes, const std::uint64_t n_rounds, const double elapsed)
+{
+    std::cout << name << ": " << elapsed / n_rounds * 1000.0 << " ms per parse, "
+        << n_bytes * n_rounds / elapsed / (1024.0 * 1024.0) << " MiB/s\n";
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_forms = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000);
+    const std::uint64_t n_rounds = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 10);
+
+    const std::string script = generate_script(n_forms);
+    std::cout << "script: " << n_forms << " forms, " << script.size() / (1024.0 * 1024.0) << " MiB\n";
+
+    std::size_t n_exprs = 0;
+    std::size_t n_flat_exprs = 0;
+
+    {
+        const auto start_time = std::chrono::steady_clock::now();
+
+        for (std::uint64_t round_i = 0; round_i < n_rounds; round_i++)
+        {
+            const yli::lisp::Scanner scanner(script);
+            const yli::lisp::Parser parser(scanner.get_token_list());
+
+            if (!scanner.get_is_success() || !parser.get_is_success()) [[unlikely]]
+            {
+                std::cerr << "ERROR: `main`: `Parser` failed!\n";
+                return EXIT_FAILURE;
+            }
+
+            if (round_i == 0)
+            {
+                const yli::lisp::SyntaxTreeList& syntax_tree_list = parser.get_syntax_tree_list();
+
+                for (std::size_t i = 0; i < syntax_tree_list.size(); i++)
+                {
+                    n_exprs += count_exprs(syntax_tree_list.at(i));
+                }
+            }
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        print_result("Scanner + Parser", script.size(), n_rounds, elapsed.count());
+    }
+
+    {
+        const auto start_time = std::chrono::steady_clock::now();
+
+        for (std::uint64_t round_i = 0; round_i < n_rounds; round_i++)
+        {
+            const yli::lisp::FlatParser flat_parser(script);
+
+            if (!flat_parser.get_is_success()) [[unlikely]]
+            {
+                std::cerr << "ERROR: `main`: `FlatParser` failed!\n";
+                return EXIT_FAILURE;
+            }
+
+            n_flat_exprs = flat_parser.get_syntax_tree().get_number_of_nodes();
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        print_result("FlatParser", script.size(), n_rounds, elapsed.count());
+    }
+
+    if (n_exprs != n_flat_exprs) [[unlikely]]
+    {
+        std::cerr << "ERROR: `main`: the parsers produced different numbers of expressions!\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << n_exprs << " expressions\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,261 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// YliLisp execution benchmark.
+//
+// Each agent is a `Variable` of the `Universe` holding its heading in degrees,
+// and each tick every agent runs a script that reads its heading and steers.
+// The script is executed in three ways:
+//
+// 1. Interpreted: the command strings are parsed with `legacy_parse` and
+//    executed with `legacy_executor`, which looks up the `ConsoleLispFunction`
+//    by name and converts the string parameters for each call. As the
+//    interpreter has no conditionals, `heading` and `steer` are separate commands.
+// 2. VM, console functions: the script is compiled once and `VirtualMachine`
+//    calls the same `ConsoleLispFunction`s through cached bindings.
+// 3. VM, native functions: as above, but `heading` and `steer` are native functions
+//    that resolve the agent through the entity cache of `VirtualMachine`.
+//
+// usage: benchmark_lisp_vm [n_agents] [n_ticks]
+
+#include "code/mock/mock_application.hpp"
+#include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/lisp/legacy_executor.hpp"
+#include "code/ylikuutio/lisp/legacy_parser.hpp"
+#include "code/ylikuutio/lisp/value.hpp"
+#include "code/ylikuutio/lisp/virtual_machine.hpp"
+#include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/ontology/console.hpp"
+#include "code/ylikuutio/ontology/variable.hpp"
+#include "code/ylikuutio/ontology/request.hpp"
+#include "code/ylikuutio/ontology/console_struct.hpp"
+#include "code/ylikuutio/ontology/variable_struct.hpp"
+
+// Include standard headers
+#include <chrono>   // std::chrono::duration, std::chrono::steady_clock
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint32_t, std::uint64_t
+#include <cstdlib>  // EXIT_FAILURE, EXIT_SUCCESS, std::strtoull
+#include <iostream> // std::cout, std::cerr
+#include <optional> // std::nullopt, std::optional
+#include <span>     // std::span
+#include <string>   // std::string, std::to_string
+#include <vector>   // std::vector
+
+static float get_heading(const yli::ontology::Variable& agent)
+{
+    const std::optional<yli::data::AnyValue> value = agent.get();
+
+    if (value.has_value() && value->holds<float>())
+    {
+        return value->get<float>();
+    }
+
+    return 0.0f;
+}
+
+static void steer_agent(yli::ontology::Variable& agent, const float turn)
+{
+    float heading = get_heading(agent) + turn;
+    heading = (heading >= 360.0f ? heading - 360.0f : (heading < 0.0f ? heading + 360.0f : heading));
+    agent.set(yli::data::AnyValue(heading));
+}
+
+static std::optional<yli::data::AnyValue> heading(const yli::ontology::Variable& agent)
+{
+    return yli::data::AnyValue(get_heading(agent));
+}
+
+static std::optional<yli::data::AnyValue> steer(yli::ontology::Variable& agent, const float turn)
+{
+    steer_agent(agent, turn);
+    return std::nullopt;
+}
+
+static double seconds_since(const std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void print_result(const char* const label, const double seconds, const std::uint64_t n_agents, const std::uint64_t n_ticks)
+{
+    std::cout << label << ": " << seconds << " s, " <<
+        (seconds * 1e9 / static_cast<double>(n_agents * n_ticks)) << " ns per agent per tick\n";
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_agents = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 500);
+    const std::uint64_t n_ticks  = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000);
+
+    if (n_agents == 0 || n_ticks == 0) [[unlikely]]
+    {
+        std::cerr << "ERROR: `main`: `n_agents` and `n_ticks` must be greater than 0!\n";
+        return EXIT_FAILURE;
+    }
+
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    yli::ontology::ConsoleStruct console_struct(0, 39, 15, 0); // Some dummy dimensions.
+    yli::ontology::Console* const console = application.get_generic_entity_factory().create_console(console_struct);
+
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "heading", yli::ontology::Request<yli::ontology::Console>(console), &heading);
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "steer", yli::ontology::Request<yli::ontology::Console>(console), &steer);
+
+    std::vector<std::string> agent_names;
+
+    for (std::uint64_t i = 0; i < n_agents; i++)
+    {
+        agent_names.emplace_back("agent_" + std::to_string(i));
+        yli::ontology::VariableStruct variable_struct(universe, &universe);
+        variable_struct.local_name = agent_names.back();
+        universe.create_variable(variable_struct, yli::data::AnyValue(static_cast<float>(i % 360)));
+    }
+
+    std::cout << "agents: " << n_agents << ", ticks: " << n_ticks << "\n";
+
+    // 1. Interpreted.
+    {
+        std::vector<std::string> heading_commands;
+        std::vector<std::string> steer_commands;
+
+        for (const std::string& agent_name : agent_names)
+        {
+            heading_commands.emplace_back("heading " + agent_name);
+            steer_commands.emplace_back("steer " + agent_name + " 0.5");
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (std::uint64_t tick = 0; tick < n_ticks; tick++)
+        {
+            for (std::size_t i = 0; i < n_agents; i++)
+            {
+                for (const std::string* const input : { &heading_commands[i], &steer_commands[i] })
+                {
+                    std::string command;
+                    std::vector<std::string> parameter_vector;
+
+                    if (yli::lisp::legacy_parse(*input, command, parameter_vector))
+                    {
+                        yli::lisp::execute(*console, command, parameter_vector);
+                    }
+                }
+            }
+        }
+
+        print_result("interpreted", seconds_since(start), n_agents, n_ticks);
+    }
+
+    const char* const script = "(defun think (agent) (steer agent (if (lt (heading agent) 180.0) 0.5 -0.5)))";
+
+    // 2. VM calling the console lisp functions.
+    {
+        yli::lisp::VirtualMachine virtual_machine(universe);
+        virtual_machine.define_console_lisp_function(*console, "heading");
+        virtual_machine.define_console_lisp_function(*console, "steer");
+
+        if (!virtual_machine.load(script).has_value()) [[unlikely]]
+        {
+            return EXIT_FAILURE;
+        }
+
+        const std::uint32_t think = virtual_machine.intern("think");
+        std::vector<yli::lisp::Value> agents;
+
+        for (const std::string& agent_name : agent_names)
+        {
+            agents.emplace_back(yli::lisp::Value::from_symbol(virtual_machine.intern(agent_name)));
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (std::uint64_t tick = 0; tick < n_ticks; tick++)
+        {
+            for (const yli::lisp::Value& agent : agents)
+            {
+                virtual_machine.call(think, std::span<const yli::lisp::Value>(&agent, 1));
+            }
+        }
+
+        print_result("VM, console functions", seconds_since(start), n_agents, n_ticks);
+    }
+
+    // 3. VM calling native functions.
+    {
+        yli::lisp::VirtualMachine virtual_machine(universe);
+
+        virtual_machine.define_native_function(
+                "heading",
+                [](yli::lisp::VirtualMachine& vm, std::span<const yli::lisp::Value> arguments) -> std::optional<yli::lisp::Value>
+                {
+                    auto* const agent = (arguments.size() == 1 ? dynamic_cast<yli::ontology::Variable*>(vm.resolve_entity(arguments[0])) : nullptr);
+
+                    if (agent == nullptr) [[unlikely]]
+                    {
+                        return std::nullopt;
+                    }
+
+                    return yli::lisp::Value::from_floating_point(get_heading(*agent));
+                });
+        virtual_machine.define_native_function(
+                "steer",
+                [](yli::lisp::VirtualMachine& vm, std::span<const yli::lisp::Value> arguments) -> std::optional<yli::lisp::Value>
+                {
+                    auto* const agent = (arguments.size() == 2 ? dynamic_cast<yli::ontology::Variable*>(vm.resolve_entity(arguments[0])) : nullptr);
+                    const std::optional<double> turn = (arguments.size() == 2 ? arguments[1].get_floating_point() : std::nullopt);
+
+                    if (agent == nullptr || !turn.has_value()) [[unlikely]]
+                    {
+                        return std::nullopt;
+                    }
+
+                    steer_agent(*agent, static_cast<float>(*turn));
+                    return yli::lisp::Value::nil();
+                });
+
+        if (!virtual_machine.load(script).has_value()) [[unlikely]]
+        {
+            return EXIT_FAILURE;
+        }
+
+        const std::uint32_t think = virtual_machine.intern("think");
+        std::vector<yli::lisp::Value> agents;
+
+        for (const std::string& agent_name : agent_names)
+        {
+            agents.emplace_back(yli::lisp::Value::from_symbol(virtual_machine.intern(agent_name)));
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (std::uint64_t tick = 0; tick < n_ticks; tick++)
+        {
+            for (const yli::lisp::Value& agent : agents)
+            {
+                virtual_machine.call(think, std::span<const yli::lisp::Value>(&agent, 1));
+            }
+        }
+
+        print_result("VM, native functions", seconds_since(start), n_agents, n_ticks);
+    }
+
+    return EXIT_SUCCESS;
+}
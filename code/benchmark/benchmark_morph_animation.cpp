@@ -0,0 +1,142 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Morph target animation benchmark.
+//
+// Animates `n_instances` instances of a transformation of 8 forms of
+// `n_vertices` vertices each, in `n_phase_groups` groups out of step
+// with each other, as `Shapeshifter`s of one `ShapeshifterSequence`
+// with different time offsets are. Blending each distinct phase once
+// with `MorphEvaluator` is compared against blending each instance
+// separately. Prints the time and the bytes written per frame.
+//
+// usage: benchmark_morph_animation [n_instances] [n_vertices] [n_phase_groups]
+
+#include "code/ylikuutio/animation/morph_animation.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <chrono>   // std::chrono::duration, std::chrono::steady_clock
+#include <cmath>    // std::cos, std::sin
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint32_t, std::uint64_t
+#include <cstdlib>  // EXIT_SUCCESS, std::strtoull
+#include <iostream> // std::cout
+#include <vector>   // std::vector
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_instances = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000);
+    const std::uint64_t n_vertices = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2000);
+    const std::uint64_t n_phase_groups = (argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 16);
+    constexpr std::size_t n_forms = 8;
+    constexpr std::size_t n_frames = 20;
+
+    yli::animation::MorphTargetBuffer morph_target_buffer;
+
+    for (std::size_t form_i = 0; form_i < n_forms; form_i++)
+    {
+        std::vector<glm::vec3> vertices;
+        std::vector<glm::vec3> normals;
+
+        for (std::uint64_t vertex_i = 0; vertex_i < n_vertices; vertex_i++)
+        {
+            const float angle = 0.01f * static_cast<float>(vertex_i) + 0.3f * static_cast<float>(form_i);
+            vertices.emplace_back(std::cos(angle), std::sin(angle), 0.001f * static_cast<float>(vertex_i));
+            normals.emplace_back(std::cos(angle), std::sin(angle), 0.0f);
+        }
+
+        morph_target_buffer.add_form(vertices, normals);
+    }
+
+    yli::animation::MorphPlayback playback;
+    playback.speed = 3.0f;
+
+    const std::size_t n_components = morph_target_buffer.get_number_of_components();
+    yli::animation::MorphEvaluator morph_evaluator;
+    std::vector<std::uint32_t> slots(n_instances);
+    std::vector<float> per_instance_results(n_instances * n_components * n_vertices);
+
+    double shared_time = 0.0;
+    double per_instance_time = 0.0;
+    std::size_t n_slots = 0;
+    float checksum = 0.0f;
+
+    for (std::size_t frame_i = 0; frame_i < n_frames; frame_i++)
+    {
+        const double time = static_cast<double>(frame_i) / 60.0;
+
+        // Shared per distinct phase.
+        auto start_time = std::chrono::steady_clock::now();
+
+        morph_evaluator.begin_frame();
+
+        for (std::uint64_t instance_i = 0; instance_i < n_instances; instance_i++)
+        {
+            const double time_offset = 0.1 * static_cast<double>(instance_i % n_phase_groups);
+            slots[instance_i] = morph_evaluator.request(yli::animation::get_morph_phase(playback, n_forms, time + time_offset));
+        }
+
+        morph_evaluator.evaluate(morph_target_buffer);
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        shared_time += elapsed.count();
+        n_slots = morph_evaluator.get_number_of_slots();
+        checksum += morph_evaluator.get_component(slots[n_instances - 1], 0)[0];
+
+        // Blended separately for each instance.
+        start_time = std::chrono::steady_clock::now();
+
+        for (std::uint64_t instance_i = 0; instance_i < n_instances; instance_i++)
+        {
+            const double time_offset = 0.1 * static_cast<double>(instance_i % n_phase_groups);
+            const yli::animation::MorphPhase phase = yli::animation::get_morph_phase(playback, n_forms, time + time_offset);
+
+            for (std::size_t component = 0; component < n_components; component++)
+            {
+                const float* const a = morph_target_buffer.get_component(phase.current_form, component);
+                const float* const b = morph_target_buffer.get_component(phase.next_form, component);
+                float* const result = per_instance_results.data() + (instance_i * n_components + component) * n_vertices;
+
+                for (std::uint64_t vertex_i = 0; vertex_i < n_vertices; vertex_i++)
+                {
+                    result[vertex_i] = a[vertex_i] + (b[vertex_i] - a[vertex_i]) * phase.blend;
+                }
+            }
+        }
+
+        elapsed = std::chrono::steady_clock::now() - start_time;
+        per_instance_time += elapsed.count();
+        checksum += per_instance_results[(n_instances - 1) * n_components * n_vertices];
+    }
+
+    const double mesh_bytes = static_cast<double>(n_components * n_vertices * sizeof(float));
+
+    std::cout << n_instances << " instances, " << n_vertices << " vertices, " << n_slots << " distinct phases\n";
+    std::cout << "shared per phase: " << shared_time / n_frames * 1e3 << " ms per frame, "
+        << static_cast<double>(n_slots) * mesh_bytes / 1e6 << " MB written per frame\n";
+    std::cout << "per instance: " << per_instance_time / n_frames * 1e3 << " ms per frame, "
+        << static_cast<double>(n_instances) * mesh_bytes / 1e6 << " MB written per frame\n";
+    std::cout << "checksum: " << checksum << "\n";
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,136 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// `MovableController` callback benchmark.
+//
+// Measures the time per controlled `Movable` of `MovableController::update`
+// when `n_objects` `Object`s are driven by a `go_east` `CallbackEngine`,
+// first through the generic `CallbackObject` callback and then through
+// the compiled `MovableAndArgumentsToVoidCallback` thunks.
+//
+// usage: benchmark_movable_callbacks [n_objects] [n_updates]
+
+#include "code/mock/mock_application.hpp"
+#include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/ontology/callback_engine.hpp"
+#include "code/ylikuutio/ontology/scene.hpp"
+#include "code/ylikuutio/ontology/object.hpp"
+#include "code/ylikuutio/ontology/movable_controller.hpp"
+#include "code/ylikuutio/ontology/request.hpp"
+#include "code/ylikuutio/ontology/scene_struct.hpp"
+#include "code/ylikuutio/ontology/object_struct.hpp"
+#include "code/ylikuutio/ontology/callback_engine_struct.hpp"
+#include "code/ylikuutio/ontology/movable_controller_struct.hpp"
+#include "code/ylikuutio/ontology/input_parameters_and_any_value_to_any_value_callback_with_universe.hpp"
+#include "code/ylikuutio/ontology/movable_and_arguments_to_void_callback.hpp"
+#include "code/ylikuutio/snippets/movable_controller_snippets.hpp"
+
+// Include standard headers
+#include <chrono>   // std::chrono::duration, std::chrono::steady_clock
+#include <cstdint>  // std::uint64_t
+#include <cstdlib>  // EXIT_FAILURE, EXIT_SUCCESS, std::strtoull
+#include <iostream> // std::cout, std::cerr
+#include <string>   // std::string
+
+static yli::ontology::MovableController* create_controlled_objects(
+        mock::MockApplication& application,
+        yli::ontology::Scene* const scene,
+        yli::ontology::CallbackEngine* const callback_engine,
+        const std::uint64_t n_objects)
+{
+    yli::ontology::MovableControllerStruct movable_controller_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(callback_engine) };
+    yli::ontology::MovableController* const movable_controller = application.get_generic_entity_factory().create_movable_controller(
+            movable_controller_struct);
+
+    for (std::uint64_t i = 0; i < n_objects; i++)
+    {
+        yli::ontology::ObjectStruct object_struct {
+                yli::ontology::Request(scene),
+                yli::ontology::Request(movable_controller) };
+        object_struct.cartesian_coordinates = { static_cast<float>(i % 1000), static_cast<float>(i / 1000), 0.0f };
+        object_struct.orientation =           { 0.0f, 0.0f, 0.0f };
+        application.get_generic_entity_factory().create_object(object_struct);
+    }
+
+    return movable_controller;
+}
+
+static void run(
+        const std::string& name,
+        const yli::ontology::MovableController& movable_controller,
+        const std::uint64_t n_objects,
+        const std::uint64_t n_updates)
+{
+    movable_controller.update(); // Warm up, also compiles the thunks.
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    for (std::uint64_t i = 0; i < n_updates; i++)
+    {
+        movable_controller.update();
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    const double ns_per_movable = 1e9 * elapsed.count() / static_cast<double>(n_objects * n_updates);
+
+    std::cout << name << ": " << n_objects << " movables, " << n_updates << " updates in "
+        << elapsed.count() << " s, " << ns_per_movable << " ns/movable\n";
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_objects = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000);
+    const std::uint64_t n_updates = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000);
+
+    if (n_objects == 0 || n_updates == 0) [[unlikely]]
+    {
+        std::cerr << "ERROR: `main`: `n_objects` and `n_updates` must be greater than 0!\n";
+        return EXIT_FAILURE;
+    }
+
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+    universe.set_active_scene(scene);
+
+    yli::ontology::InputParametersAndAnyValueToAnyValueCallbackWithUniverse callback = &yli::snippets::go_east;
+    yli::ontology::CallbackEngineStruct generic_callback_engine_struct;
+    yli::ontology::CallbackEngine* const generic_callback_engine = application.get_generic_entity_factory().create_callback_engine(
+            generic_callback_engine_struct);
+    generic_callback_engine->create_callback_object(callback);
+
+    yli::ontology::MovableAndArgumentsToVoidCallback movable_callback = &yli::snippets::go_east;
+    yli::ontology::CallbackEngineStruct typed_callback_engine_struct;
+    yli::ontology::CallbackEngine* const typed_callback_engine = application.get_generic_entity_factory().create_callback_engine(
+            typed_callback_engine_struct);
+    typed_callback_engine->create_movable_callback_object(movable_callback);
+
+    const yli::ontology::MovableController* const generic_movable_controller =
+        create_controlled_objects(application, scene, generic_callback_engine, n_objects);
+    const yli::ontology::MovableController* const typed_movable_controller =
+        create_controlled_objects(application, scene, typed_callback_engine, n_objects);
+
+    run("generic callbacks", *generic_movable_controller, n_objects, n_updates);
+    run("typed thunks", *typed_movable_controller, n_objects, n_updates);
+
+    return EXIT_SUCCESS;
+}
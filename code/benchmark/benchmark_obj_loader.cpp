@@ -0,0 +1,296 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// OBJ loader benchmark.
+//
+// Writes a grid of `n_triangles` triangles into a temporary OBJ file and
+// loads it with the line-by-line `std::string` parser that `load_obj` used
+// before, and with `load_obj` using 1 thread and all hardware threads.
+//
+// usage: benchmark_obj_loader [n_triangles] [obj_filename]
+//
+// If `obj_filename` is given, that file is loaded instead of a generated one.
+
+#include "code/ylikuutio/load/obj_loader.hpp"
+#include "code/ylikuutio/file/file_loader.hpp"
+#include "code/ylikuutio/string/extract_string.hpp"
+#include "code/ylikuutio/string/match_string.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp>
+#endif
+
+// Include standard headers
+#include <algorithm>  // std::ranges::replace
+#include <chrono>     // std::chrono::duration, std::chrono::steady_clock
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::int32_t, std::uint64_t
+#include <cstdlib>    // EXIT_FAILURE, EXIT_SUCCESS, std::strtoull
+#include <filesystem> // std::filesystem
+#include <fstream>    // std::ofstream
+#include <functional> // std::function
+#include <iostream>   // std::cout, std::cerr
+#include <optional>   // std::optional
+#include <sstream>    // std::stringstream
+#include <string>     // std::string
+#include <thread>     // std::thread
+#include <vector>     // std::vector
+
+// The previous `load_obj`, kept here as the baseline.
+static bool legacy_load_obj(
+        const std::string& filename,
+        std::vector<glm::vec3>& out_vertices,
+        std::vector<glm::vec2>& out_uvs,
+        std::vector<glm::vec3>& out_normals)
+{
+    const std::optional<std::string> file_content = yli::file::slurp(filename);
+
+    if (!file_content || file_content->empty())
+    {
+        return false;
+    }
+
+    std::vector<std::int32_t> vertex_indices, uv_indices, normal_indices;
+    std::vector<glm::vec3> temp_vertices;
+    std::vector<glm::vec2> temp_uvs;
+    std::vector<glm::vec3> temp_normals;
+
+    std::size_t file_content_i = 0;
+
+    while (true)
+    {
+        const std::vector<std::string> whitespace_vector = { " ", "\t" };
+
+        while (yli::string::check_and_report_if_some_string_matches<char>(*file_content, file_content_i, whitespace_vector))
+        {
+            file_content_i++;
+        }
+
+        if (file_content_i >= file_content->size())
+        {
+            break;
+        }
+
+        auto newline_char_end_string = "\n";
+        std::string current_line_string = yli::string::extract_string_with_several_endings<char>(*file_content, file_content_i, newline_char_end_string);
+        std::ranges::replace(current_line_string, '/', ' ');
+
+        auto current_line_stringstream = std::stringstream(current_line_string);
+        std::string prefix;
+
+        if (current_line_string.compare(0, 1, "#") == 0)
+        {
+        }
+        else if (current_line_string.compare(0, 2, "vt") == 0)
+        {
+            glm::vec2 uv;
+            current_line_stringstream >> prefix >> uv.x >> uv.y;
+            temp_uvs.emplace_back(uv);
+        }
+        else if (current_line_string.compare(0, 2, "vn") == 0)
+        {
+            glm::vec3 normal;
+            current_line_stringstream >> prefix >> normal.x >> normal.y >> normal.z;
+            temp_normals.emplace_back(normal);
+        }
+        else if (current_line_string.compare(0, 1, "v") == 0)
+        {
+            glm::vec3 vertex;
+            current_line_stringstream >> prefix >> vertex.x >> vertex.y >> vertex.z;
+            temp_vertices.emplace_back(vertex);
+        }
+        else if (current_line_string.compare(0, 1, "f") == 0)
+        {
+            std::int32_t vertex_i[3];
+            std::int32_t uv_i[3];
+            std::int32_t normal_i[3];
+            current_line_stringstream >> prefix >>
+                vertex_i[0] >> uv_i[0] >> normal_i[0] >>
+                vertex_i[1] >> uv_i[1] >> normal_i[1] >>
+                vertex_i[2] >> uv_i[2] >> normal_i[2];
+
+            for (std::size_t i = 0; i < 3; i++)
+            {
+                vertex_indices.emplace_back(vertex_i[i]);
+                uv_indices.emplace_back(uv_i[i]);
+                normal_indices.emplace_back(normal_i[i]);
+            }
+        }
+        else if (current_line_string.compare(0, 1, "o") == 0)
+        {
+            break;
+        }
+
+        const std::vector<std::string> endline_vector = { "\n", "\r" };
+
+        while (yli::string::check_and_report_if_some_string_matches<char>(*file_content, ++file_content_i, endline_vector))
+        {
+        }
+    }
+
+    for (std::size_t i = 0; i < vertex_indices.size(); i++)
+    {
+        out_vertices.emplace_back(temp_vertices.at(vertex_indices.at(i) - 1));
+        out_uvs.emplace_back(temp_uvs.at(uv_indices.at(i) - 1));
+        out_normals.emplace_back(temp_normals.at(normal_indices.at(i) - 1));
+    }
+
+    return true;
+}
+
+static bool write_grid_obj(const std::string& filename, const std::uint64_t n_triangles)
+{
+    const std::uint64_t n_quads = (n_triangles + 1) / 2;
+    std::uint64_t grid_width = 1;
+
+    while (grid_width * grid_width < n_quads)
+    {
+        grid_width++;
+    }
+
+    const std::uint64_t grid_height = (n_quads + grid_width - 1) / grid_width;
+
+    std::ofstream file_stream(filename, std::ios::binary);
+
+    for (std::uint64_t y = 0; y <= grid_height; y++)
+    {
+        for (std::uint64_t x = 0; x <= grid_width; x++)
+        {
+            file_stream << "v " << x * 0.125 << " " << y * 0.125 << " " << ((x * 7 + y * 13) % 17) * 0.0625 << "\n";
+            file_stream << "vt " << static_cast<double>(x) / grid_width << " " << static_cast<double>(y) / grid_height << "\n";
+            file_stream << "vn 0.000000 0.000000 1.000000\n";
+        }
+    }
+
+    // Quads are written as two triangles, as the baseline only reads triangles.
+    std::uint64_t n_triangles_written = 0;
+
+    for (std::uint64_t y = 0; y < grid_height && n_triangles_written < n_triangles; y++)
+    {
+        for (std::uint64_t x = 0; x < grid_width && n_triangles_written < n_triangles; x++)
+        {
+            const std::uint64_t i1 = y * (grid_width + 1) + x + 1;
+            const std::uint64_t i2 = i1 + 1;
+            const std::uint64_t i3 = i2 + grid_width + 1;
+            const std::uint64_t i4 = i1 + grid_width + 1;
+
+            file_stream << "f " << i1 << "/" << i1 << "/" << i1 << " " << i2 << "/" << i2 << "/" << i2 << " " << i3 << "/" << i3 << "/" << i3 << "\n";
+            n_triangles_written++;
+
+            if (n_triangles_written < n_triangles)
+            {
+                file_stream << "f " << i1 << "/" << i1 << "/" << i1 << " " << i3 << "/" << i3 << "/" << i3 << " " << i4 << "/" << i4 << "/" << i4 << "\n";
+                n_triangles_written++;
+            }
+        }
+    }
+
+    return file_stream.good();
+}
+
+static bool run_benchmark(
+        const std::string& name,
+        const std::function<bool(std::vector<glm::vec3>&, std::vector<glm::vec2>&, std::vector<glm::vec3>&)>& load,
+        const std::uintmax_t file_size,
+        std::vector<glm::vec3>& out_vertices)
+{
+    std::vector<glm::vec2> out_uvs;
+    std::vector<glm::vec3> out_normals;
+
+    const auto start_time = std::chrono::steady_clock::now();
+    const bool result = load(out_vertices, out_uvs, out_normals);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+
+    if (!result) [[unlikely]]
+    {
+        std::cerr << "ERROR: `run_benchmark`: " << name << " failed!\n";
+        return false;
+    }
+
+    std::cout << name << ": " << out_vertices.size() / 3 << " triangles in " << elapsed.count() << " s, "
+        << file_size / elapsed.count() / (1024.0 * 1024.0) << " MiB/s\n";
+    return true;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_triangles = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000);
+    const bool is_generated = (argc <= 2);
+    const std::string obj_filename = (is_generated ?
+            (std::filesystem::temp_directory_path() / "ylikuutio_benchmark_obj_loader.obj").string() :
+            std::string(argv[2]));
+
+    if (is_generated && !write_grid_obj(obj_filename, n_triangles)) [[unlikely]]
+    {
+        std::cerr << "ERROR: `main`: writing " << obj_filename << " failed!\n";
+        return EXIT_FAILURE;
+    }
+
+    const std::uintmax_t file_size = std::filesystem::file_size(obj_filename);
+    std::cout << "OBJ file: " << obj_filename << ", " << file_size / (1024.0 * 1024.0) << " MiB\n";
+
+    std::vector<glm::vec3> legacy_vertices;
+    std::vector<glm::vec3> single_thread_vertices;
+    std::vector<glm::vec3> multithread_vertices;
+    const std::size_t n_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+    const bool is_ok =
+        run_benchmark(
+                "legacy load_obj",
+                [&](std::vector<glm::vec3>& vertices, std::vector<glm::vec2>& uvs, std::vector<glm::vec3>& normals)
+                {
+                    return legacy_load_obj(obj_filename, vertices, uvs, normals);
+                },
+                file_size,
+                legacy_vertices) &&
+        run_benchmark(
+                "load_obj, 1 thread",
+                [&](std::vector<glm::vec3>& vertices, std::vector<glm::vec2>& uvs, std::vector<glm::vec3>& normals)
+                {
+                    return yli::load::load_obj(obj_filename, vertices, uvs, normals, 1);
+                },
+                file_size,
+                single_thread_vertices) &&
+        run_benchmark(
+                "load_obj, hardware threads: " + std::to_string(n_threads),
+                [&](std::vector<glm::vec3>& vertices, std::vector<glm::vec2>& uvs, std::vector<glm::vec3>& normals)
+                {
+                    return yli::load::load_obj(obj_filename, vertices, uvs, normals, n_threads);
+                },
+                file_size,
+                multithread_vertices);
+
+    if (is_generated)
+    {
+        std::filesystem::remove(obj_filename);
+    }
+
+    if (!is_ok)
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (legacy_vertices != single_thread_vertices || single_thread_vertices != multithread_vertices) [[unlikely]]
+    {
+        std::cerr << "ERROR: `main`: the loaders produced different vertices!\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
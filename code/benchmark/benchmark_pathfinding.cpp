@@ -0,0 +1,184 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Pathfinding benchmark.
+//
+// Generates a hilly heightmap of `size` x `size` samples, derives a
+// navigation grid from it, and plans paths for `n_units` units, each
+// from its position to a random goal at most 512 samples away, as police
+// units replanning do. Prints the time per path of plain A*, of HPA* on
+// the calling thread, of HPA* requests served by the `PathPlanner` worker
+// threads, and of the same requests served from the path cache.
+//
+// usage: benchmark_pathfinding [size] [n_units]
+
+#include "code/ylikuutio/graph/a_star.hpp"
+#include "code/ylikuutio/graph/hierarchical_pathfinder.hpp"
+#include "code/ylikuutio/graph/navigation_grid.hpp"
+#include "code/ylikuutio/graph/path_cache.hpp"
+#include "code/ylikuutio/graph/path_planner.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::clamp
+#include <chrono>    // std::chrono::duration, std::chrono::steady_clock
+#include <cmath>     // std::cos, std::sin
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int64_t, std::uint32_t, std::uint64_t
+#include <cstdlib>   // EXIT_SUCCESS, std::strtoull
+#include <iostream>  // std::cout
+#include <memory>    // std::make_shared, std::shared_ptr
+#include <random>    // std::mt19937, std::uniform_int_distribution
+#include <vector>    // std::vector
+
+static std::vector<float> generate_hills(const std::uint32_t size)
+{
+    std::vector<float> altitudes;
+    altitudes.reserve(static_cast<std::size_t>(size) * size);
+
+    for (std::uint32_t j = 0; j < size; j++)
+    {
+        for (std::uint32_t i = 0; i < size; i++)
+        {
+            const float x = static_cast<float>(i);
+            const float z = static_cast<float>(j);
+            altitudes.emplace_back(
+                    40.0f * std::sin(0.013f * x) * std::cos(0.017f * z) +
+                    12.0f * std::sin(0.061f * x + 1.0f) * std::sin(0.047f * z) +
+                    3.0f * std::cos(0.23f * x) * std::cos(0.19f * z + 2.0f));
+        }
+    }
+
+    return altitudes;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint32_t size = static_cast<std::uint32_t>(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024);
+    const std::uint64_t n_units = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 500);
+    constexpr std::int64_t max_distance = 512;
+    constexpr float max_slope = 1.5f;
+
+    auto start_time = std::chrono::steady_clock::now();
+    const std::shared_ptr<const yli::graph::NavigationGrid> grid = std::make_shared<const yli::graph::NavigationGrid>(
+            yli::graph::NavigationGrid::create_from_heightmap(
+                generate_hills(size), size, size, glm::vec2(0.0f, 0.0f), glm::vec2(1.0f, 1.0f), max_slope));
+    const yli::graph::HierarchicalPathfinder hierarchical_pathfinder(grid, 16);
+    const std::chrono::duration<double> build_time = std::chrono::steady_clock::now() - start_time;
+
+    std::mt19937 generator(2026);
+    std::uniform_int_distribution<std::int64_t> coordinate_distribution(0, size - 1);
+    std::uniform_int_distribution<std::int64_t> offset_distribution(-max_distance, max_distance);
+
+    std::vector<std::uint32_t> starts;
+    std::vector<std::uint32_t> goals;
+
+    while (starts.size() < n_units)
+    {
+        const std::int64_t i = coordinate_distribution(generator);
+        const std::int64_t j = coordinate_distribution(generator);
+        const std::uint32_t start = grid->get_cell(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(j));
+        const std::uint32_t goal = grid->get_cell(
+                static_cast<std::uint32_t>(std::clamp<std::int64_t>(i + offset_distribution(generator), 0, size - 1)),
+                static_cast<std::uint32_t>(std::clamp<std::int64_t>(j + offset_distribution(generator), 0, size - 1)));
+
+        if (grid->is_walkable(start) && grid->is_walkable(goal))
+        {
+            starts.emplace_back(start);
+            goals.emplace_back(goal);
+        }
+    }
+
+    yli::graph::AStarWorkspace workspace;
+    std::vector<std::uint32_t> path;
+    float cost = 0.0f;
+    std::uint64_t n_found = 0;
+    double total_cost = 0.0;
+
+    start_time = std::chrono::steady_clock::now();
+
+    for (std::uint64_t unit_i = 0; unit_i < n_units; unit_i++)
+    {
+        if (yli::graph::find_path(*grid, starts[unit_i], goals[unit_i], workspace, path, cost))
+        {
+            n_found++;
+            total_cost += cost;
+        }
+    }
+
+    const std::chrono::duration<double> a_star_time = std::chrono::steady_clock::now() - start_time;
+
+    std::uint64_t n_hierarchical_found = 0;
+    double total_hierarchical_cost = 0.0;
+
+    start_time = std::chrono::steady_clock::now();
+
+    for (std::uint64_t unit_i = 0; unit_i < n_units; unit_i++)
+    {
+        if (hierarchical_pathfinder.find_path(starts[unit_i], goals[unit_i], workspace, path, cost))
+        {
+            n_hierarchical_found++;
+            total_hierarchical_cost += cost;
+        }
+    }
+
+    const std::chrono::duration<double> hierarchical_time = std::chrono::steady_clock::now() - start_time;
+
+    yli::graph::PathPlanner path_planner(0, n_units);
+    path_planner.set_navigation_grid(grid, 16);
+    std::vector<yli::graph::PathPlanner::PathFuture> futures;
+    futures.reserve(n_units);
+
+    start_time = std::chrono::steady_clock::now();
+
+    for (std::uint64_t unit_i = 0; unit_i < n_units; unit_i++)
+    {
+        futures.emplace_back(path_planner.request_path(yli::graph::PathDomain::GRID, starts[unit_i], goals[unit_i]));
+    }
+
+    const std::chrono::duration<double> request_time = std::chrono::steady_clock::now() - start_time;
+    path_planner.finish();
+    const std::chrono::duration<double> planner_time = std::chrono::steady_clock::now() - start_time;
+
+    start_time = std::chrono::steady_clock::now();
+    std::uint64_t n_cached_found = 0;
+
+    for (std::uint64_t unit_i = 0; unit_i < n_units; unit_i++)
+    {
+        n_cached_found += (path_planner.request_path(yli::graph::PathDomain::GRID, starts[unit_i], goals[unit_i]).get()->is_found() ? 1 : 0);
+    }
+
+    const std::chrono::duration<double> cached_time = std::chrono::steady_clock::now() - start_time;
+
+    std::cout << size << " x " << size << " grid, " << hierarchical_pathfinder.get_number_of_abstract_nodes() << " abstract nodes, "
+        << build_time.count() * 1e3 << " ms to build\n";
+    std::cout << n_units << " paths, " << n_found << " found, HPA* cost / A* cost "
+        << (total_cost > 0.0 ? total_hierarchical_cost / total_cost : 1.0) << " (" << n_hierarchical_found << " found)\n";
+    std::cout << "A*:             " << a_star_time.count() / n_units * 1e6 << " us per path\n";
+    std::cout << "HPA*:           " << hierarchical_time.count() / n_units * 1e6 << " us per path\n";
+    std::cout << "HPA* on " << path_planner.get_number_of_worker_threads() << " threads: "
+        << planner_time.count() / n_units * 1e6 << " us per path, "
+        << request_time.count() / n_units * 1e6 << " us per request on the calling thread\n";
+    std::cout << "cached:         " << cached_time.count() / n_units * 1e6 << " us per path (" << n_cached_found << " found)\n";
+
+    return EXIT_SUCCESS;
+}
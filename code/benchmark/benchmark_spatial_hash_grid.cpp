@@ -0,0 +1,144 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+// Spatial hash grid benchmark.
+//
+// Creates `n_movers` movers of 2 groups on a square of about 16 movers
+// per 32x32 units. Each tick every mover takes a random step, then
+// queries its opponents within the radius of 16 units and its 8
+// nearest allies, as AI callbacks of `Movable`s do. Prints the time per
+// tick of the moves and of the queries, and for comparison the time of
+// the radius queries by scanning all movers, extrapolated from a sample.
+//
+// usage: benchmark_spatial_hash_grid [n_movers] [n_ticks]
+
+#include "code/ylikuutio/geometry/spatial_hash_grid.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <chrono>   // std::chrono::duration, std::chrono::steady_clock
+#include <cmath>    // std::sqrt
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::int32_t, std::uint32_t, std::uint64_t
+#include <cstdlib>  // EXIT_SUCCESS, std::strtoull
+#include <iostream> // std::cout
+#include <random>   // std::mt19937, std::uniform_real_distribution
+#include <vector>   // std::vector
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_movers = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 50000);
+    const std::uint64_t n_ticks = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20);
+    constexpr float radius = 16.0f;
+    constexpr std::size_t k = 8;
+    constexpr std::size_t n_brute_force_samples = 100;
+
+    const float side = std::sqrt(static_cast<float>(n_movers) / 16.0f) * 32.0f;
+
+    std::mt19937 generator(2026);
+    std::uniform_real_distribution<float> coordinate_distribution(0.0f, side);
+    std::uniform_real_distribution<float> step_distribution(-1.0f, 1.0f);
+
+    yli::geometry::SpatialHashGrid grid(radius);
+    std::vector<glm::vec3> points;
+    std::vector<std::int32_t> proxy_ids;
+    points.reserve(n_movers);
+    proxy_ids.reserve(n_movers);
+
+    for (std::uint64_t mover_i = 0; mover_i < n_movers; mover_i++)
+    {
+        points.emplace_back(coordinate_distribution(generator), 0.0f, coordinate_distribution(generator));
+        proxy_ids.emplace_back(grid.create_proxy(points.back(), mover_i % 2, nullptr));
+    }
+
+    double move_time = 0.0;
+    double radius_query_time = 0.0;
+    double nearest_query_time = 0.0;
+    double brute_force_time = 0.0;
+    std::uint64_t n_radius_neighbours = 0;
+    std::uint64_t n_brute_force_neighbours = 0;
+    std::vector<yli::geometry::SpatialNeighbour> neighbours;
+
+    for (std::uint64_t tick_i = 0; tick_i < n_ticks; tick_i++)
+    {
+        auto start_time = std::chrono::steady_clock::now();
+
+        for (std::uint64_t mover_i = 0; mover_i < n_movers; mover_i++)
+        {
+            points[mover_i] += glm::vec3(step_distribution(generator), 0.0f, step_distribution(generator));
+            grid.move_proxy(proxy_ids[mover_i], points[mover_i], mover_i % 2);
+        }
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        move_time += elapsed.count();
+        start_time = std::chrono::steady_clock::now();
+
+        for (std::uint64_t mover_i = 0; mover_i < n_movers; mover_i++)
+        {
+            neighbours.clear();
+            const yli::geometry::SpatialQueryFilter filter { static_cast<std::uint32_t>(mover_i % 2), yli::geometry::GroupRelation::OTHER, proxy_ids[mover_i] };
+            grid.query_radius(points[mover_i], radius, filter, neighbours);
+            n_radius_neighbours += neighbours.size();
+        }
+
+        elapsed = std::chrono::steady_clock::now() - start_time;
+        radius_query_time += elapsed.count();
+        start_time = std::chrono::steady_clock::now();
+
+        for (std::uint64_t mover_i = 0; mover_i < n_movers; mover_i++)
+        {
+            const yli::geometry::SpatialQueryFilter filter { static_cast<std::uint32_t>(mover_i % 2), yli::geometry::GroupRelation::SAME, proxy_ids[mover_i] };
+            grid.query_nearest(points[mover_i], k, filter, neighbours);
+        }
+
+        elapsed = std::chrono::steady_clock::now() - start_time;
+        nearest_query_time += elapsed.count();
+        start_time = std::chrono::steady_clock::now();
+
+        for (std::uint64_t sample_i = 0; sample_i < n_brute_force_samples && sample_i < n_movers; sample_i++)
+        {
+            const std::uint64_t mover_i = sample_i * n_movers / n_brute_force_samples;
+
+            for (std::uint64_t other_i = 0; other_i < n_movers; other_i++)
+            {
+                const glm::vec3 difference = points[other_i] - points[mover_i];
+
+                if (other_i % 2 != mover_i % 2 && glm::dot(difference, difference) <= radius * radius)
+                {
+                    n_brute_force_neighbours++;
+                }
+            }
+        }
+
+        elapsed = std::chrono::steady_clock::now() - start_time;
+        brute_force_time += elapsed.count() * static_cast<double>(n_movers) / static_cast<double>(n_brute_force_samples);
+    }
+
+    std::cout << n_movers << " movers, " << grid.get_number_of_cells() << " cells, "
+        << static_cast<double>(n_radius_neighbours) / static_cast<double>(n_movers * n_ticks) << " opponents in radius on average\n";
+    std::cout << "moves:                  " << move_time / n_ticks * 1e3 << " ms per tick\n";
+    std::cout << "radius queries:         " << radius_query_time / n_ticks * 1e3 << " ms per tick\n";
+    std::cout << k << "-nearest queries:      " << nearest_query_time / n_ticks * 1e3 << " ms per tick\n";
+    std::cout << "radius queries by scan: " << brute_force_time / n_ticks * 1e3 << " ms per tick (extrapolated, "
+        << n_brute_force_neighbours << " found in samples)\n";
+
+    return EXIT_SUCCESS;
+}
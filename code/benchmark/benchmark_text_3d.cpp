@@ -0,0 +1,220 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+// `Text3d` benchmark.
+//
+// Creates a text of `n_characters` characters over `n_glyphs` `Glyph`s,
+// first as one `GlyphObject` entity per character, as `Text3d` used to
+// do, and then as one `Text3d` whose characters are instances in its
+// `Text3dMesh`. Prints the creation time, the heap memory used, and the
+// CPU time per frame of the transforms: one model matrix per character
+// vs. one model matrix per text. The GPU time of the draw calls can not
+// be measured headless; the batched text needs one instanced draw call
+// per distinct `Glyph` instead of one draw call per character.
+//
+// usage: benchmark_text_3d [n_characters] [n_frames]
+
+#include "code/mock/mock_application.hpp"
+#include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/ontology/scene.hpp"
+#include "code/ylikuutio/ontology/pipeline.hpp"
+#include "code/ylikuutio/ontology/material.hpp"
+#include "code/ylikuutio/ontology/vector_font.hpp"
+#include "code/ylikuutio/ontology/glyph.hpp"
+#include "code/ylikuutio/ontology/glyph_object.hpp"
+#include "code/ylikuutio/ontology/movable.hpp"
+#include "code/ylikuutio/ontology/cartesian_coordinates_module.hpp"
+#include "code/ylikuutio/ontology/text_3d.hpp"
+#include "code/ylikuutio/ontology/request.hpp"
+#include "code/ylikuutio/ontology/texture_file_format.hpp"
+#include "code/ylikuutio/ontology/scene_struct.hpp"
+#include "code/ylikuutio/ontology/pipeline_struct.hpp"
+#include "code/ylikuutio/ontology/material_struct.hpp"
+#include "code/ylikuutio/ontology/vector_font_struct.hpp"
+#include "code/ylikuutio/ontology/glyph_struct.hpp"
+#include "code/ylikuutio/ontology/glyph_object_struct.hpp"
+#include "code/ylikuutio/ontology/text_3d_struct.hpp"
+#include "code/ylikuutio/render/text_3d_mesh.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+#ifndef __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#define __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#include <glm/gtc/matrix_transform.hpp>
+#endif
+
+#ifndef __GLM_GTC_QUATERNION_HPP_INCLUDED
+#define __GLM_GTC_QUATERNION_HPP_INCLUDED
+#include <glm/gtc/quaternion.hpp> // glm::quat
+#endif
+
+// Include standard headers
+#include <chrono>   // std::chrono::duration, std::chrono::steady_clock
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <cstdlib>  // EXIT_SUCCESS, std::strtoull
+#include <iostream> // std::cout
+#include <malloc.h> // mallinfo2
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+static std::size_t get_heap_usage()
+{
+    return mallinfo2().uordblks;
+}
+
+// The per-frame transform of one `Movable`, as in `Object::render_this_object`.
+static glm::mat4 compute_mvp_matrix(const yli::ontology::Movable& movable, const glm::mat4& view_projection_matrix)
+{
+    glm::mat4 model_matrix = glm::scale(glm::mat4(1.0f), movable.scale * movable.original_scale_vector);
+    const glm::vec3 euler_angles { movable.orientation.roll, -movable.orientation.pitch, movable.orientation.yaw };
+    model_matrix = glm::mat4_cast(glm::quat(euler_angles)) * model_matrix;
+    model_matrix[3][0] = movable.location.get_x();
+    model_matrix[3][1] = movable.location.get_y();
+    model_matrix[3][2] = movable.location.get_z();
+    return view_projection_matrix * model_matrix;
+}
+
+int main(const int argc, const char* const argv[])
+{
+    const std::uint64_t n_characters = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000);
+    const std::uint64_t n_frames = (argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100);
+    constexpr std::size_t n_glyphs = 26;
+
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(scene) };
+    yli::ontology::Pipeline* const pipeline = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+
+    yli::ontology::MaterialStruct material_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(pipeline),
+            yli::ontology::TextureFileFormat::PNG };
+    yli::ontology::Material* const material = application.get_generic_entity_factory().create_material(
+            material_struct);
+
+    yli::ontology::VectorFontStruct vector_font_struct { yli::ontology::Request(material) };
+    yli::ontology::VectorFont* const vector_font = application.get_generic_entity_factory().create_vector_font(
+            vector_font_struct);
+
+    std::vector<yli::ontology::Glyph*> glyphs;
+
+    for (std::size_t glyph_i = 0; glyph_i < n_glyphs; glyph_i++)
+    {
+        yli::ontology::GlyphStruct glyph_struct {
+                yli::ontology::Request(vector_font),
+                yli::ontology::Request(material) };
+        yli::ontology::Glyph* const glyph = application.get_generic_entity_factory().create_glyph(glyph_struct);
+        vector_font->set_glyph_for_unicode_value(static_cast<std::int32_t>('a' + glyph_i), *glyph);
+        glyphs.push_back(glyph);
+    }
+
+    std::string text;
+
+    for (std::uint64_t character_i = 0; character_i < n_characters; character_i++)
+    {
+        text += (character_i % 80 == 79 ? '\n' : static_cast<char>('a' + character_i % n_glyphs));
+    }
+
+    const glm::mat4 view_projection_matrix = application.get_universe().get_projection_matrix() *
+        application.get_universe().get_view_matrix();
+
+    // One `GlyphObject` per character.
+    std::vector<yli::ontology::GlyphObject*> glyph_objects;
+    glyph_objects.reserve(n_characters);
+    const std::size_t heap_usage_before_glyph_objects = get_heap_usage();
+    auto start_time = std::chrono::steady_clock::now();
+
+    for (std::uint64_t character_i = 0; character_i < n_characters; character_i++)
+    {
+        yli::ontology::GlyphObjectStruct glyph_object_struct {
+                yli::ontology::Request(scene),
+                yli::ontology::Request(glyphs[character_i % n_glyphs]) };
+        glyph_object_struct.cartesian_coordinates = yli::ontology::CartesianCoordinatesModule(
+                static_cast<float>(character_i % 80),
+                -static_cast<float>(character_i / 80),
+                0.0f);
+        glyph_objects.push_back(application.get_generic_entity_factory().create_glyph_object(glyph_object_struct));
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    const double glyph_objects_creation_time = elapsed.count();
+    const std::size_t glyph_objects_heap_usage = get_heap_usage() - heap_usage_before_glyph_objects;
+
+    start_time = std::chrono::steady_clock::now();
+    float checksum = 0.0f;
+
+    for (std::uint64_t frame_i = 0; frame_i < n_frames; frame_i++)
+    {
+        for (const yli::ontology::GlyphObject* const glyph_object : glyph_objects)
+        {
+            checksum += compute_mvp_matrix(*glyph_object, view_projection_matrix)[3][0];
+        }
+    }
+
+    elapsed = std::chrono::steady_clock::now() - start_time;
+    const double glyph_objects_frame_time = elapsed.count() / static_cast<double>(n_frames);
+
+    // One `Text3d` with all characters as instances.
+    const std::size_t heap_usage_before_text_3d = get_heap_usage();
+    start_time = std::chrono::steady_clock::now();
+
+    yli::ontology::Text3dStruct text_3d_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(vector_font) };
+    text_3d_struct.cartesian_coordinates = yli::ontology::CartesianCoordinatesModule(0.0f, 0.0f, 0.0f);
+    text_3d_struct.text_string = text;
+    yli::ontology::Text3d* const text_3d = application.get_generic_entity_factory().create_text_3d(
+            text_3d_struct);
+
+    elapsed = std::chrono::steady_clock::now() - start_time;
+    const double text_3d_creation_time = elapsed.count();
+    const std::size_t text_3d_heap_usage = get_heap_usage() - heap_usage_before_text_3d;
+
+    start_time = std::chrono::steady_clock::now();
+
+    for (std::uint64_t frame_i = 0; frame_i < n_frames; frame_i++)
+    {
+        checksum += compute_mvp_matrix(*text_3d, view_projection_matrix)[3][0];
+    }
+
+    elapsed = std::chrono::steady_clock::now() - start_time;
+    const double text_3d_frame_time = elapsed.count() / static_cast<double>(n_frames);
+
+    const yli::render::Text3dMesh& text_3d_mesh = text_3d->get_text_3d_mesh();
+
+    std::cout << n_characters << " characters, " << n_glyphs << " glyphs, checksum " << checksum << "\n";
+    std::cout << "GlyphObjects: " << glyph_objects.size() << " entities, "
+        << glyph_objects_creation_time * 1e3 << " ms to create, "
+        << glyph_objects_heap_usage / 1024 << " KiB, "
+        << glyph_objects_frame_time * 1e6 << " us per frame, "
+        << glyph_objects.size() << " draw calls per frame\n";
+    std::cout << "Text3d: " << text_3d_mesh.get_number_of_characters() << " instances, "
+        << text_3d_creation_time * 1e3 << " ms to create, "
+        << text_3d_heap_usage / 1024 << " KiB (layout " << text_3d_mesh.get_memory_usage() / 1024 << " KiB), "
+        << text_3d_frame_time * 1e6 << " us per frame, "
+        << text_3d_mesh.get_batches().size() << " draw calls per frame\n";
+
+    return EXIT_SUCCESS;
+}
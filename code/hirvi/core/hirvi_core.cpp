@@ -17,6 +17,9 @@
 
 #include "hirvi_core.hpp"
 #include "hirvi_application_callback.hpp"
+#include "code/ylikuutio/command_line/command_line_master.hpp"
+#include "code/ylikuutio/console/console_logic_module.hpp"
+#include "code/ylikuutio/core/application.hpp"
 #include "code/ylikuutio/ontology/console.hpp"
 #include "code/ylikuutio/snippets/framebuffer_snippets.hpp"
 #include "code/ylikuutio/snippets/background_color_snippets.hpp"
@@ -234,6 +237,19 @@ namespace hirvi::core
             hirvi_application_callback(*this);
         }
 
+        const yli::command_line::CommandLineMaster& command_line_master =
+            this->get_universe().get_application().command_line_master;
+
+        if (command_line_master.is_key("source"))
+        {
+            // Run a script of console commands before the simulation starts.
+            // The script may end the program by calling `quit`.
+            if (yli::console::ConsoleLogicModule::source(*my_console, command_line_master.get_value("source")).has_value())
+            {
+                return true;
+            }
+        }
+
         this->get_universe().start_simulation();
         return true;
     }
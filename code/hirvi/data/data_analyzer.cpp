@@ -17,5 +17,32 @@
 
 #include "data_analyzer.hpp"
 
+// Include standard headers
+#include <atomic>  // std::atomic
+#include <cstdint> // std::uint64_t
+
 namespace hirvi::data
-{ }
+{
+    static std::atomic<std::uint64_t> next_id { 1 };
+
+    DataAnalyzer::DataAnalyzer()
+        : id { next_id++ }
+    {
+    }
+
+    DataAnalyzer::DataAnalyzer(const DataAnalyzer&)
+        : id { next_id++ }
+    {
+    }
+
+    DataAnalyzer& DataAnalyzer::operator=(const DataAnalyzer&)
+    {
+        // The id stays.
+        return *this;
+    }
+
+    std::uint64_t DataAnalyzer::get_id() const noexcept
+    {
+        return this->id;
+    }
+}
@@ -19,6 +19,7 @@
 #define HIRVI_DATA_DATA_ANALYZER_HPP_INCLUDED
 
 // Include standard headers
+#include <cstdint> // std::uint64_t
 #include <utility> // std::pair
 #include <vector>  // std::vector
 
@@ -37,10 +38,22 @@ namespace hirvi::data
     class DataAnalyzer
     {
     public:
+        DataAnalyzer();
+
+        // A copy gets an id of its own.
+        DataAnalyzer(const DataAnalyzer&);
+        DataAnalyzer& operator=(const DataAnalyzer&);
+
         virtual ~DataAnalyzer() = default;
 
         [[nodiscard]] virtual std::pair<std::vector<std::size_t>, glm::vec3> analyze_data(
             const std::vector<PositionReport>& reports) const = 0;
+
+        // Unique among all analyzers during the run, unlike the address, and never 0.
+        [[nodiscard]] std::uint64_t get_id() const noexcept;
+
+    private:
+        std::uint64_t id;
     };
 }
 
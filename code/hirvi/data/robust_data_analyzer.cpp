@@ -0,0 +1,316 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "robust_data_analyzer.hpp"
+#include "position_report.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::clamp, std::lower_bound, std::max, std::min, std::nth_element, std::sort
+#include <cmath>     // NAN, std::abs, std::isfinite
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int64_t, std::uint32_t, std::uint64_t
+#include <stdexcept> // std::runtime_error
+#include <utility>   // std::pair
+#include <vector>    // std::vector
+
+namespace hirvi::data
+{
+    // Cell coordinates are packed in 21 bits per axis, cells farther away are clamped to the border cells.
+    static constexpr std::int64_t cell_bias { std::int64_t { 1 } << 20 };
+    static constexpr std::int64_t max_cell { cell_bias - 1 };
+
+    struct CellEntry
+    {
+        std::uint64_t key;
+        std::uint32_t report_i;
+
+        bool operator<(const CellEntry& other) const
+        {
+            return this->key < other.key;
+        }
+    };
+
+    struct Cell
+    {
+        std::uint64_t key;
+        std::uint32_t first_entry_i;
+        std::uint32_t n_reports;
+    };
+
+    // Per-thread scratch buffers, reused between calls.
+    struct AnalysisScratch
+    {
+        std::vector<CellEntry> entries;
+        std::vector<Cell> cells;
+        std::vector<float> values;
+        std::vector<std::uint32_t> valid_report_indices;
+    };
+
+    static std::int64_t get_cell_coordinate(const float coordinate, const float inverse_tolerance)
+    {
+        // Truncate and round down the negative values, `std::floor` is a library call without SSE4.1.
+        const float scaled = std::clamp(coordinate * inverse_tolerance, -2.0e6f, 2.0e6f);
+        std::int64_t cell = static_cast<std::int64_t>(scaled);
+        cell -= (scaled < static_cast<float>(cell) ? 1 : 0);
+        return std::clamp(cell, -cell_bias, max_cell);
+    }
+
+    static std::uint64_t get_key(const std::int64_t x, const std::int64_t y, const std::int64_t z)
+    {
+        return (static_cast<std::uint64_t>(x + cell_bias) << 42) |
+            (static_cast<std::uint64_t>(y + cell_bias) << 21) |
+            static_cast<std::uint64_t>(z + cell_bias);
+    }
+
+    static std::int64_t get_x(const std::uint64_t key)
+    {
+        return static_cast<std::int64_t>(key >> 42) - cell_bias;
+    }
+
+    static std::int64_t get_y(const std::uint64_t key)
+    {
+        return static_cast<std::int64_t>((key >> 21) & 0x1fffff) - cell_bias;
+    }
+
+    static std::int64_t get_z(const std::uint64_t key)
+    {
+        return static_cast<std::int64_t>(key & 0x1fffff) - cell_bias;
+    }
+
+    // Number of reports in the 3x3x3 cells around `cell_i`.
+    static std::size_t get_neighbourhood_count(const std::vector<Cell>& cells, const std::size_t cell_i)
+    {
+        const std::uint64_t key = cells[cell_i].key;
+        const std::int64_t x = get_x(key);
+        const std::int64_t y = get_y(key);
+        const std::int64_t z = get_z(key);
+        std::size_t count = 0;
+
+        for (std::int64_t neighbour_x = std::max(x - 1, -cell_bias); neighbour_x <= std::min(x + 1, max_cell); neighbour_x++)
+        {
+            for (std::int64_t neighbour_y = std::max(y - 1, -cell_bias); neighbour_y <= std::min(y + 1, max_cell); neighbour_y++)
+            {
+                // The 3 cells along z are consecutive in key order.
+                const std::uint64_t first_key = get_key(neighbour_x, neighbour_y, std::max(z - 1, -cell_bias));
+                const std::uint64_t last_key = get_key(neighbour_x, neighbour_y, std::min(z + 1, max_cell));
+
+                auto it = std::lower_bound(
+                        cells.begin(), cells.end(), first_key,
+                        [](const Cell& cell, const std::uint64_t other_key) { return cell.key < other_key; });
+
+                for ( ; it != cells.end() && it->key <= last_key; ++it)
+                {
+                    count += it->n_reports;
+                }
+            }
+        }
+
+        return count;
+    }
+
+    static bool is_in_neighbourhood(const std::uint64_t key, const std::uint64_t center_key)
+    {
+        return std::abs(get_x(key) - get_x(center_key)) <= 1 &&
+            std::abs(get_y(key) - get_y(center_key)) <= 1 &&
+            std::abs(get_z(key) - get_z(center_key)) <= 1;
+    }
+
+    static float get_median(std::vector<float>& values)
+    {
+        const std::size_t middle_i = values.size() / 2;
+        std::nth_element(values.begin(), values.begin() + middle_i, values.end());
+        return values[middle_i];
+    }
+
+    static float get_trimmed_mean(std::vector<float>& values, const float trim_fraction)
+    {
+        const std::size_t n_trimmed = static_cast<std::size_t>(trim_fraction * static_cast<float>(values.size()));
+
+        if (2 * n_trimmed >= values.size())
+        {
+            return get_median(values);
+        }
+
+        // Partition the lowest and the highest `n_trimmed` values to the ends.
+        if (n_trimmed > 0)
+        {
+            std::nth_element(values.begin(), values.begin() + n_trimmed, values.end());
+            std::nth_element(values.begin() + n_trimmed, values.end() - n_trimmed, values.end());
+        }
+
+        double sum = 0.0;
+
+        for (std::size_t value_i = n_trimmed; value_i < values.size() - n_trimmed; value_i++)
+        {
+            sum += values[value_i];
+        }
+
+        return static_cast<float>(sum / static_cast<double>(values.size() - 2 * n_trimmed));
+    }
+
+    RobustDataAnalyzer::RobustDataAnalyzer(const float tolerance, const float trim_fraction)
+        : tolerance { tolerance },
+        trim_fraction { trim_fraction }
+    {
+        if (!(tolerance > 0.0f) || !std::isfinite(tolerance))
+        {
+            throw std::runtime_error("ERROR: `RobustDataAnalyzer::RobustDataAnalyzer`: tolerance must be positive and finite!");
+        }
+
+        if (!(trim_fraction >= 0.0f && trim_fraction <= 0.5f))
+        {
+            throw std::runtime_error("ERROR: `RobustDataAnalyzer::RobustDataAnalyzer`: trim fraction must be between 0 and 0.5!");
+        }
+    }
+
+    std::pair<std::vector<std::size_t>, glm::vec3> RobustDataAnalyzer::analyze_data(
+        const std::vector<PositionReport>& reports) const
+    {
+        thread_local AnalysisScratch scratch;
+        std::vector<CellEntry>& entries = scratch.entries;
+        std::vector<Cell>& cells = scratch.cells;
+        std::vector<float>& values = scratch.values;
+        std::vector<std::uint32_t>& valid_report_indices = scratch.valid_report_indices;
+
+        const float inverse_tolerance = 1.0f / this->tolerance;
+        entries.clear();
+
+        for (std::uint32_t report_i = 0; report_i < reports.size(); report_i++)
+        {
+            const glm::vec3& position = reports[report_i].position;
+
+            if (std::isfinite(position.x) && std::isfinite(position.y) && std::isfinite(position.z))
+            {
+                entries.push_back({
+                        get_key(
+                            get_cell_coordinate(position.x, inverse_tolerance),
+                            get_cell_coordinate(position.y, inverse_tolerance),
+                            get_cell_coordinate(position.z, inverse_tolerance)),
+                        report_i });
+            }
+        }
+
+        std::sort(entries.begin(), entries.end());
+
+        cells.clear();
+
+        for (std::uint32_t entry_i = 0; entry_i < entries.size(); entry_i++)
+        {
+            if (cells.empty() || cells.back().key != entries[entry_i].key)
+            {
+                cells.push_back({ entries[entry_i].key, entry_i, 0 });
+            }
+
+            cells.back().n_reports++;
+        }
+
+        // Find the densest neighbourhood, the first one on ties.
+        std::size_t best_cell_i = 0;
+        std::size_t best_count = 0;
+
+        for (std::size_t cell_i = 0; cell_i < cells.size(); cell_i++)
+        {
+            const std::size_t count = get_neighbourhood_count(cells, cell_i);
+
+            if (count > best_count)
+            {
+                best_count = count;
+                best_cell_i = cell_i;
+            }
+        }
+
+        glm::vec3 median { NAN, NAN, NAN };
+
+        if (!cells.empty())
+        {
+            const std::uint64_t center_key = cells[best_cell_i].key;
+
+            for (int axis = 0; axis < 3; axis++)
+            {
+                values.clear();
+
+                for (const Cell& cell : cells)
+                {
+                    if (is_in_neighbourhood(cell.key, center_key))
+                    {
+                        for (std::uint32_t entry_i = cell.first_entry_i; entry_i < cell.first_entry_i + cell.n_reports; entry_i++)
+                        {
+                            values.emplace_back(reports[entries[entry_i].report_i].position[axis]);
+                        }
+                    }
+                }
+
+                median[axis] = get_median(values);
+            }
+        }
+
+        std::vector<std::size_t> traitor_ids;
+        valid_report_indices.clear();
+
+        for (std::uint32_t report_i = 0; report_i < reports.size(); report_i++)
+        {
+            const glm::vec3& position = reports[report_i].position;
+
+            // Comparisons with NAN are false, so non-finite reports are traitors.
+            if (std::abs(position.x - median.x) <= this->tolerance &&
+                    std::abs(position.y - median.y) <= this->tolerance &&
+                    std::abs(position.z - median.z) <= this->tolerance)
+            {
+                valid_report_indices.emplace_back(report_i);
+            }
+            else
+            {
+                traitor_ids.emplace_back(reports[report_i].reporterID);
+            }
+        }
+
+        glm::vec3 determined_position { NAN, NAN, NAN };
+
+        if (!valid_report_indices.empty())
+        {
+            for (int axis = 0; axis < 3; axis++)
+            {
+                values.clear();
+
+                for (const std::uint32_t report_i : valid_report_indices)
+                {
+                    values.emplace_back(reports[report_i].position[axis]);
+                }
+
+                determined_position[axis] = get_trimmed_mean(values, this->trim_fraction);
+            }
+        }
+
+        return { traitor_ids, determined_position };
+    }
+
+    float RobustDataAnalyzer::get_tolerance() const
+    {
+        return this->tolerance;
+    }
+
+    float RobustDataAnalyzer::get_trim_fraction() const
+    {
+        return this->trim_fraction;
+    }
+}
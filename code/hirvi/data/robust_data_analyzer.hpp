@@ -0,0 +1,69 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef HIRVI_DATA_ROBUST_DATA_ANALYZER_HPP_INCLUDED
+#define HIRVI_DATA_ROBUST_DATA_ANALYZER_HPP_INCLUDED
+
+#include "data_analyzer.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+#include <cstddef> // std::size_t
+#include <utility> // std::pair
+#include <vector>  // std::vector
+
+// `RobustDataAnalyzer` fuses noisy position reports of one target.
+//
+// Honest reports are assumed to lie within `tolerance` of each other
+// on each axis. The reports are bucketed into a grid of cubes of size
+// `tolerance` by sorting them by their cell, so that all honest reports
+// fall in the 3x3x3 cells around any of them. The 3x3x3 neighbourhood
+// with the most reports is the consensus. Reports farther than
+// `tolerance` on any axis from the per-axis median of the consensus
+// are traitors, also reports with non-finite coordinates. The position
+// is the per-axis mean of the valid reports with `trim_fraction` of the
+// lowest and of the highest values trimmed away; a `trim_fraction` of
+// 0.5 gives the median.
+//
+// `analyze_data` keeps no state between calls, the scratch buffers are
+// per thread, so one analyzer can serve many threads.
+
+namespace hirvi::data
+{
+    class RobustDataAnalyzer : public DataAnalyzer
+    {
+    public:
+        explicit RobustDataAnalyzer(float tolerance = 1.0f, float trim_fraction = 0.1f);
+
+        [[nodiscard]] std::pair<std::vector<std::size_t>, glm::vec3> analyze_data(
+            const std::vector<PositionReport>& reports) const override;
+
+        [[nodiscard]] float get_tolerance() const;
+
+        [[nodiscard]] float get_trim_fraction() const;
+
+    private:
+        float tolerance;
+        float trim_fraction;
+    };
+}
+
+#endif
@@ -19,8 +19,12 @@
 #include "code/hirvi/data/data_analyzer.hpp"
 
 // Include standard headers
-#include <algorithm> // std::ranges::copy
+#include <algorithm> // std::max, std::min, std::ranges::copy
+#include <atomic>    // std::atomic
+#include <cstddef>   // std::size_t
 #include <iterator>  // std::inserter
+#include <thread>    // std::thread
+#include <vector>    // std::vector
 
 namespace hirvi::data
 {
@@ -29,17 +33,115 @@ namespace hirvi::data
     void SpatialData::clear_reports()
     {
         this->position_reports.clear();
+        this->report_indices.clear();
+        this->analyzed_by_id = 0;
     }
 
     void SpatialData::add_report(const PositionReport& report)
     {
-        this->position_reports.emplace_back(report);
+        const auto [it, is_new_reporter] = this->report_indices.try_emplace(report.reporterID, this->position_reports.size());
+
+        if (is_new_reporter)
+        {
+            this->position_reports.emplace_back(report);
+        }
+        else
+        {
+            this->position_reports[it->second] = report;
+        }
+
+        this->analyzed_by_id = 0;
+    }
+
+    void SpatialData::remove_report(const std::size_t reporterID)
+    {
+        const auto it = this->report_indices.find(reporterID);
+
+        if (it == this->report_indices.end())
+        {
+            return;
+        }
+
+        // Move the last report into the freed slot.
+        const std::size_t report_i = it->second;
+        this->report_indices.erase(it);
+
+        if (report_i + 1 < this->position_reports.size())
+        {
+            this->position_reports[report_i] = this->position_reports.back();
+            this->report_indices[this->position_reports[report_i].reporterID] = report_i;
+        }
+
+        this->position_reports.pop_back();
+        this->analyzed_by_id = 0;
     }
 
     void SpatialData::determine_position_and_detect_traitors(const DataAnalyzer& data_analyzer)
     {
+        if (this->analyzed_by_id == data_analyzer.get_id())
+        {
+            // Nothing has changed.
+            return;
+        }
+
         const auto& [traitors, position] = data_analyzer.analyze_data(this->position_reports);
+        this->detected_traitors.clear();
         std::ranges::copy(traitors, std::inserter(this->detected_traitors, this->detected_traitors.end()));
         this->determined_position = position;
+        this->analyzed_by_id = data_analyzer.get_id();
+    }
+
+    void SpatialData::determine_positions_and_detect_traitors(
+        const std::vector<SpatialData*>& spatial_datas,
+        const DataAnalyzer& data_analyzer,
+        const std::size_t n_threads)
+    {
+        const std::size_t n_used_threads = std::min<std::size_t>(
+            n_threads > 0 ? n_threads : std::max<std::size_t>(std::thread::hardware_concurrency(), 1),
+            spatial_datas.size());
+
+        // The targets are claimed one at a time, as their numbers of reports may vary a lot.
+        std::atomic<std::size_t> next_i { 0 };
+
+        const auto analyze = [&]()
+        {
+            for (std::size_t i = next_i++; i < spatial_datas.size(); i = next_i++)
+            {
+                if (spatial_datas[i] != nullptr)
+                {
+                    spatial_datas[i]->determine_position_and_detect_traitors(data_analyzer);
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+
+        for (std::size_t thread_i = 1; thread_i < n_used_threads; thread_i++)
+        {
+            threads.emplace_back(analyze);
+        }
+
+        // The calling thread works too.
+        analyze();
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    const std::vector<PositionReport>& SpatialData::get_position_reports() const
+    {
+        return this->position_reports;
+    }
+
+    const std::set<std::size_t>& SpatialData::get_detected_traitors() const
+    {
+        return this->detected_traitors;
+    }
+
+    const glm::vec3& SpatialData::get_determined_position() const
+    {
+        return this->determined_position;
     }
 }
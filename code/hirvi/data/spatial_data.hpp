@@ -27,8 +27,21 @@
 #endif
 
 // Include standard headers
-#include <set>    // std::set
-#include <vector> // std::vector
+#include <cmath>         // NAN
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint64_t
+#include <set>           // std::set
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+// `SpatialData` collects the position reports of one target.
+//
+// Each reporter has at most one report: a new report replaces the
+// previous report of the same reporter, so reports can be streamed in
+// without clearing the old ones. The position and the traitors are
+// determined again only if the reports or the analyzer have changed
+// since the previous analysis, and the traitors are those of the
+// current reports only.
 
 namespace hirvi::data
 {
@@ -43,10 +56,27 @@ namespace hirvi::data
 
         void add_report(const PositionReport& report);
 
+        void remove_report(std::size_t reporterID);
+
         void determine_position_and_detect_traitors(const DataAnalyzer& data_analyzer);
 
+        // Analyzes many targets on `n_threads` threads, 0 means the hardware concurrency.
+        // `data_analyzer` must support concurrent calls of `analyze_data`.
+        static void determine_positions_and_detect_traitors(
+            const std::vector<SpatialData*>& spatial_datas,
+            const DataAnalyzer& data_analyzer,
+            std::size_t n_threads = 0);
+
+        [[nodiscard]] const std::vector<PositionReport>& get_position_reports() const;
+
+        [[nodiscard]] const std::set<std::size_t>& get_detected_traitors() const;
+
+        [[nodiscard]] const glm::vec3& get_determined_position() const;
+
     private:
         std::vector<PositionReport> position_reports;
+        std::unordered_map<std::size_t, std::size_t> report_indices; // Index of the report of each reporter.
+        std::uint64_t analyzed_by_id { 0 };                         // 0 if the reports have changed since.
 
         std::set<std::size_t> detected_traitors;
         glm::vec3 determined_position { NAN, NAN, NAN };
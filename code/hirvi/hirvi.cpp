@@ -101,6 +101,8 @@ namespace hirvi
             "fullscreen",
             "no-fullscreen",
             "headless",
+            "headless-simulation",
+            "ticks-per-second",
             "window-width",
             "window-height",
             "framebuffer-width",
@@ -108,7 +110,8 @@ namespace hirvi
             "speed",
             "turbo-factor",
             "twin-turbo-factor",
-            "mouse-speed"
+            "mouse-speed",
+            "source"
         };
     }
 
@@ -186,6 +189,20 @@ namespace hirvi
             universe_struct.graphics_api_backend = yli::render::GraphicsApiBackend::HEADLESS;
         }
 
+        if (this->command_line_master.is_key("headless-simulation"))
+        {
+            // Run the headless simulation loop, driven by console commands from stdin.
+            universe_struct.graphics_api_backend = yli::render::GraphicsApiBackend::HEADLESS;
+            universe_struct.should_run_headless_simulation = true;
+        }
+
+        if (this->command_line_master.is_key("ticks-per-second") &&
+            check_if_float_string<char>(this->command_line_master.get_value("ticks-per-second")))
+        {
+            universe_struct.headless_ticks_per_second =
+                    this->command_line_master.get_value_or_throw<float>("ticks-per-second");
+        }
+
         if (this->command_line_master.is_key("window-width") &&
             check_if_unsigned_integer_string<char>(this->command_line_master.get_value("window-width")))
         {
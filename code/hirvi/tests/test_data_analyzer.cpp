@@ -0,0 +1,177 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "gtest/gtest.h"
+#include "code/hirvi/data/position_report.hpp"
+#include "code/hirvi/data/robust_data_analyzer.hpp"
+#include "code/hirvi/data/spatial_data.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cmath>     // NAN, std::isnan
+#include <cstddef>   // std::size_t
+#include <memory>    // std::make_unique, std::unique_ptr
+#include <random>    // std::mt19937, std::normal_distribution, std::uniform_real_distribution
+#include <set>       // std::set
+#include <stdexcept> // std::runtime_error
+#include <vector>    // std::vector
+
+TEST(robust_data_analyzer_must_be_initialized_appropriately, robust_data_analyzer)
+{
+    const hirvi::data::RobustDataAnalyzer data_analyzer(2.0f, 0.25f);
+    ASSERT_EQ(data_analyzer.get_tolerance(), 2.0f);
+    ASSERT_EQ(data_analyzer.get_trim_fraction(), 0.25f);
+
+    ASSERT_THROW(hirvi::data::RobustDataAnalyzer(0.0f, 0.1f), std::runtime_error);
+    ASSERT_THROW(hirvi::data::RobustDataAnalyzer(NAN, 0.1f), std::runtime_error);
+    ASSERT_THROW(hirvi::data::RobustDataAnalyzer(1.0f, 0.6f), std::runtime_error);
+}
+
+TEST(robust_data_analyzer_must_detect_traitors, no_reports)
+{
+    const hirvi::data::RobustDataAnalyzer data_analyzer;
+    const auto [traitors, position] = data_analyzer.analyze_data({});
+    ASSERT_TRUE(traitors.empty());
+    ASSERT_TRUE(std::isnan(position.x));
+}
+
+TEST(robust_data_analyzer_must_detect_traitors, noisy_reports)
+{
+    const hirvi::data::RobustDataAnalyzer data_analyzer(1.0f, 0.1f);
+    const glm::vec3 target(100.3f, -7.0f, 12.9f);
+
+    std::mt19937 generator(2026);
+    std::uniform_real_distribution<float> noise_distribution(-0.4f, 0.4f);
+    std::uniform_real_distribution<float> lie_distribution(-50.0f, 50.0f);
+
+    std::vector<hirvi::data::PositionReport> reports;
+    std::set<std::size_t> expected_traitors;
+
+    for (std::size_t reporter_id = 0; reporter_id < 100; reporter_id++)
+    {
+        if (reporter_id % 4 == 3)
+        {
+            // Traitors report positions far away, some of them in agreement.
+            const glm::vec3 lie = (reporter_id % 8 == 3 ? glm::vec3(0.0f, 0.0f, 0.0f) :
+                    glm::vec3(lie_distribution(generator), lie_distribution(generator), lie_distribution(generator)));
+            reports.push_back({ target + glm::vec3(5.0f, 5.0f, 5.0f) + lie, reporter_id });
+            expected_traitors.insert(reporter_id);
+        }
+        else
+        {
+            reports.push_back({ target + glm::vec3(noise_distribution(generator), noise_distribution(generator), noise_distribution(generator)), reporter_id });
+        }
+    }
+
+    reports.push_back({ glm::vec3(NAN, 0.0f, 0.0f), 100 });
+    expected_traitors.insert(100);
+
+    const auto [traitors, position] = data_analyzer.analyze_data(reports);
+    ASSERT_EQ(std::set<std::size_t>(traitors.begin(), traitors.end()), expected_traitors);
+    ASSERT_NEAR(position.x, target.x, 0.1f);
+    ASSERT_NEAR(position.y, target.y, 0.1f);
+    ASSERT_NEAR(position.z, target.z, 0.1f);
+}
+
+TEST(robust_data_analyzer_must_estimate_position, median)
+{
+    const hirvi::data::RobustDataAnalyzer data_analyzer(10.0f, 0.5f);
+    const std::vector<hirvi::data::PositionReport> reports {
+        { glm::vec3(1.0f, 2.0f, 3.0f), 0 },
+        { glm::vec3(2.0f, 9.0f, 3.0f), 1 },
+        { glm::vec3(9.0f, 3.0f, 3.0f), 2 } };
+
+    const auto [traitors, position] = data_analyzer.analyze_data(reports);
+    ASSERT_TRUE(traitors.empty());
+    ASSERT_EQ(position, glm::vec3(2.0f, 3.0f, 3.0f));
+}
+
+TEST(spatial_data_must_stream_reports, robust_data_analyzer)
+{
+    const hirvi::data::RobustDataAnalyzer data_analyzer(1.0f, 0.0f);
+    hirvi::data::SpatialData spatial_data;
+    ASSERT_TRUE(std::isnan(spatial_data.get_determined_position().x));
+
+    spatial_data.add_report({ glm::vec3(1.0f, 1.0f, 1.0f), 1 });
+    spatial_data.add_report({ glm::vec3(1.0f, 1.0f, 1.0f), 2 });
+    spatial_data.add_report({ glm::vec3(40.0f, 1.0f, 1.0f), 3 });
+    spatial_data.determine_position_and_detect_traitors(data_analyzer);
+    ASSERT_EQ(spatial_data.get_determined_position(), glm::vec3(1.0f, 1.0f, 1.0f));
+    ASSERT_EQ(spatial_data.get_detected_traitors(), std::set<std::size_t>({ 3 }));
+
+    // A new report of a reporter replaces the previous one.
+    spatial_data.add_report({ glm::vec3(3.0f, 1.0f, 1.0f), 1 });
+    spatial_data.add_report({ glm::vec3(3.0f, 1.0f, 1.0f), 2 });
+    ASSERT_EQ(spatial_data.get_position_reports().size(), 3);
+    spatial_data.determine_position_and_detect_traitors(data_analyzer);
+    ASSERT_EQ(spatial_data.get_determined_position(), glm::vec3(3.0f, 1.0f, 1.0f));
+
+    spatial_data.remove_report(1);
+    spatial_data.remove_report(7);
+    ASSERT_EQ(spatial_data.get_position_reports().size(), 2);
+    spatial_data.add_report({ glm::vec3(40.5f, 1.0f, 1.0f), 4 });
+    spatial_data.add_report({ glm::vec3(40.5f, 1.0f, 1.0f), 5 });
+    spatial_data.determine_position_and_detect_traitors(data_analyzer);
+    ASSERT_NEAR(spatial_data.get_determined_position().x, (40.0f + 40.5f + 40.5f) / 3.0f, 1e-5f);
+
+    // The traitors are those of the current reports only.
+    ASSERT_EQ(spatial_data.get_detected_traitors(), std::set<std::size_t>({ 2 }));
+
+    // Another analyzer analyzes the same reports again.
+    const hirvi::data::RobustDataAnalyzer other_data_analyzer(100.0f, 0.0f);
+    spatial_data.determine_position_and_detect_traitors(other_data_analyzer);
+    ASSERT_TRUE(spatial_data.get_detected_traitors().empty());
+
+    spatial_data.clear_reports();
+    ASSERT_TRUE(spatial_data.get_position_reports().empty());
+}
+
+TEST(spatial_data_must_be_analyzed_in_parallel, robust_data_analyzer)
+{
+    const hirvi::data::RobustDataAnalyzer data_analyzer(1.0f, 0.1f);
+    std::vector<std::unique_ptr<hirvi::data::SpatialData>> targets;
+    std::vector<hirvi::data::SpatialData*> spatial_datas;
+    std::mt19937 generator(7);
+    std::normal_distribution<float> noise_distribution(0.0f, 0.1f);
+
+    for (std::size_t target_i = 0; target_i < 64; target_i++)
+    {
+        targets.emplace_back(std::make_unique<hirvi::data::SpatialData>());
+        spatial_datas.emplace_back(targets.back().get());
+        const glm::vec3 target(static_cast<float>(target_i), 0.0f, -static_cast<float>(target_i));
+
+        for (std::size_t reporter_id = 0; reporter_id < 10 * (target_i + 1); reporter_id++)
+        {
+            const glm::vec3 noise(noise_distribution(generator), noise_distribution(generator), noise_distribution(generator));
+            targets.back()->add_report({ (reporter_id == 0 ? glm::vec3(1000.0f) : target + noise), reporter_id });
+        }
+    }
+
+    hirvi::data::SpatialData::determine_positions_and_detect_traitors(spatial_datas, data_analyzer, 4);
+
+    for (std::size_t target_i = 0; target_i < targets.size(); target_i++)
+    {
+        const glm::vec3& position = targets[target_i]->get_determined_position();
+        ASSERT_NEAR(position.x, static_cast<float>(target_i), 0.2f);
+        ASSERT_NEAR(position.z, -static_cast<float>(target_i), 0.2f);
+        ASSERT_EQ(targets[target_i]->get_detected_traitors(), std::set<std::size_t>({ 0 }));
+    }
+}
@@ -0,0 +1,288 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "morph_animation.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::clamp, std::max, std::min
+#include <cmath>     // std::abs, std::floor, std::fmod, std::lround
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t, std::uint64_t
+#include <stdexcept> // std::runtime_error
+#include <vector>    // std::vector
+
+namespace yli::animation
+{
+    static MorphPhase get_phase_at_position(const double position, const std::size_t n_forms)
+    {
+        const double last = static_cast<double>(n_forms - 1);
+        const double clamped_position = std::clamp(position, 0.0, last);
+        const std::uint32_t current_form = static_cast<std::uint32_t>(clamped_position);
+        const std::uint32_t next_form = std::min<std::uint32_t>(current_form + 1, static_cast<std::uint32_t>(n_forms - 1));
+        return MorphPhase { current_form, next_form, static_cast<float>(clamped_position - current_form) };
+    }
+
+    MorphPhase get_morph_phase(const MorphPlayback& playback, const std::size_t n_forms, const double time)
+    {
+        if (n_forms == 0) [[unlikely]]
+        {
+            return MorphPhase();
+        }
+
+        const double last = static_cast<double>(n_forms - 1);
+        const double offset = static_cast<double>(std::min(playback.initial_offset, n_forms - 1));
+
+        if (playback.speed == 0.0f || n_forms == 1 || !(time > 0.0))
+        {
+            return get_phase_at_position(offset, n_forms);
+        }
+
+        const bool is_forward = (playback.speed > 0.0f);
+        double distance = std::abs(static_cast<double>(playback.speed)) * time;
+
+        if (playback.bounce_from_start && playback.bounce_from_end)
+        {
+            // Unfold the bouncing into a cycle of 2 * `last` forms, going forward first.
+            const double unfolded = std::fmod((is_forward ? offset : 2.0 * last - offset) + distance, 2.0 * last);
+            return get_phase_at_position(unfolded <= last ? unfolded : 2.0 * last - unfolded, n_forms);
+        }
+
+        if (!playback.bounce_from_start && !playback.bounce_from_end)
+        {
+            if (!playback.is_repeating)
+            {
+                return get_phase_at_position(offset + (is_forward ? distance : -distance), n_forms);
+            }
+
+            // Wrap around, the last form blends into the first one.
+            const double n = static_cast<double>(n_forms);
+            double position = std::fmod(offset + (is_forward ? distance : -distance), n);
+            position += (position < 0.0 ? n : 0.0);
+            const std::uint32_t current_form = std::min(static_cast<std::uint32_t>(position), static_cast<std::uint32_t>(n_forms - 1));
+            const std::uint32_t next_form = static_cast<std::uint32_t>((current_form + 1) % n_forms);
+            return MorphPhase { current_form, next_form, static_cast<float>(std::clamp(position - current_form, 0.0, 1.0)) };
+        }
+
+        // One bouncing end: a cycle goes to the end in the initial direction,
+        // bounces back to the other end if it was the bouncing end, and ends.
+        const bool is_towards_bouncing_end = (is_forward == playback.bounce_from_end);
+        const double distance_to_end = (is_forward ? last - offset : offset);
+        const double cycle = distance_to_end + (is_towards_bouncing_end ? last : 0.0);
+
+        if (cycle <= 0.0)
+        {
+            return get_phase_at_position(offset, n_forms);
+        }
+
+        distance = (playback.is_repeating ? std::fmod(distance, cycle) : std::min(distance, cycle));
+
+        if (distance <= distance_to_end)
+        {
+            return get_phase_at_position(offset + (is_forward ? distance : -distance), n_forms);
+        }
+
+        const double bounced_distance = distance - distance_to_end;
+        return get_phase_at_position(is_forward ? last - bounced_distance : bounced_distance, n_forms);
+    }
+
+    void MorphTargetBuffer::clear() noexcept
+    {
+        this->data.clear();
+        this->n_forms = 0;
+        this->n_vertices = 0;
+        this->n_components = 0;
+    }
+
+    void MorphTargetBuffer::add_form(const std::vector<glm::vec3>& vertices, const std::vector<glm::vec3>& normals)
+    {
+        const std::size_t n_components = (normals.empty() ? 3 : 6);
+
+        if (!normals.empty() && normals.size() != vertices.size()) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `MorphTargetBuffer::add_form`: number of normals does not match the number of vertices!");
+        }
+
+        if (this->n_forms > 0 && (vertices.size() != this->n_vertices || n_components != this->n_components)) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `MorphTargetBuffer::add_form`: the form does not match the previous forms!");
+        }
+
+        this->n_vertices = vertices.size();
+        this->n_components = n_components;
+        this->data.reserve(this->data.size() + n_components * this->n_vertices);
+
+        for (std::size_t component = 0; component < n_components; component++)
+        {
+            const std::vector<glm::vec3>& source = (component < 3 ? vertices : normals);
+
+            for (const glm::vec3& vector : source)
+            {
+                this->data.emplace_back(vector[static_cast<int>(component % 3)]);
+            }
+        }
+
+        this->n_forms++;
+    }
+
+    std::size_t MorphTargetBuffer::get_number_of_forms() const noexcept
+    {
+        return this->n_forms;
+    }
+
+    std::size_t MorphTargetBuffer::get_number_of_vertices() const noexcept
+    {
+        return this->n_vertices;
+    }
+
+    std::size_t MorphTargetBuffer::get_number_of_components() const noexcept
+    {
+        return this->n_components;
+    }
+
+    const float* MorphTargetBuffer::get_component(const std::size_t form, const std::size_t component) const
+    {
+        if (form >= this->n_forms || component >= this->n_components) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `MorphTargetBuffer::get_component`: form or component out of range!");
+        }
+
+        return this->data.data() + (form * this->n_components + component) * this->n_vertices;
+    }
+
+    MorphEvaluator::MorphEvaluator(const std::uint32_t n_blend_steps)
+        : n_blend_steps { std::max<std::uint32_t>(n_blend_steps, 1) }
+    {
+    }
+
+    void MorphEvaluator::begin_frame()
+    {
+        this->slots_by_key.clear();
+        this->phases.clear();
+        this->n_requests = 0;
+    }
+
+    std::uint32_t MorphEvaluator::request(const MorphPhase& phase)
+    {
+        this->n_requests++;
+
+        // Blends at either end are the forms themselves.
+        const std::uint32_t step = static_cast<std::uint32_t>(
+                std::clamp<long>(std::lround(phase.blend * static_cast<float>(this->n_blend_steps)), 0, this->n_blend_steps));
+        const std::uint32_t current_form = (step == this->n_blend_steps ? phase.next_form : phase.current_form);
+        const std::uint32_t next_form = (step == 0 ? phase.current_form : phase.next_form);
+        const std::uint32_t quantized_step = (step == this->n_blend_steps ? 0 : step);
+
+        const std::uint64_t key =
+            (static_cast<std::uint64_t>(current_form) << 40) |
+            (static_cast<std::uint64_t>(next_form & 0xffffff) << 16) |
+            quantized_step;
+
+        const auto [it, is_new_phase] = this->slots_by_key.try_emplace(key, static_cast<std::uint32_t>(this->phases.size()));
+
+        if (is_new_phase)
+        {
+            this->phases.push_back({
+                    current_form,
+                    next_form,
+                    static_cast<float>(quantized_step) / static_cast<float>(this->n_blend_steps) });
+        }
+
+        return it->second;
+    }
+
+    void MorphEvaluator::evaluate(const MorphTargetBuffer& morph_target_buffer)
+    {
+        this->n_vertices = morph_target_buffer.get_number_of_vertices();
+        this->n_components = morph_target_buffer.get_number_of_components();
+        const std::size_t slot_size = this->n_components * this->n_vertices;
+        this->results.resize(this->phases.size() * slot_size);
+
+        if (morph_target_buffer.get_number_of_forms() == 0)
+        {
+            return;
+        }
+
+        const std::uint32_t last_form = static_cast<std::uint32_t>(morph_target_buffer.get_number_of_forms() - 1);
+
+        for (std::size_t slot = 0; slot < this->phases.size(); slot++)
+        {
+            const MorphPhase& phase = this->phases[slot];
+            const std::uint32_t current_form = std::min(phase.current_form, last_form);
+            const std::uint32_t next_form = std::min(phase.next_form, last_form);
+            const float blend = phase.blend;
+
+            for (std::size_t component = 0; component < this->n_components; component++)
+            {
+                const float* const a = morph_target_buffer.get_component(current_form, component);
+                const float* const b = morph_target_buffer.get_component(next_form, component);
+                float* const result = this->results.data() + slot * slot_size + component * this->n_vertices;
+
+                for (std::size_t vertex_i = 0; vertex_i < this->n_vertices; vertex_i++)
+                {
+                    result[vertex_i] = a[vertex_i] + (b[vertex_i] - a[vertex_i]) * blend;
+                }
+            }
+        }
+    }
+
+    std::size_t MorphEvaluator::get_number_of_requests() const noexcept
+    {
+        return this->n_requests;
+    }
+
+    std::size_t MorphEvaluator::get_number_of_slots() const noexcept
+    {
+        return this->phases.size();
+    }
+
+    const MorphPhase& MorphEvaluator::get_phase(const std::uint32_t slot) const
+    {
+        return this->phases.at(slot);
+    }
+
+    const float* MorphEvaluator::get_component(const std::uint32_t slot, const std::size_t component) const
+    {
+        if (slot >= this->phases.size() || component >= this->n_components) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `MorphEvaluator::get_component`: slot or component out of range!");
+        }
+
+        return this->results.data() + (slot * this->n_components + component) * this->n_vertices;
+    }
+
+    glm::vec3 MorphEvaluator::get_vertex(const std::uint32_t slot, const std::size_t vertex_i) const
+    {
+        return glm::vec3(
+                this->get_component(slot, 0)[vertex_i],
+                this->get_component(slot, 1)[vertex_i],
+                this->get_component(slot, 2)[vertex_i]);
+    }
+
+    glm::vec3 MorphEvaluator::get_normal(const std::uint32_t slot, const std::size_t vertex_i) const
+    {
+        return glm::vec3(
+                this->get_component(slot, 3)[vertex_i],
+                this->get_component(slot, 4)[vertex_i],
+                this->get_component(slot, 5)[vertex_i]);
+    }
+}
@@ -0,0 +1,149 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_ANIMATION_MORPH_ANIMATION_HPP_INCLUDED
+#define YLIKUUTIO_ANIMATION_MORPH_ANIMATION_HPP_INCLUDED
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint32_t, std::uint64_t
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+// Morph target animation, as in `ShapeshifterTransformation`.
+//
+// How morph target animation works:
+//
+// `MorphTargetBuffer` packs the vertices and normals of all forms of
+// a transformation into one contiguous buffer, each coordinate of each
+// form as its own array, so that blending 2 forms is a single pass of
+// `a + (b - a) * blend` over contiguous floats, which the compiler
+// vectorizes.
+//
+// `get_morph_phase` tells which 2 forms an instance blends, and how,
+// at a given time. `MorphEvaluator` collects the phases of all
+// instances for a frame, quantizes the blends to `n_blend_steps`
+// steps, and gives the instances with the same quantized phase the
+// same slot. `evaluate` then blends each distinct phase once, so a
+// frame costs one mesh per distinct phase, however many instances
+// share it.
+
+namespace yli::animation
+{
+    // How the forms are played, as in `ShapeshifterSequence`.
+    struct MorphPlayback
+    {
+        float speed { 0.0f };             // Forms per second. Negative speed plays backwards.
+        std::size_t initial_offset { 0 }; // Index of the form from which to begin.
+
+        // Repeating playback begins again from `initial_offset` in the same direction
+        // after all bouncing has ended. Without bouncing the last form blends into the first.
+        bool is_repeating { true };
+
+        // If both are `true`, the playback bounces endlessly.
+        bool bounce_from_start { false };
+        bool bounce_from_end { false };
+    };
+
+    // The blend of `current_form` weighted by 1 - `blend` and `next_form` weighted by `blend`.
+    struct MorphPhase
+    {
+        std::uint32_t current_form { 0 };
+        std::uint32_t next_form { 0 };
+        float blend { 0.0f };
+
+        bool operator==(const MorphPhase& other) const noexcept = default;
+    };
+
+    MorphPhase get_morph_phase(const MorphPlayback& playback, std::size_t n_forms, double time);
+
+    class MorphTargetBuffer
+    {
+        public:
+            // The coordinates of a vertex, then of a normal.
+            static constexpr std::size_t max_components { 6 };
+
+            MorphTargetBuffer() = default;
+
+            void clear() noexcept;
+
+            // All forms must have the same number of vertices, and either all or none of them normals.
+            void add_form(const std::vector<glm::vec3>& vertices, const std::vector<glm::vec3>& normals);
+
+            std::size_t get_number_of_forms() const noexcept;
+
+            std::size_t get_number_of_vertices() const noexcept;
+
+            // 3 without normals, 6 with normals.
+            std::size_t get_number_of_components() const noexcept;
+
+            // The array of coordinate `component` of `form`: x, y, z of the vertices, then of the normals.
+            const float* get_component(std::size_t form, std::size_t component) const;
+
+        private:
+            std::vector<float> data;
+            std::size_t n_forms { 0 };
+            std::size_t n_vertices { 0 };
+            std::size_t n_components { 0 };
+    };
+
+    class MorphEvaluator
+    {
+        public:
+            explicit MorphEvaluator(std::uint32_t n_blend_steps = 64);
+
+            // Forgets the phases of the previous frame.
+            void begin_frame();
+
+            // Returns the slot of the blended mesh of `phase`, shared by the same quantized phases.
+            std::uint32_t request(const MorphPhase& phase);
+
+            // Blends each distinct phase requested since `begin_frame` once.
+            void evaluate(const MorphTargetBuffer& morph_target_buffer);
+
+            std::size_t get_number_of_requests() const noexcept;
+
+            std::size_t get_number_of_slots() const noexcept;
+
+            // The quantized phase of `slot`.
+            const MorphPhase& get_phase(std::uint32_t slot) const;
+
+            // The blended array of coordinate `component` of `slot`, valid after `evaluate`.
+            const float* get_component(std::uint32_t slot, std::size_t component) const;
+
+            glm::vec3 get_vertex(std::uint32_t slot, std::size_t vertex_i) const;
+
+            glm::vec3 get_normal(std::uint32_t slot, std::size_t vertex_i) const;
+
+        private:
+            std::unordered_map<std::uint64_t, std::uint32_t> slots_by_key;
+            std::vector<MorphPhase> phases;
+            std::vector<float> results; // The components of each slot, as in `MorphTargetBuffer`.
+            std::size_t n_requests { 0 };
+            std::size_t n_vertices { 0 };
+            std::size_t n_components { 0 };
+            std::uint32_t n_blend_steps;
+    };
+}
+
+#endif
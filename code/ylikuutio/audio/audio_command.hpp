@@ -0,0 +1,85 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_AUDIO_AUDIO_COMMAND_HPP_INCLUDED
+#define YLIKUUTIO_AUDIO_AUDIO_COMMAND_HPP_INCLUDED
+
+#include "command_queue.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+
+namespace yli::audio
+{
+    class AudioStream;
+    struct SoundBuffer;
+
+    // 0 is not a valid `VoiceId`.
+    using VoiceId = std::uint32_t;
+
+    enum class AudioCommandType
+    {
+        PLAY_VOICE,
+        STOP_VOICE,
+        STOP_ALL_VOICES,
+        SET_VOICE_POSITION,
+        SET_VOICE_GAIN,
+        SET_LISTENER
+    };
+
+    // Sent from the main thread to the audio thread.
+    // A `PLAY_VOICE` command plays either `sound_buffer` or `audio_stream`.
+    // Both must stay alive until the corresponding `VOICE_FINISHED` event.
+    struct AudioCommand
+    {
+        AudioCommandType type { AudioCommandType::STOP_ALL_VOICES };
+        VoiceId voice_id { 0 };
+        const SoundBuffer* sound_buffer { nullptr };
+        AudioStream* audio_stream { nullptr };
+        glm::vec3 position { 0.0f, 0.0f, 0.0f }; // Voice or listener position.
+        glm::vec3 right { 1.0f, 0.0f, 0.0f };    // Listener right vector.
+        float gain { 1.0f };
+        bool is_positional { false };
+        bool loop { false };
+    };
+
+    enum class AudioEventType
+    {
+        VOICE_FINISHED
+    };
+
+    // Sent from the audio thread to the main thread.
+    struct AudioEvent
+    {
+        AudioEventType type { AudioEventType::VOICE_FINISHED };
+        VoiceId voice_id { 0 };
+    };
+
+    inline constexpr std::size_t audio_queue_size = 1024;
+
+    using AudioCommandQueue = CommandQueue<AudioCommand, audio_queue_size>;
+    using AudioEventQueue = CommandQueue<AudioEvent, audio_queue_size>;
+}
+
+#endif
@@ -0,0 +1,45 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_AUDIO_AUDIO_DECODER_HPP_INCLUDED
+#define YLIKUUTIO_AUDIO_AUDIO_DECODER_HPP_INCLUDED
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <span>    // std::span
+
+namespace yli::audio
+{
+    // `AudioDecoder` produces interleaved stereo `float` samples
+    // at the sample rate of the mixer, one chunk at a time.
+    class AudioDecoder
+    {
+        public:
+            AudioDecoder() = default;
+
+            AudioDecoder(const AudioDecoder&) = delete;            // Delete copy constructor.
+            AudioDecoder& operator=(const AudioDecoder&) = delete; // Delete copy assignment.
+
+            virtual ~AudioDecoder() = default;
+
+            // Decodes at most `samples.size() / 2` frames into `samples`.
+            // Returns the number of frames decoded, 0 at the end of the audio.
+            virtual std::size_t decode(std::span<float> samples) = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,46 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_AUDIO_AUDIO_OUTPUT_HPP_INCLUDED
+#define YLIKUUTIO_AUDIO_AUDIO_OUTPUT_HPP_INCLUDED
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <span>    // std::span
+
+namespace yli::audio
+{
+    // `AudioOutput` receives the mixed interleaved stereo `float` samples.
+    class AudioOutput
+    {
+        public:
+            AudioOutput() = default;
+
+            AudioOutput(const AudioOutput&) = delete;            // Delete copy constructor.
+            AudioOutput& operator=(const AudioOutput&) = delete; // Delete copy assignment.
+
+            virtual ~AudioOutput() = default;
+
+            // Returns the number of frames queued but not yet played.
+            virtual std::size_t get_n_queued_frames() const = 0;
+
+            // Returns `false` on failure.
+            virtual bool put(std::span<const float> samples) = 0;
+    };
+}
+
+#endif
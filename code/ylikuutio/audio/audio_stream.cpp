@@ -0,0 +1,107 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "audio_stream.hpp"
+#include "audio_decoder.hpp"
+
+// Include standard headers
+#include <algorithm> // std::copy_n, std::max, std::min
+#include <cstddef>   // std::size_t
+#include <memory>    // std::unique_ptr
+#include <span>      // std::span
+#include <utility>   // std::move
+
+namespace yli::audio
+{
+    AudioStream::AudioStream(std::unique_ptr<AudioDecoder>&& decoder, const std::size_t n_chunk_frames, const std::size_t n_chunks)
+        : decoder { std::move(decoder) },
+          n_chunk_frames { std::max<std::size_t>(n_chunk_frames, 1) },
+          capacity { this->n_chunk_frames * std::max<std::size_t>(n_chunks, 1) }
+    {
+        this->ring_buffer.resize(2 * this->capacity);
+        this->is_decoder_finished = (this->decoder == nullptr);
+    }
+
+    AudioStream::~AudioStream() = default;
+
+    std::size_t AudioStream::refill()
+    {
+        std::size_t n_frames_decoded = 0;
+
+        while (!this->is_decoder_finished && this->capacity - this->n_buffered_frames >= this->n_chunk_frames)
+        {
+            const std::size_t write_frame_i = (this->read_frame_i + this->n_buffered_frames) % this->capacity;
+
+            // A chunk which would cross the end of the ring buffer is decoded in two parts.
+            const std::size_t n_frames_to_decode = std::min(this->n_chunk_frames, this->capacity - write_frame_i);
+            const std::size_t n_frames = this->decoder->decode(
+                    std::span<float>(this->ring_buffer.data() + 2 * write_frame_i, 2 * n_frames_to_decode));
+
+            if (n_frames == 0)
+            {
+                this->is_decoder_finished = true;
+                break;
+            }
+
+            this->n_buffered_frames += n_frames;
+            this->n_decoded_frames += n_frames;
+            n_frames_decoded += n_frames;
+        }
+
+        return n_frames_decoded;
+    }
+
+    std::size_t AudioStream::read(std::span<float> samples)
+    {
+        const std::size_t n_frames = std::min(samples.size() / 2, this->n_buffered_frames);
+        std::size_t n_frames_read = 0;
+
+        while (n_frames_read < n_frames)
+        {
+            const std::size_t n_contiguous_frames = std::min(n_frames - n_frames_read, this->capacity - this->read_frame_i);
+            std::copy_n(
+                    this->ring_buffer.data() + 2 * this->read_frame_i,
+                    2 * n_contiguous_frames,
+                    samples.data() + 2 * n_frames_read);
+            this->read_frame_i = (this->read_frame_i + n_contiguous_frames) % this->capacity;
+            n_frames_read += n_contiguous_frames;
+        }
+
+        this->n_buffered_frames -= n_frames_read;
+        return n_frames_read;
+    }
+
+    bool AudioStream::get_is_finished() const
+    {
+        return this->is_decoder_finished && this->n_buffered_frames == 0;
+    }
+
+    std::size_t AudioStream::get_n_buffered_frames() const
+    {
+        return this->n_buffered_frames;
+    }
+
+    std::size_t AudioStream::get_n_decoded_frames() const
+    {
+        return this->n_decoded_frames;
+    }
+
+    std::size_t AudioStream::get_capacity() const
+    {
+        return this->capacity;
+    }
+}
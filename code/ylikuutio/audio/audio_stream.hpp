@@ -0,0 +1,76 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_AUDIO_AUDIO_STREAM_HPP_INCLUDED
+#define YLIKUUTIO_AUDIO_AUDIO_STREAM_HPP_INCLUDED
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <memory>  // std::unique_ptr
+#include <span>    // std::span
+#include <vector>  // std::vector
+
+namespace yli::audio
+{
+    class AudioDecoder;
+
+    // `AudioStream` decodes a long sound, e.g. music, in chunks into a
+    // ring buffer of `n_chunks` chunks, instead of decoding it all at once.
+    //
+    // `AudioStream` is not thread-safe. It is prefilled by the thread that
+    // creates it, and after it has been handed over to the audio thread
+    // only the audio thread calls `refill` and `read`.
+
+    class AudioStream final
+    {
+        public:
+            AudioStream(std::unique_ptr<AudioDecoder>&& decoder, std::size_t n_chunk_frames, std::size_t n_chunks);
+
+            AudioStream(const AudioStream&) = delete;            // Delete copy constructor.
+            AudioStream& operator=(const AudioStream&) = delete; // Delete copy assignment.
+
+            ~AudioStream();
+
+            // Decodes whole chunks until the ring buffer is full or the audio ends.
+            // Returns the number of frames decoded.
+            std::size_t refill();
+
+            // Reads at most `samples.size() / 2` frames into `samples`.
+            // Returns the number of frames read, which may be less than requested
+            // if decoding has not kept up.
+            std::size_t read(std::span<float> samples);
+
+            // Returns `true` when the audio has ended and all of it has been read.
+            bool get_is_finished() const;
+
+            std::size_t get_n_buffered_frames() const;
+            std::size_t get_n_decoded_frames() const;
+            std::size_t get_capacity() const;
+
+        private:
+            std::unique_ptr<AudioDecoder> decoder;
+            std::vector<float> ring_buffer;       // Interleaved stereo samples.
+            const std::size_t n_chunk_frames;
+            const std::size_t capacity;           // In frames.
+            std::size_t read_frame_i { 0 };
+            std::size_t n_buffered_frames { 0 };
+            std::size_t n_decoded_frames { 0 };
+            bool is_decoder_finished { false };
+    };
+}
+
+#endif
@@ -16,16 +16,35 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "audio_system.hpp"
+#include "audio_command.hpp"
+#include "audio_stream.hpp"
+#include "mixer_thread.hpp"
+#include "sdl_audio_output.hpp"
+#include "sdl_mixer_decoder.hpp"
+#include "sound_buffer.hpp"
 #include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/ontology/camera.hpp"
 #include "code/ylikuutio/sdl/ylikuutio_sdl.hpp"
 
 #include <SDL3/SDL.h>
 #include <SDL3_mixer/SDL_mixer.h>
 
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
 // Include standard headers
+#include <cstddef>  // std::size_t
 #include <iostream> // std::cerr
+#include <limits>   // std::numeric_limits
 #include <list>     // std::list
+#include <memory>   // std::make_unique, std::unique_ptr
+#include <span>     // std::span
 #include <string>   // std::string
+#include <utility>  // std::move
+#include <vector>   // std::vector
 
 namespace yli::audio
 {
@@ -41,14 +60,18 @@ namespace yli::audio
     {
         this->terminate();
 
-        if (!this->universe.get_is_silent())
-        {
-            // TODO: Deinit if needed!
-        }
+        // The audio thread must be stopped before the sounds it plays are destroyed.
+        this->mixer_thread.reset();
+        this->audio_output.reset();
     }
 
     bool AudioSystem::init()
     {
+        if (this->universe.get_is_silent())
+        {
+            return true;
+        }
+
         if (!MIX_Init())
         {
             std::cerr << "ERROR: `AudioSystem::init`: initializing SDL_mixer library failed!\n";
@@ -56,54 +79,133 @@ namespace yli::audio
             return false;
         }
 
-        this->mixer = MIX_CreateMixerDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, nullptr);
+        this->audio_output = std::make_unique<SdlAudioOutput>(sample_rate);
+
+        if (!this->audio_output->get_is_valid())
+        {
+            std::cerr << "ERROR: `AudioSystem::init`: creating audio output failed!\n";
+            this->audio_output.reset();
+            return false;
+        }
+
+        this->mixer_thread = std::make_unique<MixerThread>(*this->audio_output, max_n_voices, n_block_frames, n_target_latency_frames);
+        this->mixer_thread->start();
+        return true;
+    }
+
+    void AudioSystem::terminate()
+    {
+        this->constructible_module.alive = false;
+
+        if (this->mixer_thread != nullptr)
+        {
+            this->mixer_thread->stop();
+        }
+    }
+
+    bool AudioSystem::load_and_play(const std::string& audio_file)
+    {
+        if (this->mixer_thread == nullptr)
+        {
+            return true;
+        }
+
+        // Long audio files are streamed in chunks instead of decoding them all at once.
+        auto decoder = std::make_unique<SdlMixerDecoder>(this->get_audio_file_path(audio_file), sample_rate);
 
-        if (this->mixer == nullptr)
+        if (!decoder->get_is_valid())
         {
-            std::cerr << "ERROR: `AudioSystem::init`: creating mixer failed!\n";
-            sdl::print_sdl_error();
+            std::cerr << "ERROR: `AudioSystem::load_and_play`: loading audio file " << audio_file << " failed!\n";
             return false;
         }
 
-        this->music_track = MIX_CreateTrack(this->mixer);
+        this->stop_voice(this->music_voice_id);
 
-        if (this->music_track == nullptr)
+        auto audio_stream = std::make_unique<AudioStream>(std::move(decoder), n_stream_chunk_frames, n_stream_chunks);
+        audio_stream->refill();
+
+        AudioCommand command;
+        command.audio_stream = audio_stream.get();
+        const VoiceId voice_id = this->play_voice(command);
+
+        if (voice_id == 0)
         {
-            std::cerr << "ERROR: `AudioSystem::init`: creating music track failed!\n";
-            sdl::print_sdl_error();
             return false;
         }
 
+        this->audio_stream_map[voice_id] = std::move(audio_stream);
+        this->music_voice_id = voice_id;
         return true;
     }
 
-    void AudioSystem::terminate()
+    VoiceId AudioSystem::play_sound(const std::string& audio_file, const float gain, const bool loop)
     {
-        this->constructible_module.alive = false;
+        const SoundBuffer* const sound_buffer = this->get_or_load_sound_buffer(audio_file);
+
+        if (sound_buffer == nullptr)
+        {
+            return 0;
+        }
+
+        AudioCommand command;
+        command.sound_buffer = sound_buffer;
+        command.gain = gain;
+        command.loop = loop;
+        return this->play_voice(command);
     }
 
-    bool AudioSystem::load_and_play(const std::string& audio_file)
+    VoiceId AudioSystem::play_sound_at(const std::string& audio_file, const glm::vec3& position, const float gain, const bool loop)
     {
-        // There's no sound with that filename loaded yet, so load it now.
-        if (!this->universe.get_is_silent())
+        const SoundBuffer* const sound_buffer = this->get_or_load_sound_buffer(audio_file);
+
+        if (sound_buffer == nullptr)
         {
-            char* audio_file_path = nullptr;
-            SDL_asprintf(&audio_file_path, "%s%s", SDL_GetBasePath(), audio_file.c_str());
-            MIX_Audio* const audio = MIX_LoadAudio(this->mixer, audio_file_path, false);
-            if (audio == nullptr)
-            {
-                std::cerr << "ERROR: `AudioSystem::load_and_play`: loading audio file " << std::string(audio_file_path) << " failed!\n";
-                yli::sdl::print_sdl_error();
-                return false;
-            }
+            return 0;
+        }
 
-            SDL_free(audio_file_path);
+        AudioCommand command;
+        command.sound_buffer = sound_buffer;
+        command.position = position;
+        command.gain = gain;
+        command.is_positional = true;
+        command.loop = loop;
+        return this->play_voice(command);
+    }
 
-            MIX_SetTrackAudio(this->music_track, audio);
-            MIX_PlayTrack(this->music_track, 0); // Play the track!
+    void AudioSystem::set_voice_position(const VoiceId voice_id, const glm::vec3& position)
+    {
+        if (this->mixer_thread != nullptr && voice_id != 0)
+        {
+            AudioCommand command;
+            command.type = AudioCommandType::SET_VOICE_POSITION;
+            command.voice_id = voice_id;
+            command.position = position;
+            this->push_command(command);
         }
+    }
 
-        return true;
+    void AudioSystem::set_voice_gain(const VoiceId voice_id, const float gain)
+    {
+        if (this->mixer_thread != nullptr && voice_id != 0)
+        {
+            AudioCommand command;
+            command.type = AudioCommandType::SET_VOICE_GAIN;
+            command.voice_id = voice_id;
+            command.gain = gain;
+            this->push_command(command);
+        }
+    }
+
+    void AudioSystem::stop_voice(const VoiceId voice_id)
+    {
+        // The stream of the voice is destroyed when the audio thread reports the voice as finished.
+        if (this->mixer_thread != nullptr && voice_id != 0)
+        {
+            AudioCommand command;
+            command.type = AudioCommandType::STOP_VOICE;
+            command.voice_id = voice_id;
+            this->push_command(command);
+        }
     }
 
     void AudioSystem::add_to_playlist(const std::string& playlist, const std::string& audio_file)
@@ -147,18 +249,37 @@ namespace yli::audio
 
     void AudioSystem::update()
     {
-        if (!this->universe.get_is_silent() && this->current_playlist.size() > 0)
+        if (this->mixer_thread == nullptr)
         {
-            // This function checks if a playlist is running.
-            // if yes, then if the the previous sound has ended,
-            // its memory gets freed and a new sound gets started.
+            return;
+        }
+
+        this->push_pending_commands();
+
+        bool has_music_ended = false;
+        AudioEvent event;
 
-            if (!MIX_TrackPlaying(this->music_track))
+        while (this->mixer_thread->pop_event(event))
+        {
+            if (event.type == AudioEventType::VOICE_FINISHED)
             {
-                // Song ended.
-                this->next_song_from_playlist();
+                this->audio_stream_map.erase(event.voice_id);
+
+                if (event.voice_id == this->music_voice_id)
+                {
+                    this->music_voice_id = 0;
+                    has_music_ended = true;
+                }
             }
         }
+
+        if (has_music_ended && this->current_playlist.size() > 0)
+        {
+            // Song ended.
+            this->next_song_from_playlist();
+        }
+
+        this->update_listener();
     }
 
     void AudioSystem::next_song_from_playlist()
@@ -188,12 +309,19 @@ namespace yli::audio
 
     void AudioSystem::pause()
     {
-        // TODO: implement pause!
+        // Without the audio thread the output queue drains and the voices stay where they are.
+        if (this->mixer_thread != nullptr)
+        {
+            this->mixer_thread->stop();
+        }
     }
 
     void AudioSystem::continue_after_pause()
     {
-        // TODO: implement continue after pause!
+        if (this->mixer_thread != nullptr)
+        {
+            this->mixer_thread->start();
+        }
     }
 
     void AudioSystem::clear_playlist(const std::string& /* playlist */)
@@ -205,4 +333,112 @@ namespace yli::audio
     {
         // TODO: implement erase playlist!
     }
+
+    std::string AudioSystem::get_audio_file_path(const std::string& audio_file) const
+    {
+        char* audio_file_path = nullptr;
+        SDL_asprintf(&audio_file_path, "%s%s", SDL_GetBasePath(), audio_file.c_str());
+        const std::string audio_file_path_string = (audio_file_path != nullptr ? audio_file_path : audio_file);
+        SDL_free(audio_file_path);
+        return audio_file_path_string;
+    }
+
+    const SoundBuffer* AudioSystem::get_or_load_sound_buffer(const std::string& audio_file)
+    {
+        if (this->mixer_thread == nullptr)
+        {
+            return nullptr;
+        }
+
+        if (auto it = this->sound_buffer_map.find(audio_file); it != this->sound_buffer_map.end())
+        {
+            return it->second.get();
+        }
+
+        SdlMixerDecoder decoder(this->get_audio_file_path(audio_file), sample_rate);
+
+        if (!decoder.get_is_valid())
+        {
+            std::cerr << "ERROR: `AudioSystem::get_or_load_sound_buffer`: loading audio file " << audio_file << " failed!\n";
+            return nullptr;
+        }
+
+        auto sound_buffer = std::make_unique<SoundBuffer>();
+
+        for (std::size_t n_frames = n_stream_chunk_frames; n_frames > 0; )
+        {
+            const std::size_t n_samples = sound_buffer->samples.size();
+            sound_buffer->samples.resize(n_samples + 2 * n_stream_chunk_frames);
+            n_frames = decoder.decode(std::span<float>(sound_buffer->samples.data() + n_samples, 2 * n_stream_chunk_frames));
+            sound_buffer->samples.resize(n_samples + 2 * n_frames);
+        }
+
+        const SoundBuffer* const sound_buffer_pointer = sound_buffer.get();
+        this->sound_buffer_map[audio_file] = std::move(sound_buffer);
+        return sound_buffer_pointer;
+    }
+
+    VoiceId AudioSystem::play_voice(AudioCommand& command)
+    {
+        if (this->mixer_thread == nullptr)
+        {
+            return 0;
+        }
+
+        command.type = AudioCommandType::PLAY_VOICE;
+        command.voice_id = this->next_voice_id;
+        this->push_command(command);
+
+        // 0 is not a valid `VoiceId`.
+        this->next_voice_id = (this->next_voice_id == std::numeric_limits<VoiceId>::max() ? 1 : this->next_voice_id + 1);
+        return command.voice_id;
+    }
+
+    void AudioSystem::update_listener()
+    {
+        if (!this->mixer_thread->get_is_running())
+        {
+            // Nothing would drain the command queue while paused,
+            // and the listener is sent again on the first update after the pause.
+            return;
+        }
+
+        const ontology::Camera* const camera = this->universe.get_active_camera();
+
+        if (camera == nullptr)
+        {
+            return;
+        }
+
+        // The first row of the view matrix is the right vector of the `Camera`.
+        const glm::mat4& view_matrix = camera->get_view_matrix();
+
+        AudioCommand command;
+        command.type = AudioCommandType::SET_LISTENER;
+        command.position = camera->location.xyz;
+        command.right = glm::vec3(view_matrix[0][0], view_matrix[1][0], view_matrix[2][0]);
+        this->push_command(command);
+    }
+
+    void AudioSystem::push_command(const AudioCommand& command)
+    {
+        // Keep the commands in order, a new command must not overtake the pending ones.
+        if (!this->pending_commands.empty() || !this->mixer_thread->push_command(command))
+        {
+            this->pending_commands.push_back(command);
+        }
+    }
+
+    void AudioSystem::push_pending_commands()
+    {
+        std::size_t n_pushed_commands = 0;
+
+        while (n_pushed_commands < this->pending_commands.size() &&
+                this->mixer_thread->push_command(this->pending_commands[n_pushed_commands]))
+        {
+            n_pushed_commands++;
+        }
+
+        this->pending_commands.erase(this->pending_commands.begin(), this->pending_commands.begin() + n_pushed_commands);
+    }
 }
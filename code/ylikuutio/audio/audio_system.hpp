@@ -18,16 +18,22 @@
 #ifndef YLIKUUTIO_AUDIO_AUDIO_SYSTEM_HPP_INCLUDED
 #define YLIKUUTIO_AUDIO_AUDIO_SYSTEM_HPP_INCLUDED
 
+#include "audio_command.hpp"
 #include "code/ylikuutio/memory/constructible_module.hpp"
 
-#include <SDL3/SDL.h>
-#include <SDL3_mixer/SDL_mixer.h>
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
 
 // Include standard headers
 #include <cstddef>       // std::size_t
 #include <list>          // std::list
+#include <memory>        // std::unique_ptr
 #include <string>        // std::string
 #include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
 
 namespace yli::memory
 {
@@ -42,6 +48,19 @@ namespace yli::ontology
 
 namespace yli::audio
 {
+    class AudioStream;
+    class MixerThread;
+    class SdlAudioOutput;
+    struct SoundBuffer;
+
+    // `AudioSystem` plays music and positional sounds on a `MixerThread`.
+    //
+    // Music is streamed in chunks. Other sounds are decoded fully on
+    // first use and cached by filename. `update` is called every frame:
+    // it retries the commands which did not fit into the command queue,
+    // advances the playlist when a song has ended and moves the listener
+    // to the active `Camera`.
+
     class AudioSystem final
     {
         public:
@@ -56,6 +75,14 @@ namespace yli::audio
             void terminate();
 
             bool load_and_play(const std::string& audio_file);
+
+            // Returns the `VoiceId` of the sound, or 0 on failure.
+            VoiceId play_sound(const std::string& audio_file, float gain, bool loop);
+            VoiceId play_sound_at(const std::string& audio_file, const glm::vec3& position, float gain, bool loop);
+            void set_voice_position(VoiceId voice_id, const glm::vec3& position);
+            void set_voice_gain(VoiceId voice_id, float gain);
+            void stop_voice(VoiceId voice_id);
+
             void add_to_playlist(const std::string& playlist, const std::string& audio_file);
             void remove_from_playlist(const std::string& playlist, const std::string& audio_file);
             void play_playlist(const std::string& playlist);
@@ -66,21 +93,44 @@ namespace yli::audio
             void clear_playlist(const std::string& playlist);
             void erase_playlist(const std::string& playlist);
 
+            static constexpr int sample_rate                     { 48000 };
+            static constexpr std::size_t max_n_voices            { 64 };
+            static constexpr std::size_t n_block_frames          { 256 };  // About 5 ms.
+            static constexpr std::size_t n_target_latency_frames { 1024 }; // About 21 ms.
+            static constexpr std::size_t n_stream_chunk_frames   { 4096 };
+            static constexpr std::size_t n_stream_chunks         { 4 };
+
             template<typename T1, std::size_t DataSize>
                 friend class memory::MemoryStorage;
 
         private:
+            std::string get_audio_file_path(const std::string& audio_file) const;
+            const SoundBuffer* get_or_load_sound_buffer(const std::string& audio_file);
+            VoiceId play_voice(AudioCommand& command);
+            void update_listener();
+
+            // Pushes `command` to the audio thread, or keeps it pending if the command queue is full.
+            void push_command(const AudioCommand& command);
+
+            // Retries the pending commands in order. Called by `update`.
+            void push_pending_commands();
+
             memory::ConstructibleModule constructible_module;
 
             ontology::Universe& universe;
 
-            MIX_Mixer* mixer        { nullptr };
-            MIX_Track* music_track  { nullptr };
+            std::unique_ptr<SdlAudioOutput> audio_output;
+            std::unique_ptr<MixerThread> mixer_thread;
+
+            std::unordered_map<std::string, std::unique_ptr<SoundBuffer>> sound_buffer_map; // key: filename.
+            std::unordered_map<VoiceId, std::unique_ptr<AudioStream>> audio_stream_map;     // Streams of playing voices.
+            std::vector<AudioCommand> pending_commands; // Commands which did not fit into the command queue, in order.
+            VoiceId next_voice_id  { 1 };
+            VoiceId music_voice_id { 0 };
 
             std::unordered_map<std::string, std::list<std::string>> playlist_map; // key: name of playlist, value: list of filenames.
             std::string current_playlist;                                         // name of current playlist.
             std::list<std::string>::iterator current_playlist_sound_iterator;
-            Uint32 bytes_put { 0 };
             bool loop { false };
     };
 }
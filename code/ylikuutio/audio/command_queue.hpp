@@ -0,0 +1,97 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_AUDIO_COMMAND_QUEUE_HPP_INCLUDED
+#define YLIKUUTIO_AUDIO_COMMAND_QUEUE_HPP_INCLUDED
+
+// Include standard headers
+#include <array>   // std::array
+#include <atomic>  // std::atomic, std::memory_order_acquire, std::memory_order_relaxed, std::memory_order_release
+#include <cstddef> // std::size_t
+
+// `CommandQueue` is a lock-free single-producer single-consumer ring buffer.
+//
+// Exactly one thread may call `try_push` and exactly one thread may call
+// `try_pop`. Neither call blocks nor allocates, so the audio thread can
+// use the queue without risking priority inversion. One slot is kept
+// free to tell a full queue from an empty one.
+
+namespace yli::audio
+{
+    template<typename T, std::size_t Capacity>
+        class CommandQueue final
+        {
+            static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "`Capacity` must be a power of 2!");
+
+            public:
+                CommandQueue() = default;
+
+                CommandQueue(const CommandQueue&) = delete;            // Delete copy constructor.
+                CommandQueue& operator=(const CommandQueue&) = delete; // Delete copy assignment.
+
+                // Returns `false` if the queue is full.
+                bool try_push(const T& value)
+                {
+                    const std::size_t tail = this->tail_i.load(std::memory_order_relaxed);
+                    const std::size_t next_tail = (tail + 1) & (Capacity - 1);
+
+                    if (next_tail == this->head_i.load(std::memory_order_acquire))
+                    {
+                        return false;
+                    }
+
+                    this->slots[tail] = value;
+                    this->tail_i.store(next_tail, std::memory_order_release);
+                    return true;
+                }
+
+                // Returns `false` if the queue is empty.
+                bool try_pop(T& value)
+                {
+                    const std::size_t head = this->head_i.load(std::memory_order_relaxed);
+
+                    if (head == this->tail_i.load(std::memory_order_acquire))
+                    {
+                        return false;
+                    }
+
+                    value = this->slots[head];
+                    this->head_i.store((head + 1) & (Capacity - 1), std::memory_order_release);
+                    return true;
+                }
+
+                bool empty() const
+                {
+                    return this->head_i.load(std::memory_order_acquire) == this->tail_i.load(std::memory_order_acquire);
+                }
+
+                static constexpr std::size_t get_capacity()
+                {
+                    return Capacity - 1;
+                }
+
+            private:
+                std::array<T, Capacity> slots {};
+
+                // The indices are on separate cache lines so that the producer
+                // and the consumer do not invalidate each other's cache line.
+                alignas(64) std::atomic<std::size_t> head_i { 0 }; // Written by the consumer.
+                alignas(64) std::atomic<std::size_t> tail_i { 0 }; // Written by the producer.
+        };
+}
+
+#endif
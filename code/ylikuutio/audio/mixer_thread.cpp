@@ -0,0 +1,129 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "mixer_thread.hpp"
+#include "audio_command.hpp"
+#include "audio_output.hpp"
+#include "software_mixer.hpp"
+
+// Include standard headers
+#include <algorithm> // std::max
+#include <chrono>    // std::chrono::milliseconds
+#include <cstddef>   // std::size_t
+#include <span>      // std::span
+#include <thread>    // std::this_thread::sleep_for, std::thread
+
+namespace yli::audio
+{
+    MixerThread::MixerThread(
+            AudioOutput& audio_output,
+            const std::size_t max_n_voices,
+            const std::size_t n_block_frames,
+            const std::size_t n_target_latency_frames)
+        : audio_output { audio_output },
+          software_mixer(max_n_voices, n_block_frames),
+          block_samples(2 * std::max<std::size_t>(n_block_frames, 1)),
+          n_block_frames { std::max<std::size_t>(n_block_frames, 1) },
+          n_target_latency_frames { n_target_latency_frames }
+    {
+    }
+
+    MixerThread::~MixerThread()
+    {
+        this->stop();
+    }
+
+    void MixerThread::start()
+    {
+        if (this->is_running.exchange(true))
+        {
+            return;
+        }
+
+        this->thread = std::thread(&MixerThread::run, this);
+    }
+
+    void MixerThread::stop()
+    {
+        this->is_running.store(false);
+
+        if (this->thread.joinable())
+        {
+            this->thread.join();
+        }
+    }
+
+    bool MixerThread::get_is_running() const
+    {
+        return this->is_running.load();
+    }
+
+    bool MixerThread::push_command(const AudioCommand& command)
+    {
+        return this->command_queue.try_push(command);
+    }
+
+    bool MixerThread::pop_event(AudioEvent& event)
+    {
+        return this->event_queue.try_pop(event);
+    }
+
+    std::size_t MixerThread::run_once()
+    {
+        this->software_mixer.push_pending_events(this->event_queue);
+
+        AudioCommand command;
+
+        while (this->command_queue.try_pop(command))
+        {
+            this->software_mixer.apply(command, this->event_queue);
+        }
+
+        std::size_t n_frames_mixed = 0;
+
+        while (this->audio_output.get_n_queued_frames() < this->n_target_latency_frames)
+        {
+            this->software_mixer.mix(std::span<float>(this->block_samples), this->event_queue);
+
+            if (!this->audio_output.put(std::span<const float>(this->block_samples)))
+            {
+                break;
+            }
+
+            n_frames_mixed += this->n_block_frames;
+        }
+
+        this->software_mixer.refill_streams();
+        return n_frames_mixed;
+    }
+
+    const SoftwareMixer& MixerThread::get_software_mixer() const
+    {
+        return this->software_mixer;
+    }
+
+    void MixerThread::run()
+    {
+        // A block is several milliseconds of audio, so polling every
+        // millisecond keeps the output queue near its target.
+        while (this->is_running.load())
+        {
+            this->run_once();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
@@ -0,0 +1,94 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_AUDIO_MIXER_THREAD_HPP_INCLUDED
+#define YLIKUUTIO_AUDIO_MIXER_THREAD_HPP_INCLUDED
+
+#include "audio_command.hpp"
+#include "software_mixer.hpp"
+
+// Include standard headers
+#include <atomic>  // std::atomic
+#include <cstddef> // std::size_t
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+namespace yli::audio
+{
+    class AudioOutput;
+
+    // `MixerThread` runs a `SoftwareMixer` on a dedicated audio thread,
+    // independent of the frame rate of the main loop.
+    //
+    // The main thread controls the mixer only through a lock-free command
+    // queue and learns about finished voices through a lock-free event
+    // queue. The audio thread keeps `n_target_latency_frames` frames queued
+    // in the `AudioOutput`, mixing `n_block_frames` frames at a time, and
+    // decodes streamed voices after mixing.
+    //
+    // Only the queues and the mixing are free of locks and allocations.
+    // The decoding runs on the audio thread too, and the `AudioDecoder`
+    // may lock or allocate, so a slow decode can delay the next block.
+    // The queued latency of `n_target_latency_frames` absorbs that.
+
+    class MixerThread final
+    {
+        public:
+            MixerThread(
+                    AudioOutput& audio_output,
+                    std::size_t max_n_voices,
+                    std::size_t n_block_frames,
+                    std::size_t n_target_latency_frames);
+
+            MixerThread(const MixerThread&) = delete;            // Delete copy constructor.
+            MixerThread& operator=(const MixerThread&) = delete; // Delete copy assignment.
+
+            ~MixerThread();
+
+            void start();
+            void stop();
+            bool get_is_running() const;
+
+            // Called by the main thread. Returns `false` if the queue is full.
+            bool push_command(const AudioCommand& command);
+            bool pop_event(AudioEvent& event);
+
+            // Runs one iteration of the audio thread: applies the pending commands,
+            // mixes until the target latency is reached and refills the streams.
+            // Returns the number of frames mixed. Must not be called while the
+            // audio thread is running.
+            std::size_t run_once();
+
+            const SoftwareMixer& get_software_mixer() const;
+
+        private:
+            void run();
+
+            AudioOutput& audio_output;
+            SoftwareMixer software_mixer;
+            AudioCommandQueue command_queue;
+            AudioEventQueue event_queue;
+            std::vector<float> block_samples;
+            const std::size_t n_block_frames;
+            const std::size_t n_target_latency_frames;
+
+            std::thread thread;
+            std::atomic<bool> is_running { false };
+    };
+}
+
+#endif
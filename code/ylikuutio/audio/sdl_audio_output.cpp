@@ -0,0 +1,83 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "sdl_audio_output.hpp"
+#include "code/ylikuutio/sdl/ylikuutio_sdl.hpp"
+
+#include <SDL3/SDL.h>
+
+// Include standard headers
+#include <cstddef>  // std::size_t
+#include <iostream> // std::cerr
+#include <span>     // std::span
+
+namespace yli::audio
+{
+    SdlAudioOutput::SdlAudioOutput(const int sample_rate)
+    {
+        SDL_AudioSpec spec {};
+        spec.format = SDL_AUDIO_F32;
+        spec.channels = 2;
+        spec.freq = sample_rate;
+
+        this->audio_stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, nullptr, nullptr);
+
+        if (this->audio_stream == nullptr)
+        {
+            std::cerr << "ERROR: `SdlAudioOutput::SdlAudioOutput`: opening playback device failed!\n";
+            yli::sdl::print_sdl_error();
+            return;
+        }
+
+        // The device of a new audio stream starts paused.
+        SDL_ResumeAudioStreamDevice(this->audio_stream);
+    }
+
+    SdlAudioOutput::~SdlAudioOutput()
+    {
+        if (this->audio_stream != nullptr)
+        {
+            SDL_DestroyAudioStream(this->audio_stream);
+        }
+    }
+
+    bool SdlAudioOutput::get_is_valid() const
+    {
+        return this->audio_stream != nullptr;
+    }
+
+    std::size_t SdlAudioOutput::get_n_queued_frames() const
+    {
+        if (this->audio_stream == nullptr) [[unlikely]]
+        {
+            return 0;
+        }
+
+        const int n_bytes = SDL_GetAudioStreamQueued(this->audio_stream);
+        return (n_bytes > 0 ? static_cast<std::size_t>(n_bytes) / (2 * sizeof(float)) : 0);
+    }
+
+    bool SdlAudioOutput::put(std::span<const float> samples)
+    {
+        if (this->audio_stream == nullptr) [[unlikely]]
+        {
+            return false;
+        }
+
+        return SDL_PutAudioStreamData(this->audio_stream, samples.data(), static_cast<int>(samples.size_bytes()));
+    }
+}
@@ -0,0 +1,52 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_AUDIO_SDL_AUDIO_OUTPUT_HPP_INCLUDED
+#define YLIKUUTIO_AUDIO_SDL_AUDIO_OUTPUT_HPP_INCLUDED
+
+#include "audio_output.hpp"
+
+#include <SDL3/SDL.h>
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <span>    // std::span
+
+namespace yli::audio
+{
+    // Plays the samples on the default playback device through an `SDL_AudioStream`.
+    // With `SDL_AUDIO_DRIVER=dummy` or `SDL_AUDIO_DRIVER=disk` no audio hardware is needed.
+    class SdlAudioOutput final : public AudioOutput
+    {
+        public:
+            explicit SdlAudioOutput(int sample_rate);
+
+            ~SdlAudioOutput() override;
+
+            // Returns `false` if opening the playback device failed.
+            bool get_is_valid() const;
+
+            std::size_t get_n_queued_frames() const override;
+
+            bool put(std::span<const float> samples) override;
+
+        private:
+            SDL_AudioStream* audio_stream { nullptr };
+    };
+}
+
+#endif
@@ -0,0 +1,80 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "sdl_mixer_decoder.hpp"
+#include "code/ylikuutio/sdl/ylikuutio_sdl.hpp"
+
+#include <SDL3/SDL.h>
+#include <SDL3_mixer/SDL_mixer.h>
+
+// Include standard headers
+#include <cstddef>  // std::size_t
+#include <iostream> // std::cerr
+#include <span>     // std::span
+#include <string>   // std::string
+
+namespace yli::audio
+{
+    SdlMixerDecoder::SdlMixerDecoder(const std::string& audio_file_path, const int sample_rate)
+        : decoder { MIX_CreateAudioDecoder(audio_file_path.c_str(), 0) }
+    {
+        this->spec.format = SDL_AUDIO_F32;
+        this->spec.channels = 2;
+        this->spec.freq = sample_rate;
+
+        if (this->decoder == nullptr)
+        {
+            std::cerr << "ERROR: `SdlMixerDecoder::SdlMixerDecoder`: opening audio file " << audio_file_path << " failed!\n";
+            yli::sdl::print_sdl_error();
+        }
+    }
+
+    SdlMixerDecoder::~SdlMixerDecoder()
+    {
+        if (this->decoder != nullptr)
+        {
+            MIX_DestroyAudioDecoder(this->decoder);
+        }
+    }
+
+    bool SdlMixerDecoder::get_is_valid() const
+    {
+        return this->decoder != nullptr;
+    }
+
+    std::size_t SdlMixerDecoder::decode(std::span<float> samples)
+    {
+        if (this->decoder == nullptr) [[unlikely]]
+        {
+            return 0;
+        }
+
+        const int n_bytes = MIX_DecodeAudio(
+                this->decoder,
+                samples.data(),
+                static_cast<int>(samples.size_bytes()),
+                &this->spec);
+
+        if (n_bytes <= 0)
+        {
+            // End of audio or a decoding error.
+            return 0;
+        }
+
+        return static_cast<std::size_t>(n_bytes) / (2 * sizeof(float));
+    }
+}
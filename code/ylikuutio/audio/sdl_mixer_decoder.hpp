@@ -0,0 +1,53 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_AUDIO_SDL_MIXER_DECODER_HPP_INCLUDED
+#define YLIKUUTIO_AUDIO_SDL_MIXER_DECODER_HPP_INCLUDED
+
+#include "audio_decoder.hpp"
+
+#include <SDL3/SDL.h>
+#include <SDL3_mixer/SDL_mixer.h>
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <span>    // std::span
+#include <string>  // std::string
+
+namespace yli::audio
+{
+    // Decodes any format supported by SDL_mixer, converting
+    // to stereo `float` at `sample_rate` while decoding.
+    class SdlMixerDecoder final : public AudioDecoder
+    {
+        public:
+            SdlMixerDecoder(const std::string& audio_file_path, int sample_rate);
+
+            ~SdlMixerDecoder() override;
+
+            // Returns `false` if the audio file could not be opened.
+            bool get_is_valid() const;
+
+            std::size_t decode(std::span<float> samples) override;
+
+        private:
+            MIX_AudioDecoder* decoder { nullptr };
+            SDL_AudioSpec spec {};
+    };
+}
+
+#endif
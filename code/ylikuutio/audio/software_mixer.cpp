@@ -0,0 +1,305 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "software_mixer.hpp"
+#include "audio_command.hpp"
+#include "audio_stream.hpp"
+#include "sound_buffer.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::clamp, std::copy_n, std::fill, std::max, std::min
+#include <cmath>     // std::cos, std::sin
+#include <cstddef>   // std::size_t
+#include <numbers>   // std::numbers::pi_v
+#include <span>      // std::span
+
+namespace yli::audio
+{
+    SoftwareMixer::SoftwareMixer(const std::size_t max_n_voices, const std::size_t n_block_frames)
+        : voices(max_n_voices),
+          source_samples(2 * std::max<std::size_t>(n_block_frames, 1)),
+          n_block_frames { std::max<std::size_t>(n_block_frames, 1) }
+    {
+        this->pending_finished_voice_ids.reserve(max_n_voices + audio_queue_size);
+    }
+
+    void SoftwareMixer::apply(const AudioCommand& command, AudioEventQueue& event_queue)
+    {
+        switch (command.type)
+        {
+            case AudioCommandType::PLAY_VOICE:
+                {
+                    Voice* const voice = this->find_voice(0);
+
+                    if (voice == nullptr || (command.sound_buffer == nullptr && command.audio_stream == nullptr))
+                    {
+                        // All voices are in use, so the sound is dropped.
+                        this->report_finished_voice(command.voice_id, event_queue);
+                        return;
+                    }
+
+                    *voice = Voice();
+                    voice->voice_id = command.voice_id;
+                    voice->sound_buffer = command.sound_buffer;
+                    voice->audio_stream = command.audio_stream;
+                    voice->position = command.position;
+                    voice->gain = command.gain;
+                    voice->is_positional = command.is_positional;
+                    voice->loop = command.loop;
+                    this->n_playing_voices++;
+                    return;
+                }
+            case AudioCommandType::STOP_VOICE:
+                if (Voice* const voice = this->find_voice(command.voice_id); voice != nullptr && command.voice_id != 0)
+                {
+                    this->report_finished_voice(voice->voice_id, event_queue);
+                    *voice = Voice();
+                    this->n_playing_voices--;
+                }
+                return;
+            case AudioCommandType::STOP_ALL_VOICES:
+                for (Voice& voice : this->voices)
+                {
+                    if (voice.voice_id != 0)
+                    {
+                        this->report_finished_voice(voice.voice_id, event_queue);
+                        voice = Voice();
+                    }
+                }
+
+                this->n_playing_voices = 0;
+                return;
+            case AudioCommandType::SET_VOICE_POSITION:
+                if (Voice* const voice = this->find_voice(command.voice_id); voice != nullptr && command.voice_id != 0)
+                {
+                    voice->position = command.position;
+                }
+                return;
+            case AudioCommandType::SET_VOICE_GAIN:
+                if (Voice* const voice = this->find_voice(command.voice_id); voice != nullptr && command.voice_id != 0)
+                {
+                    voice->gain = command.gain;
+                }
+                return;
+            case AudioCommandType::SET_LISTENER:
+                this->listener_position = command.position;
+
+                if (const float right_length = glm::length(command.right); right_length > 0.0f)
+                {
+                    this->listener_right = command.right / right_length;
+                }
+                return;
+        }
+    }
+
+    void SoftwareMixer::mix(std::span<float> samples, AudioEventQueue& event_queue)
+    {
+        std::fill(samples.begin(), samples.end(), 0.0f);
+
+        for (std::size_t frame_i = 0; frame_i < samples.size() / 2; frame_i += this->n_block_frames)
+        {
+            const std::size_t n_frames = std::min(this->n_block_frames, samples.size() / 2 - frame_i);
+            this->mix_block(samples.subspan(2 * frame_i, 2 * n_frames), event_queue);
+        }
+
+        for (float& sample : samples)
+        {
+            sample = std::clamp(sample, -1.0f, 1.0f);
+        }
+    }
+
+    void SoftwareMixer::push_pending_events(AudioEventQueue& event_queue)
+    {
+        std::size_t n_pushed = 0;
+
+        while (n_pushed < this->pending_finished_voice_ids.size() &&
+                event_queue.try_push(AudioEvent { AudioEventType::VOICE_FINISHED, this->pending_finished_voice_ids[n_pushed] }))
+        {
+            n_pushed++;
+        }
+
+        this->pending_finished_voice_ids.erase(
+                this->pending_finished_voice_ids.begin(),
+                this->pending_finished_voice_ids.begin() + n_pushed);
+    }
+
+    std::size_t SoftwareMixer::get_n_pending_events() const
+    {
+        return this->pending_finished_voice_ids.size();
+    }
+
+    void SoftwareMixer::refill_streams()
+    {
+        for (const Voice& voice : this->voices)
+        {
+            if (voice.audio_stream != nullptr)
+            {
+                voice.audio_stream->refill();
+            }
+        }
+    }
+
+    std::size_t SoftwareMixer::get_n_playing_voices() const
+    {
+        return this->n_playing_voices;
+    }
+
+    std::size_t SoftwareMixer::get_max_n_voices() const
+    {
+        return this->voices.size();
+    }
+
+    float SoftwareMixer::compute_distance_gain(const float distance) const
+    {
+        const float clamped_distance = std::clamp(distance, this->reference_distance, std::max(this->reference_distance, this->max_distance));
+        return this->reference_distance /
+            (this->reference_distance + this->rolloff_factor * (clamped_distance - this->reference_distance));
+    }
+
+    glm::vec2 SoftwareMixer::compute_pan_gains(const float pan)
+    {
+        const float angle = (std::clamp(pan, -1.0f, 1.0f) + 1.0f) * 0.25f * std::numbers::pi_v<float>;
+        return glm::vec2(std::cos(angle), std::sin(angle));
+    }
+
+    void SoftwareMixer::report_finished_voice(const VoiceId voice_id, AudioEventQueue& event_queue)
+    {
+        // Keep the events in order, a new event must not overtake the pending ones.
+        if (!this->pending_finished_voice_ids.empty() ||
+                !event_queue.try_push(AudioEvent { AudioEventType::VOICE_FINISHED, voice_id }))
+        {
+            this->pending_finished_voice_ids.push_back(voice_id);
+        }
+    }
+
+    SoftwareMixer::Voice* SoftwareMixer::find_voice(const VoiceId voice_id)
+    {
+        for (Voice& voice : this->voices)
+        {
+            if (voice.voice_id == voice_id)
+            {
+                return &voice;
+            }
+        }
+
+        return nullptr;
+    }
+
+    glm::vec2 SoftwareMixer::compute_target_gains(const Voice& voice) const
+    {
+        if (!voice.is_positional)
+        {
+            return glm::vec2(voice.gain, voice.gain);
+        }
+
+        const glm::vec3 to_voice = voice.position - this->listener_position;
+        const float distance = glm::length(to_voice);
+        const float pan = (distance > 0.0f ? glm::dot(to_voice / distance, this->listener_right) : 0.0f);
+        return voice.gain * this->compute_distance_gain(distance) * compute_pan_gains(pan);
+    }
+
+    std::size_t SoftwareMixer::read_voice(Voice& voice, const std::size_t n_frames)
+    {
+        if (voice.audio_stream != nullptr)
+        {
+            return voice.audio_stream->read(std::span<float>(this->source_samples.data(), 2 * n_frames));
+        }
+
+        const std::size_t n_buffer_frames = voice.sound_buffer->get_n_frames();
+        std::size_t n_frames_read = 0;
+
+        while (n_frames_read < n_frames && n_buffer_frames > 0)
+        {
+            if (voice.frame_i >= n_buffer_frames)
+            {
+                if (!voice.loop)
+                {
+                    break;
+                }
+
+                voice.frame_i = 0;
+            }
+
+            const std::size_t n_contiguous_frames = std::min(n_frames - n_frames_read, n_buffer_frames - voice.frame_i);
+            std::copy_n(
+                    voice.sound_buffer->samples.data() + 2 * voice.frame_i,
+                    2 * n_contiguous_frames,
+                    this->source_samples.data() + 2 * n_frames_read);
+            voice.frame_i += n_contiguous_frames;
+            n_frames_read += n_contiguous_frames;
+        }
+
+        return n_frames_read;
+    }
+
+    void SoftwareMixer::mix_block(std::span<float> samples, AudioEventQueue& event_queue)
+    {
+        const std::size_t n_frames = samples.size() / 2;
+
+        for (Voice& voice : this->voices)
+        {
+            if (voice.voice_id == 0)
+            {
+                continue;
+            }
+
+            const std::size_t n_frames_read = this->read_voice(voice, n_frames);
+            const glm::vec2 target_gains = this->compute_target_gains(voice);
+            const glm::vec2 start_gains = (voice.has_gains ? voice.current_gains : target_gains);
+            const glm::vec2 gain_step = (target_gains - start_gains) / static_cast<float>(n_frames);
+
+            for (std::size_t frame_i = 0; frame_i < n_frames_read; frame_i++)
+            {
+                const glm::vec2 gains = start_gains + gain_step * static_cast<float>(frame_i + 1);
+                const float left = this->source_samples[2 * frame_i];
+                const float right = this->source_samples[2 * frame_i + 1];
+
+                if (voice.is_positional)
+                {
+                    const float mono = 0.5f * (left + right);
+                    samples[2 * frame_i] += mono * gains.x;
+                    samples[2 * frame_i + 1] += mono * gains.y;
+                }
+                else
+                {
+                    samples[2 * frame_i] += left * gains.x;
+                    samples[2 * frame_i + 1] += right * gains.y;
+                }
+            }
+
+            voice.current_gains = target_gains;
+            voice.has_gains = true;
+
+            const bool is_finished = (voice.audio_stream != nullptr ?
+                    voice.audio_stream->get_is_finished() :
+                    n_frames_read < n_frames);
+
+            if (is_finished)
+            {
+                this->report_finished_voice(voice.voice_id, event_queue);
+                voice = Voice();
+                this->n_playing_voices--;
+            }
+        }
+    }
+}
@@ -0,0 +1,130 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_AUDIO_SOFTWARE_MIXER_HPP_INCLUDED
+#define YLIKUUTIO_AUDIO_SOFTWARE_MIXER_HPP_INCLUDED
+
+#include "audio_command.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <span>    // std::span
+#include <vector>  // std::vector
+
+namespace yli::audio
+{
+    class AudioStream;
+    struct SoundBuffer;
+
+    // `SoftwareMixer` mixes up to `max_n_voices` voices into interleaved
+    // stereo `float` samples. It is used only by the audio thread, and
+    // does not allocate after construction unless more `VOICE_FINISHED`
+    // events are waiting for room in the event queue than were reserved.
+    //
+    // A positional voice is downmixed to mono, attenuated by its distance
+    // to the listener and panned with constant power by its direction
+    // relative to the right vector of the listener. Gain changes are
+    // ramped over one block to avoid clicks.
+    //
+    // Distance attenuation is clamped inverse distance:
+    // `reference_distance / (reference_distance + rolloff_factor * (d - reference_distance))`,
+    // where `d` is clamped to `[reference_distance, max_distance]`.
+
+    class SoftwareMixer final
+    {
+        public:
+            SoftwareMixer(std::size_t max_n_voices, std::size_t n_block_frames);
+
+            SoftwareMixer(const SoftwareMixer&) = delete;            // Delete copy constructor.
+            SoftwareMixer& operator=(const SoftwareMixer&) = delete; // Delete copy assignment.
+
+            // A `PLAY_VOICE` command which finds no free voice is
+            // reported as finished at once.
+            void apply(const AudioCommand& command, AudioEventQueue& event_queue);
+
+            // Overwrites `samples` with the mix of all playing voices.
+            void mix(std::span<float> samples, AudioEventQueue& event_queue);
+
+            // Retries the `VOICE_FINISHED` events which did not fit into `event_queue`.
+            // The main thread frees the stream of a voice only after its event,
+            // so an event is never dropped.
+            void push_pending_events(AudioEventQueue& event_queue);
+
+            std::size_t get_n_pending_events() const;
+
+            // Decodes more of each streamed voice. Called outside of `mix`
+            // so that decoding does not delay the output.
+            void refill_streams();
+
+            std::size_t get_n_playing_voices() const;
+            std::size_t get_max_n_voices() const;
+
+            float compute_distance_gain(float distance) const;
+
+            // `pan` is -1 for left, 0 for center and 1 for right.
+            static glm::vec2 compute_pan_gains(float pan);
+
+            float reference_distance { 1.0f };
+            float rolloff_factor     { 1.0f };
+            float max_distance       { 1000.0f };
+
+        private:
+            struct Voice
+            {
+                VoiceId voice_id { 0 };
+                const SoundBuffer* sound_buffer { nullptr };
+                AudioStream* audio_stream { nullptr };
+                std::size_t frame_i { 0 };
+                glm::vec3 position { 0.0f, 0.0f, 0.0f };
+                glm::vec2 current_gains { 0.0f, 0.0f }; // Left and right.
+                float gain { 1.0f };
+                bool is_positional { false };
+                bool loop { false };
+                bool has_gains { false };
+            };
+
+            // Pushes a `VOICE_FINISHED` event, or keeps it pending if `event_queue` is full.
+            void report_finished_voice(VoiceId voice_id, AudioEventQueue& event_queue);
+
+            Voice* find_voice(VoiceId voice_id);
+
+            glm::vec2 compute_target_gains(const Voice& voice) const;
+
+            // Reads at most `n_frames` frames of `voice` into `source_samples`.
+            // Returns the number of frames read.
+            std::size_t read_voice(Voice& voice, std::size_t n_frames);
+
+            void mix_block(std::span<float> samples, AudioEventQueue& event_queue);
+
+            std::vector<Voice> voices;
+            std::vector<float> source_samples;
+            std::vector<VoiceId> pending_finished_voice_ids; // Reserved so that it normally does not allocate.
+            const std::size_t n_block_frames;
+            std::size_t n_playing_voices { 0 };
+
+            glm::vec3 listener_position { 0.0f, 0.0f, 0.0f };
+            glm::vec3 listener_right { 1.0f, 0.0f, 0.0f };
+    };
+}
+
+#endif
@@ -0,0 +1,40 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_AUDIO_SOUND_BUFFER_HPP_INCLUDED
+#define YLIKUUTIO_AUDIO_SOUND_BUFFER_HPP_INCLUDED
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+namespace yli::audio
+{
+    // A fully decoded sound, for short cues which are played often.
+    // Samples are interleaved stereo `float`s at the sample rate of the mixer.
+    struct SoundBuffer
+    {
+        std::size_t get_n_frames() const
+        {
+            return this->samples.size() / 2;
+        }
+
+        std::vector<float> samples;
+    };
+}
+
+#endif
@@ -0,0 +1,428 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "completion_engine.hpp"
+
+// Include standard headers
+#include <algorithm>   // std::min, std::partial_sort_copy, std::sort, std::unique
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int32_t, std::uint32_t, std::uint64_t
+#include <limits>      // std::numeric_limits
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+namespace yli::console
+{
+    static constexpr std::int32_t consecutive_bonus = 8;
+    static constexpr std::int32_t name_part_start_bonus = 6;
+    static constexpr std::int32_t no_match = -(1 << 30);
+
+    // One bit per letter, digit and `_`, and one bit for all other characters.
+    static std::uint64_t get_character_mask(const std::string_view string)
+    {
+        std::uint64_t mask = 0;
+
+        for (const char character : string)
+        {
+            std::uint32_t bit_i = 63;
+
+            if (character >= 'a' && character <= 'z')
+            {
+                bit_i = character - 'a';
+            }
+            else if (character >= 'A' && character <= 'Z')
+            {
+                bit_i = 26 + (character - 'A');
+            }
+            else if (character >= '0' && character <= '9')
+            {
+                bit_i = 52 + (character - '0');
+            }
+            else if (character == '_')
+            {
+                bit_i = 62;
+            }
+
+            mask |= std::uint64_t { 1 } << bit_i;
+        }
+
+        return mask;
+    }
+
+    static std::int32_t get_name_part_start_bonus(const std::string_view candidate, const std::size_t match_i)
+    {
+        if (match_i == 0 || candidate[match_i - 1] == '.' || candidate[match_i - 1] == '_')
+        {
+            return name_part_start_bonus;
+        }
+
+        return 0;
+    }
+
+    // Matches `input` as a subsequence of candidates, in sorted order.
+    //
+    // The first match found forwards fixes the end of the match, and the
+    // shortest match ending there is scored backwards from there. The forward pass resumes from the prefix shared with the previous
+    // candidate, so sibling names under the same parent are not rescanned.
+    class FuzzyMatcher
+    {
+    public:
+        explicit FuzzyMatcher(const std::string_view input)
+            : input { input }
+        {
+        }
+
+        std::int32_t get_score(const std::string_view candidate, const std::size_t shared_prefix_length)
+        {
+            if (this->score != no_match && this->end_i < shared_prefix_length)
+            {
+                // The match is within the shared prefix.
+                return this->score;
+            }
+
+            // `progress[i]` is the number of input characters matched in `candidate[0, i)`.
+            std::size_t candidate_i = std::min(shared_prefix_length, this->progress_end_i);
+            std::size_t input_i = this->progress[candidate_i];
+
+            if (this->progress.size() <= candidate.size())
+            {
+                this->progress.resize(candidate.size() + 1);
+            }
+
+            while (input_i < this->input.size() && candidate_i < candidate.size())
+            {
+                input_i += (candidate[candidate_i++] == this->input[input_i] ? 1 : 0);
+                this->progress[candidate_i] = input_i;
+            }
+
+            this->progress_end_i = candidate_i;
+
+            if (input_i < this->input.size())
+            {
+                this->score = no_match;
+                return this->score;
+            }
+
+            this->end_i = candidate_i - 1;
+
+            // Skipped characters between matched characters score lower.
+            std::size_t next_match_i = this->end_i;
+            this->score = get_name_part_start_bonus(candidate, next_match_i);
+
+            for (std::size_t match_i = next_match_i; input_i > 1; )
+            {
+                if (candidate[--match_i] == this->input[input_i - 2])
+                {
+                    this->score += (match_i + 1 == next_match_i ?
+                            consecutive_bonus :
+                            -static_cast<std::int32_t>(next_match_i - match_i - 1));
+                    this->score += get_name_part_start_bonus(candidate, match_i);
+                    next_match_i = match_i;
+                    input_i--;
+                }
+            }
+
+            return this->score;
+        }
+
+    private:
+        const std::string_view input;
+        std::vector<std::size_t> progress { 0 };
+        std::size_t progress_end_i { 0 };
+        std::size_t end_i { 0 };
+        std::int32_t score { no_match };
+    };
+
+    void CompletionEngine::set_candidates(std::vector<std::string>&& candidates)
+    {
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        this->candidate_characters.clear();
+        this->candidate_offsets.clear();
+        this->candidate_masks.clear();
+        this->candidate_shared_prefix_lengths.clear();
+        this->candidate_offsets.reserve(candidates.size() + 1);
+        this->candidate_masks.reserve(candidates.size());
+        this->candidate_shared_prefix_lengths.reserve(candidates.size());
+
+        for (std::size_t candidate_i = 0; candidate_i < candidates.size(); candidate_i++)
+        {
+            const std::string& candidate = candidates[candidate_i];
+            std::size_t shared_prefix_length = 0;
+
+            if (candidate_i > 0)
+            {
+                const std::string& previous_candidate = candidates[candidate_i - 1];
+
+                while (shared_prefix_length < previous_candidate.size() &&
+                       previous_candidate[shared_prefix_length] == candidate[shared_prefix_length])
+                {
+                    shared_prefix_length++;
+                }
+            }
+
+            this->candidate_offsets.emplace_back(static_cast<std::uint32_t>(this->candidate_characters.size()));
+            this->candidate_masks.emplace_back(get_character_mask(candidate));
+            this->candidate_shared_prefix_lengths.emplace_back(static_cast<std::uint32_t>(shared_prefix_length));
+            this->candidate_characters += candidate;
+        }
+
+        this->candidate_offsets.emplace_back(static_cast<std::uint32_t>(this->candidate_characters.size()));
+
+        this->prefix_first_i = 0;
+        this->prefix_end_i = 0;
+        this->fuzzy_matches.clear();
+        this->ranked_fuzzy_matches.clear();
+        this->are_matches_valid = false;
+    }
+
+    std::string_view CompletionEngine::get_candidate(const std::size_t candidate_i) const
+    {
+        const std::uint32_t offset = this->candidate_offsets[candidate_i];
+        return std::string_view(this->candidate_characters).substr(offset, this->candidate_offsets[candidate_i + 1] - offset);
+    }
+
+    void CompletionEngine::add_fuzzy_matches(const std::string_view input, const std::size_t first_i, const std::size_t end_i)
+    {
+        const std::uint64_t input_mask = get_character_mask(input);
+        FuzzyMatcher fuzzy_matcher(input);
+        std::size_t shared_prefix_length = 0; // With the previously scored candidate.
+
+        for (std::size_t candidate_i = first_i; candidate_i < end_i; candidate_i++)
+        {
+            if (candidate_i > first_i)
+            {
+                shared_prefix_length = std::min<std::size_t>(shared_prefix_length, this->candidate_shared_prefix_lengths[candidate_i]);
+            }
+
+            if ((input_mask & ~this->candidate_masks[candidate_i]) != 0)
+            {
+                continue;
+            }
+
+            const std::int32_t score = fuzzy_matcher.get_score(this->get_candidate(candidate_i), shared_prefix_length);
+            shared_prefix_length = std::numeric_limits<std::size_t>::max();
+
+            if (score != no_match)
+            {
+                this->fuzzy_matches.emplace_back(Match { static_cast<std::uint32_t>(candidate_i), score });
+            }
+        }
+    }
+
+    std::size_t CompletionEngine::update(const std::string_view input)
+    {
+        if (this->are_matches_valid && input == this->input)
+        {
+            return this->size();
+        }
+
+        const bool is_narrowing = this->are_matches_valid && input.starts_with(this->input);
+        const std::size_t old_prefix_first_i = this->prefix_first_i;
+        const std::size_t old_prefix_end_i = this->prefix_end_i;
+
+        // Binary search for the first candidate not less than `input`, then for the end of the prefix matches.
+        std::size_t low_i = (is_narrowing ? old_prefix_first_i : 0);
+        std::size_t high_i = (is_narrowing ? old_prefix_end_i : this->get_number_of_candidates());
+
+        while (low_i < high_i)
+        {
+            const std::size_t middle_i = low_i + (high_i - low_i) / 2;
+
+            if (this->get_candidate(middle_i) < input)
+            {
+                low_i = middle_i + 1;
+            }
+            else
+            {
+                high_i = middle_i;
+            }
+        }
+
+        this->prefix_first_i = low_i;
+        high_i = (is_narrowing ? old_prefix_end_i : this->get_number_of_candidates());
+
+        while (low_i < high_i)
+        {
+            const std::size_t middle_i = low_i + (high_i - low_i) / 2;
+
+            if (this->get_candidate(middle_i).starts_with(input))
+            {
+                low_i = middle_i + 1;
+            }
+            else
+            {
+                high_i = middle_i;
+            }
+        }
+
+        this->prefix_end_i = low_i;
+        this->ranked_fuzzy_matches.clear();
+
+        if (is_narrowing)
+        {
+            // Every match of the new input is also a match of the previous input.
+            const std::uint64_t input_mask = get_character_mask(input);
+            FuzzyMatcher fuzzy_matcher(input);
+            std::size_t previous_candidate_i = std::numeric_limits<std::size_t>::max();
+            std::size_t n_fuzzy_matches = 0;
+            std::size_t n_fuzzy_matches_before_old_prefix_matches = 0;
+
+            for (const Match& match : this->fuzzy_matches)
+            {
+                if ((input_mask & ~this->candidate_masks[match.candidate_i]) != 0)
+                {
+                    continue;
+                }
+
+                std::size_t shared_prefix_length = 0;
+
+                if (previous_candidate_i < match.candidate_i)
+                {
+                    shared_prefix_length = std::numeric_limits<std::size_t>::max();
+
+                    for (std::size_t candidate_i = previous_candidate_i + 1; candidate_i <= match.candidate_i; candidate_i++)
+                    {
+                        shared_prefix_length = std::min<std::size_t>(shared_prefix_length, this->candidate_shared_prefix_lengths[candidate_i]);
+                    }
+                }
+
+                const std::int32_t score = fuzzy_matcher.get_score(this->get_candidate(match.candidate_i), shared_prefix_length);
+                previous_candidate_i = match.candidate_i;
+
+                if (score != no_match)
+                {
+                    n_fuzzy_matches_before_old_prefix_matches += (match.candidate_i < old_prefix_first_i ? 1 : 0);
+                    this->fuzzy_matches[n_fuzzy_matches++] = Match { match.candidate_i, score };
+                }
+            }
+
+            this->fuzzy_matches.resize(n_fuzzy_matches);
+
+            // Previous prefix matches that are not prefix matches any more.
+            // They are inserted in place, so that the fuzzy matches stay in candidate order.
+            std::vector<Match> old_fuzzy_matches_after_old_prefix_matches(
+                    this->fuzzy_matches.begin() + n_fuzzy_matches_before_old_prefix_matches,
+                    this->fuzzy_matches.end());
+            this->fuzzy_matches.resize(n_fuzzy_matches_before_old_prefix_matches);
+            this->add_fuzzy_matches(input, old_prefix_first_i, this->prefix_first_i);
+            this->add_fuzzy_matches(input, this->prefix_end_i, old_prefix_end_i);
+            this->fuzzy_matches.insert(
+                    this->fuzzy_matches.end(),
+                    old_fuzzy_matches_after_old_prefix_matches.begin(),
+                    old_fuzzy_matches_after_old_prefix_matches.end());
+        }
+        else
+        {
+            this->fuzzy_matches.clear();
+
+            if (!input.empty())
+            {
+                this->add_fuzzy_matches(input, 0, this->prefix_first_i);
+                this->add_fuzzy_matches(input, this->prefix_end_i, this->get_number_of_candidates());
+            }
+        }
+
+        this->input = input;
+        this->are_matches_valid = true;
+        return this->size();
+    }
+
+    std::vector<std::string_view> CompletionEngine::get_page(const std::size_t page_i, const std::size_t page_size)
+    {
+        const std::size_t n_prefix_matches = this->get_number_of_prefix_matches();
+        const std::size_t first_i = std::min(page_i * page_size, this->size());
+        const std::size_t end_i = std::min(first_i + page_size, this->size());
+
+        if (end_i > n_prefix_matches + this->ranked_fuzzy_matches.size())
+        {
+            // The fuzzy matches are kept in candidate order for narrowing,
+            // so the best ones are copied out. The candidates are sorted,
+            // so ties are broken by the index.
+            this->ranked_fuzzy_matches.resize(end_i - n_prefix_matches);
+            std::partial_sort_copy(
+                    this->fuzzy_matches.begin(),
+                    this->fuzzy_matches.end(),
+                    this->ranked_fuzzy_matches.begin(),
+                    this->ranked_fuzzy_matches.end(),
+                    [](const Match& lhs, const Match& rhs)
+                    {
+                        return lhs.score > rhs.score || (lhs.score == rhs.score && lhs.candidate_i < rhs.candidate_i);
+                    });
+        }
+
+        std::vector<std::string_view> page;
+        page.reserve(end_i - first_i);
+
+        for (std::size_t match_i = first_i; match_i < end_i; match_i++)
+        {
+            page.emplace_back(
+                    match_i < n_prefix_matches ?
+                    this->get_candidate(this->prefix_first_i + match_i) :
+                    this->get_candidate(this->ranked_fuzzy_matches[match_i - n_prefix_matches].candidate_i));
+        }
+
+        return page;
+    }
+
+    std::string CompletionEngine::complete() const
+    {
+        if (this->prefix_first_i == this->prefix_end_i)
+        {
+            if (this->fuzzy_matches.size() == 1)
+            {
+                return std::string(this->get_candidate(this->fuzzy_matches.front().candidate_i));
+            }
+
+            return this->input;
+        }
+
+        // The candidates are sorted, so the first and the last prefix match have the shortest common prefix.
+        const std::string_view first = this->get_candidate(this->prefix_first_i);
+        const std::string_view last = this->get_candidate(this->prefix_end_i - 1);
+        std::size_t length = 0;
+
+        while (length < first.size() && length < last.size() && first[length] == last[length])
+        {
+            length++;
+        }
+
+        return std::string(first.substr(0, length));
+    }
+
+    std::size_t CompletionEngine::size() const
+    {
+        return this->get_number_of_prefix_matches() + this->fuzzy_matches.size();
+    }
+
+    std::size_t CompletionEngine::get_number_of_prefix_matches() const
+    {
+        return this->prefix_end_i - this->prefix_first_i;
+    }
+
+    std::size_t CompletionEngine::get_number_of_candidates() const
+    {
+        return this->candidate_masks.size();
+    }
+
+    const std::string& CompletionEngine::get_input() const
+    {
+        return this->input;
+    }
+}
@@ -0,0 +1,104 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_CONSOLE_COMPLETION_ENGINE_HPP_INCLUDED
+#define YLIKUUTIO_CONSOLE_COMPLETION_ENGINE_HPP_INCLUDED
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int32_t, std::uint32_t, std::uint64_t
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+// `CompletionEngine` ranks candidate names against an input.
+//
+// A candidate matches if the input is its prefix or, failing that,
+// a subsequence of it (fuzzy matching). Prefix matches rank first,
+// in lexicographic order. Fuzzy matches rank by score: consecutive
+// characters and characters at the start of a name part (after `.`
+// or `_`) score higher, skipped characters score lower.
+//
+// The candidates are kept sorted in one contiguous buffer, so the
+// prefix matches are a range found by binary search, and names under
+// the same parent entity are adjacent. Fuzzy matching resumes from the
+// prefix shared with the previous candidate instead of rescanning it.
+// The fuzzy matches of the previous input are cached. When the new
+// input extends the previous input, only the previous matches are
+// rescanned. Fuzzy matches are ranked lazily, only as far as the
+// requested page.
+
+namespace yli::console
+{
+    class CompletionEngine
+    {
+    public:
+        CompletionEngine() = default;
+
+        CompletionEngine(const CompletionEngine&) = delete;
+
+        CompletionEngine& operator=(const CompletionEngine&) = delete;
+
+        void set_candidates(std::vector<std::string>&& candidates);
+
+        // Narrows or recomputes the matches for `input`. Returns the number of matches.
+        std::size_t update(std::string_view input);
+
+        // Returns the ranked matches of page `page_i`.
+        std::vector<std::string_view> get_page(std::size_t page_i, std::size_t page_size);
+
+        // Returns the longest common prefix of the prefix matches,
+        // the only match if there are no prefix matches, or else the input.
+        std::string complete() const;
+
+        std::size_t size() const;
+
+        std::size_t get_number_of_prefix_matches() const;
+
+        std::size_t get_number_of_candidates() const;
+
+        const std::string& get_input() const;
+
+    private:
+        struct Match
+        {
+            std::uint32_t candidate_i;
+            std::int32_t score;
+        };
+
+        std::string_view get_candidate(std::size_t candidate_i) const;
+
+        // Adds the fuzzy matches among `[first_i, end_i)`.
+        void add_fuzzy_matches(std::string_view input, std::size_t first_i, std::size_t end_i);
+
+        std::string candidate_characters;              // All candidates sorted and concatenated.
+        std::vector<std::uint32_t> candidate_offsets;  // Start of each candidate, and the end.
+        std::vector<std::uint64_t> candidate_masks;    // Characters present in each candidate.
+        std::vector<std::uint32_t> candidate_shared_prefix_lengths; // Shared with the previous candidate.
+
+        std::size_t prefix_first_i { 0 };              // Prefix matches are `[prefix_first_i, prefix_end_i)`.
+        std::size_t prefix_end_i { 0 };
+
+        std::vector<Match> fuzzy_matches;              // In candidate order.
+        std::vector<Match> ranked_fuzzy_matches;       // The best fuzzy matches, as far as requested.
+
+        std::string input;
+        bool are_matches_valid { false };
+    };
+}
+
+#endif
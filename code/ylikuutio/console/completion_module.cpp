@@ -16,26 +16,118 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "completion_module.hpp"
+#include "completion_engine.hpp"
 #include "text_input.hpp"
 #include "code/ylikuutio/lisp/legacy_parser.hpp"
+#include "code/ylikuutio/ontology/entity.hpp"
+#include "code/ylikuutio/ontology/registry.hpp"
 #include "code/ylikuutio/ontology/universe.hpp"
 #include "code/ylikuutio/ontology/console.hpp"
 
 // Include standard headers
-#include <cstddef> // std::size_t
-#include <string>  // std::string
-#include <vector>  // std::vector
+#include <cstddef>       // std::size_t
+#include <string>        // std::string, std::to_string
+#include <string_view>   // std::string_view
+#include <unordered_set> // std::unordered_set
+#include <utility>       // std::move
+#include <vector>        // std::vector
 
 namespace yli::console
 {
+    static void collect_names(
+            const ontology::Registry& registry,
+            const std::string& prefix,
+            std::unordered_set<const ontology::Registry*>& visited_registries,
+            std::vector<std::string>& names)
+    {
+        // Each `Registry` is visited only once, so that names referring to
+        // an ancestor do not recurse forever.
+        if (!visited_registries.insert(&registry).second)
+        {
+            return;
+        }
+
+        for (const auto& [name, indexable] : registry.get_indexable_map())
+        {
+            names.emplace_back(prefix + name);
+        }
+
+        for (const auto& [name, entity] : registry.get_entity_map())
+        {
+            names.emplace_back(prefix + name);
+
+            if (entity != nullptr)
+            {
+                entity->create_deferred_variables();
+                collect_names(entity->registry, prefix + name + ".", visited_registries, names);
+            }
+        }
+    }
+
     CompletionModule::CompletionModule(ontology::Console& console)
         : console { console }
     { }
 
-    void CompletionModule::complete()
+    void CompletionModule::update_candidates()
+    {
+        const ontology::Registry& universe_registry = this->console.get_universe().registry;
+
+        if (this->candidates_generation == universe_registry.get_universe_generation())
+        {
+            return;
+        }
+
+        std::vector<std::string> names;
+        std::unordered_set<const ontology::Registry*> visited_registries;
+        collect_names(universe_registry, "", visited_registries, names);
+
+        this->completion_engine.set_candidates(std::move(names));
+        this->candidates_generation = universe_registry.get_universe_generation();
+    }
+
+    void CompletionModule::print_completions(const std::string& input_string, const std::string& query)
     {
-        const ontology::Universe& universe = this->console.get_universe();
+        this->update_candidates();
+
+        if (this->completion_engine.update(query) <= 1)
+        {
+            this->next_page_i = 0;
+            return;
+        }
+
+        // One row is left for the input.
+        const std::size_t page_size = (this->console.n_rows > 1 ? this->console.n_rows - 1 : 1);
+        std::size_t page_i = (input_string == this->paged_input_string ? this->next_page_i : 0);
+
+        if (page_i * page_size >= this->completion_engine.size())
+        {
+            // All pages have been printed, start again.
+            page_i = 0;
+        }
+
+        if (page_i == 0)
+        {
+            this->console.print_text(input_string);
+        }
 
+        for (const std::string_view completion : this->completion_engine.get_page(page_i, page_size))
+        {
+            this->console.print_text(std::string(completion));
+        }
+
+        const std::size_t n_printed = (page_i + 1) * page_size;
+
+        if (n_printed < this->completion_engine.size())
+        {
+            this->console.print_text(
+                    "-- " + std::to_string(this->completion_engine.size() - n_printed) + " more, press Tab again --");
+        }
+
+        this->next_page_i = page_i + 1;
+    }
+
+    void CompletionModule::complete()
+    {
         if (this->console.console_logic_module.get_active_in_console())
         {
             TextInput* const active_input = this->console.console_logic_module.edit_input();
@@ -59,9 +151,9 @@ namespace yli::console
                 // If `input_string` is empty, then complete the command.
                 // Also if there are no parameters and `input_string` does not end with a space, then complete the command.
 
-                this->console.print_completions(universe.registry, command);
+                this->print_completions(input_string, command);
 
-                const std::string completion = universe.complete(command);
+                const std::string completion = this->completion_engine.complete();
                 active_input->clear();
                 active_input->add_characters(completion);
             }
@@ -72,9 +164,9 @@ namespace yli::console
 
                 // If `input_string` is empty, then complete the parameter.
 
-                this->console.print_completions(universe.registry, "");
+                this->print_completions(input_string, "");
 
-                const std::string completion = universe.complete("");
+                const std::string completion = this->completion_engine.complete();
 
                 if (!completion.empty())
                 {
@@ -86,9 +178,9 @@ namespace yli::console
                 // If `input_string` does not end with a space,
                 // then complete the current parameter.
 
-                this->console.print_completions(universe.registry, parameter_vector.back());
+                this->print_completions(input_string, parameter_vector.back());
 
-                const std::string completion = universe.complete(parameter_vector.back());
+                const std::string completion = this->completion_engine.complete();
                 active_input->clear();
                 active_input->add_characters(command);
                 active_input->add_character(' ');
@@ -109,7 +201,9 @@ namespace yli::console
             {
                 // Complete the next parameter.
 
-                const std::string completion = universe.complete("");
+                this->update_candidates();
+                this->completion_engine.update("");
+                const std::string completion = this->completion_engine.complete();
 
                 if (!completion.empty())
                 {
@@ -119,6 +213,7 @@ namespace yli::console
             }
 
             this->console.move_cursor_to_end_of_line();
+            this->paged_input_string = active_input->data();
         }
     }
 }
@@ -18,6 +18,14 @@
 #ifndef YLIKUUTIO_CONSOLE_COMPLETION_MODULE_HPP_INCLUDED
 #define YLIKUUTIO_CONSOLE_COMPLETION_MODULE_HPP_INCLUDED
 
+#include "completion_engine.hpp"
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <limits>  // std::numeric_limits
+#include <string>  // std::string
+
 namespace yli::ontology
 {
     class Console;
@@ -25,6 +33,13 @@ namespace yli::ontology
 
 namespace yli::console
 {
+    // Tab completion of `Console`. The candidates are the names in the
+    // `Registry` of `Universe` and, as dotted names, the local names
+    // of the named entities under it. The candidates are collected again
+    // only when some `Registry` has changed.
+    //
+    // If there are more matches than fit in the console, they are printed
+    // one page at a time, and pressing Tab again prints the next page.
     class CompletionModule
     {
     public:
@@ -33,7 +48,16 @@ namespace yli::console
         void complete();
 
     private:
+        void update_candidates();
+
+        void print_completions(const std::string& input_string, const std::string& query);
+
         ontology::Console& console;
+        CompletionEngine completion_engine;
+        std::uint64_t candidates_generation { std::numeric_limits<std::uint64_t>::max() };
+
+        std::string paged_input_string; // The input after the previous completion.
+        std::size_t next_page_i { 0 };
     };
 }
 
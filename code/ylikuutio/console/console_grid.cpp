@@ -0,0 +1,136 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "console_grid.hpp"
+#include "scrollback_buffer_view.hpp"
+
+// Include standard headers
+#include <algorithm>   // std::max, std::min
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <string_view> // std::string_view
+
+namespace yli::console
+{
+    ConsoleGrid::ConsoleGrid(const std::uint32_t n_columns, const std::uint32_t n_rows)
+        : n_columns { (n_columns > 0 ? n_columns : 1) },
+          n_rows { (n_rows > 0 ? n_rows : 1) },
+          cells(static_cast<std::size_t>(this->n_columns) * this->n_rows, ' ')
+    {
+        this->mark_all_dirty();
+    }
+
+    void ConsoleGrid::set_row(const std::size_t row_i, const std::string_view text)
+    {
+        if (row_i >= this->n_rows) [[unlikely]]
+        {
+            return;
+        }
+
+        char* const row = this->cells.data() + row_i * this->n_columns;
+        DirtyColumns& dirty_columns = this->dirty_columns[row_i];
+
+        for (std::uint32_t column_i = 0; column_i < this->n_columns; column_i++)
+        {
+            const char character = (column_i < text.size() ? text[column_i] : ' ');
+
+            if (row[column_i] != character)
+            {
+                row[column_i] = character;
+
+                if (dirty_columns.empty())
+                {
+                    dirty_columns = DirtyColumns { column_i, column_i + 1 };
+                }
+                else
+                {
+                    dirty_columns.first = std::min(dirty_columns.first, column_i);
+                    dirty_columns.last = std::max(dirty_columns.last, column_i + 1);
+                }
+
+                this->is_dirty = true;
+            }
+        }
+    }
+
+    void ConsoleGrid::set_text(const ScrollbackBufferView& view, const std::string_view input)
+    {
+        std::size_t row_i = 0;
+
+        for (std::size_t line_i = 0; line_i < view.size() && row_i < this->n_rows; line_i++)
+        {
+            this->set_row(row_i++, view[line_i]);
+        }
+
+        for (std::size_t input_i = 0; input_i < input.size() && row_i < this->n_rows; input_i += this->n_columns)
+        {
+            this->set_row(row_i++, input.substr(input_i, this->n_columns));
+        }
+
+        while (row_i < this->n_rows)
+        {
+            this->set_row(row_i++, std::string_view());
+        }
+    }
+
+    void ConsoleGrid::mark_all_dirty()
+    {
+        this->dirty_columns.assign(this->n_rows, DirtyColumns { 0, this->n_columns });
+        this->is_dirty = true;
+    }
+
+    void ConsoleGrid::clear_dirty()
+    {
+        this->dirty_columns.assign(this->n_rows, DirtyColumns());
+        this->is_dirty = false;
+    }
+
+    bool ConsoleGrid::get_is_dirty() const
+    {
+        return this->is_dirty;
+    }
+
+    DirtyColumns ConsoleGrid::get_dirty_columns(const std::size_t row_i) const
+    {
+        if (row_i >= this->n_rows) [[unlikely]]
+        {
+            return DirtyColumns();
+        }
+
+        return this->dirty_columns[row_i];
+    }
+
+    std::string_view ConsoleGrid::get_row(const std::size_t row_i) const
+    {
+        if (row_i >= this->n_rows) [[unlikely]]
+        {
+            return std::string_view();
+        }
+
+        return std::string_view(this->cells.data() + row_i * this->n_columns, this->n_columns);
+    }
+
+    std::uint32_t ConsoleGrid::get_n_columns() const
+    {
+        return this->n_columns;
+    }
+
+    std::uint32_t ConsoleGrid::get_n_rows() const
+    {
+        return this->n_rows;
+    }
+}
@@ -0,0 +1,89 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_CONSOLE_CONSOLE_GRID_HPP_INCLUDED
+#define YLIKUUTIO_CONSOLE_CONSOLE_GRID_HPP_INCLUDED
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+// `ConsoleGrid` holds the `n_columns` x `n_rows` character cells of a `Console`.
+// Every row is always `n_columns` characters wide, shorter lines are padded with spaces.
+//
+// Changed cells are tracked per row as a half-open range of columns,
+// so that the renderer needs to upload only the cells that have changed
+// since the previous call of `clear_dirty`.
+
+namespace yli::console
+{
+    class ScrollbackBufferView;
+
+    struct DirtyColumns
+    {
+        std::uint32_t first { 0 };
+        std::uint32_t last  { 0 }; // One past the last changed column.
+
+        bool empty() const
+        {
+            return this->first >= this->last;
+        }
+    };
+
+    class ConsoleGrid
+    {
+    public:
+        ConsoleGrid(const std::uint32_t n_columns, const std::uint32_t n_rows);
+
+        ConsoleGrid(const ConsoleGrid&) = delete;
+
+        ConsoleGrid& operator=(const ConsoleGrid&) = delete;
+
+        // Writes `text` to row `row_i`, truncated or padded with spaces to `n_columns`.
+        void set_row(std::size_t row_i, std::string_view text);
+
+        // Writes the lines of `view` followed by `input` wrapped to `n_columns`,
+        // and clears the remaining rows.
+        void set_text(const ScrollbackBufferView& view, std::string_view input);
+
+        void mark_all_dirty();
+
+        void clear_dirty();
+
+        bool get_is_dirty() const;
+
+        DirtyColumns get_dirty_columns(std::size_t row_i) const;
+
+        std::string_view get_row(std::size_t row_i) const;
+
+        std::uint32_t get_n_columns() const;
+
+        std::uint32_t get_n_rows() const;
+
+    private:
+        const std::uint32_t n_columns;
+        const std::uint32_t n_rows;
+
+        std::vector<char> cells;
+        std::vector<DirtyColumns> dirty_columns;
+        bool is_dirty { true };
+    };
+}
+
+#endif
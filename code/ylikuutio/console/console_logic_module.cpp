@@ -20,6 +20,7 @@
 #include "modifier_state.hpp"
 #include "text_input_history.hpp"
 #include "scrollback_buffer.hpp"
+#include "script_runner.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
 #include "code/ylikuutio/lisp/legacy_parser.hpp"
 #include "code/ylikuutio/lisp/legacy_executor.hpp"
@@ -33,6 +34,7 @@
 #include <iostream> // std::cerr
 #include <limits>   // std::numeric_limits
 #include <optional> // std::optional
+#include <sstream>  // std::ostringstream
 #include <string>   // std::string
 #include <vector>   // std::vector
 
@@ -1025,6 +1027,84 @@ namespace yli::console
         return data::AnyValue(clear_console_magic_number);
     }
 
+    std::optional<data::AnyValue> ConsoleLogicModule::search(
+        ontology::Console& console,
+        const std::vector<std::string>& needle_words)
+    {
+        constexpr std::size_t max_n_search_results = 100;
+
+        std::string needle = needle_words.front();
+
+        for (std::size_t word_i = 1; word_i < needle_words.size(); word_i++)
+        {
+            needle += ' ';
+            needle += needle_words[word_i];
+        }
+
+        // Collect the matches first, as printing them modifies the scrollback buffer.
+        std::vector<std::string> matching_lines;
+
+        if (!console.scrollback_buffer.get_history_filename().empty())
+        {
+            matching_lines = console.scrollback_buffer.search_history(needle, max_n_search_results);
+        }
+        else
+        {
+            for (const std::size_t row_i : console.scrollback_buffer.find(needle))
+            {
+                if (matching_lines.size() >= max_n_search_results)
+                {
+                    break;
+                }
+
+                matching_lines.emplace_back(console.scrollback_buffer.line_at(row_i));
+            }
+        }
+
+        for (const std::string& line : matching_lines)
+        {
+            console.print_text(line);
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<data::AnyValue> ConsoleLogicModule::source(
+        ontology::Console& console,
+        const std::string& filename)
+    {
+        if (console.console_logic_module.source_depth >= ConsoleLogicModule::max_source_depth) [[unlikely]]
+        {
+            console.print_text("source: too deeply nested: " + filename);
+            return std::nullopt;
+        }
+
+        console.console_logic_module.source_depth++;
+        ScriptRunner script_runner(console);
+        std::optional<data::AnyValue> exit_value = script_runner.run_file(filename);
+        console.console_logic_module.source_depth--;
+
+        if (!script_runner.get_is_file_loaded())
+        {
+            console.print_text("source: could not read " + filename);
+            return std::nullopt;
+        }
+
+        std::ostringstream summary_stringstream;
+        summary_stringstream << "source: " << filename << ": " << script_runner.get_n_commands() << " commands";
+
+        if (script_runner.get_n_unknown_commands() > 0)
+        {
+            summary_stringstream << " (" << script_runner.get_n_unknown_commands() << " unknown)";
+        }
+
+        summary_stringstream << " in " << script_runner.get_elapsed_seconds() * 1000.0 << " ms";
+        console.print_text(summary_stringstream.str());
+
+        // Pass on the request to exit the program, if any.
+        return exit_value;
+    }
+
     // Public callbacks end here.
 
     // Callbacks end here.
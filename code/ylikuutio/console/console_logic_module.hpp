@@ -26,6 +26,7 @@
 #include <limits>   // std::numeric_limits
 #include <optional> // std::optional
 #include <string>   // std::string
+#include <vector>   // std::vector
 
 namespace yli::data
 {
@@ -294,6 +295,18 @@ namespace yli::console
                 static std::optional<data::AnyValue> clear(
                         ontology::Console& console);
 
+                // Prints the lines which contain the words of `needle` joined with spaces.
+                // Searches the history file if the console has one, otherwise the scrollback buffer.
+                static std::optional<data::AnyValue> search(
+                        ontology::Console& console,
+                        const std::vector<std::string>& needle_words);
+
+                // Executes the commands of the file `filename` as a batch, see `ScriptRunner`,
+                // and prints the number of commands executed and the time it took.
+                static std::optional<data::AnyValue> source(
+                        ontology::Console& console,
+                        const std::string& filename);
+
                 // Public callbacks end here.
 
         private:
@@ -315,6 +328,10 @@ namespace yli::console
 
                 ModifierState modifier_state;
 
+                // Nesting depth of `source` commands, to stop scripts that source themselves.
+                std::size_t source_depth { 0 };
+                static constexpr std::size_t max_source_depth { 16 };
+
         public:
                 const std::string prompt { "$ " };
         };
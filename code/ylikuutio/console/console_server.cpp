@@ -0,0 +1,387 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "console_server.hpp"
+#include "console_server_struct.hpp"
+#include "remote_command.hpp"
+
+// Include asio
+#include <asio.hpp>
+
+// Include standard headers
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint16_t, std::uint64_t
+#include <deque>        // std::deque
+#include <filesystem>   // std::filesystem::is_socket, std::filesystem::remove
+#include <map>          // std::map
+#include <memory>       // std::enable_shared_from_this, std::make_shared, std::make_unique, std::shared_ptr
+#include <mutex>        // std::mutex, std::scoped_lock
+#include <optional>     // std::optional
+#include <stdexcept>    // std::runtime_error
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <system_error> // std::error_code
+#include <thread>       // std::thread
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
+namespace yli::console
+{
+    // Longer lines are not console commands, the client is disconnected.
+    static constexpr std::size_t max_line_length = 64 * 1024;
+
+    // Replies are one line each, so line breaks in the text are replaced.
+    static std::string make_line(const std::string_view prefix, const std::string_view text)
+    {
+        std::string line;
+        line.reserve(prefix.size() + text.size() + 1);
+        line += prefix;
+
+        for (const char character : text)
+        {
+            line += (character == '\n' || character == '\r' ? ' ' : character);
+        }
+
+        line += '\n';
+        return line;
+    }
+
+    // Everything here except `commands` is only used by the network thread.
+    struct ConsoleServer::NetworkState
+    {
+        class Session
+        {
+            public:
+                virtual ~Session() = default;
+
+                // Droppable lines are not queued if the client does not keep up.
+                virtual void write(std::string&& line, bool is_droppable) = 0;
+
+                virtual void close() = 0;
+
+                bool is_subscribed_to_metrics { false };
+        };
+
+        template<typename Socket>
+        class StreamSession final : public Session, public std::enable_shared_from_this<StreamSession<Socket>>
+        {
+            public:
+                StreamSession(NetworkState& network_state, Socket&& socket, const std::uint64_t client_id)
+                    : network_state { network_state },
+                      socket { std::move(socket) },
+                      client_id { client_id }
+                {
+                }
+
+                void start()
+                {
+                    this->read_line();
+                }
+
+                void write(std::string&& line, const bool is_droppable) override
+                {
+                    if (is_droppable && this->write_queue.size() >= this->network_state.max_queued_writes)
+                    {
+                        return;
+                    }
+
+                    this->write_queue.emplace_back(std::move(line));
+
+                    if (this->write_queue.size() == 1)
+                    {
+                        this->write_next();
+                    }
+                }
+
+                void close() override
+                {
+                    asio::error_code error;
+                    this->socket.close(error);
+                }
+
+            private:
+                void read_line()
+                {
+                    asio::async_read_until(
+                            this->socket,
+                            asio::dynamic_buffer(this->read_buffer, max_line_length),
+                            '\n',
+                            [self = this->shared_from_this()](const asio::error_code& error, const std::size_t line_length)
+                            {
+                                if (error)
+                                {
+                                    self->network_state.remove_session(self->client_id);
+                                    return;
+                                }
+
+                                std::string line = self->read_buffer.substr(0, line_length - 1);
+                                self->read_buffer.erase(0, line_length);
+
+                                if (!line.empty() && line.back() == '\r')
+                                {
+                                    line.pop_back();
+                                }
+
+                                self->network_state.receive_line(*self, self->client_id, std::move(line));
+                                self->read_line();
+                            });
+                }
+
+                void write_next()
+                {
+                    asio::async_write(
+                            this->socket,
+                            asio::buffer(this->write_queue.front()),
+                            [self = this->shared_from_this()](const asio::error_code& error, const std::size_t /* n_bytes */)
+                            {
+                                if (error)
+                                {
+                                    self->network_state.remove_session(self->client_id);
+                                    return;
+                                }
+
+                                self->write_queue.pop_front();
+
+                                if (!self->write_queue.empty())
+                                {
+                                    self->write_next();
+                                }
+                            });
+                }
+
+                NetworkState& network_state;
+                Socket socket;
+                const std::uint64_t client_id;
+                std::string read_buffer;
+                std::deque<std::string> write_queue;
+        };
+
+        explicit NetworkState(const ConsoleServerStruct& console_server_struct)
+            : unix_socket_path { console_server_struct.unix_socket_path },
+              max_queued_writes { console_server_struct.max_queued_writes }
+        {
+        }
+
+        template<typename Acceptor>
+        void accept(Acceptor& acceptor)
+        {
+            using Socket = typename Acceptor::protocol_type::socket;
+
+            acceptor.async_accept(
+                    [this, &acceptor](const asio::error_code& error, Socket socket)
+                    {
+                        if (!acceptor.is_open())
+                        {
+                            return;
+                        }
+
+                        if (!error)
+                        {
+                            const std::uint64_t client_id = this->next_client_id++;
+                            std::shared_ptr<StreamSession<Socket>> session =
+                                std::make_shared<StreamSession<Socket>>(*this, std::move(socket), client_id);
+                            this->sessions.emplace(client_id, session);
+                            session->start();
+                        }
+
+                        this->accept(acceptor);
+                    });
+        }
+
+        void receive_line(Session& session, const std::uint64_t client_id, std::string&& line)
+        {
+            if (line.empty())
+            {
+                return;
+            }
+
+            if (line == ":metrics on")
+            {
+                session.is_subscribed_to_metrics = true;
+                return;
+            }
+
+            if (line == ":metrics off")
+            {
+                session.is_subscribed_to_metrics = false;
+                return;
+            }
+
+            std::scoped_lock lock(this->mutex);
+            this->commands.emplace_back(RemoteCommand { client_id, std::move(line) });
+        }
+
+        void remove_session(const std::uint64_t client_id)
+        {
+            if (const auto it = this->sessions.find(client_id); it != this->sessions.end())
+            {
+                it->second->close();
+                this->sessions.erase(it);
+            }
+        }
+
+        void shut_down()
+        {
+            asio::error_code error;
+
+            if (this->tcp_acceptor)
+            {
+                this->tcp_acceptor->close(error);
+            }
+
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+            if (this->unix_acceptor)
+            {
+                this->unix_acceptor->close(error);
+            }
+#endif
+
+            for (auto& [client_id, session] : this->sessions)
+            {
+                session->close();
+            }
+
+            this->sessions.clear();
+            this->work_guard.reset();
+        }
+
+        asio::io_context io_context;
+        asio::executor_work_guard<asio::io_context::executor_type> work_guard { asio::make_work_guard(io_context) };
+        std::optional<asio::ip::tcp::acceptor> tcp_acceptor;
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+        std::optional<asio::local::stream_protocol::acceptor> unix_acceptor;
+#endif
+        std::map<std::uint64_t, std::shared_ptr<Session>> sessions;
+        std::uint64_t next_client_id { 1 };
+        const std::string unix_socket_path;
+        const std::size_t max_queued_writes;
+
+        std::mutex mutex;
+        std::vector<RemoteCommand> commands; // Guarded by `mutex`.
+
+        std::thread network_thread;
+    };
+
+    ConsoleServer::ConsoleServer(const ConsoleServerStruct& console_server_struct)
+        : network_state { std::make_unique<NetworkState>(console_server_struct) }
+    {
+        NetworkState& network_state = *this->network_state;
+
+        if (!console_server_struct.unix_socket_path.empty())
+        {
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+            // A socket file left over from an earlier run would make binding fail.
+            if (std::error_code error; std::filesystem::is_socket(console_server_struct.unix_socket_path, error))
+            {
+                std::filesystem::remove(console_server_struct.unix_socket_path, error);
+            }
+
+            network_state.unix_acceptor.emplace(
+                    network_state.io_context,
+                    asio::local::stream_protocol::endpoint(console_server_struct.unix_socket_path));
+            network_state.accept(*network_state.unix_acceptor);
+#else
+            throw std::runtime_error("ERROR: `ConsoleServer::ConsoleServer`: Unix domain sockets are not supported!");
+#endif
+        }
+        else
+        {
+            // Only the loopback interface, remote control is for local use only.
+            network_state.tcp_acceptor.emplace(
+                    network_state.io_context,
+                    asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), console_server_struct.tcp_port));
+            network_state.accept(*network_state.tcp_acceptor);
+        }
+
+        network_state.network_thread = std::thread(
+                [&network_state]()
+                {
+                    network_state.io_context.run();
+                });
+    }
+
+    ConsoleServer::~ConsoleServer()
+    {
+        NetworkState& network_state = *this->network_state;
+
+        asio::post(
+                network_state.io_context,
+                [&network_state]()
+                {
+                    network_state.shut_down();
+                });
+
+        network_state.network_thread.join();
+
+        if (!network_state.unix_socket_path.empty())
+        {
+            std::error_code error;
+            std::filesystem::remove(network_state.unix_socket_path, error);
+        }
+    }
+
+    std::vector<RemoteCommand> ConsoleServer::take_commands()
+    {
+        std::vector<RemoteCommand> commands;
+        std::scoped_lock lock(this->network_state->mutex);
+        commands.swap(this->network_state->commands);
+        return commands;
+    }
+
+    void ConsoleServer::send_result(const std::uint64_t client_id, const std::string_view result)
+    {
+        NetworkState& network_state = *this->network_state;
+
+        asio::post(
+                network_state.io_context,
+                [&network_state, client_id, line = make_line("result ", result)]() mutable
+                {
+                    if (const auto it = network_state.sessions.find(client_id); it != network_state.sessions.end())
+                    {
+                        it->second->write(std::move(line), false);
+                    }
+                });
+    }
+
+    void ConsoleServer::send_metrics(const std::string_view metrics)
+    {
+        NetworkState& network_state = *this->network_state;
+
+        asio::post(
+                network_state.io_context,
+                [&network_state, line = make_line("metrics ", metrics)]()
+                {
+                    for (auto& [client_id, session] : network_state.sessions)
+                    {
+                        if (session->is_subscribed_to_metrics)
+                        {
+                            session->write(std::string(line), true);
+                        }
+                    }
+                });
+    }
+
+    std::uint16_t ConsoleServer::get_tcp_port() const
+    {
+        if (this->network_state->tcp_acceptor)
+        {
+            return this->network_state->tcp_acceptor->local_endpoint().port();
+        }
+
+        return 0;
+    }
+}
@@ -0,0 +1,74 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_CONSOLE_CONSOLE_SERVER_HPP_INCLUDED
+#define YLIKUUTIO_CONSOLE_CONSOLE_SERVER_HPP_INCLUDED
+
+#include "remote_console.hpp"
+#include "remote_command.hpp"
+
+// Include standard headers
+#include <cstdint>     // std::uint16_t, std::uint64_t
+#include <memory>      // std::unique_ptr
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+// `ConsoleServer` accepts console commands over a local socket, either
+// a Unix domain socket or TCP on the loopback interface, so that a
+// headless simulation can be driven and observed without a display.
+// It is compiled only if `COMPILE_CONSOLE_SERVER` is set in CMake,
+// because it needs standalone asio.
+//
+// The protocol is line based. Each line received is one console command
+// and gets exactly one `result <text>` line as reply, after the main loop
+// has executed it. A client that sends `:metrics on` receives the periodic
+// `metrics <key>=<value> ...` lines until it sends `:metrics off`.
+//
+// The sockets are served by a background thread. Received commands are
+// only queued there, so they never race the simulation.
+
+namespace yli::console
+{
+    struct ConsoleServerStruct;
+
+    class ConsoleServer final : public RemoteConsole
+    {
+        public:
+            explicit ConsoleServer(const ConsoleServerStruct& console_server_struct);
+
+            ConsoleServer(const ConsoleServer&) = delete;            // Delete copy constructor.
+            ConsoleServer& operator=(const ConsoleServer&) = delete; // Delete copy assignment.
+
+            ~ConsoleServer() override;
+
+            std::vector<RemoteCommand> take_commands() override;
+
+            void send_result(std::uint64_t client_id, std::string_view result) override;
+
+            void send_metrics(std::string_view metrics) override;
+
+            // The bound TCP port, or 0 when listening on a Unix domain socket.
+            std::uint16_t get_tcp_port() const;
+
+        private:
+            struct NetworkState;
+
+            std::unique_ptr<NetworkState> network_state;
+    };
+}
+
+#endif
@@ -0,0 +1,36 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_CONSOLE_CONSOLE_SERVER_STRUCT_HPP_INCLUDED
+#define YLIKUUTIO_CONSOLE_CONSOLE_SERVER_STRUCT_HPP_INCLUDED
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint16_t
+#include <string>  // std::string
+
+namespace yli::console
+{
+    struct ConsoleServerStruct
+    {
+        std::string unix_socket_path;               // If not empty, listen on this Unix domain socket instead of TCP.
+        std::uint16_t tcp_port { 0 };               // TCP port on the loopback interface, 0 means any free port.
+        std::size_t max_queued_writes { 256 };      // Per client. Metrics are dropped for clients that do not keep up.
+    };
+}
+
+#endif
@@ -15,17 +15,20 @@
 // You should have received a copy of the GNU Affero General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
-#ifndef YLIKUUTIO_ONTOLOGY_GLYPH_OBJECT_CREATION_HPP_INCLUDED
-#define YLIKUUTIO_ONTOLOGY_GLYPH_OBJECT_CREATION_HPP_INCLUDED
+#ifndef YLIKUUTIO_CONSOLE_REMOTE_COMMAND_HPP_INCLUDED
+#define YLIKUUTIO_CONSOLE_REMOTE_COMMAND_HPP_INCLUDED
 
 // Include standard headers
-#include <string>   // std::string
+#include <cstdint> // std::uint64_t
+#include <string>  // std::string
 
-namespace yli::ontology
+namespace yli::console
 {
-    class Text3d;
-
-    void create_glyph_objects(const std::string& text_string, Text3d& text_3d);
+    struct RemoteCommand
+    {
+        std::uint64_t client_id; // Where to send the result.
+        std::string command;
+    };
 }
 
 #endif
@@ -0,0 +1,53 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_CONSOLE_REMOTE_CONSOLE_HPP_INCLUDED
+#define YLIKUUTIO_CONSOLE_REMOTE_CONSOLE_HPP_INCLUDED
+
+#include "remote_command.hpp"
+
+// Include standard headers
+#include <cstdint>     // std::uint64_t
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+// `RemoteConsole` is the interface through which a headless simulation
+// receives console commands from outside the process and reports back.
+//
+// The main loop polls `take_commands` once per tick, before the tick,
+// and executes the commands in the order received. Implementations must
+// be safe to use while their own I/O runs on another thread.
+
+namespace yli::console
+{
+    class RemoteConsole
+    {
+    public:
+        virtual ~RemoteConsole() = default;
+
+        // Returns the commands received since the last call, in order.
+        virtual std::vector<RemoteCommand> take_commands() = 0;
+
+        // Sends the result of a command to the client that sent it.
+        virtual void send_result(std::uint64_t client_id, std::string_view result) = 0;
+
+        // Sends metrics to the clients that have subscribed to them.
+        virtual void send_metrics(std::string_view metrics) = 0;
+    };
+}
+
+#endif
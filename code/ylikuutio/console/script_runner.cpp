@@ -0,0 +1,215 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "script_runner.hpp"
+#include "code/ylikuutio/core/application.hpp"
+#include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/file/memory_mapped_file.hpp"
+#include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/ontology/console.hpp"
+#include "code/ylikuutio/ontology/console_lisp_function.hpp"
+#include "code/ylikuutio/ontology/callback_magic_numbers.hpp"
+
+// Include standard headers
+#include <chrono>      // std::chrono::duration, std::chrono::steady_clock
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <optional>    // std::nullopt, std::optional
+#include <string>      // std::string, std::to_string
+#include <string_view> // std::string_view
+#include <utility>     // std::move
+
+namespace yli::console
+{
+    ScriptRunner::ScriptRunner(ontology::Console& console)
+        : console { console }
+    {
+    }
+
+    std::optional<data::AnyValue> ScriptRunner::run(const std::string_view script)
+    {
+        const auto start_time = std::chrono::steady_clock::now();
+        std::optional<data::AnyValue> exit_value;
+
+        for (std::size_t line_start = 0; line_start < script.size(); )
+        {
+            std::size_t line_end = script.find('\n', line_start);
+
+            if (line_end == std::string_view::npos)
+            {
+                line_end = script.size();
+            }
+
+            std::string_view line = script.substr(line_start, line_end - line_start);
+            line_start = line_end + 1;
+            this->n_lines++;
+
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.remove_suffix(1);
+            }
+
+            // Split the line at spaces. The first non-empty token is the command,
+            // the rest non-empty tokens are the parameters.
+            std::string_view command;
+            std::size_t n_parameters = 0;
+
+            for (std::size_t token_start = 0; token_start < line.size(); )
+            {
+                std::size_t token_end = line.find(' ', token_start);
+
+                if (token_end == std::string_view::npos)
+                {
+                    token_end = line.size();
+                }
+
+                if (token_end > token_start)
+                {
+                    const std::string_view token = line.substr(token_start, token_end - token_start);
+
+                    if (command.empty() && token.front() == ';')
+                    {
+                        // Comment line.
+                        break;
+                    }
+                    else if (command.empty())
+                    {
+                        command = token;
+                    }
+                    else if (n_parameters < this->parameter_vector.size())
+                    {
+                        // Reuse the capacity of the previous parameters.
+                        this->parameter_vector[n_parameters++].assign(token);
+                    }
+                    else
+                    {
+                        this->parameter_vector.emplace_back(token);
+                        n_parameters++;
+                    }
+                }
+
+                token_start = token_end + 1;
+            }
+
+            if (command.empty())
+            {
+                continue;
+            }
+
+            this->parameter_vector.resize(n_parameters);
+            this->n_commands++;
+
+            const ontology::ConsoleLispFunction* const console_lisp_function = this->get_console_lisp_function(command);
+
+            if (console_lisp_function == nullptr) [[unlikely]]
+            {
+                this->n_unknown_commands++;
+                this->console.print_text("line " + std::to_string(this->n_lines) + ": unknown command: " + std::string(command));
+                continue;
+            }
+
+            if (std::optional<data::AnyValue> any_value = console_lisp_function->execute(this->parameter_vector);
+                any_value &&
+                any_value->holds<std::uint32_t>() &&
+                any_value->get<std::uint32_t>() == ontology::CallbackMagicNumber::EXIT_PROGRAM) [[unlikely]]
+            {
+                exit_value = std::move(any_value);
+                break;
+            }
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        this->elapsed_seconds += elapsed.count();
+        return exit_value;
+    }
+
+    std::optional<data::AnyValue> ScriptRunner::run_file(const std::string& filename)
+    {
+        const file::MemoryMappedFile script_file(filename);
+        this->is_file_loaded = script_file.get_is_valid();
+
+        if (!this->is_file_loaded)
+        {
+            return std::nullopt;
+        }
+
+        return this->run(script_file.get_string_view());
+    }
+
+    bool ScriptRunner::get_is_file_loaded() const
+    {
+        return this->is_file_loaded;
+    }
+
+    std::size_t ScriptRunner::get_n_lines() const
+    {
+        return this->n_lines;
+    }
+
+    std::size_t ScriptRunner::get_n_commands() const
+    {
+        return this->n_commands;
+    }
+
+    std::size_t ScriptRunner::get_n_unknown_commands() const
+    {
+        return this->n_unknown_commands;
+    }
+
+    double ScriptRunner::get_elapsed_seconds() const
+    {
+        return this->elapsed_seconds;
+    }
+
+    ontology::ConsoleLispFunction* ScriptRunner::get_console_lisp_function(const std::string_view command)
+    {
+        ontology::Universe& universe = this->console.get_application().get_universe();
+
+        auto it = this->console_lisp_function_cache.find(command);
+
+        if (it != this->console_lisp_function_cache.end() && it->second.generation == *it->second.name_generation) [[likely]]
+        {
+            return it->second.console_lisp_function;
+        }
+
+        // Same lookup as in `lisp::execute`.
+        std::string command_string(command);
+        ontology::ConsoleLispFunction* console_lisp_function = nullptr;
+
+        if (ontology::Entity* const console_lisp_function_entity = universe.get_entity(command_string);
+            console_lisp_function_entity != nullptr && console_lisp_function_entity->get_parent() == &this->console)
+        {
+            console_lisp_function = dynamic_cast<ontology::ConsoleLispFunction*>(console_lisp_function_entity);
+        }
+
+        const std::size_t* const name_generation = universe.registry.get_name_generation(command_string);
+
+        if (name_generation == nullptr)
+        {
+            // `command` has never been bound, so there is nothing to validate a cached lookup with.
+            return console_lisp_function;
+        }
+
+        if (it == this->console_lisp_function_cache.end())
+        {
+            it = this->console_lisp_function_cache.emplace(std::move(command_string), CachedConsoleLispFunction {}).first;
+        }
+
+        it->second = CachedConsoleLispFunction { console_lisp_function, name_generation, *name_generation };
+        return console_lisp_function;
+    }
+}
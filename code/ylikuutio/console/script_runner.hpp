@@ -0,0 +1,106 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_CONSOLE_SCRIPT_RUNNER_HPP_INCLUDED
+#define YLIKUUTIO_CONSOLE_SCRIPT_RUNNER_HPP_INCLUDED
+
+#include "code/ylikuutio/data/any_value.hpp"
+
+// Include standard headers
+#include <cstddef>       // std::size_t
+#include <functional>    // std::equal_to, std::hash
+#include <optional>      // std::optional
+#include <string>        // std::string
+#include <string_view>   // std::string_view
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+namespace yli::ontology
+{
+    class Console;
+    class ConsoleLispFunction;
+}
+
+namespace yli::console
+{
+    class ScriptRunner final
+    {
+        // `ScriptRunner` executes a script of console commands as one batch.
+        //
+        // Every line is one command, split into the command and its parameters
+        // at spaces just like `lisp::legacy_parse` does, but directly from the
+        // script buffer. Empty lines and lines beginning with `;` are skipped.
+        // Unlike `Console::execute_command`, commands are not echoed into
+        // the scrollback buffer, and the `ConsoleLispFunction` of each command
+        // is looked up only once per `Registry` generation.
+        //
+        // Execution stops at the first command that requests exiting the program.
+
+        public:
+            explicit ScriptRunner(ontology::Console& console);
+
+            ScriptRunner(const ScriptRunner&) = delete;            // Delete copy constructor.
+            ScriptRunner& operator=(const ScriptRunner&) = delete; // Delete copy assignment.
+
+            // Returns the value of the command that requested exiting the program, if any.
+            std::optional<data::AnyValue> run(std::string_view script);
+
+            // As `run`, with the contents of `filename`. `get_is_file_loaded` tells if reading it succeeded.
+            std::optional<data::AnyValue> run_file(const std::string& filename);
+
+            bool get_is_file_loaded() const;
+            std::size_t get_n_lines() const;
+            std::size_t get_n_commands() const;
+            std::size_t get_n_unknown_commands() const;
+            double get_elapsed_seconds() const;
+
+        private:
+            struct StringHash
+            {
+                using is_transparent = void;
+
+                std::size_t operator()(const std::string_view string) const
+                {
+                    return std::hash<std::string_view>{}(string);
+                }
+            };
+
+            // A cached lookup is valid until its name is bound or erased, see `Registry::get_name_generation`.
+            struct CachedConsoleLispFunction
+            {
+                ontology::ConsoleLispFunction* console_lisp_function;
+                const std::size_t* name_generation;
+                std::size_t generation;
+            };
+
+            ontology::ConsoleLispFunction* get_console_lisp_function(std::string_view command);
+
+            ontology::Console& console;
+
+            std::unordered_map<std::string, CachedConsoleLispFunction, StringHash, std::equal_to<>> console_lisp_function_cache;
+
+            std::vector<std::string> parameter_vector;
+
+            bool is_file_loaded            { false };
+            std::size_t n_lines            { 0 };
+            std::size_t n_commands         { 0 };
+            std::size_t n_unknown_commands { 0 };
+            double elapsed_seconds         { 0.0 };
+    };
+}
+
+#endif
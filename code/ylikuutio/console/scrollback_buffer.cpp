@@ -16,51 +16,105 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "scrollback_buffer.hpp"
+#include "scrollback_buffer_view.hpp"
 #include "console_state.hpp"
+#include "code/ylikuutio/file/memory_mapped_file.hpp"
 
 // Include standard headers
-#include <cstddef>  // std::size_t
-#include <cstdint>  // std::uint32_t
-#include <limits>   // std::numeric_limits
-#include <span>     // std::span
-#include <string>   // std::string
-#include <vector>   // std::vector
+#include <algorithm>   // std::copy_n, std::min, std::search
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t, std::uint64_t
+#include <functional>  // std::boyer_moore_horspool_searcher
+#include <ios>         // std::ios
+#include <iostream>    // std::cerr
+#include <limits>      // std::numeric_limits
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
 
 namespace yli::console
 {
-    ScrollbackBuffer::ScrollbackBuffer(const std::uint32_t n_columns, const std::uint32_t n_rows)
+    ScrollbackBuffer::ScrollbackBuffer(const std::uint32_t n_columns, const std::uint32_t n_rows, const std::size_t max_n_lines)
         : n_columns { (n_columns > 0 ? n_columns : 1) },
-          n_rows { (n_rows > 0 ? n_rows : 1) }
+          n_rows { (n_rows > 0 ? n_rows : 1) },
+          max_n_lines { (max_n_lines > 0 ? max_n_lines : 1) },
+          arena(this->max_n_lines * this->n_columns),
+          lines(this->max_n_lines)
     { }
 
-    void ScrollbackBuffer::add_to_buffer(const std::string& text)
+    void ScrollbackBuffer::add_to_buffer(const std::string_view text)
     {
-        for (std::size_t text_i = 0; text_i < text.size(); text_i += this->n_columns)
+        if (!text.empty())
         {
-            if (text_i + this->n_columns <= text.size())
-            {
-                this->buffer.emplace_back(text.cbegin() + text_i, text.cbegin() + text_i + this->n_columns);
-            }
-            else
-            {
-                this->buffer.emplace_back(text.cbegin() + text_i, text.end());
-            }
+            this->emplace_back(text);
         }
     }
 
-    void ScrollbackBuffer::emplace_back(const std::string& text)
+    void ScrollbackBuffer::emplace_back(const std::string_view text)
     {
-        this->buffer.emplace_back(text);
+        const std::size_t arena_size = this->arena.size();
+        const std::size_t length = std::min(text.size(), arena_size);
+
+        // A line is never split at the end of the arena, so that it can be viewed as one `std::string_view`.
+        if (const std::size_t offset = this->next_position % arena_size; offset + length > arena_size)
+        {
+            this->next_position += arena_size - offset;
+        }
+
+        if (this->n_lines == this->max_n_lines)
+        {
+            this->evict_first_line();
+        }
+
+        // Evict the lines whose bytes would be overwritten.
+        while (this->n_lines > 0 && this->next_position + length > this->lines[this->first_line_i].position + arena_size)
+        {
+            this->evict_first_line();
+        }
+
+        const std::size_t offset = this->next_position % arena_size;
+        std::copy_n(text.data(), length, this->arena.data() + offset);
+
+        std::size_t ring_i = this->first_line_i + this->n_lines;
+        ring_i = (ring_i < this->max_n_lines ? ring_i : ring_i - this->max_n_lines);
+        this->lines[ring_i] = ScrollbackBufferLine { this->next_position, this->next_row, offset, length };
+        this->n_lines++;
+        this->next_position += length;
+        this->next_row += this->get_n_rows_of_line(this->lines[ring_i]);
+
+        if (this->history_file.is_open())
+        {
+            this->history_file << text << '\n';
+        }
     }
 
-    void ScrollbackBuffer::push_back(const std::string& text)
+    void ScrollbackBuffer::push_back(const std::string_view text)
     {
-        this->buffer.push_back(text);
+        this->emplace_back(text);
+    }
+
+    void ScrollbackBuffer::evict_first_line()
+    {
+        const std::size_t n_rows_of_line = this->get_n_rows_of_line(this->lines[this->first_line_i]);
+        this->first_line_i = (this->first_line_i + 1 < this->max_n_lines ? this->first_line_i + 1 : 0);
+        this->n_lines--;
+
+        if (this->get_is_active_in_buffer())
+        {
+            // Keep pointing to the same row, unless it was evicted.
+            this->buffer_index = (this->buffer_index > n_rows_of_line ? this->buffer_index - n_rows_of_line : 0);
+        }
+    }
+
+    std::size_t ScrollbackBuffer::get_n_rows_of_line(const ScrollbackBufferLine& line) const
+    {
+        // An empty line takes one row, too.
+        return (line.length > 0 ? (line.length + this->n_columns - 1) / this->n_columns : 1);
     }
 
     bool ScrollbackBuffer::enter_buffer()
     {
-        if (const std::size_t buffer_size = this->buffer.size(); buffer_size > 0) [[likely]]
+        if (const std::size_t buffer_size = this->size(); buffer_size > 0) [[likely]]
         {
             if (this->get_is_active_in_buffer()) [[unlikely]]
             {
@@ -70,7 +124,6 @@ namespace yli::console
 
             // If we are not in buffer and the buffer is not empty, enter the buffer.
             this->buffer_index = buffer_size - 1;
-            this->buffer_it = this->buffer.begin() + this->buffer_index;
             return true;
         }
 
@@ -84,7 +137,6 @@ namespace yli::console
         {
             // If we are in buffer, exit the buffer.
             this->buffer_index = std::numeric_limits<std::size_t>::max();
-            this->buffer_it = this->buffer.end();
             return true;
         }
 
@@ -97,7 +149,6 @@ namespace yli::console
         {
             // If we are in the buffer and not in the oldest input, move to the previous input.
             --this->buffer_index;
-            --this->buffer_it;
             return true;
         }
 
@@ -111,7 +162,6 @@ namespace yli::console
         {
             // If we are in the buffer and not in the newest input, move to the next input.
             ++this->buffer_index;
-            ++this->buffer_it;
             return true;
         }
 
@@ -124,7 +174,6 @@ namespace yli::console
         if (this->size() > 0 && this->get_is_active_in_buffer()) [[likely]]
         {
             this->buffer_index = 0;
-            this->buffer_it = this->buffer.begin();
         }
     }
 
@@ -133,42 +182,164 @@ namespace yli::console
         if (this->size() > 0 && this->get_is_active_in_buffer()) [[likely]]
         {
             this->buffer_index = this->size() - 1;
-            this->buffer_it = this->buffer.begin() + this->size() - 1;
         }
     }
 
-    std::span<const std::string> ScrollbackBuffer::get_view(const std::size_t top_index,
-                                                            const std::size_t max_rows) const
+    ScrollbackBufferView ScrollbackBuffer::get_view(const std::size_t top_index,
+                                                    const std::size_t max_rows) const
     {
         if (top_index >= this->size()) [[unlikely]]
         {
             // Top index is too big.
-            return std::span(this->data().begin(), this->data().begin()); // Empty view.
+            return ScrollbackBufferView(); // Empty view.
         }
-        else if (max_rows <= this->size() && top_index <= this->size() - max_rows) [[likely]]
+
+        // A max-size view can not be provided if it would extend past the end of data.
+        return ScrollbackBufferView(
+                this->arena.data(),
+                this->lines.data(),
+                this->max_n_lines,
+                this->first_line_i,
+                this->n_lines,
+                this->n_columns,
+                this->lines[this->first_line_i].first_row + top_index,
+                std::min(max_rows, this->size() - top_index));
+    }
+
+    ScrollbackBufferView ScrollbackBuffer::get_view_to_last(const std::size_t max_rows) const
+    {
+        if (this->size() > max_rows) [[likely]]
         {
-            // Arguments are valid and a view of requested size can be provided.
-            return std::span(&this->data()[top_index], &this->data()[top_index + max_rows]);
+            return this->get_view(this->size() - max_rows, max_rows);
         }
 
-        // Arguments are valid but a max-size view can not be provided due to end of data.
-        return std::span(&this->data()[top_index], &this->data()[this->size()]);
+        return this->get_view(0, this->size());
     }
 
-    std::span<const std::string> ScrollbackBuffer::get_view_to_last(const std::size_t max_rows) const
+    std::string_view ScrollbackBuffer::at(const std::size_t row_i) const
     {
-        if (this->size() > max_rows) [[likely]]
+        return this->get_view(row_i, 1)[0];
+    }
+
+    std::string_view ScrollbackBuffer::line_at(const std::size_t row_i) const
+    {
+        if (row_i >= this->size()) [[unlikely]]
+        {
+            return std::string_view();
+        }
+
+        const std::uint64_t row = this->lines[this->first_line_i].first_row + row_i;
+        std::size_t ring_i = this->first_line_i;
+
+        for (std::size_t line_i = 0; line_i < this->n_lines; line_i++)
+        {
+            const ScrollbackBufferLine& line = this->lines[ring_i];
+
+            if (row < line.first_row + this->get_n_rows_of_line(line))
+            {
+                return std::string_view(this->arena.data() + line.offset, line.length);
+            }
+
+            ring_i = (ring_i + 1 < this->max_n_lines ? ring_i + 1 : 0);
+        }
+
+        return std::string_view();
+    }
+
+    std::vector<std::size_t> ScrollbackBuffer::find(const std::string_view needle) const
+    {
+        std::vector<std::size_t> row_indices;
+
+        if (this->n_lines == 0)
+        {
+            return row_indices;
+        }
+
+        const std::uint64_t first_row = this->lines[this->first_line_i].first_row;
+        std::size_t ring_i = this->first_line_i;
+
+        // Whole lines are searched, so matches which cross a wrap are found too.
+        for (std::size_t line_i = 0; line_i < this->n_lines; line_i++)
+        {
+            const ScrollbackBufferLine& line = this->lines[ring_i];
+
+            if (std::string_view(this->arena.data() + line.offset, line.length).find(needle) != std::string_view::npos)
+            {
+                row_indices.emplace_back(static_cast<std::size_t>(line.first_row - first_row));
+            }
+
+            ring_i = (ring_i + 1 < this->max_n_lines ? ring_i + 1 : 0);
+        }
+
+        return row_indices;
+    }
+
+    bool ScrollbackBuffer::set_history_file(const std::string& history_filename)
+    {
+        this->history_file.close();
+        this->history_file.clear();
+        this->history_file.open(history_filename, std::ios::out | std::ios::app | std::ios::binary);
+
+        if (!this->history_file.is_open()) [[unlikely]]
         {
-            const auto top_of_view_it = this->data().cend() - max_rows;
-            return std::span(top_of_view_it, this->data().cend());
+            std::cerr << "ERROR: `ScrollbackBuffer::set_history_file`: opening " << history_filename << " failed!\n";
+            this->history_filename.clear();
+            return false;
         }
 
-        return std::span(this->data().cbegin(), this->data().cend());
+        this->history_filename = history_filename;
+        return true;
     }
 
-    const std::string& ScrollbackBuffer::at(const std::size_t line_i) const
+    const std::string& ScrollbackBuffer::get_history_filename() const
     {
-        return *(this->buffer.begin() + line_i);
+        return this->history_filename;
+    }
+
+    std::vector<std::string> ScrollbackBuffer::search_history(const std::string_view needle, const std::size_t max_n_results)
+    {
+        std::vector<std::string> results;
+
+        if (!this->history_file.is_open() || needle.empty() || max_n_results == 0)
+        {
+            return results;
+        }
+
+        this->history_file.flush();
+
+        const file::MemoryMappedFile mapped_history(this->history_filename);
+
+        if (!mapped_history.get_is_valid())
+        {
+            // The history is empty.
+            return results;
+        }
+
+        const char* const history_begin = mapped_history.data();
+        const char* const history_end = mapped_history.data() + mapped_history.size();
+        const std::boyer_moore_horspool_searcher searcher(needle.begin(), needle.end());
+
+        for (const char* it = history_begin; results.size() < max_n_results; )
+        {
+            const char* const match = std::search(it, history_end, searcher);
+
+            if (match == history_end)
+            {
+                break;
+            }
+
+            const std::string_view text_before_match(history_begin, static_cast<std::size_t>(match - history_begin));
+            const std::size_t previous_newline_i = text_before_match.rfind('\n');
+            const char* const line_begin = (previous_newline_i == std::string_view::npos ? history_begin : history_begin + previous_newline_i + 1);
+            const char* line_end = std::find(match + needle.size(), history_end, '\n');
+
+            results.emplace_back(line_begin, line_end);
+
+            // Continue from the next line, so that each line is reported only once.
+            it = (line_end < history_end ? line_end + 1 : history_end);
+        }
+
+        return results;
     }
 
     bool ScrollbackBuffer::get_is_active_in_buffer() const
@@ -178,7 +349,8 @@ namespace yli::console
 
     std::size_t ScrollbackBuffer::size() const
     {
-        return this->buffer.size();
+        // Number of display rows.
+        return (this->n_lines > 0 ? static_cast<std::size_t>(this->next_row - this->lines[this->first_line_i].first_row) : 0);
     }
 
     bool ScrollbackBuffer::empty() const
@@ -186,9 +358,9 @@ namespace yli::console
         return this->size() == 0;
     }
 
-    const std::vector<std::string>& ScrollbackBuffer::data() const
+    std::size_t ScrollbackBuffer::get_max_n_lines() const
     {
-        return this->buffer;
+        return this->max_n_lines;
     }
 
     std::uint32_t ScrollbackBuffer::get_n_columns() const
@@ -245,7 +417,6 @@ namespace yli::console
                 this->buffer_index = 0;
             }
 
-            this->buffer_it = this->buffer.begin() + this->buffer_index;
             return true;
         }
 
@@ -262,7 +433,6 @@ namespace yli::console
             this->buffer_index + this->n_rows < this->size()) [[likely]]
         {
             this->buffer_index += this->n_rows;
-            this->buffer_it = this->buffer.begin() + this->buffer_index;
             return true;
         }
 
@@ -271,8 +441,10 @@ namespace yli::console
 
     void ScrollbackBuffer::clear()
     {
-        this->buffer.clear();
-        this->buffer_it = this->buffer.end();
+        this->first_line_i = 0;
+        this->n_lines = 0;
+        this->next_position = 0;
+        this->next_row = 0;
         this->buffer_index = std::numeric_limits<std::size_t>::max();
     }
 }
@@ -20,15 +20,28 @@
 
 #include "scrollback_buffer_iterator.hpp"
 #include "scrollback_buffer_const_iterator.hpp"
+#include "scrollback_buffer_view.hpp"
 #include "console_state.hpp"
 
 // Include standard headers
-#include <cstddef>  // std::size_t
-#include <cstdint>  // std::uint32_t
-#include <limits>   // std::numeric_limits
-#include <span>     // std::span
-#include <string>   // std::string
-#include <vector>   // std::vector
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t, std::uint64_t
+#include <fstream>     // std::ofstream
+#include <limits>      // std::numeric_limits
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+// `ScrollbackBuffer` is a ring buffer of at most `max_n_lines` logical lines.
+// The text of the lines is stored in one contiguous byte arena of
+// `max_n_lines * n_columns` bytes, so appending a line does not allocate.
+// When the line ring or the arena is full, the oldest lines are evicted.
+//
+// Lines are wrapped to display rows of `n_columns` characters only when
+// they are viewed. Indices, `size` and paging are in display rows.
+//
+// Optionally all lines are also appended to a history file, so that
+// the full history can be searched even after eviction.
 
 namespace yli::console
 {
@@ -39,17 +52,24 @@ namespace yli::console
         typedef ScrollbackBufferIterator iterator;
         typedef ScrollbackBufferConstIterator const_iterator;
 
-        explicit ScrollbackBuffer(const std::uint32_t n_columns = 80, const std::uint32_t n_rows = 24);
+        static constexpr std::size_t default_max_n_lines = 10000;
+
+        explicit ScrollbackBuffer(
+                const std::uint32_t n_columns = 80,
+                const std::uint32_t n_rows = 24,
+                const std::size_t max_n_lines = default_max_n_lines);
 
         ScrollbackBuffer(const ScrollbackBuffer&) = delete;
 
         ScrollbackBuffer& operator=(const ScrollbackBuffer&) = delete;
 
-        void add_to_buffer(const std::string& text);
+        // Adds `text` as one line, unless it is empty.
+        void add_to_buffer(std::string_view text);
 
-        void emplace_back(const std::string& text);
+        // Adds `text` as one line, truncated to the size of the arena.
+        void emplace_back(std::string_view text);
 
-        void push_back(const std::string& text);
+        void push_back(std::string_view text);
 
         bool enter_buffer();
 
@@ -69,11 +89,28 @@ namespace yli::console
 
         void clear();
 
-        std::span<const std::string> get_view(std::size_t top_index, std::size_t max_rows) const;
+        ScrollbackBufferView get_view(std::size_t top_index, std::size_t max_rows) const;
+
+        ScrollbackBufferView get_view_to_last(std::size_t max_rows) const;
+
+        // Returns the display row `row_i`.
+        std::string_view at(std::size_t row_i) const;
+
+        // Returns the whole logical line which contains the display row `row_i`.
+        std::string_view line_at(std::size_t row_i) const;
+
+        // Returns the first display rows of the lines in the buffer which contain `needle`.
+        std::vector<std::size_t> find(std::string_view needle) const;
 
-        std::span<const std::string> get_view_to_last(std::size_t max_rows) const;
+        // All lines added after this are also appended to `history_filename`.
+        // Returns `false` if the file could not be opened.
+        bool set_history_file(const std::string& history_filename);
 
-        const std::string& at(std::size_t line_i) const;
+        const std::string& get_history_filename() const;
+
+        // Searches the whole history file for lines which contain `needle`.
+        // Returns at most `max_n_results` lines, oldest first.
+        std::vector<std::string> search_history(std::string_view needle, std::size_t max_n_results);
 
         bool get_is_active_in_buffer() const;
 
@@ -81,7 +118,7 @@ namespace yli::console
 
         bool empty() const;
 
-        const std::vector<std::string>& data() const;
+        std::size_t get_max_n_lines() const;
 
         std::uint32_t get_n_columns() const;
 
@@ -94,30 +131,44 @@ namespace yli::console
         // Iterator functions.
         iterator begin()
         {
-            return iterator(this->buffer.begin());
+            return iterator(this->get_view(0, this->size()), 0);
         }
 
         iterator end()
         {
-            return iterator(this->buffer.end());
+            return iterator(this->get_view(0, this->size()), this->size());
         }
 
         const_iterator cbegin() const
         {
-            return const_iterator(this->buffer.cbegin());
+            return const_iterator(this->get_view(0, this->size()), 0);
         }
 
         const_iterator cend() const
         {
-            return const_iterator(this->buffer.cend());
+            return const_iterator(this->get_view(0, this->size()), this->size());
         }
 
     private:
-        std::vector<std::string> buffer;
+        void evict_first_line();
+
+        std::size_t get_n_rows_of_line(const ScrollbackBufferLine& line) const;
+
         const std::uint32_t n_columns;  // Number of columns must be at least 1.
         const std::uint32_t n_rows;     // Number of rows must be at least 1.
-        std::vector<std::string>::iterator buffer_it { this->buffer.end() };
+        const std::size_t max_n_lines;  // Maximum number of lines must be at least 1.
+
+        std::vector<char> arena;
+        std::vector<ScrollbackBufferLine> lines; // Ring of `max_n_lines` lines.
+        std::size_t first_line_i    { 0 };       // Ring index of the oldest line.
+        std::size_t n_lines         { 0 };
+        std::uint64_t next_position { 0 };       // Position of the next line, see `ScrollbackBufferLine`.
+        std::uint64_t next_row      { 0 };       // First display row of the next line.
+
         std::size_t buffer_index { std::numeric_limits<std::size_t>::max() };
+
+        std::string history_filename;
+        std::ofstream history_file;
     };
 }
 
@@ -18,11 +18,12 @@
 #ifndef YLIKUUTIO_CONSOLE_SCROLLBACK_BUFFER_CONST_ITERATOR_HPP_INCLUDED
 #define YLIKUUTIO_CONSOLE_SCROLLBACK_BUFFER_CONST_ITERATOR_HPP_INCLUDED
 
+#include "scrollback_buffer_view.hpp"
+
 // Include standard headers
-#include <cstddef>  // std::ptrdiff_t
-#include <iterator> // std::bidirectional_iterator_tag
-#include <string>   // std::string
-#include <vector>   // std::vector
+#include <cstddef>     // std::ptrdiff_t, std::size_t
+#include <iterator>    // std::bidirectional_iterator_tag
+#include <string_view> // std::string_view
 
 namespace yli::console
 {
@@ -30,13 +31,14 @@ namespace yli::console
     {
     public:
         using iterator_category = std::bidirectional_iterator_tag;
-        using value_type = std::string;
+        using value_type = std::string_view;
         using difference_type = std::ptrdiff_t;
-        using pointer = const std::string*;
-        using reference = const std::string&;
+        using pointer = const std::string_view*;
+        using reference = std::string_view;
 
-        explicit ScrollbackBufferConstIterator(const std::vector<std::string>::const_iterator it)
-            : it { it }
+        ScrollbackBufferConstIterator(const ScrollbackBufferView view, const std::size_t line_i)
+            : view { view },
+            line_i { line_i }
         { }
 
         // copy constructor.
@@ -45,55 +47,49 @@ namespace yli::console
         // copy assignment.
         ScrollbackBufferConstIterator& operator=(const ScrollbackBufferConstIterator&) = default;
 
-        // assignment of `std::vector` const_iterator.
-        ScrollbackBufferConstIterator& operator=(const std::vector<std::string>::const_iterator it)
-        {
-            this->it = it;
-            return *this;
-        }
-
         ~ScrollbackBufferConstIterator() = default;
 
         bool operator==(const ScrollbackBufferConstIterator& other_it) const noexcept
         {
-            return this->it == other_it.it;
+            return this->line_i == other_it.line_i;
         }
 
         bool operator!=(const ScrollbackBufferConstIterator& other_it) const = default;
 
         ScrollbackBufferConstIterator& operator++()
         {
-            ++this->it;
+            ++this->line_i;
             return *this;
         }
 
         ScrollbackBufferConstIterator& operator--()
         {
-            --this->it;
+            --this->line_i;
             return *this;
         }
 
-        ScrollbackBufferConstIterator& operator++(int)
+        ScrollbackBufferConstIterator operator++(int)
         {
-            ScrollbackBufferConstIterator& temp { *this };
-            ++this->it;
+            ScrollbackBufferConstIterator temp { *this };
+            ++this->line_i;
             return temp;
         }
 
-        ScrollbackBufferConstIterator& operator--(int)
+        ScrollbackBufferConstIterator operator--(int)
         {
-            ScrollbackBufferConstIterator& temp { *this };
-            --this->it;
+            ScrollbackBufferConstIterator temp { *this };
+            --this->line_i;
             return temp;
         }
 
-        std::string operator*() const
+        std::string_view operator*() const
         {
-            return *(this->it);
+            return this->view[this->line_i];
         }
 
     private:
-        std::vector<std::string>::const_iterator it;
+        ScrollbackBufferView view;
+        std::size_t line_i;
     };
 }
 
@@ -0,0 +1,123 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_CONSOLE_SCROLLBACK_BUFFER_VIEW_HPP_INCLUDED
+#define YLIKUUTIO_CONSOLE_SCROLLBACK_BUFFER_VIEW_HPP_INCLUDED
+
+// Include standard headers
+#include <algorithm>   // std::min
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <string_view> // std::string_view
+
+namespace yli::console
+{
+    // Location of one logical line in the text arena of `ScrollbackBuffer`.
+    struct ScrollbackBufferLine
+    {
+        std::uint64_t position  { 0 }; // Monotonically increasing, counts also skipped bytes at the end of the arena.
+        std::uint64_t first_row { 0 }; // Monotonically increasing number of the first display row of the line.
+        std::size_t offset      { 0 }; // `position` wrapped to the arena.
+        std::size_t length      { 0 };
+    };
+
+    // A non-owning view of consecutive display rows of `ScrollbackBuffer`.
+    // Logical lines are wrapped into rows of at most `n_columns` characters here.
+    // The view is invalidated by any modification of the `ScrollbackBuffer`.
+    class ScrollbackBufferView
+    {
+    public:
+        ScrollbackBufferView() = default;
+
+        ScrollbackBufferView(
+                const char* const arena,
+                const ScrollbackBufferLine* const lines,
+                const std::size_t line_capacity,
+                const std::size_t first_line_i,
+                const std::size_t n_lines,
+                const std::size_t n_columns,
+                const std::uint64_t first_row,
+                const std::size_t n_rows)
+            : arena { arena },
+            lines { lines },
+            line_capacity { line_capacity },
+            first_line_i { first_line_i },
+            n_lines { n_lines },
+            n_columns { n_columns },
+            first_row { first_row },
+            n_rows { n_rows }
+        {
+        }
+
+        std::string_view operator[](const std::size_t row_i) const
+        {
+            const std::uint64_t row = this->first_row + row_i;
+
+            // Binary search for the last logical line which begins at or before `row`.
+            std::size_t low = 0;
+            std::size_t high = this->n_lines;
+
+            while (high - low > 1)
+            {
+                const std::size_t middle = low + (high - low) / 2;
+
+                if (this->get_line(middle).first_row <= row)
+                {
+                    low = middle;
+                }
+                else
+                {
+                    high = middle;
+                }
+            }
+
+            const ScrollbackBufferLine& line = this->get_line(low);
+            const std::size_t offset_in_line = static_cast<std::size_t>(row - line.first_row) * this->n_columns;
+            return std::string_view(this->arena + line.offset + offset_in_line, std::min(this->n_columns, line.length - offset_in_line));
+        }
+
+        std::size_t size() const
+        {
+            return this->n_rows;
+        }
+
+        bool empty() const
+        {
+            return this->n_rows == 0;
+        }
+
+    private:
+        const ScrollbackBufferLine& get_line(const std::size_t line_i) const
+        {
+            // `line_i` < `n_lines` <= `line_capacity`, so one subtraction is enough to wrap around.
+            std::size_t ring_i = this->first_line_i + line_i;
+            ring_i = (ring_i < this->line_capacity ? ring_i : ring_i - this->line_capacity);
+            return this->lines[ring_i];
+        }
+
+        const char* arena                 { nullptr };
+        const ScrollbackBufferLine* lines { nullptr };
+        std::size_t line_capacity         { 0 };
+        std::size_t first_line_i          { 0 };
+        std::size_t n_lines               { 0 };
+        std::size_t n_columns             { 1 };
+        std::uint64_t first_row           { 0 };
+        std::size_t n_rows                { 0 };
+    };
+}
+
+#endif
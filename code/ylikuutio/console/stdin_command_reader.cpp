@@ -0,0 +1,160 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "stdin_command_reader.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <poll.h>   // poll, pollfd, POLLIN
+#include <unistd.h> // read, STDIN_FILENO
+#endif
+
+// Include standard headers
+#include <array>    // std::array
+#include <atomic>   // std::atomic
+#include <cstddef>  // std::size_t
+#include <iterator> // std::make_move_iterator
+#include <mutex>    // std::mutex, std::scoped_lock
+#include <string>   // std::string
+#include <thread>   // std::thread
+#include <utility>  // std::move
+#include <vector>   // std::vector
+
+namespace yli::console
+{
+    // How long the reader thread waits for input before checking for `stop`.
+    static constexpr int poll_timeout_in_milliseconds = 100;
+
+    StdinCommandReader::StdinCommandReader()
+        : reader_thread(&StdinCommandReader::read_lines, this)
+    {
+    }
+
+    StdinCommandReader::~StdinCommandReader()
+    {
+        this->stop();
+    }
+
+    void StdinCommandReader::stop()
+    {
+        this->is_stop_requested = true;
+
+        if (this->reader_thread.joinable())
+        {
+            this->reader_thread.join();
+        }
+    }
+
+    void StdinCommandReader::read_lines()
+    {
+        std::string partial_line;
+        std::array<char, 4096> buffer;
+
+        while (!this->is_stop_requested)
+        {
+#ifdef _WIN32
+            HANDLE stdin_handle = GetStdHandle(STD_INPUT_HANDLE);
+
+            if (WaitForSingleObject(stdin_handle, poll_timeout_in_milliseconds) != WAIT_OBJECT_0)
+            {
+                continue;
+            }
+
+            DWORD n_bytes_read = 0;
+
+            if (!ReadFile(stdin_handle, buffer.data(), static_cast<DWORD>(buffer.size()), &n_bytes_read, nullptr))
+            {
+                n_bytes_read = 0;
+            }
+#else
+            pollfd stdin_pollfd { STDIN_FILENO, POLLIN, 0 };
+
+            if (poll(&stdin_pollfd, 1, poll_timeout_in_milliseconds) <= 0)
+            {
+                continue;
+            }
+
+            const ssize_t n_bytes_read = read(STDIN_FILENO, buffer.data(), buffer.size());
+
+            if (n_bytes_read < 0)
+            {
+                continue;
+            }
+#endif
+
+            if (n_bytes_read == 0)
+            {
+                // End of file. A last line without a newline is still a command.
+                std::scoped_lock lock(this->mutex);
+
+                if (!partial_line.empty())
+                {
+                    this->lines.emplace_back(std::move(partial_line));
+                }
+
+                this->is_eof = true;
+                return;
+            }
+
+            std::vector<std::string> complete_lines;
+
+            for (std::size_t i = 0; i < static_cast<std::size_t>(n_bytes_read); i++)
+            {
+                if (buffer[i] == '\n')
+                {
+                    if (!partial_line.empty() && partial_line.back() == '\r')
+                    {
+                        partial_line.pop_back();
+                    }
+
+                    complete_lines.emplace_back(std::move(partial_line));
+                    partial_line.clear();
+                }
+                else
+                {
+                    partial_line.push_back(buffer[i]);
+                }
+            }
+
+            if (!complete_lines.empty())
+            {
+                std::scoped_lock lock(this->mutex);
+                this->lines.insert(
+                        this->lines.end(),
+                        std::make_move_iterator(complete_lines.begin()),
+                        std::make_move_iterator(complete_lines.end()));
+            }
+        }
+    }
+
+    std::vector<std::string> StdinCommandReader::take_lines()
+    {
+        std::scoped_lock lock(this->mutex);
+        std::vector<std::string> taken_lines(
+                std::make_move_iterator(this->lines.begin()),
+                std::make_move_iterator(this->lines.end()));
+        this->lines.clear();
+        return taken_lines;
+    }
+
+    bool StdinCommandReader::get_is_eof() const
+    {
+        std::scoped_lock lock(this->mutex);
+        return this->is_eof;
+    }
+}
@@ -0,0 +1,69 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_CONSOLE_STDIN_COMMAND_READER_HPP_INCLUDED
+#define YLIKUUTIO_CONSOLE_STDIN_COMMAND_READER_HPP_INCLUDED
+
+// Include standard headers
+#include <atomic>  // std::atomic
+#include <deque>   // std::deque
+#include <mutex>   // std::mutex
+#include <string>  // std::string
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+// `StdinCommandReader` reads console commands from the standard input
+// in a background thread, so that a headless `Universe` can be driven
+// from a terminal or a pipe without polling the main loop.
+//
+// The reader thread waits for input with a timeout instead of blocking
+// in `std::getline`, so that `stop` (and the destructor) can join it.
+// Only one reader should exist at a time, as they would share stdin.
+
+namespace yli::console
+{
+    class StdinCommandReader final
+    {
+        public:
+            StdinCommandReader();
+
+            StdinCommandReader(const StdinCommandReader&) = delete;            // Delete copy constructor.
+            StdinCommandReader& operator=(const StdinCommandReader&) = delete; // Delete copy assignment.
+
+            ~StdinCommandReader();
+
+            // Stops and joins the reader thread. Safe to call more than once.
+            void stop();
+
+            // Returns the lines read since the last call, in order.
+            std::vector<std::string> take_lines();
+
+            // `true` after end of file has been reached on stdin.
+            bool get_is_eof() const;
+
+        private:
+            void read_lines();
+
+            mutable std::mutex mutex;
+            std::deque<std::string> lines;
+            bool is_eof { false };
+            std::atomic<bool> is_stop_requested { false };
+            std::thread reader_thread;
+    };
+}
+
+#endif
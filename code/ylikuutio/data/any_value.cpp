@@ -21,7 +21,7 @@
 #endif
 
 #include "any_value.hpp"
-#include "variant_templates.hpp"
+#include "datatype.hpp"
 #include "code/ylikuutio/ontology/entity.hpp"
 #include "code/ylikuutio/ontology/movable.hpp"
 #include "code/ylikuutio/ontology/universe.hpp"
@@ -39,6 +39,7 @@
 #include "code/ylikuutio/ontology/text_3d.hpp"
 #include "code/ylikuutio/ontology/console.hpp"
 #include "code/ylikuutio/ontology/compute_task.hpp"
+#include "code/ylikuutio/string/convert_string_to_value.hpp"
 #include "code/ylikuutio/string/ylikuutio_string.hpp"
 
 // Include GLM
@@ -48,1169 +49,809 @@
 #endif
 
 // Include standard headers
-#include <cstdint>    // std::int8_t, std::int16_t, std::int32_t, std::int64_t, std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
-#include <functional> // std::reference_wrapper
-#include <ios>        // std::boolalpha, std::dec, std::fixed, std::hex
-#include <optional>   // std::optional
-#include <sstream>    // std::stringstream
-#include <string>     // std::string
-#include <stdexcept>  // std::runtime_error
-#include <variant>    // std::holds_alternative, std::monostate
-#include <vector>     // std::vector
+#include <charconv>    // std::chars_format, std::to_chars, std::to_chars_result
+#include <cstdint>     // std::int8_t, std::int16_t, std::int32_t, std::int64_t, std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t, std::uintptr_t
+#include <cstring>     // std::memcpy
+#include <optional>    // std::optional
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <stdexcept>   // std::runtime_error
+#include <type_traits> // std::is_base_of_v, std::is_floating_point_v, std::type_identity
+#include <utility>     // std::move
+#include <vector>      // std::vector
 
 namespace yli::data
 {
-    bool AnyValue::operator==(const AnyValue& rhs) const noexcept
+    static const char* get_datatype_name(const Datatype datatype, const bool is_const) noexcept
     {
-        if (this->get_datatype() != rhs.get_datatype())
+        switch (datatype)
         {
-            return false;
+            // Fundamental types.
+            case Datatype::BOOL:                return "bool";
+            case Datatype::CHAR:                return "char";
+            case Datatype::FLOAT:               return "float";
+            case Datatype::DOUBLE:              return "double";
+            case Datatype::INT32_T:             return "std::int32_t";
+            case Datatype::UINT32_T:            return "std::uint32_t";
+            case Datatype::INT64_T:             return "std::int64_t";
+            case Datatype::UINT64_T:            return "std::uint64_t";
+            // Strings.
+            case Datatype::STD_STRING:          return "std::string";
+            // Variable-size vectors.
+            case Datatype::STD_VECTOR_INT8_T:   return "std::vector<std::int8_t>";
+            case Datatype::STD_VECTOR_UINT8_T:  return "std::vector<std::uint8_t>";
+            case Datatype::STD_VECTOR_INT16_T:  return "std::vector<std::int16_t>";
+            case Datatype::STD_VECTOR_UINT16_T: return "std::vector<std::uint16_t>";
+            case Datatype::STD_VECTOR_INT32_T:  return "std::vector<std::int32_t>";
+            case Datatype::STD_VECTOR_UINT32_T: return "std::vector<std::uint32_t>";
+            case Datatype::STD_VECTOR_INT64_T:  return "std::vector<std::int64_t>";
+            case Datatype::STD_VECTOR_UINT64_T: return "std::vector<std::uint64_t>";
+            case Datatype::STD_VECTOR_FLOAT:    return "std::vector<float>";
+            // Fixed-size vectors.
+            case Datatype::GLM_VEC3:            return "glm::vec3";
+            case Datatype::GLM_VEC4:            return "glm::vec4";
+            // Ontology.
+            case Datatype::ENTITY:              return "yli::ontology::Entity&";
+            case Datatype::MOVABLE:             return is_const ? "const yli::ontology::Movable&" : "yli::ontology::Movable&";
+            case Datatype::UNIVERSE:            return "yli::ontology::Universe&";
+            case Datatype::ECOSYSTEM:           return "yli::ontology::Ecosystem&";
+            case Datatype::SCENE:               return "yli::ontology::Scene&";
+            case Datatype::PIPELINE:            return "yli::ontology::Pipeline&";
+            case Datatype::MATERIAL:            return "yli::ontology::Material&";
+            case Datatype::SPECIES:             return "yli::ontology::Species&";
+            case Datatype::OBJECT:              return "yli::ontology::Object&";
+            case Datatype::SYMBIOSIS:           return "yli::ontology::Symbiosis&";
+            case Datatype::HOLOBIONT:           return "yli::ontology::Holobiont&";
+            case Datatype::FONT_2D:             return "yli::ontology::Font2d&";
+            case Datatype::TEXT_2D:             return "yli::ontology::Text2d&";
+            case Datatype::VECTOR_FONT:         return "yli::ontology::VectorFont&";
+            case Datatype::TEXT_3D:             return "yli::ontology::Text3d&";
+            case Datatype::CONSOLE:             return "yli::ontology::Console&";
+            case Datatype::COMPUTE_TASK:        return "yli::ontology::ComputeTask&";
+            default:
+                return "ERROR: `AnyValue::get_datatype`: no datatype string defined for this datatype!";
         }
+    }
 
-        // Fundamental types.
-        if (std::holds_alternative<bool>(this->data) && std::holds_alternative<bool>(rhs.data))
-        {
-            return std::get<bool>(this->data) == std::get<bool>(rhs.data);
-        }
-        if (std::holds_alternative<char>(this->data) && std::holds_alternative<char>(rhs.data))
-        {
-            return std::get<char>(this->data) == std::get<char>(rhs.data);
-        }
-        if (std::holds_alternative<float>(this->data) && std::holds_alternative<float>(rhs.data))
-        {
-            return std::get<float>(this->data) == std::get<float>(rhs.data);
-        }
-        if (std::holds_alternative<double>(this->data) && std::holds_alternative<double>(rhs.data))
-        {
-            return std::get<double>(this->data) == std::get<double>(rhs.data);
-        }
-        if (std::holds_alternative<std::int32_t>(this->data) && std::holds_alternative<std::int32_t>(rhs.data))
-        {
-            return std::get<std::int32_t>(this->data) == std::get<std::int32_t>(rhs.data);
-        }
-        if (std::holds_alternative<std::uint32_t>(this->data) && std::holds_alternative<std::uint32_t>(rhs.data))
-        {
-            return std::get<std::uint32_t>(this->data) == std::get<std::uint32_t>(rhs.data);
-        }
-        if (std::holds_alternative<std::int64_t>(this->data) && std::holds_alternative<std::int64_t>(rhs.data))
-        {
-            return std::get<std::int64_t>(this->data) == std::get<std::int64_t>(rhs.data);
-        }
-        if (std::holds_alternative<std::uint64_t>(this->data) && std::holds_alternative<std::uint64_t>(rhs.data))
-        {
-            return std::get<std::uint64_t>(this->data) == std::get<std::uint64_t>(rhs.data);
-        }
-        // Strings.
-        if (std::holds_alternative<std::reference_wrapper<std::string>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<std::string>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<std::string>>(this->data).get() ==
-                   std::get<std::reference_wrapper<std::string>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<const std::string>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<const std::string>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<const std::string>>(this->data).get() ==
-                   std::get<std::reference_wrapper<const std::string>>(rhs.data).get();
-        }
-        // Variable-size vectors.
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::int8_t>>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<std::vector<std::int8_t>>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<std::vector<std::int8_t>>>(this->data).get() ==
-                   std::get<std::reference_wrapper<std::vector<std::int8_t>>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint8_t>>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<std::vector<std::uint8_t>>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<std::vector<std::uint8_t>>>(this->data).get() ==
-                   std::get<std::reference_wrapper<std::vector<std::uint8_t>>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::int16_t>>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<std::vector<std::int16_t>>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<std::vector<std::int16_t>>>(this->data).get() ==
-                   std::get<std::reference_wrapper<std::vector<std::int16_t>>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint16_t>>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<std::vector<std::uint16_t>>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<std::vector<std::uint16_t>>>(this->data).get() ==
-                   std::get<std::reference_wrapper<std::vector<std::uint16_t>>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::int32_t>>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<std::vector<std::int32_t>>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<std::vector<std::int32_t>>>(this->data).get() ==
-                   std::get<std::reference_wrapper<std::vector<std::int32_t>>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint32_t>>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<std::vector<std::uint32_t>>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<std::vector<std::uint32_t>>>(this->data).get() ==
-                   std::get<std::reference_wrapper<std::vector<std::uint32_t>>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::int64_t>>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<std::vector<std::int64_t>>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<std::vector<std::int64_t>>>(this->data).get() ==
-                   std::get<std::reference_wrapper<std::vector<std::int64_t>>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint64_t>>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<std::vector<std::uint64_t>>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<std::vector<std::uint64_t>>>(this->data).get() ==
-                   std::get<std::reference_wrapper<std::vector<std::uint64_t>>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<float>>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<std::vector<float>>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<std::vector<float>>>(this->data).get() ==
-                   std::get<std::reference_wrapper<std::vector<float>>>(rhs.data).get();
-        }
-        // Fixed-size vectors.
-        if (std::holds_alternative<std::reference_wrapper<glm::vec3>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<glm::vec3>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<glm::vec3>>(this->data).get() ==
-                   std::get<std::reference_wrapper<glm::vec3>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<const glm::vec3>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<const glm::vec3>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<const glm::vec3>>(this->data).get() ==
-                   std::get<std::reference_wrapper<const glm::vec3>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<glm::vec4>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<glm::vec4>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<glm::vec4>>(this->data).get() ==
-                   std::get<std::reference_wrapper<glm::vec4>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<const glm::vec4>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<const glm::vec4>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<const glm::vec4>>(this->data).get() ==
-                   std::get<std::reference_wrapper<const glm::vec4>>(rhs.data).get();
-        }
-        // Ontology.
-        if (std::holds_alternative<std::reference_wrapper<ontology::Entity>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Entity>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Entity>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Entity>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Movable>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Movable>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Movable>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Movable>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<const ontology::Movable>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<const ontology::Movable>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<const ontology::Movable>>(this->data).get() ==
-                   std::get<std::reference_wrapper<const ontology::Movable>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Universe>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Universe>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Universe>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Universe>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Ecosystem>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Ecosystem>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Ecosystem>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Ecosystem>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Scene>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Scene>>(rhs.data))
+    // Calls `f` with `std::type_identity` of the `std::vector` type of `datatype`.
+    template<typename F>
+        static decltype(auto) with_vector_type(const Datatype datatype, F&& f)
         {
-            return std::get<std::reference_wrapper<ontology::Scene>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Scene>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Pipeline>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Pipeline>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Pipeline>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Pipeline>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Material>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Material>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Material>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Material>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Species>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Species>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Species>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Species>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Object>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Object>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Object>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Object>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Symbiosis>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Symbiosis>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Symbiosis>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Symbiosis>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Holobiont>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Holobiont>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Holobiont>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Holobiont>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Font2d>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Font2d>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Font2d>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Font2d>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Text2d>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Text2d>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Text2d>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Text2d>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::VectorFont>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::VectorFont>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::VectorFont>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::VectorFont>>(rhs.data).get();
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Text3d>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Text3d>>(rhs.data))
-        {
-            return std::get<std::reference_wrapper<ontology::Text3d>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Text3d>>(rhs.data).get();
+            switch (datatype)
+            {
+                case Datatype::STD_VECTOR_INT8_T:   return f(std::type_identity<std::vector<std::int8_t>> {});
+                case Datatype::STD_VECTOR_UINT8_T:  return f(std::type_identity<std::vector<std::uint8_t>> {});
+                case Datatype::STD_VECTOR_INT16_T:  return f(std::type_identity<std::vector<std::int16_t>> {});
+                case Datatype::STD_VECTOR_UINT16_T: return f(std::type_identity<std::vector<std::uint16_t>> {});
+                case Datatype::STD_VECTOR_INT32_T:  return f(std::type_identity<std::vector<std::int32_t>> {});
+                case Datatype::STD_VECTOR_UINT32_T: return f(std::type_identity<std::vector<std::uint32_t>> {});
+                case Datatype::STD_VECTOR_INT64_T:  return f(std::type_identity<std::vector<std::int64_t>> {});
+                case Datatype::STD_VECTOR_UINT64_T: return f(std::type_identity<std::vector<std::uint64_t>> {});
+                default:                            return f(std::type_identity<std::vector<float>> {});
+            }
         }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Console>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::Console>>(rhs.data))
+
+    // Calls `f` with `std::type_identity` of the Entity type of `datatype`.
+    template<typename F>
+        static decltype(auto) with_entity_type(const Datatype datatype, F&& f)
         {
-            return std::get<std::reference_wrapper<ontology::Console>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::Console>>(rhs.data).get();
+            switch (datatype)
+            {
+                case Datatype::MOVABLE:      return f(std::type_identity<ontology::Movable> {});
+                case Datatype::UNIVERSE:     return f(std::type_identity<ontology::Universe> {});
+                case Datatype::ECOSYSTEM:    return f(std::type_identity<ontology::Ecosystem> {});
+                case Datatype::SCENE:        return f(std::type_identity<ontology::Scene> {});
+                case Datatype::PIPELINE:     return f(std::type_identity<ontology::Pipeline> {});
+                case Datatype::MATERIAL:     return f(std::type_identity<ontology::Material> {});
+                case Datatype::SPECIES:      return f(std::type_identity<ontology::Species> {});
+                case Datatype::OBJECT:       return f(std::type_identity<ontology::Object> {});
+                case Datatype::SYMBIOSIS:    return f(std::type_identity<ontology::Symbiosis> {});
+                case Datatype::HOLOBIONT:    return f(std::type_identity<ontology::Holobiont> {});
+                case Datatype::FONT_2D:      return f(std::type_identity<ontology::Font2d> {});
+                case Datatype::TEXT_2D:      return f(std::type_identity<ontology::Text2d> {});
+                case Datatype::VECTOR_FONT:  return f(std::type_identity<ontology::VectorFont> {});
+                case Datatype::TEXT_3D:      return f(std::type_identity<ontology::Text3d> {});
+                case Datatype::CONSOLE:      return f(std::type_identity<ontology::Console> {});
+                case Datatype::COMPUTE_TASK: return f(std::type_identity<ontology::ComputeTask> {});
+                default:                     return f(std::type_identity<ontology::Entity> {});
+            }
         }
-        if (std::holds_alternative<std::reference_wrapper<ontology::ComputeTask>>(this->data) &&
-            std::holds_alternative<std::reference_wrapper<ontology::ComputeTask>>(rhs.data))
+
+    template<typename T>
+        static std::string number_to_string(const T value)
         {
-            return std::get<std::reference_wrapper<ontology::ComputeTask>>(this->data).get() ==
-                   std::get<std::reference_wrapper<ontology::ComputeTask>>(rhs.data).get();
+            // Large enough for the largest `double` in fixed notation with 6 decimals.
+            char buffer[320];
+            std::to_chars_result result;
+
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 6);
+            }
+            else
+            {
+                result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            }
+
+            return std::string(buffer, result.ptr);
         }
 
-        return false;
+    static std::string address_to_string(const void* const address)
+    {
+        char buffer[2 * sizeof(std::uintptr_t)];
+        const std::to_chars_result result = std::to_chars(
+                buffer,
+                buffer + sizeof(buffer),
+                reinterpret_cast<std::uintptr_t>(address),
+                16);
+        return std::string(buffer, result.ptr);
     }
 
-    std::string AnyValue::get_datatype() const noexcept
+    // Returns the `Movable` of an Entity of type `datatype`, or `nullptr` if the Entity is not a `Movable`.
+    static ontology::Movable* get_movable_pointer(const Datatype datatype, ontology::Entity* const entity)
     {
-        // Fundamental types.
-        if (std::holds_alternative<bool>(this->data))
-        {
-            return "bool";
-        }
-        if (std::holds_alternative<char>(this->data))
-        {
-            return "char";
-        }
-        if (std::holds_alternative<float>(this->data))
-        {
-            return "float";
-        }
-        if (std::holds_alternative<double>(this->data))
-        {
-            return "double";
-        }
-        if (std::holds_alternative<std::int32_t>(this->data))
-        {
-            return "std::int32_t";
-        }
-        if (std::holds_alternative<std::uint32_t>(this->data))
-        {
-            return "std::uint32_t";
-        }
-        if (std::holds_alternative<std::int64_t>(this->data))
-        {
-            return "std::int64_t";
-        }
-        if (std::holds_alternative<std::uint64_t>(this->data))
-        {
-            return "std::uint64_t";
-        }
-        // Strings.
-        if (std::holds_alternative<std::reference_wrapper<std::string>>(this->data))
-        {
-            return "std::string&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<const std::string>>(this->data))
-        {
-            return "const std::string&";
-        }
-        // Variable-size vectors.
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::int8_t>>>(this->data))
-        {
-            return "std::vector<std::int8_t>&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint8_t>>>(this->data))
-        {
-            return "std::vector<std::uint8_t>&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::int16_t>>>(this->data))
-        {
-            return "std::vector<std::int16_t>&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint16_t>>>(this->data))
-        {
-            return "std::vector<std::uint16_t>&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::int32_t>>>(this->data))
-        {
-            return "std::vector<std::int32_t>&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint32_t>>>(this->data))
+        if (datatype < Datatype::ENTITY)
         {
-            return "std::vector<std::uint32_t>&";
+            return nullptr;
         }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::int64_t>>>(this->data))
-        {
-            return "std::vector<std::int64_t>&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint64_t>>>(this->data))
-        {
-            return "std::vector<std::uint64_t>&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<std::vector<float>>>(this->data))
-        {
-            return "std::vector<float>&";
-        }
-        // Fixed-size vectors.
-        if (std::holds_alternative<std::reference_wrapper<glm::vec3>>(this->data))
-        {
-            return "glm::vec3&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<const glm::vec3>>(this->data))
-        {
-            return "const glm::vec3&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<glm::vec4>>(this->data))
-        {
-            return "glm::vec4&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<const glm::vec4>>(this->data))
-        {
-            return "const glm::vec4&";
-        }
-        // Ontology.
-        if (std::holds_alternative<std::reference_wrapper<ontology::Entity>>(this->data))
-        {
-            return "yli::ontology::Entity&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Movable>>(this->data))
-        {
-            return "yli::ontology::Movable&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<const ontology::Movable>>(this->data))
-        {
-            return "const yli::ontology::Movable&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Universe>>(this->data))
-        {
-            return "yli::ontology::Universe&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Ecosystem>>(this->data))
-        {
-            return "yli::ontology::Ecosystem&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Scene>>(this->data))
-        {
-            return "yli::ontology::Scene&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Pipeline>>(this->data))
-        {
-            return "yli::ontology::Pipeline&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Material>>(this->data))
-        {
-            return "yli::ontology::Material&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Species>>(this->data))
-        {
-            return "yli::ontology::Species&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Object>>(this->data))
-        {
-            return "yli::ontology::Object&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Symbiosis>>(this->data))
-        {
-            return "yli::ontology::Symbiosis&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Holobiont>>(this->data))
-        {
-            return "yli::ontology::Holobiont&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Font2d>>(this->data))
-        {
-            return "yli::ontology::Font2d&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Text2d>>(this->data))
-        {
-            return "yli::ontology::Text2d&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::VectorFont>>(this->data))
-        {
-            return "yli::ontology::VectorFont&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Text3d>>(this->data))
-        {
-            return "yli::ontology::Text3d&";
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Console>>(this->data))
+
+        return with_entity_type(
+                datatype,
+                [entity](const auto type) -> ontology::Movable*
+                {
+                    using T = typename decltype(type)::type;
+
+                    if constexpr (std::is_base_of_v<ontology::Movable, T>)
+                    {
+                        return static_cast<T*>(entity);
+                    }
+
+                    return nullptr;
+                });
+    }
+
+    bool AnyValue::operator==(const AnyValue& rhs) const noexcept
+    {
+        if (this->datatype != rhs.datatype || this->is_const != rhs.is_const)
         {
-            return "yli::ontology::Console&";
+            return false;
         }
-        if (std::holds_alternative<std::reference_wrapper<ontology::ComputeTask>>(this->data))
+
+        switch (this->datatype)
         {
-            return "yli::ontology::ComputeTask&";
-        }
+            case Datatype::UNKNOWN:
+                return false;
+            case Datatype::BOOL:
+                return this->payload.bool_value == rhs.payload.bool_value;
+            case Datatype::CHAR:
+                return this->payload.char_value == rhs.payload.char_value;
+            case Datatype::FLOAT:
+                return this->payload.float_value == rhs.payload.float_value;
+            case Datatype::DOUBLE:
+                return this->payload.double_value == rhs.payload.double_value;
+            case Datatype::INT32_T:
+                return this->payload.int32_t_value == rhs.payload.int32_t_value;
+            case Datatype::UINT32_T:
+                return this->payload.uint32_t_value == rhs.payload.uint32_t_value;
+            case Datatype::INT64_T:
+                return this->payload.int64_t_value == rhs.payload.int64_t_value;
+            case Datatype::UINT64_T:
+                return this->payload.uint64_t_value == rhs.payload.uint64_t_value;
+            case Datatype::STD_STRING:
+                return this->get_string_view() == rhs.get_string_view();
+            case Datatype::GLM_VEC3:
+                return this->payload.glm_vec3_value == rhs.payload.glm_vec3_value;
+            case Datatype::GLM_VEC4:
+                return this->payload.glm_vec4_value == rhs.payload.glm_vec4_value;
+            default:
+                break;
+        }
+
+        if (this->datatype >= Datatype::ENTITY)
+        {
+            return this->payload.entity == rhs.payload.entity;
+        }
+
+        return with_vector_type(
+                this->datatype,
+                [this, &rhs](const auto type) -> bool
+                {
+                    using T = typename decltype(type)::type;
+                    return *static_cast<const T*>(this->payload.vector) == *static_cast<const T*>(rhs.payload.vector);
+                });
+    }
 
-        return "ERROR: `AnyValue::get_datatype`: no datatype string defined for this datatype!";
+    std::string AnyValue::get_datatype() const noexcept
+    {
+        return get_datatype_name(this->datatype, this->is_const);
     }
 
     std::string AnyValue::get_string() const
     {
-        std::stringstream any_value_stringstream;
-        any_value_stringstream.precision(6); // 6 decimals in floating point output.
+        switch (this->datatype)
+        {
+            case Datatype::UNKNOWN:
+                return "ERROR: `AnyValue::get_string`: no string defined for this datatype!";
+            case Datatype::BOOL:
+                return this->payload.bool_value ? "true" : "false";
+            case Datatype::CHAR:
+                return std::string(1, this->payload.char_value);
+            case Datatype::FLOAT:
+                return number_to_string(this->payload.float_value);
+            case Datatype::DOUBLE:
+                return number_to_string(this->payload.double_value);
+            case Datatype::INT32_T:
+                return number_to_string(this->payload.int32_t_value);
+            case Datatype::UINT32_T:
+                return number_to_string(this->payload.uint32_t_value);
+            case Datatype::INT64_T:
+                return number_to_string(this->payload.int64_t_value);
+            case Datatype::UINT64_T:
+                return number_to_string(this->payload.uint64_t_value);
+            case Datatype::STD_STRING:
+                return std::string(this->get_string_view());
+            case Datatype::GLM_VEC3:
+                {
+                    const glm::vec3& vector = this->payload.glm_vec3_value;
+                    return "{ " + number_to_string(vector.x) +
+                        ", " + number_to_string(vector.y) +
+                        ", " + number_to_string(vector.z) +
+                        " }";
+                }
+            case Datatype::GLM_VEC4:
+                {
+                    const glm::vec4& vector = this->payload.glm_vec4_value;
+                    return "{ " + number_to_string(vector.x) +
+                        ", " + number_to_string(vector.y) +
+                        ", " + number_to_string(vector.z) +
+                        ", " + number_to_string(vector.w) +
+                        " }";
+                }
+            default:
+                break;
+        }
+
+        if (this->datatype >= Datatype::ENTITY)
+        {
+            return with_entity_type(
+                    this->datatype,
+                    [this](const auto type) -> std::string
+                    {
+                        using T = typename decltype(type)::type;
+                        return address_to_string(static_cast<const T*>(this->payload.entity));
+                    });
+        }
+
+        // Variable-size vectors are printed as their datatype.
+        return get_datatype_name(this->datatype, this->is_const);
+    }
 
-        // Fundamental types.
-        if (std::holds_alternative<bool>(this->data))
-        {
-            any_value_stringstream << std::boolalpha << std::get<bool>(this->data);
-        }
-        else if (std::holds_alternative<char>(this->data))
-        {
-            any_value_stringstream << std::get<char>(this->data);
-        }
-        else if (std::holds_alternative<float>(this->data))
-        {
-            any_value_stringstream << std::fixed << std::get<float>(this->data);
-        }
-        else if (std::holds_alternative<double>(this->data))
-        {
-            any_value_stringstream << std::fixed << std::get<double>(this->data);
-        }
-        else if (std::holds_alternative<std::int32_t>(this->data))
-        {
-            // in Linux `int` is 32 bits, `long` is 64 bits, `long long` is also 64 bits.
-            // in Windows `int` is 32 bits, `long` is also 32 bits, `long long` is 64 bits.
-            any_value_stringstream << std::get<std::int32_t>(this->data);
-        }
-        else if (std::holds_alternative<std::uint32_t>(this->data))
-        {
-            // in Linux `int` is 32 bits, `long` is 64 bits, `long long` is also 64 bits.
-            // in Windows `int` is 32 bits, `long` is also 32 bits, `long long` is 64 bits.
-            any_value_stringstream << std::get<std::uint32_t>(this->data);
-        }
-        else if (std::holds_alternative<std::int64_t>(this->data))
-        {
-            any_value_stringstream << std::get<std::int64_t>(this->data);
-        }
-        else if (std::holds_alternative<std::uint64_t>(this->data))
-        {
-            any_value_stringstream << std::get<std::uint64_t>(this->data);
-        }
-        // Strings.
-        else if (std::holds_alternative<std::reference_wrapper<std::string>>(this->data))
-        {
-            any_value_stringstream << std::get<std::reference_wrapper<std::string>>(this->data).get();
-        }
-        else if (std::holds_alternative<std::reference_wrapper<const std::string>>(this->data))
-        {
-            any_value_stringstream << std::get<std::reference_wrapper<const std::string>>(this->data).get();
-        }
-        // Variable-size vectors.
-        else if (std::holds_alternative<std::reference_wrapper<std::vector<std::int8_t>>>(this->data))
-        {
-            any_value_stringstream << "std::vector<std::int8_t>&";
-        }
-        else if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint8_t>>>(this->data))
-        {
-            any_value_stringstream << "std::vector<std::uint8_t>&";
-        }
-        else if (std::holds_alternative<std::reference_wrapper<std::vector<std::int16_t>>>(this->data))
-        {
-            any_value_stringstream << "std::vector<std::int16_t>&";
-        }
-        else if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint16_t>>>(this->data))
-        {
-            any_value_stringstream << "std::vector<std::uint16_t>&";
-        }
-        else if (std::holds_alternative<std::reference_wrapper<std::vector<std::int32_t>>>(this->data))
+    std::string_view AnyValue::get_string_view() const
+    {
+        if (this->datatype != Datatype::STD_STRING)
         {
-            any_value_stringstream << "std::vector<std::int32_t>&";
+            throw std::runtime_error("Requested `std::string_view` for `AnyValue` that didn't hold `std::string`!");
         }
-        else if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint32_t>>>(this->data))
+
+        if (this->is_long_string)
         {
-            any_value_stringstream << "std::vector<std::uint32_t>&";
+            return *this->payload.long_string;
         }
-        else if (std::holds_alternative<std::reference_wrapper<std::vector<std::int64_t>>>(this->data))
+
+        return std::string_view(this->payload.small_string, this->small_string_size);
+    }
+
+    ontology::Entity& AnyValue::get_entity_ref() const
+    {
+        if (this->is_const)
         {
-            any_value_stringstream << "std::vector<std::int64_t>&";
+            throw std::runtime_error("Requested `Entity&` for `AnyValue` that holds `const Movable` reference!");
         }
-        else if (std::holds_alternative<std::reference_wrapper<std::vector<std::uint64_t>>>(this->data))
+
+        if (this->datatype < Datatype::ENTITY) [[unlikely]]
         {
-            any_value_stringstream << "std::vector<std::uint64_t>&";
+            throw std::runtime_error("Requested `Entity&` for `AnyValue` that didn't hold `Entity` reference!");
         }
-        else if (std::holds_alternative<std::reference_wrapper<std::vector<float>>>(this->data))
+
+        return *this->payload.entity;
+    }
+
+    const yli::ontology::Entity& AnyValue::get_const_entity_ref() const
+    {
+        if (this->datatype < Datatype::ENTITY) [[unlikely]]
         {
-            any_value_stringstream << "std::vector<float>&";
+            throw std::runtime_error("Requested `const Entity&` for `AnyValue` that didn't hold `Entity` reference!");
         }
-        // Fixed-size vectors.
-        else if (std::holds_alternative<std::reference_wrapper<glm::vec3>>(this->data))
-        {
-            const glm::vec3& cartesian_coordinates = std::get<std::reference_wrapper<glm::vec3>>(this->data);
 
-            any_value_stringstream << std::fixed << "{ " << cartesian_coordinates.x
-                    << ", " << cartesian_coordinates.y
-                    << ", " << cartesian_coordinates.z
-                    << " }";
-        }
-        else if (std::holds_alternative<std::reference_wrapper<const glm::vec3>>(this->data))
-        {
-            const glm::vec3& cartesian_coordinates = std::get<std::reference_wrapper<const glm::vec3>>(this->data);
+        return *this->payload.entity;
+    }
 
-            any_value_stringstream << std::fixed << "{ " << cartesian_coordinates.x
-                    << ", " << cartesian_coordinates.y
-                    << ", " << cartesian_coordinates.z
-                    << " }";
-        }
-        else if (std::holds_alternative<std::reference_wrapper<glm::vec4>>(this->data))
-        {
-            const glm::vec4& cartesian_coordinates = std::get<std::reference_wrapper<glm::vec4>>(this->data);
+    bool AnyValue::has_movable_ref() const
+    {
+        return !this->is_const && get_movable_pointer(this->datatype, this->payload.entity) != nullptr;
+    }
 
-            any_value_stringstream << std::fixed << "{ " << cartesian_coordinates.x
-                    << ", " << cartesian_coordinates.y
-                    << ", " << cartesian_coordinates.z
-                    << ", " << cartesian_coordinates.w
-                    << " }";
-        }
-        else if (std::holds_alternative<std::reference_wrapper<const glm::vec4>>(this->data))
-        {
-            const glm::vec4& cartesian_coordinates = std::get<std::reference_wrapper<const glm::vec4>>(this->data);
+    bool AnyValue::has_const_movable_ref() const
+    {
+        return get_movable_pointer(this->datatype, this->payload.entity) != nullptr;
+    }
 
-            any_value_stringstream << std::fixed << "{ " << cartesian_coordinates.x
-                    << ", " << cartesian_coordinates.y
-                    << ", " << cartesian_coordinates.z
-                    << ", " << cartesian_coordinates.w
-                    << " }";
-        }
-        // Ontology.
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Entity>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Entity>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Movable>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Movable>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<const ontology::Movable>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<const
-                ontology::Movable>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Universe>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Universe>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Ecosystem>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Ecosystem>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Scene>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Scene>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Pipeline>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Pipeline>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Material>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Material>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Species>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Species>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Object>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Object>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Symbiosis>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Symbiosis>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Holobiont>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Holobiont>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Font2d>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Font2d>>(this->data)) << std::dec;
-        }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Text2d>>(this->data))
+    ontology::Movable& AnyValue::get_movable_ref() const
+    {
+        if (this->is_const)
         {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Text2d>>(this->data)) << std::dec;
+            throw std::runtime_error("Requested `Movable&` for `AnyValue` that holds `const Movable` reference!");
         }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::VectorFont>>(this->data))
+
+        return const_cast<ontology::Movable&>(this->get_const_movable_ref());
+    }
+
+    const ontology::Movable& AnyValue::get_const_movable_ref() const
+    {
+        const ontology::Movable* const movable = get_movable_pointer(this->datatype, this->payload.entity);
+
+        if (movable == nullptr) [[unlikely]]
         {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::VectorFont>>(this->data)) << std::dec;
+            throw std::runtime_error("Requested `Movable&` for `AnyValue` that didn't hold `Movable` reference!");
         }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Text3d>>(this->data))
+
+        return *movable;
+    }
+
+    template<typename T>
+        static bool set_new_number(T& value, const std::string& value_string)
         {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Text3d>>(this->data)) << std::dec;
+            const std::optional<T> new_value = yli::string::convert_string_to_number<T>(value_string);
+
+            if (!new_value)
+            {
+                return false;
+            }
+
+            value = *new_value;
+            return true;
         }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::Console>>(this->data))
-        {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::Console>>(this->data)) << std::dec;
+
+    bool AnyValue::set_new_value(const std::string& value_string)
+    {
+        switch (this->datatype)
+        {
+            case Datatype::BOOL:
+                if (value_string == "true") // Ylikuutio is case sensitive!
+                {
+                    this->payload.bool_value = true;
+                    return true;
+                }
+                if (value_string == "false") // Ylikuutio is case sensitive!
+                {
+                    this->payload.bool_value = false;
+                    return true;
+                }
+                return false;
+            case Datatype::CHAR:
+                if (value_string.size() == 1)
+                {
+                    this->payload.char_value = value_string[0];
+                    return true;
+                }
+                return false;
+            case Datatype::FLOAT:
+                return yli::string::check_if_float_string<char>(value_string) &&
+                    set_new_number(this->payload.float_value, value_string);
+            case Datatype::DOUBLE:
+                return yli::string::check_if_double_string<char>(value_string) &&
+                    set_new_number(this->payload.double_value, value_string);
+            case Datatype::INT32_T:
+                return yli::string::check_if_signed_integer_string<char>(value_string) &&
+                    set_new_number(this->payload.int32_t_value, value_string);
+            case Datatype::UINT32_T:
+                return yli::string::check_if_unsigned_integer_string<char>(value_string) &&
+                    set_new_number(this->payload.uint32_t_value, value_string);
+            case Datatype::INT64_T:
+                return yli::string::check_if_signed_integer_string<char>(value_string) &&
+                    set_new_number(this->payload.int64_t_value, value_string);
+            case Datatype::UINT64_T:
+                return yli::string::check_if_unsigned_integer_string<char>(value_string) &&
+                    set_new_number(this->payload.uint64_t_value, value_string);
+            case Datatype::STD_STRING:
+                this->release();
+                this->set_string(value_string);
+                return true;
+            default:
+                return false;
         }
-        else if (std::holds_alternative<std::reference_wrapper<ontology::ComputeTask>>(this->data))
+    }
+
+    void AnyValue::set_string(const std::string_view string)
+    {
+        // The caller must have released any owned heap data.
+        this->datatype = Datatype::STD_STRING;
+
+        if (string.size() <= small_string_capacity)
         {
-            any_value_stringstream << std::hex << reinterpret_cast<std::uint64_t>(&std::get<std::reference_wrapper<
-                ontology::ComputeTask>>(this->data)) << std::dec;
+            std::memcpy(this->payload.small_string, string.data(), string.size());
+            this->small_string_size = static_cast<std::uint8_t>(string.size());
+            this->is_long_string = false;
         }
         else
         {
-            return "ERROR: `AnyValue::get_string`: no string defined for this datatype!";
+            this->payload.long_string = new std::string(string);
+            this->small_string_size = 0;
+            this->is_long_string = true;
         }
+    }
 
-        return any_value_stringstream.str();
+    void AnyValue::set_entity(const Datatype entity_datatype, ontology::Entity* const entity, const bool is_const_entity) noexcept
+    {
+        this->datatype = entity_datatype;
+        this->payload.entity = entity;
+        this->is_const = is_const_entity;
     }
 
-    const std::string& AnyValue::get_const_std_string_ref() const
+    void AnyValue::copy_heap_data_from(const AnyValue& other)
     {
-        if (std::holds_alternative<std::reference_wrapper<std::string>>(this->data))
-        {
-            return std::get<std::reference_wrapper<std::string>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<const std::string>>(this->data))
+        if (other.is_long_string)
         {
-            return std::get<std::reference_wrapper<const std::string>>(this->data);
+            this->payload.long_string = new std::string(*other.payload.long_string);
+            return;
         }
 
-        throw std::runtime_error(
-            "Requested `const std::string&` for `AnyValue` that didn't hold `std::string` or `const std::string` reference!");
+        this->payload.vector = with_vector_type(
+                other.datatype,
+                [&other](const auto type) -> void*
+                {
+                    using T = typename decltype(type)::type;
+                    return new T(*static_cast<const T*>(other.payload.vector));
+                });
     }
 
-    ontology::Entity& AnyValue::get_entity_ref() const
+    void AnyValue::release() noexcept
     {
-        if (std::holds_alternative<std::reference_wrapper<ontology::Entity>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Entity>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Universe>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Universe>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Movable>>(this->data))
+        if (this->is_long_string)
         {
-            return std::get<std::reference_wrapper<ontology::Movable>>(this->data);
+            delete this->payload.long_string;
         }
-        if (std::holds_alternative<std::reference_wrapper<const ontology::Movable>>(this->data))
+        else if (this->owns_heap_data())
         {
-            throw std::runtime_error("Requested `Entity&` for `AnyValue` that holds `const Movable` reference!");
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Ecosystem>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Ecosystem>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Scene>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Scene>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Pipeline>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Pipeline>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Material>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Material>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Species>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Species>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Object>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Object>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Symbiosis>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Symbiosis>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Holobiont>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Holobiont>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Font2d>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Font2d>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Text2d>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Text2d>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::VectorFont>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::VectorFont>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Text3d>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Text3d>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Console>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Console>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::ComputeTask>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::ComputeTask>>(this->data);
+            with_vector_type(
+                    this->datatype,
+                    [this](const auto type)
+                    {
+                        using T = typename decltype(type)::type;
+                        delete static_cast<T*>(this->payload.vector);
+                    });
         }
 
-        throw std::runtime_error("Requested `Entity&` for `AnyValue` that didn't hold `Entity` reference!");
+        this->datatype = Datatype::UNKNOWN;
+        this->is_long_string = false;
     }
 
-    const yli::ontology::Entity& AnyValue::get_const_entity_ref() const
+    AnyValue& AnyValue::operator=(const AnyValue& other)
     {
-        if (std::holds_alternative<std::reference_wrapper<const ontology::Movable>>(this->data))
+        if (this != &other)
         {
-            return std::get<std::reference_wrapper<const ontology::Movable>>(this->data);
+            AnyValue copy(other);
+            *this = std::move(copy);
         }
 
-        return this->get_entity_ref();
+        return *this;
     }
 
-    bool AnyValue::has_movable_ref() const
+    AnyValue& AnyValue::operator=(AnyValue&& other) noexcept
     {
-        if (std::holds_alternative<std::reference_wrapper<ontology::Movable>>(this->data))
-        {
-            return true;
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Object>>(this->data))
-        {
-            return true;
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Holobiont>>(this->data))
+        if (this != &other)
         {
-            return true;
+            this->release();
+            this->payload = other.payload;
+            this->datatype = other.datatype;
+            this->small_string_size = other.small_string_size;
+            this->is_long_string = other.is_long_string;
+            this->is_const = other.is_const;
+
+            other.datatype = Datatype::UNKNOWN;
+            other.is_long_string = false;
         }
 
-        return false;
+        return *this;
     }
 
-    bool AnyValue::has_const_movable_ref() const
+    AnyValue::AnyValue(const AnyValue& original)
+        : payload(original.payload),
+        datatype(original.datatype),
+        small_string_size(original.small_string_size),
+        is_long_string(original.is_long_string),
+        is_const(original.is_const)
     {
-        if (std::holds_alternative<std::reference_wrapper<const ontology::Movable>>(this->data))
+        // copy constructor.
+        // Only strings that don't fit in the payload and variable-size vectors need more than the payload copy.
+
+        if (this->owns_heap_data())
         {
-            return true;
+            this->copy_heap_data_from(original);
         }
-
-        return this->has_movable_ref();
     }
 
-    ontology::Movable& AnyValue::get_movable_ref() const
+    AnyValue::AnyValue(AnyValue&& original) noexcept
+        : payload(original.payload),
+        datatype(original.datatype),
+        small_string_size(original.small_string_size),
+        is_long_string(original.is_long_string),
+        is_const(original.is_const)
     {
-        if (std::holds_alternative<std::reference_wrapper<ontology::Movable>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Movable>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<const ontology::Movable>>(this->data))
-        {
-            throw std::runtime_error("Requested `Movable&` for `AnyValue` that holds `const Movable` reference!");
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Object>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Object>>(this->data);
-        }
-        if (std::holds_alternative<std::reference_wrapper<ontology::Holobiont>>(this->data))
-        {
-            return std::get<std::reference_wrapper<ontology::Holobiont>>(this->data);
-        }
+        // move constructor.
 
-        throw std::runtime_error("Requested `Movable&` for `AnyValue` that didn't hold `Movable` reference!");
+        original.datatype = Datatype::UNKNOWN;
+        original.is_long_string = false;
     }
 
-    const ontology::Movable& AnyValue::get_const_movable_ref() const
+    AnyValue::AnyValue(const std::optional<AnyValue> original)
     {
-        if (std::holds_alternative<std::reference_wrapper<const ontology::Movable>>(this->data))
+        // constructor for optional `AnyValue`.
+
+        if (original)
         {
-            return std::get<std::reference_wrapper<const ontology::Movable>>(this->data);
+            *this = *original;
         }
-
-        return this->get_movable_ref();
     }
 
-    bool AnyValue::set_new_value(const std::string& value_string)
+    AnyValue::AnyValue(const std::string& type, const std::string& value_string)
     {
-        std::stringstream value_stringstream;
-
-        if (std::holds_alternative<bool>(this->data))
+        if (type == "bool")
         {
-            if (value_string == "true") // Ylikuutio is case sensitive!
-            {
-                this->data = true;
-                return true;
-            }
-            if (value_string == "false") // Ylikuutio is case sensitive!
-            {
-                this->data = false;
-                return true;
-            }
-            return false;
+            this->datatype = Datatype::BOOL;
         }
-        if (std::holds_alternative<char>(this->data))
+        else if (type == "char")
         {
-            if (value_string.size() == 1)
-            {
-                this->data = value_string[0];
-                return true;
-            }
-            return false;
+            this->datatype = Datatype::CHAR;
         }
-        if (std::holds_alternative<float>(this->data))
+        else if (type == "float")
         {
-            if (!yli::string::check_if_float_string<char>(value_string))
-            {
-                return false;
-            }
-
-            float float_value;
-            value_stringstream << value_string;
-            value_stringstream >> float_value;
-            this->data = float_value;
-            return true;
+            this->datatype = Datatype::FLOAT;
         }
-        if (std::holds_alternative<double>(this->data))
+        else if (type == "double")
         {
-            if (!yli::string::check_if_double_string<char>(value_string))
-            {
-                return false;
-            }
-
-            double double_value;
-            value_stringstream << value_string;
-            value_stringstream >> double_value;
-            this->data = double_value;
-            return true;
+            this->datatype = Datatype::DOUBLE;
         }
-        if (std::holds_alternative<std::int32_t>(this->data))
+        else if (type == "std::int32_t")
         {
-            if (!yli::string::check_if_signed_integer_string<char>(value_string))
-            {
-                return false;
-            }
-
-            std::int32_t int32_t_value;
-            value_stringstream << value_string;
-            value_stringstream >> int32_t_value;
-            this->data = int32_t_value;
-            return true;
+            this->datatype = Datatype::INT32_T;
         }
-        if (std::holds_alternative<std::uint32_t>(this->data))
+        else if (type == "std::uint32_t")
         {
-            if (!yli::string::check_if_unsigned_integer_string<char>(value_string))
-            {
-                return false;
-            }
-
-            std::uint32_t uint32_t_value;
-            value_stringstream << value_string;
-            value_stringstream >> uint32_t_value;
-            this->data = uint32_t_value;
-            return true;
+            this->datatype = Datatype::UINT32_T;
         }
-        if (std::holds_alternative<std::int64_t>(this->data))
+        else if (type == "std::string")
         {
-            if (!yli::string::check_if_signed_integer_string<char>(value_string))
-            {
-                return false;
-            }
-
-            std::int64_t int64_t_value;
-            value_stringstream << value_string;
-            value_stringstream >> int64_t_value;
-            this->data = int64_t_value;
-            return true;
+            this->set_string(value_string);
+            return;
         }
-        if (std::holds_alternative<std::uint64_t>(this->data))
+        else
         {
-            if (!yli::string::check_if_unsigned_integer_string<char>(value_string))
-            {
-                return false;
-            }
-
-            std::uint64_t uint64_t_value;
-            value_stringstream << value_string;
-            value_stringstream >> uint64_t_value;
-            this->data = uint64_t_value;
-            return true;
+            return;
         }
 
-        return false;
-    }
-
-    AnyValue::AnyValue(const std::optional<AnyValue> original)
-    {
-        // constructor for optional `AnyValue`.
-
-        if (original)
+        if (!this->set_new_value(value_string))
         {
-            this->data = (*original).data;
+            this->datatype = Datatype::UNKNOWN;
         }
     }
 
-    AnyValue::AnyValue(const std::string& type, const std::string& value_string)
-        : data(get_variant<
-            std::monostate,
-            // Fundamental types.
-            bool,
-            char,
-            float,
-            double,
-            std::int32_t,
-            std::uint32_t,
-            std::int64_t,
-            std::uint64_t,
-            // Strings.
-            std::reference_wrapper<std::string>,
-            std::reference_wrapper<const std::string>,
-            // Variable-size vectors.
-            std::reference_wrapper<std::vector<std::int8_t>>,
-            std::reference_wrapper<std::vector<std::uint8_t>>,
-            std::reference_wrapper<std::vector<std::int16_t>>,
-            std::reference_wrapper<std::vector<std::uint16_t>>,
-            std::reference_wrapper<std::vector<std::int32_t>>,
-            std::reference_wrapper<std::vector<std::uint32_t>>,
-            std::reference_wrapper<std::vector<std::int64_t>>,
-            std::reference_wrapper<std::vector<std::uint64_t>>,
-            std::reference_wrapper<std::vector<float>>,
-            // Fixed-size vectors.
-            std::reference_wrapper<glm::vec3>,
-            std::reference_wrapper<const glm::vec3>,
-            std::reference_wrapper<glm::vec4>,
-            std::reference_wrapper<const glm::vec4>,
-            // Ontology.
-            std::reference_wrapper<ontology::Entity>,
-            std::reference_wrapper<ontology::Movable>,
-            std::reference_wrapper<const ontology::Movable>,
-            std::reference_wrapper<ontology::Universe>,
-            std::reference_wrapper<ontology::Ecosystem>,
-            std::reference_wrapper<ontology::Scene>,
-            std::reference_wrapper<ontology::Pipeline>,
-            std::reference_wrapper<ontology::Material>,
-            std::reference_wrapper<ontology::Species>,
-            std::reference_wrapper<ontology::Object>,
-            std::reference_wrapper<ontology::Symbiosis>,
-            std::reference_wrapper<ontology::Holobiont>,
-            std::reference_wrapper<ontology::Font2d>,
-            std::reference_wrapper<ontology::Text2d>,
-            std::reference_wrapper<ontology::VectorFont>,
-            std::reference_wrapper<ontology::Text3d>,
-            std::reference_wrapper<ontology::Console>,
-            std::reference_wrapper<ontology::ComputeTask>>(type, value_string))
-    { }
-
     // Fundamental types.
 
     AnyValue::AnyValue(const bool bool_value)
-        : data(bool_value)
-    { }
+        : datatype(Datatype::BOOL)
+    {
+        this->payload.bool_value = bool_value;
+    }
 
     AnyValue::AnyValue(const char char_value)
-        : data(char_value)
-    { }
+        : datatype(Datatype::CHAR)
+    {
+        this->payload.char_value = char_value;
+    }
 
     AnyValue::AnyValue(const float float_value)
-        : data(float_value)
-    { }
+        : datatype(Datatype::FLOAT)
+    {
+        this->payload.float_value = float_value;
+    }
 
     AnyValue::AnyValue(const double double_value)
-        : data(double_value)
-    { }
+        : datatype(Datatype::DOUBLE)
+    {
+        this->payload.double_value = double_value;
+    }
 
     AnyValue::AnyValue(const std::int32_t int32_t_value)
-        : data(int32_t_value)
-    { }
+        : datatype(Datatype::INT32_T)
+    {
+        this->payload.int32_t_value = int32_t_value;
+    }
 
     AnyValue::AnyValue(const std::uint32_t uint32_t_value)
-        : data(uint32_t_value)
-    { }
+        : datatype(Datatype::UINT32_T)
+    {
+        this->payload.uint32_t_value = uint32_t_value;
+    }
 
     AnyValue::AnyValue(const std::int64_t int64_t_value)
-        : data(int64_t_value)
-    { }
+        : datatype(Datatype::INT64_T)
+    {
+        this->payload.int64_t_value = int64_t_value;
+    }
 
     AnyValue::AnyValue(const std::uint64_t uint64_t_value)
-        : data(uint64_t_value)
-    { }
+        : datatype(Datatype::UINT64_T)
+    {
+        this->payload.uint64_t_value = uint64_t_value;
+    }
 
     // Strings.
 
-    AnyValue::AnyValue(std::string& std_string_ref)
-        : data(std::reference_wrapper(std_string_ref))
-    { }
-
-    AnyValue::AnyValue(const std::string& const_std_string_ref)
-        : data(std::reference_wrapper(const_std_string_ref))
-    { }
+    AnyValue::AnyValue(const std::string& std_string)
+    {
+        this->set_string(std_string);
+    }
 
     // Variable-size vectors.
 
-    AnyValue::AnyValue(std::vector<std::int8_t>& std_vector_int8_t_ref)
-        : data(std::reference_wrapper(std_vector_int8_t_ref))
-    { }
+    AnyValue::AnyValue(const std::vector<std::int8_t>& std_vector_int8_t)
+        : datatype(Datatype::STD_VECTOR_INT8_T)
+    {
+        this->payload.vector = new std::vector<std::int8_t>(std_vector_int8_t);
+    }
 
-    AnyValue::AnyValue(std::vector<std::uint8_t>& std_vector_uint8_t_ref)
-        : data(std::reference_wrapper(std_vector_uint8_t_ref))
-    { }
+    AnyValue::AnyValue(const std::vector<std::uint8_t>& std_vector_uint8_t)
+        : datatype(Datatype::STD_VECTOR_UINT8_T)
+    {
+        this->payload.vector = new std::vector<std::uint8_t>(std_vector_uint8_t);
+    }
 
-    AnyValue::AnyValue(std::vector<std::int16_t>& std_vector_int16_t_ref)
-        : data(std::reference_wrapper(std_vector_int16_t_ref))
-    { }
+    AnyValue::AnyValue(const std::vector<std::int16_t>& std_vector_int16_t)
+        : datatype(Datatype::STD_VECTOR_INT16_T)
+    {
+        this->payload.vector = new std::vector<std::int16_t>(std_vector_int16_t);
+    }
 
-    AnyValue::AnyValue(std::vector<std::uint16_t>& std_vector_uint16_t_ref)
-        : data(std::reference_wrapper(std_vector_uint16_t_ref))
-    { }
+    AnyValue::AnyValue(const std::vector<std::uint16_t>& std_vector_uint16_t)
+        : datatype(Datatype::STD_VECTOR_UINT16_T)
+    {
+        this->payload.vector = new std::vector<std::uint16_t>(std_vector_uint16_t);
+    }
 
-    AnyValue::AnyValue(std::vector<std::int32_t>& std_vector_int32_t_ref)
-        : data(std::reference_wrapper(std_vector_int32_t_ref))
-    { }
+    AnyValue::AnyValue(const std::vector<std::int32_t>& std_vector_int32_t)
+        : datatype(Datatype::STD_VECTOR_INT32_T)
+    {
+        this->payload.vector = new std::vector<std::int32_t>(std_vector_int32_t);
+    }
 
-    AnyValue::AnyValue(std::vector<std::uint32_t>& std_vector_uint32_t_ref)
-        : data(std::reference_wrapper(std_vector_uint32_t_ref))
-    { }
+    AnyValue::AnyValue(const std::vector<std::uint32_t>& std_vector_uint32_t)
+        : datatype(Datatype::STD_VECTOR_UINT32_T)
+    {
+        this->payload.vector = new std::vector<std::uint32_t>(std_vector_uint32_t);
+    }
 
-    AnyValue::AnyValue(std::vector<std::int64_t>& std_vector_int64_t_ref)
-        : data(std::reference_wrapper(std_vector_int64_t_ref))
-    { }
+    AnyValue::AnyValue(const std::vector<std::int64_t>& std_vector_int64_t)
+        : datatype(Datatype::STD_VECTOR_INT64_T)
+    {
+        this->payload.vector = new std::vector<std::int64_t>(std_vector_int64_t);
+    }
 
-    AnyValue::AnyValue(std::vector<std::uint64_t>& std_vector_uint64_t_ref)
-        : data(std::reference_wrapper(std_vector_uint64_t_ref))
-    { }
+    AnyValue::AnyValue(const std::vector<std::uint64_t>& std_vector_uint64_t)
+        : datatype(Datatype::STD_VECTOR_UINT64_T)
+    {
+        this->payload.vector = new std::vector<std::uint64_t>(std_vector_uint64_t);
+    }
 
-    AnyValue::AnyValue(std::vector<float>& std_vector_float_ref)
-        : data(std::reference_wrapper(std_vector_float_ref))
-    { }
+    AnyValue::AnyValue(const std::vector<float>& std_vector_float)
+        : datatype(Datatype::STD_VECTOR_FLOAT)
+    {
+        this->payload.vector = new std::vector<float>(std_vector_float);
+    }
 
     // Fixed-size vectors.
 
-    AnyValue::AnyValue(glm::vec3& glm_vec3_ref)
-        : data(std::reference_wrapper(glm_vec3_ref))
-    { }
-
-    AnyValue::AnyValue(const glm::vec3& const_glm_vec3_ref)
-        : data(std::reference_wrapper(const_glm_vec3_ref))
-    { }
-
-    AnyValue::AnyValue(glm::vec4& glm_vec4_ref)
-        : data(std::reference_wrapper(glm_vec4_ref))
-    { }
+    AnyValue::AnyValue(const glm::vec3& glm_vec3)
+        : datatype(Datatype::GLM_VEC3)
+    {
+        this->payload.glm_vec3_value = glm_vec3;
+    }
 
-    AnyValue::AnyValue(const glm::vec4& const_glm_vec4_ref)
-        : data(std::reference_wrapper(const_glm_vec4_ref))
-    { }
+    AnyValue::AnyValue(const glm::vec4& glm_vec4)
+        : datatype(Datatype::GLM_VEC4)
+    {
+        this->payload.glm_vec4_value = glm_vec4;
+    }
 
     // Ontology.
-
     AnyValue::AnyValue(ontology::Entity& entity_ref)
-        : data(std::reference_wrapper(entity_ref))
-    { }
+    {
+        this->set_entity(Datatype::ENTITY, &entity_ref);
+    }
 
     AnyValue::AnyValue(ontology::Movable& movable_ref)
-        : data(std::reference_wrapper(movable_ref))
-    { }
+    {
+        this->set_entity(Datatype::MOVABLE, &movable_ref);
+    }
 
     AnyValue::AnyValue(const ontology::Movable& const_movable_ref)
-        : data(std::reference_wrapper(const_movable_ref))
-    { }
+    {
+        // The const-ness is kept in `is_const`.
+        this->set_entity(Datatype::MOVABLE, const_cast<ontology::Movable*>(&const_movable_ref), true);
+    }
 
     AnyValue::AnyValue(ontology::Universe& universe_ref)
-        : data(std::reference_wrapper(universe_ref))
-    { }
+    {
+        this->set_entity(Datatype::UNIVERSE, &universe_ref);
+    }
 
     AnyValue::AnyValue(ontology::Ecosystem& ecosystem_ref)
-        : data(std::reference_wrapper(ecosystem_ref))
-    { }
+    {
+        this->set_entity(Datatype::ECOSYSTEM, &ecosystem_ref);
+    }
 
     AnyValue::AnyValue(ontology::Scene& scene_ref)
-        : data(std::reference_wrapper(scene_ref))
-    { }
+    {
+        this->set_entity(Datatype::SCENE, &scene_ref);
+    }
 
     AnyValue::AnyValue(ontology::Pipeline& pipeline_ref)
-        : data(std::reference_wrapper(pipeline_ref))
-    { }
+    {
+        this->set_entity(Datatype::PIPELINE, &pipeline_ref);
+    }
 
     AnyValue::AnyValue(ontology::Material& material_ref)
-        : data(std::reference_wrapper(material_ref))
-    { }
+    {
+        this->set_entity(Datatype::MATERIAL, &material_ref);
+    }
 
     AnyValue::AnyValue(ontology::Species& species_ref)
-        : data(std::reference_wrapper(species_ref))
-    { }
+    {
+        this->set_entity(Datatype::SPECIES, &species_ref);
+    }
 
     AnyValue::AnyValue(ontology::Object& object_ref)
-        : data(std::reference_wrapper(object_ref))
-    { }
+    {
+        this->set_entity(Datatype::OBJECT, &object_ref);
+    }
 
     AnyValue::AnyValue(ontology::Symbiosis& symbiosis_ref)
-        : data(std::reference_wrapper(symbiosis_ref))
-    { }
+    {
+        this->set_entity(Datatype::SYMBIOSIS, &symbiosis_ref);
+    }
 
     AnyValue::AnyValue(ontology::Holobiont& holobiont_ref)
-        : data(std::reference_wrapper(holobiont_ref))
-    { }
+    {
+        this->set_entity(Datatype::HOLOBIONT, &holobiont_ref);
+    }
 
     AnyValue::AnyValue(ontology::Font2d& font_2d_ref)
-        : data(std::reference_wrapper(font_2d_ref))
-    { }
+    {
+        this->set_entity(Datatype::FONT_2D, &font_2d_ref);
+    }
 
     AnyValue::AnyValue(ontology::Text2d& text_2d_ref)
-        : data(std::reference_wrapper(text_2d_ref))
-    { }
+    {
+        this->set_entity(Datatype::TEXT_2D, &text_2d_ref);
+    }
 
     AnyValue::AnyValue(ontology::VectorFont& vector_font_ref)
-        : data(std::reference_wrapper(vector_font_ref))
-    { }
+    {
+        this->set_entity(Datatype::VECTOR_FONT, &vector_font_ref);
+    }
 
     AnyValue::AnyValue(ontology::Text3d& text_3d_ref)
-        : data(std::reference_wrapper(text_3d_ref))
-    { }
+    {
+        this->set_entity(Datatype::TEXT_3D, &text_3d_ref);
+    }
 
     AnyValue::AnyValue(ontology::Console& console_ref)
-        : data(std::reference_wrapper(console_ref))
-    { }
+    {
+        this->set_entity(Datatype::CONSOLE, &console_ref);
+    }
 
     AnyValue::AnyValue(ontology::ComputeTask& compute_task_ref)
-        : data(std::reference_wrapper(compute_task_ref))
-    { }
+    {
+        this->set_entity(Datatype::COMPUTE_TASK, &compute_task_ref);
+    }
 }
@@ -18,6 +18,8 @@
 #ifndef YLIKUUTIO_DATA_ANY_VALUE_HPP_INCLUDED
 #define YLIKUUTIO_DATA_ANY_VALUE_HPP_INCLUDED
 
+#include "datatype.hpp"
+
 // Include GLM
 #ifndef GLM_GLM_HPP_INCLUDED
 #define GLM_GLM_HPP_INCLUDED
@@ -25,12 +27,16 @@
 #endif
 
 // Include standard headers
-#include <cstdint>    // std::int8_t, std::int16_t, std::int32_t, std::int64_t, std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
-#include <functional> // std::reference_wrapper
-#include <optional>   // std::optional
-#include <string>     // std::string
-#include <variant>    // std::holds_alternative, std::monostate, std::variant
-#include <vector>     // std::vector
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int8_t, std::int16_t, std::int32_t, std::int64_t, std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
+#include <optional>    // std::optional
+#include <stdexcept>   // std::runtime_error
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <type_traits> // std::false_type, std::is_const_v, std::is_same_v, std::is_trivially_copyable_v, std::remove_const_t
+#include <utility>     // std::as_const
+#include <variant>     // std::monostate
+#include <vector>      // std::vector
 
 namespace yli::ontology
 {
@@ -55,20 +61,37 @@ namespace yli::ontology
 
 namespace yli::data
 {
+    // `AnyValue` is a `Datatype` tag and a 24-byte payload.
+    //
+    // Fundamental types and fixed-size vectors are stored inline, and
+    // copying them copies the payload and nothing else. Strings of up to
+    // `small_string_capacity` characters are stored inline too, longer
+    // strings and variable-size vectors are owned on the heap.
+    // `yli::ontology` Entities are never owned: they are stored as one
+    // `Entity*` and the tag tells their static type.
     class AnyValue final
     {
     public:
+        static constexpr std::size_t small_string_capacity = 24;
+
         bool operator==(const AnyValue& rhs) const noexcept;
 
         bool operator!=(const AnyValue& rhs) const = default;
 
-        AnyValue& operator=(const AnyValue& other) = default;
+        AnyValue& operator=(const AnyValue& other);
+
+        AnyValue& operator=(AnyValue&& other) noexcept;
+
+        Datatype get_type() const noexcept
+        {
+            return this->datatype;
+        }
 
         std::string get_datatype() const noexcept;
 
         std::string get_string() const;
 
-        const std::string& get_const_std_string_ref() const;
+        std::string_view get_string_view() const;
 
         ontology::Entity& get_entity_ref() const;
 
@@ -84,19 +107,51 @@ namespace yli::data
 
         bool set_new_value(const std::string& value_string);
 
+        // Returns `true` if the value is of type `T`.
+        // Entities are matched by their exact static type,
+        // `const ontology::Movable` only matches a const `Movable`.
+        template<typename T>
+            bool holds() const noexcept
+            {
+                return this->datatype == get_datatype_of<T>() && this->is_const == std::is_const_v<T>;
+            }
+
+        // Returns the value of type `T`, or throws if the value is not of type `T`.
+        // Strings are returned as `std::string_view`, Entities as references,
+        // so an Entity type `T` must be complete at the call site.
+        template<typename T>
+            decltype(auto) get() const;
+
+        // Calls `visitor` with the value: `std::monostate`, a fundamental type,
+        // `std::string_view`, `const std::vector<T>&`, `const glm::vec3&`, `const glm::vec4&`,
+        // or `ontology::Entity&` (`const ontology::Entity&` for a const `Movable`).
+        template<typename Visitor>
+            decltype(auto) visit(Visitor&& visitor) const;
+
         // copy constructor.
-        AnyValue(const AnyValue& original) = default;
+        AnyValue(const AnyValue& original);
+
+        // move constructor.
+        AnyValue(AnyValue&& original) noexcept;
 
         // constructor for optional `AnyValue`.
         explicit AnyValue(const std::optional<AnyValue> original);
 
         // common constructors.
 
-        AnyValue() = default;
+        constexpr AnyValue() = default;
 
-        AnyValue(const std::string& type, const std::string& value_string);
+        constexpr ~AnyValue()
+        {
+            if (this->owns_heap_data())
+            {
+                this->release();
+            }
+        }
 
         // This constructor takes also the value as a string.
+        AnyValue(const std::string& type, const std::string& value_string);
+
         // Fundamental types.
         explicit AnyValue(bool bool_value);
 
@@ -115,37 +170,31 @@ namespace yli::data
         explicit AnyValue(std::uint64_t uint64_t_value);
 
         // Strings.
-        explicit AnyValue(std::string& std_string_ref);
-
-        explicit AnyValue(const std::string& const_std_string_ref);
+        explicit AnyValue(const std::string& std_string);
 
         // Variable-size vectors.
-        explicit AnyValue(std::vector<std::int8_t>& std_vector_int8_t_ref);
+        explicit AnyValue(const std::vector<std::int8_t>& std_vector_int8_t);
 
-        explicit AnyValue(std::vector<std::uint8_t>& std_vector_uint8_t_ref);
+        explicit AnyValue(const std::vector<std::uint8_t>& std_vector_uint8_t);
 
-        explicit AnyValue(std::vector<std::int16_t>& std_vector_int16_t_ref);
+        explicit AnyValue(const std::vector<std::int16_t>& std_vector_int16_t);
 
-        explicit AnyValue(std::vector<std::uint16_t>& std_vector_uint16_t_ref);
+        explicit AnyValue(const std::vector<std::uint16_t>& std_vector_uint16_t);
 
-        explicit AnyValue(std::vector<std::int32_t>& std_vector_int32_t_ref);
+        explicit AnyValue(const std::vector<std::int32_t>& std_vector_int32_t);
 
-        explicit AnyValue(std::vector<std::uint32_t>& std_vector_uint32_t_ref);
+        explicit AnyValue(const std::vector<std::uint32_t>& std_vector_uint32_t);
 
-        explicit AnyValue(std::vector<std::int64_t>& std_vector_int64_t_ref);
+        explicit AnyValue(const std::vector<std::int64_t>& std_vector_int64_t);
 
-        explicit AnyValue(std::vector<std::uint64_t>& std_vector_uint64_t_ref);
+        explicit AnyValue(const std::vector<std::uint64_t>& std_vector_uint64_t);
 
-        explicit AnyValue(std::vector<float>& std_vector_float_ref);
+        explicit AnyValue(const std::vector<float>& std_vector_float);
 
         // Fixed-size vectors.
-        explicit AnyValue(glm::vec3& glm_vec3_ref);
+        explicit AnyValue(const glm::vec3& glm_vec3);
 
-        explicit AnyValue(const glm::vec3& const_glm_vec3_ref);
-
-        explicit AnyValue(glm::vec4& glm_vec4_ref);
-
-        explicit AnyValue(const glm::vec4& const_glm_vec4_ref);
+        explicit AnyValue(const glm::vec4& glm_vec4);
 
         // Ontology.
         explicit AnyValue(ontology::Entity& entity_ref);
@@ -184,70 +233,200 @@ namespace yli::data
 
         explicit AnyValue(ontology::ComputeTask& compute_task_ref);
 
-        std::variant<
-            // Uninitialized state.
-            std::monostate,
-            // Fundamental types.
-            bool,
-            char,
-            float,
-            double,
-            std::int32_t,
-            std::uint32_t,
-            std::int64_t,
-            std::uint64_t,
-            // Strings.
-            std::reference_wrapper<std::string>,
-            std::reference_wrapper<const std::string>,
-            // Variable-size vectors.
-            std::reference_wrapper<std::vector<std::int8_t>>,
-            std::reference_wrapper<std::vector<std::uint8_t>>,
-            std::reference_wrapper<std::vector<std::int16_t>>,
-            std::reference_wrapper<std::vector<std::uint16_t>>,
-            std::reference_wrapper<std::vector<std::int32_t>>,
-            std::reference_wrapper<std::vector<std::uint32_t>>,
-            std::reference_wrapper<std::vector<std::int64_t>>,
-            std::reference_wrapper<std::vector<std::uint64_t>>,
-            std::reference_wrapper<std::vector<float>>,
-            // Fixed-size vectors.
-            std::reference_wrapper<glm::vec3>,
-            std::reference_wrapper<const glm::vec3>,
-            std::reference_wrapper<glm::vec4>,
-            std::reference_wrapper<const glm::vec4>,
-            // Ontology.
-            // `yli::ontology` datatypes, 'entity' path.
-            std::reference_wrapper<ontology::Entity>,
-            std::reference_wrapper<ontology::Movable>,
-            std::reference_wrapper<const yli::ontology::Movable>,
-            // `yli::ontology` datatypes, 'universe' path.
-            std::reference_wrapper<ontology::Universe>,
-            // `yli::ontology` datatypes, 'ecosystem' path.
-            std::reference_wrapper<ontology::Ecosystem>,
-            // `yli::ontology` datatypes, 'simple' path.
-            std::reference_wrapper<ontology::Scene>,
-            std::reference_wrapper<ontology::Pipeline>,
-            std::reference_wrapper<ontology::Material>,
-            std::reference_wrapper<ontology::Species>,
-            std::reference_wrapper<ontology::Object>,
-            // `yli::ontology` datatypes, 'heightmap' path.
-            // TODO
-            // `yli::ontology` datatypes, 'symbiont' path.
-            std::reference_wrapper<ontology::Symbiosis>,
-            // `yli::ontology` datatypes, 'holobiont' path.
-            std::reference_wrapper<ontology::Holobiont>,
-            // `yli::ontology` datatypes, 'shapeshifter' path.
-            // TODO
-            // `yli::ontology` datatypes, 'text 2D' path.
-            std::reference_wrapper<ontology::Font2d>,
-            std::reference_wrapper<ontology::Text2d>,
-            // `yli::ontology` datatypes, 'text 3D' path.
-            std::reference_wrapper<ontology::VectorFont>,
-            std::reference_wrapper<ontology::Text3d>,
-            // `yli::ontology` datatypes, 'console' path.
-            std::reference_wrapper<ontology::Console>,
-            // `yli::ontology` datatypes, 'compute' path.
-            std::reference_wrapper<ontology::ComputeTask>> data;
+    private:
+        template<typename T>
+            struct IsStdVector : std::false_type { };
+
+        template<typename T>
+            struct IsStdVector<std::vector<T>> : std::true_type { };
+
+        template<typename T>
+            struct DependentFalse : std::false_type { };
+
+        template<typename T>
+            static consteval Datatype get_datatype_of() noexcept
+            {
+                using U = std::remove_const_t<T>;
+
+                if constexpr (std::is_same_v<U, std::monostate>) { return Datatype::UNKNOWN; }
+                // Fundamental types.
+                else if constexpr (std::is_same_v<U, bool>) { return Datatype::BOOL; }
+                else if constexpr (std::is_same_v<U, char>) { return Datatype::CHAR; }
+                else if constexpr (std::is_same_v<U, float>) { return Datatype::FLOAT; }
+                else if constexpr (std::is_same_v<U, double>) { return Datatype::DOUBLE; }
+                else if constexpr (std::is_same_v<U, std::int32_t>) { return Datatype::INT32_T; }
+                else if constexpr (std::is_same_v<U, std::uint32_t>) { return Datatype::UINT32_T; }
+                else if constexpr (std::is_same_v<U, std::int64_t>) { return Datatype::INT64_T; }
+                else if constexpr (std::is_same_v<U, std::uint64_t>) { return Datatype::UINT64_T; }
+                // Strings.
+                else if constexpr (std::is_same_v<U, std::string>) { return Datatype::STD_STRING; }
+                // Variable-size vectors.
+                else if constexpr (std::is_same_v<U, std::vector<std::int8_t>>) { return Datatype::STD_VECTOR_INT8_T; }
+                else if constexpr (std::is_same_v<U, std::vector<std::uint8_t>>) { return Datatype::STD_VECTOR_UINT8_T; }
+                else if constexpr (std::is_same_v<U, std::vector<std::int16_t>>) { return Datatype::STD_VECTOR_INT16_T; }
+                else if constexpr (std::is_same_v<U, std::vector<std::uint16_t>>) { return Datatype::STD_VECTOR_UINT16_T; }
+                else if constexpr (std::is_same_v<U, std::vector<std::int32_t>>) { return Datatype::STD_VECTOR_INT32_T; }
+                else if constexpr (std::is_same_v<U, std::vector<std::uint32_t>>) { return Datatype::STD_VECTOR_UINT32_T; }
+                else if constexpr (std::is_same_v<U, std::vector<std::int64_t>>) { return Datatype::STD_VECTOR_INT64_T; }
+                else if constexpr (std::is_same_v<U, std::vector<std::uint64_t>>) { return Datatype::STD_VECTOR_UINT64_T; }
+                else if constexpr (std::is_same_v<U, std::vector<float>>) { return Datatype::STD_VECTOR_FLOAT; }
+                // Fixed-size vectors.
+                else if constexpr (std::is_same_v<U, glm::vec3>) { return Datatype::GLM_VEC3; }
+                else if constexpr (std::is_same_v<U, glm::vec4>) { return Datatype::GLM_VEC4; }
+                // Ontology.
+                else if constexpr (std::is_same_v<U, ontology::Entity>) { return Datatype::ENTITY; }
+                else if constexpr (std::is_same_v<U, ontology::Movable>) { return Datatype::MOVABLE; }
+                else if constexpr (std::is_same_v<U, ontology::Universe>) { return Datatype::UNIVERSE; }
+                else if constexpr (std::is_same_v<U, ontology::Ecosystem>) { return Datatype::ECOSYSTEM; }
+                else if constexpr (std::is_same_v<U, ontology::Scene>) { return Datatype::SCENE; }
+                else if constexpr (std::is_same_v<U, ontology::Pipeline>) { return Datatype::PIPELINE; }
+                else if constexpr (std::is_same_v<U, ontology::Material>) { return Datatype::MATERIAL; }
+                else if constexpr (std::is_same_v<U, ontology::Species>) { return Datatype::SPECIES; }
+                else if constexpr (std::is_same_v<U, ontology::Object>) { return Datatype::OBJECT; }
+                else if constexpr (std::is_same_v<U, ontology::Symbiosis>) { return Datatype::SYMBIOSIS; }
+                else if constexpr (std::is_same_v<U, ontology::Holobiont>) { return Datatype::HOLOBIONT; }
+                else if constexpr (std::is_same_v<U, ontology::Font2d>) { return Datatype::FONT_2D; }
+                else if constexpr (std::is_same_v<U, ontology::Text2d>) { return Datatype::TEXT_2D; }
+                else if constexpr (std::is_same_v<U, ontology::VectorFont>) { return Datatype::VECTOR_FONT; }
+                else if constexpr (std::is_same_v<U, ontology::Text3d>) { return Datatype::TEXT_3D; }
+                else if constexpr (std::is_same_v<U, ontology::Console>) { return Datatype::CONSOLE; }
+                else if constexpr (std::is_same_v<U, ontology::ComputeTask>) { return Datatype::COMPUTE_TASK; }
+                else
+                {
+                    static_assert(DependentFalse<T>::value, "`AnyValue` does not support this datatype!");
+                }
+            }
+
+        constexpr bool owns_heap_data() const noexcept
+        {
+            return this->is_long_string ||
+                (this->datatype >= Datatype::STD_VECTOR_INT8_T && this->datatype <= Datatype::STD_VECTOR_UINT64_T);
+        }
+
+        void set_string(std::string_view string);
+        void set_entity(Datatype entity_datatype, ontology::Entity* const entity, const bool is_const_entity = false) noexcept;
+        void copy_heap_data_from(const AnyValue& other);
+        void release() noexcept;
+
+        union Payload
+        {
+            bool bool_value;
+            char char_value;
+            float float_value;
+            double double_value;
+            std::int32_t int32_t_value;
+            std::uint32_t uint32_t_value;
+            std::int64_t int64_t_value;
+            std::uint64_t uint64_t_value { 0 };
+            glm::vec3 glm_vec3_value;
+            glm::vec4 glm_vec4_value;
+            ontology::Entity* entity;
+            std::string* long_string; // Owned, used for strings longer than `small_string_capacity`.
+            void* vector;             // Owned `std::vector`, its element type is given by the `Datatype` tag.
+            char small_string[small_string_capacity];
+        };
+
+        static_assert(std::is_trivially_copyable_v<Payload>);
+        static_assert(sizeof(Payload) == small_string_capacity);
+
+        Payload payload {};
+        Datatype datatype { Datatype::UNKNOWN };
+        std::uint8_t small_string_size { 0 };
+        bool is_long_string           { false };
+        bool is_const                 { false };
     };
+
+    template<typename T>
+        decltype(auto) AnyValue::get() const
+        {
+            if (!this->holds<T>()) [[unlikely]]
+            {
+                throw std::runtime_error("Requested a datatype that `AnyValue` didn't hold!");
+            }
+
+            using U = std::remove_const_t<T>;
+
+            if constexpr (get_datatype_of<T>() >= Datatype::ENTITY)
+            {
+                return static_cast<T&>(*this->payload.entity);
+            }
+            else if constexpr (std::is_same_v<U, std::monostate>)
+            {
+                return std::monostate {};
+            }
+            else if constexpr (std::is_same_v<U, std::string>)
+            {
+                return this->get_string_view();
+            }
+            else if constexpr (IsStdVector<U>::value)
+            {
+                return static_cast<const U&>(*static_cast<const U*>(this->payload.vector));
+            }
+            else
+            {
+                return static_cast<const U&>(*reinterpret_cast<const U*>(&this->payload));
+            }
+        }
+
+    template<typename Visitor>
+        decltype(auto) AnyValue::visit(Visitor&& visitor) const
+        {
+            switch (this->datatype)
+            {
+                case Datatype::UNKNOWN:
+                    return visitor(std::monostate {});
+                case Datatype::BOOL:
+                    return visitor(this->payload.bool_value);
+                case Datatype::CHAR:
+                    return visitor(this->payload.char_value);
+                case Datatype::FLOAT:
+                    return visitor(this->payload.float_value);
+                case Datatype::DOUBLE:
+                    return visitor(this->payload.double_value);
+                case Datatype::INT32_T:
+                    return visitor(this->payload.int32_t_value);
+                case Datatype::UINT32_T:
+                    return visitor(this->payload.uint32_t_value);
+                case Datatype::INT64_T:
+                    return visitor(this->payload.int64_t_value);
+                case Datatype::UINT64_T:
+                    return visitor(this->payload.uint64_t_value);
+                case Datatype::STD_STRING:
+                    return visitor(this->get_string_view());
+                case Datatype::STD_VECTOR_INT8_T:
+                    return visitor(this->get<std::vector<std::int8_t>>());
+                case Datatype::STD_VECTOR_UINT8_T:
+                    return visitor(this->get<std::vector<std::uint8_t>>());
+                case Datatype::STD_VECTOR_INT16_T:
+                    return visitor(this->get<std::vector<std::int16_t>>());
+                case Datatype::STD_VECTOR_UINT16_T:
+                    return visitor(this->get<std::vector<std::uint16_t>>());
+                case Datatype::STD_VECTOR_INT32_T:
+                    return visitor(this->get<std::vector<std::int32_t>>());
+                case Datatype::STD_VECTOR_UINT32_T:
+                    return visitor(this->get<std::vector<std::uint32_t>>());
+                case Datatype::STD_VECTOR_INT64_T:
+                    return visitor(this->get<std::vector<std::int64_t>>());
+                case Datatype::STD_VECTOR_UINT64_T:
+                    return visitor(this->get<std::vector<std::uint64_t>>());
+                case Datatype::STD_VECTOR_FLOAT:
+                    return visitor(this->get<std::vector<float>>());
+                case Datatype::GLM_VEC3:
+                    return visitor(std::as_const(this->payload.glm_vec3_value));
+                case Datatype::GLM_VEC4:
+                    return visitor(std::as_const(this->payload.glm_vec4_value));
+                default:
+                    if (this->is_const)
+                    {
+                        return visitor(std::as_const(*this->payload.entity));
+                    }
+                    return visitor(*this->payload.entity);
+            }
+        }
+
+    // `AnyValue` is passed by value through callbacks, variables and console commands,
+    // so it must stay within a tag and a 24-byte payload.
+    static_assert(sizeof(AnyValue) <= 4 * sizeof(std::uint64_t));
 }
 
 #endif
@@ -49,6 +49,8 @@ namespace yli::data
         STD_VECTOR_INT32_T  = 15,
         STD_VECTOR_UINT32_T = 16,
         STD_VECTOR_FLOAT    = 17,
+        STD_VECTOR_INT64_T  = 18,
+        STD_VECTOR_UINT64_T = 19,
         // Fixed-size vectors.
         GLM_VEC3            = 21,
         GLM_VEC4            = 22,
@@ -19,12 +19,13 @@
 #define YLIKUUTIO_DATA_VARIANT_TEMPLATES_HPP_INCLUDED
 
 #include "any_value.hpp"
+#include "code/ylikuutio/string/convert_string_to_value.hpp"
 #include "code/ylikuutio/string/ylikuutio_string.hpp"
 
 // Include standard headers
 #include <cstdint>  // std::int32_t, std::uint32_t
+#include <optional> // std::optional
 #include <string>   // std::string
-#include <sstream>  // std::stringstream
 #include <variant>  // std::holds_alternative, std::variant
 
 namespace yli::data
@@ -33,7 +34,6 @@ namespace yli::data
     template<typename... V>
     std::variant<V...> get_variant(const std::string& type, const std::string& value_string)
     {
-        std::stringstream value_stringstream;
         std::variant<V...> my_variant;
 
         if (type == "bool")
@@ -56,42 +56,38 @@ namespace yli::data
         }
         else if (type == "float")
         {
-            if (yli::string::check_if_float_string<char>(value_string))
+            const std::optional<float> float_value = yli::string::convert_string_to_number<float>(value_string);
+
+            if (yli::string::check_if_float_string<char>(value_string) && float_value)
             {
-                float float_value;
-                value_stringstream << value_string;
-                value_stringstream >> float_value;
-                my_variant = float_value;
+                my_variant = *float_value;
             }
         }
         else if (type == "double")
         {
-            if (yli::string::check_if_double_string<char>(value_string))
+            const std::optional<double> double_value = yli::string::convert_string_to_number<double>(value_string);
+
+            if (yli::string::check_if_double_string<char>(value_string) && double_value)
             {
-                double double_value;
-                value_stringstream << value_string;
-                value_stringstream >> double_value;
-                my_variant = double_value;
+                my_variant = *double_value;
             }
         }
         else if (type == "std::int32_t")
         {
-            if (yli::string::check_if_signed_integer_string<char>(value_string))
+            const std::optional<std::int32_t> int32_t_value = yli::string::convert_string_to_number<std::int32_t>(value_string);
+
+            if (yli::string::check_if_signed_integer_string<char>(value_string) && int32_t_value)
             {
-                std::int32_t int32_t_value;
-                value_stringstream << value_string;
-                value_stringstream >> int32_t_value;
-                my_variant = int32_t_value;
+                my_variant = *int32_t_value;
             }
         }
         else if (type == "std::uint32_t")
         {
-            if (yli::string::check_if_unsigned_integer_string<char>(value_string))
+            const std::optional<std::uint32_t> uint32_t_value = yli::string::convert_string_to_number<std::uint32_t>(value_string);
+
+            if (yli::string::check_if_unsigned_integer_string<char>(value_string) && uint32_t_value)
             {
-                std::uint32_t uint32_t_value;
-                value_stringstream << value_string;
-                value_stringstream >> uint32_t_value;
-                my_variant = uint32_t_value;
+                my_variant = *uint32_t_value;
             }
         }
 
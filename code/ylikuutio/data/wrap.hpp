@@ -21,6 +21,7 @@
 // Include standard headers
 #include <functional> // std::reference_wrapper
 #include <string>     // std::string
+#include <vector>     // std::vector
 
 namespace yli::data
 {
@@ -53,6 +54,12 @@ namespace yli::data
     {
         using type = const std::string;
     };
+
+    template<>
+    struct WrapAllButStrings<const std::vector<std::string>&>
+    {
+        using type = const std::vector<std::string>;
+    };
 }
 
 #endif
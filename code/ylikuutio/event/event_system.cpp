@@ -55,8 +55,8 @@ namespace yli::event
                     if (const std::optional<data::AnyValue> any_value =
                                 generic_callback_engine->execute(data::AnyValue());
                         any_value &&
-                        std::holds_alternative<std::uint32_t>(any_value->data) &&
-                        std::get<std::uint32_t>(any_value->data) == ontology::CallbackMagicNumber::EXIT_PROGRAM)
+                        any_value->holds<std::uint32_t>() &&
+                        any_value->get<std::uint32_t>() == ontology::CallbackMagicNumber::EXIT_PROGRAM)
                     {
                         this->universe.request_exit();
                     }
@@ -76,8 +76,8 @@ namespace yli::event
 
                 if (const std::optional<data::AnyValue> any_value = generic_callback_engine->execute(data::AnyValue());
                     any_value &&
-                    std::holds_alternative<std::uint32_t>(any_value->data) &&
-                    std::get<std::uint32_t>(any_value->data) == ontology::CallbackMagicNumber::EXIT_PROGRAM)
+                    any_value->holds<std::uint32_t>() &&
+                    any_value->get<std::uint32_t>() == ontology::CallbackMagicNumber::EXIT_PROGRAM)
                 {
                     this->universe.request_exit();
                 }
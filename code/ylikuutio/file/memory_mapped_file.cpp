@@ -0,0 +1,166 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "memory_mapped_file.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>    // open, O_RDONLY
+#include <sys/mman.h> // mmap, munmap, madvise
+#include <sys/stat.h> // fstat
+#include <unistd.h>   // close
+#endif
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <iostream>    // std::cout, std::cerr
+#include <string>      // std::string
+#include <string_view> // std::string_view
+
+namespace yli::file
+{
+    MemoryMappedFile::MemoryMappedFile(const std::string& file_path)
+    {
+        std::cout << "Mapping file " << file_path << " into memory.\n";
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(
+                file_path.c_str(),
+                GENERIC_READ,
+                FILE_SHARE_READ,
+                nullptr,
+                OPEN_EXISTING,
+                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                nullptr);
+
+        if (file == INVALID_HANDLE_VALUE) [[unlikely]]
+        {
+            return;
+        }
+
+        LARGE_INTEGER file_size;
+
+        if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (mapping == nullptr) [[unlikely]]
+        {
+            std::cerr << "ERROR: `MemoryMappedFile::MemoryMappedFile`: `CreateFileMappingA` failed for " << file_path << "!\n";
+            CloseHandle(file);
+            return;
+        }
+
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (view == nullptr) [[unlikely]]
+        {
+            std::cerr << "ERROR: `MemoryMappedFile::MemoryMappedFile`: `MapViewOfFile` failed for " << file_path << "!\n";
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return;
+        }
+
+        this->file_handle = file;
+        this->mapping_handle = mapping;
+        this->mapped_data = static_cast<const char*>(view);
+        this->mapped_size = static_cast<std::size_t>(file_size.QuadPart);
+#else
+        const int file_descriptor = open(file_path.c_str(), O_RDONLY);
+
+        if (file_descriptor < 0) [[unlikely]]
+        {
+            return;
+        }
+
+        struct stat file_status;
+
+        if (fstat(file_descriptor, &file_status) != 0 || file_status.st_size <= 0)
+        {
+            close(file_descriptor);
+            return;
+        }
+
+        const std::size_t file_size = static_cast<std::size_t>(file_status.st_size);
+        void* mapping = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+        // The mapping stays valid after the file descriptor is closed.
+        close(file_descriptor);
+
+        if (mapping == MAP_FAILED) [[unlikely]]
+        {
+            std::cerr << "ERROR: `MemoryMappedFile::MemoryMappedFile`: `mmap` failed for " << file_path << "!\n";
+            return;
+        }
+
+        madvise(mapping, file_size, MADV_SEQUENTIAL);
+
+        this->mapped_data = static_cast<const char*>(mapping);
+        this->mapped_size = file_size;
+#endif
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+#ifdef _WIN32
+        if (this->mapped_data != nullptr)
+        {
+            UnmapViewOfFile(this->mapped_data);
+        }
+
+        if (this->mapping_handle != nullptr)
+        {
+            CloseHandle(this->mapping_handle);
+        }
+
+        if (this->file_handle != nullptr)
+        {
+            CloseHandle(this->file_handle);
+        }
+#else
+        if (this->mapped_data != nullptr)
+        {
+            munmap(const_cast<char*>(this->mapped_data), this->mapped_size);
+        }
+#endif
+    }
+
+    bool MemoryMappedFile::get_is_valid() const
+    {
+        return this->mapped_data != nullptr;
+    }
+
+    const char* MemoryMappedFile::data() const
+    {
+        return this->mapped_data;
+    }
+
+    std::size_t MemoryMappedFile::size() const
+    {
+        return this->mapped_size;
+    }
+
+    std::string_view MemoryMappedFile::get_string_view() const
+    {
+        return std::string_view(this->mapped_data, this->mapped_size);
+    }
+}
@@ -0,0 +1,58 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_FILE_MEMORY_MAPPED_FILE_HPP_INCLUDED
+#define YLIKUUTIO_FILE_MEMORY_MAPPED_FILE_HPP_INCLUDED
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <string>      // std::string
+#include <string_view> // std::string_view
+
+// `MemoryMappedFile` maps a whole file read-only into memory.
+// An empty file or a file that could not be mapped gives an invalid
+// `MemoryMappedFile`, check `get_is_valid` before using the data.
+
+namespace yli::file
+{
+    class MemoryMappedFile final
+    {
+        public:
+            explicit MemoryMappedFile(const std::string& file_path);
+
+            MemoryMappedFile(const MemoryMappedFile&) = delete;            // Delete copy constructor.
+            MemoryMappedFile& operator=(const MemoryMappedFile&) = delete; // Delete copy assignment.
+
+            ~MemoryMappedFile();
+
+            bool get_is_valid() const;
+            const char* data() const;
+            std::size_t size() const;
+            std::string_view get_string_view() const;
+
+        private:
+            const char* mapped_data { nullptr };
+            std::size_t mapped_size { 0 };
+
+#ifdef _WIN32
+            void* file_handle    { nullptr };
+            void* mapping_handle { nullptr };
+#endif
+    };
+}
+
+#endif
@@ -0,0 +1,119 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "aabb.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::max, std::min
+#include <vector>    // std::vector
+
+namespace yli::geometry
+{
+    Aabb Aabb::from_points(const std::vector<glm::vec3>& points) noexcept
+    {
+        Aabb aabb;
+
+        for (const glm::vec3& point : points)
+        {
+            aabb.expand(point);
+        }
+
+        return aabb;
+    }
+
+    Aabb Aabb::from_sphere(const glm::vec3& center, const float radius) noexcept
+    {
+        const glm::vec3 radius_vector(radius, radius, radius);
+        return Aabb(center - radius_vector, center + radius_vector);
+    }
+
+    Aabb Aabb::merge(const Aabb& lhs, const Aabb& rhs) noexcept
+    {
+        if (lhs.is_empty())
+        {
+            return rhs;
+        }
+
+        if (rhs.is_empty())
+        {
+            return lhs;
+        }
+
+        return Aabb(
+                glm::vec3(std::min(lhs.min.x, rhs.min.x), std::min(lhs.min.y, rhs.min.y), std::min(lhs.min.z, rhs.min.z)),
+                glm::vec3(std::max(lhs.max.x, rhs.max.x), std::max(lhs.max.y, rhs.max.y), std::max(lhs.max.z, rhs.max.z)));
+    }
+
+    bool Aabb::is_empty() const noexcept
+    {
+        return this->min.x > this->max.x || this->min.y > this->max.y || this->min.z > this->max.z;
+    }
+
+    void Aabb::expand(const glm::vec3& point) noexcept
+    {
+        if (this->is_empty())
+        {
+            this->min = point;
+            this->max = point;
+            return;
+        }
+
+        this->min = glm::vec3(std::min(this->min.x, point.x), std::min(this->min.y, point.y), std::min(this->min.z, point.z));
+        this->max = glm::vec3(std::max(this->max.x, point.x), std::max(this->max.y, point.y), std::max(this->max.z, point.z));
+    }
+
+    Aabb Aabb::fatten(const float margin) const noexcept
+    {
+        const glm::vec3 margin_vector(margin, margin, margin);
+        return Aabb(this->min - margin_vector, this->max + margin_vector);
+    }
+
+    bool Aabb::contains(const Aabb& other) const noexcept
+    {
+        return this->min.x <= other.min.x && this->min.y <= other.min.y && this->min.z <= other.min.z &&
+            other.max.x <= this->max.x && other.max.y <= this->max.y && other.max.z <= this->max.z;
+    }
+
+    bool Aabb::overlaps(const Aabb& other) const noexcept
+    {
+        return this->min.x <= other.max.x && other.min.x <= this->max.x &&
+            this->min.y <= other.max.y && other.min.y <= this->max.y &&
+            this->min.z <= other.max.z && other.min.z <= this->max.z;
+    }
+
+    glm::vec3 Aabb::get_center() const noexcept
+    {
+        return 0.5f * (this->min + this->max);
+    }
+
+    glm::vec3 Aabb::get_extent() const noexcept
+    {
+        return 0.5f * (this->max - this->min);
+    }
+
+    float Aabb::get_perimeter() const noexcept
+    {
+        const glm::vec3 size = this->max - this->min;
+        return size.x * size.y + size.y * size.z + size.z * size.x;
+    }
+}
@@ -0,0 +1,76 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_GEOMETRY_AABB_HPP_INCLUDED
+#define YLIKUUTIO_GEOMETRY_AABB_HPP_INCLUDED
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <vector> // std::vector
+
+// `Aabb` is an axis-aligned bounding box.
+//
+// A default constructed `Aabb` is empty (inverted), so that expanding it
+// with the first point makes it a degenerate box containing only that point.
+
+namespace yli::geometry
+{
+    struct Aabb
+    {
+        Aabb() = default;
+
+        Aabb(const glm::vec3& min, const glm::vec3& max) noexcept
+            : min { min },
+              max { max }
+        {
+        }
+
+        static Aabb from_points(const std::vector<glm::vec3>& points) noexcept;
+
+        static Aabb from_sphere(const glm::vec3& center, float radius) noexcept;
+
+        static Aabb merge(const Aabb& lhs, const Aabb& rhs) noexcept;
+
+        bool is_empty() const noexcept;
+
+        void expand(const glm::vec3& point) noexcept;
+
+        // Grow the box by `margin` in every direction.
+        Aabb fatten(float margin) const noexcept;
+
+        bool contains(const Aabb& other) const noexcept;
+
+        bool overlaps(const Aabb& other) const noexcept;
+
+        glm::vec3 get_center() const noexcept;
+
+        glm::vec3 get_extent() const noexcept;
+
+        // Half of the surface area, used as the cost in tree building.
+        float get_perimeter() const noexcept;
+
+        glm::vec3 min { 1.0f, 1.0f, 1.0f };
+        glm::vec3 max { -1.0f, -1.0f, -1.0f };
+    };
+}
+
+#endif
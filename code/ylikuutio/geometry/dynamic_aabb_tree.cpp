@@ -0,0 +1,406 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "dynamic_aabb_tree.hpp"
+#include "aabb.hpp"
+
+// Include standard headers
+#include <algorithm> // std::max
+#include <cmath>     // std::abs
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int32_t
+#include <stdexcept> // std::runtime_error
+#include <vector>    // std::vector
+
+namespace yli::geometry
+{
+    DynamicAabbTree::DynamicAabbTree(const float margin) noexcept
+        : margin { margin }
+    {
+    }
+
+    std::int32_t DynamicAabbTree::create_proxy(const Aabb& aabb, void* const user_data)
+    {
+        const std::int32_t proxy_id = this->allocate_node();
+        Node& node = this->nodes[proxy_id];
+        node.aabb = aabb.fatten(this->margin);
+        node.user_data = user_data;
+        node.height = 0;
+
+        this->insert_leaf(proxy_id);
+        this->n_proxies++;
+        return proxy_id;
+    }
+
+    void DynamicAabbTree::destroy_proxy(const std::int32_t proxy_id)
+    {
+        if (proxy_id < 0 || proxy_id >= static_cast<std::int32_t>(this->nodes.size()) ||
+                !this->nodes[proxy_id].is_leaf() || this->nodes[proxy_id].height != 0) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `DynamicAabbTree::destroy_proxy`: invalid `proxy_id`!");
+        }
+
+        this->remove_leaf(proxy_id);
+        this->free_node(proxy_id);
+        this->n_proxies--;
+    }
+
+    bool DynamicAabbTree::move_proxy(const std::int32_t proxy_id, const Aabb& aabb)
+    {
+        if (proxy_id < 0 || proxy_id >= static_cast<std::int32_t>(this->nodes.size()) ||
+                this->nodes[proxy_id].height != 0) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `DynamicAabbTree::move_proxy`: invalid `proxy_id`!");
+        }
+
+        if (this->nodes[proxy_id].aabb.contains(aabb))
+        {
+            // Still inside the fattened `Aabb`, nothing to do.
+            return false;
+        }
+
+        this->remove_leaf(proxy_id);
+        this->nodes[proxy_id].aabb = aabb.fatten(this->margin);
+        this->insert_leaf(proxy_id);
+        return true;
+    }
+
+    void* DynamicAabbTree::get_user_data(const std::int32_t proxy_id) const
+    {
+        return this->nodes.at(proxy_id).user_data;
+    }
+
+    const Aabb& DynamicAabbTree::get_fat_aabb(const std::int32_t proxy_id) const
+    {
+        return this->nodes.at(proxy_id).aabb;
+    }
+
+    std::size_t DynamicAabbTree::get_number_of_proxies() const noexcept
+    {
+        return this->n_proxies;
+    }
+
+    std::int32_t DynamicAabbTree::get_height() const noexcept
+    {
+        if (this->root == null_node)
+        {
+            return 0;
+        }
+
+        return this->nodes[this->root].height;
+    }
+
+    bool DynamicAabbTree::validate() const
+    {
+        if (this->root == null_node)
+        {
+            return this->n_proxies == 0;
+        }
+
+        if (this->nodes[this->root].parent != null_node)
+        {
+            return false;
+        }
+
+        std::size_t n_leaves = 0;
+        return this->validate_subtree(this->root, n_leaves) && n_leaves == this->n_proxies;
+    }
+
+    std::int32_t DynamicAabbTree::allocate_node()
+    {
+        if (this->free_list == null_node)
+        {
+            this->nodes.emplace_back();
+            return static_cast<std::int32_t>(this->nodes.size() - 1);
+        }
+
+        const std::int32_t node_id = this->free_list;
+        this->free_list = this->nodes[node_id].parent;
+        this->nodes[node_id] = Node();
+        return node_id;
+    }
+
+    void DynamicAabbTree::free_node(const std::int32_t node_id)
+    {
+        Node& node = this->nodes[node_id];
+        node.user_data = nullptr;
+        node.child1 = null_node;
+        node.child2 = null_node;
+        node.height = -1;
+        node.parent = this->free_list;
+        this->free_list = node_id;
+    }
+
+    void DynamicAabbTree::insert_leaf(const std::int32_t leaf)
+    {
+        if (this->root == null_node)
+        {
+            this->root = leaf;
+            this->nodes[leaf].parent = null_node;
+            return;
+        }
+
+        // Find the best sibling by descending towards the cheapest child.
+        const Aabb leaf_aabb = this->nodes[leaf].aabb;
+        std::int32_t index = this->root;
+
+        while (!this->nodes[index].is_leaf())
+        {
+            const Node& node = this->nodes[index];
+            const float area = node.aabb.get_perimeter();
+            const float combined_area = Aabb::merge(node.aabb, leaf_aabb).get_perimeter();
+
+            // Cost of creating a new parent for this node and the new leaf.
+            const float cost = 2.0f * combined_area;
+
+            // Minimum cost of pushing the leaf further down the tree.
+            const float inheritance_cost = 2.0f * (combined_area - area);
+
+            auto child_cost = [&](const std::int32_t child) -> float
+            {
+                const Node& child_node = this->nodes[child];
+                const float merged_area = Aabb::merge(leaf_aabb, child_node.aabb).get_perimeter();
+
+                if (child_node.is_leaf())
+                {
+                    return merged_area + inheritance_cost;
+                }
+
+                return merged_area - child_node.aabb.get_perimeter() + inheritance_cost;
+            };
+
+            const float cost1 = child_cost(node.child1);
+            const float cost2 = child_cost(node.child2);
+
+            if (cost < cost1 && cost < cost2)
+            {
+                break;
+            }
+
+            index = (cost1 < cost2 ? node.child1 : node.child2);
+        }
+
+        const std::int32_t sibling = index;
+
+        // Create a new parent for `sibling` and `leaf`.
+        const std::int32_t old_parent = this->nodes[sibling].parent;
+        const std::int32_t new_parent = this->allocate_node();
+        this->nodes[new_parent].parent = old_parent;
+        this->nodes[new_parent].aabb = Aabb::merge(leaf_aabb, this->nodes[sibling].aabb);
+        this->nodes[new_parent].height = this->nodes[sibling].height + 1;
+        this->nodes[new_parent].child1 = sibling;
+        this->nodes[new_parent].child2 = leaf;
+        this->nodes[sibling].parent = new_parent;
+        this->nodes[leaf].parent = new_parent;
+
+        if (old_parent == null_node)
+        {
+            this->root = new_parent;
+        }
+        else if (this->nodes[old_parent].child1 == sibling)
+        {
+            this->nodes[old_parent].child1 = new_parent;
+        }
+        else
+        {
+            this->nodes[old_parent].child2 = new_parent;
+        }
+
+        // Walk back up the tree fixing heights and `Aabb`s.
+        index = this->nodes[leaf].parent;
+
+        while (index != null_node)
+        {
+            index = this->balance(index);
+
+            const std::int32_t child1 = this->nodes[index].child1;
+            const std::int32_t child2 = this->nodes[index].child2;
+            this->nodes[index].height = 1 + std::max(this->nodes[child1].height, this->nodes[child2].height);
+            this->nodes[index].aabb = Aabb::merge(this->nodes[child1].aabb, this->nodes[child2].aabb);
+
+            index = this->nodes[index].parent;
+        }
+    }
+
+    void DynamicAabbTree::remove_leaf(const std::int32_t leaf)
+    {
+        if (leaf == this->root)
+        {
+            this->root = null_node;
+            return;
+        }
+
+        const std::int32_t parent = this->nodes[leaf].parent;
+        const std::int32_t grandparent = this->nodes[parent].parent;
+        const std::int32_t sibling = (this->nodes[parent].child1 == leaf ?
+                this->nodes[parent].child2 :
+                this->nodes[parent].child1);
+
+        if (grandparent == null_node)
+        {
+            this->root = sibling;
+            this->nodes[sibling].parent = null_node;
+            this->free_node(parent);
+            return;
+        }
+
+        // Replace `parent` with `sibling`.
+        if (this->nodes[grandparent].child1 == parent)
+        {
+            this->nodes[grandparent].child1 = sibling;
+        }
+        else
+        {
+            this->nodes[grandparent].child2 = sibling;
+        }
+
+        this->nodes[sibling].parent = grandparent;
+        this->free_node(parent);
+
+        std::int32_t index = grandparent;
+
+        while (index != null_node)
+        {
+            index = this->balance(index);
+
+            const std::int32_t child1 = this->nodes[index].child1;
+            const std::int32_t child2 = this->nodes[index].child2;
+            this->nodes[index].aabb = Aabb::merge(this->nodes[child1].aabb, this->nodes[child2].aabb);
+            this->nodes[index].height = 1 + std::max(this->nodes[child1].height, this->nodes[child2].height);
+
+            index = this->nodes[index].parent;
+        }
+    }
+
+    std::int32_t DynamicAabbTree::balance(const std::int32_t node_a)
+    {
+        // Perform a left or right rotation if `node_a` is imbalanced.
+        // Returns the new root of the subtree.
+
+        Node& a = this->nodes[node_a];
+
+        if (a.is_leaf() || a.height < 2)
+        {
+            return node_a;
+        }
+
+        const std::int32_t node_b = a.child1;
+        const std::int32_t node_c = a.child2;
+        const std::int32_t balance = this->nodes[node_c].height - this->nodes[node_b].height;
+
+        // Rotate `node_c` up if the subtree of `node_c` is too high, and vice versa.
+        auto rotate_up = [this, node_a](const std::int32_t up, const std::int32_t other) -> std::int32_t
+        {
+            Node& a = this->nodes[node_a];
+            Node& up_node = this->nodes[up];
+            const std::int32_t node_f = up_node.child1;
+            const std::int32_t node_g = up_node.child2;
+
+            // Swap `a` and `up`.
+            up_node.child1 = node_a;
+            up_node.parent = a.parent;
+            a.parent = up;
+
+            // `a`'s old parent should point to `up`.
+            if (up_node.parent != null_node)
+            {
+                if (this->nodes[up_node.parent].child1 == node_a)
+                {
+                    this->nodes[up_node.parent].child1 = up;
+                }
+                else
+                {
+                    this->nodes[up_node.parent].child2 = up;
+                }
+            }
+            else
+            {
+                this->root = up;
+            }
+
+            // Keep the higher of `f` and `g` under `up`, move the lower one under `a`.
+            const bool is_f_higher = this->nodes[node_f].height > this->nodes[node_g].height;
+            const std::int32_t kept = (is_f_higher ? node_f : node_g);
+            const std::int32_t moved = (is_f_higher ? node_g : node_f);
+
+            up_node.child2 = kept;
+
+            if (a.child1 == up)
+            {
+                a.child1 = moved;
+            }
+            else
+            {
+                a.child2 = moved;
+            }
+
+            this->nodes[moved].parent = node_a;
+
+            a.aabb = Aabb::merge(this->nodes[other].aabb, this->nodes[moved].aabb);
+            up_node.aabb = Aabb::merge(a.aabb, this->nodes[kept].aabb);
+
+            a.height = 1 + std::max(this->nodes[other].height, this->nodes[moved].height);
+            up_node.height = 1 + std::max(a.height, this->nodes[kept].height);
+
+            return up;
+        };
+
+        if (balance > 1)
+        {
+            return rotate_up(node_c, node_b);
+        }
+
+        if (balance < -1)
+        {
+            return rotate_up(node_b, node_c);
+        }
+
+        return node_a;
+    }
+
+    bool DynamicAabbTree::validate_subtree(const std::int32_t node_id, std::size_t& n_leaves) const
+    {
+        const Node& node = this->nodes[node_id];
+
+        if (node.is_leaf())
+        {
+            n_leaves++;
+            return node.height == 0 && node.child2 == null_node;
+        }
+
+        const Node& child1 = this->nodes[node.child1];
+        const Node& child2 = this->nodes[node.child2];
+
+        if (child1.parent != node_id || child2.parent != node_id)
+        {
+            return false;
+        }
+
+        if (node.height != 1 + std::max(child1.height, child2.height) ||
+                std::abs(child1.height - child2.height) > 1)
+        {
+            return false;
+        }
+
+        if (!node.aabb.contains(child1.aabb) || !node.aabb.contains(child2.aabb))
+        {
+            return false;
+        }
+
+        return this->validate_subtree(node.child1, n_leaves) && this->validate_subtree(node.child2, n_leaves);
+    }
+}
@@ -0,0 +1,213 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_GEOMETRY_DYNAMIC_AABB_TREE_HPP_INCLUDED
+#define YLIKUUTIO_GEOMETRY_DYNAMIC_AABB_TREE_HPP_INCLUDED
+
+#include "aabb.hpp"
+#include "frustum.hpp"
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int32_t
+#include <vector>  // std::vector
+
+// `DynamicAabbTree` is a bounding volume hierarchy of axis-aligned
+// bounding boxes that supports incremental updates.
+//
+// How `DynamicAabbTree` works:
+//
+// Each proxy (leaf) stores a fattened copy of the `Aabb` given by the user.
+// `move_proxy` does nothing while the new `Aabb` still fits inside the
+// fattened one, so objects that move only a little do not touch the tree.
+// When an `Aabb` leaves its fattened box, the leaf is removed and inserted
+// again. Insertion chooses the sibling with the smallest increase in
+// surface area and the tree is kept balanced with rotations.
+
+namespace yli::geometry
+{
+    class DynamicAabbTree
+    {
+        public:
+            static constexpr std::int32_t null_node { -1 };
+
+            explicit DynamicAabbTree(float margin = 1.0f) noexcept;
+
+            DynamicAabbTree(const DynamicAabbTree&) = delete;            // Delete copy constructor.
+            DynamicAabbTree& operator=(const DynamicAabbTree&) = delete; // Delete copy assignment.
+
+            ~DynamicAabbTree() = default;
+
+            // Returns the proxy ID of the new leaf.
+            std::int32_t create_proxy(const Aabb& aabb, void* user_data);
+
+            void destroy_proxy(std::int32_t proxy_id);
+
+            // Returns `true` if the proxy was reinserted.
+            bool move_proxy(std::int32_t proxy_id, const Aabb& aabb);
+
+            void* get_user_data(std::int32_t proxy_id) const;
+
+            const Aabb& get_fat_aabb(std::int32_t proxy_id) const;
+
+            std::size_t get_number_of_proxies() const noexcept;
+
+            std::int32_t get_height() const noexcept;
+
+            // Checks the structural invariants, for tests.
+            bool validate() const;
+
+            // Calls `callback(user_data)` for every proxy whose fattened `Aabb`
+            // may intersect `frustum`. Subtrees completely inside the frustum
+            // are reported without further plane tests.
+            template<typename Callback>
+            void query(const Frustum& frustum, Callback&& callback) const
+            {
+                if (this->root == null_node)
+                {
+                    return;
+                }
+
+                std::vector<std::int32_t>& stack = this->query_stack;
+                stack.clear();
+                stack.push_back(this->root);
+
+                while (!stack.empty())
+                {
+                    const std::int32_t node_id = stack.back();
+                    stack.pop_back();
+                    const Node& node = this->nodes[node_id];
+
+                    if (!frustum.intersects(node.aabb))
+                    {
+                        continue;
+                    }
+
+                    if (node.is_leaf())
+                    {
+                        callback(node.user_data);
+                    }
+                    else if (frustum.contains(node.aabb))
+                    {
+                        this->report_all_leaves(node_id, callback);
+                    }
+                    else
+                    {
+                        stack.push_back(node.child1);
+                        stack.push_back(node.child2);
+                    }
+                }
+            }
+
+            // Calls `callback(user_data)` for every proxy whose fattened `Aabb` overlaps `aabb`.
+            template<typename Callback>
+            void query(const Aabb& aabb, Callback&& callback) const
+            {
+                if (this->root == null_node)
+                {
+                    return;
+                }
+
+                std::vector<std::int32_t>& stack = this->query_stack;
+                stack.clear();
+                stack.push_back(this->root);
+
+                while (!stack.empty())
+                {
+                    const std::int32_t node_id = stack.back();
+                    stack.pop_back();
+                    const Node& node = this->nodes[node_id];
+
+                    if (!node.aabb.overlaps(aabb))
+                    {
+                        continue;
+                    }
+
+                    if (node.is_leaf())
+                    {
+                        callback(node.user_data);
+                    }
+                    else
+                    {
+                        stack.push_back(node.child1);
+                        stack.push_back(node.child2);
+                    }
+                }
+            }
+
+        private:
+            struct Node
+            {
+                bool is_leaf() const noexcept
+                {
+                    return this->child1 == null_node;
+                }
+
+                Aabb aabb;
+                void* user_data { nullptr };
+
+                // `parent` doubles as the next free node when the node is in the free list.
+                std::int32_t parent { null_node };
+                std::int32_t child1 { null_node };
+                std::int32_t child2 { null_node };
+
+                // Leaf is 0, free node is -1.
+                std::int32_t height { -1 };
+            };
+
+            template<typename Callback>
+            void report_all_leaves(const std::int32_t subtree_root, Callback& callback) const
+            {
+                std::vector<std::int32_t>& stack = this->subtree_stack;
+                stack.clear();
+                stack.push_back(subtree_root);
+
+                while (!stack.empty())
+                {
+                    const Node& node = this->nodes[stack.back()];
+                    stack.pop_back();
+
+                    if (node.is_leaf())
+                    {
+                        callback(node.user_data);
+                    }
+                    else
+                    {
+                        stack.push_back(node.child1);
+                        stack.push_back(node.child2);
+                    }
+                }
+            }
+
+            std::int32_t allocate_node();
+            void free_node(std::int32_t node_id);
+            void insert_leaf(std::int32_t leaf);
+            void remove_leaf(std::int32_t leaf);
+            std::int32_t balance(std::int32_t node_id);
+            bool validate_subtree(std::int32_t node_id, std::size_t& n_leaves) const;
+
+            std::vector<Node> nodes;
+            mutable std::vector<std::int32_t> query_stack;
+            mutable std::vector<std::int32_t> subtree_stack;
+            std::int32_t root { null_node };
+            std::int32_t free_list { null_node };
+            std::size_t n_proxies { 0 };
+            float margin;
+    };
+}
+
+#endif
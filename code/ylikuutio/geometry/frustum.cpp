@@ -0,0 +1,117 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "frustum.hpp"
+#include "aabb.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cmath> // std::sqrt
+
+namespace yli::geometry
+{
+    Frustum::Frustum(const glm::mat4& view_projection_matrix) noexcept
+    {
+        // GLM matrices are column-major, so `m[column][row]`.
+        const glm::mat4& m = view_projection_matrix;
+        const glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        const glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        const glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        const glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+        this->planes[0] = row3 + row0; // Left.
+        this->planes[1] = row3 - row0; // Right.
+        this->planes[2] = row3 + row1; // Bottom.
+        this->planes[3] = row3 - row1; // Top.
+        this->planes[4] = row3 + row2; // Near.
+        this->planes[5] = row3 - row2; // Far.
+
+        for (glm::vec4& plane : this->planes)
+        {
+            const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+
+            if (length > 0.0f) [[likely]]
+            {
+                plane = plane * (1.0f / length);
+            }
+        }
+    }
+
+    bool Frustum::intersects(const Aabb& aabb) const noexcept
+    {
+        if (aabb.is_empty()) [[unlikely]]
+        {
+            return false;
+        }
+
+        for (const glm::vec4& plane : this->planes)
+        {
+            // Test the corner that is farthest along the plane normal.
+            const float x = plane.x >= 0.0f ? aabb.max.x : aabb.min.x;
+            const float y = plane.y >= 0.0f ? aabb.max.y : aabb.min.y;
+            const float z = plane.z >= 0.0f ? aabb.max.z : aabb.min.z;
+
+            if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool Frustum::contains(const Aabb& aabb) const noexcept
+    {
+        if (aabb.is_empty()) [[unlikely]]
+        {
+            return false;
+        }
+
+        for (const glm::vec4& plane : this->planes)
+        {
+            // Test the corner that is nearest along the plane normal.
+            const float x = plane.x >= 0.0f ? aabb.min.x : aabb.max.x;
+            const float y = plane.y >= 0.0f ? aabb.min.y : aabb.max.y;
+            const float z = plane.z >= 0.0f ? aabb.min.z : aabb.max.z;
+
+            if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool Frustum::intersects_sphere(const glm::vec3& center, const float radius) const noexcept
+    {
+        for (const glm::vec4& plane : this->planes)
+        {
+            if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,57 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_GEOMETRY_FRUSTUM_HPP_INCLUDED
+#define YLIKUUTIO_GEOMETRY_FRUSTUM_HPP_INCLUDED
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <array> // std::array
+
+// `Frustum` is the viewing volume of a `Camera`, stored as 6 planes
+// whose normals point inside the volume. The planes are extracted
+// from the combined projection and view matrix (Gribb & Hartmann).
+
+namespace yli::geometry
+{
+    struct Aabb;
+
+    class Frustum
+    {
+        public:
+            explicit Frustum(const glm::mat4& view_projection_matrix) noexcept;
+
+            // Returns `false` only if `aabb` is certainly outside the frustum.
+            bool intersects(const Aabb& aabb) const noexcept;
+
+            // Returns `true` if `aabb` is completely inside the frustum.
+            bool contains(const Aabb& aabb) const noexcept;
+
+            // Returns `false` only if the sphere is certainly outside the frustum.
+            bool intersects_sphere(const glm::vec3& center, float radius) const noexcept;
+
+            // Plane equation is `dot(xyz, point) + w = 0`.
+            std::array<glm::vec4, 6> planes;
+    };
+}
+
+#endif
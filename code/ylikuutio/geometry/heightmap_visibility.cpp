@@ -0,0 +1,941 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "heightmap_visibility.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::clamp, std::max, std::min
+#include <bit>       // std::bit_cast, std::bit_width
+#include <cmath>     // NAN, std::abs, std::floor, std::isfinite, std::sqrt
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int32_t, std::uint8_t, std::uint32_t
+#include <limits>    // std::numeric_limits
+#include <stdexcept> // std::runtime_error
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+namespace yli::geometry
+{
+    // Rays are processed in packets of this many rays in the batched queries.
+    static constexpr std::size_t packet_size { 8 };
+
+    // The march probes the cell a little ahead, so that it always progresses.
+    static constexpr float probe_distance { 1e-4f };
+
+    static constexpr float infinity { std::numeric_limits<float>::infinity() };
+
+    static bool is_finite(const glm::vec3& point) noexcept
+    {
+        return std::isfinite(point.x) && std::isfinite(point.y) && std::isfinite(point.z);
+    }
+
+    // Narrows `[t_min, t_max]` to where `p0 + d * t` is within `[low, high]`.
+    static void clip_axis(
+            const float p0,
+            const float d,
+            const float low,
+            const float high,
+            float& t_min,
+            float& t_max) noexcept
+    {
+        const float inverse_d = 1.0f / (d != 0.0f ? d : 1.0f);
+        const float t_low = (low - p0) * inverse_d;
+        const float t_high = (high - p0) * inverse_d;
+        const bool is_outside = (p0 < low || p0 > high);
+
+        t_min = (d != 0.0f ? std::max(t_min, std::min(t_low, t_high)) : (is_outside ? 1.0f : t_min));
+        t_max = (d != 0.0f ? std::min(t_max, std::max(t_low, t_high)) : (is_outside ? 0.0f : t_max));
+    }
+
+    // `condition ? if_true : if_false` as a blend of the bits. Both values are computed,
+    // so that the compiler does not move the computation of either into a branch, which
+    // would keep the loops over the lanes from vectorizing.
+    static float select(const bool condition, const float if_true, const float if_false) noexcept
+    {
+        const std::uint32_t mask = 0u - static_cast<std::uint32_t>(condition);
+        return std::bit_cast<float>((std::bit_cast<std::uint32_t>(if_true) & mask) | (std::bit_cast<std::uint32_t>(if_false) & ~mask));
+    }
+
+    Viewshed::Viewshed(
+            const glm::vec3& observer,
+            std::vector<float>&& min_visible_altitudes,
+            const std::uint32_t width,
+            const std::uint32_t height,
+            const glm::vec2& origin,
+            const glm::vec2& spacing)
+        : observer { observer },
+        min_visible_altitudes(std::move(min_visible_altitudes)),
+        width { width },
+        height { height },
+        origin { origin },
+        inverse_spacing { 1.0f / spacing.x, 1.0f / spacing.y }
+    {
+    }
+
+    bool Viewshed::is_visible(const glm::vec3& target) const
+    {
+        const float u = (target.x - this->origin.x) * this->inverse_spacing.x;
+        const float v = (target.z - this->origin.y) * this->inverse_spacing.y;
+
+        if (this->width < 2 || this->height < 2 ||
+                !(u >= 0.0f && u <= static_cast<float>(this->width - 1) && v >= 0.0f && v <= static_cast<float>(this->height - 1)))
+        {
+            return true;
+        }
+
+        const std::uint32_t i = std::min(static_cast<std::uint32_t>(u), this->width - 2);
+        const std::uint32_t j = std::min(static_cast<std::uint32_t>(v), this->height - 2);
+        const float a = u - static_cast<float>(i);
+        const float b = v - static_cast<float>(j);
+
+        const float m00 = this->get_min_visible_altitude(i, j);
+        const float m10 = this->get_min_visible_altitude(i + 1, j);
+        const float m01 = this->get_min_visible_altitude(i, j + 1);
+        const float m11 = this->get_min_visible_altitude(i + 1, j + 1);
+
+        if (!std::isfinite(m00 + m10 + m01 + m11)) [[unlikely]]
+        {
+            // Some corner is not visible at any altitude, use the conservative maximum.
+            return target.y >= std::max(std::max(m00, m10), std::max(m01, m11));
+        }
+
+        const float threshold = (1.0f - b) * ((1.0f - a) * m00 + a * m10) + b * ((1.0f - a) * m01 + a * m11);
+        return target.y >= threshold;
+    }
+
+    float Viewshed::get_min_visible_altitude(const std::uint32_t i, const std::uint32_t j) const
+    {
+        return this->min_visible_altitudes[static_cast<std::size_t>(j) * this->width + i];
+    }
+
+    const glm::vec3& Viewshed::get_observer() const noexcept
+    {
+        return this->observer;
+    }
+
+    bool Viewshed::empty() const noexcept
+    {
+        return this->min_visible_altitudes.empty();
+    }
+
+    HeightmapVisibility::HeightmapVisibility(
+            std::vector<float>&& altitudes,
+            const std::uint32_t width,
+            const std::uint32_t height,
+            const glm::vec2& origin,
+            const glm::vec2& spacing)
+        : altitudes(std::move(altitudes)),
+        width { width },
+        height { height },
+        origin { origin },
+        spacing { spacing },
+        inverse_spacing { 1.0f / spacing.x, 1.0f / spacing.y }
+    {
+        if (this->width < 2 || this->height < 2) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `HeightmapVisibility::HeightmapVisibility`: the heightmap must be at least 2 x 2!");
+        }
+
+        if (this->altitudes.size() != static_cast<std::size_t>(this->width) * this->height) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `HeightmapVisibility::HeightmapVisibility`: number of altitudes does not match the dimensions!");
+        }
+
+        if (!(this->spacing.x > 0.0f && this->spacing.y > 0.0f && std::isfinite(this->spacing.x) && std::isfinite(this->spacing.y))) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `HeightmapVisibility::HeightmapVisibility`: `spacing` must be positive and finite!");
+        }
+
+        float max_magnitude = 1.0f;
+
+        for (const float altitude : this->altitudes)
+        {
+            if (!std::isfinite(altitude)) [[unlikely]]
+            {
+                throw std::runtime_error("ERROR: `HeightmapVisibility::HeightmapVisibility`: altitudes must be finite!");
+            }
+
+            max_magnitude = std::max(max_magnitude, std::abs(altitude));
+        }
+
+        this->altitude_tolerance = 1e-5f * max_magnitude;
+
+        // Level 0: the maximum of each quad.
+        Level level_0 { {}, this->width - 1, this->height - 1 };
+        level_0.max_altitudes.resize(static_cast<std::size_t>(level_0.width) * level_0.height);
+
+        for (std::uint32_t j = 0; j < level_0.height; j++)
+        {
+            for (std::uint32_t i = 0; i < level_0.width; i++)
+            {
+                level_0.max_altitudes[static_cast<std::size_t>(j) * level_0.width + i] = std::max(
+                        std::max(this->get_quad_corner(i, j), this->get_quad_corner(i + 1, j)),
+                        std::max(this->get_quad_corner(i, j + 1), this->get_quad_corner(i + 1, j + 1)));
+            }
+        }
+
+        this->levels.emplace_back(std::move(level_0));
+
+        while (this->levels.back().width > 1 || this->levels.back().height > 1)
+        {
+            const Level& child = this->levels.back();
+            Level parent { {}, (child.width + 1) / 2, (child.height + 1) / 2 };
+            parent.max_altitudes.resize(static_cast<std::size_t>(parent.width) * parent.height);
+
+            for (std::uint32_t j = 0; j < parent.height; j++)
+            {
+                const std::uint32_t child_j0 = 2 * j;
+                const std::uint32_t child_j1 = std::min(2 * j + 1, child.height - 1);
+
+                for (std::uint32_t i = 0; i < parent.width; i++)
+                {
+                    const std::uint32_t child_i0 = 2 * i;
+                    const std::uint32_t child_i1 = std::min(2 * i + 1, child.width - 1);
+
+                    parent.max_altitudes[static_cast<std::size_t>(j) * parent.width + i] = std::max(
+                            std::max(
+                                child.max_altitudes[static_cast<std::size_t>(child_j0) * child.width + child_i0],
+                                child.max_altitudes[static_cast<std::size_t>(child_j0) * child.width + child_i1]),
+                            std::max(
+                                child.max_altitudes[static_cast<std::size_t>(child_j1) * child.width + child_i0],
+                                child.max_altitudes[static_cast<std::size_t>(child_j1) * child.width + child_i1]));
+                }
+            }
+
+            this->levels.emplace_back(std::move(parent));
+        }
+    }
+
+    template<typename Visitor>
+        void HeightmapVisibility::march(const GridRay& ray, Visitor&& visitor) const
+        {
+            const float grid_length = std::max(std::abs(ray.du), std::abs(ray.dv));
+
+            if (grid_length == 0.0f)
+            {
+                // A vertical segment: only the quad below it.
+                const Level& level_0 = this->levels.front();
+                const std::uint32_t i = std::min(static_cast<std::uint32_t>(ray.u0), level_0.width - 1);
+                const std::uint32_t j = std::min(static_cast<std::uint32_t>(ray.v0), level_0.height - 1);
+                visitor.visit_quad(i, j, ray.t_min, ray.t_max);
+                return;
+            }
+
+            // Start at the level at which the ray spans at most 2 x 2 cells.
+            const float t_probe_distance = probe_distance / grid_length;
+            const float inverse_du = (ray.du != 0.0f ? 1.0f / ray.du : 0.0f);
+            const float inverse_dv = (ray.dv != 0.0f ? 1.0f / ray.dv : 0.0f);
+            std::size_t level_i = std::min(
+                    static_cast<std::size_t>(std::bit_width(static_cast<std::uint32_t>(grid_length * (ray.t_max - ray.t_min)))),
+                    this->levels.size() - 1);
+            float t = ray.t_min;
+
+            while (t < ray.t_max)
+            {
+                const Level& level = this->levels[level_i];
+                const float cell_size = static_cast<float>(1u << level_i);
+                const float inverse_cell_size = 1.0f / cell_size; // Exact, a power of 2.
+                const float t_probe = std::min(t + t_probe_distance, 0.5f * (t + ray.t_max));
+
+                if (!(t_probe > t)) [[unlikely]]
+                {
+                    // The rest of the segment is below the float precision of `t`.
+                    return;
+                }
+
+                const float u = ray.u0 + ray.du * t_probe;
+                const float v = ray.v0 + ray.dv * t_probe;
+                const std::uint32_t i = static_cast<std::uint32_t>(std::clamp(
+                            static_cast<std::int32_t>(std::floor(u * inverse_cell_size)), 0, static_cast<std::int32_t>(level.width - 1)));
+                const std::uint32_t j = static_cast<std::uint32_t>(std::clamp(
+                            static_cast<std::int32_t>(std::floor(v * inverse_cell_size)), 0, static_cast<std::int32_t>(level.height - 1)));
+
+                float t_exit = ray.t_max;
+
+                if (ray.du > 0.0f)
+                {
+                    t_exit = std::min(t_exit, (static_cast<float>(i + 1) * cell_size - ray.u0) * inverse_du);
+                }
+                else if (ray.du < 0.0f)
+                {
+                    t_exit = std::min(t_exit, (static_cast<float>(i) * cell_size - ray.u0) * inverse_du);
+                }
+
+                if (ray.dv > 0.0f)
+                {
+                    t_exit = std::min(t_exit, (static_cast<float>(j + 1) * cell_size - ray.v0) * inverse_dv);
+                }
+                else if (ray.dv < 0.0f)
+                {
+                    t_exit = std::min(t_exit, (static_cast<float>(j) * cell_size - ray.v0) * inverse_dv);
+                }
+
+                t_exit = std::max(t_exit, t_probe);
+
+                if (visitor.should_skip(level.max_altitudes[static_cast<std::size_t>(j) * level.width + i], t, t_exit))
+                {
+                    t = t_exit;
+
+                    if (level_i + 1 < this->levels.size())
+                    {
+                        level_i++;
+                    }
+                }
+                else if (level_i > 0)
+                {
+                    level_i--;
+                }
+                else
+                {
+                    if (visitor.visit_quad(i, j, t, t_exit))
+                    {
+                        return;
+                    }
+
+                    // The ray is close to the terrain here, so stay at level 0.
+                    t = t_exit;
+                }
+            }
+        }
+
+    float HeightmapVisibility::get_altitude(const float x, const float z) const
+    {
+        const float u = (x - this->origin.x) * this->inverse_spacing.x;
+        const float v = (z - this->origin.y) * this->inverse_spacing.y;
+
+        if (!(u >= 0.0f && u <= static_cast<float>(this->width - 1) && v >= 0.0f && v <= static_cast<float>(this->height - 1)))
+        {
+            return NAN;
+        }
+
+        const std::uint32_t i = std::min(static_cast<std::uint32_t>(u), this->width - 2);
+        const std::uint32_t j = std::min(static_cast<std::uint32_t>(v), this->height - 2);
+        const float a = u - static_cast<float>(i);
+        const float b = v - static_cast<float>(j);
+
+        return (1.0f - b) * ((1.0f - a) * this->get_quad_corner(i, j) + a * this->get_quad_corner(i + 1, j)) +
+            b * ((1.0f - a) * this->get_quad_corner(i, j + 1) + a * this->get_quad_corner(i + 1, j + 1));
+    }
+
+    bool HeightmapVisibility::is_line_of_sight(const glm::vec3& from, const glm::vec3& to) const
+    {
+        if (!is_finite(from) || !is_finite(to)) [[unlikely]]
+        {
+            return false;
+        }
+
+        GridRay ray {
+            (from.x - this->origin.x) * this->inverse_spacing.x,
+            (from.z - this->origin.y) * this->inverse_spacing.y,
+            from.y,
+            (to.x - from.x) * this->inverse_spacing.x,
+            (to.z - from.z) * this->inverse_spacing.y,
+            to.y - from.y,
+            0.0f,
+            1.0f };
+
+        if (!this->clip(ray))
+        {
+            return true;
+        }
+
+        return this->is_ray_clear(ray);
+    }
+
+    void HeightmapVisibility::are_lines_of_sight(
+            const glm::vec3* const from,
+            const glm::vec3* const to,
+            const std::size_t n_rays,
+            std::uint8_t* const results) const
+    {
+        const float grid_max_u = static_cast<float>(this->width - 1);
+        const float grid_max_v = static_cast<float>(this->height - 1);
+        const std::size_t top_level_i = this->levels.size() - 1;
+
+        // The rays that the cull does not resolve.
+        std::vector<GridRay> pending_rays;
+        std::vector<std::size_t> pending_ray_indices;
+
+        for (std::size_t first_i = 0; first_i < n_rays; first_i += packet_size)
+        {
+            const std::size_t n_lanes = std::min(packet_size, n_rays - first_i);
+
+            // Structure of arrays, so that the loops over the lanes vectorize.
+            float u0[packet_size] {};
+            float v0[packet_size] {};
+            float y0[packet_size] {};
+            float du[packet_size] {};
+            float dv[packet_size] {};
+            float dy[packet_size] {};
+            float t_min[packet_size] {};
+            float t_max[packet_size] {};
+            float bound[packet_size] {};
+            bool is_finite_ray[packet_size] {};
+            bool is_resolved[packet_size] {};
+
+            for (std::size_t lane_i = 0; lane_i < n_lanes; lane_i++)
+            {
+                const glm::vec3& ray_from = from[first_i + lane_i];
+                const glm::vec3& ray_to = to[first_i + lane_i];
+                is_finite_ray[lane_i] = is_finite(ray_from) && is_finite(ray_to);
+                u0[lane_i] = (ray_from.x - this->origin.x) * this->inverse_spacing.x;
+                v0[lane_i] = (ray_from.z - this->origin.y) * this->inverse_spacing.y;
+                y0[lane_i] = ray_from.y;
+                du[lane_i] = (ray_to.x - ray_from.x) * this->inverse_spacing.x;
+                dv[lane_i] = (ray_to.z - ray_from.z) * this->inverse_spacing.y;
+                dy[lane_i] = ray_to.y - ray_from.y;
+            }
+
+            for (std::size_t lane_i = 0; lane_i < packet_size; lane_i++)
+            {
+                float lane_t_min = 0.0f;
+                float lane_t_max = 1.0f;
+                clip_axis(u0[lane_i], du[lane_i], 0.0f, grid_max_u, lane_t_min, lane_t_max);
+                clip_axis(v0[lane_i], dv[lane_i], 0.0f, grid_max_v, lane_t_min, lane_t_max);
+                t_min[lane_i] = lane_t_min;
+                t_max[lane_i] = lane_t_max;
+            }
+
+            // The pyramid level at which the footprint of the clipped ray is at most 2 x 2 cells.
+            for (std::size_t lane_i = 0; lane_i < n_lanes; lane_i++)
+            {
+                if (t_min[lane_i] > t_max[lane_i])
+                {
+                    bound[lane_i] = -infinity;
+                    continue;
+                }
+
+                const float u_a = std::clamp(u0[lane_i] + du[lane_i] * t_min[lane_i], 0.0f, grid_max_u);
+                const float u_b = std::clamp(u0[lane_i] + du[lane_i] * t_max[lane_i], 0.0f, grid_max_u);
+                const float v_a = std::clamp(v0[lane_i] + dv[lane_i] * t_min[lane_i], 0.0f, grid_max_v);
+                const float v_b = std::clamp(v0[lane_i] + dv[lane_i] * t_max[lane_i], 0.0f, grid_max_v);
+                const float extent = std::max(std::abs(u_b - u_a), std::abs(v_b - v_a));
+                const std::size_t level_i = std::min(
+                        static_cast<std::size_t>(std::bit_width(static_cast<std::uint32_t>(extent))),
+                        top_level_i);
+                const Level& level = this->levels[level_i];
+                const float inverse_cell_size = 1.0f / static_cast<float>(1u << level_i);
+
+                const std::uint32_t i_low = std::min(static_cast<std::uint32_t>(std::min(u_a, u_b) * inverse_cell_size), level.width - 1);
+                const std::uint32_t i_high = std::min(static_cast<std::uint32_t>(std::max(u_a, u_b) * inverse_cell_size), level.width - 1);
+                const std::uint32_t j_low = std::min(static_cast<std::uint32_t>(std::min(v_a, v_b) * inverse_cell_size), level.height - 1);
+                const std::uint32_t j_high = std::min(static_cast<std::uint32_t>(std::max(v_a, v_b) * inverse_cell_size), level.height - 1);
+
+                bound[lane_i] = std::max(
+                        std::max(
+                            level.max_altitudes[static_cast<std::size_t>(j_low) * level.width + i_low],
+                            level.max_altitudes[static_cast<std::size_t>(j_low) * level.width + i_high]),
+                        std::max(
+                            level.max_altitudes[static_cast<std::size_t>(j_high) * level.width + i_low],
+                            level.max_altitudes[static_cast<std::size_t>(j_high) * level.width + i_high]));
+            }
+
+            for (std::size_t lane_i = 0; lane_i < packet_size; lane_i++)
+            {
+                // A ray that misses the grid or passes above its whole footprint is clear.
+                const float y_a = y0[lane_i] + dy[lane_i] * t_min[lane_i];
+                const float y_b = y0[lane_i] + dy[lane_i] * t_max[lane_i];
+                is_resolved[lane_i] = (t_min[lane_i] > t_max[lane_i]) || (std::min(y_a, y_b) >= bound[lane_i] - this->altitude_tolerance);
+            }
+
+            for (std::size_t lane_i = 0; lane_i < n_lanes; lane_i++)
+            {
+                if (!is_finite_ray[lane_i]) [[unlikely]]
+                {
+                    results[first_i + lane_i] = 0;
+                }
+                else if (is_resolved[lane_i])
+                {
+                    results[first_i + lane_i] = 1;
+                }
+                else
+                {
+                    pending_rays.emplace_back(GridRay { u0[lane_i], v0[lane_i], y0[lane_i], du[lane_i], dv[lane_i], dy[lane_i], t_min[lane_i], t_max[lane_i] });
+                    pending_ray_indices.emplace_back(first_i + lane_i);
+                }
+            }
+        }
+
+        this->march_packet(pending_rays, pending_ray_indices, results);
+    }
+
+    void HeightmapVisibility::march_packet(
+            const std::vector<GridRay>& rays,
+            const std::vector<std::size_t>& ray_indices,
+            std::uint8_t* const results) const
+    {
+        // The lanes march their rays in lock step, each as `march` with a `BlockVisitor` does.
+        // A lane whose ray is resolved is refilled with the next ray, so that the lanes stay busy.
+        // All loops over the lanes except the one that gathers the altitudes vectorize.
+        const std::int32_t top_level_i = static_cast<std::int32_t>(this->levels.size() - 1);
+        const float altitude_tolerance = this->altitude_tolerance;
+
+        // The rays of the lanes.
+        float u0[packet_size] {};
+        float v0[packet_size] {};
+        float y0[packet_size] {};
+        float du[packet_size] {};
+        float dv[packet_size] {};
+        float dy[packet_size] {};
+        float t_max[packet_size] {};
+        float inverse_du[packet_size] {};
+        float inverse_dv[packet_size] {};
+        float exit_step_u[packet_size] {}; // 1 if the ray exits a cell at its high u side, otherwise 0.
+        float exit_step_v[packet_size] {};
+        float t_probe_distance[packet_size] {};
+        std::int32_t is_active[packet_size] {};
+        std::size_t lane_ray_i[packet_size] {};
+
+        // The march state of the lanes.
+        float t[packet_size] {};
+        float cell_size[packet_size] {};
+        float inverse_cell_size[packet_size] {};
+        std::int32_t level_i[packet_size] {};
+
+        // The state after the current step.
+        float next_t[packet_size] {};
+        float next_cell_size[packet_size] {};
+        float next_inverse_cell_size[packet_size] {};
+        std::int32_t next_level_i[packet_size] {};
+        std::int32_t is_done[packet_size] {};
+        std::int32_t is_blocked[packet_size] {};
+
+        // The current cell of the lanes.
+        float t_probe[packet_size] {};
+        float cell_u[packet_size] {};
+        float cell_v[packet_size] {};
+        float cell_i[packet_size] {};
+        float cell_j[packet_size] {};
+        float max_altitude[packet_size] {};
+        float h00[packet_size] {};
+        float h10[packet_size] {};
+        float h01[packet_size] {};
+        float h11[packet_size] {};
+
+        std::size_t next_ray_i = 0;
+        std::size_t n_active_lanes = 0;
+
+        // Loads the next unresolved ray into the lane, returns `false` if there are no rays left.
+        auto refill = [&](const std::size_t lane_i)
+        {
+            while (next_ray_i < rays.size())
+            {
+                const std::size_t ray_i = next_ray_i++;
+                const GridRay& ray = rays[ray_i];
+                const float grid_length = std::max(std::abs(ray.du), std::abs(ray.dv));
+
+                if (grid_length == 0.0f || !(ray.t_min < ray.t_max)) [[unlikely]]
+                {
+                    results[ray_indices[ray_i]] = (this->is_ray_clear(ray) ? 1 : 0);
+                    continue;
+                }
+
+                const std::int32_t start_level_i = std::min(
+                        static_cast<std::int32_t>(std::bit_width(static_cast<std::uint32_t>(grid_length * (ray.t_max - ray.t_min)))),
+                        top_level_i);
+
+                u0[lane_i] = ray.u0;
+                v0[lane_i] = ray.v0;
+                y0[lane_i] = ray.y0;
+                du[lane_i] = ray.du;
+                dv[lane_i] = ray.dv;
+                dy[lane_i] = ray.dy;
+                t_max[lane_i] = ray.t_max;
+                inverse_du[lane_i] = (ray.du != 0.0f ? 1.0f / ray.du : 0.0f);
+                inverse_dv[lane_i] = (ray.dv != 0.0f ? 1.0f / ray.dv : 0.0f);
+                exit_step_u[lane_i] = (ray.du > 0.0f ? 1.0f : 0.0f);
+                exit_step_v[lane_i] = (ray.dv > 0.0f ? 1.0f : 0.0f);
+                t_probe_distance[lane_i] = probe_distance / grid_length;
+                is_active[lane_i] = 1;
+                lane_ray_i[lane_i] = ray_i;
+                t[lane_i] = ray.t_min;
+                cell_size[lane_i] = static_cast<float>(1u << start_level_i);
+                inverse_cell_size[lane_i] = 1.0f / cell_size[lane_i];
+                level_i[lane_i] = start_level_i;
+                return true;
+            }
+
+            is_active[lane_i] = 0;
+            return false;
+        };
+
+        for (std::size_t lane_i = 0; lane_i < packet_size; lane_i++)
+        {
+            n_active_lanes += (refill(lane_i) ? 1 : 0);
+        }
+
+        while (n_active_lanes > 0)
+        {
+            for (std::size_t lane_i = 0; lane_i < packet_size; lane_i++)
+            {
+                t_probe[lane_i] = std::min(t[lane_i] + t_probe_distance[lane_i], 0.5f * (t[lane_i] + t_max[lane_i]));
+                cell_u[lane_i] = (u0[lane_i] + du[lane_i] * t_probe[lane_i]) * inverse_cell_size[lane_i];
+                cell_v[lane_i] = (v0[lane_i] + dv[lane_i] * t_probe[lane_i]) * inverse_cell_size[lane_i];
+            }
+
+            for (std::size_t lane_i = 0; lane_i < packet_size; lane_i++)
+            {
+                if (!is_active[lane_i])
+                {
+                    continue;
+                }
+
+                const Level& level = this->levels[level_i[lane_i]];
+                const std::uint32_t i = static_cast<std::uint32_t>(std::clamp(
+                            static_cast<std::int32_t>(std::floor(cell_u[lane_i])), 0, static_cast<std::int32_t>(level.width - 1)));
+                const std::uint32_t j = static_cast<std::uint32_t>(std::clamp(
+                            static_cast<std::int32_t>(std::floor(cell_v[lane_i])), 0, static_cast<std::int32_t>(level.height - 1)));
+                cell_i[lane_i] = static_cast<float>(i);
+                cell_j[lane_i] = static_cast<float>(j);
+                max_altitude[lane_i] = level.max_altitudes[static_cast<std::size_t>(j) * level.width + i];
+
+                if (level_i[lane_i] == 0)
+                {
+                    h00[lane_i] = this->get_quad_corner(i, j);
+                    h10[lane_i] = this->get_quad_corner(i + 1, j);
+                    h01[lane_i] = this->get_quad_corner(i, j + 1);
+                    h11[lane_i] = this->get_quad_corner(i + 1, j + 1);
+                }
+            }
+
+            for (std::size_t lane_i = 0; lane_i < packet_size; lane_i++)
+            {
+                // Both alternatives of each choice are computed and then selected, see `select`.
+                const float lane_u0 = u0[lane_i];
+                const float lane_v0 = v0[lane_i];
+                const float lane_y0 = y0[lane_i];
+                const float lane_du = du[lane_i];
+                const float lane_dv = dv[lane_i];
+                const float lane_dy = dy[lane_i];
+                const float lane_t_max = t_max[lane_i];
+                const float lane_t_probe = t_probe[lane_i];
+                const float lane_cell_size = cell_size[lane_i];
+                const float lane_inverse_cell_size = inverse_cell_size[lane_i];
+                const float lane_cell_i = cell_i[lane_i];
+                const float lane_cell_j = cell_j[lane_i];
+                const float lane_h00 = h00[lane_i];
+                const float lane_h10 = h10[lane_i];
+                const float lane_h01 = h01[lane_i];
+                const float lane_h11 = h11[lane_i];
+                const std::int32_t lane_level_i = level_i[lane_i];
+
+                const float t_exit_u = ((lane_cell_i + exit_step_u[lane_i]) * lane_cell_size - lane_u0) * inverse_du[lane_i];
+                const float t_exit_v = ((lane_cell_j + exit_step_v[lane_i]) * lane_cell_size - lane_v0) * inverse_dv[lane_i];
+                const float t_exit = std::max(
+                        std::min(
+                            std::min(lane_t_max, select(lane_du != 0.0f, t_exit_u, lane_t_max)),
+                            select(lane_dv != 0.0f, t_exit_v, lane_t_max)),
+                        lane_t_probe);
+
+                const float t_enter = t[lane_i];
+                const float min_ray_altitude = std::min(lane_y0 + lane_dy * t_enter, lane_y0 + lane_dy * t_exit);
+                const bool is_skipped = (min_ray_altitude >= max_altitude[lane_i] - altitude_tolerance);
+
+                // The exact quad test of `is_quad_above_ray`, which applies at level 0 only.
+                const float slope_u = lane_h10 - lane_h00;
+                const float slope_v = lane_h01 - lane_h00;
+                const float twist = lane_h00 - lane_h10 - lane_h01 + lane_h11;
+                const float a = lane_u0 + lane_du * t_enter - lane_cell_i;
+                const float b = lane_v0 + lane_dv * t_enter - lane_cell_j;
+                const float y = lane_y0 + lane_dy * t_enter;
+                const float c2 = twist * lane_du * lane_dv;
+                const float c1 = slope_u * lane_du + slope_v * lane_dv + twist * (a * lane_dv + b * lane_du) - lane_dy;
+                const float c0 = lane_h00 + slope_u * a + slope_v * b + twist * a * b - y;
+                const float s_exit = t_exit - t_enter;
+                const float s_top = -c1 / (2.0f * c2);
+                const float rise_at_exit = (c2 * s_exit + c1) * s_exit + c0;
+                const float rise_at_top = (c2 * s_top + c1) * s_top + c0;
+                const bool has_top = (c2 < 0.0f) & (s_top > 0.0f) & (s_top < s_exit);
+                const float max_rise = std::max(std::max(c0, rise_at_exit), select(has_top, rise_at_top, c0));
+
+                const bool is_level_0 = (lane_level_i == 0);
+                const bool is_stalled = !(lane_t_probe > t_enter);
+                const bool is_quad_blocked = is_level_0 & !is_skipped & (max_rise > altitude_tolerance);
+                const bool is_going_up = is_skipped & (lane_level_i < top_level_i);
+                const bool is_going_down = !is_skipped & !is_level_0;
+                const float lane_next_t = select(is_skipped | is_level_0, t_exit, t_enter);
+
+                next_t[lane_i] = lane_next_t;
+                next_level_i[lane_i] = lane_level_i + static_cast<std::int32_t>(is_going_up) - static_cast<std::int32_t>(is_going_down);
+                next_cell_size[lane_i] = select(
+                        is_going_up, 2.0f * lane_cell_size, select(is_going_down, 0.5f * lane_cell_size, lane_cell_size));
+                next_inverse_cell_size[lane_i] = select(
+                        is_going_up, 0.5f * lane_inverse_cell_size, select(is_going_down, 2.0f * lane_inverse_cell_size, lane_inverse_cell_size));
+                is_blocked[lane_i] = !is_stalled & is_quad_blocked;
+                is_done[lane_i] = (is_active[lane_i] != 0) & (is_stalled | is_quad_blocked | !(lane_next_t < lane_t_max));
+            }
+
+            for (std::size_t lane_i = 0; lane_i < packet_size; lane_i++)
+            {
+                t[lane_i] = next_t[lane_i];
+                cell_size[lane_i] = next_cell_size[lane_i];
+                inverse_cell_size[lane_i] = next_inverse_cell_size[lane_i];
+                level_i[lane_i] = next_level_i[lane_i];
+
+                if (is_done[lane_i])
+                {
+                    results[ray_indices[lane_ray_i[lane_i]]] = (is_blocked[lane_i] ? 0 : 1);
+                    n_active_lanes -= (refill(lane_i) ? 0 : 1);
+                }
+            }
+        }
+    }
+
+    Viewshed HeightmapVisibility::compute_viewshed(const glm::vec3& observer) const
+    {
+        std::vector<float> min_visible_altitudes(this->altitudes.size(), infinity);
+
+        if (!is_finite(observer)) [[unlikely]]
+        {
+            return Viewshed(observer, std::move(min_visible_altitudes), this->width, this->height, this->origin, this->spacing);
+        }
+
+        const float observer_u = (observer.x - this->origin.x) * this->inverse_spacing.x;
+        const float observer_v = (observer.z - this->origin.y) * this->inverse_spacing.y;
+        const float observer_altitude = this->get_altitude(observer.x, observer.z);
+
+        if (observer_altitude > observer.y + this->altitude_tolerance)
+        {
+            // The observer is underground.
+            return Viewshed(observer, std::move(min_visible_altitudes), this->width, this->height, this->origin, this->spacing);
+        }
+
+        for (std::uint32_t j = 0; j < this->height; j++)
+        {
+            for (std::uint32_t i = 0; i < this->width; i++)
+            {
+                // The segment to (i, j, h) is clear if `h >= observer.y + (terrain(t) - observer.y) / t` for all `t`.
+                // Find the maximum of the slope `(terrain(t) - observer.y) / t` along the segment.
+                GridRay ray {
+                    observer_u,
+                    observer_v,
+                    observer.y,
+                    static_cast<float>(i) - observer_u,
+                    static_cast<float>(j) - observer_v,
+                    0.0f,
+                    0.0f,
+                    1.0f };
+
+                if (!this->clip(ray)) [[unlikely]]
+                {
+                    continue;
+                }
+
+                float max_slope = -infinity;
+
+                struct SlopeVisitor
+                {
+                    const HeightmapVisibility& heightmap_visibility;
+                    const GridRay& ray;
+                    float& max_slope;
+
+                    bool should_skip(const float max_altitude, const float t_enter, const float t_exit) const
+                    {
+                        // An upper bound of the slope within the cell.
+                        const float rise = max_altitude - this->ray.y0;
+                        const float max_cell_slope = (rise > 0.0f ? rise / std::max(t_enter, std::numeric_limits<float>::min()) : rise / t_exit);
+                        return max_cell_slope <= this->max_slope;
+                    }
+
+                    bool visit_quad(const std::uint32_t quad_i, const std::uint32_t quad_j, const float t_enter, const float t_exit) const
+                    {
+                        this->max_slope = std::max(
+                                this->max_slope,
+                                this->heightmap_visibility.get_max_slope_in_quad(this->ray, quad_i, quad_j, t_enter, t_exit));
+                        return false;
+                    }
+                };
+
+                this->march(ray, SlopeVisitor { *this, ray, max_slope });
+
+                min_visible_altitudes[static_cast<std::size_t>(j) * this->width + i] = observer.y + max_slope;
+            }
+        }
+
+        return Viewshed(observer, std::move(min_visible_altitudes), this->width, this->height, this->origin, this->spacing);
+    }
+
+    std::uint32_t HeightmapVisibility::get_width() const noexcept
+    {
+        return this->width;
+    }
+
+    std::uint32_t HeightmapVisibility::get_height() const noexcept
+    {
+        return this->height;
+    }
+
+    std::size_t HeightmapVisibility::get_number_of_levels() const noexcept
+    {
+        return this->levels.size();
+    }
+
+    float HeightmapVisibility::get_max_altitude(const std::size_t level_i, const std::uint32_t i, const std::uint32_t j) const
+    {
+        const Level& level = this->levels.at(level_i);
+        return level.max_altitudes.at(static_cast<std::size_t>(j) * level.width + i);
+    }
+
+    bool HeightmapVisibility::clip(GridRay& ray) const
+    {
+        clip_axis(ray.u0, ray.du, 0.0f, static_cast<float>(this->width - 1), ray.t_min, ray.t_max);
+        clip_axis(ray.v0, ray.dv, 0.0f, static_cast<float>(this->height - 1), ray.t_min, ray.t_max);
+        return ray.t_min <= ray.t_max;
+    }
+
+    float HeightmapVisibility::get_quad_corner(const std::uint32_t i, const std::uint32_t j) const
+    {
+        return this->altitudes[static_cast<std::size_t>(j) * this->width + i];
+    }
+
+    HeightmapVisibility::QuadProfile HeightmapVisibility::get_quad_profile(
+            const GridRay& ray,
+            const std::uint32_t i,
+            const std::uint32_t j,
+            const float t_enter) const
+    {
+        // The bilinear altitude relative to the ray, as a quadratic of `s = t - t_enter`.
+        const float h00 = this->get_quad_corner(i, j);
+        const float h10 = this->get_quad_corner(i + 1, j);
+        const float h01 = this->get_quad_corner(i, j + 1);
+        const float h11 = this->get_quad_corner(i + 1, j + 1);
+        const float slope_u = h10 - h00;
+        const float slope_v = h01 - h00;
+        const float twist = h00 - h10 - h01 + h11;
+
+        const float a = ray.u0 + ray.du * t_enter - static_cast<float>(i);
+        const float b = ray.v0 + ray.dv * t_enter - static_cast<float>(j);
+        const float y = ray.y0 + ray.dy * t_enter;
+
+        return QuadProfile {
+            twist * ray.du * ray.dv,
+            slope_u * ray.du + slope_v * ray.dv + twist * (a * ray.dv + b * ray.du) - ray.dy,
+            h00 + slope_u * a + slope_v * b + twist * a * b - y };
+    }
+
+    bool HeightmapVisibility::is_quad_above_ray(
+            const GridRay& ray,
+            const std::uint32_t i,
+            const std::uint32_t j,
+            const float t_enter,
+            const float t_exit) const
+    {
+        const QuadProfile profile = this->get_quad_profile(ray, i, j, t_enter);
+        const float s_exit = t_exit - t_enter;
+
+        float max_rise = std::max(profile.c0, (profile.c2 * s_exit + profile.c1) * s_exit + profile.c0);
+
+        if (profile.c2 < 0.0f)
+        {
+            const float s_top = -profile.c1 / (2.0f * profile.c2);
+
+            if (s_top > 0.0f && s_top < s_exit)
+            {
+                max_rise = std::max(max_rise, (profile.c2 * s_top + profile.c1) * s_top + profile.c0);
+            }
+        }
+
+        return max_rise > this->altitude_tolerance;
+    }
+
+    float HeightmapVisibility::get_max_slope_in_quad(
+            const GridRay& ray,
+            const std::uint32_t i,
+            const std::uint32_t j,
+            const float t_enter,
+            const float t_exit) const
+    {
+        // With `rise(t) = c2 * t^2 + c1 * t + c0` in terms of `t`, the slope is
+        // `rise(t) / t = c2 * t + c1 + c0 / t`, which is extremal at `t = sqrt(c0 / c2)`.
+        const QuadProfile local = this->get_quad_profile(ray, i, j, t_enter);
+        const float c2 = local.c2;
+        const float c1 = local.c1 - 2.0f * local.c2 * t_enter;
+        float c0 = (local.c2 * t_enter - local.c1) * t_enter + local.c0;
+
+        float max_slope;
+
+        if (t_enter > 0.0f)
+        {
+            max_slope = local.c0 / t_enter;
+        }
+        else if (local.c0 < -this->altitude_tolerance)
+        {
+            // The observer is above the terrain: the slope tends to minus infinity at `t = 0`.
+            max_slope = -infinity;
+        }
+        else if (local.c0 <= this->altitude_tolerance)
+        {
+            // The observer is on the terrain: the slope at `t = 0` is the limit `c1`.
+            c0 = 0.0f;
+            max_slope = c1;
+        }
+        else
+        {
+            return infinity;
+        }
+
+        if (t_exit > 0.0f)
+        {
+            max_slope = std::max(max_slope, c2 * t_exit + c1 + c0 / t_exit);
+        }
+
+        if (c2 != 0.0f && c0 / c2 > 0.0f)
+        {
+            const float t_top = std::sqrt(c0 / c2);
+
+            if (t_top > t_enter && t_top < t_exit)
+            {
+                max_slope = std::max(max_slope, c2 * t_top + c1 + c0 / t_top);
+            }
+        }
+
+        return max_slope;
+    }
+
+    bool HeightmapVisibility::is_ray_clear(const GridRay& ray) const
+    {
+        bool is_blocked = false;
+
+        struct BlockVisitor
+        {
+            const HeightmapVisibility& heightmap_visibility;
+            const GridRay& ray;
+            bool& is_blocked;
+
+            bool should_skip(const float max_altitude, const float t_enter, const float t_exit) const
+            {
+                const float min_ray_altitude = std::min(this->ray.y0 + this->ray.dy * t_enter, this->ray.y0 + this->ray.dy * t_exit);
+                return min_ray_altitude >= max_altitude - this->heightmap_visibility.altitude_tolerance;
+            }
+
+            bool visit_quad(const std::uint32_t quad_i, const std::uint32_t quad_j, const float t_enter, const float t_exit) const
+            {
+                this->is_blocked = this->heightmap_visibility.is_quad_above_ray(this->ray, quad_i, quad_j, t_enter, t_exit);
+                return this->is_blocked;
+            }
+        };
+
+        this->march(ray, BlockVisitor { *this, ray, is_blocked });
+        return !is_blocked;
+    }
+}
@@ -0,0 +1,184 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_GEOMETRY_HEIGHTMAP_VISIBILITY_HPP_INCLUDED
+#define YLIKUUTIO_GEOMETRY_HEIGHTMAP_VISIBILITY_HPP_INCLUDED
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t, std::uint32_t
+#include <vector>  // std::vector
+
+// `HeightmapVisibility` answers line of sight queries over a heightmap.
+//
+// How `HeightmapVisibility` works:
+//
+// The heightmap is a grid of `width` x `height` altitudes. Sample (i, j)
+// is at x = `origin.x` + i * `spacing.x`, z = `origin.y` + j * `spacing.y`,
+// and the terrain between the samples is bilinear. Outside of the grid
+// there is no terrain. A segment is blocked if the terrain rises above
+// it anywhere, touching the terrain does not block.
+//
+// Level 0 of the max-height pyramid holds the maximum altitude of each
+// quad of 4 samples, and each next level holds the maximum of 2 x 2
+// cells of the previous level. A ray is marched through the cells of the
+// pyramid: if the ray is above the maximum of a cell, the whole cell is
+// skipped and the march goes up a level, otherwise it goes down a level.
+// At level 0 the ray is tested against the bilinear quad exactly.
+//
+// Batched queries first resolve the rays that are above the terrain of
+// their whole footprint, in loops over packets of rays. The rest are
+// marched in lock step in the lanes of a packet, and a lane is refilled
+// with the next ray as soon as its ray is resolved. The loops that step
+// the lanes are branch-free, so that the compiler vectorizes them, and
+// only the gathering of the altitudes is scalar.
+//
+// A `Viewshed` caches the visibility from one observer: for each sample
+// the lowest altitude that is visible from the observer.
+
+namespace yli::geometry
+{
+    class Viewshed
+    {
+        public:
+            Viewshed() = default;
+
+            Viewshed(
+                    const glm::vec3& observer,
+                    std::vector<float>&& min_visible_altitudes,
+                    std::uint32_t width,
+                    std::uint32_t height,
+                    const glm::vec2& origin,
+                    const glm::vec2& spacing);
+
+            // Targets between the samples use the bilinearly interpolated
+            // minimum visible altitude, which is approximate.
+            // Targets outside of the grid are visible.
+            bool is_visible(const glm::vec3& target) const;
+
+            float get_min_visible_altitude(std::uint32_t i, std::uint32_t j) const;
+
+            const glm::vec3& get_observer() const noexcept;
+
+            bool empty() const noexcept;
+
+        private:
+            glm::vec3 observer { 0.0f, 0.0f, 0.0f };
+            std::vector<float> min_visible_altitudes;
+            std::uint32_t width { 0 };
+            std::uint32_t height { 0 };
+            glm::vec2 origin { 0.0f, 0.0f };
+            glm::vec2 inverse_spacing { 1.0f, 1.0f };
+    };
+
+    class HeightmapVisibility
+    {
+        public:
+            // `altitudes` are in row-major order, `width` samples per row.
+            HeightmapVisibility(
+                    std::vector<float>&& altitudes,
+                    std::uint32_t width,
+                    std::uint32_t height,
+                    const glm::vec2& origin = glm::vec2(0.0f, 0.0f),
+                    const glm::vec2& spacing = glm::vec2(1.0f, 1.0f));
+
+            HeightmapVisibility(const HeightmapVisibility&) = delete;            // Delete copy constructor.
+            HeightmapVisibility& operator=(const HeightmapVisibility&) = delete; // Delete copy assignment.
+
+            ~HeightmapVisibility() = default;
+
+            // Bilinear altitude of the terrain, `NAN` outside of the grid.
+            float get_altitude(float x, float z) const;
+
+            bool is_line_of_sight(const glm::vec3& from, const glm::vec3& to) const;
+
+            // Writes 1 to `results[i]` if there is line of sight from `from[i]` to `to[i]`, otherwise 0.
+            void are_lines_of_sight(
+                    const glm::vec3* from,
+                    const glm::vec3* to,
+                    std::size_t n_rays,
+                    std::uint8_t* results) const;
+
+            Viewshed compute_viewshed(const glm::vec3& observer) const;
+
+            std::uint32_t get_width() const noexcept;
+
+            std::uint32_t get_height() const noexcept;
+
+            std::size_t get_number_of_levels() const noexcept;
+
+            // Maximum altitude of cell (i, j) of pyramid level `level`.
+            float get_max_altitude(std::size_t level, std::uint32_t i, std::uint32_t j) const;
+
+        private:
+            struct Level
+            {
+                std::vector<float> max_altitudes;
+                std::uint32_t width;
+                std::uint32_t height;
+            };
+
+            // A segment in grid coordinates: u = (x - origin.x) / spacing.x, v likewise from z.
+            struct GridRay
+            {
+                float u0;
+                float v0;
+                float y0;
+                float du;
+                float dv;
+                float dy;
+                float t_min; // The part of the segment over the grid.
+                float t_max;
+            };
+
+            // Altitude of the terrain above the ray within a quad, `(c2 * s + c1) * s + c0` for `s = t - t_enter`.
+            struct QuadProfile
+            {
+                float c2;
+                float c1;
+                float c0;
+            };
+
+            bool clip(GridRay& ray) const;
+            float get_quad_corner(std::uint32_t i, std::uint32_t j) const;
+            QuadProfile get_quad_profile(const GridRay& ray, std::uint32_t i, std::uint32_t j, float t_enter) const;
+            bool is_quad_above_ray(const GridRay& ray, std::uint32_t i, std::uint32_t j, float t_enter, float t_exit) const;
+            float get_max_slope_in_quad(const GridRay& ray, std::uint32_t i, std::uint32_t j, float t_enter, float t_exit) const;
+            bool is_ray_clear(const GridRay& ray) const;
+            void march_packet(const std::vector<GridRay>& rays, const std::vector<std::size_t>& ray_indices, std::uint8_t* results) const;
+
+            template<typename Visitor>
+            void march(const GridRay& ray, Visitor&& visitor) const;
+
+            std::vector<float> altitudes;
+            std::vector<Level> levels;
+            std::uint32_t width;
+            std::uint32_t height;
+            glm::vec2 origin;
+            glm::vec2 spacing;
+            glm::vec2 inverse_spacing;
+            float altitude_tolerance; // Rounding errors below this do not block.
+    };
+}
+
+#endif
@@ -0,0 +1,754 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "spatial_hash_grid.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::max, std::min, std::pop_heap, std::push_heap, std::sort, std::sort_heap
+#include <cmath>     // std::floor, std::isfinite
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int32_t, std::int64_t, std::uint32_t, std::uint64_t
+#include <stdexcept> // std::runtime_error
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+namespace yli::geometry
+{
+    // Cell coordinates are clamped to 21 bits each, so that they fit in a 64-bit key.
+    static constexpr std::int32_t min_cell_coordinate { -(1 << 20) };
+    static constexpr std::int32_t max_cell_coordinate { (1 << 20) - 1 };
+
+    static constexpr std::size_t min_table_capacity { 16 };
+    static constexpr std::size_t min_empty_cells_to_remove { 64 };
+
+    static bool is_finite(const glm::vec3& point) noexcept
+    {
+        return std::isfinite(point.x) && std::isfinite(point.y) && std::isfinite(point.z);
+    }
+
+    static std::int32_t to_cell_coordinate(const float scaled) noexcept
+    {
+        // Also maps NaN to `min_cell_coordinate`.
+        if (!(scaled >= static_cast<float>(min_cell_coordinate)))
+        {
+            return min_cell_coordinate;
+        }
+
+        if (scaled >= static_cast<float>(max_cell_coordinate))
+        {
+            return max_cell_coordinate;
+        }
+
+        return static_cast<std::int32_t>(std::floor(scaled));
+    }
+
+    static std::uint64_t get_cell_key(const glm::ivec3& coordinates) noexcept
+    {
+        return (static_cast<std::uint64_t>(coordinates.x - min_cell_coordinate) << 42) |
+            (static_cast<std::uint64_t>(coordinates.y - min_cell_coordinate) << 21) |
+            static_cast<std::uint64_t>(coordinates.z - min_cell_coordinate);
+    }
+
+    static std::size_t hash_cell_key(const std::uint64_t key, const std::size_t mask) noexcept
+    {
+        return static_cast<std::size_t>((key * 0x9e3779b97f4a7c15ULL) >> 32) & mask;
+    }
+
+    static std::uint64_t get_volume(const glm::ivec3& min, const glm::ivec3& max) noexcept
+    {
+        if (min.x > max.x || min.y > max.y || min.z > max.z)
+        {
+            return 0;
+        }
+
+        return static_cast<std::uint64_t>(static_cast<std::int64_t>(max.x) - min.x + 1) *
+            static_cast<std::uint64_t>(static_cast<std::int64_t>(max.y) - min.y + 1) *
+            static_cast<std::uint64_t>(static_cast<std::int64_t>(max.z) - min.z + 1);
+    }
+
+    static std::int32_t get_chebyshev_distance(const glm::ivec3& lhs, const glm::ivec3& rhs) noexcept
+    {
+        const glm::ivec3 difference = glm::abs(lhs - rhs);
+        return std::max({ difference.x, difference.y, difference.z });
+    }
+
+    static bool is_accepted(const SpatialQueryFilter& filter, const std::uint32_t group, const std::int32_t proxy_id) noexcept
+    {
+        if (proxy_id == filter.excluded_proxy_id)
+        {
+            return false;
+        }
+
+        switch (filter.relation)
+        {
+            case GroupRelation::SAME:
+                return group == filter.group;
+            case GroupRelation::OTHER:
+                return group != filter.group;
+            default:
+                return true;
+        }
+    }
+
+    static bool is_nearer(const SpatialNeighbour& lhs, const SpatialNeighbour& rhs) noexcept
+    {
+        return lhs.distance_squared < rhs.distance_squared;
+    }
+
+    SpatialHashGrid::SpatialHashGrid(const float cell_size)
+        : cell_size { cell_size },
+          inverse_cell_size { 1.0f / cell_size }
+    {
+        if (!(cell_size > 0.0f) || !std::isfinite(cell_size)) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `SpatialHashGrid::SpatialHashGrid`: `cell_size` must be positive and finite!");
+        }
+    }
+
+    std::int32_t SpatialHashGrid::create_proxy(const glm::vec3& point, const std::uint32_t group, void* const user_data)
+    {
+        std::int32_t proxy_id;
+
+        if (this->free_proxy_ids.empty())
+        {
+            proxy_id = static_cast<std::int32_t>(this->proxies.size());
+            this->proxies.emplace_back();
+        }
+        else
+        {
+            proxy_id = this->free_proxy_ids.back();
+            this->free_proxy_ids.pop_back();
+        }
+
+        Proxy& proxy = this->proxies[proxy_id];
+        proxy.point = point;
+        proxy.user_data = user_data;
+        proxy.group = group;
+        proxy.is_in_use = true;
+
+        this->add_entry(proxy_id, point);
+        this->n_proxies++;
+        return proxy_id;
+    }
+
+    void SpatialHashGrid::destroy_proxy(const std::int32_t proxy_id)
+    {
+        if (!this->is_valid_proxy(proxy_id)) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `SpatialHashGrid::destroy_proxy`: invalid `proxy_id`!");
+        }
+
+        this->remove_entry(proxy_id);
+        this->proxies[proxy_id] = Proxy();
+        this->free_proxy_ids.push_back(proxy_id);
+        this->n_proxies--;
+        this->remove_empty_cells();
+    }
+
+    bool SpatialHashGrid::move_proxy(const std::int32_t proxy_id, const glm::vec3& point, const std::uint32_t group)
+    {
+        if (!this->is_valid_proxy(proxy_id)) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `SpatialHashGrid::move_proxy`: invalid `proxy_id`!");
+        }
+
+        Proxy& proxy = this->proxies[proxy_id];
+        proxy.point = point;
+        proxy.group = group;
+
+        const bool is_finite_point = is_finite(point);
+
+        if (proxy.cell_i >= 0 && is_finite_point &&
+                this->cells[proxy.cell_i].coordinates == this->get_cell_coordinates(point)) [[likely]]
+        {
+            Entry& entry = this->cells[proxy.cell_i].entries[proxy.entry_i];
+            entry.point = point;
+            entry.group = group;
+            return false;
+        }
+
+        if (proxy.cell_i < 0 && !is_finite_point)
+        {
+            return false;
+        }
+
+        this->remove_entry(proxy_id);
+        this->add_entry(proxy_id, point);
+        this->remove_empty_cells();
+        return true;
+    }
+
+    bool SpatialHashGrid::is_valid_proxy(const std::int32_t proxy_id) const noexcept
+    {
+        return proxy_id >= 0 &&
+            proxy_id < static_cast<std::int32_t>(this->proxies.size()) &&
+            this->proxies[proxy_id].is_in_use;
+    }
+
+    void* SpatialHashGrid::get_user_data(const std::int32_t proxy_id) const
+    {
+        return this->proxies.at(proxy_id).user_data;
+    }
+
+    const glm::vec3& SpatialHashGrid::get_point(const std::int32_t proxy_id) const
+    {
+        return this->proxies.at(proxy_id).point;
+    }
+
+    std::uint32_t SpatialHashGrid::get_group(const std::int32_t proxy_id) const
+    {
+        return this->proxies.at(proxy_id).group;
+    }
+
+    std::size_t SpatialHashGrid::get_number_of_proxies() const noexcept
+    {
+        return this->n_proxies;
+    }
+
+    std::size_t SpatialHashGrid::get_number_of_cells() const noexcept
+    {
+        return this->cells.size() - this->n_empty_cells;
+    }
+
+    float SpatialHashGrid::get_cell_size() const noexcept
+    {
+        return this->cell_size;
+    }
+
+    void SpatialHashGrid::query_radius(
+            const glm::vec3& center,
+            const float radius,
+            const SpatialQueryFilter& filter,
+            std::vector<SpatialNeighbour>& neighbours) const
+    {
+        if (!is_finite(center) || !(radius >= 0.0f) || this->cells.empty())
+        {
+            return;
+        }
+
+        const float radius_squared = radius * radius;
+        const glm::ivec3 min = glm::max(this->get_cell_coordinates(center - glm::vec3(radius)), this->occupied_min);
+        const glm::ivec3 max = glm::min(this->get_cell_coordinates(center + glm::vec3(radius)), this->occupied_max);
+
+        this->visit_cells_in_box(
+                min,
+                max,
+                [&](const Cell& cell)
+                {
+                    if (this->get_distance_squared_to_cell(center, cell.coordinates) > radius_squared)
+                    {
+                        return;
+                    }
+
+                    for (const Entry& entry : cell.entries)
+                    {
+                        if (!is_accepted(filter, entry.group, entry.proxy_id))
+                        {
+                            continue;
+                        }
+
+                        const glm::vec3 difference = entry.point - center;
+
+                        if (const float distance_squared = glm::dot(difference, difference); distance_squared <= radius_squared)
+                        {
+                            neighbours.push_back(SpatialNeighbour { entry.proxy_id, distance_squared });
+                        }
+                    }
+                });
+    }
+
+    void SpatialHashGrid::query_nearest(
+            const glm::vec3& center,
+            const std::size_t k,
+            const SpatialQueryFilter& filter,
+            std::vector<SpatialNeighbour>& neighbours,
+            const float max_distance) const
+    {
+        neighbours.clear();
+
+        if (k == 0 || !is_finite(center) || !(max_distance >= 0.0f) || this->cells.empty())
+        {
+            return;
+        }
+
+        // `heap` is a max-heap of the best candidates, the farthest first.
+        std::vector<SpatialNeighbour>& heap = this->heap;
+        heap.clear();
+
+        const float max_distance_squared = max_distance * max_distance;
+
+        auto get_bound = [&]() -> float
+        {
+            return (heap.size() < k ? max_distance_squared : heap.front().distance_squared);
+        };
+
+        auto visit_cell = [&](const Cell& cell)
+        {
+            if (this->get_distance_squared_to_cell(center, cell.coordinates) > get_bound())
+            {
+                return;
+            }
+
+            for (const Entry& entry : cell.entries)
+            {
+                if (!is_accepted(filter, entry.group, entry.proxy_id))
+                {
+                    continue;
+                }
+
+                const glm::vec3 difference = entry.point - center;
+                const float distance_squared = glm::dot(difference, difference);
+
+                if (heap.size() < k)
+                {
+                    if (distance_squared <= max_distance_squared)
+                    {
+                        heap.push_back(SpatialNeighbour { entry.proxy_id, distance_squared });
+                        std::push_heap(heap.begin(), heap.end(), is_nearer);
+                    }
+                }
+                else if (distance_squared < heap.front().distance_squared)
+                {
+                    std::pop_heap(heap.begin(), heap.end(), is_nearer);
+                    heap.back() = SpatialNeighbour { entry.proxy_id, distance_squared };
+                    std::push_heap(heap.begin(), heap.end(), is_nearer);
+                }
+            }
+        };
+
+        const glm::ivec3 center_cell = this->get_cell_coordinates(center);
+
+        // Start from the first ring that reaches the occupied cells.
+        const glm::ivec3 gap = glm::max(
+                glm::max(this->occupied_min - center_cell, center_cell - this->occupied_max),
+                glm::ivec3(0));
+
+        for (std::int32_t ring = std::max({ gap.x, gap.y, gap.z }); ; ring++)
+        {
+            // Every cell of the ring is at least `ring - 1` cells away from `center`.
+            if (ring > 0)
+            {
+                const float min_distance = static_cast<float>(ring - 1) * this->cell_size;
+
+                if (min_distance * min_distance > get_bound())
+                {
+                    break;
+                }
+            }
+
+            const glm::ivec3 ring_min = glm::max(center_cell - ring, this->occupied_min);
+            const glm::ivec3 ring_max = glm::min(center_cell + ring, this->occupied_max);
+            const std::uint64_t n_ring_cells = get_volume(ring_min, ring_max) -
+                (ring > 0 ?
+                 get_volume(glm::max(center_cell - (ring - 1), this->occupied_min), glm::min(center_cell + (ring - 1), this->occupied_max)) :
+                 0);
+
+            if (n_ring_cells > this->cells.size())
+            {
+                // Scanning the remaining cells is cheaper than looking up the ring.
+                for (const Cell& cell : this->cells)
+                {
+                    if (get_chebyshev_distance(cell.coordinates, center_cell) >= ring)
+                    {
+                        visit_cell(cell);
+                    }
+                }
+
+                break;
+            }
+
+            for (std::int32_t x = ring_min.x; x <= ring_max.x; x++)
+            {
+                for (std::int32_t y = ring_min.y; y <= ring_max.y; y++)
+                {
+                    auto visit = [&](const std::int32_t z)
+                    {
+                        if (const std::int32_t cell_i = this->find_cell(get_cell_key(glm::ivec3(x, y, z))); cell_i >= 0)
+                        {
+                            visit_cell(this->cells[cell_i]);
+                        }
+                    };
+
+                    if (x == center_cell.x - ring || x == center_cell.x + ring ||
+                            y == center_cell.y - ring || y == center_cell.y + ring)
+                    {
+                        for (std::int32_t z = ring_min.z; z <= ring_max.z; z++)
+                        {
+                            visit(z);
+                        }
+
+                        continue;
+                    }
+
+                    // Inside the ring in x and y, only the two z faces belong to the ring.
+                    if (center_cell.z - ring >= ring_min.z)
+                    {
+                        visit(center_cell.z - ring);
+                    }
+
+                    if (ring > 0 && center_cell.z + ring <= ring_max.z)
+                    {
+                        visit(center_cell.z + ring);
+                    }
+                }
+            }
+
+            if (glm::all(glm::lessThanEqual(center_cell - ring, this->occupied_min)) &&
+                    glm::all(glm::greaterThanEqual(center_cell + ring, this->occupied_max)))
+            {
+                // All occupied cells have been visited.
+                break;
+            }
+        }
+
+        std::sort_heap(heap.begin(), heap.end(), is_nearer);
+        neighbours.assign(heap.begin(), heap.end());
+    }
+
+    void SpatialHashGrid::sort_nearest_first(std::vector<SpatialNeighbour>& neighbours)
+    {
+        std::sort(
+                neighbours.begin(),
+                neighbours.end(),
+                [](const SpatialNeighbour& lhs, const SpatialNeighbour& rhs)
+                {
+                    return lhs.distance_squared < rhs.distance_squared ||
+                        (lhs.distance_squared == rhs.distance_squared && lhs.proxy_id < rhs.proxy_id);
+                });
+    }
+
+    bool SpatialHashGrid::validate() const
+    {
+        std::size_t n_in_use = 0;
+
+        for (std::size_t proxy_id = 0; proxy_id < this->proxies.size(); proxy_id++)
+        {
+            const Proxy& proxy = this->proxies[proxy_id];
+
+            if (!proxy.is_in_use)
+            {
+                if (proxy.cell_i != -1)
+                {
+                    return false;
+                }
+
+                continue;
+            }
+
+            n_in_use++;
+
+            if (proxy.cell_i < 0)
+            {
+                if (is_finite(proxy.point))
+                {
+                    return false;
+                }
+
+                continue;
+            }
+
+            if (proxy.cell_i >= static_cast<std::int32_t>(this->cells.size()))
+            {
+                return false;
+            }
+
+            const Cell& cell = this->cells[proxy.cell_i];
+
+            if (proxy.entry_i < 0 || proxy.entry_i >= static_cast<std::int32_t>(cell.entries.size()))
+            {
+                return false;
+            }
+
+            const Entry& entry = cell.entries[proxy.entry_i];
+
+            if (entry.proxy_id != static_cast<std::int32_t>(proxy_id) ||
+                    entry.point != proxy.point ||
+                    entry.group != proxy.group ||
+                    cell.coordinates != this->get_cell_coordinates(proxy.point))
+            {
+                return false;
+            }
+        }
+
+        if (n_in_use != this->n_proxies || n_in_use + this->free_proxy_ids.size() != this->proxies.size())
+        {
+            return false;
+        }
+
+        std::size_t n_entries = 0;
+        std::size_t n_empty_cells = 0;
+
+        for (std::size_t cell_i = 0; cell_i < this->cells.size(); cell_i++)
+        {
+            const Cell& cell = this->cells[cell_i];
+
+            if (cell.key != get_cell_key(cell.coordinates) ||
+                    this->find_cell(cell.key) != static_cast<std::int32_t>(cell_i) ||
+                    glm::any(glm::lessThan(cell.coordinates, this->occupied_min)) ||
+                    glm::any(glm::greaterThan(cell.coordinates, this->occupied_max)))
+            {
+                return false;
+            }
+
+            n_entries += cell.entries.size();
+            n_empty_cells += (cell.entries.empty() ? 1 : 0);
+        }
+
+        std::size_t n_finite = 0;
+
+        for (const Proxy& proxy : this->proxies)
+        {
+            n_finite += (proxy.is_in_use && proxy.cell_i >= 0 ? 1 : 0);
+        }
+
+        return n_entries == n_finite && n_empty_cells == this->n_empty_cells && this->cells.size() * 2 <= this->table.size();
+    }
+
+    glm::ivec3 SpatialHashGrid::get_cell_coordinates(const glm::vec3& point) const noexcept
+    {
+        const glm::vec3 scaled = point * this->inverse_cell_size;
+        return glm::ivec3(to_cell_coordinate(scaled.x), to_cell_coordinate(scaled.y), to_cell_coordinate(scaled.z));
+    }
+
+    std::int32_t SpatialHashGrid::find_cell(const std::uint64_t key) const noexcept
+    {
+        if (this->table.empty())
+        {
+            return -1;
+        }
+
+        const std::size_t mask = this->table.size() - 1;
+
+        for (std::size_t slot_i = hash_cell_key(key, mask); ; slot_i = (slot_i + 1) & mask)
+        {
+            const std::int32_t cell_i = this->table[slot_i];
+
+            if (cell_i < 0 || this->cells[cell_i].key == key)
+            {
+                return cell_i;
+            }
+        }
+    }
+
+    std::int32_t SpatialHashGrid::get_or_create_cell(const glm::ivec3& coordinates, const std::uint64_t key)
+    {
+        if (const std::int32_t cell_i = this->find_cell(key); cell_i >= 0)
+        {
+            return cell_i;
+        }
+
+        // Keep the load factor at most 1/2.
+        if ((this->cells.size() + 1) * 2 > this->table.size())
+        {
+            this->rebuild_table(std::max(min_table_capacity, this->table.size() * 2));
+        }
+
+        if (this->cells.empty())
+        {
+            this->occupied_min = coordinates;
+            this->occupied_max = coordinates;
+        }
+        else
+        {
+            this->occupied_min = glm::min(this->occupied_min, coordinates);
+            this->occupied_max = glm::max(this->occupied_max, coordinates);
+        }
+
+        const std::int32_t cell_i = static_cast<std::int32_t>(this->cells.size());
+        this->cells.push_back(Cell { coordinates, key, std::vector<Entry>() });
+        this->insert_into_table(cell_i);
+        this->n_empty_cells++;
+        return cell_i;
+    }
+
+    void SpatialHashGrid::insert_into_table(const std::int32_t cell_i)
+    {
+        const std::size_t mask = this->table.size() - 1;
+        std::size_t slot_i = hash_cell_key(this->cells[cell_i].key, mask);
+
+        while (this->table[slot_i] >= 0)
+        {
+            slot_i = (slot_i + 1) & mask;
+        }
+
+        this->table[slot_i] = cell_i;
+    }
+
+    void SpatialHashGrid::rebuild_table(const std::size_t capacity)
+    {
+        this->table.assign(capacity, -1);
+
+        for (std::size_t cell_i = 0; cell_i < this->cells.size(); cell_i++)
+        {
+            this->insert_into_table(static_cast<std::int32_t>(cell_i));
+        }
+    }
+
+    void SpatialHashGrid::add_entry(const std::int32_t proxy_id, const glm::vec3& point)
+    {
+        Proxy& proxy = this->proxies[proxy_id];
+
+        if (!is_finite(point))
+        {
+            proxy.cell_i = -1;
+            proxy.entry_i = -1;
+            return;
+        }
+
+        const glm::ivec3 coordinates = this->get_cell_coordinates(point);
+        const std::int32_t cell_i = this->get_or_create_cell(coordinates, get_cell_key(coordinates));
+        Cell& cell = this->cells[cell_i];
+
+        if (cell.entries.empty())
+        {
+            this->n_empty_cells--;
+        }
+
+        proxy.cell_i = cell_i;
+        proxy.entry_i = static_cast<std::int32_t>(cell.entries.size());
+        cell.entries.push_back(Entry { point, proxy.group, proxy_id });
+    }
+
+    void SpatialHashGrid::remove_entry(const std::int32_t proxy_id)
+    {
+        Proxy& proxy = this->proxies[proxy_id];
+
+        if (proxy.cell_i < 0)
+        {
+            return;
+        }
+
+        std::vector<Entry>& entries = this->cells[proxy.cell_i].entries;
+
+        // Swap with the last entry.
+        const Entry& last_entry = entries.back();
+        this->proxies[last_entry.proxy_id].entry_i = proxy.entry_i;
+        entries[proxy.entry_i] = last_entry;
+        entries.pop_back();
+
+        if (entries.empty())
+        {
+            this->n_empty_cells++;
+        }
+
+        proxy.cell_i = -1;
+        proxy.entry_i = -1;
+    }
+
+    void SpatialHashGrid::remove_empty_cells()
+    {
+        if (this->n_empty_cells < min_empty_cells_to_remove || this->n_empty_cells * 2 <= this->cells.size())
+        {
+            return;
+        }
+
+        std::vector<Cell> occupied_cells;
+        occupied_cells.reserve(this->cells.size() - this->n_empty_cells);
+
+        for (Cell& cell : this->cells)
+        {
+            if (cell.entries.empty())
+            {
+                continue;
+            }
+
+            const std::int32_t cell_i = static_cast<std::int32_t>(occupied_cells.size());
+
+            for (const Entry& entry : cell.entries)
+            {
+                this->proxies[entry.proxy_id].cell_i = cell_i;
+            }
+
+            if (occupied_cells.empty())
+            {
+                this->occupied_min = cell.coordinates;
+                this->occupied_max = cell.coordinates;
+            }
+            else
+            {
+                this->occupied_min = glm::min(this->occupied_min, cell.coordinates);
+                this->occupied_max = glm::max(this->occupied_max, cell.coordinates);
+            }
+
+            occupied_cells.push_back(std::move(cell));
+        }
+
+        this->cells = std::move(occupied_cells);
+        this->n_empty_cells = 0;
+
+        std::size_t capacity = min_table_capacity;
+
+        while (capacity < this->cells.size() * 2)
+        {
+            capacity *= 2;
+        }
+
+        this->rebuild_table(capacity);
+    }
+
+    float SpatialHashGrid::get_distance_squared_to_cell(const glm::vec3& point, const glm::ivec3& coordinates) const noexcept
+    {
+        const glm::vec3 cell_min = glm::vec3(coordinates) * this->cell_size;
+        const glm::vec3 cell_max = cell_min + this->cell_size;
+        const glm::vec3 difference = glm::max(glm::max(cell_min - point, point - cell_max), glm::vec3(0.0f));
+        return glm::dot(difference, difference);
+    }
+
+    template<typename Visitor>
+    void SpatialHashGrid::visit_cells_in_box(const glm::ivec3& min, const glm::ivec3& max, Visitor&& visitor) const
+    {
+        const std::uint64_t volume = get_volume(min, max);
+
+        if (volume == 0)
+        {
+            return;
+        }
+
+        if (volume > this->cells.size())
+        {
+            // Scanning the cells is cheaper than looking up the box.
+            for (const Cell& cell : this->cells)
+            {
+                if (glm::all(glm::greaterThanEqual(cell.coordinates, min)) && glm::all(glm::lessThanEqual(cell.coordinates, max)))
+                {
+                    visitor(cell);
+                }
+            }
+
+            return;
+        }
+
+        for (std::int32_t x = min.x; x <= max.x; x++)
+        {
+            for (std::int32_t y = min.y; y <= max.y; y++)
+            {
+                for (std::int32_t z = min.z; z <= max.z; z++)
+                {
+                    if (const std::int32_t cell_i = this->find_cell(get_cell_key(glm::ivec3(x, y, z))); cell_i >= 0)
+                    {
+                        visitor(this->cells[cell_i]);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,178 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#ifndef YLIKUUTIO_GEOMETRY_SPATIAL_HASH_GRID_HPP_INCLUDED
+#define YLIKUUTIO_GEOMETRY_SPATIAL_HASH_GRID_HPP_INCLUDED
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int32_t, std::uint32_t, std::uint64_t
+#include <limits>  // std::numeric_limits
+#include <vector>  // std::vector
+
+// `SpatialHashGrid` is a uniform grid of points for neighbour queries.
+//
+// How `SpatialHashGrid` works:
+//
+// Space is divided into cubic cells of `cell_size`. Only occupied cells
+// exist: they are found through an open addressing hash table keyed by
+// the cell coordinates. Each cell stores the points of its proxies
+// together with their groups, so queries read one contiguous array per
+// cell. `move_proxy` only touches the cells when the point moves to
+// another cell. Cells that become empty are removed lazily, when they
+// are the majority.
+//
+// Radius queries visit the cells overlapping the query sphere. Nearest
+// neighbour queries visit rings of cells around the query point, until
+// the next ring can not be closer than the `k`th best point found.
+// A proxy whose point is not finite is kept but not placed in any cell.
+
+namespace yli::geometry
+{
+    enum class GroupRelation
+    {
+        ANY,
+        SAME,
+        OTHER
+    };
+
+    struct SpatialQueryFilter
+    {
+        std::uint32_t group { 0 };
+        GroupRelation relation { GroupRelation::ANY };
+        std::int32_t excluded_proxy_id { -1 }; // E.g. the proxy of the querying entity.
+    };
+
+    struct SpatialNeighbour
+    {
+        std::int32_t proxy_id;
+        float distance_squared;
+    };
+
+    class SpatialHashGrid
+    {
+        public:
+            static constexpr std::int32_t null_proxy { -1 };
+
+            explicit SpatialHashGrid(float cell_size = 16.0f);
+
+            SpatialHashGrid(const SpatialHashGrid&) = delete;            // Delete copy constructor.
+            SpatialHashGrid& operator=(const SpatialHashGrid&) = delete; // Delete copy assignment.
+
+            ~SpatialHashGrid() = default;
+
+            // Returns the proxy ID.
+            std::int32_t create_proxy(const glm::vec3& point, std::uint32_t group, void* user_data);
+
+            void destroy_proxy(std::int32_t proxy_id);
+
+            // Returns `true` if the proxy moved to another cell.
+            bool move_proxy(std::int32_t proxy_id, const glm::vec3& point, std::uint32_t group);
+
+            bool is_valid_proxy(std::int32_t proxy_id) const noexcept;
+
+            void* get_user_data(std::int32_t proxy_id) const;
+
+            const glm::vec3& get_point(std::int32_t proxy_id) const;
+
+            std::uint32_t get_group(std::int32_t proxy_id) const;
+
+            std::size_t get_number_of_proxies() const noexcept;
+
+            std::size_t get_number_of_cells() const noexcept;
+
+            float get_cell_size() const noexcept;
+
+            // Appends the proxies within `radius` of `center` to `neighbours`, in no particular order.
+            void query_radius(
+                    const glm::vec3& center,
+                    float radius,
+                    const SpatialQueryFilter& filter,
+                    std::vector<SpatialNeighbour>& neighbours) const;
+
+            // Replaces `neighbours` with the `k` nearest proxies within `max_distance`, nearest first.
+            void query_nearest(
+                    const glm::vec3& center,
+                    std::size_t k,
+                    const SpatialQueryFilter& filter,
+                    std::vector<SpatialNeighbour>& neighbours,
+                    float max_distance = std::numeric_limits<float>::infinity()) const;
+
+            // Sorts `neighbours` by distance, nearest first, ties by proxy ID.
+            static void sort_nearest_first(std::vector<SpatialNeighbour>& neighbours);
+
+            // Checks the structural invariants, for tests.
+            bool validate() const;
+
+        private:
+            struct Entry
+            {
+                glm::vec3 point;
+                std::uint32_t group;
+                std::int32_t proxy_id;
+            };
+
+            struct Cell
+            {
+                glm::ivec3 coordinates;
+                std::uint64_t key;
+                std::vector<Entry> entries;
+            };
+
+            struct Proxy
+            {
+                glm::vec3 point { 0.0f, 0.0f, 0.0f };
+                void* user_data { nullptr };
+                std::uint32_t group { 0 };
+                std::int32_t cell_i { -1 };  // -1 if the point is not finite or the proxy is free.
+                std::int32_t entry_i { -1 };
+                bool is_in_use { false };
+            };
+
+            glm::ivec3 get_cell_coordinates(const glm::vec3& point) const noexcept;
+            std::int32_t find_cell(std::uint64_t key) const noexcept;
+            std::int32_t get_or_create_cell(const glm::ivec3& coordinates, std::uint64_t key);
+            void insert_into_table(std::int32_t cell_i);
+            void rebuild_table(std::size_t capacity);
+            void add_entry(std::int32_t proxy_id, const glm::vec3& point);
+            void remove_entry(std::int32_t proxy_id);
+            void remove_empty_cells();
+            float get_distance_squared_to_cell(const glm::vec3& point, const glm::ivec3& coordinates) const noexcept;
+
+            template<typename Visitor>
+            void visit_cells_in_box(const glm::ivec3& min, const glm::ivec3& max, Visitor&& visitor) const;
+
+            std::vector<Proxy> proxies;
+            std::vector<std::int32_t> free_proxy_ids;
+            std::vector<Cell> cells;
+            std::vector<std::int32_t> table; // Cell indices, -1 for an empty slot.
+            mutable std::vector<SpatialNeighbour> heap;
+            glm::ivec3 occupied_min { 0, 0, 0 }; // Bounds of the cell coordinates, may be loose.
+            glm::ivec3 occupied_max { -1, -1, -1 };
+            std::size_t n_proxies { 0 };
+            std::size_t n_empty_cells { 0 };
+            float cell_size;
+            float inverse_cell_size;
+    };
+}
+
+#endif
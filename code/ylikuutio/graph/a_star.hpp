@@ -0,0 +1,221 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_GRAPH_A_STAR_HPP_INCLUDED
+#define YLIKUUTIO_GRAPH_A_STAR_HPP_INCLUDED
+
+// Include standard headers
+#include <algorithm> // std::fill, std::pop_heap, std::push_heap, std::reverse
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <limits>    // std::numeric_limits
+#include <vector>    // std::vector
+
+// A* search over any graph which provides:
+//
+// `std::size_t get_number_of_nodes() const`
+// `float get_heuristic(std::uint32_t node, std::uint32_t goal) const`, which must not overestimate.
+// `void for_each_neighbour(std::uint32_t node, F&& f) const`, which calls `f(neighbour, cost)`.
+//
+// The per-search arrays live in an `AStarWorkspace`, which is reused
+// between searches: a search only bumps the generation of the workspace
+// instead of clearing arrays of the size of the graph. A workspace must
+// not be shared between threads.
+
+namespace yli::graph
+{
+    inline constexpr std::uint32_t invalid_node { std::numeric_limits<std::uint32_t>::max() };
+
+    class AStarWorkspace
+    {
+        public:
+            // Starts a new search over a graph of `n_nodes` nodes.
+            void prepare(const std::size_t n_nodes)
+            {
+                if (this->costs.size() < n_nodes)
+                {
+                    this->costs.resize(n_nodes);
+                    this->parents.resize(n_nodes);
+                    this->generations.resize(n_nodes, 0);
+                }
+
+                // Generations advance by 2: `generation` marks the open nodes and `generation + 1` the closed ones.
+                if (this->generation >= std::numeric_limits<std::uint32_t>::max() - 3) [[unlikely]]
+                {
+                    // Before the generation wraps around, so that old stamps can not match.
+                    std::fill(this->generations.begin(), this->generations.end(), 0);
+                    this->generation = 0;
+                }
+
+                this->generation += 2;
+
+                this->open.clear();
+                this->n_expanded = 0;
+            }
+
+            // Cost of the cheapest path found to `node` in the latest search, infinite if not reached.
+            float get_cost(const std::uint32_t node) const
+            {
+                return (this->is_reached(node) ? this->costs[node] : std::numeric_limits<float>::infinity());
+            }
+
+            bool is_reached(const std::uint32_t node) const
+            {
+                return node < this->generations.size() &&
+                    (this->generations[node] == this->generation || this->generations[node] == this->generation + 1);
+            }
+
+            // Appends the path from the start of the latest search to `node`.
+            void append_path(const std::uint32_t node, std::vector<std::uint32_t>& path) const
+            {
+                const std::size_t first_i = path.size();
+
+                for (std::uint32_t path_node = node; path_node != invalid_node; path_node = this->parents[path_node])
+                {
+                    path.emplace_back(path_node);
+                }
+
+                std::reverse(path.begin() + first_i, path.end());
+            }
+
+            std::size_t get_number_of_expanded_nodes() const
+            {
+                return this->n_expanded;
+            }
+
+        private:
+            struct OpenEntry
+            {
+                float priority;
+                std::uint32_t node;
+
+                bool operator<(const OpenEntry& other) const
+                {
+                    // `std::push_heap` builds a max-heap, so the lowest priority is the greatest.
+                    return this->priority > other.priority;
+                }
+            };
+
+            template<typename Graph>
+                friend bool search(const Graph& graph, std::uint32_t start, std::uint32_t goal, AStarWorkspace& workspace);
+
+            bool is_closed(const std::uint32_t node) const
+            {
+                return this->generations[node] == this->generation + 1;
+            }
+
+            std::vector<float> costs;
+            std::vector<std::uint32_t> parents;
+            std::vector<std::uint32_t> generations;
+            std::vector<OpenEntry> open;
+            std::uint32_t generation { 0 };
+            std::size_t n_expanded { 0 };
+    };
+
+    // Searches from `start` until `goal` is reached, or until all reachable nodes
+    // are reached if `goal` is `invalid_node` (Dijkstra). Returns `true` if `goal` was reached.
+    template<typename Graph>
+        bool search(const Graph& graph, const std::uint32_t start, const std::uint32_t goal, AStarWorkspace& workspace)
+        {
+            const std::size_t n_nodes = graph.get_number_of_nodes();
+
+            workspace.prepare(n_nodes);
+
+            if (start >= n_nodes || (goal != invalid_node && goal >= n_nodes)) [[unlikely]]
+            {
+                return false;
+            }
+
+            workspace.costs[start] = 0.0f;
+            workspace.parents[start] = invalid_node;
+            workspace.generations[start] = workspace.generation;
+            workspace.open.push_back({ (goal != invalid_node ? graph.get_heuristic(start, goal) : 0.0f), start });
+
+            while (!workspace.open.empty())
+            {
+                std::pop_heap(workspace.open.begin(), workspace.open.end());
+                const std::uint32_t node = workspace.open.back().node;
+                workspace.open.pop_back();
+
+                if (workspace.is_closed(node))
+                {
+                    // A stale entry, `node` was already expanded through a cheaper path.
+                    continue;
+                }
+
+                workspace.generations[node] = workspace.generation + 1;
+                workspace.n_expanded++;
+
+                if (node == goal)
+                {
+                    return true;
+                }
+
+                const float node_cost = workspace.costs[node];
+
+                graph.for_each_neighbour(node, [&](const std::uint32_t neighbour, const float cost)
+                        {
+                            const float neighbour_cost = node_cost + cost;
+
+                            if (workspace.generations[neighbour] == workspace.generation + 1)
+                            {
+                                return;
+                            }
+
+                            if (workspace.generations[neighbour] == workspace.generation && workspace.costs[neighbour] <= neighbour_cost)
+                            {
+                                return;
+                            }
+
+                            workspace.costs[neighbour] = neighbour_cost;
+                            workspace.parents[neighbour] = node;
+                            workspace.generations[neighbour] = workspace.generation;
+                            workspace.open.push_back({
+                                    neighbour_cost + (goal != invalid_node ? graph.get_heuristic(neighbour, goal) : 0.0f),
+                                    neighbour });
+                            std::push_heap(workspace.open.begin(), workspace.open.end());
+                        });
+            }
+
+            return false;
+        }
+
+    // Replaces `path` with the cheapest path from `start` to `goal`. Returns `false` if there is none.
+    template<typename Graph>
+        bool find_path(
+                const Graph& graph,
+                const std::uint32_t start,
+                const std::uint32_t goal,
+                AStarWorkspace& workspace,
+                std::vector<std::uint32_t>& path,
+                float& cost)
+        {
+            path.clear();
+            cost = std::numeric_limits<float>::infinity();
+
+            if (goal == invalid_node || !search(graph, start, goal, workspace))
+            {
+                return false;
+            }
+
+            workspace.append_path(goal, path);
+            cost = workspace.get_cost(goal);
+            return true;
+        }
+}
+
+#endif
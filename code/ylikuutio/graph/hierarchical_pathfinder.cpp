@@ -0,0 +1,495 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "hierarchical_pathfinder.hpp"
+#include "a_star.hpp"
+#include "navigation_grid.hpp"
+
+// Include standard headers
+#include <algorithm> // std::min
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <limits>    // std::numeric_limits
+#include <memory>    // std::shared_ptr
+#include <stdexcept> // std::runtime_error
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+namespace yli::graph
+{
+    // Walkable stretches of a border at least this long get an entrance at both ends.
+    static constexpr std::uint32_t min_double_entrance_length { 6 };
+
+    static float get_step_cost(const NavigationGrid& grid, const std::uint32_t from, const std::uint32_t to)
+    {
+        float step_cost = std::numeric_limits<float>::infinity();
+
+        grid.for_each_neighbour(from, [&](const std::uint32_t neighbour, const float cost)
+                {
+                    if (neighbour == to)
+                    {
+                        step_cost = cost;
+                    }
+                });
+
+        return step_cost;
+    }
+
+    // The abstract graph with the start and the goal of a query as 2 extra nodes.
+    class HierarchicalPathfinder::QueryView
+    {
+        public:
+            QueryView(
+                    const HierarchicalPathfinder& pathfinder,
+                    const std::uint32_t goal_cell,
+                    const std::vector<Link>& start_links,
+                    const std::vector<Link>& goal_links)
+                : pathfinder { pathfinder },
+                goal_cell { goal_cell },
+                goal_cluster { pathfinder.get_cluster(goal_cell) },
+                start_links { start_links },
+                goal_links { goal_links }
+            {
+            }
+
+            std::uint32_t get_start_node() const noexcept
+            {
+                return static_cast<std::uint32_t>(this->pathfinder.abstract_cells.size());
+            }
+
+            std::uint32_t get_goal_node() const noexcept
+            {
+                return static_cast<std::uint32_t>(this->pathfinder.abstract_cells.size() + 1);
+            }
+
+            std::size_t get_number_of_nodes() const noexcept
+            {
+                return this->pathfinder.abstract_cells.size() + 2;
+            }
+
+            std::uint32_t get_cell(const std::uint32_t node, const std::uint32_t start_cell) const noexcept
+            {
+                if (node == this->get_start_node())
+                {
+                    return start_cell;
+                }
+
+                if (node == this->get_goal_node())
+                {
+                    return this->goal_cell;
+                }
+
+                return this->pathfinder.abstract_cells[node];
+            }
+
+            float get_heuristic(const std::uint32_t node, const std::uint32_t /* goal */) const
+            {
+                if (node >= this->pathfinder.abstract_cells.size())
+                {
+                    // Only the start is searched from, and the goal is never expanded.
+                    return 0.0f;
+                }
+
+                return this->pathfinder.grid->get_heuristic(this->pathfinder.abstract_cells[node], this->goal_cell);
+            }
+
+            template<typename F>
+                void for_each_neighbour(const std::uint32_t node, F&& f) const
+                {
+                    if (node == this->get_start_node())
+                    {
+                        for (const Link& link : this->start_links)
+                        {
+                            f(link.abstract_node, link.cost);
+                        }
+
+                        return;
+                    }
+
+                    if (node == this->get_goal_node())
+                    {
+                        return;
+                    }
+
+                    for (std::uint32_t edge_i = this->pathfinder.first_edges[node]; edge_i < this->pathfinder.first_edges[node + 1]; edge_i++)
+                    {
+                        f(this->pathfinder.edge_targets[edge_i], this->pathfinder.edge_costs[edge_i]);
+                    }
+
+                    if (this->pathfinder.get_cluster(this->pathfinder.abstract_cells[node]) == this->goal_cluster)
+                    {
+                        for (const Link& link : this->goal_links)
+                        {
+                            if (link.abstract_node == node)
+                            {
+                                f(this->get_goal_node(), link.cost);
+                            }
+                        }
+                    }
+                }
+
+        private:
+            const HierarchicalPathfinder& pathfinder;
+            std::uint32_t goal_cell;
+            std::uint32_t goal_cluster;
+            const std::vector<Link>& start_links;
+            const std::vector<Link>& goal_links;
+    };
+
+    HierarchicalPathfinder::HierarchicalPathfinder(std::shared_ptr<const NavigationGrid> grid, const std::uint32_t cluster_size)
+        : grid(std::move(grid)),
+        cluster_size { cluster_size }
+    {
+        if (this->grid == nullptr) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `HierarchicalPathfinder::HierarchicalPathfinder`: `grid` is `nullptr`!");
+        }
+
+        if (this->cluster_size < 2) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `HierarchicalPathfinder::HierarchicalPathfinder`: `cluster_size` must be at least 2!");
+        }
+
+        const std::uint32_t width = this->grid->get_width();
+        const std::uint32_t height = this->grid->get_height();
+        this->n_clusters_i = (width + this->cluster_size - 1) / this->cluster_size;
+        this->n_clusters_j = (height + this->cluster_size - 1) / this->cluster_size;
+        this->abstract_node_of_cell.assign(this->grid->get_number_of_nodes(), invalid_node);
+
+        std::vector<std::uint32_t> edge_sources;
+        std::vector<std::uint32_t> edge_targets;
+        std::vector<float> edge_costs;
+
+        // Entrances over the borders between clusters side by side, then between clusters on top of each other.
+        for (std::uint32_t cluster_j = 0; cluster_j < this->n_clusters_j; cluster_j++)
+        {
+            const std::uint32_t j_begin = cluster_j * this->cluster_size;
+            const std::uint32_t border_length = std::min(this->cluster_size, height - j_begin);
+
+            for (std::uint32_t cluster_i = 0; cluster_i + 1 < this->n_clusters_i; cluster_i++)
+            {
+                const std::uint32_t i = (cluster_i + 1) * this->cluster_size - 1;
+                this->add_entrances(this->grid->get_cell(i, j_begin), width, 1, border_length, edge_sources, edge_targets, edge_costs);
+            }
+        }
+
+        for (std::uint32_t cluster_i = 0; cluster_i < this->n_clusters_i; cluster_i++)
+        {
+            const std::uint32_t i_begin = cluster_i * this->cluster_size;
+            const std::uint32_t border_length = std::min(this->cluster_size, width - i_begin);
+
+            for (std::uint32_t cluster_j = 0; cluster_j + 1 < this->n_clusters_j; cluster_j++)
+            {
+                const std::uint32_t j = (cluster_j + 1) * this->cluster_size - 1;
+                this->add_entrances(this->grid->get_cell(i_begin, j), 1, width, border_length, edge_sources, edge_targets, edge_costs);
+            }
+        }
+
+        // Group the abstract nodes by cluster.
+        const std::size_t n_clusters = this->get_number_of_clusters();
+        this->first_cluster_nodes.assign(n_clusters + 1, 0);
+
+        for (const std::uint32_t cell : this->abstract_cells)
+        {
+            this->first_cluster_nodes[this->get_cluster(cell) + 1]++;
+        }
+
+        for (std::size_t cluster = 0; cluster < n_clusters; cluster++)
+        {
+            this->first_cluster_nodes[cluster + 1] += this->first_cluster_nodes[cluster];
+        }
+
+        this->cluster_nodes.resize(this->abstract_cells.size());
+        std::vector<std::uint32_t> next_cluster_nodes(this->first_cluster_nodes.begin(), this->first_cluster_nodes.end() - 1);
+
+        for (std::uint32_t node = 0; node < this->abstract_cells.size(); node++)
+        {
+            this->cluster_nodes[next_cluster_nodes[this->get_cluster(this->abstract_cells[node])]++] = node;
+        }
+
+        // Edges between the entrance cells of each cluster, one search within the cluster from each.
+        AStarWorkspace workspace;
+
+        for (std::uint32_t cluster = 0; cluster < n_clusters; cluster++)
+        {
+            const GridRegionView cluster_view(*this->grid, this->get_cluster_region(cluster));
+
+            for (std::uint32_t node_i = this->first_cluster_nodes[cluster]; node_i < this->first_cluster_nodes[cluster + 1]; node_i++)
+            {
+                const std::uint32_t node = this->cluster_nodes[node_i];
+                search(cluster_view, this->abstract_cells[node], invalid_node, workspace);
+
+                for (std::uint32_t other_i = this->first_cluster_nodes[cluster]; other_i < this->first_cluster_nodes[cluster + 1]; other_i++)
+                {
+                    const std::uint32_t other = this->cluster_nodes[other_i];
+
+                    if (other != node && workspace.is_reached(this->abstract_cells[other]))
+                    {
+                        edge_sources.emplace_back(node);
+                        edge_targets.emplace_back(other);
+                        edge_costs.emplace_back(workspace.get_cost(this->abstract_cells[other]));
+                    }
+                }
+            }
+        }
+
+        // Counting sort of the edges by their source nodes.
+        const std::size_t n_nodes = this->abstract_cells.size();
+        this->first_edges.assign(n_nodes + 1, 0);
+
+        for (const std::uint32_t source : edge_sources)
+        {
+            this->first_edges[source + 1]++;
+        }
+
+        for (std::size_t node = 0; node < n_nodes; node++)
+        {
+            this->first_edges[node + 1] += this->first_edges[node];
+        }
+
+        std::vector<std::uint32_t> next_edges(this->first_edges.begin(), this->first_edges.end() - 1);
+        this->edge_targets.resize(edge_sources.size());
+        this->edge_costs.resize(edge_sources.size());
+
+        for (std::size_t edge_i = 0; edge_i < edge_sources.size(); edge_i++)
+        {
+            const std::uint32_t sorted_edge_i = next_edges[edge_sources[edge_i]]++;
+            this->edge_targets[sorted_edge_i] = edge_targets[edge_i];
+            this->edge_costs[sorted_edge_i] = edge_costs[edge_i];
+        }
+    }
+
+    bool HierarchicalPathfinder::find_path(
+            const std::uint32_t start,
+            const std::uint32_t goal,
+            AStarWorkspace& workspace,
+            std::vector<std::uint32_t>& path,
+            float& cost) const
+    {
+        path.clear();
+        cost = std::numeric_limits<float>::infinity();
+
+        const std::size_t n_cells = this->grid->get_number_of_nodes();
+
+        if (start >= n_cells || goal >= n_cells || !this->grid->is_walkable(start) || !this->grid->is_walkable(goal))
+        {
+            return false;
+        }
+
+        if (start == goal)
+        {
+            path.emplace_back(start);
+            cost = 0.0f;
+            return true;
+        }
+
+        const std::uint32_t start_cluster = this->get_cluster(start);
+
+        if (start_cluster == this->get_cluster(goal) &&
+                graph::find_path(GridRegionView(*this->grid, this->get_cluster_region(start_cluster)), start, goal, workspace, path, cost))
+        {
+            return true;
+        }
+
+        std::vector<Link> start_links;
+        std::vector<Link> goal_links;
+        this->link(start, workspace, start_links);
+        this->link(goal, workspace, goal_links);
+
+        if (start_links.empty() || goal_links.empty())
+        {
+            return false;
+        }
+
+        const QueryView query_view(*this, goal, start_links, goal_links);
+        std::vector<std::uint32_t> abstract_path;
+        float abstract_cost;
+
+        if (!graph::find_path(query_view, query_view.get_start_node(), query_view.get_goal_node(), workspace, abstract_path, abstract_cost))
+        {
+            return false;
+        }
+
+        // Refine the abstract path into cells.
+        path.emplace_back(start);
+        cost = 0.0f;
+        std::vector<std::uint32_t> segment;
+
+        for (std::size_t node_i = 0; node_i + 1 < abstract_path.size(); node_i++)
+        {
+            const std::uint32_t from = query_view.get_cell(abstract_path[node_i], start);
+            const std::uint32_t to = query_view.get_cell(abstract_path[node_i + 1], start);
+
+            if (from == to)
+            {
+                // The start or the goal is an entrance cell.
+                continue;
+            }
+
+            const std::uint32_t from_cluster = this->get_cluster(from);
+
+            if (from_cluster != this->get_cluster(to))
+            {
+                // An entrance, a single step over the border.
+                path.emplace_back(to);
+                cost += get_step_cost(*this->grid, from, to);
+                continue;
+            }
+
+            float segment_cost;
+
+            if (!graph::find_path(GridRegionView(*this->grid, this->get_cluster_region(from_cluster)), from, to, workspace, segment, segment_cost)) [[unlikely]]
+            {
+                path.clear();
+                cost = std::numeric_limits<float>::infinity();
+                return false;
+            }
+
+            path.insert(path.end(), segment.begin() + 1, segment.end());
+            cost += segment_cost;
+        }
+
+        return true;
+    }
+
+    const NavigationGrid& HierarchicalPathfinder::get_grid() const noexcept
+    {
+        return *this->grid;
+    }
+
+    std::uint32_t HierarchicalPathfinder::get_cluster_size() const noexcept
+    {
+        return this->cluster_size;
+    }
+
+    std::size_t HierarchicalPathfinder::get_number_of_clusters() const noexcept
+    {
+        return static_cast<std::size_t>(this->n_clusters_i) * this->n_clusters_j;
+    }
+
+    std::size_t HierarchicalPathfinder::get_number_of_abstract_nodes() const noexcept
+    {
+        return this->abstract_cells.size();
+    }
+
+    std::size_t HierarchicalPathfinder::get_number_of_abstract_edges() const noexcept
+    {
+        return this->edge_targets.size();
+    }
+
+    std::uint32_t HierarchicalPathfinder::get_cluster(const std::uint32_t cell) const noexcept
+    {
+        return (this->grid->get_j(cell) / this->cluster_size) * this->n_clusters_i + this->grid->get_i(cell) / this->cluster_size;
+    }
+
+    GridRegion HierarchicalPathfinder::get_cluster_region(const std::uint32_t cluster) const noexcept
+    {
+        const std::uint32_t i_begin = (cluster % this->n_clusters_i) * this->cluster_size;
+        const std::uint32_t j_begin = (cluster / this->n_clusters_i) * this->cluster_size;
+        return GridRegion {
+            i_begin,
+            j_begin,
+            std::min(i_begin + this->cluster_size, this->grid->get_width()),
+            std::min(j_begin + this->cluster_size, this->grid->get_height()) };
+    }
+
+    void HierarchicalPathfinder::add_entrances(
+            const std::uint32_t first_cell,
+            const std::uint32_t step_along_border,
+            const std::uint32_t step_across_border,
+            const std::uint32_t border_length,
+            std::vector<std::uint32_t>& edge_sources,
+            std::vector<std::uint32_t>& edge_targets,
+            std::vector<float>& edge_costs)
+    {
+        const auto add_entrance = [&](const std::uint32_t border_i)
+        {
+            const std::uint32_t cell = first_cell + border_i * step_along_border;
+            const std::uint32_t other_cell = cell + step_across_border;
+            const std::uint32_t node = this->get_or_create_abstract_node(cell);
+            const std::uint32_t other_node = this->get_or_create_abstract_node(other_cell);
+            const float step_cost = get_step_cost(*this->grid, cell, other_cell);
+
+            edge_sources.emplace_back(node);
+            edge_targets.emplace_back(other_node);
+            edge_costs.emplace_back(step_cost);
+            edge_sources.emplace_back(other_node);
+            edge_targets.emplace_back(node);
+            edge_costs.emplace_back(step_cost);
+        };
+
+        std::uint32_t stretch_begin = 0;
+
+        for (std::uint32_t border_i = 0; border_i <= border_length; border_i++)
+        {
+            const std::uint32_t cell = first_cell + border_i * step_along_border;
+            const bool is_open = (border_i < border_length &&
+                    this->grid->is_walkable(cell) &&
+                    this->grid->is_walkable(cell + step_across_border));
+
+            if (is_open)
+            {
+                continue;
+            }
+
+            // The stretch `[stretch_begin, border_i)` ends here.
+            if (border_i > stretch_begin)
+            {
+                const std::uint32_t stretch_length = border_i - stretch_begin;
+
+                if (stretch_length >= min_double_entrance_length)
+                {
+                    add_entrance(stretch_begin);
+                    add_entrance(border_i - 1);
+                }
+                else
+                {
+                    add_entrance(stretch_begin + stretch_length / 2);
+                }
+            }
+
+            stretch_begin = border_i + 1;
+        }
+    }
+
+    std::uint32_t HierarchicalPathfinder::get_or_create_abstract_node(const std::uint32_t cell)
+    {
+        if (this->abstract_node_of_cell[cell] == invalid_node)
+        {
+            this->abstract_node_of_cell[cell] = static_cast<std::uint32_t>(this->abstract_cells.size());
+            this->abstract_cells.emplace_back(cell);
+        }
+
+        return this->abstract_node_of_cell[cell];
+    }
+
+    void HierarchicalPathfinder::link(const std::uint32_t cell, AStarWorkspace& workspace, std::vector<Link>& links) const
+    {
+        const std::uint32_t cluster = this->get_cluster(cell);
+        search(GridRegionView(*this->grid, this->get_cluster_region(cluster)), cell, invalid_node, workspace);
+
+        for (std::uint32_t node_i = this->first_cluster_nodes[cluster]; node_i < this->first_cluster_nodes[cluster + 1]; node_i++)
+        {
+            const std::uint32_t node = this->cluster_nodes[node_i];
+
+            if (workspace.is_reached(this->abstract_cells[node]))
+            {
+                links.push_back({ node, workspace.get_cost(this->abstract_cells[node]) });
+            }
+        }
+    }
+}
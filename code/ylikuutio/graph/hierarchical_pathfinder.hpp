@@ -0,0 +1,128 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_GRAPH_HIERARCHICAL_PATHFINDER_HPP_INCLUDED
+#define YLIKUUTIO_GRAPH_HIERARCHICAL_PATHFINDER_HPP_INCLUDED
+
+#include "a_star.hpp"
+#include "navigation_grid.hpp"
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <memory>  // std::shared_ptr
+#include <vector>  // std::vector
+
+// `HierarchicalPathfinder` finds paths over a `NavigationGrid` with HPA*.
+//
+// How `HierarchicalPathfinder` works:
+//
+// The grid is divided into square clusters of `cluster_size` cells.
+// Where the cells on both sides of a border between 2 clusters are
+// walkable, there is an entrance: a pair of cells, one in each cluster,
+// in the middle of a short walkable stretch of the border or at both
+// ends of a long one. The entrance cells are the nodes of an abstract
+// graph. Its edges cross the borders at the entrances, and connect the
+// entrance cells of each cluster with the costs of the cheapest paths
+// between them within the cluster.
+//
+// A query links the start and the goal to the entrance cells of their
+// clusters, searches the abstract graph, and then refines each abstract
+// edge into cells with a search limited to one cluster. The paths are
+// near-optimal, within the cost of staying inside the clusters. Start
+// and goal in the same cluster are first searched within the cluster.
+//
+// Queries do not modify the pathfinder, so they can run concurrently,
+// each with its own `AStarWorkspace`.
+
+namespace yli::graph
+{
+    class HierarchicalPathfinder
+    {
+        public:
+            HierarchicalPathfinder(std::shared_ptr<const NavigationGrid> grid, std::uint32_t cluster_size = 16);
+
+            HierarchicalPathfinder(const HierarchicalPathfinder&) = delete;            // Delete copy constructor.
+            HierarchicalPathfinder& operator=(const HierarchicalPathfinder&) = delete; // Delete copy assignment.
+
+            ~HierarchicalPathfinder() = default;
+
+            // Replaces `path` with a path of cells from `start` to `goal`. Returns `false` if there is none.
+            bool find_path(
+                    std::uint32_t start,
+                    std::uint32_t goal,
+                    AStarWorkspace& workspace,
+                    std::vector<std::uint32_t>& path,
+                    float& cost) const;
+
+            const NavigationGrid& get_grid() const noexcept;
+
+            std::uint32_t get_cluster_size() const noexcept;
+
+            std::size_t get_number_of_clusters() const noexcept;
+
+            std::size_t get_number_of_abstract_nodes() const noexcept;
+
+            std::size_t get_number_of_abstract_edges() const noexcept;
+
+        private:
+            // A start or a goal linked to an entrance cell of its cluster.
+            struct Link
+            {
+                std::uint32_t abstract_node;
+                float cost;
+            };
+
+            class QueryView;
+
+            std::uint32_t get_cluster(std::uint32_t cell) const noexcept;
+            GridRegion get_cluster_region(std::uint32_t cluster) const noexcept;
+
+            void add_entrances(
+                    std::uint32_t first_cell,
+                    std::uint32_t step_along_border,
+                    std::uint32_t step_across_border,
+                    std::uint32_t border_length,
+                    std::vector<std::uint32_t>& edge_sources,
+                    std::vector<std::uint32_t>& edge_targets,
+                    std::vector<float>& edge_costs);
+
+            std::uint32_t get_or_create_abstract_node(std::uint32_t cell);
+
+            // Links `cell` to the entrance cells of its cluster.
+            void link(std::uint32_t cell, AStarWorkspace& workspace, std::vector<Link>& links) const;
+
+            std::shared_ptr<const NavigationGrid> grid;
+            std::uint32_t cluster_size;
+            std::uint32_t n_clusters_i;
+            std::uint32_t n_clusters_j;
+
+            std::vector<std::uint32_t> abstract_cells;       // The cell of each abstract node.
+            std::vector<std::uint32_t> abstract_node_of_cell; // `invalid_node` if the cell is not an entrance cell.
+
+            // Adjacency arrays of the abstract graph.
+            std::vector<std::uint32_t> first_edges;
+            std::vector<std::uint32_t> edge_targets;
+            std::vector<float> edge_costs;
+
+            // The abstract nodes of cluster `c` are `cluster_nodes[first_cluster_nodes[c] ... first_cluster_nodes[c + 1]]`.
+            std::vector<std::uint32_t> first_cluster_nodes;
+            std::vector<std::uint32_t> cluster_nodes;
+    };
+}
+
+#endif
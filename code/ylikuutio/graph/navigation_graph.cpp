@@ -0,0 +1,149 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "navigation_graph.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::min
+#include <cmath>     // std::isfinite, std::isnan
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <limits>    // std::numeric_limits
+#include <stdexcept> // std::runtime_error
+#include <vector>    // std::vector
+
+namespace yli::graph
+{
+    std::uint32_t NavigationGraph::add_node(const glm::vec3& position)
+    {
+        this->positions.emplace_back(position);
+        this->is_finalized = false;
+        return static_cast<std::uint32_t>(this->positions.size() - 1);
+    }
+
+    void NavigationGraph::add_edge(const std::uint32_t from, const std::uint32_t to, float cost)
+    {
+        if (from >= this->positions.size() || to >= this->positions.size()) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `NavigationGraph::add_edge`: invalid node!");
+        }
+
+        if (std::isnan(cost))
+        {
+            cost = glm::distance(this->positions[from], this->positions[to]);
+        }
+
+        if (!(cost >= 0.0f && std::isfinite(cost))) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `NavigationGraph::add_edge`: `cost` must be non-negative and finite!");
+        }
+
+        this->edges.push_back({ from, to, cost });
+        this->is_finalized = false;
+    }
+
+    void NavigationGraph::add_bidirectional_edge(const std::uint32_t a, const std::uint32_t b, const float cost)
+    {
+        this->add_edge(a, b, cost);
+        this->add_edge(b, a, cost);
+    }
+
+    void NavigationGraph::finalize()
+    {
+        const std::size_t n_nodes = this->positions.size();
+        this->first_edges.assign(n_nodes + 1, 0);
+
+        for (const Edge& edge : this->edges)
+        {
+            this->first_edges[edge.from + 1]++;
+        }
+
+        for (std::size_t node_i = 0; node_i < n_nodes; node_i++)
+        {
+            this->first_edges[node_i + 1] += this->first_edges[node_i];
+        }
+
+        // Counting sort of the edges by their source nodes.
+        std::vector<std::uint32_t> next_edges(this->first_edges.begin(), this->first_edges.end() - 1);
+        this->edge_targets.resize(this->edges.size());
+        this->edge_costs.resize(this->edges.size());
+        this->heuristic_scale = 1.0f;
+
+        for (const Edge& edge : this->edges)
+        {
+            const std::uint32_t edge_i = next_edges[edge.from]++;
+            this->edge_targets[edge_i] = edge.to;
+            this->edge_costs[edge_i] = edge.cost;
+
+            const float distance = glm::distance(this->positions[edge.from], this->positions[edge.to]);
+
+            if (distance > 0.0f)
+            {
+                this->heuristic_scale = std::min(this->heuristic_scale, edge.cost / distance);
+            }
+        }
+
+        this->is_finalized = true;
+    }
+
+    bool NavigationGraph::get_is_finalized() const noexcept
+    {
+        return this->is_finalized;
+    }
+
+    std::size_t NavigationGraph::get_number_of_nodes() const noexcept
+    {
+        // Searches see only the finalized nodes.
+        return (this->is_finalized ? this->positions.size() : 0);
+    }
+
+    std::size_t NavigationGraph::get_number_of_edges() const noexcept
+    {
+        return this->edges.size();
+    }
+
+    const glm::vec3& NavigationGraph::get_position(const std::uint32_t node) const
+    {
+        return this->positions.at(node);
+    }
+
+    std::uint32_t NavigationGraph::get_nearest_node(const glm::vec3& position) const
+    {
+        std::uint32_t nearest_node = invalid_node;
+        float nearest_distance_squared = std::numeric_limits<float>::infinity();
+
+        for (std::uint32_t node = 0; node < this->positions.size(); node++)
+        {
+            const glm::vec3 difference = this->positions[node] - position;
+            const float distance_squared = glm::dot(difference, difference);
+
+            if (distance_squared < nearest_distance_squared)
+            {
+                nearest_distance_squared = distance_squared;
+                nearest_node = node;
+            }
+        }
+
+        return nearest_node;
+    }
+}
@@ -0,0 +1,104 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_GRAPH_NAVIGATION_GRAPH_HPP_INCLUDED
+#define YLIKUUTIO_GRAPH_NAVIGATION_GRAPH_HPP_INCLUDED
+
+#include "a_star.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cmath>   // NAN
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
+#include <vector>  // std::vector
+
+// `NavigationGraph` is a directed graph of points, e.g. of `Waypoint`s.
+//
+// Edges are added freely and then packed into adjacency arrays by
+// `finalize`, which searches require. The heuristic is the straight
+// line distance, scaled down by the lowest cost per distance of the
+// edges so that it never overestimates.
+
+namespace yli::graph
+{
+    class NavigationGraph
+    {
+        public:
+            NavigationGraph() = default;
+
+            std::uint32_t add_node(const glm::vec3& position);
+
+            // A `cost` of `NAN` means the distance between the nodes.
+            void add_edge(std::uint32_t from, std::uint32_t to, float cost = NAN);
+
+            void add_bidirectional_edge(std::uint32_t a, std::uint32_t b, float cost = NAN);
+
+            void finalize();
+
+            bool get_is_finalized() const noexcept;
+
+            std::size_t get_number_of_nodes() const noexcept;
+
+            std::size_t get_number_of_edges() const noexcept;
+
+            const glm::vec3& get_position(std::uint32_t node) const;
+
+            // `invalid_node` if the graph is empty.
+            std::uint32_t get_nearest_node(const glm::vec3& position) const;
+
+            float get_heuristic(std::uint32_t node, std::uint32_t goal) const
+            {
+                return this->heuristic_scale * glm::distance(this->positions[node], this->positions[goal]);
+            }
+
+            template<typename F>
+                void for_each_neighbour(const std::uint32_t node, F&& f) const
+                {
+                    for (std::uint32_t edge_i = this->first_edges[node]; edge_i < this->first_edges[node + 1]; edge_i++)
+                    {
+                        f(this->edge_targets[edge_i], this->edge_costs[edge_i]);
+                    }
+                }
+
+        private:
+            struct Edge
+            {
+                std::uint32_t from;
+                std::uint32_t to;
+                float cost;
+            };
+
+            std::vector<glm::vec3> positions;
+            std::vector<Edge> edges;
+
+            // Adjacency arrays: the edges of node `n` are `[first_edges[n], first_edges[n + 1])`.
+            std::vector<std::uint32_t> first_edges;
+            std::vector<std::uint32_t> edge_targets;
+            std::vector<float> edge_costs;
+
+            float heuristic_scale { 1.0f };
+            bool is_finalized { false };
+    };
+}
+
+#endif
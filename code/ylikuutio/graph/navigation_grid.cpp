@@ -0,0 +1,174 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "navigation_grid.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::max
+#include <cmath>     // std::abs, std::floor, std::isfinite, std::sqrt
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <limits>    // std::numeric_limits
+#include <stdexcept> // std::runtime_error
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+namespace yli::graph
+{
+    NavigationGrid::NavigationGrid(
+            std::vector<float>&& costs,
+            const std::uint32_t width,
+            const std::uint32_t height,
+            const glm::vec2& origin,
+            const glm::vec2& spacing)
+        : costs(std::move(costs)),
+        width { width },
+        height { height },
+        origin { origin },
+        spacing { spacing },
+        diagonal_length { std::sqrt(spacing.x * spacing.x + spacing.y * spacing.y) }
+    {
+        if (this->width == 0 || this->height == 0) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `NavigationGrid::NavigationGrid`: the grid must not be empty!");
+        }
+
+        if (this->costs.size() != static_cast<std::size_t>(this->width) * this->height) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `NavigationGrid::NavigationGrid`: number of costs does not match the dimensions!");
+        }
+
+        if (!(this->spacing.x > 0.0f && this->spacing.y > 0.0f && std::isfinite(this->spacing.x) && std::isfinite(this->spacing.y))) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `NavigationGrid::NavigationGrid`: `spacing` must be positive and finite!");
+        }
+
+        for (const float cost : this->costs)
+        {
+            // `NAN` is not walkable either.
+            if (!(cost >= 1.0f)) [[unlikely]]
+            {
+                throw std::runtime_error("ERROR: `NavigationGrid::NavigationGrid`: costs must be at least 1!");
+            }
+        }
+    }
+
+    NavigationGrid NavigationGrid::create_from_heightmap(
+            const std::vector<float>& altitudes,
+            const std::uint32_t width,
+            const std::uint32_t height,
+            const glm::vec2& origin,
+            const glm::vec2& spacing,
+            const float max_slope)
+    {
+        if (altitudes.size() != static_cast<std::size_t>(width) * height) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `NavigationGrid::create_from_heightmap`: number of altitudes does not match the dimensions!");
+        }
+
+        std::vector<float> costs(altitudes.size());
+
+        for (std::uint32_t j = 0; j < height; j++)
+        {
+            for (std::uint32_t i = 0; i < width; i++)
+            {
+                const std::size_t cell = static_cast<std::size_t>(j) * width + i;
+                const float altitude = altitudes[cell];
+                float slope = 0.0f;
+
+                if (i > 0)
+                {
+                    slope = std::max(slope, std::abs(altitudes[cell - 1] - altitude) / spacing.x);
+                }
+
+                if (i + 1 < width)
+                {
+                    slope = std::max(slope, std::abs(altitudes[cell + 1] - altitude) / spacing.x);
+                }
+
+                if (j > 0)
+                {
+                    slope = std::max(slope, std::abs(altitudes[cell - width] - altitude) / spacing.y);
+                }
+
+                if (j + 1 < height)
+                {
+                    slope = std::max(slope, std::abs(altitudes[cell + width] - altitude) / spacing.y);
+                }
+
+                costs[cell] = (slope <= max_slope ? 1.0f + slope : std::numeric_limits<float>::infinity());
+            }
+        }
+
+        NavigationGrid grid(std::move(costs), width, height, origin, spacing);
+        grid.altitudes = altitudes;
+        return grid;
+    }
+
+    std::uint32_t NavigationGrid::get_width() const noexcept
+    {
+        return this->width;
+    }
+
+    std::uint32_t NavigationGrid::get_height() const noexcept
+    {
+        return this->height;
+    }
+
+    std::size_t NavigationGrid::get_number_of_nodes() const noexcept
+    {
+        return this->costs.size();
+    }
+
+    float NavigationGrid::get_cost(const std::uint32_t cell) const
+    {
+        return this->costs.at(cell);
+    }
+
+    std::uint32_t NavigationGrid::get_cell_at(const glm::vec3& position) const
+    {
+        const float u = std::floor((position.x - this->origin.x) / this->spacing.x + 0.5f);
+        const float v = std::floor((position.z - this->origin.y) / this->spacing.y + 0.5f);
+
+        // Also rejects `NAN`.
+        if (!(u >= 0.0f && u < static_cast<float>(this->width) && v >= 0.0f && v < static_cast<float>(this->height)))
+        {
+            return invalid_node;
+        }
+
+        return this->get_cell(static_cast<std::uint32_t>(u), static_cast<std::uint32_t>(v));
+    }
+
+    glm::vec3 NavigationGrid::get_position(const std::uint32_t cell) const
+    {
+        if (cell >= this->costs.size()) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `NavigationGrid::get_position`: invalid cell!");
+        }
+
+        return glm::vec3(
+                this->origin.x + static_cast<float>(this->get_i(cell)) * this->spacing.x,
+                (this->altitudes.empty() ? 0.0f : this->altitudes[cell]),
+                this->origin.y + static_cast<float>(this->get_j(cell)) * this->spacing.y);
+    }
+}
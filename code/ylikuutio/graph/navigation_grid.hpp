@@ -0,0 +1,230 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_GRAPH_NAVIGATION_GRID_HPP_INCLUDED
+#define YLIKUUTIO_GRAPH_NAVIGATION_GRID_HPP_INCLUDED
+
+#include "a_star.hpp"
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::min
+#include <cmath>     // std::isfinite
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int32_t, std::uint32_t
+#include <vector>    // std::vector
+
+// `NavigationGrid` is a grid of cells for ground movement.
+//
+// Cell (i, j) is centered at x = `origin.x` + i * `spacing.x`,
+// z = `origin.y` + j * `spacing.y`, like the samples of a heightmap.
+// Each walkable cell has a cost per distance of at least 1, blocked
+// cells have an infinite cost. Movement is 8-connected, but diagonal
+// steps may not cut the corners of blocked cells. A step costs its
+// length times the mean cost of its cells, and the heuristic is the
+// octile distance, which never overestimates.
+
+namespace yli::graph
+{
+    // Cells `[i_begin, i_end)` x `[j_begin, j_end)`.
+    struct GridRegion
+    {
+        std::uint32_t i_begin;
+        std::uint32_t j_begin;
+        std::uint32_t i_end;
+        std::uint32_t j_end;
+
+        bool contains(const std::uint32_t i, const std::uint32_t j) const noexcept
+        {
+            return i >= this->i_begin && i < this->i_end && j >= this->j_begin && j < this->j_end;
+        }
+    };
+
+    class NavigationGrid
+    {
+        public:
+            // `costs` are in row-major order, `width` cells per row.
+            NavigationGrid(
+                    std::vector<float>&& costs,
+                    std::uint32_t width,
+                    std::uint32_t height,
+                    const glm::vec2& origin = glm::vec2(0.0f, 0.0f),
+                    const glm::vec2& spacing = glm::vec2(1.0f, 1.0f));
+
+            // Cells steeper than `max_slope` towards any of their 4 neighbours are blocked,
+            // the others cost 1 + their steepest slope.
+            static NavigationGrid create_from_heightmap(
+                    const std::vector<float>& altitudes,
+                    std::uint32_t width,
+                    std::uint32_t height,
+                    const glm::vec2& origin,
+                    const glm::vec2& spacing,
+                    float max_slope);
+
+            std::uint32_t get_width() const noexcept;
+
+            std::uint32_t get_height() const noexcept;
+
+            std::size_t get_number_of_nodes() const noexcept;
+
+            std::uint32_t get_cell(const std::uint32_t i, const std::uint32_t j) const noexcept
+            {
+                return j * this->width + i;
+            }
+
+            std::uint32_t get_i(const std::uint32_t cell) const noexcept
+            {
+                return cell % this->width;
+            }
+
+            std::uint32_t get_j(const std::uint32_t cell) const noexcept
+            {
+                return cell / this->width;
+            }
+
+            bool is_walkable(const std::uint32_t cell) const noexcept
+            {
+                return std::isfinite(this->costs[cell]);
+            }
+
+            float get_cost(std::uint32_t cell) const;
+
+            // The cell nearest to `position`, `invalid_node` outside of the grid.
+            std::uint32_t get_cell_at(const glm::vec3& position) const;
+
+            // Center of `cell`, at the altitude of the heightmap if the grid was created from one.
+            glm::vec3 get_position(std::uint32_t cell) const;
+
+            float get_heuristic(const std::uint32_t node, const std::uint32_t goal) const
+            {
+                const std::int32_t di = static_cast<std::int32_t>(this->get_i(node)) - static_cast<std::int32_t>(this->get_i(goal));
+                const std::int32_t dj = static_cast<std::int32_t>(this->get_j(node)) - static_cast<std::int32_t>(this->get_j(goal));
+                const float steps_i = static_cast<float>(di < 0 ? -di : di);
+                const float steps_j = static_cast<float>(dj < 0 ? -dj : dj);
+                const float diagonal_steps = std::min(steps_i, steps_j);
+                return diagonal_steps * this->diagonal_length +
+                    (steps_i - diagonal_steps) * this->spacing.x +
+                    (steps_j - diagonal_steps) * this->spacing.y;
+            }
+
+            template<typename F>
+                void for_each_neighbour(const std::uint32_t node, F&& f) const
+                {
+                    this->for_each_neighbour_in_region(node, GridRegion { 0, 0, this->width, this->height }, f);
+                }
+
+            template<typename F>
+                void for_each_neighbour_in_region(const std::uint32_t node, const GridRegion& region, F&& f) const
+                {
+                    if (!this->is_walkable(node)) [[unlikely]]
+                    {
+                        // There is no way out of a blocked cell.
+                        return;
+                    }
+
+                    const std::uint32_t i = this->get_i(node);
+                    const std::uint32_t j = this->get_j(node);
+                    const float node_cost = this->costs[node];
+
+                    // Orthogonal steps first, their walkability gates the diagonal steps.
+                    const bool is_west_open = (i > region.i_begin && this->is_walkable(node - 1));
+                    const bool is_east_open = (i + 1 < region.i_end && this->is_walkable(node + 1));
+                    const bool is_south_open = (j > region.j_begin && this->is_walkable(node - this->width));
+                    const bool is_north_open = (j + 1 < region.j_end && this->is_walkable(node + this->width));
+
+                    if (is_west_open)
+                    {
+                        f(node - 1, this->spacing.x * 0.5f * (node_cost + this->costs[node - 1]));
+                    }
+
+                    if (is_east_open)
+                    {
+                        f(node + 1, this->spacing.x * 0.5f * (node_cost + this->costs[node + 1]));
+                    }
+
+                    if (is_south_open)
+                    {
+                        f(node - this->width, this->spacing.y * 0.5f * (node_cost + this->costs[node - this->width]));
+                    }
+
+                    if (is_north_open)
+                    {
+                        f(node + this->width, this->spacing.y * 0.5f * (node_cost + this->costs[node + this->width]));
+                    }
+
+                    const auto visit_diagonal = [&](const bool is_open, const std::uint32_t neighbour)
+                    {
+                        if (is_open && this->is_walkable(neighbour))
+                        {
+                            f(neighbour, this->diagonal_length * 0.5f * (node_cost + this->costs[neighbour]));
+                        }
+                    };
+
+                    visit_diagonal(is_south_open && is_west_open, node - this->width - 1);
+                    visit_diagonal(is_south_open && is_east_open, node - this->width + 1);
+                    visit_diagonal(is_north_open && is_west_open, node + this->width - 1);
+                    visit_diagonal(is_north_open && is_east_open, node + this->width + 1);
+                }
+
+        private:
+            std::vector<float> costs;
+            std::vector<float> altitudes; // Empty if the grid was not created from a heightmap.
+            std::uint32_t width;
+            std::uint32_t height;
+            glm::vec2 origin;
+            glm::vec2 spacing;
+            float diagonal_length;
+    };
+
+    // The cells of `region` of a `NavigationGrid` as a graph, for searches limited to the region.
+    class GridRegionView
+    {
+        public:
+            GridRegionView(const NavigationGrid& grid, const GridRegion& region)
+                : grid { grid },
+                region { region }
+            {
+            }
+
+            std::size_t get_number_of_nodes() const noexcept
+            {
+                return this->grid.get_number_of_nodes();
+            }
+
+            float get_heuristic(const std::uint32_t node, const std::uint32_t goal) const
+            {
+                return this->grid.get_heuristic(node, goal);
+            }
+
+            template<typename F>
+                void for_each_neighbour(const std::uint32_t node, F&& f) const
+                {
+                    this->grid.for_each_neighbour_in_region(node, this->region, f);
+                }
+
+        private:
+            const NavigationGrid& grid;
+            GridRegion region;
+    };
+}
+
+#endif
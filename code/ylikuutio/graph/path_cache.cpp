@@ -0,0 +1,98 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "path_cache.hpp"
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <memory>  // std::shared_ptr
+#include <utility> // std::move
+
+namespace yli::graph
+{
+    PathCache::PathCache(const std::size_t capacity)
+        : capacity { capacity }
+    {
+        this->entries_by_key.reserve(capacity);
+    }
+
+    std::shared_ptr<const Path> PathCache::find(const PathKey& key)
+    {
+        const auto it = this->entries_by_key.find(key);
+
+        if (it == this->entries_by_key.end())
+        {
+            this->n_misses++;
+            return nullptr;
+        }
+
+        this->n_hits++;
+        this->entries.splice(this->entries.begin(), this->entries, it->second);
+        return it->second->second;
+    }
+
+    void PathCache::insert(const PathKey& key, std::shared_ptr<const Path> path)
+    {
+        if (this->capacity == 0)
+        {
+            return;
+        }
+
+        if (const auto it = this->entries_by_key.find(key); it != this->entries_by_key.end())
+        {
+            it->second->second = std::move(path);
+            this->entries.splice(this->entries.begin(), this->entries, it->second);
+            return;
+        }
+
+        if (this->entries.size() >= this->capacity)
+        {
+            this->entries_by_key.erase(this->entries.back().first);
+            this->entries.pop_back();
+        }
+
+        this->entries.emplace_front(key, std::move(path));
+        this->entries_by_key.emplace(key, this->entries.begin());
+    }
+
+    void PathCache::clear()
+    {
+        this->entries.clear();
+        this->entries_by_key.clear();
+    }
+
+    std::size_t PathCache::size() const noexcept
+    {
+        return this->entries.size();
+    }
+
+    std::size_t PathCache::get_capacity() const noexcept
+    {
+        return this->capacity;
+    }
+
+    std::uint64_t PathCache::get_number_of_hits() const noexcept
+    {
+        return this->n_hits;
+    }
+
+    std::uint64_t PathCache::get_number_of_misses() const noexcept
+    {
+        return this->n_misses;
+    }
+}
@@ -0,0 +1,108 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_GRAPH_PATH_CACHE_HPP_INCLUDED
+#define YLIKUUTIO_GRAPH_PATH_CACHE_HPP_INCLUDED
+
+// Include standard headers
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint32_t, std::uint64_t
+#include <limits>        // std::numeric_limits
+#include <list>          // std::list
+#include <memory>        // std::shared_ptr
+#include <unordered_map> // std::unordered_map
+#include <utility>       // std::pair
+#include <vector>        // std::vector
+
+namespace yli::graph
+{
+    enum class PathDomain : std::uint32_t
+    {
+        GRID,  // Cells of a `NavigationGrid`.
+        GRAPH  // Nodes of a `NavigationGraph`.
+    };
+
+    // Nodes from the start to the goal, empty if there is no path.
+    struct Path
+    {
+        std::vector<std::uint32_t> nodes;
+        float cost { std::numeric_limits<float>::infinity() };
+
+        bool is_found() const noexcept
+        {
+            return !this->nodes.empty();
+        }
+    };
+
+    struct PathKey
+    {
+        PathDomain domain;
+        std::uint32_t start;
+        std::uint32_t goal;
+        std::uint64_t version; // Of the navigation data the path was found in.
+
+        bool operator==(const PathKey& other) const noexcept = default;
+    };
+
+    struct PathKeyHash
+    {
+        std::size_t operator()(const PathKey& key) const noexcept
+        {
+            const std::uint64_t nodes = (static_cast<std::uint64_t>(key.start) << 32) | key.goal;
+            return static_cast<std::size_t>(
+                    (nodes ^ (key.version * 0x9e3779b97f4a7c15ULL) ^ static_cast<std::uint64_t>(key.domain)) * 0xff51afd7ed558ccdULL >> 16);
+        }
+    };
+
+    // `PathCache` keeps the most recently used paths, including the negative results.
+    // It is not thread-safe.
+    class PathCache
+    {
+        public:
+            explicit PathCache(std::size_t capacity);
+
+            PathCache(const PathCache&) = delete;            // Delete copy constructor.
+            PathCache& operator=(const PathCache&) = delete; // Delete copy assignment.
+
+            // `nullptr` if `key` is not cached. A found path becomes the most recently used.
+            std::shared_ptr<const Path> find(const PathKey& key);
+
+            // Evicts the least recently used path if the cache is full.
+            void insert(const PathKey& key, std::shared_ptr<const Path> path);
+
+            void clear();
+
+            std::size_t size() const noexcept;
+
+            std::size_t get_capacity() const noexcept;
+
+            std::uint64_t get_number_of_hits() const noexcept;
+
+            std::uint64_t get_number_of_misses() const noexcept;
+
+        private:
+            using Entry = std::pair<PathKey, std::shared_ptr<const Path>>;
+
+            std::list<Entry> entries; // Most recently used first.
+            std::unordered_map<PathKey, std::list<Entry>::iterator, PathKeyHash> entries_by_key;
+            std::size_t capacity;
+            std::uint64_t n_hits { 0 };
+            std::uint64_t n_misses { 0 };
+    };
+}
+
+#endif
@@ -0,0 +1,284 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "path_planner.hpp"
+#include "a_star.hpp"
+#include "hierarchical_pathfinder.hpp"
+#include "navigation_graph.hpp"
+#include "navigation_grid.hpp"
+#include "path_cache.hpp"
+
+// Include standard headers
+#include <algorithm> // std::max
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t, std::uint64_t
+#include <exception> // std::exception
+#include <future>    // std::promise, std::shared_future
+#include <iostream>  // std::cerr
+#include <memory>    // std::make_shared, std::shared_ptr
+#include <mutex>     // std::scoped_lock, std::unique_lock
+#include <thread>    // std::thread
+#include <utility>   // std::move
+
+namespace yli::graph
+{
+    PathPlanner::PathPlanner(const std::size_t n_worker_threads, const std::size_t cache_capacity)
+        : navigation { std::make_shared<Navigation>() },
+        cache(cache_capacity),
+        n_worker_threads {
+            n_worker_threads > 0 ?
+                n_worker_threads :
+                std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1 }
+    {
+    }
+
+    PathPlanner::~PathPlanner()
+    {
+        {
+            std::scoped_lock lock(this->mutex);
+            this->is_stopping = true;
+        }
+
+        this->request_condition_variable.notify_all();
+
+        for (std::thread& worker_thread : this->worker_threads)
+        {
+            worker_thread.join();
+        }
+    }
+
+    void PathPlanner::set_navigation_grid(std::shared_ptr<const NavigationGrid> grid, const std::uint32_t cluster_size)
+    {
+        std::shared_ptr<const HierarchicalPathfinder> hierarchical_pathfinder =
+            (grid != nullptr ? std::make_shared<const HierarchicalPathfinder>(grid, cluster_size) : nullptr);
+
+        // The copy, the change and the swap are under one lock, so that
+        // a concurrent `set_navigation_graph` does not get lost.
+        std::scoped_lock lock(this->mutex);
+        std::shared_ptr<Navigation> new_navigation = std::make_shared<Navigation>(*this->navigation);
+        new_navigation->grid = std::move(grid);
+        new_navigation->hierarchical_pathfinder = std::move(hierarchical_pathfinder);
+        this->set_navigation(std::move(new_navigation));
+    }
+
+    void PathPlanner::set_navigation_graph(std::shared_ptr<const NavigationGraph> graph)
+    {
+        std::scoped_lock lock(this->mutex);
+        std::shared_ptr<Navigation> new_navigation = std::make_shared<Navigation>(*this->navigation);
+        new_navigation->graph = std::move(graph);
+        this->set_navigation(std::move(new_navigation));
+    }
+
+    std::shared_ptr<const NavigationGrid> PathPlanner::get_navigation_grid() const
+    {
+        std::scoped_lock lock(this->mutex);
+        return this->navigation->grid;
+    }
+
+    std::shared_ptr<const NavigationGraph> PathPlanner::get_navigation_graph() const
+    {
+        std::scoped_lock lock(this->mutex);
+        return this->navigation->graph;
+    }
+
+    PathPlanner::PathFuture PathPlanner::request_path(const PathDomain domain, const std::uint32_t start, const std::uint32_t goal)
+    {
+        PathFuture future;
+
+        {
+            std::scoped_lock lock(this->mutex);
+            const PathKey key { domain, start, goal, this->navigation->version };
+
+            if (std::shared_ptr<const Path> path = this->cache.find(key); path != nullptr)
+            {
+                std::promise<std::shared_ptr<const Path>> promise;
+                promise.set_value(std::move(path));
+                return promise.get_future().share();
+            }
+
+            if (const auto it = this->requests_in_flight.find(key); it != this->requests_in_flight.end())
+            {
+                return it->second;
+            }
+
+            if (this->worker_threads.empty())
+            {
+                this->start_worker_threads();
+            }
+
+            std::promise<std::shared_ptr<const Path>> promise;
+            future = promise.get_future().share();
+            this->requests_in_flight.emplace(key, future);
+            this->requests.push_back(Request { key, this->navigation, std::move(promise) });
+            this->n_pending_requests++;
+        }
+
+        this->request_condition_variable.notify_one();
+        return future;
+    }
+
+    std::shared_ptr<const Path> PathPlanner::find_path(const PathDomain domain, const std::uint32_t start, const std::uint32_t goal)
+    {
+        std::shared_ptr<const Navigation> current_navigation;
+        PathKey key;
+
+        {
+            std::scoped_lock lock(this->mutex);
+            current_navigation = this->navigation;
+            key = PathKey { domain, start, goal, current_navigation->version };
+
+            if (std::shared_ptr<const Path> path = this->cache.find(key); path != nullptr)
+            {
+                return path;
+            }
+
+            this->n_searches++;
+        }
+
+        std::shared_ptr<const Path> path = PathPlanner::search(*current_navigation, key);
+
+        {
+            std::scoped_lock lock(this->mutex);
+
+            if (key.version == this->navigation->version)
+            {
+                this->cache.insert(key, path);
+            }
+        }
+
+        return path;
+    }
+
+    void PathPlanner::finish()
+    {
+        std::unique_lock lock(this->mutex);
+        this->finish_condition_variable.wait(lock, [this] { return this->n_pending_requests == 0; });
+    }
+
+    std::size_t PathPlanner::get_number_of_pending_requests() const
+    {
+        std::scoped_lock lock(this->mutex);
+        return this->n_pending_requests;
+    }
+
+    std::size_t PathPlanner::get_number_of_worker_threads() const
+    {
+        return this->n_worker_threads;
+    }
+
+    std::uint64_t PathPlanner::get_number_of_cache_hits() const
+    {
+        std::scoped_lock lock(this->mutex);
+        return this->cache.get_number_of_hits();
+    }
+
+    std::uint64_t PathPlanner::get_number_of_searches() const
+    {
+        std::scoped_lock lock(this->mutex);
+        return this->n_searches;
+    }
+
+    std::shared_ptr<const Path> PathPlanner::search(const Navigation& navigation, const PathKey& key)
+    {
+        // Each thread reuses its own workspace.
+        thread_local AStarWorkspace workspace;
+
+        std::shared_ptr<Path> path = std::make_shared<Path>();
+
+        if (key.domain == PathDomain::GRID && navigation.hierarchical_pathfinder != nullptr)
+        {
+            navigation.hierarchical_pathfinder->find_path(key.start, key.goal, workspace, path->nodes, path->cost);
+        }
+        else if (key.domain == PathDomain::GRAPH && navigation.graph != nullptr)
+        {
+            graph::find_path(*navigation.graph, key.start, key.goal, workspace, path->nodes, path->cost);
+        }
+
+        return path;
+    }
+
+    void PathPlanner::set_navigation(std::shared_ptr<Navigation> new_navigation)
+    {
+        new_navigation->version = this->navigation->version + 1;
+        this->navigation = std::move(new_navigation);
+        this->cache.clear();
+    }
+
+    void PathPlanner::start_worker_threads()
+    {
+        this->worker_threads.reserve(this->n_worker_threads);
+
+        for (std::size_t i = 0; i < this->n_worker_threads; i++)
+        {
+            this->worker_threads.emplace_back(&PathPlanner::run_worker_thread, this);
+        }
+    }
+
+    void PathPlanner::run_worker_thread()
+    {
+        while (true)
+        {
+            Request request;
+
+            {
+                std::unique_lock lock(this->mutex);
+                this->request_condition_variable.wait(lock, [this] { return this->is_stopping || !this->requests.empty(); });
+
+                if (this->is_stopping)
+                {
+                    return;
+                }
+
+                request = std::move(this->requests.front());
+                this->requests.pop_front();
+                this->n_searches++;
+            }
+
+            std::shared_ptr<const Path> path;
+
+            try
+            {
+                path = PathPlanner::search(*request.navigation, request.key);
+            }
+            catch (const std::exception& exception)
+            {
+                std::cerr << "ERROR: `PathPlanner::run_worker_thread`: search failed: " << exception.what() << "\n";
+                path = std::make_shared<const Path>();
+            }
+
+            request.promise.set_value(path);
+            this->complete(request.key, path);
+        }
+    }
+
+    void PathPlanner::complete(const PathKey& key, const std::shared_ptr<const Path>& path)
+    {
+        {
+            std::scoped_lock lock(this->mutex);
+            this->requests_in_flight.erase(key);
+
+            if (key.version == this->navigation->version)
+            {
+                this->cache.insert(key, path);
+            }
+
+            this->n_pending_requests--;
+        }
+
+        this->finish_condition_variable.notify_all();
+    }
+}
@@ -0,0 +1,134 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_GRAPH_PATH_PLANNER_HPP_INCLUDED
+#define YLIKUUTIO_GRAPH_PATH_PLANNER_HPP_INCLUDED
+
+#include "path_cache.hpp"
+
+// Include standard headers
+#include <condition_variable> // std::condition_variable
+#include <cstddef>            // std::size_t
+#include <cstdint>            // std::uint32_t, std::uint64_t
+#include <deque>              // std::deque
+#include <future>             // std::promise, std::shared_future
+#include <memory>             // std::shared_ptr
+#include <mutex>              // std::mutex
+#include <thread>             // std::thread
+#include <unordered_map>      // std::unordered_map
+#include <vector>             // std::vector
+
+// `PathPlanner` serves path requests over a `NavigationGrid`, with HPA*,
+// and over a `NavigationGraph`, e.g. of `Waypoint`s, with A*.
+//
+// Requests are served on worker threads, so that planning does not
+// stall the frame. The paths are kept in an LRU `PathCache`: a request
+// for a cached path gets a ready future, and concurrent requests for the
+// same path share one search. Setting new navigation data invalidates
+// the cached paths, requests in flight finish with the old data.
+//
+// Worker threads are started lazily on the first request.
+
+namespace yli::graph
+{
+    class NavigationGrid;
+    class NavigationGraph;
+    class HierarchicalPathfinder;
+
+    class PathPlanner final
+    {
+        public:
+            using PathFuture = std::shared_future<std::shared_ptr<const Path>>;
+
+            // 0 worker threads means one less than the hardware concurrency, but at least 1.
+            explicit PathPlanner(std::size_t n_worker_threads, std::size_t cache_capacity = 4096);
+
+            PathPlanner(const PathPlanner&) = delete;            // Delete copy constructor.
+            PathPlanner& operator=(const PathPlanner&) = delete; // Delete copy assignment.
+
+            // Waits for running searches to finish. Requests which have not
+            // been started yet are dropped and their futures get a broken promise.
+            ~PathPlanner();
+
+            // Builds the abstract graph of the grid on the calling thread.
+            void set_navigation_grid(std::shared_ptr<const NavigationGrid> grid, std::uint32_t cluster_size = 16);
+
+            void set_navigation_graph(std::shared_ptr<const NavigationGraph> graph);
+
+            std::shared_ptr<const NavigationGrid> get_navigation_grid() const;
+
+            std::shared_ptr<const NavigationGraph> get_navigation_graph() const;
+
+            PathFuture request_path(PathDomain domain, std::uint32_t start, std::uint32_t goal);
+
+            // Finds the path on the calling thread, through the cache.
+            std::shared_ptr<const Path> find_path(PathDomain domain, std::uint32_t start, std::uint32_t goal);
+
+            // Blocks until all requests have been served.
+            void finish();
+
+            std::size_t get_number_of_pending_requests() const;
+
+            std::size_t get_number_of_worker_threads() const;
+
+            std::uint64_t get_number_of_cache_hits() const;
+
+            std::uint64_t get_number_of_searches() const;
+
+        private:
+            // A snapshot of the navigation data, shared by the requests made while it was current.
+            struct Navigation
+            {
+                std::shared_ptr<const NavigationGrid> grid;
+                std::shared_ptr<const HierarchicalPathfinder> hierarchical_pathfinder;
+                std::shared_ptr<const NavigationGraph> graph;
+                std::uint64_t version { 0 };
+            };
+
+            struct Request
+            {
+                PathKey key;
+                std::shared_ptr<const Navigation> navigation;
+                std::promise<std::shared_ptr<const Path>> promise;
+            };
+
+            static std::shared_ptr<const Path> search(const Navigation& navigation, const PathKey& key);
+
+            // `mutex` must be locked.
+            void set_navigation(std::shared_ptr<Navigation> navigation);
+            void start_worker_threads();
+            void run_worker_thread();
+
+            // Stores a found path and releases the requests waiting for it.
+            void complete(const PathKey& key, const std::shared_ptr<const Path>& path);
+
+            mutable std::mutex mutex;
+            std::condition_variable request_condition_variable;
+            std::condition_variable finish_condition_variable;
+            std::deque<Request> requests;
+            std::unordered_map<PathKey, PathFuture, PathKeyHash> requests_in_flight;
+            std::vector<std::thread> worker_threads;
+            std::shared_ptr<const Navigation> navigation;
+            PathCache cache;
+            std::size_t n_worker_threads { 1 };
+            std::size_t n_pending_requests { 0 };
+            std::uint64_t n_searches { 0 };
+            bool is_stopping { false };
+    };
+}
+
+#endif
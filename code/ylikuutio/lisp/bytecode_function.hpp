@@ -0,0 +1,37 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LISP_BYTECODE_FUNCTION_HPP_INCLUDED
+#define YLIKUUTIO_LISP_BYTECODE_FUNCTION_HPP_INCLUDED
+
+#include "instruction.hpp"
+
+// Include standard headers
+#include <cstdint> // std::uint32_t
+#include <vector>  // std::vector
+
+namespace yli::lisp
+{
+    struct BytecodeFunction
+    {
+        std::uint32_t symbol;             // Name of the function, `SymbolTable::npos` for top-level code.
+        std::uint32_t n_parameters { 0 };
+        std::vector<Instruction> code;
+    };
+}
+
+#endif
@@ -0,0 +1,385 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "compiler.hpp"
+#include "bytecode_function.hpp"
+#include "expr.hpp"
+#include "expr_type.hpp"
+#include "instruction.hpp"
+#include "symbol_table.hpp"
+#include "syntax_tree_list.hpp"
+#include "token.hpp"
+#include "token_type.hpp"
+#include "value.hpp"
+#include "virtual_machine.hpp"
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int64_t, std::uint32_t, std::uint64_t
+#include <iostream>    // std::cerr
+#include <optional>    // std::nullopt, std::optional
+#include <string_view> // std::string_view
+#include <utility>     // std::move
+
+namespace yli::lisp
+{
+    Compiler::Compiler(VirtualMachine& virtual_machine)
+        : virtual_machine { virtual_machine },
+        nil_constant_i { static_cast<std::uint32_t>(virtual_machine.constants.size()) }
+    {
+        this->virtual_machine.constants.emplace_back(Value::nil());
+    }
+
+    std::optional<std::size_t> Compiler::compile(const SyntaxTreeList& syntax_tree_list)
+    {
+        BytecodeFunction program { SymbolTable::npos, 0, {} };
+
+        // Find the last top-level expression that is not a `defun`, as it provides the return value.
+        std::size_t last_expr_i = syntax_tree_list.size();
+
+        for (std::size_t i = 0; i < syntax_tree_list.size(); i++)
+        {
+            const Expr& expr = syntax_tree_list.at(i);
+
+            if (expr.get_type() == ExprType::FUNCTION_CALL && expr.get_token().get_lexeme() == "defun")
+            {
+                if (!this->compile_defun(expr))
+                {
+                    return std::nullopt;
+                }
+            }
+            else
+            {
+                last_expr_i = i;
+            }
+        }
+
+        this->parameters.clear();
+
+        for (std::size_t i = 0; i < syntax_tree_list.size(); i++)
+        {
+            const Expr& expr = syntax_tree_list.at(i);
+
+            if (expr.get_type() == ExprType::FUNCTION_CALL && expr.get_token().get_lexeme() == "defun")
+            {
+                continue;
+            }
+
+            if (!this->compile_expr(expr, program, i == last_expr_i))
+            {
+                return std::nullopt;
+            }
+
+            if (i != last_expr_i)
+            {
+                program.code.push_back({ OpCode::POP });
+            }
+        }
+
+        if (last_expr_i == syntax_tree_list.size())
+        {
+            // There was no expression besides `defun`s.
+            this->emit_constant(program, this->nil_constant_i, true);
+        }
+
+        this->virtual_machine.bytecode_functions.emplace_back(std::move(program));
+        return this->virtual_machine.bytecode_functions.size() - 1;
+    }
+
+    bool Compiler::compile_defun(const Expr& defun_expr)
+    {
+        // (defun name (parameter ...) body ...)
+        if (defun_expr.get_number_of_children() < 2 ||
+                defun_expr.at(0).get_type() != ExprType::IDENTIFIER)
+        {
+            this->report_error(defun_expr, "`defun` requires a name and a parameter list");
+            return false;
+        }
+
+        this->parameters.clear();
+
+        const Expr& parameter_list = defun_expr.at(1);
+
+        if (parameter_list.get_type() == ExprType::FUNCTION_CALL)
+        {
+            // The parser produces `(foo bar)` as a function call `foo` with `bar` as its child.
+            this->parameters.push_back(this->virtual_machine.intern(parameter_list.get_token().get_lexeme()));
+
+            for (std::size_t i = 0; i < parameter_list.get_number_of_children(); i++)
+            {
+                const Expr& parameter = parameter_list.at(i);
+
+                if (parameter.get_type() != ExprType::IDENTIFIER)
+                {
+                    this->report_error(parameter, "parameters must be identifiers");
+                    return false;
+                }
+
+                this->parameters.push_back(this->virtual_machine.intern(parameter.get_token().get_lexeme()));
+            }
+        }
+        else if (parameter_list.get_type() != ExprType::IDENTIFIER || parameter_list.get_token().get_lexeme() != "nil")
+        {
+            this->report_error(parameter_list, "`defun` requires a parameter list or `nil`");
+            return false;
+        }
+
+        const std::uint32_t symbol = this->virtual_machine.intern(defun_expr.at(0).get_token().get_lexeme());
+        BytecodeFunction function { symbol, static_cast<std::uint32_t>(this->parameters.size()), {} };
+
+        if (!this->compile_sequence(defun_expr, 2, function, true))
+        {
+            return false;
+        }
+
+        this->virtual_machine.bytecode_functions.emplace_back(std::move(function));
+
+        VirtualMachine::FunctionSlot& function_slot = this->virtual_machine.get_function_slot(symbol);
+        function_slot.native_function = nullptr;
+        function_slot.bytecode_function_i = this->virtual_machine.bytecode_functions.size() - 1;
+        return true;
+    }
+
+    bool Compiler::compile_expr(const Expr& expr, BytecodeFunction& function, const bool is_tail)
+    {
+        switch (expr.get_type())
+        {
+            case ExprType::IDENTIFIER:
+                if (!this->compile_identifier(expr, function))
+                {
+                    return false;
+                }
+                break;
+            case ExprType::LITERAL:
+                if (!this->compile_literal(expr, function))
+                {
+                    return false;
+                }
+                break;
+            case ExprType::FUNCTION_CALL:
+                return this->compile_function_call(expr, function, is_tail);
+            default:
+                this->report_error(expr, "unsupported expression");
+                return false;
+        }
+
+        if (is_tail)
+        {
+            function.code.push_back({ OpCode::RETURN });
+        }
+
+        return true;
+    }
+
+    bool Compiler::compile_identifier(const Expr& expr, BytecodeFunction& function)
+    {
+        const std::string_view name = expr.get_token().get_lexeme();
+
+        if (name == "#t" || name == "#f")
+        {
+            const std::uint32_t constant_i = static_cast<std::uint32_t>(this->virtual_machine.constants.size());
+            this->virtual_machine.constants.emplace_back(Value::from_bool(name == "#t"));
+            this->emit_constant(function, constant_i, false);
+            return true;
+        }
+
+        if (name == "nil")
+        {
+            this->emit_constant(function, this->nil_constant_i, false);
+            return true;
+        }
+
+        const std::uint32_t symbol = this->virtual_machine.intern(name);
+
+        for (std::size_t i = 0; i < this->parameters.size(); i++)
+        {
+            if (this->parameters[i] == symbol)
+            {
+                function.code.push_back({ OpCode::PUSH_ARGUMENT, static_cast<std::uint32_t>(i) });
+                return true;
+            }
+        }
+
+        const std::uint32_t constant_i = static_cast<std::uint32_t>(this->virtual_machine.constants.size());
+        this->virtual_machine.constants.emplace_back(Value::from_symbol(symbol));
+        this->emit_constant(function, constant_i, false);
+        return true;
+    }
+
+    bool Compiler::compile_literal(const Expr& expr, BytecodeFunction& function)
+    {
+        const Token& token = expr.get_token();
+        Value value;
+
+        switch (token.get_type())
+        {
+            case TokenType::STRING:
+                value = Value::from_string(this->virtual_machine.intern(token.get_lexeme()));
+                break;
+            case TokenType::UNSIGNED_INTEGER:
+                value = Value::from_unsigned_integer(token.get_numeric_value<std::uint64_t>().value_or(0));
+                break;
+            case TokenType::SIGNED_INTEGER:
+                value = Value::from_signed_integer(token.get_numeric_value<std::int64_t>().value_or(0));
+                break;
+            case TokenType::FLOATING_POINT:
+                value = Value::from_floating_point(token.get_numeric_value<double>().value_or(0.0));
+                break;
+            default:
+                this->report_error(expr, "unsupported literal");
+                return false;
+        }
+
+        const std::uint32_t constant_i = static_cast<std::uint32_t>(this->virtual_machine.constants.size());
+        this->virtual_machine.constants.emplace_back(value);
+        this->emit_constant(function, constant_i, false);
+        return true;
+    }
+
+    bool Compiler::compile_function_call(const Expr& expr, BytecodeFunction& function, const bool is_tail)
+    {
+        const std::string_view name = expr.get_token().get_lexeme();
+
+        if (name == "if")
+        {
+            return this->compile_if(expr, function, is_tail);
+        }
+
+        if (name == "progn")
+        {
+            return this->compile_sequence(expr, 0, function, is_tail);
+        }
+
+        if (name == "defun")
+        {
+            this->report_error(expr, "`defun` is only allowed at top level");
+            return false;
+        }
+
+        for (std::size_t i = 0; i < expr.get_number_of_children(); i++)
+        {
+            if (!this->compile_expr(expr.at(i), function, false))
+            {
+                return false;
+            }
+        }
+
+        const std::uint32_t call_site_i = static_cast<std::uint32_t>(this->virtual_machine.call_sites.size());
+        this->virtual_machine.call_sites.push_back({
+                this->virtual_machine.intern(name),
+                static_cast<std::uint32_t>(expr.get_number_of_children()) });
+        function.code.push_back({ is_tail ? OpCode::TAIL_CALL : OpCode::CALL, call_site_i });
+        return true;
+    }
+
+    bool Compiler::compile_if(const Expr& expr, BytecodeFunction& function, const bool is_tail)
+    {
+        // (if condition then else)
+        const std::size_t n_children = expr.get_number_of_children();
+
+        if (n_children != 2 && n_children != 3)
+        {
+            this->report_error(expr, "`if` requires a condition, a `then` expression and an optional `else` expression");
+            return false;
+        }
+
+        if (!this->compile_expr(expr.at(0), function, false))
+        {
+            return false;
+        }
+
+        const std::size_t jump_to_else_i = function.code.size();
+        function.code.push_back({ OpCode::JUMP_IF_FALSE });
+
+        if (!this->compile_expr(expr.at(1), function, is_tail))
+        {
+            return false;
+        }
+
+        // In tail position both branches return, so there is nothing to jump over.
+        std::size_t jump_to_end_i = function.code.size();
+
+        if (!is_tail)
+        {
+            function.code.push_back({ OpCode::JUMP });
+        }
+
+        function.code[jump_to_else_i].operand = static_cast<std::uint32_t>(function.code.size());
+
+        if (n_children == 3)
+        {
+            if (!this->compile_expr(expr.at(2), function, is_tail))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            this->emit_constant(function, this->nil_constant_i, is_tail);
+        }
+
+        if (!is_tail)
+        {
+            function.code[jump_to_end_i].operand = static_cast<std::uint32_t>(function.code.size());
+        }
+
+        return true;
+    }
+
+    bool Compiler::compile_sequence(const Expr& expr, const std::size_t first_child_i, BytecodeFunction& function, const bool is_tail)
+    {
+        const std::size_t n_children = expr.get_number_of_children();
+
+        if (first_child_i >= n_children)
+        {
+            this->emit_constant(function, this->nil_constant_i, is_tail);
+            return true;
+        }
+
+        for (std::size_t i = first_child_i; i < n_children; i++)
+        {
+            const bool is_last = (i == n_children - 1);
+
+            if (!this->compile_expr(expr.at(i), function, is_last && is_tail))
+            {
+                return false;
+            }
+
+            if (!is_last)
+            {
+                function.code.push_back({ OpCode::POP });
+            }
+        }
+
+        return true;
+    }
+
+    void Compiler::emit_constant(BytecodeFunction& function, const std::uint32_t constant_i, const bool is_tail)
+    {
+        function.code.push_back({ OpCode::PUSH_CONSTANT, constant_i });
+
+        if (is_tail)
+        {
+            function.code.push_back({ OpCode::RETURN });
+        }
+    }
+
+    void Compiler::report_error(const Expr& expr, const char* const message) const
+    {
+        std::cerr << "ERROR: `Compiler::compile`: line " << expr.get_token().get_line() << ": " << message << "!\n";
+    }
+}
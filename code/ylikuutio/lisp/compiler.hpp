@@ -0,0 +1,78 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LISP_COMPILER_HPP_INCLUDED
+#define YLIKUUTIO_LISP_COMPILER_HPP_INCLUDED
+
+#include "bytecode_function.hpp"
+
+// Include standard headers
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint32_t
+#include <optional> // std::optional
+#include <vector>   // std::vector
+
+namespace yli::lisp
+{
+    class Expr;
+    class SyntaxTreeList;
+    class VirtualMachine;
+
+    class Compiler
+    {
+        // `Compiler` compiles the syntax trees produced by `Parser` into bytecode of `VirtualMachine`.
+        //
+        // Special forms:
+        // (defun name (parameter ...) body ...) ; Top level only. Use `nil` for no parameters.
+        // (if condition then else)             ; `else` is optional.
+        // (progn expression ...)
+        //
+        // `#t`, `#f`, and `nil` are constants. Other identifiers are parameters
+        // if the enclosing function has such a parameter, otherwise they are symbols.
+        //
+        // Every expression in tail position is compiled so that it returns its value,
+        // so function calls in tail position become `TAIL_CALL` instructions.
+
+        public:
+            explicit Compiler(VirtualMachine& virtual_machine);
+
+            // Returns the index of the compiled top-level program, or `std::nullopt` on error.
+            std::optional<std::size_t> compile(const SyntaxTreeList& syntax_tree_list);
+
+        private:
+            bool compile_defun(const Expr& defun_expr);
+            bool compile_expr(const Expr& expr, BytecodeFunction& function, bool is_tail);
+            bool compile_identifier(const Expr& expr, BytecodeFunction& function);
+            bool compile_literal(const Expr& expr, BytecodeFunction& function);
+            bool compile_function_call(const Expr& expr, BytecodeFunction& function, bool is_tail);
+            bool compile_if(const Expr& expr, BytecodeFunction& function, bool is_tail);
+            bool compile_sequence(const Expr& expr, std::size_t first_child_i, BytecodeFunction& function, bool is_tail);
+
+            void emit_constant(BytecodeFunction& function, std::uint32_t constant_i, bool is_tail);
+
+            void report_error(const Expr& expr, const char* const message) const;
+
+            VirtualMachine& virtual_machine;
+
+            // Parameters of the function being compiled.
+            std::vector<std::uint32_t> parameters;
+
+            std::uint32_t nil_constant_i;
+    };
+}
+
+#endif
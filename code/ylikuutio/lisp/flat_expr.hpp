@@ -0,0 +1,71 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LISP_FLAT_EXPR_HPP_INCLUDED
+#define YLIKUUTIO_LISP_FLAT_EXPR_HPP_INCLUDED
+
+#include "expr_type.hpp"
+#include "token_type.hpp"
+
+// Include standard headers
+#include <cstdint>     // std::int64_t, std::uint32_t, std::uint64_t
+#include <limits>      // std::numeric_limits
+#include <optional>    // std::nullopt, std::optional
+#include <string_view> // std::string_view
+#include <variant>     // std::get, std::holds_alternative, std::monostate, std::variant
+
+namespace yli::lisp
+{
+    // `FlatExpr` is a node of a `FlatSyntaxTree`.
+    //
+    // Unlike `Expr`, a `FlatExpr` does not own anything: the lexeme
+    // is a view into the source (or into the decoded string storage of
+    // the `FlatSyntaxTree`), and the children are linked by their indices
+    // in the node array of the `FlatSyntaxTree`.
+    struct FlatExpr
+    {
+        static constexpr std::uint32_t npos { std::numeric_limits<std::uint32_t>::max() };
+
+        template<typename T>
+            std::optional<T> get_numeric_value() const
+            {
+                if (std::holds_alternative<T>(this->numeric_value)) [[likely]]
+                {
+                    return std::get<T>(this->numeric_value);
+                }
+
+                return std::nullopt;
+            }
+
+        std::string_view lexeme;
+        std::variant<
+            std::monostate, // Not a number.
+            std::int64_t,
+            std::uint64_t,
+            double> numeric_value;
+        std::uint32_t line               { 0 };
+        std::uint32_t column             { 0 };
+        std::uint32_t first_child        { npos };
+        std::uint32_t last_child         { npos };
+        std::uint32_t next_sibling       { npos };
+        std::uint32_t number_of_children { 0 };
+        ExprType type                    { ExprType::LITERAL };
+        TokenType token_type             { TokenType::IDENTIFIER };
+    };
+}
+
+#endif
@@ -0,0 +1,42 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LISP_FLAT_EXPR_VISITOR_HPP_INCLUDED
+#define YLIKUUTIO_LISP_FLAT_EXPR_VISITOR_HPP_INCLUDED
+
+namespace yli::lisp
+{
+    class FlatSyntaxTree;
+    struct FlatExpr;
+
+    // `FlatExprVisitor` mirrors `ExprVisitor` for `FlatSyntaxTree` nodes,
+    // so that the same visitor class can implement both and walk
+    // either representation of a parsed program.
+    class FlatExprVisitor
+    {
+        public:
+            virtual ~FlatExprVisitor() = default;
+
+            virtual void visit_identifier_expr(const FlatSyntaxTree& syntax_tree, const FlatExpr& identifier_expr) = 0;
+            virtual void visit_literal_expr(const FlatSyntaxTree& syntax_tree, const FlatExpr& literal_expr) = 0;
+            virtual void visit_function_call_expr(const FlatSyntaxTree& syntax_tree, const FlatExpr& function_call_expr) = 0;
+            virtual void visit_defun_expr(const FlatSyntaxTree& syntax_tree, const FlatExpr& defun_expr) = 0;
+            virtual void visit_lambda_expr(const FlatSyntaxTree& syntax_tree, const FlatExpr& lambda_expr) = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,545 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "flat_parser.hpp"
+#include "flat_expr.hpp"
+#include "expr_type.hpp"
+#include "error_type.hpp"
+#include "token_type.hpp"
+#include "code/ylikuutio/string/ylikuutio_string.hpp"
+
+// Include standard headers
+#include <charconv>     // std::from_chars
+#include <cstdint>      // std::int64_t, std::uint32_t, std::uint64_t
+#include <optional>     // std::optional, std::nullopt
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <system_error> // std::errc
+#include <utility>      // std::move
+
+namespace yli::lisp
+{
+    template<typename T>
+        static std::optional<T> convert_lexeme_to_value(const std::string_view lexeme)
+        {
+            T value {};
+            const auto [ptr, error_code] = std::from_chars(lexeme.data(), lexeme.data() + lexeme.size(), value);
+
+            if (error_code != std::errc() || ptr != lexeme.data() + lexeme.size()) [[unlikely]]
+            {
+                return std::nullopt;
+            }
+
+            return value;
+        }
+
+    FlatParser::FlatParser(std::string_view source)
+        : source { source },
+        text_position { this->source.cbegin(), this->source.cend() },
+        is_success { this->parse() }
+    {
+    }
+
+    const FlatSyntaxTree& FlatParser::get_syntax_tree() const
+    {
+        return this->syntax_tree;
+    }
+
+    const ErrorLog& FlatParser::get_error_log() const
+    {
+        return this->error_log;
+    }
+
+    bool FlatParser::get_is_success() const
+    {
+        return this->is_success;
+    }
+
+    bool FlatParser::parse()
+    {
+        // Every expression takes at least one codepoint and a separator,
+        // but typical scripts have longer lexemes and whitespace.
+        // Reserving for one node per 8 bytes avoids most of the regrowth
+        // without overcommitting much memory for short scripts.
+        this->syntax_tree.reserve(this->source.size() / 8);
+
+        while (this->text_position.get_it() != this->source.cend())
+        {
+            this->text_position.advance_to_next_token();
+
+            if (std::optional<FlatToken> maybe_token = this->scan_token(); maybe_token.has_value())
+            {
+                this->parse_token(*maybe_token);
+            }
+        }
+
+        while (!this->paren_token_stack.empty())
+        {
+            const TextPosition text_position = this->paren_token_stack.back().text_position;
+            this->paren_token_stack.pop_back();
+            this->error_log.add_error(text_position, ErrorType::MATCHING_RIGHT_PARENTHESIS_MISSING);
+        }
+
+        return this->error_log.empty();
+    }
+
+    std::optional<FlatParser::FlatToken> FlatParser::scan_token()
+    {
+        // Scanning is identical to `Scanner::scan_token`.
+
+        while (this->text_position.get_it() != this->text_position.get_cend())
+        {
+            std::optional<char32_t> maybe_codepoint = this->text_position.peek_codepoint();
+
+            if (!maybe_codepoint.has_value())
+            {
+                // Scanning failed. End scanning now.
+                this->add_error(ErrorType::INVALID_UNICODE);
+                return std::nullopt;
+            }
+
+            const char32_t codepoint = maybe_codepoint.value();
+            const TextPosition start_position = this->text_position;
+
+            switch (codepoint)
+            {
+                case U'(':
+                case U')':
+                case U'[':
+                case U']':
+                case U'{':
+                case U'}':
+                case U'\'':
+                case U'.':
+                    {
+                        // Single-character tokens.
+                        const TokenType type =
+                            codepoint == U'(' ? TokenType::LEFT_PARENTHESIS :
+                            codepoint == U')' ? TokenType::RIGHT_PARENTHESIS :
+                            codepoint == U'[' ? TokenType::LEFT_SQUARE_BRACKET :
+                            codepoint == U']' ? TokenType::RIGHT_SQUARE_BRACKET :
+                            codepoint == U'{' ? TokenType::LEFT_CURLY_BRACE :
+                            codepoint == U'}' ? TokenType::RIGHT_CURLY_BRACE :
+                            codepoint == U'\'' ? TokenType::QUOTE :
+                            TokenType::DOT;
+                        const std::string_view::const_iterator token_start_it = this->text_position.get_token_start_it();
+                        return FlatToken { type, std::string_view(token_start_it, this->text_position.next(codepoint)), {}, start_position };
+                    }
+                case U';':
+                    {
+                        // Beginning of a comment. Scan until newline.
+                        while (this->text_position.get_it() != this->source.cend())
+                        {
+                            std::optional<char32_t> maybe_codepoint = this->text_position.scan_codepoint_and_advance();
+
+                            if (!maybe_codepoint.has_value()) [[unlikely]]
+                            {
+                                this->add_error(ErrorType::INVALID_UNICODE);
+                                break;
+                            }
+
+                            if (maybe_codepoint.value() == U'\n')
+                            {
+                                break;
+                            }
+                        }
+
+                        break;
+                    }
+                case U' ':
+                case U',':
+                case U'\n':
+                case U'\r':
+                case U'\t':
+                    {
+                        // Ignore whitespace.
+                        // Comma `,` counts as whitespace, too.
+                        this->text_position.next(codepoint);
+                        return std::nullopt;
+                    }
+                case U'"':
+                    {
+                        return this->scan_string_literal();
+                    }
+                default:
+                    {
+                        if (codepoint < 0x20) [[unlikely]]
+                        {
+                            // Codepoints below 0x20 (32) except the ones already processed are invalid in YliLisp.
+                            this->add_error(ErrorType::INVALID_CODEPOINT);
+                            this->text_position.next(codepoint);
+                            return std::nullopt;
+                        }
+                        else if ((codepoint >= U'0' && codepoint <= U'9') || codepoint == U'-')
+                        {
+                            // Number literal.
+                            return this->scan_number_literal();
+                        }
+
+                        // Identifier.
+                        return this->scan_identifier();
+                    }
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<FlatParser::FlatToken> FlatParser::scan_string_literal()
+    {
+        // Read until `"`. See `yli::lisp::scan_string_literal`.
+        // As long as there are no escape sequences the lexeme
+        // is a view into the source. The first escape sequence
+        // switches to decoding into `decoded_string`.
+
+        const TextPosition start_position = this->text_position;
+        this->text_position.next(U'"');
+        const std::string_view::const_iterator string_start_it = this->text_position.get_it();
+        std::string decoded_string;
+        bool is_decoded = false;
+
+        while (this->text_position.get_it() != this->text_position.get_cend())
+        {
+            std::optional<char32_t> maybe_codepoint = this->text_position.peek_codepoint();
+
+            if (!maybe_codepoint.has_value()) [[unlikely]]
+            {
+                this->add_error(ErrorType::INVALID_UNICODE);
+                return std::nullopt;
+            }
+
+            const char32_t codepoint = maybe_codepoint.value();
+
+            if (codepoint < 0x20) [[unlikely]]
+            {
+                // Invalid codepoint. Report an error.
+                this->add_error(ErrorType::INVALID_CODEPOINT);
+            }
+
+            const std::string_view::const_iterator codepoint_it = this->text_position.get_it();
+            this->text_position.next(codepoint);
+
+            if (codepoint == U'"')
+            {
+                // End of string.
+                const std::string_view lexeme = is_decoded ?
+                    this->syntax_tree.store_decoded_string(std::move(decoded_string)) :
+                    std::string_view(string_start_it, codepoint_it);
+                return FlatToken { TokenType::STRING, lexeme, {}, start_position };
+            }
+            else if (codepoint == U'\\') [[unlikely]]
+            {
+                // Escape. Read next codepoint.
+                if (!is_decoded)
+                {
+                    decoded_string.assign(string_start_it, codepoint_it);
+                    is_decoded = true;
+                }
+
+                std::optional<char32_t> maybe_second_codepoint = this->text_position.scan_codepoint_and_advance();
+
+                if (!maybe_second_codepoint.has_value())
+                {
+                    // Scanning failed.
+                    this->add_error(ErrorType::INVALID_UNICODE);
+                    return std::nullopt;
+                }
+
+                if (const char32_t second_codepoint = maybe_second_codepoint.value(); second_codepoint == U'n') [[likely]]
+                {
+                    // Newline.
+                    decoded_string.push_back('\n');
+                }
+                else if (second_codepoint == U'\\')
+                {
+                    // Backslash.
+                    decoded_string.push_back('\\');
+                }
+                else if (second_codepoint == U'"')
+                {
+                    // Double quote.
+                    decoded_string.push_back('"');
+                }
+                else if (second_codepoint == U't')
+                {
+                    // Tab.
+                    decoded_string.push_back('\t');
+                }
+                else
+                {
+                    // ERROR: Invalid character after `\` escape. Report an error.
+                    this->add_error(ErrorType::INVALID_ESCAPE_SEQUENCE);
+                }
+            }
+            else if (is_decoded)
+            {
+                // This codepoint is a part of the string. Advance to the next codepoint.
+                decoded_string.push_back(codepoint);
+            }
+        }
+
+        // No closing double quote was found.
+        // Invalid codepoint. Report an error with the text position of the opening double parenthesis.
+        TextPosition opening_double_quote_position(
+                this->text_position.get_token_start_it(),
+                this->text_position.get_it(),
+                this->text_position.get_offset(),
+                this->text_position.get_line(),
+                this->text_position.get_token_start_it() - this->text_position.get_cbegin() + 1);
+        this->error_log.add_error(opening_double_quote_position, ErrorType::CLOSING_DOUBLE_QUOTE_MISSING);
+        return std::nullopt;
+    }
+
+    std::optional<FlatParser::FlatToken> FlatParser::scan_number_literal()
+    {
+        // See `yli::lisp::scan_number_literal` and `yli::lisp::convert_string_to_value`.
+        const TextPosition start_position = this->text_position;
+
+        while (this->text_position.get_it() != this->text_position.get_cend())
+        {
+            std::optional<char32_t> maybe_codepoint = this->text_position.peek_codepoint();
+
+            if (!maybe_codepoint.has_value()) [[unlikely]]
+            {
+                this->add_error(ErrorType::INVALID_UNICODE);
+                return std::nullopt;
+            }
+
+            const char32_t codepoint = maybe_codepoint.value();
+
+            if (FlatParser::is_reserved_codepoint(codepoint) || codepoint < 0x20) [[unlikely]]
+            {
+                // Reserved codepoint. End of number literal.
+                break;
+            }
+
+            this->text_position.next(codepoint);
+        }
+
+        const std::string_view lexeme(this->text_position.get_token_start_it(), this->text_position.get_it());
+
+        if (yli::string::check_if_unsigned_integer_string(lexeme))
+        {
+            // OK, so this is a unsigned integer string.
+            if (std::optional<std::uint64_t> maybe_uint64_t = convert_lexeme_to_value<std::uint64_t>(lexeme); maybe_uint64_t.has_value()) [[likely]]
+            {
+                return FlatToken { TokenType::UNSIGNED_INTEGER, lexeme, *maybe_uint64_t, start_position };
+            }
+
+            this->error_log.add_error(start_position, ErrorType::INVALID_UNSIGNED_INTEGER_LITERAL);
+            return std::nullopt;
+        }
+        else if (yli::string::check_if_signed_integer_string(lexeme))
+        {
+            // OK, so this is a signed integer string.
+            if (std::optional<std::int64_t> maybe_int64_t = convert_lexeme_to_value<std::int64_t>(lexeme); maybe_int64_t.has_value()) [[likely]]
+            {
+                return FlatToken { TokenType::SIGNED_INTEGER, lexeme, *maybe_int64_t, start_position };
+            }
+
+            this->error_log.add_error(start_position, ErrorType::INVALID_SIGNED_INTEGER_LITERAL);
+            return std::nullopt;
+        }
+        else if (yli::string::check_if_double_string(lexeme))
+        {
+            // OK, this is a floating point string that can fit in IEEE-754 double precision variable (`double` in C++).
+            if (std::optional<double> maybe_double = convert_lexeme_to_value<double>(lexeme); maybe_double.has_value()) [[likely]]
+            {
+                return FlatToken { TokenType::FLOATING_POINT, lexeme, *maybe_double, start_position };
+            }
+
+            this->error_log.add_error(start_position, ErrorType::INVALID_FLOATING_POINT_LITERAL);
+            return std::nullopt;
+        }
+
+        this->error_log.add_error(start_position, ErrorType::INVALID_NUMBER_LITERAL);
+        return std::nullopt;
+    }
+
+    std::optional<FlatParser::FlatToken> FlatParser::scan_identifier()
+    {
+        // See `yli::lisp::scan_identifier`.
+        const TextPosition start_position = this->text_position;
+
+        while (this->text_position.get_it() != this->text_position.get_cend())
+        {
+            std::optional<char32_t> maybe_codepoint = this->text_position.peek_codepoint();
+
+            if (!maybe_codepoint.has_value()) [[unlikely]]
+            {
+                this->add_error(ErrorType::INVALID_UNICODE);
+                return std::nullopt;
+            }
+
+            const char32_t codepoint = maybe_codepoint.value();
+
+            if (FlatParser::is_reserved_codepoint(codepoint) || codepoint < 0x20) [[unlikely]]
+            {
+                // Reserved codepoint. End of identifier.
+                break;
+            }
+
+            this->text_position.next(codepoint);
+        }
+
+        const std::string_view lexeme(this->text_position.get_token_start_it(), this->text_position.get_it());
+        return FlatToken { TokenType::IDENTIFIER, lexeme, {}, start_position };
+    }
+
+    void FlatParser::parse_token(const FlatToken& token)
+    {
+        // Parsing is identical to `Parser::parse`, with `FlatExpr::npos` in place of `nullptr`.
+
+        if (token.type == TokenType::LEFT_PARENTHESIS ||
+                token.type == TokenType::LEFT_SQUARE_BRACKET ||
+                token.type == TokenType::LEFT_CURLY_BRACE)
+        {
+            // This token is the beginning of a parenthesis, square bracket or curly brace expression.
+            this->paren_token_stack.emplace_back(token);
+            this->parent_stack.emplace_back(this->current_parent);
+            this->current_parent = FlatExpr::npos;
+            return;
+        }
+
+        const TokenType open_type = this->paren_token_stack.empty() ? token.type : this->paren_token_stack.back().type;
+
+        if ((token.type == TokenType::RIGHT_PARENTHESIS && open_type == TokenType::LEFT_PARENTHESIS) ||
+                (token.type == TokenType::RIGHT_SQUARE_BRACKET && open_type == TokenType::LEFT_SQUARE_BRACKET) ||
+                (token.type == TokenType::RIGHT_CURLY_BRACE && open_type == TokenType::LEFT_CURLY_BRACE))
+        {
+            // This token is the end of a parenthesized expression, a horizontal concatenation or a vertical concatenation.
+            const bool is_empty_parenthesis_block = token.type == TokenType::RIGHT_PARENTHESIS && this->current_parent == FlatExpr::npos;
+            this->paren_token_stack.pop_back();
+
+            // Restore the parent from stack (if any).
+            this->current_parent = this->parent_stack.back();
+            this->parent_stack.pop_back();
+
+            if (is_empty_parenthesis_block)
+            {
+                // Error: empty parenthesis block.
+                // `()` is not supported. Use `null` instead.
+                this->error_log.add_error(token.text_position, ErrorType::EMPTY_PARENTHESIS_BLOCK);
+            }
+        }
+        else if (!this->paren_token_stack.empty() && token.type == TokenType::RIGHT_PARENTHESIS)
+        {
+            // Error: left square bracket or left curly brace and right parenthesis do not match!
+            this->error_log.add_error(
+                    token.text_position,
+                    open_type == TokenType::LEFT_SQUARE_BRACKET ?
+                    ErrorType::LEFT_SQUARE_BRACKET_WITH_RIGHT_PARENTHESIS :
+                    ErrorType::LEFT_CURLY_BRACE_WITH_RIGHT_PARENTHESIS);
+        }
+        else if (!this->paren_token_stack.empty() && token.type == TokenType::RIGHT_SQUARE_BRACKET)
+        {
+            // Error: left parenthesis or left curly brace and right square bracket do not match!
+            this->error_log.add_error(
+                    token.text_position,
+                    open_type == TokenType::LEFT_PARENTHESIS ?
+                    ErrorType::LEFT_PARENTHESIS_WITH_RIGHT_SQUARE_BRACKET :
+                    ErrorType::LEFT_CURLY_BRACE_WITH_RIGHT_SQUARE_BRACKET);
+        }
+        else if (!this->paren_token_stack.empty() && token.type == TokenType::RIGHT_CURLY_BRACE)
+        {
+            // Error: left parenthesis or left square bracket and right curly brace do not match!
+            this->error_log.add_error(
+                    token.text_position,
+                    open_type == TokenType::LEFT_PARENTHESIS ?
+                    ErrorType::LEFT_PARENTHESIS_WITH_RIGHT_CURLY_BRACE :
+                    ErrorType::LEFT_SQUARE_BRACKET_WITH_RIGHT_CURLY_BRACE);
+        }
+        else if (token.type == TokenType::RIGHT_PARENTHESIS)
+        {
+            // Error: no matching left parenthesis!
+            this->error_log.add_error(token.text_position, ErrorType::MATCHING_LEFT_PARENTHESIS_MISSING);
+        }
+        else if (token.type == TokenType::IDENTIFIER && this->current_parent == FlatExpr::npos && this->paren_token_stack.size() > 1)
+        {
+            // This is a function call (not top level).
+            this->current_parent = this->bind_to_parent_or_become_root(
+                    this->parent_stack.back(), token, ExprType::FUNCTION_CALL, TokenType::FUNCTION_CALL);
+        }
+        else if (token.type == TokenType::IDENTIFIER && this->current_parent == FlatExpr::npos && this->paren_token_stack.size() == 1)
+        {
+            // This is a top-level function call.
+            this->current_parent = this->bind_to_parent_or_become_root(
+                    this->current_parent, token, ExprType::FUNCTION_CALL, TokenType::FUNCTION_CALL);
+        }
+        else if (token.type == TokenType::IDENTIFIER)
+        {
+            // This is a top-level identifier evaluation, or an identifier given as argument.
+            this->bind_to_parent_or_become_root(this->current_parent, token, ExprType::IDENTIFIER, token.type);
+        }
+        else if (!this->paren_token_stack.empty() && this->current_parent == FlatExpr::npos)
+        {
+            // Syntax error: an identifier is expected after opening parenthesis.
+            this->error_log.add_error(token.text_position, ErrorType::FUNCTION_CALL_EXPECTED);
+        }
+        else if (token.type == TokenType::STRING ||
+                token.type == TokenType::UNSIGNED_INTEGER ||
+                token.type == TokenType::SIGNED_INTEGER ||
+                token.type == TokenType::FLOATING_POINT)
+        {
+            // Literal argument.
+            this->bind_to_parent_or_become_root(this->current_parent, token, ExprType::LITERAL, token.type);
+        }
+
+        // TODO: implement quoting and member access, as in `Parser`!
+    }
+
+    std::uint32_t FlatParser::bind_to_parent_or_become_root(
+            const std::uint32_t parent_i,
+            const FlatToken& token,
+            const ExprType expr_type,
+            const TokenType token_type)
+    {
+        FlatExpr expr;
+        expr.lexeme = token.lexeme;
+        expr.numeric_value = token.numeric_value;
+        expr.line = static_cast<std::uint32_t>(token.text_position.get_line());
+        expr.column = static_cast<std::uint32_t>(token.text_position.get_column());
+        expr.type = expr_type;
+        expr.token_type = token_type;
+        return this->syntax_tree.bind_to_parent_or_become_root(parent_i, expr);
+    }
+
+    void FlatParser::add_error(const ErrorType error_type)
+    {
+        this->error_log.add_error(this->text_position, error_type);
+    }
+
+    bool FlatParser::is_reserved_codepoint(const char32_t codepoint)
+    {
+        // Same as `Scanner::reserved_codepoints`, without hashing.
+        switch (codepoint)
+        {
+            case U'(':
+            case U')':
+            case U'\'':
+            case U';':
+            case U' ':
+            case U'\r':
+            case U'\t':
+            case U'\n':
+            case U'"':
+                return true;
+            default:
+                return false;
+        }
+    }
+}
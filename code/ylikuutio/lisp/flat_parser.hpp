@@ -0,0 +1,97 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LISP_FLAT_PARSER_HPP_INCLUDED
+#define YLIKUUTIO_LISP_FLAT_PARSER_HPP_INCLUDED
+
+#include "flat_syntax_tree.hpp"
+#include "error_log.hpp"
+#include "error_type.hpp"
+#include "expr_type.hpp"
+#include "text_position.hpp"
+#include "token_type.hpp"
+
+// Include standard headers
+#include <cstdint>     // std::int64_t, std::uint32_t, std::uint64_t
+#include <optional>    // std::optional
+#include <string_view> // std::string_view
+#include <variant>     // std::monostate, std::variant
+#include <vector>      // std::vector
+
+namespace yli::lisp
+{
+    class FlatParser
+    {
+        // `FlatParser` scans and parses in one pass and produces
+        // a `FlatSyntaxTree` instead of a `TokenList` and a `SyntaxTreeList`.
+        // The grammar, the resulting tree shape and the reported errors
+        // are the same as with `Scanner` followed by `Parser`.
+        //
+        // Tokens are never materialized as `Token`s: lexemes are views
+        // into `source`, so `source` must outlive the `FlatParser`.
+        // Apart from the amortized growth of the node array and the
+        // decoding of string literals with escape sequences, parsing
+        // does not allocate.
+
+        public:
+            explicit FlatParser(std::string_view source);
+
+            [[nodiscard]] const FlatSyntaxTree& get_syntax_tree() const;
+            [[nodiscard]] const ErrorLog& get_error_log() const;
+
+            [[nodiscard]] bool get_is_success() const;
+
+        private:
+            struct FlatToken
+            {
+                TokenType type;
+                std::string_view lexeme;
+                std::variant<std::monostate, std::int64_t, std::uint64_t, double> numeric_value;
+                TextPosition text_position;
+            };
+
+            bool parse();
+
+            std::optional<FlatToken> scan_token();
+            std::optional<FlatToken> scan_string_literal();
+            std::optional<FlatToken> scan_number_literal();
+            std::optional<FlatToken> scan_identifier();
+
+            void parse_token(const FlatToken& token);
+
+            // If there is a parent `FlatExpr` bind to it, otherwise start a new syntax tree by becoming its root `FlatExpr`.
+            std::uint32_t bind_to_parent_or_become_root(std::uint32_t parent_i, const FlatToken& token, ExprType expr_type, TokenType token_type);
+
+            void add_error(ErrorType error_type);
+
+            static bool is_reserved_codepoint(char32_t codepoint);
+
+            std::string_view source;
+            TextPosition text_position;
+            FlatSyntaxTree syntax_tree;
+            ErrorLog error_log;
+
+            // Parser state, see `Parser`.
+            std::vector<FlatToken> paren_token_stack;
+            std::vector<std::uint32_t> parent_stack;
+            std::uint32_t current_parent { FlatExpr::npos };
+
+            const bool is_success;
+    };
+}
+
+#endif
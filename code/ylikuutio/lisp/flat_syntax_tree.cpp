@@ -0,0 +1,160 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "flat_syntax_tree.hpp"
+#include "flat_expr.hpp"
+#include "flat_expr_visitor.hpp"
+#include "expr_type.hpp"
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <stdexcept>   // std::out_of_range
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <utility>     // std::move
+
+namespace yli::lisp
+{
+    const FlatExpr& FlatSyntaxTree::at(const std::size_t i) const
+    {
+        return this->nodes[this->roots.at(i)];
+    }
+
+    bool FlatSyntaxTree::empty() const
+    {
+        return this->roots.empty();
+    }
+
+    std::size_t FlatSyntaxTree::size() const
+    {
+        return this->roots.size();
+    }
+
+    const FlatExpr& FlatSyntaxTree::at(const FlatExpr& expr, const std::size_t i) const
+    {
+        if (i >= expr.number_of_children) [[unlikely]]
+        {
+            throw std::out_of_range("FlatSyntaxTree::at: child index out of range");
+        }
+
+        const FlatExpr* child = this->get_first_child(expr);
+
+        for (std::size_t child_i = 0; child_i < i; child_i++)
+        {
+            child = this->get_next_sibling(*child);
+        }
+
+        return *child;
+    }
+
+    const FlatExpr* FlatSyntaxTree::get_first_child(const FlatExpr& expr) const
+    {
+        return expr.first_child != FlatExpr::npos ? &this->nodes[expr.first_child] : nullptr;
+    }
+
+    const FlatExpr* FlatSyntaxTree::get_next_sibling(const FlatExpr& expr) const
+    {
+        return expr.next_sibling != FlatExpr::npos ? &this->nodes[expr.next_sibling] : nullptr;
+    }
+
+    const std::vector<FlatExpr>& FlatSyntaxTree::data() const
+    {
+        return this->nodes;
+    }
+
+    std::size_t FlatSyntaxTree::get_number_of_nodes() const
+    {
+        return this->nodes.size();
+    }
+
+    void FlatSyntaxTree::accept(const FlatExpr& expr, FlatExprVisitor& visitor) const
+    {
+        switch (expr.type)
+        {
+            case ExprType::IDENTIFIER:
+                visitor.visit_identifier_expr(*this, expr);
+                break;
+            case ExprType::LITERAL:
+                visitor.visit_literal_expr(*this, expr);
+                break;
+            case ExprType::FUNCTION_CALL:
+                visitor.visit_function_call_expr(*this, expr);
+                break;
+            case ExprType::DEFUN:
+                visitor.visit_defun_expr(*this, expr);
+                break;
+            case ExprType::LAMBDA:
+                visitor.visit_lambda_expr(*this, expr);
+                break;
+        }
+    }
+
+    void FlatSyntaxTree::clear()
+    {
+        this->nodes.clear();
+        this->roots.clear();
+        this->decoded_strings.clear();
+    }
+
+    void FlatSyntaxTree::reserve(const std::size_t n_nodes)
+    {
+        this->nodes.reserve(n_nodes);
+    }
+
+    std::uint32_t FlatSyntaxTree::bind_to_parent_or_become_root(const std::uint32_t parent_i, const FlatExpr& expr)
+    {
+        // Bind `expr` to the parent expression (`parent_i`),
+        // unless `parent_i` is `npos`, in which case start a new
+        // syntax tree. In either case return the index of the newly
+        // bound expression.
+
+        const std::uint32_t expr_i = static_cast<std::uint32_t>(this->nodes.size());
+        this->nodes.emplace_back(expr);
+
+        if (parent_i != FlatExpr::npos) [[likely]]
+        {
+            // There is a parent `FlatExpr`, so bind to it.
+            FlatExpr& parent = this->nodes[parent_i];
+
+            if (parent.last_child != FlatExpr::npos)
+            {
+                this->nodes[parent.last_child].next_sibling = expr_i;
+            }
+            else
+            {
+                parent.first_child = expr_i;
+            }
+
+            parent.last_child = expr_i;
+            parent.number_of_children++;
+        }
+        else
+        {
+            // There is no parent `FlatExpr`, so start
+            // a new syntax tree by becoming its root `FlatExpr`.
+            this->roots.emplace_back(expr_i);
+        }
+
+        return expr_i;
+    }
+
+    std::string_view FlatSyntaxTree::store_decoded_string(std::string&& decoded_string)
+    {
+        return this->decoded_strings.emplace_back(std::move(decoded_string));
+    }
+}
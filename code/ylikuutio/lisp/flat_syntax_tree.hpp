@@ -0,0 +1,81 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LISP_FLAT_SYNTAX_TREE_HPP_INCLUDED
+#define YLIKUUTIO_LISP_FLAT_SYNTAX_TREE_HPP_INCLUDED
+
+#include "flat_expr.hpp"
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <deque>       // std::deque
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+namespace yli::lisp
+{
+    class FlatExprVisitor;
+
+    class FlatSyntaxTree
+    {
+        // `FlatSyntaxTree` stores all `FlatExpr` nodes of all syntax trees
+        // of a program in one array, in the order they were parsed.
+        // Children are linked by indices (`first_child`, `next_sibling`),
+        // so building the tree does not allocate per node and destroying
+        // it frees everything in one step.
+        //
+        // String literals without escape sequences are views into the source,
+        // so the source must outlive the `FlatSyntaxTree`. String literals
+        // with escape sequences are decoded into storage owned by the tree.
+
+        public:
+            FlatSyntaxTree() = default;
+
+            // Roots of the syntax trees.
+            [[nodiscard]] const FlatExpr& at(std::size_t i) const;
+            [[nodiscard]] bool empty() const;
+            [[nodiscard]] std::size_t size() const;
+
+            // Children of `expr`.
+            [[nodiscard]] const FlatExpr& at(const FlatExpr& expr, std::size_t i) const;
+            [[nodiscard]] const FlatExpr* get_first_child(const FlatExpr& expr) const;
+            [[nodiscard]] const FlatExpr* get_next_sibling(const FlatExpr& expr) const;
+
+            [[nodiscard]] const std::vector<FlatExpr>& data() const;
+            [[nodiscard]] std::size_t get_number_of_nodes() const;
+
+            void accept(const FlatExpr& expr, FlatExprVisitor& visitor) const;
+
+            // Removes all nodes but keeps the capacity for the next parse.
+            void clear();
+            void reserve(std::size_t n_nodes);
+
+            // If there is a parent `FlatExpr` bind to it, otherwise start a new syntax tree by becoming its root `FlatExpr`.
+            std::uint32_t bind_to_parent_or_become_root(std::uint32_t parent_i, const FlatExpr& expr);
+
+            std::string_view store_decoded_string(std::string&& decoded_string);
+
+        private:
+            std::vector<FlatExpr> nodes;
+            std::vector<std::uint32_t> roots;
+            std::deque<std::string> decoded_strings; // `std::deque` keeps the views valid when it grows.
+    };
+}
+
+#endif
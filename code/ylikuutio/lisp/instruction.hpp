@@ -0,0 +1,51 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LISP_INSTRUCTION_HPP_INCLUDED
+#define YLIKUUTIO_LISP_INSTRUCTION_HPP_INCLUDED
+
+// Include standard headers
+#include <cstdint> // std::uint8_t, std::uint32_t
+
+namespace yli::lisp
+{
+    enum class OpCode : std::uint8_t
+    {
+        PUSH_CONSTANT, // Push `constants[operand]`.
+        PUSH_ARGUMENT, // Push argument `operand` of the current frame.
+        POP,           // Discard the topmost value.
+        JUMP,          // Continue from instruction `operand`.
+        JUMP_IF_FALSE, // Pop a value and continue from instruction `operand` if it is `nil` or `#f`.
+        CALL,          // Call `call_sites[operand]`, its arguments are the topmost values.
+        TAIL_CALL,     // Like `CALL`, but reuse the current frame.
+        RETURN         // Return the topmost value to the caller.
+    };
+
+    struct Instruction
+    {
+        OpCode op_code;
+        std::uint32_t operand { 0 };
+    };
+
+    struct CallSite
+    {
+        std::uint32_t symbol;       // The function to call.
+        std::uint32_t n_arguments;
+    };
+}
+
+#endif
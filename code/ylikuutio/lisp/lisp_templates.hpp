@@ -19,6 +19,7 @@
 #define YLIKUUTIO_LISP_LISP_TEMPLATES_HPP_INCLUDED
 
 #include "code/ylikuutio/data/wrap.hpp"
+#include "code/ylikuutio/lisp/parameter_class.hpp"
 #include "code/ylikuutio/ontology/entity.hpp"
 #include "code/ylikuutio/ontology/universe.hpp"
 #include "code/ylikuutio/ontology/variable.hpp"
@@ -38,12 +39,13 @@
 #include "code/ylikuutio/ontology/vector_font.hpp"
 #include "code/ylikuutio/ontology/text_3d.hpp"
 #include "code/ylikuutio/ontology/console.hpp"
-#include "code/ylikuutio/string/ylikuutio_string.hpp"
 
 // Include standard headers
+#include <cmath>    // std::abs
 #include <cstddef>  // std::size_t
 #include <cstdint>  // std::int32_t, std::int64_t, std::uint32_t, std::uint64_t
-#include <sstream>  // std::stringstream
+#include <limits>   // std::numeric_limits
+#include <span>     // std::span
 #include <string>   // std::string
 #include <vector>   // std::vector
 
@@ -51,6 +53,9 @@ namespace yli::lisp
 {
     // Templates for processing Lisp function arguments.
     //
+    // Each argument string is converted only once, by `convert_arguments`,
+    // and the templates below just pick the already converted value.
+    //
     // The default environment is `Universe`.
     //
     // 1. If the callback has `yli::ontology::Universe&` or `yli::ontology::Universe*` as an argument,
@@ -63,268 +68,268 @@ namespace yli::lisp
     //    The `Console` is set as environment.
     //
     // 3. Otherwise, if the callback has `yli::ontology::Entity&` or `yli::ontology::Entity*` or
-    //    some subtype of `Entity` as an argument, then the string will be looked up and converted into that.
+    //    some subtype of `Entity` as an argument, then the looked up `Entity` will be provided.
     //    The `Entity` is set as environment.
     //
-    // 4. If the callback has `bool` as an argument, then the string will be converted into that.
+    // 4. If the callback has `bool` as an argument, then the converted value will be provided.
+    //
+    // 5. If the callback has `float` as an argument, then the converted value will be provided.
     //
-    // 5. If the callback has `float` as an argument, then the string will be converted into that.
+    // 6. If the callback has `double` as an argument, then the converted value will be provided.
     //
-    // 6. If the callback has `double` as an argument, then the string will be converted into that.
+    // 7. If the callback has `std::int32_t` as an argument, then the converted value will be provided.
     //
-    // 7. If the callback has `std::int32_t` as an argument, then the string will be converted into that.
+    // 8. If the callback has `std::uint32_t` as an argument, then the converted value will be provided.
     //
-    // 8. If the callback has `std::uint32_t` as an argument, then the string will be converted into that.
+    // 9. If the callback has `const std::vector<std::string>&` as its last argument,
+    //    then all remaining argument strings, at least one, are bound to it.
 
     template<typename T1>
-        std::optional<typename data::WrapAllButStrings<T1>::type> convert_string_to_value_and_advance_index(
+        std::optional<typename data::WrapAllButStrings<T1>::type> convert_argument_to_value_and_advance_index(
                 ontology::Universe&,
                 ontology::Console&,
-                ontology::Entity*&,         // environment.
-                const std::vector<std::string>&, // parameter vector.
-                std::size_t&) = delete;          // parameter_i.
+                ontology::Entity*&,                 // environment.
+                std::span<const ConvertedArgument>, // arguments.
+                std::size_t&) = delete;             // argument_i.
 
     template<>
-        inline std::optional<data::WrapAllButStrings<bool>::type> convert_string_to_value_and_advance_index<bool>(
+        inline std::optional<data::WrapAllButStrings<bool>::type> convert_argument_to_value_and_advance_index<bool>(
                 ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*&, // environment.
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
-
-            if (my_string == "true") // Ylikuutio is case sensitive!
+            if (const ConvertedArgument& argument = arguments[argument_i++];
+                argument.classes & get_parameter_class_bit(ParameterClass::BOOL))
             {
-                return true; // OK, true.
-            }
-            if (my_string == "false") // Ylikuutio is case sensitive!
-            {
-                return false; // OK, false.
+                return argument.boolean;
             }
+
             return std::nullopt;
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<char>::type> convert_string_to_value_and_advance_index<char>(
+        inline std::optional<data::WrapAllButStrings<char>::type> convert_argument_to_value_and_advance_index<char>(
                 ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*&, // environment.
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            if (const std::string& my_string = parameter_vector.at(parameter_i++); my_string.size() == 1)
+            if (const ConvertedArgument& argument = arguments[argument_i++];
+                argument.classes & get_parameter_class_bit(ParameterClass::CHAR))
             {
-                return my_string[0];
+                return argument.character;
             }
 
             return std::nullopt;
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<float>::type> convert_string_to_value_and_advance_index<float>(
+        inline std::optional<data::WrapAllButStrings<float>::type> convert_argument_to_value_and_advance_index<float>(
                 ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*&, // environment.
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
-
-            if (!string::check_if_float_string<char>(my_string))
+            if (const ConvertedArgument& argument = arguments[argument_i++];
+                (argument.classes & get_parameter_class_bit(ParameterClass::FLOATING_POINT)) &&
+                std::abs(argument.floating_point) <= std::numeric_limits<float>::max())
             {
-                return std::nullopt;
+                return static_cast<float>(argument.floating_point);
             }
 
-            float value;
-            std::stringstream my_stringstream;
-            my_stringstream << my_string;
-            my_stringstream >> value;
-            return value;
+            return std::nullopt;
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<double>::type> convert_string_to_value_and_advance_index<double>(
+        inline std::optional<data::WrapAllButStrings<double>::type> convert_argument_to_value_and_advance_index<double>(
                 ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*&, // environment.
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
-
-            if (!string::check_if_double_string<char>(my_string))
+            if (const ConvertedArgument& argument = arguments[argument_i++];
+                argument.classes & get_parameter_class_bit(ParameterClass::FLOATING_POINT))
             {
-                return std::nullopt;
+                return argument.floating_point;
             }
 
-            double value;
-            std::stringstream my_stringstream;
-            my_stringstream << my_string;
-            my_stringstream >> value;
-            return value;
+            return std::nullopt;
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<std::int32_t>::type> convert_string_to_value_and_advance_index<std::int32_t>(
+        inline std::optional<data::WrapAllButStrings<std::int32_t>::type> convert_argument_to_value_and_advance_index<std::int32_t>(
                 ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*&, // environment.
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
-
-            if (!string::check_if_signed_integer_string<char>(my_string))
+            if (const ConvertedArgument& argument = arguments[argument_i++];
+                (argument.classes & get_parameter_class_bit(ParameterClass::SIGNED_INTEGER)) &&
+                argument.signed_integer >= std::numeric_limits<std::int32_t>::min() &&
+                argument.signed_integer <= std::numeric_limits<std::int32_t>::max())
             {
-                return std::nullopt;
+                return static_cast<std::int32_t>(argument.signed_integer);
             }
 
-            std::int32_t value;
-            std::stringstream my_stringstream;
-            my_stringstream << my_string;
-            my_stringstream >> value;
-            return value;
+            return std::nullopt;
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<std::uint32_t>::type> convert_string_to_value_and_advance_index<std::uint32_t>(
+        inline std::optional<data::WrapAllButStrings<std::uint32_t>::type> convert_argument_to_value_and_advance_index<std::uint32_t>(
                 ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*&, // environment.
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
-
-            if (!string::check_if_unsigned_integer_string<char>(my_string))
+            if (const ConvertedArgument& argument = arguments[argument_i++];
+                (argument.classes & get_parameter_class_bit(ParameterClass::UNSIGNED_INTEGER)) &&
+                argument.unsigned_integer <= std::numeric_limits<std::uint32_t>::max())
             {
-                return std::nullopt;
+                return static_cast<std::uint32_t>(argument.unsigned_integer);
             }
 
-            std::uint32_t value;
-            std::stringstream my_stringstream;
-            my_stringstream << my_string;
-            my_stringstream >> value;
-            return value;
+            return std::nullopt;
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<std::int64_t>::type> convert_string_to_value_and_advance_index<std::int64_t>(
+        inline std::optional<data::WrapAllButStrings<std::int64_t>::type> convert_argument_to_value_and_advance_index<std::int64_t>(
                 ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*&, // environment.
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
-
-            if (!string::check_if_signed_integer_string<char>(my_string))
+            if (const ConvertedArgument& argument = arguments[argument_i++];
+                argument.classes & get_parameter_class_bit(ParameterClass::SIGNED_INTEGER))
             {
-                return std::nullopt;
+                return argument.signed_integer;
             }
 
-            std::int64_t value;
-            std::stringstream my_stringstream;
-            my_stringstream << my_string;
-            my_stringstream >> value;
-            return value;
+            return std::nullopt;
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<std::uint64_t>::type> convert_string_to_value_and_advance_index<std::uint64_t>(
+        inline std::optional<data::WrapAllButStrings<std::uint64_t>::type> convert_argument_to_value_and_advance_index<std::uint64_t>(
                 ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*&, // environment.
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            if (const ConvertedArgument& argument = arguments[argument_i++];
+                argument.classes & get_parameter_class_bit(ParameterClass::UNSIGNED_INTEGER))
+            {
+                return argument.unsigned_integer;
+            }
 
-            if (!string::check_if_unsigned_integer_string<char>(my_string))
+            return std::nullopt;
+        }
+
+    template<>
+        inline std::optional<data::WrapAllButStrings<const std::string&>::type> convert_argument_to_value_and_advance_index<const std::string&>(
+                ontology::Universe&,
+                ontology::Console&,
+                ontology::Entity*&, // environment.
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
+        {
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            std::uint64_t value;
-            std::stringstream my_stringstream;
-            my_stringstream << my_string;
-            my_stringstream >> value;
-            return value;
+            return *arguments[argument_i++].string;
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<const std::string&>::type> convert_string_to_value_and_advance_index<const std::string&>(
+        inline std::optional<data::WrapAllButStrings<const std::vector<std::string>&>::type> convert_argument_to_value_and_advance_index<const std::vector<std::string>&>(
                 ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*&, // environment.
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            // Note: this specialization consumes all remaining parameters, at least one.
+
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            return parameter_vector.at(parameter_i++);
+            std::vector<std::string> rest;
+            rest.reserve(arguments.size() - argument_i);
+
+            for ( ; argument_i < arguments.size(); argument_i++)
+            {
+                rest.emplace_back(*arguments[argument_i].string);
+            }
+
+            return rest;
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Entity&>::type> convert_string_to_value_and_advance_index<ontology::Entity&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Entity&>::type> convert_argument_to_value_and_advance_index<ontology::Entity&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            ontology::Entity* const value = universe.get_entity(my_string);
+            ontology::Entity* const value = argument.entity;
 
             if (value == nullptr)
             {
@@ -336,21 +341,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Entity*>::type> convert_string_to_value_and_advance_index<ontology::Entity*>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Entity*>::type> convert_argument_to_value_and_advance_index<ontology::Entity*>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            ontology::Entity* const value = universe.get_entity(my_string);
+            ontology::Entity* const value = argument.entity;
 
             if (value == nullptr)
             {
@@ -362,21 +367,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<const ontology::Entity&>::type> convert_string_to_value_and_advance_index<const ontology::Entity&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<const ontology::Entity&>::type> convert_argument_to_value_and_advance_index<const ontology::Entity&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            ontology::Entity* const value = universe.get_entity(my_string);
+            ontology::Entity* const value = argument.entity;
 
             if (value == nullptr)
             {
@@ -388,21 +393,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Movable&>::type> convert_string_to_value_and_advance_index<ontology::Movable&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Movable&>::type> convert_argument_to_value_and_advance_index<ontology::Movable&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Movable*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Movable*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -414,12 +419,12 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Universe&>::type> convert_string_to_value_and_advance_index<ontology::Universe&>(
+        inline std::optional<data::WrapAllButStrings<ontology::Universe&>::type> convert_argument_to_value_and_advance_index<ontology::Universe&>(
                 ontology::Universe& universe,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>&, // parameter vector.
-                std::size_t&)                    // parameter_i.
+                std::span<const ConvertedArgument>, // arguments.
+                std::size_t&)                       // argument_i.
         {
             // Note: this specialization returns the `yli::ontology::Universe&` provided as an argument,
             // and does not do a lookup.
@@ -429,12 +434,12 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Universe*>::type> convert_string_to_value_and_advance_index<ontology::Universe*>(
+        inline std::optional<data::WrapAllButStrings<ontology::Universe*>::type> convert_argument_to_value_and_advance_index<ontology::Universe*>(
                 ontology::Universe& universe,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>&, // parameter vector.
-                std::size_t&)                    // parameter_i.
+                std::span<const ConvertedArgument>, // arguments.
+                std::size_t&)                       // argument_i.
         {
             // Note: this specialization returns the `yli::ontology::Universe*` provided as an argument,
             // and does not do a lookup.
@@ -444,12 +449,12 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<const ontology::Universe&>::type> convert_string_to_value_and_advance_index<const ontology::Universe&>(
+        inline std::optional<data::WrapAllButStrings<const ontology::Universe&>::type> convert_argument_to_value_and_advance_index<const ontology::Universe&>(
                 ontology::Universe& universe,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>&, // parameter vector.
-                std::size_t&)                    // parameter_i.
+                std::span<const ConvertedArgument>, // arguments.
+                std::size_t&)                       // argument_i.
         {
             // Note: this specialization returns the `yli::ontology::Universe&` provided as an argument,
             // and does not do a lookup.
@@ -459,21 +464,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Variable&>::type> convert_string_to_value_and_advance_index<ontology::Variable&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Variable&>::type> convert_argument_to_value_and_advance_index<ontology::Variable&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Variable*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Variable*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -485,21 +490,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Variable*>::type> convert_string_to_value_and_advance_index<ontology::Variable*>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Variable*>::type> convert_argument_to_value_and_advance_index<ontology::Variable*>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Variable*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Variable*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -511,21 +516,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<const ontology::Variable&>::type> convert_string_to_value_and_advance_index<const ontology::Variable&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<const ontology::Variable&>::type> convert_argument_to_value_and_advance_index<const ontology::Variable&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Variable*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Variable*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -537,21 +542,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Ecosystem&>::type> convert_string_to_value_and_advance_index<ontology::Ecosystem&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Ecosystem&>::type> convert_argument_to_value_and_advance_index<ontology::Ecosystem&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Ecosystem*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Ecosystem*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -563,21 +568,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Scene&>::type> convert_string_to_value_and_advance_index<ontology::Scene&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Scene&>::type> convert_argument_to_value_and_advance_index<ontology::Scene&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Scene*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Scene*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -589,21 +594,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::MovableController&>::type> convert_string_to_value_and_advance_index<ontology::MovableController&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::MovableController&>::type> convert_argument_to_value_and_advance_index<ontology::MovableController&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::MovableController*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::MovableController*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -615,21 +620,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Pipeline&>::type> convert_string_to_value_and_advance_index<ontology::Pipeline&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Pipeline&>::type> convert_argument_to_value_and_advance_index<ontology::Pipeline&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Pipeline*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Pipeline*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -641,21 +646,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Material&>::type> convert_string_to_value_and_advance_index<ontology::Material&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Material&>::type> convert_argument_to_value_and_advance_index<ontology::Material&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Material*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Material*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -667,21 +672,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Species&>::type> convert_string_to_value_and_advance_index<ontology::Species&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Species&>::type> convert_argument_to_value_and_advance_index<ontology::Species&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Species*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Species*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -693,21 +698,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Species*>::type> convert_string_to_value_and_advance_index<ontology::Species*>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Species*>::type> convert_argument_to_value_and_advance_index<ontology::Species*>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Species*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Species*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -719,21 +724,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Object&>::type> convert_string_to_value_and_advance_index<ontology::Object&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Object&>::type> convert_argument_to_value_and_advance_index<ontology::Object&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Object*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Object*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -745,21 +750,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Symbiosis&>::type> convert_string_to_value_and_advance_index<ontology::Symbiosis&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Symbiosis&>::type> convert_argument_to_value_and_advance_index<ontology::Symbiosis&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Symbiosis*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Symbiosis*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -771,21 +776,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Symbiosis*>::type> convert_string_to_value_and_advance_index<ontology::Symbiosis*>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Symbiosis*>::type> convert_argument_to_value_and_advance_index<ontology::Symbiosis*>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Symbiosis*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Symbiosis*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -797,21 +802,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::ShapeshifterTransformation&>::type> convert_string_to_value_and_advance_index<ontology::ShapeshifterTransformation&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::ShapeshifterTransformation&>::type> convert_argument_to_value_and_advance_index<ontology::ShapeshifterTransformation&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::ShapeshifterTransformation*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::ShapeshifterTransformation*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -823,21 +828,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::ShapeshifterSequence&>::type> convert_string_to_value_and_advance_index<ontology::ShapeshifterSequence&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::ShapeshifterSequence&>::type> convert_argument_to_value_and_advance_index<ontology::ShapeshifterSequence&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::ShapeshifterSequence*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::ShapeshifterSequence*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -849,21 +854,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Font2d&>::type> convert_string_to_value_and_advance_index<ontology::Font2d&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Font2d&>::type> convert_argument_to_value_and_advance_index<ontology::Font2d&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Font2d*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Font2d*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -875,21 +880,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Text2d&>::type> convert_string_to_value_and_advance_index<ontology::Text2d&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Text2d&>::type> convert_argument_to_value_and_advance_index<ontology::Text2d&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Text2d*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Text2d*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -901,21 +906,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::VectorFont&>::type> convert_string_to_value_and_advance_index<ontology::VectorFont&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::VectorFont&>::type> convert_argument_to_value_and_advance_index<ontology::VectorFont&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::VectorFont*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::VectorFont*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -927,21 +932,21 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Text3d&>::type> convert_string_to_value_and_advance_index<ontology::Text3d&>(
-                ontology::Universe& universe,
+        inline std::optional<data::WrapAllButStrings<ontology::Text3d&>::type> convert_argument_to_value_and_advance_index<ontology::Text3d&>(
+                ontology::Universe&,
                 ontology::Console&,
                 ontology::Entity*& environment,
-                const std::vector<std::string>& parameter_vector,
-                std::size_t& parameter_i)
+                std::span<const ConvertedArgument> arguments,
+                std::size_t& argument_i)
         {
-            if (parameter_i >= parameter_vector.size()) // No argument left to consume.
+            if (argument_i >= arguments.size()) // No argument left to consume.
             {
                 return std::nullopt;
             }
 
-            const std::string& my_string = parameter_vector.at(parameter_i++);
+            const ConvertedArgument& argument = arguments[argument_i++];
 
-            const auto value = dynamic_cast<ontology::Text3d*>(universe.get_entity(my_string));
+            const auto value = dynamic_cast<ontology::Text3d*>(argument.entity);
 
             if (value == nullptr)
             {
@@ -953,12 +958,12 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Console&>::type> convert_string_to_value_and_advance_index<ontology::Console&>(
+        inline std::optional<data::WrapAllButStrings<ontology::Console&>::type> convert_argument_to_value_and_advance_index<ontology::Console&>(
                 ontology::Universe&,
                 ontology::Console& context,
                 ontology::Entity*& environment,
-                const std::vector<std::string>&, // parameter vector.
-                std::size_t&)                    // parameter_i.
+                std::span<const ConvertedArgument>, // arguments.
+                std::size_t&)                       // argument_i.
         {
             // Note: this specialization returns the `yli::ontology::Console&` provided as an argument,
             // and does not do a lookup.
@@ -968,12 +973,12 @@ namespace yli::lisp
         }
 
     template<>
-        inline std::optional<data::WrapAllButStrings<ontology::Console*>::type> convert_string_to_value_and_advance_index<ontology::Console*>(
+        inline std::optional<data::WrapAllButStrings<ontology::Console*>::type> convert_argument_to_value_and_advance_index<ontology::Console*>(
                 ontology::Universe&,
                 ontology::Console& context,
                 ontology::Entity*& environment,
-                const std::vector<std::string>&, // parameter vector.
-                std::size_t&)                    // parameter_i.
+                std::span<const ConvertedArgument>, // arguments.
+                std::size_t&)                       // argument_i.
         {
             // Note: this specialization returns the `yli::ontology::Console&` provided as an argument,
             // and does not do a lookup.
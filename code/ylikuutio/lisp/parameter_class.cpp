@@ -0,0 +1,99 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "parameter_class.hpp"
+#include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/string/ylikuutio_string.hpp"
+
+// Include standard headers
+#include <sstream> // std::stringstream
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+namespace yli::lisp
+{
+    ConvertedArgument convert_argument(ontology::Universe& universe, const std::string& argument)
+    {
+        // Any parameter string can be a string.
+        ConvertedArgument converted_argument;
+        converted_argument.string = &argument;
+        converted_argument.classes = get_parameter_class_bit(ParameterClass::STRING);
+
+        if (argument == "true" || argument == "false") // Ylikuutio is case sensitive!
+        {
+            converted_argument.boolean = (argument == "true");
+            converted_argument.classes |= get_parameter_class_bit(ParameterClass::BOOL);
+        }
+
+        if (argument.size() == 1)
+        {
+            converted_argument.character = argument[0];
+            converted_argument.classes |= get_parameter_class_bit(ParameterClass::CHAR);
+        }
+
+        if (string::check_if_double_string<char>(argument))
+        {
+            std::stringstream my_stringstream(argument);
+
+            if (my_stringstream >> converted_argument.floating_point)
+            {
+                converted_argument.classes |= get_parameter_class_bit(ParameterClass::FLOATING_POINT);
+            }
+        }
+
+        if (string::check_if_signed_integer_string<char>(argument))
+        {
+            std::stringstream my_stringstream(argument);
+
+            if (my_stringstream >> converted_argument.signed_integer)
+            {
+                converted_argument.classes |= get_parameter_class_bit(ParameterClass::SIGNED_INTEGER);
+            }
+        }
+
+        if (string::check_if_unsigned_integer_string<char>(argument))
+        {
+            std::stringstream my_stringstream(argument);
+
+            if (my_stringstream >> converted_argument.unsigned_integer)
+            {
+                converted_argument.classes |= get_parameter_class_bit(ParameterClass::UNSIGNED_INTEGER);
+            }
+        }
+
+        if (ontology::Entity* const entity = universe.get_entity(argument); entity != nullptr)
+        {
+            converted_argument.entity = entity;
+            converted_argument.classes |= get_parameter_class_bit(ParameterClass::ENTITY);
+        }
+
+        return converted_argument;
+    }
+
+    std::vector<ConvertedArgument> convert_arguments(ontology::Universe& universe, const std::vector<std::string>& parameter_vector)
+    {
+        std::vector<ConvertedArgument> arguments;
+        arguments.reserve(parameter_vector.size());
+
+        for (const std::string& parameter : parameter_vector)
+        {
+            arguments.emplace_back(convert_argument(universe, parameter));
+        }
+
+        return arguments;
+    }
+}
@@ -0,0 +1,147 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LISP_PARAMETER_CLASS_HPP_INCLUDED
+#define YLIKUUTIO_LISP_PARAMETER_CLASS_HPP_INCLUDED
+
+// Include standard headers
+#include <array>       // std::array
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int32_t, std::int64_t, std::uint16_t, std::uint32_t, std::uint64_t
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <type_traits> // std::is_same_v, std::remove_cvref_t, std::remove_pointer_t
+#include <vector>      // std::vector
+
+namespace yli::ontology
+{
+    class Universe;
+    class Console;
+    class Entity;
+}
+
+namespace yli::lisp
+{
+    // The class of a callback parameter, as seen by `convert_argument_to_value_and_advance_index`.
+    // The signature of a callback is the list of its parameter classes which consume a parameter string.
+    enum class ParameterClass : std::uint8_t
+    {
+        NONE,             // `Universe` and `Console` are provided without consuming a parameter string.
+        BOOL,
+        CHAR,
+        FLOATING_POINT,
+        SIGNED_INTEGER,
+        UNSIGNED_INTEGER,
+        STRING,
+        ENTITY,
+        REST              // `const std::vector<std::string>&` as the last parameter consumes all remaining parameter strings.
+    };
+
+    // Bitmask of `ParameterClass`es.
+    using ParameterClassMask = std::uint16_t;
+
+    constexpr ParameterClassMask get_parameter_class_bit(const ParameterClass parameter_class)
+    {
+        return static_cast<ParameterClassMask>(1u << static_cast<std::uint8_t>(parameter_class));
+    }
+
+    template<typename T1>
+        constexpr ParameterClass get_parameter_class()
+        {
+            using Type = std::remove_cvref_t<std::remove_pointer_t<std::remove_cvref_t<T1>>>;
+
+            if constexpr (std::is_same_v<Type, ontology::Universe> || std::is_same_v<Type, ontology::Console>)
+            {
+                return ParameterClass::NONE;
+            }
+            else if constexpr (std::is_same_v<Type, bool>)
+            {
+                return ParameterClass::BOOL;
+            }
+            else if constexpr (std::is_same_v<Type, char>)
+            {
+                return ParameterClass::CHAR;
+            }
+            else if constexpr (std::is_same_v<Type, float> || std::is_same_v<Type, double>)
+            {
+                return ParameterClass::FLOATING_POINT;
+            }
+            else if constexpr (std::is_same_v<Type, std::int32_t> || std::is_same_v<Type, std::int64_t>)
+            {
+                return ParameterClass::SIGNED_INTEGER;
+            }
+            else if constexpr (std::is_same_v<Type, std::uint32_t> || std::is_same_v<Type, std::uint64_t>)
+            {
+                return ParameterClass::UNSIGNED_INTEGER;
+            }
+            else if constexpr (std::is_same_v<Type, std::string>)
+            {
+                return ParameterClass::STRING;
+            }
+            else if constexpr (std::is_same_v<Type, std::vector<std::string>>)
+            {
+                return ParameterClass::REST;
+            }
+            else
+            {
+                // Every other parameter is an `Entity` or one of its subtypes, looked up by name.
+                return ParameterClass::ENTITY;
+            }
+        }
+
+    template<typename... Types>
+        constexpr auto make_signature()
+        {
+            constexpr std::size_t n_parameters = ((get_parameter_class<Types>() != ParameterClass::NONE ? 1 : 0) + ... + 0);
+            constexpr std::array<ParameterClass, sizeof...(Types) + 1> parameter_classes { get_parameter_class<Types>()..., ParameterClass::NONE };
+
+            std::array<ParameterClass, n_parameters> signature {};
+            std::size_t signature_i = 0;
+
+            for (const ParameterClass parameter_class : parameter_classes)
+            {
+                if (parameter_class != ParameterClass::NONE)
+                {
+                    signature[signature_i++] = parameter_class;
+                }
+            }
+
+            return signature;
+        }
+
+    // A parameter string converted once into the values of all `ParameterClass`es that accept it.
+    // `classes` tells which of the values are valid. Binding to a parameter may still fail,
+    // e.g. if a number is out of range of the parameter type or the `Entity` is of another type.
+    struct ConvertedArgument
+    {
+        const std::string* string { nullptr };
+        ontology::Entity* entity { nullptr };
+        double floating_point { 0.0 };
+        std::int64_t signed_integer { 0 };
+        std::uint64_t unsigned_integer { 0 };
+        ParameterClassMask classes { 0 };
+        bool boolean { false };
+        char character { '\0' };
+    };
+
+    // `argument` is looked up as a name of an `Entity` too. `argument` must outlive the result.
+    ConvertedArgument convert_argument(ontology::Universe& universe, const std::string& argument);
+
+    std::vector<ConvertedArgument> convert_arguments(ontology::Universe& universe, const std::vector<std::string>& parameter_vector);
+}
+
+#endif
@@ -0,0 +1,61 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "symbol_table.hpp"
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <memory>      // std::make_unique
+#include <string>      // std::string
+#include <string_view> // std::string_view
+
+namespace yli::lisp
+{
+    std::uint32_t SymbolTable::intern(std::string_view name)
+    {
+        if (const auto it = this->symbols.find(name); it != this->symbols.end())
+        {
+            return it->second;
+        }
+
+        const std::uint32_t symbol = static_cast<std::uint32_t>(this->names.size());
+        this->names.emplace_back(std::make_unique<std::string>(name));
+        this->symbols.emplace(*this->names.back(), symbol);
+        return symbol;
+    }
+
+    std::uint32_t SymbolTable::find(std::string_view name) const
+    {
+        if (const auto it = this->symbols.find(name); it != this->symbols.end())
+        {
+            return it->second;
+        }
+
+        return SymbolTable::npos;
+    }
+
+    const std::string& SymbolTable::get_name(std::uint32_t symbol) const
+    {
+        return *this->names.at(symbol);
+    }
+
+    std::size_t SymbolTable::size() const
+    {
+        return this->names.size();
+    }
+}
@@ -0,0 +1,62 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LISP_SYMBOL_TABLE_HPP_INCLUDED
+#define YLIKUUTIO_LISP_SYMBOL_TABLE_HPP_INCLUDED
+
+// Include standard headers
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint32_t
+#include <memory>        // std::unique_ptr
+#include <string>        // std::string
+#include <string_view>   // std::string_view
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+namespace yli::lisp
+{
+    class SymbolTable
+    {
+        // `SymbolTable` interns identifiers and string literals.
+        // Every distinct string gets a dense `std::uint32_t` symbol,
+        // so that bytecode and `Value`s can refer to names by index.
+
+        public:
+            SymbolTable() = default;
+
+            SymbolTable(const SymbolTable&) = delete;            // Delete copy constructor.
+            SymbolTable& operator=(const SymbolTable&) = delete; // Delete copy assignment.
+
+            std::uint32_t intern(std::string_view name);
+
+            // Returns the symbol of `name` or `SymbolTable::npos` if `name` has not been interned.
+            std::uint32_t find(std::string_view name) const;
+
+            const std::string& get_name(std::uint32_t symbol) const;
+
+            std::size_t size() const;
+
+            static constexpr std::uint32_t npos { 0xffffffff };
+
+        private:
+            // Names are stored behind `std::unique_ptr` so that the `std::string_view` keys stay valid.
+            std::vector<std::unique_ptr<std::string>> names;
+            std::unordered_map<std::string_view, std::uint32_t> symbols;
+    };
+}
+
+#endif
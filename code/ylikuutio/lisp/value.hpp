@@ -0,0 +1,137 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LISP_VALUE_HPP_INCLUDED
+#define YLIKUUTIO_LISP_VALUE_HPP_INCLUDED
+
+// Include standard headers
+#include <cstdint>  // std::int64_t, std::uint32_t, std::uint64_t, std::uint8_t
+#include <optional> // std::nullopt, std::optional
+
+namespace yli::lisp
+{
+    enum class ValueType : std::uint8_t
+    {
+        NIL,
+        BOOL,
+        SIGNED_INTEGER,
+        UNSIGNED_INTEGER,
+        FLOATING_POINT,
+        SYMBOL, // Interned identifier, e.g. the name of an `Entity`.
+        STRING  // Interned string literal.
+    };
+
+    // An unboxed YliLisp value as stored on the stack of `VirtualMachine`.
+    // Symbols and strings are indices to the `SymbolTable` of the `VirtualMachine`,
+    // so `Value` is trivially copyable and never allocates.
+    struct Value
+    {
+        static Value nil()
+        {
+            return Value();
+        }
+
+        static Value from_bool(const bool value)
+        {
+            Value result;
+            result.type = ValueType::BOOL;
+            result.bool_value = value;
+            return result;
+        }
+
+        static Value from_signed_integer(const std::int64_t value)
+        {
+            Value result;
+            result.type = ValueType::SIGNED_INTEGER;
+            result.signed_integer = value;
+            return result;
+        }
+
+        static Value from_unsigned_integer(const std::uint64_t value)
+        {
+            Value result;
+            result.type = ValueType::UNSIGNED_INTEGER;
+            result.unsigned_integer = value;
+            return result;
+        }
+
+        static Value from_floating_point(const double value)
+        {
+            Value result;
+            result.type = ValueType::FLOATING_POINT;
+            result.floating_point = value;
+            return result;
+        }
+
+        static Value from_symbol(const std::uint32_t symbol)
+        {
+            Value result;
+            result.type = ValueType::SYMBOL;
+            result.symbol = symbol;
+            return result;
+        }
+
+        static Value from_string(const std::uint32_t symbol)
+        {
+            Value result;
+            result.type = ValueType::STRING;
+            result.symbol = symbol;
+            return result;
+        }
+
+        bool is_number() const
+        {
+            return this->type == ValueType::SIGNED_INTEGER ||
+                this->type == ValueType::UNSIGNED_INTEGER ||
+                this->type == ValueType::FLOATING_POINT;
+        }
+
+        // Everything else except `nil` and `#f` is true.
+        bool is_true() const
+        {
+            return this->type != ValueType::NIL && (this->type != ValueType::BOOL || this->bool_value);
+        }
+
+        std::optional<double> get_floating_point() const
+        {
+            switch (this->type)
+            {
+                case ValueType::SIGNED_INTEGER:
+                    return static_cast<double>(this->signed_integer);
+                case ValueType::UNSIGNED_INTEGER:
+                    return static_cast<double>(this->unsigned_integer);
+                case ValueType::FLOATING_POINT:
+                    return this->floating_point;
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        ValueType type { ValueType::NIL };
+
+        union
+        {
+            bool bool_value;
+            std::int64_t signed_integer;
+            std::uint64_t unsigned_integer;
+            double floating_point;
+            std::uint32_t symbol;
+        };
+    };
+}
+
+#endif
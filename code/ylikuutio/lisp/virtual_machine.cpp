@@ -0,0 +1,684 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "virtual_machine.hpp"
+#include "bytecode_function.hpp"
+#include "compiler.hpp"
+#include "instruction.hpp"
+#include "parser.hpp"
+#include "scanner.hpp"
+#include "symbol_table.hpp"
+#include "value.hpp"
+#include "code/ylikuutio/core/application.hpp"
+#include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/data/datatype.hpp"
+#include "code/ylikuutio/ontology/entity.hpp"
+#include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/ontology/console.hpp"
+#include "code/ylikuutio/ontology/console_lisp_function.hpp"
+
+// Include standard headers
+#include <charconv>    // std::chars_format, std::to_chars
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int32_t, std::int64_t, std::uint32_t, std::uint64_t
+#include <iostream>    // std::cerr
+#include <limits>      // std::numeric_limits
+#include <optional>    // std::nullopt, std::optional
+#include <span>        // std::span
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <utility>     // std::move
+#include <vector>      // std::vector
+
+namespace yli::lisp
+{
+    static std::optional<Value> apply_arithmetic(
+            const std::span<const Value> arguments,
+            const char* const name,
+            std::int64_t (*signed_op)(std::int64_t, std::int64_t),
+            std::uint64_t (*unsigned_op)(std::uint64_t, std::uint64_t),
+            double (*floating_point_op)(double, double))
+    {
+        if (arguments.size() != 2 || !arguments[0].is_number() || !arguments[1].is_number()) [[unlikely]]
+        {
+            std::cerr << "ERROR: `VirtualMachine::run`: `" << name << "` requires 2 numeric arguments!\n";
+            return std::nullopt;
+        }
+
+        const Value& lhs = arguments[0];
+        const Value& rhs = arguments[1];
+
+        if (lhs.type == ValueType::FLOATING_POINT || rhs.type == ValueType::FLOATING_POINT)
+        {
+            return Value::from_floating_point(floating_point_op(*lhs.get_floating_point(), *rhs.get_floating_point()));
+        }
+
+        if (lhs.type == ValueType::UNSIGNED_INTEGER && rhs.type == ValueType::UNSIGNED_INTEGER)
+        {
+            return Value::from_unsigned_integer(unsigned_op(lhs.unsigned_integer, rhs.unsigned_integer));
+        }
+
+        const std::int64_t lhs_int = (lhs.type == ValueType::SIGNED_INTEGER ? lhs.signed_integer : static_cast<std::int64_t>(lhs.unsigned_integer));
+        const std::int64_t rhs_int = (rhs.type == ValueType::SIGNED_INTEGER ? rhs.signed_integer : static_cast<std::int64_t>(rhs.unsigned_integer));
+        return Value::from_signed_integer(signed_op(lhs_int, rhs_int));
+    }
+
+    static std::optional<Value> apply_comparison(
+            const std::span<const Value> arguments,
+            const char* const name,
+            bool (*compare)(double, double))
+    {
+        if (arguments.size() != 2 || !arguments[0].is_number() || !arguments[1].is_number()) [[unlikely]]
+        {
+            std::cerr << "ERROR: `VirtualMachine::run`: `" << name << "` requires 2 numeric arguments!\n";
+            return std::nullopt;
+        }
+
+        return Value::from_bool(compare(*arguments[0].get_floating_point(), *arguments[1].get_floating_point()));
+    }
+
+    static bool is_equal(const Value& lhs, const Value& rhs)
+    {
+        if (lhs.is_number() && rhs.is_number())
+        {
+            if (lhs.type == rhs.type && lhs.type != ValueType::FLOATING_POINT)
+            {
+                // Compare integers exactly.
+                return lhs.unsigned_integer == rhs.unsigned_integer;
+            }
+
+            return *lhs.get_floating_point() == *rhs.get_floating_point();
+        }
+
+        if (lhs.type != rhs.type)
+        {
+            return false;
+        }
+
+        switch (lhs.type)
+        {
+            case ValueType::NIL:
+                return true;
+            case ValueType::BOOL:
+                return lhs.bool_value == rhs.bool_value;
+            default:
+                return lhs.symbol == rhs.symbol;
+        }
+    }
+
+    static std::optional<Value> convert_any_value_to_value(VirtualMachine& virtual_machine, const data::AnyValue& any_value)
+    {
+        switch (any_value.get_type())
+        {
+            case data::Datatype::BOOL:
+                return Value::from_bool(any_value.get<bool>());
+            case data::Datatype::FLOAT:
+                return Value::from_floating_point(any_value.get<float>());
+            case data::Datatype::DOUBLE:
+                return Value::from_floating_point(any_value.get<double>());
+            case data::Datatype::INT32_T:
+                return Value::from_signed_integer(any_value.get<std::int32_t>());
+            case data::Datatype::UINT32_T:
+                return Value::from_unsigned_integer(any_value.get<std::uint32_t>());
+            case data::Datatype::INT64_T:
+                return Value::from_signed_integer(any_value.get<std::int64_t>());
+            case data::Datatype::UINT64_T:
+                return Value::from_unsigned_integer(any_value.get<std::uint64_t>());
+            case data::Datatype::STD_STRING:
+                return Value::from_string(virtual_machine.intern(any_value.get_string_view()));
+            case data::Datatype::ENTITY:
+                if (const std::string global_name = any_value.get_const_entity_ref().get_global_name(); !global_name.empty())
+                {
+                    return Value::from_symbol(virtual_machine.intern(global_name));
+                }
+                break;
+            default:
+                break;
+        }
+
+        return Value::nil();
+    }
+
+    VirtualMachine::VirtualMachine()
+    {
+        // The stack is never reallocated so that native functions may safely
+        // keep their arguments while calling back into the `VirtualMachine`.
+        this->stack.reserve(VirtualMachine::max_stack_size);
+        this->frames.reserve(VirtualMachine::max_call_depth);
+        this->define_builtin_functions();
+    }
+
+    VirtualMachine::VirtualMachine(ontology::Universe& universe)
+        : VirtualMachine()
+    {
+        this->universe = &universe;
+    }
+
+    std::optional<std::size_t> VirtualMachine::load(std::string_view source)
+    {
+        const Scanner scanner(source);
+
+        if (!scanner.get_is_success())
+        {
+            std::cerr << "ERROR: `VirtualMachine::load`: scanning failed!\n";
+            return std::nullopt;
+        }
+
+        const Parser parser(scanner.get_token_list());
+
+        if (!parser.get_is_success())
+        {
+            std::cerr << "ERROR: `VirtualMachine::load`: parsing failed!\n";
+            return std::nullopt;
+        }
+
+        Compiler compiler(*this);
+        return compiler.compile(parser.get_syntax_tree_list());
+    }
+
+    std::optional<Value> VirtualMachine::run(const std::size_t program_i)
+    {
+        if (program_i >= this->bytecode_functions.size() ||
+                this->bytecode_functions[program_i].symbol != SymbolTable::npos) [[unlikely]]
+        {
+            std::cerr << "ERROR: `VirtualMachine::run`: invalid program " << program_i << "!\n";
+            return std::nullopt;
+        }
+
+        return this->execute(program_i, this->stack.size());
+    }
+
+    std::optional<Value> VirtualMachine::call(const std::uint32_t symbol, std::span<const Value> arguments)
+    {
+        if (symbol >= this->function_slots.size()) [[unlikely]]
+        {
+            std::cerr << "ERROR: `VirtualMachine::call`: undefined function!\n";
+            return std::nullopt;
+        }
+
+        const FunctionSlot& function_slot = this->function_slots[symbol];
+
+        if (function_slot.native_function)
+        {
+            return function_slot.native_function(*this, arguments);
+        }
+
+        if (function_slot.bytecode_function_i >= this->bytecode_functions.size()) [[unlikely]]
+        {
+            std::cerr << "ERROR: `VirtualMachine::call`: undefined function `" << this->symbol_table.get_name(symbol) << "`!\n";
+            return std::nullopt;
+        }
+
+        if (this->bytecode_functions[function_slot.bytecode_function_i].n_parameters != arguments.size()) [[unlikely]]
+        {
+            std::cerr << "ERROR: `VirtualMachine::call`: wrong number of arguments to `" << this->symbol_table.get_name(symbol) << "`!\n";
+            return std::nullopt;
+        }
+
+        const std::size_t base = this->stack.size();
+
+        for (const Value& argument : arguments)
+        {
+            if (!this->push(argument)) [[unlikely]]
+            {
+                this->stack.resize(base);
+                return std::nullopt;
+            }
+        }
+
+        return this->execute(function_slot.bytecode_function_i, base);
+    }
+
+    std::optional<Value> VirtualMachine::call(std::string_view name, std::span<const Value> arguments)
+    {
+        const std::uint32_t symbol = this->symbol_table.find(name);
+
+        if (symbol == SymbolTable::npos)
+        {
+            std::cerr << "ERROR: `VirtualMachine::call`: undefined function `" << name << "`!\n";
+            return std::nullopt;
+        }
+
+        return this->call(symbol, arguments);
+    }
+
+    void VirtualMachine::define_native_function(std::string_view name, NativeFunction native_function)
+    {
+        FunctionSlot& function_slot = this->get_function_slot(this->intern(name));
+        function_slot.native_function = std::move(native_function);
+        function_slot.bytecode_function_i = std::numeric_limits<std::size_t>::max();
+    }
+
+    void VirtualMachine::define_console_lisp_function(const ontology::Console& console, std::string_view name)
+    {
+        // The `ConsoleLispFunction` is looked up again only when `name` has been bound or erased.
+        this->define_native_function(
+                name,
+                [&console,
+                name = std::string(name),
+                console_lisp_function = static_cast<const ontology::ConsoleLispFunction*>(nullptr),
+                name_generation = static_cast<const std::size_t*>(nullptr),
+                generation = std::numeric_limits<std::size_t>::max(),
+                parameter_vector = std::vector<std::string>()]
+                (VirtualMachine& virtual_machine, std::span<const Value> arguments) mutable -> std::optional<Value>
+                {
+                    const ontology::Universe& universe = console.get_application().get_universe();
+
+                    if (name_generation == nullptr) [[unlikely]]
+                    {
+                        // Remains `nullptr` until `name` is bound for the first time.
+                        name_generation = universe.registry.get_name_generation(name);
+                    }
+
+                    if (name_generation == nullptr || generation != *name_generation) [[unlikely]]
+                    {
+                        ontology::Entity* const entity = universe.get_entity(name);
+                        console_lisp_function = (entity != nullptr && entity->get_parent() == &console ?
+                                dynamic_cast<const ontology::ConsoleLispFunction*>(entity) :
+                                nullptr);
+                        generation = (name_generation != nullptr ? *name_generation : std::numeric_limits<std::size_t>::max());
+                    }
+
+                    if (console_lisp_function == nullptr) [[unlikely]]
+                    {
+                        std::cerr << "ERROR: `VirtualMachine::run`: `" << name << "` is not a console lisp function!\n";
+                        return std::nullopt;
+                    }
+
+                    // Reuse the strings of the previous call.
+                    parameter_vector.resize(arguments.size());
+
+                    for (std::size_t i = 0; i < arguments.size(); i++)
+                    {
+                        parameter_vector[i].clear();
+                        virtual_machine.append_to_string(arguments[i], parameter_vector[i]);
+                    }
+
+                    const std::optional<data::AnyValue> result = console_lisp_function->execute(parameter_vector);
+
+                    if (!result.has_value())
+                    {
+                        return Value::nil();
+                    }
+
+                    return convert_any_value_to_value(virtual_machine, *result);
+                });
+    }
+
+    bool VirtualMachine::is_function(std::string_view name) const
+    {
+        const std::uint32_t symbol = this->symbol_table.find(name);
+
+        if (symbol == SymbolTable::npos || symbol >= this->function_slots.size())
+        {
+            return false;
+        }
+
+        const FunctionSlot& function_slot = this->function_slots[symbol];
+        return function_slot.native_function || function_slot.bytecode_function_i < this->bytecode_functions.size();
+    }
+
+    ontology::Entity* VirtualMachine::resolve_entity(const Value& value)
+    {
+        if (this->universe == nullptr ||
+                (value.type != ValueType::SYMBOL && value.type != ValueType::STRING)) [[unlikely]]
+        {
+            return nullptr;
+        }
+
+        const std::string& name = this->symbol_table.get_name(value.symbol);
+
+        if (name.find('.') != std::string::npos)
+        {
+            // Local names are not bound in the `Registry` of the `Universe`, so their lookups can not be cached.
+            return this->universe->get_entity(name);
+        }
+
+        if (value.symbol >= this->entity_cache.size())
+        {
+            this->entity_cache.resize(this->symbol_table.size());
+        }
+
+        CachedEntity& cached_entity = this->entity_cache[value.symbol];
+
+        if (cached_entity.name_generation == nullptr) [[unlikely]]
+        {
+            cached_entity.name_generation = this->universe->registry.get_name_generation(name);
+
+            if (cached_entity.name_generation == nullptr)
+            {
+                // `name` has never been bound.
+                return nullptr;
+            }
+        }
+
+        if (cached_entity.generation != *cached_entity.name_generation) [[unlikely]]
+        {
+            cached_entity.entity = this->universe->get_entity(name);
+            cached_entity.generation = *cached_entity.name_generation;
+        }
+
+        return cached_entity.entity;
+    }
+
+    void VirtualMachine::append_to_string(const Value& value, std::string& output) const
+    {
+        char buffer[64];
+        std::to_chars_result result { buffer, {} };
+
+        switch (value.type)
+        {
+            case ValueType::NIL:
+                output += "nil";
+                return;
+            case ValueType::BOOL:
+                output += (value.bool_value ? "true" : "false");
+                return;
+            case ValueType::SIGNED_INTEGER:
+                result = std::to_chars(buffer, buffer + sizeof(buffer), value.signed_integer);
+                break;
+            case ValueType::UNSIGNED_INTEGER:
+                result = std::to_chars(buffer, buffer + sizeof(buffer), value.unsigned_integer);
+                break;
+            case ValueType::FLOATING_POINT:
+                // Fixed notation, as the numeric arguments of console lisp functions do not accept exponents.
+                result = std::to_chars(buffer, buffer + sizeof(buffer), value.floating_point, std::chars_format::fixed);
+
+                if (result.ec != std::errc())
+                {
+                    result = std::to_chars(buffer, buffer + sizeof(buffer), value.floating_point);
+                }
+                break;
+            case ValueType::SYMBOL:
+            case ValueType::STRING:
+                output += this->symbol_table.get_name(value.symbol);
+                return;
+        }
+
+        output.append(buffer, result.ptr);
+    }
+
+    std::string VirtualMachine::to_string(const Value& value) const
+    {
+        std::string output;
+        this->append_to_string(value, output);
+        return output;
+    }
+
+    std::uint32_t VirtualMachine::intern(std::string_view name)
+    {
+        return this->symbol_table.intern(name);
+    }
+
+    const SymbolTable& VirtualMachine::get_symbol_table() const
+    {
+        return this->symbol_table;
+    }
+
+    void VirtualMachine::define_builtin_functions()
+    {
+        this->define_native_function("add", [](VirtualMachine&, std::span<const Value> arguments)
+                {
+                    return apply_arithmetic(arguments, "add",
+                            [](std::int64_t a, std::int64_t b) { return a + b; },
+                            [](std::uint64_t a, std::uint64_t b) { return a + b; },
+                            [](double a, double b) { return a + b; });
+                });
+        this->define_native_function("sub", [](VirtualMachine&, std::span<const Value> arguments)
+                {
+                    return apply_arithmetic(arguments, "sub",
+                            [](std::int64_t a, std::int64_t b) { return a - b; },
+                            [](std::uint64_t a, std::uint64_t b) { return a - b; },
+                            [](double a, double b) { return a - b; });
+                });
+        this->define_native_function("mul", [](VirtualMachine&, std::span<const Value> arguments)
+                {
+                    return apply_arithmetic(arguments, "mul",
+                            [](std::int64_t a, std::int64_t b) { return a * b; },
+                            [](std::uint64_t a, std::uint64_t b) { return a * b; },
+                            [](double a, double b) { return a * b; });
+                });
+        this->define_native_function("div", [](VirtualMachine&, std::span<const Value> arguments) -> std::optional<Value>
+                {
+                    if (arguments.size() == 2 &&
+                            arguments[1].type != ValueType::FLOATING_POINT &&
+                            arguments[0].type != ValueType::FLOATING_POINT &&
+                            arguments[1].is_number() &&
+                            arguments[1].unsigned_integer == 0) [[unlikely]]
+                    {
+                        std::cerr << "ERROR: `VirtualMachine::run`: integer division by zero!\n";
+                        return std::nullopt;
+                    }
+
+                    return apply_arithmetic(arguments, "div",
+                            [](std::int64_t a, std::int64_t b) { return a / b; },
+                            [](std::uint64_t a, std::uint64_t b) { return a / b; },
+                            [](double a, double b) { return a / b; });
+                });
+        this->define_native_function("lt", [](VirtualMachine&, std::span<const Value> arguments)
+                {
+                    return apply_comparison(arguments, "lt", [](double a, double b) { return a < b; });
+                });
+        this->define_native_function("le", [](VirtualMachine&, std::span<const Value> arguments)
+                {
+                    return apply_comparison(arguments, "le", [](double a, double b) { return a <= b; });
+                });
+        this->define_native_function("gt", [](VirtualMachine&, std::span<const Value> arguments)
+                {
+                    return apply_comparison(arguments, "gt", [](double a, double b) { return a > b; });
+                });
+        this->define_native_function("ge", [](VirtualMachine&, std::span<const Value> arguments)
+                {
+                    return apply_comparison(arguments, "ge", [](double a, double b) { return a >= b; });
+                });
+        this->define_native_function("eq", [](VirtualMachine&, std::span<const Value> arguments) -> std::optional<Value>
+                {
+                    if (arguments.size() != 2) [[unlikely]]
+                    {
+                        std::cerr << "ERROR: `VirtualMachine::run`: `eq` requires 2 arguments!\n";
+                        return std::nullopt;
+                    }
+
+                    return Value::from_bool(is_equal(arguments[0], arguments[1]));
+                });
+        this->define_native_function("not", [](VirtualMachine&, std::span<const Value> arguments) -> std::optional<Value>
+                {
+                    if (arguments.size() != 1) [[unlikely]]
+                    {
+                        std::cerr << "ERROR: `VirtualMachine::run`: `not` requires 1 argument!\n";
+                        return std::nullopt;
+                    }
+
+                    return Value::from_bool(!arguments[0].is_true());
+                });
+    }
+
+    VirtualMachine::FunctionSlot& VirtualMachine::get_function_slot(const std::uint32_t symbol)
+    {
+        if (symbol >= this->function_slots.size())
+        {
+            this->function_slots.resize(symbol + 1);
+        }
+
+        return this->function_slots[symbol];
+    }
+
+    std::optional<Value> VirtualMachine::execute(const std::size_t function_i, const std::size_t base)
+    {
+        const std::size_t first_frame_i = this->frames.size();
+
+        if (first_frame_i >= VirtualMachine::max_call_depth) [[unlikely]]
+        {
+            std::cerr << "ERROR: `VirtualMachine::run`: maximum call depth exceeded!\n";
+            this->stack.resize(base);
+            return std::nullopt;
+        }
+
+        this->frames.push_back({ function_i, 0, base });
+
+        while (true)
+        {
+            Frame& frame = this->frames.back();
+            const Instruction instruction = this->bytecode_functions[frame.function_i].code[frame.instruction_i++];
+
+            switch (instruction.op_code)
+            {
+                case OpCode::PUSH_CONSTANT:
+                    if (!this->push(this->constants[instruction.operand])) [[unlikely]]
+                    {
+                        break;
+                    }
+                    continue;
+                case OpCode::PUSH_ARGUMENT:
+                    if (!this->push(this->stack[frame.base + instruction.operand])) [[unlikely]]
+                    {
+                        break;
+                    }
+                    continue;
+                case OpCode::POP:
+                    this->stack.pop_back();
+                    continue;
+                case OpCode::JUMP:
+                    frame.instruction_i = instruction.operand;
+                    continue;
+                case OpCode::JUMP_IF_FALSE:
+                    {
+                        const bool is_true = this->stack.back().is_true();
+                        this->stack.pop_back();
+
+                        if (!is_true)
+                        {
+                            frame.instruction_i = instruction.operand;
+                        }
+                    }
+                    continue;
+                case OpCode::CALL:
+                case OpCode::TAIL_CALL:
+                    {
+                        const CallSite& call_site = this->call_sites[instruction.operand];
+                        const std::size_t arguments_base = this->stack.size() - call_site.n_arguments;
+                        const bool is_tail_call = (instruction.op_code == OpCode::TAIL_CALL);
+
+                        if (call_site.symbol >= this->function_slots.size()) [[unlikely]]
+                        {
+                            std::cerr << "ERROR: `VirtualMachine::run`: undefined function `" << this->symbol_table.get_name(call_site.symbol) << "`!\n";
+                            break;
+                        }
+
+                        const FunctionSlot& function_slot = this->function_slots[call_site.symbol];
+
+                        if (function_slot.native_function)
+                        {
+                            const std::optional<Value> result = function_slot.native_function(
+                                    *this,
+                                    std::span<const Value>(this->stack.data() + arguments_base, call_site.n_arguments));
+
+                            if (!result.has_value()) [[unlikely]]
+                            {
+                                break;
+                            }
+
+                            if (is_tail_call)
+                            {
+                                // Return the result directly to the caller.
+                                this->stack.resize(this->frames.back().base);
+                                this->frames.pop_back();
+
+                                if (this->frames.size() == first_frame_i)
+                                {
+                                    return *result;
+                                }
+                            }
+                            else
+                            {
+                                this->stack.resize(arguments_base);
+                            }
+
+                            this->stack.push_back(*result);
+                            continue;
+                        }
+
+                        if (function_slot.bytecode_function_i >= this->bytecode_functions.size()) [[unlikely]]
+                        {
+                            std::cerr << "ERROR: `VirtualMachine::run`: undefined function `" << this->symbol_table.get_name(call_site.symbol) << "`!\n";
+                            break;
+                        }
+
+                        if (this->bytecode_functions[function_slot.bytecode_function_i].n_parameters != call_site.n_arguments) [[unlikely]]
+                        {
+                            std::cerr << "ERROR: `VirtualMachine::run`: wrong number of arguments to `" << this->symbol_table.get_name(call_site.symbol) << "`!\n";
+                            break;
+                        }
+
+                        if (is_tail_call)
+                        {
+                            // Replace the current frame with the callee.
+                            for (std::size_t i = 0; i < call_site.n_arguments; i++)
+                            {
+                                this->stack[frame.base + i] = this->stack[arguments_base + i];
+                            }
+
+                            this->stack.resize(frame.base + call_site.n_arguments);
+                            frame.function_i = function_slot.bytecode_function_i;
+                            frame.instruction_i = 0;
+                            continue;
+                        }
+
+                        if (this->frames.size() >= VirtualMachine::max_call_depth) [[unlikely]]
+                        {
+                            std::cerr << "ERROR: `VirtualMachine::run`: maximum call depth exceeded!\n";
+                            break;
+                        }
+
+                        this->frames.push_back({ function_slot.bytecode_function_i, 0, arguments_base });
+                    }
+                    continue;
+                case OpCode::RETURN:
+                    {
+                        const Value result = this->stack.back();
+                        this->stack.resize(frame.base);
+                        this->frames.pop_back();
+
+                        if (this->frames.size() == first_frame_i)
+                        {
+                            return result;
+                        }
+
+                        this->stack.push_back(result);
+                    }
+                    continue;
+            }
+
+            // A runtime error occurred, unwind everything this call pushed.
+            this->frames.resize(first_frame_i);
+            this->stack.resize(base);
+            return std::nullopt;
+        }
+    }
+
+    bool VirtualMachine::push(const Value& value)
+    {
+        if (this->stack.size() >= VirtualMachine::max_stack_size) [[unlikely]]
+        {
+            std::cerr << "ERROR: `VirtualMachine::run`: stack overflow!\n";
+            return false;
+        }
+
+        this->stack.push_back(value);
+        return true;
+    }
+}
@@ -0,0 +1,149 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LISP_VIRTUAL_MACHINE_HPP_INCLUDED
+#define YLIKUUTIO_LISP_VIRTUAL_MACHINE_HPP_INCLUDED
+
+#include "bytecode_function.hpp"
+#include "instruction.hpp"
+#include "symbol_table.hpp"
+#include "value.hpp"
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <functional>  // std::function
+#include <limits>      // std::numeric_limits
+#include <optional>    // std::optional
+#include <span>        // std::span
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+namespace yli::ontology
+{
+    class Entity;
+    class Universe;
+    class Console;
+}
+
+namespace yli::lisp
+{
+    class VirtualMachine;
+
+    // A native function returns `std::nullopt` to signal a runtime error, which aborts the execution.
+    using NativeFunction = std::function<std::optional<Value>(VirtualMachine&, std::span<const Value>)>;
+
+    class VirtualMachine
+    {
+        // `VirtualMachine` is a stack machine that executes YliLisp compiled into bytecode by `Compiler`.
+        //
+        // Source code is compiled once with `load`, and the compiled code can then be executed
+        // any number of times with `run` or `call` without scanning, parsing, or string conversions.
+        //
+        // Example:
+        // (defun think (agent) (steer agent (if (lt (heading agent) 180.0) 0.5 -0.5)))
+        //
+        // Function calls are resolved by symbol from a table indexed by the symbol,
+        // and calls in tail position reuse the frame of the caller.
+        // Entities and console lisp functions are resolved once by name and cached
+        // until that name is bound or erased in the `Universe`.
+
+        public:
+            VirtualMachine();
+            explicit VirtualMachine(ontology::Universe& universe);
+
+            VirtualMachine(const VirtualMachine&) = delete;            // Delete copy constructor.
+            VirtualMachine& operator=(const VirtualMachine&) = delete; // Delete copy assignment.
+
+            ~VirtualMachine() = default;
+
+            // Compiles `source`. `defun` expressions define functions,
+            // other top-level expressions are compiled into a program.
+            // Returns the index of the program, or `std::nullopt` on error.
+            std::optional<std::size_t> load(std::string_view source);
+
+            std::optional<Value> run(std::size_t program_i);
+            std::optional<Value> call(std::uint32_t symbol, std::span<const Value> arguments);
+            std::optional<Value> call(std::string_view name, std::span<const Value> arguments);
+
+            void define_native_function(std::string_view name, NativeFunction native_function);
+
+            // Makes the `ConsoleLispFunction` called `name` of `console` callable.
+            // Arguments are converted to strings for the overload resolution of `ConsoleLispFunction`.
+            void define_console_lisp_function(const ontology::Console& console, std::string_view name);
+
+            bool is_function(std::string_view name) const;
+
+            // Resolves a symbol or a string to an `Entity` of the `Universe`.
+            ontology::Entity* resolve_entity(const Value& value);
+
+            void append_to_string(const Value& value, std::string& output) const;
+            std::string to_string(const Value& value) const;
+
+            std::uint32_t intern(std::string_view name);
+            const SymbolTable& get_symbol_table() const;
+
+            static constexpr std::size_t max_stack_size { 65536 };
+            static constexpr std::size_t max_call_depth { 1024 };
+
+            friend class Compiler;
+
+        private:
+            struct FunctionSlot
+            {
+                NativeFunction native_function;
+                std::size_t bytecode_function_i { std::numeric_limits<std::size_t>::max() };
+            };
+
+            struct Frame
+            {
+                std::size_t function_i;
+                std::size_t instruction_i;
+                std::size_t base; // Stack index of the first argument.
+            };
+
+            struct CachedEntity
+            {
+                ontology::Entity* entity { nullptr };
+                const std::size_t* name_generation { nullptr }; // See `Registry::get_name_generation`.
+                std::size_t generation { std::numeric_limits<std::size_t>::max() };
+            };
+
+            void define_builtin_functions();
+
+            FunctionSlot& get_function_slot(std::uint32_t symbol);
+
+            std::optional<Value> execute(std::size_t function_i, std::size_t base);
+
+            bool push(const Value& value);
+
+            ontology::Universe* universe { nullptr };
+
+            SymbolTable symbol_table;
+            std::vector<Value> constants;
+            std::vector<CallSite> call_sites;
+            std::vector<BytecodeFunction> bytecode_functions;
+            std::vector<FunctionSlot> function_slots; // Indexed by symbol.
+            std::vector<CachedEntity> entity_cache;   // Indexed by symbol.
+
+            std::vector<Value> stack;
+            std::vector<Frame> frames;
+    };
+}
+
+#endif
@@ -0,0 +1,206 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "asset_loader.hpp"
+
+// Include standard headers
+#include <algorithm> // std::max
+#include <chrono>    // std::chrono::microseconds, std::chrono::steady_clock
+#include <cstddef>   // std::size_t
+#include <exception> // std::exception
+#include <future>    // std::promise, std::shared_future
+#include <iostream>  // std::cerr
+#include <mutex>     // std::mutex, std::scoped_lock, std::unique_lock
+#include <thread>    // std::thread
+#include <utility>   // std::move
+
+namespace yli::load
+{
+    AssetLoader::AssetLoader(const std::size_t n_worker_threads)
+        : n_worker_threads {
+            n_worker_threads > 0 ?
+                n_worker_threads :
+                std::max<std::size_t>(std::thread::hardware_concurrency(), 2) - 1 }
+    {
+    }
+
+    AssetLoader::~AssetLoader()
+    {
+        {
+            std::scoped_lock lock(this->mutex);
+            this->is_stopping = true;
+        }
+
+        this->job_condition_variable.notify_all();
+
+        for (std::thread& worker_thread : this->worker_threads)
+        {
+            worker_thread.join();
+        }
+    }
+
+    std::shared_future<bool> AssetLoader::enqueue(CpuJob cpu_job, UploadJob upload_job)
+    {
+        std::promise<bool> promise;
+        std::shared_future<bool> future = promise.get_future().share();
+
+        {
+            std::scoped_lock lock(this->mutex);
+
+            if (this->worker_threads.empty())
+            {
+                this->start_worker_threads();
+            }
+
+            this->jobs.push_back(Job { std::move(cpu_job), std::move(upload_job), std::move(promise) });
+            this->n_pending_jobs++;
+        }
+
+        this->job_condition_variable.notify_one();
+        return future;
+    }
+
+    std::size_t AssetLoader::process_uploads(const std::chrono::microseconds time_budget)
+    {
+        const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + time_budget;
+        std::size_t n_uploads = 0;
+
+        while (this->run_next_upload())
+        {
+            n_uploads++;
+
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                break;
+            }
+        }
+
+        return n_uploads;
+    }
+
+    void AssetLoader::finish()
+    {
+        while (true)
+        {
+            {
+                std::unique_lock lock(this->mutex);
+                this->upload_condition_variable.wait(lock, [this] { return this->n_pending_jobs == 0 || !this->uploads.empty(); });
+
+                if (this->n_pending_jobs == 0)
+                {
+                    return;
+                }
+            }
+
+            while (this->run_next_upload())
+            {
+            }
+        }
+    }
+
+    std::size_t AssetLoader::get_number_of_pending_jobs() const
+    {
+        std::scoped_lock lock(this->mutex);
+        return this->n_pending_jobs;
+    }
+
+    std::size_t AssetLoader::get_number_of_worker_threads() const
+    {
+        return this->n_worker_threads;
+    }
+
+    void AssetLoader::start_worker_threads()
+    {
+        this->worker_threads.reserve(this->n_worker_threads);
+
+        for (std::size_t i = 0; i < this->n_worker_threads; i++)
+        {
+            this->worker_threads.emplace_back(&AssetLoader::run_worker_thread, this);
+        }
+    }
+
+    void AssetLoader::run_worker_thread()
+    {
+        while (true)
+        {
+            Job job;
+
+            {
+                std::unique_lock lock(this->mutex);
+                this->job_condition_variable.wait(lock, [this] { return this->is_stopping || !this->jobs.empty(); });
+
+                if (this->is_stopping)
+                {
+                    return;
+                }
+
+                job = std::move(this->jobs.front());
+                this->jobs.pop_front();
+            }
+
+            bool result = false;
+
+            try
+            {
+                result = job.cpu_job();
+            }
+            catch (const std::exception& exception)
+            {
+                std::cerr << "ERROR: `AssetLoader::run_worker_thread`: CPU job failed: " << exception.what() << "\n";
+            }
+
+            {
+                std::scoped_lock lock(this->mutex);
+                this->uploads.push_back(Upload { std::move(job.upload_job), std::move(job.promise), result });
+            }
+
+            this->upload_condition_variable.notify_all();
+        }
+    }
+
+    bool AssetLoader::run_next_upload()
+    {
+        Upload upload;
+
+        {
+            std::scoped_lock lock(this->mutex);
+
+            if (this->uploads.empty())
+            {
+                return false;
+            }
+
+            upload = std::move(this->uploads.front());
+            this->uploads.pop_front();
+        }
+
+        if (upload.upload_job)
+        {
+            upload.upload_job(upload.result);
+        }
+
+        upload.promise.set_value(upload.result);
+
+        {
+            std::scoped_lock lock(this->mutex);
+            this->n_pending_jobs--;
+        }
+
+        this->upload_condition_variable.notify_all();
+        return true;
+    }
+}
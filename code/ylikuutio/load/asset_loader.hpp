@@ -0,0 +1,110 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LOAD_ASSET_LOADER_HPP_INCLUDED
+#define YLIKUUTIO_LOAD_ASSET_LOADER_HPP_INCLUDED
+
+// Include standard headers
+#include <chrono>             // std::chrono::microseconds
+#include <condition_variable> // std::condition_variable
+#include <cstddef>            // std::size_t
+#include <deque>              // std::deque
+#include <functional>         // std::function
+#include <future>             // std::promise, std::shared_future
+#include <mutex>              // std::mutex
+#include <thread>             // std::thread
+#include <vector>             // std::vector
+
+// `AssetLoader` runs asset loading in two stages. File I/O, decoding and
+// other CPU work runs on worker threads. The result is then handed to an
+// upload job which runs on the thread that calls `process_uploads`, that
+// is, the thread which owns the GL context. Uploads are drained in
+// time-budgeted slices so that loading does not stall rendering.
+//
+// Worker threads are started lazily on the first `enqueue` call.
+
+namespace yli::load
+{
+    class AssetLoader final
+    {
+        public:
+            // Returns `true` on success.
+            using CpuJob = std::function<bool()>;
+
+            // Receives the return value of the corresponding `CpuJob`.
+            using UploadJob = std::function<void(bool)>;
+
+            // 0 worker threads means one less than the hardware concurrency, but at least 1.
+            explicit AssetLoader(std::size_t n_worker_threads);
+
+            AssetLoader(const AssetLoader&) = delete;            // Delete copy constructor.
+            AssetLoader& operator=(const AssetLoader&) = delete; // Delete copy assignment.
+
+            // Waits for running CPU jobs to finish. Jobs which have not been
+            // uploaded yet are dropped and their futures get a broken promise.
+            ~AssetLoader();
+
+            // The returned future becomes ready after `upload_job` has run,
+            // and holds the return value of `cpu_job`.
+            std::shared_future<bool> enqueue(CpuJob cpu_job, UploadJob upload_job);
+
+            // Runs upload jobs until the queue is empty or `time_budget` is spent.
+            // At least one upload job is run if there is any, so that loading always progresses.
+            // Returns the number of upload jobs run.
+            std::size_t process_uploads(std::chrono::microseconds time_budget);
+
+            // Blocks until all enqueued jobs have been uploaded.
+            // Must be called on the same thread as `process_uploads`.
+            void finish();
+
+            // Jobs which have been enqueued but not uploaded yet.
+            std::size_t get_number_of_pending_jobs() const;
+
+            std::size_t get_number_of_worker_threads() const;
+
+        private:
+            struct Job
+            {
+                CpuJob cpu_job;
+                UploadJob upload_job;
+                std::promise<bool> promise;
+            };
+
+            struct Upload
+            {
+                UploadJob upload_job;
+                std::promise<bool> promise;
+                bool result { false };
+            };
+
+            void start_worker_threads();
+            void run_worker_thread();
+            bool run_next_upload();
+
+            mutable std::mutex mutex;
+            std::condition_variable job_condition_variable;
+            std::condition_variable upload_condition_variable;
+            std::deque<Job> jobs;
+            std::deque<Upload> uploads;
+            std::vector<std::thread> worker_threads;
+            std::size_t n_worker_threads { 1 };
+            std::size_t n_pending_jobs   { 0 };
+            bool is_stopping             { false };
+    };
+}
+
+#endif
@@ -57,19 +57,29 @@ namespace yli::load
             return false;
         }
 
+        return upload_common_texture(*image_data, image_width, image_height, textureID, graphics_api_backend);
+    }
+
+    bool upload_common_texture(
+            const std::vector<std::uint8_t>& image_data,
+            const std::uint32_t image_width,
+            const std::uint32_t image_height,
+            GLuint& textureID,
+            const render::GraphicsApiBackend graphics_api_backend)
+    {
         if (graphics_api_backend == render::GraphicsApiBackend::OPENGL)
         {
-            return opengl::prepare_opengl_texture(*image_data.get(), image_width, image_height, textureID);
+            return opengl::prepare_opengl_texture(image_data, image_width, image_height, textureID);
         }
         if (graphics_api_backend == render::GraphicsApiBackend::VULKAN)
         {
             // TODO: implement.
-            throw std::runtime_error("ERROR: `yli::load::load_common_texture`: Vulkan is not supported yet!");
+            throw std::runtime_error("ERROR: `yli::load::upload_common_texture`: Vulkan is not supported yet!");
         }
         if (graphics_api_backend == render::GraphicsApiBackend::SOFTWARE)
         {
             // TODO: implement.
-            throw std::runtime_error("ERROR: `yli::load::load_common_texture`: software rendering is not supported yet!");
+            throw std::runtime_error("ERROR: `yli::load::upload_common_texture`: software rendering is not supported yet!");
         }
 
         // Headless.
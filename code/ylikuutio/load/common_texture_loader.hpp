@@ -21,8 +21,9 @@
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
 
 // Include standard headers
-#include <cstdint>  // std::uint32_t
+#include <cstdint>  // std::uint8_t, std::uint32_t
 #include <string>   // std::string
+#include <vector>   // std::vector
 
 namespace yli::load
 {
@@ -36,6 +37,14 @@ namespace yli::render
 
 namespace yli::load
 {
+    // Upload decoded image data to the GPU. Must be called on the thread which owns the GL context.
+    bool upload_common_texture(
+            const std::vector<std::uint8_t>& image_data,
+            std::uint32_t image_width,
+            std::uint32_t image_height,
+            GLuint& textureID,
+            render::GraphicsApiBackend graphics_api_backend);
+
     // Load a PNG file.
     bool load_common_texture(
             const std::string& filename,
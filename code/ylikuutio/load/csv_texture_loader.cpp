@@ -24,11 +24,10 @@
 
 // Include standard headers
 #include <cstdint>    // std::int8_t, std::int16_t, std::int32_t, std::uint8_t, std::uint16_t, std::uint32_t
-#include <functional> // std::reference_wrapper
 #include <iostream> // std::cout, std::cerr
 #include <optional> // std::optional
 #include <string>   // std::string
-#include <variant>  // std::holds_alternative, std::variant
+#include <variant>  // std::get, std::variant
 #include <vector>   // std::vector
 
 namespace yli::load
@@ -70,13 +69,13 @@ namespace yli::load
 
             if (left_filler_vector_any_value != nullptr &&
                     right_filler_vector_any_value != nullptr &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::int8_t>>>(left_filler_vector_any_value->data) &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::int8_t>>>(right_filler_vector_any_value->data))
+                    left_filler_vector_any_value->holds<std::vector<std::int8_t>>() &&
+                    right_filler_vector_any_value->holds<std::vector<std::int8_t>>())
             {
                 image_data = yli::linear_algebra::insert_elements<std::int8_t>(
                         *csv_image_data,
-                        std::get<std::reference_wrapper<std::vector<std::int8_t>>>(left_filler_vector_any_value->data),
-                        std::get<std::reference_wrapper<std::vector<std::int8_t>>>(right_filler_vector_any_value->data));
+                        left_filler_vector_any_value->get<std::vector<std::int8_t>>(),
+                        right_filler_vector_any_value->get<std::vector<std::int8_t>>());
             }
 
             image_data_ptr = std::get<std::vector<std::int8_t>>(image_data).data();
@@ -95,13 +94,13 @@ namespace yli::load
 
             if (left_filler_vector_any_value != nullptr &&
                     right_filler_vector_any_value != nullptr &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::uint8_t>>>(left_filler_vector_any_value->data) &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::uint8_t>>>(right_filler_vector_any_value->data))
+                    left_filler_vector_any_value->holds<std::vector<std::uint8_t>>() &&
+                    right_filler_vector_any_value->holds<std::vector<std::uint8_t>>())
             {
                 image_data = yli::linear_algebra::insert_elements<std::uint8_t>(
                         *csv_image_data,
-                        std::get<std::reference_wrapper<std::vector<std::uint8_t>>>(left_filler_vector_any_value->data),
-                        std::get<std::reference_wrapper<std::vector<std::uint8_t>>>(right_filler_vector_any_value->data));
+                        left_filler_vector_any_value->get<std::vector<std::uint8_t>>(),
+                        right_filler_vector_any_value->get<std::vector<std::uint8_t>>());
             }
 
             image_data_ptr = std::get<std::vector<std::uint8_t>>(image_data).data();
@@ -120,13 +119,13 @@ namespace yli::load
 
             if (left_filler_vector_any_value != nullptr &&
                     right_filler_vector_any_value != nullptr &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::int16_t>>>(left_filler_vector_any_value->data) &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::int16_t>>>(right_filler_vector_any_value->data))
+                    left_filler_vector_any_value->holds<std::vector<std::int16_t>>() &&
+                    right_filler_vector_any_value->holds<std::vector<std::int16_t>>())
             {
                 image_data = yli::linear_algebra::insert_elements<std::int16_t>(
                         *csv_image_data,
-                        std::get<std::reference_wrapper<std::vector<std::int16_t>>>(left_filler_vector_any_value->data),
-                        std::get<std::reference_wrapper<std::vector<std::int16_t>>>(right_filler_vector_any_value->data));
+                        left_filler_vector_any_value->get<std::vector<std::int16_t>>(),
+                        right_filler_vector_any_value->get<std::vector<std::int16_t>>());
             }
 
             image_data_ptr = std::get<std::vector<std::int16_t>>(image_data).data();
@@ -145,13 +144,13 @@ namespace yli::load
 
             if (left_filler_vector_any_value != nullptr &&
                     right_filler_vector_any_value != nullptr &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::uint16_t>>>(left_filler_vector_any_value->data) &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::uint16_t>>>(right_filler_vector_any_value->data))
+                    left_filler_vector_any_value->holds<std::vector<std::uint16_t>>() &&
+                    right_filler_vector_any_value->holds<std::vector<std::uint16_t>>())
             {
                 image_data = yli::linear_algebra::insert_elements<std::uint16_t>(
                         *csv_image_data,
-                        std::get<std::reference_wrapper<std::vector<std::uint16_t>>>(left_filler_vector_any_value->data),
-                        std::get<std::reference_wrapper<std::vector<std::uint16_t>>>(right_filler_vector_any_value->data));
+                        left_filler_vector_any_value->get<std::vector<std::uint16_t>>(),
+                        right_filler_vector_any_value->get<std::vector<std::uint16_t>>());
             }
 
             image_data_ptr = std::get<std::vector<std::uint16_t>>(image_data).data();
@@ -170,13 +169,13 @@ namespace yli::load
 
             if (left_filler_vector_any_value != nullptr &&
                     right_filler_vector_any_value != nullptr &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::int32_t>>>(left_filler_vector_any_value->data) &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::int32_t>>>(right_filler_vector_any_value->data))
+                    left_filler_vector_any_value->holds<std::vector<std::int32_t>>() &&
+                    right_filler_vector_any_value->holds<std::vector<std::int32_t>>())
             {
                 image_data = yli::linear_algebra::insert_elements<std::int32_t>(
                         *csv_image_data,
-                        std::get<std::reference_wrapper<std::vector<std::int32_t>>>(left_filler_vector_any_value->data),
-                        std::get<std::reference_wrapper<std::vector<std::int32_t>>>(right_filler_vector_any_value->data));
+                        left_filler_vector_any_value->get<std::vector<std::int32_t>>(),
+                        right_filler_vector_any_value->get<std::vector<std::int32_t>>());
             }
 
             image_data_ptr = std::get<std::vector<std::int32_t>>(image_data).data();
@@ -195,13 +194,13 @@ namespace yli::load
 
             if (left_filler_vector_any_value != nullptr &&
                     right_filler_vector_any_value != nullptr &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::uint32_t>>>(left_filler_vector_any_value->data) &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<std::uint32_t>>>(right_filler_vector_any_value->data))
+                    left_filler_vector_any_value->holds<std::vector<std::uint32_t>>() &&
+                    right_filler_vector_any_value->holds<std::vector<std::uint32_t>>())
             {
                 image_data = yli::linear_algebra::insert_elements<std::uint32_t>(
                         *csv_image_data,
-                        std::get<std::reference_wrapper<std::vector<std::uint32_t>>>(left_filler_vector_any_value->data),
-                        std::get<std::reference_wrapper<std::vector<std::uint32_t>>>(right_filler_vector_any_value->data));
+                        left_filler_vector_any_value->get<std::vector<std::uint32_t>>(),
+                        right_filler_vector_any_value->get<std::vector<std::uint32_t>>());
             }
 
             image_data_ptr = std::get<std::vector<std::uint32_t>>(image_data).data();
@@ -228,13 +227,13 @@ namespace yli::load
 
             if (left_filler_vector_any_value != nullptr &&
                     right_filler_vector_any_value != nullptr &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<float>>>(left_filler_vector_any_value->data) &&
-                    std::holds_alternative<std::reference_wrapper<std::vector<float>>>(right_filler_vector_any_value->data))
+                    left_filler_vector_any_value->holds<std::vector<float>>() &&
+                    right_filler_vector_any_value->holds<std::vector<float>>())
             {
                 image_data = yli::linear_algebra::insert_elements<float>(
                         *csv_image_data,
-                        std::get<std::reference_wrapper<std::vector<float>>>(left_filler_vector_any_value->data),
-                        std::get<std::reference_wrapper<std::vector<float>>>(right_filler_vector_any_value->data));
+                        left_filler_vector_any_value->get<std::vector<float>>(),
+                        right_filler_vector_any_value->get<std::vector<float>>());
             }
 
             image_data_ptr = std::get<std::vector<float>>(image_data).data();
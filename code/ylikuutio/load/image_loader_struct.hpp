@@ -21,6 +21,7 @@
 #include <ofbx.h>
 
 // Include standard headers
+#include <cstdint> // std::uint32_t
 #include <utility> // std::pair
 #include <vector>  // std::vector
 
@@ -30,7 +31,8 @@ namespace yli::load
     {
         SHOULD_CONVERT_GRAYSCALE_TO_RGB,
         SHOULD_DISCARD_ALPHA_CHANNEL,
-        SHOULD_FLIP_VERTICALLY
+        SHOULD_FLIP_VERTICALLY,
+        SHOULD_LOAD_ASYNCHRONOUSLY
     };
 
     struct ImageLoaderStruct
@@ -53,13 +55,26 @@ namespace yli::load
                 {
                     this->should_flip_vertically = bool_value;
                 }
+                else if (enum_value == ImageLoadingFlags::SHOULD_LOAD_ASYNCHRONOUSLY)
+                {
+                    this->should_load_asynchronously = bool_value;
+                }
             }
         }
 
+        // The flags which affect the decoded texels, as a bitmask.
+        std::uint32_t get_flag_bits() const
+        {
+            return (this->should_convert_grayscale_to_rgb ? 1 : 0) |
+                (this->should_discard_alpha_channel ? 2 : 0) |
+                (this->should_flip_vertically ? 4 : 0);
+        }
+
         ofbx::Texture* ofbx_texture          { nullptr };
         bool should_convert_grayscale_to_rgb { false };
         bool should_discard_alpha_channel    { false };
         bool should_flip_vertically          { false };
+        bool should_load_asynchronously      { false }; // Decode in `AssetLoader` worker threads.
     };
 }
 
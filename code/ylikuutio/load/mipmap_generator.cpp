@@ -0,0 +1,91 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "mipmap_generator.hpp"
+#include "texture_data.hpp"
+
+// Include standard headers
+#include <algorithm> // std::max, std::min
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint8_t, std::uint32_t
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+namespace yli::load
+{
+    MipLevel downsample_mip_level(const MipLevel& source, const std::uint32_t n_color_channels)
+    {
+        MipLevel target;
+        target.width = std::max<std::uint32_t>(source.width / 2, 1);
+        target.height = std::max<std::uint32_t>(source.height / 2, 1);
+        target.data.resize(static_cast<std::size_t>(target.width) * target.height * n_color_channels);
+
+        for (std::uint32_t y = 0; y < target.height; y++)
+        {
+            const std::uint32_t y0 = std::min(2 * y, source.height - 1);
+            const std::uint32_t y1 = std::min(2 * y + 1, source.height - 1);
+
+            for (std::uint32_t x = 0; x < target.width; x++)
+            {
+                const std::uint32_t x0 = std::min(2 * x, source.width - 1);
+                const std::uint32_t x1 = std::min(2 * x + 1, source.width - 1);
+
+                const std::size_t i00 = (static_cast<std::size_t>(y0) * source.width + x0) * n_color_channels;
+                const std::size_t i01 = (static_cast<std::size_t>(y0) * source.width + x1) * n_color_channels;
+                const std::size_t i10 = (static_cast<std::size_t>(y1) * source.width + x0) * n_color_channels;
+                const std::size_t i11 = (static_cast<std::size_t>(y1) * source.width + x1) * n_color_channels;
+                const std::size_t target_i = (static_cast<std::size_t>(y) * target.width + x) * n_color_channels;
+
+                for (std::uint32_t channel = 0; channel < n_color_channels; channel++)
+                {
+                    // Round to nearest.
+                    const std::uint32_t sum =
+                        source.data[i00 + channel] + source.data[i01 + channel] +
+                        source.data[i10 + channel] + source.data[i11 + channel];
+                    target.data[target_i + channel] = static_cast<std::uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+
+        return target;
+    }
+
+    std::vector<MipLevel> generate_mip_chain(
+            std::vector<std::uint8_t> image_data,
+            const std::uint32_t image_width,
+            const std::uint32_t image_height,
+            const std::uint32_t n_color_channels)
+    {
+        std::vector<MipLevel> mip_levels;
+
+        if (image_width == 0 || image_height == 0 || n_color_channels == 0 ||
+                image_data.size() != static_cast<std::size_t>(image_width) * image_height * n_color_channels) [[unlikely]]
+        {
+            return mip_levels;
+        }
+
+        mip_levels.emplace_back(MipLevel { image_width, image_height, std::move(image_data) });
+
+        while (mip_levels.back().width > 1 || mip_levels.back().height > 1)
+        {
+            MipLevel next_level = downsample_mip_level(mip_levels.back(), n_color_channels);
+            mip_levels.emplace_back(std::move(next_level));
+        }
+
+        return mip_levels;
+    }
+}
@@ -0,0 +1,42 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LOAD_MIPMAP_GENERATOR_HPP_INCLUDED
+#define YLIKUUTIO_LOAD_MIPMAP_GENERATOR_HPP_INCLUDED
+
+#include "texture_data.hpp"
+
+// Include standard headers
+#include <cstdint>  // std::uint8_t, std::uint32_t
+#include <vector>   // std::vector
+
+namespace yli::load
+{
+    // Halves both dimensions (down to 1) by averaging 2x2 blocks of texels.
+    MipLevel downsample_mip_level(const MipLevel& source, std::uint32_t n_color_channels);
+
+    // Generates the full mip chain down to 1x1 with a box filter.
+    // Odd dimensions are handled by clamping the last row or column.
+    // Returns an empty vector if `image_data` does not match the given dimensions.
+    std::vector<MipLevel> generate_mip_chain(
+            std::vector<std::uint8_t> image_data,
+            std::uint32_t image_width,
+            std::uint32_t image_height,
+            std::uint32_t n_color_channels);
+}
+
+#endif
@@ -0,0 +1,90 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "mipmapped_texture_loader.hpp"
+#include "image_file_loader.hpp"
+#include "image_loader_struct.hpp"
+#include "mipmap_generator.hpp"
+#include "texture_container.hpp"
+#include "texture_data.hpp"
+
+// Include standard headers
+#include <cstdint>  // std::uint8_t, std::uint32_t
+#include <iostream> // std::cerr
+#include <memory>   // std::make_shared, std::shared_ptr
+#include <optional> // std::optional
+#include <string>   // std::string
+#include <utility>  // std::move
+#include <vector>   // std::vector
+
+namespace yli::load
+{
+    std::shared_ptr<TextureData> load_mipmapped_texture(
+            const std::string& filename,
+            const ImageLoaderStruct& image_loader_struct,
+            const bool should_use_texture_container)
+    {
+        const std::optional<TextureSourceStamp> source_stamp = get_texture_source_stamp(filename);
+        const std::string container_path = get_texture_container_path(filename, image_loader_struct);
+
+        if (should_use_texture_container && source_stamp)
+        {
+            if (std::optional<TextureData> texture_data = read_texture_container(container_path, *source_stamp))
+            {
+                return std::make_shared<TextureData>(std::move(*texture_data));
+            }
+        }
+
+        std::uint32_t image_width = 0;
+        std::uint32_t image_height = 0;
+        std::uint32_t image_size = 0;
+        std::uint32_t n_color_channels = 0;
+
+        const std::shared_ptr<std::vector<std::uint8_t>> image_data = load_image_file(
+                filename,
+                image_loader_struct,
+                image_width,
+                image_height,
+                image_size,
+                n_color_channels);
+
+        if (image_data == nullptr)
+        {
+            std::cerr << "ERROR: `yli::load::load_mipmapped_texture`: loading " << filename << " failed!\n";
+            return nullptr;
+        }
+
+        std::shared_ptr<TextureData> texture_data = std::make_shared<TextureData>();
+        texture_data->n_color_channels = n_color_channels;
+        texture_data->mip_levels = generate_mip_chain(std::move(*image_data), image_width, image_height, n_color_channels);
+
+        if (texture_data->mip_levels.empty())
+        {
+            std::cerr << "ERROR: `yli::load::load_mipmapped_texture`: generating mip chain for " << filename << " failed!\n";
+            return nullptr;
+        }
+
+        if (should_use_texture_container && source_stamp &&
+                !write_texture_container(container_path, *texture_data, *source_stamp))
+        {
+            // Not fatal, e.g. the asset directory may be read-only.
+            std::cerr << "ERROR: `yli::load::load_mipmapped_texture`: writing texture container " << container_path << " failed!\n";
+        }
+
+        return texture_data;
+    }
+}
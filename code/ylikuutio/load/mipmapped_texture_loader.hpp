@@ -0,0 +1,41 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LOAD_MIPMAPPED_TEXTURE_LOADER_HPP_INCLUDED
+#define YLIKUUTIO_LOAD_MIPMAPPED_TEXTURE_LOADER_HPP_INCLUDED
+
+#include "texture_data.hpp"
+
+// Include standard headers
+#include <memory>   // std::shared_ptr
+#include <string>   // std::string
+
+namespace yli::load
+{
+    struct ImageLoaderStruct;
+
+    // Loads a texture with its full mip chain. If `should_use_texture_container` is `true`,
+    // an up-to-date texture container is read instead of decoding the image, and a new
+    // container is written after decoding. Does not call the graphics API, so this can
+    // be run on a worker thread. Returns `nullptr` on failure.
+    std::shared_ptr<TextureData> load_mipmapped_texture(
+            const std::string& filename,
+            const ImageLoaderStruct& image_loader_struct,
+            bool should_use_texture_container);
+}
+
+#endif
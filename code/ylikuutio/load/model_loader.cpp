@@ -41,7 +41,7 @@
 
 namespace yli::load
 {
-    bool load_model(
+    bool load_model_data(
             const ModelLoaderStruct& model_loader_struct,
             std::vector<glm::vec3>& out_vertices,
             std::vector<glm::vec2>& out_uvs,
@@ -50,12 +50,6 @@ namespace yli::load
             std::vector<glm::vec3>& indexed_vertices,
             std::vector<glm::vec2>& indexed_uvs,
             std::vector<glm::vec3>& indexed_normals,
-            GLuint& vao,
-            GLuint& vertex_buffer,
-            GLuint& uv_buffer,
-            GLuint& normal_buffer,
-            GLuint& element_buffer,
-            const render::GraphicsApiBackend graphics_api_backend,
             const bool is_debug_mode)
     {
         bool model_loading_result = false;
@@ -167,6 +161,21 @@ namespace yli::load
 
         std::cout << "Indexing completed successfully.\n";
 
+        return model_loading_result;
+    }
+
+    void upload_model_data(
+            const std::vector<std::uint32_t>& indices,
+            const std::vector<glm::vec3>& indexed_vertices,
+            const std::vector<glm::vec2>& indexed_uvs,
+            const std::vector<glm::vec3>& indexed_normals,
+            GLuint& vao,
+            GLuint& vertex_buffer,
+            GLuint& uv_buffer,
+            GLuint& normal_buffer,
+            GLuint& element_buffer,
+            const render::GraphicsApiBackend graphics_api_backend)
+    {
         if (graphics_api_backend == render::GraphicsApiBackend::OPENGL)
         {
             glGenVertexArrays(1, &vao);
@@ -190,7 +199,53 @@ namespace yli::load
             glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, element_buffer);
             glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(std::uint32_t), &indices.at(0), GL_STATIC_DRAW);
         }
+    }
 
-        return model_loading_result;
+    bool load_model(
+            const ModelLoaderStruct& model_loader_struct,
+            std::vector<glm::vec3>& out_vertices,
+            std::vector<glm::vec2>& out_uvs,
+            std::vector<glm::vec3>& out_normals,
+            std::vector<std::uint32_t>& indices,
+            std::vector<glm::vec3>& indexed_vertices,
+            std::vector<glm::vec2>& indexed_uvs,
+            std::vector<glm::vec3>& indexed_normals,
+            GLuint& vao,
+            GLuint& vertex_buffer,
+            GLuint& uv_buffer,
+            GLuint& normal_buffer,
+            GLuint& element_buffer,
+            const render::GraphicsApiBackend graphics_api_backend,
+            const bool is_debug_mode)
+    {
+        const bool model_loading_result = load_model_data(
+                model_loader_struct,
+                out_vertices,
+                out_uvs,
+                out_normals,
+                indices,
+                indexed_vertices,
+                indexed_uvs,
+                indexed_normals,
+                is_debug_mode);
+
+        if (!model_loading_result)
+        {
+            return false;
+        }
+
+        upload_model_data(
+                indices,
+                indexed_vertices,
+                indexed_uvs,
+                indexed_normals,
+                vao,
+                vertex_buffer,
+                uv_buffer,
+                normal_buffer,
+                element_buffer,
+                graphics_api_backend);
+
+        return true;
     }
 }
@@ -39,6 +39,33 @@ namespace yli::load
 {
     struct ModelLoaderStruct;
 
+    // Reads, decodes and indexes the model. Does not call the graphics API,
+    // so this can be run on a worker thread.
+    bool load_model_data(
+            const ModelLoaderStruct& model_loader_struct,
+            std::vector<glm::vec3>& out_vertices,
+            std::vector<glm::vec2>& out_uvs,
+            std::vector<glm::vec3>& out_normals,
+            std::vector<std::uint32_t>& indices,
+            std::vector<glm::vec3>& indexed_vertices,
+            std::vector<glm::vec2>& indexed_uvs,
+            std::vector<glm::vec3>& indexed_normals,
+            bool is_debug_mode);
+
+    // Uploads indexed model data to the GPU. Must be called on the thread which owns the GL context.
+    void upload_model_data(
+            const std::vector<std::uint32_t>& indices,
+            const std::vector<glm::vec3>& indexed_vertices,
+            const std::vector<glm::vec2>& indexed_uvs,
+            const std::vector<glm::vec3>& indexed_normals,
+            GLuint& vao,
+            GLuint& vertex_buffer,
+            GLuint& uv_buffer,
+            GLuint& normal_buffer,
+            GLuint& element_buffer,
+            render::GraphicsApiBackend graphics_api_backend);
+
+    // `load_model_data` followed by `upload_model_data`.
     bool load_model(
             const ModelLoaderStruct& model_loader_struct,
             std::vector<glm::vec3>& out_vertices,
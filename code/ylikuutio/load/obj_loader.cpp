@@ -14,11 +14,8 @@
 //
 // You should have received a copy of the GNU Affero General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
-
 #include "obj_loader.hpp"
-#include "code/ylikuutio/file/file_loader.hpp"
-#include "code/ylikuutio/string/extract_string.hpp"
-#include "code/ylikuutio/string/match_string.hpp"
+#include "code/ylikuutio/file/memory_mapped_file.hpp"
 
 // Include GLM
 #ifndef __GLM_GLM_HPP_INCLUDED
@@ -27,190 +24,563 @@
 #endif
 
 // Include standard headers
-#include <algorithm> // std::ranges::replace
-#include <cstddef>   // std::size_t
-#include <cstdint>   // std::int32_t
-#include <iostream>  // std::cout, std::cerr
-#include <optional>  // std::optional
-#include <sstream>   // std::stringstream
-#include <string>    // std::string
-#include <vector>    // std::vector
+#include <algorithm>    // std::clamp, std::count, std::min
+#include <charconv>     // std::from_chars
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::int32_t, std::int64_t
+#include <cstring>      // std::memchr
+#include <functional>   // std::ref
+#include <iostream>     // std::cout, std::cerr
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <system_error> // std::errc
+#include <thread>       // std::thread
+#include <vector>       // std::vector
 
 namespace yli::load
 {
-    bool load_obj(
-            const std::string& filename,
-            std::vector<glm::vec3>& out_vertices,
-            std::vector<glm::vec2>& out_uvs,
-            std::vector<glm::vec3>& out_normals)
+    // Files smaller than this are parsed in one chunk.
+    static constexpr std::size_t obj_min_chunk_size = 1 << 16;
+
+    enum class ObjKeyword
     {
-        std::cout << "Loading OBJ file " << filename << " ...\n";
+        OTHER,
+        VERTEX,
+        UV,
+        NORMAL,
+        FACE,
+        OBJECT
+    };
 
-        // Open the file
-        const std::optional<std::string> file_content = file::slurp(filename);
+    struct ObjChunk
+    {
+        const char* begin { nullptr };
+        const char* end   { nullptr };
+
+        // Element counts of this chunk.
+        std::size_t n_vertices  { 0 };
+        std::size_t n_uvs       { 0 };
+        std::size_t n_normals   { 0 };
+        std::size_t n_triangles { 0 };
+
+        // Indices of the first element of this chunk in the whole file.
+        std::size_t first_vertex   { 0 };
+        std::size_t first_uv       { 0 };
+        std::size_t first_normal   { 0 };
+        std::size_t first_triangle { 0 };
+
+        // Start of the first `o` line, parsing stops there.
+        const char* object_line { nullptr };
 
-        if (!file_content || file_content->empty())
+        // Start of the first line that could not be parsed.
+        const char* error_line { nullptr };
+    };
+
+    static bool is_obj_whitespace(const char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    static const char* skip_obj_whitespace(const char* it, const char* const line_end)
+    {
+        while (it < line_end && is_obj_whitespace(*it))
+        {
+            it++;
+        }
+
+        return it;
+    }
+
+    static const char* find_obj_line_end(const char* const it, const char* const end)
+    {
+        const void* const newline = std::memchr(it, '\n', static_cast<std::size_t>(end - it));
+        return newline != nullptr ? static_cast<const char*>(newline) : end;
+    }
+
+    // Reads the keyword in the beginning of the line and advances `it` past it.
+    static ObjKeyword read_obj_keyword(const char*& it, const char* const line_end)
+    {
+        it = skip_obj_whitespace(it, line_end);
+        const char* const keyword_begin = it;
+
+        while (it < line_end && !is_obj_whitespace(*it))
+        {
+            it++;
+        }
+
+        const std::string_view keyword(keyword_begin, static_cast<std::size_t>(it - keyword_begin));
+
+        if (keyword == "v")
+        {
+            return ObjKeyword::VERTEX;
+        }
+        else if (keyword == "vt")
+        {
+            return ObjKeyword::UV;
+        }
+        else if (keyword == "vn")
+        {
+            return ObjKeyword::NORMAL;
+        }
+        else if (keyword == "f")
+        {
+            return ObjKeyword::FACE;
+        }
+        else if (keyword == "o")
+        {
+            return ObjKeyword::OBJECT;
+        }
+
+        // Comments, `l`, `s`, `mtllib`, `usemtl` etc. are ignored.
+        return ObjKeyword::OTHER;
+    }
+
+    static bool read_obj_float(const char*& it, const char* const line_end, float& value)
+    {
+        it = skip_obj_whitespace(it, line_end);
+
+        if (it < line_end && *it == '+')
+        {
+            it++;
+        }
+
+        const auto [pointer, error_code] = std::from_chars(it, line_end, value);
+
+        if (error_code != std::errc()) [[unlikely]]
         {
-            std::cerr << filename << " could not be opened, or the file is empty.\n";
             return false;
         }
 
-        std::vector<std::int32_t> vertex_indices, uv_indices, normal_indices;
-        std::vector<glm::vec3> temp_vertices;
-        std::vector<glm::vec2> temp_uvs;
-        std::vector<glm::vec3> temp_normals;
+        it = pointer;
+        return true;
+    }
 
-        std::size_t file_content_i = 0;
+    static std::size_t count_obj_face_vertices(const char* it, const char* const line_end)
+    {
+        std::size_t n_face_vertices = 0;
 
         while (true)
         {
-            // Assume we are at the beginning of a line now.
-            const std::vector<std::string> whitespace_vector = { " ", "\t" };
+            it = skip_obj_whitespace(it, line_end);
 
-            // Read until any non-whitespace character.
-            while (true)
+            if (it >= line_end)
             {
-                if (!string::check_and_report_if_some_string_matches<char>(*file_content, file_content_i, whitespace_vector))
-                {
-                    // Not whitespace.
-                    break;
-                }
-
-                file_content_i++;
+                return n_face_vertices;
             }
 
-            if (file_content_i >= file_content->size())
+            n_face_vertices++;
+
+            while (it < line_end && !is_obj_whitespace(*it))
             {
-                std::cout << filename << " ends in a line consisting only of whitespace.\n";
-                break;
+                it++;
             }
+        }
+    }
 
-            // OK, non-whitespace found.
-            auto newline_char_end_string = "\n";
-            std::string current_line_string = yli::string::extract_string_with_several_endings<char>(*file_content, file_content_i, newline_char_end_string);
+    // OBJ indices begin from 1, negative indices are relative to the current end of the list.
+    static bool resolve_obj_index(const std::int32_t obj_index, const std::size_t n_defined_before, const std::size_t n_total, std::size_t& index)
+    {
+        const std::int64_t resolved_index = (obj_index > 0 ?
+                static_cast<std::int64_t>(obj_index) - 1 :
+                static_cast<std::int64_t>(n_defined_before) + obj_index);
 
-            // Replace slashes `'/'` with space `' '`, to make string processing easier.
-            std::ranges::replace(current_line_string, '/', ' ');
+        if (obj_index == 0 || resolved_index < 0 || resolved_index >= static_cast<std::int64_t>(n_total)) [[unlikely]]
+        {
+            return false;
+        }
 
-            // Note: `"vt"` and `"vn"` needs to be checked for before `"v"`!
+        index = static_cast<std::size_t>(resolved_index);
+        return true;
+    }
 
-            auto current_line_stringstream = std::stringstream(current_line_string);
-            std::string prefix;
+    struct ObjFaceVertex
+    {
+        std::size_t vertex_i;
+        std::size_t uv_i;
+        std::size_t normal_i;
+    };
+
+    // Reads one `vertex/uv/normal` triplet.
+    static bool read_obj_face_vertex(
+            const char*& it,
+            const char* const line_end,
+            const ObjChunk& chunk,
+            const std::size_t n_vertices_before,
+            const std::size_t n_uvs_before,
+            const std::size_t n_normals_before,
+            const std::vector<std::size_t>& totals,
+            ObjFaceVertex& face_vertex)
+    {
+        std::int32_t obj_indices[3];
 
-            if (current_line_string.compare(0, std::char_traits<char>::length("#"), "#") == 0)
+        it = skip_obj_whitespace(it, line_end);
+
+        for (std::size_t i = 0; i < 3; i++)
+        {
+            if (i > 0)
             {
-                // `#`
-                // This line is a comment.
+                if (it >= line_end || *it != '/') [[unlikely]]
+                {
+                    return false;
+                }
+
+                it++;
             }
-            else if (current_line_string.compare(0, std::char_traits<char>::length("vt"), "vt") == 0)
+
+            const auto [pointer, error_code] = std::from_chars(it, line_end, obj_indices[i]);
+
+            if (error_code != std::errc()) [[unlikely]]
             {
-                // `vt`
-                // This line specifies texture coordinate of one vertex.
-                // Example:
-                // vt 0.748573 0.750412
-                glm::vec2 uv;
-                current_line_stringstream >> prefix >> uv.x >> uv.y;
-                temp_uvs.emplace_back(uv);
+                return false;
             }
-            else if (current_line_string.compare(0, std::char_traits<char>::length("vn"), "vn") == 0)
+
+            it = pointer;
+        }
+
+        return resolve_obj_index(obj_indices[0], chunk.first_vertex + n_vertices_before, totals[0], face_vertex.vertex_i) &&
+            resolve_obj_index(obj_indices[1], chunk.first_uv + n_uvs_before, totals[1], face_vertex.uv_i) &&
+            resolve_obj_index(obj_indices[2], chunk.first_normal + n_normals_before, totals[2], face_vertex.normal_i);
+    }
+
+    static void count_obj_chunk(ObjChunk& chunk)
+    {
+        for (const char* line_begin = chunk.begin; line_begin < chunk.end; )
+        {
+            const char* const line_end = find_obj_line_end(line_begin, chunk.end);
+            const char* it = line_begin;
+
+            switch (read_obj_keyword(it, line_end))
             {
-                // `vn`
-                // This line specifies the normal of one vertex.
-                // Example:
-                // vn 0.000000 0.000000 -1.000000
-                glm::vec3 normal;
-                current_line_stringstream >> prefix >> normal.x >> normal.y >> normal.z;
-                temp_normals.emplace_back(normal);
+                case ObjKeyword::VERTEX:
+                    chunk.n_vertices++;
+                    break;
+                case ObjKeyword::UV:
+                    chunk.n_uvs++;
+                    break;
+                case ObjKeyword::NORMAL:
+                    chunk.n_normals++;
+                    break;
+                case ObjKeyword::FACE:
+                    {
+                        const std::size_t n_face_vertices = count_obj_face_vertices(it, line_end);
+
+                        if (n_face_vertices < 3) [[unlikely]]
+                        {
+                            chunk.error_line = line_begin;
+                            return;
+                        }
+
+                        chunk.n_triangles += n_face_vertices - 2;
+                        break;
+                    }
+                case ObjKeyword::OBJECT:
+                    // TODO: implement `o`.
+                    // Currently, terminate processing when `o` is encountered.
+                    chunk.object_line = line_begin;
+                    return;
+                case ObjKeyword::OTHER:
+                    break;
             }
-            else if (current_line_string.compare(0, std::char_traits<char>::length("v"), "v") == 0)
+
+            line_begin = line_end + 1;
+        }
+    }
+
+    static void parse_obj_vertex_attributes(
+            ObjChunk& chunk,
+            glm::vec3* const vertices,
+            glm::vec2* const uvs,
+            glm::vec3* const normals)
+    {
+        glm::vec3* vertex = vertices + chunk.first_vertex;
+        glm::vec2* uv = uvs + chunk.first_uv;
+        glm::vec3* normal = normals + chunk.first_normal;
+
+        for (const char* line_begin = chunk.begin; line_begin < chunk.end; )
+        {
+            const char* const line_end = find_obj_line_end(line_begin, chunk.end);
+            const char* it = line_begin;
+            bool is_ok = true;
+
+            switch (read_obj_keyword(it, line_end))
             {
-                // `v`
-                // This line specifies a vertex.
-                // Example:
-                // v 1.000000 -1.000000 -1.000000
-                glm::vec3 vertex;
-                current_line_stringstream >> prefix >> vertex.x >> vertex.y >> vertex.z;
-                temp_vertices.emplace_back(vertex);
+                case ObjKeyword::VERTEX:
+                    // Example:
+                    // v 1.000000 -1.000000 -1.000000
+                    is_ok = read_obj_float(it, line_end, vertex->x) &&
+                        read_obj_float(it, line_end, vertex->y) &&
+                        read_obj_float(it, line_end, vertex->z);
+                    vertex++;
+                    break;
+                case ObjKeyword::UV:
+                    // Example:
+                    // vt 0.748573 0.750412
+                    is_ok = read_obj_float(it, line_end, uv->x) &&
+                        read_obj_float(it, line_end, uv->y);
+                    uv++;
+                    break;
+                case ObjKeyword::NORMAL:
+                    // Example:
+                    // vn 0.000000 0.000000 -1.000000
+                    is_ok = read_obj_float(it, line_end, normal->x) &&
+                        read_obj_float(it, line_end, normal->y) &&
+                        read_obj_float(it, line_end, normal->z);
+                    normal++;
+                    break;
+                default:
+                    break;
             }
-            else if (current_line_string.compare(0, std::char_traits<char>::length("f"), "f") == 0)
+
+            if (!is_ok) [[unlikely]]
             {
-                // `f`
-                // This line specifies a face.
-                // Example:
-                // f 5/1/1 1/2/1 4/3/1
-                std::int32_t vertex_i1;
-                std::int32_t vertex_i2;
-                std::int32_t vertex_i3;
-                std::int32_t uv_i1;
-                std::int32_t uv_i2;
-                std::int32_t uv_i3;
-                std::int32_t normal_i1;
-                std::int32_t normal_i2;
-                std::int32_t normal_i3;
-                current_line_stringstream >> prefix >> vertex_i1 >> uv_i1 >> normal_i1 >> vertex_i2 >> uv_i2 >> normal_i2 >> vertex_i3 >> uv_i3 >> normal_i3;
-                vertex_indices.emplace_back(vertex_i1);
-                vertex_indices.emplace_back(vertex_i2);
-                vertex_indices.emplace_back(vertex_i3);
-                uv_indices.emplace_back(uv_i1);
-                uv_indices.emplace_back(uv_i2);
-                uv_indices.emplace_back(uv_i3);
-                normal_indices.emplace_back(normal_i1);
-                normal_indices.emplace_back(normal_i2);
-                normal_indices.emplace_back(normal_i3);
+                chunk.error_line = line_begin;
+                return;
             }
-            else if (current_line_string.compare(0, std::char_traits<char>::length("l"), "l") == 0)
+
+            line_begin = line_end + 1;
+        }
+    }
+
+    static void parse_obj_faces(
+            ObjChunk& chunk,
+            const std::vector<std::size_t>& totals,
+            const glm::vec3* const vertices,
+            const glm::vec2* const uvs,
+            const glm::vec3* const normals,
+            glm::vec3* const out_vertices,
+            glm::vec2* const out_uvs,
+            glm::vec3* const out_normals)
+    {
+        // Counts of vertex attributes defined before the current line in this chunk,
+        // needed for relative indices.
+        std::size_t n_vertices_before = 0;
+        std::size_t n_uvs_before = 0;
+        std::size_t n_normals_before = 0;
+
+        std::size_t out_i = 3 * chunk.first_triangle;
+
+        for (const char* line_begin = chunk.begin; line_begin < chunk.end; )
+        {
+            const char* const line_end = find_obj_line_end(line_begin, chunk.end);
+            const char* it = line_begin;
+
+            switch (read_obj_keyword(it, line_end))
             {
-                // `l`
-                // TODO: implement `l`.
+                case ObjKeyword::VERTEX:
+                    n_vertices_before++;
+                    break;
+                case ObjKeyword::UV:
+                    n_uvs_before++;
+                    break;
+                case ObjKeyword::NORMAL:
+                    n_normals_before++;
+                    break;
+                case ObjKeyword::FACE:
+                    {
+                        // Example:
+                        // f 5/1/1 1/2/1 4/3/1
+                        ObjFaceVertex first;
+                        ObjFaceVertex previous;
+                        ObjFaceVertex current;
+
+                        if (!read_obj_face_vertex(it, line_end, chunk, n_vertices_before, n_uvs_before, n_normals_before, totals, first) ||
+                                !read_obj_face_vertex(it, line_end, chunk, n_vertices_before, n_uvs_before, n_normals_before, totals, previous)) [[unlikely]]
+                        {
+                            chunk.error_line = line_begin;
+                            return;
+                        }
+
+                        while (skip_obj_whitespace(it, line_end) < line_end)
+                        {
+                            if (!read_obj_face_vertex(it, line_end, chunk, n_vertices_before, n_uvs_before, n_normals_before, totals, current)) [[unlikely]]
+                            {
+                                chunk.error_line = line_begin;
+                                return;
+                            }
+
+                            // Triangulate as a fan.
+                            for (const ObjFaceVertex* face_vertex : { &first, &previous, &current })
+                            {
+                                out_vertices[out_i] = vertices[face_vertex->vertex_i];
+                                out_uvs[out_i] = uvs[face_vertex->uv_i];
+                                out_normals[out_i] = normals[face_vertex->normal_i];
+                                out_i++;
+                            }
+
+                            previous = current;
+                        }
+
+                        break;
+                    }
+                default:
+                    break;
             }
-            else if (current_line_string.compare(0, std::char_traits<char>::length("o"), "o") == 0)
+
+            line_begin = line_end + 1;
+        }
+    }
+
+    // Runs `function` for every chunk, chunk 0 on the calling thread.
+    template<typename Function>
+        static void for_each_obj_chunk_in_parallel(std::vector<ObjChunk>& chunks, const Function& function)
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(chunks.size());
+
+            for (std::size_t chunk_i = 1; chunk_i < chunks.size(); chunk_i++)
             {
-                // `o`
-                // TODO: implement `o`.
-                // Currently, terminate processing when `o` is encountered.
-                break;
+                threads.emplace_back(function, std::ref(chunks[chunk_i]));
             }
-            else if (current_line_string.compare(0, std::char_traits<char>::length("s"), "s") == 0)
+
+            function(chunks[0]);
+
+            for (std::thread& thread : threads)
             {
-                // `s`
-                // TODO: implement `s`.
+                thread.join();
             }
-            else if (current_line_string.compare(0, std::char_traits<char>::length("mtllib"), "mtllib") == 0)
+        }
+
+    static bool report_obj_error(const std::vector<ObjChunk>& chunks, const std::string& filename, const char* const file_begin)
+    {
+        for (const ObjChunk& chunk : chunks)
+        {
+            if (chunk.error_line != nullptr) [[unlikely]]
             {
-                // `mtllib`
-                // TODO: implement `mtllib`.
+                const std::size_t line_number = 1 + std::count(file_begin, chunk.error_line, '\n');
+                std::cerr << "ERROR: `yli::load::load_obj`: invalid line " << line_number << " in " << filename << "!\n";
+                return true;
             }
-            else if (current_line_string.compare(0, std::char_traits<char>::length("usemtl"), "usemtl") == 0)
+        }
+
+        return false;
+    }
+
+    bool load_obj(
+            const std::string& filename,
+            std::vector<glm::vec3>& out_vertices,
+            std::vector<glm::vec2>& out_uvs,
+            std::vector<glm::vec3>& out_normals,
+            const std::size_t n_threads)
+    {
+        std::cout << "Loading OBJ file " << filename << " ...\n";
+
+        // Open the file
+        const yli::file::MemoryMappedFile file(filename);
+
+        if (!file.get_is_valid())
+        {
+            std::cerr << filename << " could not be opened, or the file is empty.\n";
+            return false;
+        }
+
+        const char* const file_begin = file.data();
+        const char* const file_end = file.data() + file.size();
+
+        // Split the file into line-aligned chunks.
+        const std::size_t max_n_chunks = (n_threads > 0 ? n_threads : std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+        const std::size_t n_chunks = std::clamp<std::size_t>(file.size() / obj_min_chunk_size, 1, max_n_chunks);
+        std::vector<ObjChunk> chunks(n_chunks);
+
+        const char* chunk_begin = file_begin;
+
+        for (std::size_t chunk_i = 0; chunk_i < n_chunks; chunk_i++)
+        {
+            const char* chunk_end = file_end;
+
+            if (chunk_i + 1 < n_chunks)
             {
-                // `usemtl`
-                // TODO: implement `usemtl`.
+                chunk_end = find_obj_line_end(std::max(chunk_begin, file_begin + file.size() * (chunk_i + 1) / n_chunks), file_end);
+                chunk_end = (chunk_end < file_end ? chunk_end + 1 : file_end);
             }
 
-            const std::vector<std::string> endline_vector = { "\n", "\r" };
+            chunks[chunk_i].begin = chunk_begin;
+            chunks[chunk_i].end = chunk_end;
+            chunk_begin = chunk_end;
+        }
+
+        // Pass 1: count the elements of each chunk.
+        for_each_obj_chunk_in_parallel(chunks, count_obj_chunk);
 
-            // Read until any non-whitespace character.
-            while (yli::string::check_and_report_if_some_string_matches<char>(*file_content, ++file_content_i, endline_vector))
+        if (report_obj_error(chunks, filename, file_begin))
+        {
+            return false;
+        }
+
+        for (std::size_t chunk_i = 0; chunk_i < chunks.size(); chunk_i++)
+        {
+            if (chunks[chunk_i].object_line != nullptr)
             {
+                chunks[chunk_i].end = chunks[chunk_i].object_line;
+                chunks.resize(chunk_i + 1);
+                break;
             }
         }
 
-        // For each vertex of each triangle
-        for (std::size_t i = 0; i < vertex_indices.size(); i++)
+        std::size_t n_vertices = 0;
+        std::size_t n_uvs = 0;
+        std::size_t n_normals = 0;
+        std::size_t n_triangles = 0;
+
+        for (ObjChunk& chunk : chunks)
+        {
+            chunk.first_vertex = n_vertices;
+            chunk.first_uv = n_uvs;
+            chunk.first_normal = n_normals;
+            chunk.first_triangle = n_triangles;
+            n_vertices += chunk.n_vertices;
+            n_uvs += chunk.n_uvs;
+            n_normals += chunk.n_normals;
+            n_triangles += chunk.n_triangles;
+        }
+
+        // Pass 2: parse the vertex attributes.
+        std::vector<glm::vec3> temp_vertices(n_vertices);
+        std::vector<glm::vec2> temp_uvs(n_uvs);
+        std::vector<glm::vec3> temp_normals(n_normals);
+
+        for_each_obj_chunk_in_parallel(
+                chunks,
+                [&](ObjChunk& chunk)
+                {
+                    parse_obj_vertex_attributes(chunk, temp_vertices.data(), temp_uvs.data(), temp_normals.data());
+                });
+
+        if (report_obj_error(chunks, filename, file_begin))
         {
-            // Get the indices of its attributes
-            std::int32_t vertex_index = vertex_indices.at(i);
-            std::int32_t uv_index = uv_indices.at(i);
-            std::int32_t normal_index = normal_indices.at(i);
+            return false;
+        }
+
+        // Pass 3: resolve the faces into the output arrays.
+        // Faces may refer to vertex attributes in later chunks, so this can only start after pass 2.
+        const std::vector<std::size_t> totals { n_vertices, n_uvs, n_normals };
+        const std::size_t old_n_vertices = out_vertices.size();
+        const std::size_t old_n_uvs = out_uvs.size();
+        const std::size_t old_n_normals = out_normals.size();
+        out_vertices.resize(old_n_vertices + 3 * n_triangles);
+        out_uvs.resize(old_n_uvs + 3 * n_triangles);
+        out_normals.resize(old_n_normals + 3 * n_triangles);
 
-            // Get the attributes thanks to the index
-            glm::vec3 vertex = temp_vertices.at(vertex_index - 1);
-            glm::vec2 uv = temp_uvs.at(uv_index - 1);
-            glm::vec3 normal = temp_normals.at(normal_index - 1);
+        for_each_obj_chunk_in_parallel(
+                chunks,
+                [&](ObjChunk& chunk)
+                {
+                    parse_obj_faces(
+                            chunk,
+                            totals,
+                            temp_vertices.data(),
+                            temp_uvs.data(),
+                            temp_normals.data(),
+                            out_vertices.data() + old_n_vertices,
+                            out_uvs.data() + old_n_uvs,
+                            out_normals.data() + old_n_normals);
+                });
 
-            // Put the attributes in buffers
-            out_vertices.emplace_back(vertex);
-            out_uvs.emplace_back(uv);
-            out_normals.emplace_back(normal);
+        if (report_obj_error(chunks, filename, file_begin))
+        {
+            out_vertices.resize(old_n_vertices);
+            out_uvs.resize(old_n_uvs);
+            out_normals.resize(old_n_normals);
+            return false;
         }
 
         return true;
@@ -25,16 +25,27 @@
 #endif
 
 // Include standard headers
+#include <cstddef>   // std::size_t
 #include <string>    // std::string
 #include <vector>    // std::vector
 
+// `load_obj` memory-maps the OBJ file and parses it in line-aligned chunks
+// in parallel. The first pass counts the elements of each chunk, so that
+// the vertex attributes and the triangles can be written straight into
+// pre-sized arrays by the following passes.
+//
+// Faces are triangulated as fans. Every face vertex must have a vertex,
+// UV and normal index, negative (relative) indices are supported.
+// Loaded data is appended to the output vectors.
+
 namespace yli::load
 {
     bool load_obj(
             const std::string& filename,
             std::vector<glm::vec3>& out_vertices,
             std::vector<glm::vec2>& out_uvs,
-            std::vector<glm::vec3>& out_normals);
+            std::vector<glm::vec3>& out_normals,
+            const std::size_t n_threads = 0); // 0 means hardware concurrency.
 }
 
 #endif
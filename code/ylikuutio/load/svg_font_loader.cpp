@@ -0,0 +1,367 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "svg_font_loader.hpp"
+#include "code/ylikuutio/file/file_loader.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <charconv>     // std::from_chars
+#include <cstddef>      // std::size_t
+#include <iostream>     // std::cout, std::cerr
+#include <optional>     // std::optional
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <system_error> // std::errc
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
+namespace yli::load
+{
+    static bool is_svg_whitespace(const char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    // Returns the start of the next element named `element_name`, or `std::string_view::npos`.
+    static std::size_t find_svg_element(const std::string_view svg_data, const std::string_view element_name, std::size_t search_i)
+    {
+        while ((search_i = svg_data.find(element_name, search_i)) != std::string_view::npos)
+        {
+            const std::size_t after_name_i = search_i + element_name.size();
+
+            // `<font` must not match `<font-face`.
+            if (after_name_i < svg_data.size() &&
+                    (is_svg_whitespace(svg_data[after_name_i]) || svg_data[after_name_i] == '/' || svg_data[after_name_i] == '>'))
+            {
+                return search_i;
+            }
+
+            search_i = after_name_i;
+        }
+
+        return std::string_view::npos;
+    }
+
+    // Returns the value of the attribute `attribute_name` of `element`,
+    // or `std::nullopt` if `element` has no such attribute.
+    static std::optional<std::string_view> get_svg_attribute(const std::string_view element, const std::string_view attribute_name)
+    {
+        std::size_t name_i = 0;
+
+        while ((name_i = element.find(attribute_name, name_i)) != std::string_view::npos)
+        {
+            const std::size_t value_i = name_i + attribute_name.size() + 2;
+
+            // The name must be a whole attribute name, eg. `d` must not match `glyph-name="d"`.
+            if (name_i > 0 &&
+                    is_svg_whitespace(element[name_i - 1]) &&
+                    element.substr(name_i + attribute_name.size(), 2) == "=\"")
+            {
+                const std::size_t value_end_i = element.find('"', value_i);
+
+                if (value_end_i == std::string_view::npos)
+                {
+                    return std::nullopt;
+                }
+
+                return element.substr(value_i, value_end_i - value_i);
+            }
+
+            name_i++;
+        }
+
+        return std::nullopt;
+    }
+
+    static std::optional<float> convert_svg_number(const std::string_view number_string)
+    {
+        float value = 0.0f;
+        const auto [end_pointer, error_code] = std::from_chars(
+                number_string.data(),
+                number_string.data() + number_string.size(),
+                value);
+
+        if (error_code != std::errc() || end_pointer != number_string.data() + number_string.size())
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+
+    // Reads the next number of path data, skipping the whitespace and commas before it.
+    static std::optional<float> read_svg_path_number(const std::string_view path_data, std::size_t& path_i)
+    {
+        while (path_i < path_data.size() && (is_svg_whitespace(path_data[path_i]) || path_data[path_i] == ','))
+        {
+            path_i++;
+        }
+
+        float value = 0.0f;
+        const auto [end_pointer, error_code] = std::from_chars(
+                path_data.data() + path_i,
+                path_data.data() + path_data.size(),
+                value);
+
+        if (error_code != std::errc())
+        {
+            return std::nullopt;
+        }
+
+        path_i = end_pointer - path_data.data();
+        return value;
+    }
+
+    // Flattens straight line path data into closed outlines.
+    static bool load_svg_path(
+            const std::string_view path_data,
+            const float vertex_scaling_factor,
+            std::vector<std::vector<glm::vec2>>& out_outlines)
+    {
+        std::vector<glm::vec2> outline;
+        glm::vec2 current_point { 0.0f, 0.0f };
+        glm::vec2 subpath_start { 0.0f, 0.0f };
+        char command = '\0';
+        std::size_t path_i = 0;
+
+        auto close_outline = [&]()
+        {
+            if (outline.size() > 1 && outline.back() == outline.front())
+            {
+                outline.pop_back();
+            }
+
+            if (outline.size() >= 3)
+            {
+                for (glm::vec2& vertex : outline)
+                {
+                    vertex *= vertex_scaling_factor;
+                }
+
+                out_outlines.push_back(std::move(outline));
+            }
+
+            outline.clear();
+        };
+
+        auto line_to = [&](const glm::vec2& point)
+        {
+            if (outline.empty())
+            {
+                // A subpath may continue from a `Z` without a new `M`.
+                subpath_start = current_point;
+                outline.push_back(current_point);
+            }
+
+            outline.push_back(point);
+            current_point = point;
+        };
+
+        while (true)
+        {
+            while (path_i < path_data.size() && (is_svg_whitespace(path_data[path_i]) || path_data[path_i] == ','))
+            {
+                path_i++;
+            }
+
+            if (path_i == path_data.size())
+            {
+                break;
+            }
+
+            const char c = path_data[path_i];
+
+            if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'))
+            {
+                command = c;
+                path_i++;
+
+                if (command == 'Z' || command == 'z')
+                {
+                    close_outline();
+                    current_point = subpath_start;
+                    command = '\0'; // Coordinates may not follow `Z`.
+                }
+
+                continue;
+            }
+
+            const bool is_relative = (command >= 'a' && command <= 'z');
+            const glm::vec2 origin = (is_relative ? current_point : glm::vec2(0.0f, 0.0f));
+
+            if (command == 'M' || command == 'm' || command == 'L' || command == 'l')
+            {
+                const std::optional<float> x = read_svg_path_number(path_data, path_i);
+                const std::optional<float> y = (x ? read_svg_path_number(path_data, path_i) : std::nullopt);
+
+                if (!x || !y)
+                {
+                    return false;
+                }
+
+                const glm::vec2 point = origin + glm::vec2(*x, *y);
+
+                if (command == 'M' || command == 'm')
+                {
+                    close_outline();
+                    subpath_start = point;
+                    current_point = point;
+                    outline.push_back(point);
+
+                    // Coordinate pairs following a moveto are implicit linetos.
+                    command = (command == 'm' ? 'l' : 'L');
+                    continue;
+                }
+
+                line_to(point);
+            }
+            else if (command == 'H' || command == 'h')
+            {
+                const std::optional<float> x = read_svg_path_number(path_data, path_i);
+
+                if (!x)
+                {
+                    return false;
+                }
+
+                line_to(glm::vec2(origin.x + *x, current_point.y));
+            }
+            else if (command == 'V' || command == 'v')
+            {
+                const std::optional<float> y = read_svg_path_number(path_data, path_i);
+
+                if (!y)
+                {
+                    return false;
+                }
+
+                line_to(glm::vec2(current_point.x, origin.y + *y));
+            }
+            else
+            {
+                // A curve, or a number without a command.
+                return false;
+            }
+        }
+
+        close_outline();
+        return true;
+    }
+
+    bool load_svg_font(
+            const std::string& filename,
+            const float vertex_scaling_factor,
+            std::vector<std::vector<std::vector<glm::vec2>>>& out_glyph_vertex_data,
+            std::vector<std::string>& out_glyph_names,
+            std::vector<std::string>& out_unicode_strings,
+            std::vector<float>& out_advance_widths)
+    {
+        const std::optional<std::string> file_content = yli::file::slurp(filename);
+
+        if (!file_content.has_value())
+        {
+            std::cerr << "ERROR: `yli::load::load_svg_font`: loading SVG font file " << filename << " failed!\n";
+            return false;
+        }
+
+        const std::string_view svg_data = *file_content;
+
+        const std::size_t font_i = find_svg_element(svg_data, "<font", 0);
+        const std::size_t font_end_i = (font_i != std::string_view::npos ? svg_data.find('>', font_i) : std::string_view::npos);
+
+        if (font_end_i == std::string_view::npos)
+        {
+            std::cerr << "ERROR: `yli::load::load_svg_font`: " << filename << " has no `<font>` element!\n";
+            return false;
+        }
+
+        const std::optional<std::string_view> font_advance_string = get_svg_attribute(
+                svg_data.substr(font_i, font_end_i - font_i),
+                "horiz-adv-x");
+        const std::optional<float> font_advance_width = (font_advance_string ? convert_svg_number(*font_advance_string) : std::nullopt);
+
+        if (!font_advance_width)
+        {
+            std::cerr << "ERROR: `yli::load::load_svg_font`: the `<font>` element of " << filename << " has no valid `horiz-adv-x`!\n";
+            return false;
+        }
+
+        std::size_t glyph_i = font_end_i;
+
+        while ((glyph_i = find_svg_element(svg_data, "<glyph", glyph_i)) != std::string_view::npos)
+        {
+            const std::size_t glyph_end_i = svg_data.find('>', glyph_i);
+
+            if (glyph_end_i == std::string_view::npos)
+            {
+                std::cerr << "ERROR: `yli::load::load_svg_font`: unterminated `<glyph>` element in " << filename << "!\n";
+                return false;
+            }
+
+            const std::string_view glyph_element = svg_data.substr(glyph_i, glyph_end_i - glyph_i);
+            glyph_i = glyph_end_i;
+
+            const std::optional<std::string_view> unicode_string = get_svg_attribute(glyph_element, "unicode");
+
+            if (!unicode_string || unicode_string->empty())
+            {
+                // Eg. `.notdef`, there is no character to map to this glyph.
+                continue;
+            }
+
+            const std::string_view glyph_name = get_svg_attribute(glyph_element, "glyph-name").value_or("");
+
+            float advance_width = *font_advance_width;
+
+            if (const std::optional<std::string_view> advance_string = get_svg_attribute(glyph_element, "horiz-adv-x"))
+            {
+                const std::optional<float> glyph_advance_width = convert_svg_number(*advance_string);
+
+                if (!glyph_advance_width)
+                {
+                    std::cerr << "ERROR: `yli::load::load_svg_font`: invalid `horiz-adv-x` in glyph \"" << glyph_name << "\"!\n";
+                    continue;
+                }
+
+                advance_width = *glyph_advance_width;
+            }
+
+            std::vector<std::vector<glm::vec2>> outlines;
+
+            if (!load_svg_path(get_svg_attribute(glyph_element, "d").value_or(""), vertex_scaling_factor, outlines))
+            {
+                std::cerr << "ERROR: `yli::load::load_svg_font`: unsupported path data in glyph \"" << glyph_name << "\"!\n";
+                continue;
+            }
+
+            out_glyph_vertex_data.push_back(std::move(outlines));
+            out_glyph_names.emplace_back(glyph_name);
+            out_unicode_strings.emplace_back(*unicode_string);
+            out_advance_widths.push_back(advance_width * vertex_scaling_factor);
+        }
+
+        std::cout << "Number of glyphs loaded from " << filename << ": " << out_glyph_vertex_data.size() << "\n";
+        return true;
+    }
+}
@@ -0,0 +1,53 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#ifndef YLIKUUTIO_LOAD_SVG_FONT_LOADER_HPP_INCLUDED
+#define YLIKUUTIO_LOAD_SVG_FONT_LOADER_HPP_INCLUDED
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+// `load_svg_font` reads the `<glyph>` elements of an SVG font.
+//
+// Each glyph with a `unicode` attribute is loaded. Its path data is
+// flattened into closed outlines, one outline per subpath. Only straight
+// line commands (`M`, `L`, `H`, `V`, `Z` and their relative forms) are
+// supported, glyphs using curves are skipped. The advance width is the
+// `horiz-adv-x` of the glyph, or that of the `<font>` if the glyph has
+// none. Coordinates and advance widths are multiplied by `vertex_scaling_factor`.
+// Loaded data is appended to the output vectors.
+
+namespace yli::load
+{
+    bool load_svg_font(
+            const std::string& filename,
+            const float vertex_scaling_factor,
+            std::vector<std::vector<std::vector<glm::vec2>>>& out_glyph_vertex_data,
+            std::vector<std::string>& out_glyph_names,
+            std::vector<std::string>& out_unicode_strings,
+            std::vector<float>& out_advance_widths);
+}
+
+#endif
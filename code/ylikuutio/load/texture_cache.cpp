@@ -0,0 +1,155 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "texture_cache.hpp"
+#include "image_loader_struct.hpp"
+#include "mipmapped_texture_loader.hpp"
+#include "texture_data.hpp"
+#include "code/ylikuutio/opengl/opengl_texture.hpp"
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+#include "code/ylikuutio/render/graphics_api_backend.hpp"
+
+// Include standard headers
+#include <cstddef>   // std::size_t
+#include <iterator>  // std::next
+#include <memory>    // std::make_shared, std::shared_ptr
+#include <stdexcept> // std::runtime_error
+#include <string>    // std::string, std::to_string
+
+namespace yli::load
+{
+    CachedTexture::~CachedTexture()
+    {
+        if (this->texture != GL_INVALID_VALUE)
+        {
+            glDeleteTextures(1, &this->texture);
+        }
+    }
+
+    std::string TextureCache::get_key(const std::string& filename, const ImageLoaderStruct& image_loader_struct)
+    {
+        return filename + "|" + std::to_string(image_loader_struct.get_flag_bits());
+    }
+
+    std::shared_ptr<CachedTexture> TextureCache::find(const std::string& key)
+    {
+        const auto it = this->textures.find(key);
+
+        if (it == this->textures.end())
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<CachedTexture> cached_texture = it->second.lock();
+
+        if (cached_texture == nullptr)
+        {
+            this->textures.erase(it);
+        }
+
+        return cached_texture;
+    }
+
+    std::shared_ptr<CachedTexture> TextureCache::insert(
+            const std::string& key,
+            const TextureData& texture_data,
+            const render::GraphicsApiBackend graphics_api_backend)
+    {
+        if (std::shared_ptr<CachedTexture> cached_texture = this->find(key); cached_texture != nullptr)
+        {
+            return cached_texture;
+        }
+
+        if (texture_data.mip_levels.empty()) [[unlikely]]
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<CachedTexture> cached_texture = std::make_shared<CachedTexture>();
+        cached_texture->image_width      = texture_data.mip_levels.front().width;
+        cached_texture->image_height     = texture_data.mip_levels.front().height;
+        cached_texture->image_size       = cached_texture->image_width * cached_texture->image_height;
+        cached_texture->n_color_channels = texture_data.n_color_channels;
+        cached_texture->n_mip_levels     = texture_data.mip_levels.size();
+
+        if (graphics_api_backend == render::GraphicsApiBackend::OPENGL)
+        {
+            if (!opengl::prepare_opengl_mipmapped_texture(texture_data, cached_texture->texture))
+            {
+                return nullptr;
+            }
+        }
+        else if (graphics_api_backend == render::GraphicsApiBackend::VULKAN)
+        {
+            // TODO: implement.
+            throw std::runtime_error("ERROR: `TextureCache::insert`: Vulkan is not supported yet!");
+        }
+        else if (graphics_api_backend == render::GraphicsApiBackend::SOFTWARE)
+        {
+            // TODO: implement.
+            throw std::runtime_error("ERROR: `TextureCache::insert`: software rendering is not supported yet!");
+        }
+
+        this->textures[key] = cached_texture;
+        return cached_texture;
+    }
+
+    std::shared_ptr<CachedTexture> TextureCache::load(
+            const std::string& filename,
+            const ImageLoaderStruct& image_loader_struct,
+            const render::GraphicsApiBackend graphics_api_backend)
+    {
+        const std::string key = TextureCache::get_key(filename, image_loader_struct);
+
+        if (std::shared_ptr<CachedTexture> cached_texture = this->find(key); cached_texture != nullptr)
+        {
+            return cached_texture;
+        }
+
+        const std::shared_ptr<TextureData> texture_data = load_mipmapped_texture(
+                filename,
+                image_loader_struct,
+                this->should_use_texture_containers);
+
+        if (texture_data == nullptr)
+        {
+            return nullptr;
+        }
+
+        return this->insert(key, *texture_data, graphics_api_backend);
+    }
+
+    std::size_t TextureCache::get_number_of_textures()
+    {
+        for (auto it = this->textures.begin(); it != this->textures.end(); )
+        {
+            it = (it->second.expired() ? this->textures.erase(it) : std::next(it));
+        }
+
+        return this->textures.size();
+    }
+
+    bool TextureCache::get_should_use_texture_containers() const
+    {
+        return this->should_use_texture_containers;
+    }
+
+    void TextureCache::set_should_use_texture_containers(const bool should_use_texture_containers)
+    {
+        this->should_use_texture_containers = should_use_texture_containers;
+    }
+}
@@ -0,0 +1,101 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LOAD_TEXTURE_CACHE_HPP_INCLUDED
+#define YLIKUUTIO_LOAD_TEXTURE_CACHE_HPP_INCLUDED
+
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+
+// Include standard headers
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint32_t
+#include <memory>        // std::shared_ptr, std::weak_ptr
+#include <string>        // std::string
+#include <unordered_map> // std::unordered_map
+
+namespace yli::render
+{
+    enum class GraphicsApiBackend;
+}
+
+namespace yli::load
+{
+    struct ImageLoaderStruct;
+    struct TextureData;
+
+    // A GPU texture shared by all users which load the same image with the same flags.
+    // The texture is deleted when the last user releases it.
+    struct CachedTexture
+    {
+        CachedTexture() = default;
+
+        CachedTexture(const CachedTexture&) = delete;            // Delete copy constructor.
+        CachedTexture& operator=(const CachedTexture&) = delete; // Delete copy assignment.
+
+        ~CachedTexture();
+
+        GLuint texture                 { GL_INVALID_VALUE };
+        std::uint32_t image_width      { 0 };
+        std::uint32_t image_height     { 0 };
+        std::uint32_t image_size       { 0 };
+        std::uint32_t n_color_channels { 0 };
+        std::uint32_t n_mip_levels     { 0 };
+    };
+
+    // `TextureCache` maps an image file and its loading flags to a `CachedTexture`.
+    // The cache holds only weak references, so reference counting is done by the users.
+    // Textures are loaded with a precomputed mip chain, see `load_mipmapped_texture`.
+    // `TextureCache` is not thread-safe, it must be used on the thread which owns the GL context.
+    class TextureCache final
+    {
+        public:
+            TextureCache() = default;
+
+            TextureCache(const TextureCache&) = delete;            // Delete copy constructor.
+            TextureCache& operator=(const TextureCache&) = delete; // Delete copy assignment.
+
+            static std::string get_key(const std::string& filename, const ImageLoaderStruct& image_loader_struct);
+
+            // `nullptr` if there is no live texture with the given key.
+            std::shared_ptr<CachedTexture> find(const std::string& key);
+
+            // Uploads `texture_data` unless a live texture with the same key exists already,
+            // in which case that texture is returned. `nullptr` if uploading fails.
+            std::shared_ptr<CachedTexture> insert(
+                    const std::string& key,
+                    const TextureData& texture_data,
+                    render::GraphicsApiBackend graphics_api_backend);
+
+            // Finds the texture or loads and inserts it synchronously.
+            std::shared_ptr<CachedTexture> load(
+                    const std::string& filename,
+                    const ImageLoaderStruct& image_loader_struct,
+                    render::GraphicsApiBackend graphics_api_backend);
+
+            // Number of live textures.
+            std::size_t get_number_of_textures();
+
+            bool get_should_use_texture_containers() const;
+            void set_should_use_texture_containers(bool should_use_texture_containers);
+
+        private:
+            std::unordered_map<std::string, std::weak_ptr<CachedTexture>> textures;
+            bool should_use_texture_containers { true };
+    };
+}
+
+#endif
@@ -0,0 +1,212 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "texture_container.hpp"
+#include "texture_data.hpp"
+#include "image_loader_struct.hpp"
+
+// Include standard headers
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::int64_t, std::uint8_t, std::uint32_t, std::uint64_t, std::uintmax_t
+#include <cstring>      // std::memcmp, std::memcpy
+#include <filesystem>   // std::filesystem
+#include <fstream>      // std::ifstream, std::ofstream
+#include <ios>          // std::ios, std::streamsize
+#include <iterator>     // std::begin, std::end
+#include <optional>     // std::nullopt, std::optional
+#include <string>       // std::string, std::to_string
+#include <system_error> // std::error_code
+#include <vector>       // std::vector
+
+namespace yli::load
+{
+    static constexpr char texture_container_magic[] { 'Y', 'L', 'T', 'X' };
+    static constexpr std::uint32_t texture_container_version = 1;
+
+    template<typename T>
+        static void append_value(std::vector<std::uint8_t>& container_data, const T value)
+        {
+            const std::size_t offset = container_data.size();
+            container_data.resize(offset + sizeof(T));
+            std::memcpy(container_data.data() + offset, &value, sizeof(T));
+        }
+
+    template<typename T>
+        static bool read_value(const std::vector<std::uint8_t>& container_data, std::size_t& offset, T& value)
+        {
+            if (container_data.size() - offset < sizeof(T))
+            {
+                return false;
+            }
+
+            std::memcpy(&value, container_data.data() + offset, sizeof(T));
+            offset += sizeof(T);
+            return true;
+        }
+
+    std::optional<TextureSourceStamp> get_texture_source_stamp(const std::string& filename)
+    {
+        std::error_code error_code;
+        const std::uintmax_t file_size = std::filesystem::file_size(filename, error_code);
+
+        if (error_code)
+        {
+            return std::nullopt;
+        }
+
+        const std::filesystem::file_time_type last_write_time = std::filesystem::last_write_time(filename, error_code);
+
+        if (error_code)
+        {
+            return std::nullopt;
+        }
+
+        return TextureSourceStamp {
+            static_cast<std::uint64_t>(file_size),
+            static_cast<std::int64_t>(last_write_time.time_since_epoch().count()) };
+    }
+
+    std::string get_texture_container_path(const std::string& filename, const ImageLoaderStruct& image_loader_struct)
+    {
+        return filename + "." + std::to_string(image_loader_struct.get_flag_bits()) + ".yltx";
+    }
+
+    std::vector<std::uint8_t> serialize_texture_container(
+            const TextureData& texture_data,
+            const TextureSourceStamp& source_stamp)
+    {
+        std::vector<std::uint8_t> container_data(std::begin(texture_container_magic), std::end(texture_container_magic));
+
+        append_value(container_data, texture_container_version);
+        append_value(container_data, static_cast<std::uint32_t>(TextureContainerFormat::UNCOMPRESSED_8_BITS_PER_CHANNEL));
+        append_value(container_data, texture_data.n_color_channels);
+        append_value(container_data, source_stamp.file_size);
+        append_value(container_data, source_stamp.last_write_time);
+        append_value(container_data, static_cast<std::uint32_t>(texture_data.mip_levels.size()));
+
+        for (const MipLevel& mip_level : texture_data.mip_levels)
+        {
+            append_value(container_data, mip_level.width);
+            append_value(container_data, mip_level.height);
+            append_value(container_data, static_cast<std::uint64_t>(mip_level.data.size()));
+            container_data.insert(container_data.end(), mip_level.data.begin(), mip_level.data.end());
+        }
+
+        return container_data;
+    }
+
+    std::optional<TextureData> deserialize_texture_container(
+            const std::vector<std::uint8_t>& container_data,
+            const TextureSourceStamp& source_stamp)
+    {
+        if (container_data.size() < sizeof(texture_container_magic) ||
+                std::memcmp(container_data.data(), texture_container_magic, sizeof(texture_container_magic)) != 0)
+        {
+            return std::nullopt;
+        }
+
+        std::size_t offset = sizeof(texture_container_magic);
+        std::uint32_t version = 0;
+        std::uint32_t format = 0;
+        TextureData texture_data;
+        TextureSourceStamp container_source_stamp;
+        std::uint32_t n_mip_levels = 0;
+
+        if (!read_value(container_data, offset, version) ||
+                version != texture_container_version ||
+                !read_value(container_data, offset, format) ||
+                format != static_cast<std::uint32_t>(TextureContainerFormat::UNCOMPRESSED_8_BITS_PER_CHANNEL) ||
+                !read_value(container_data, offset, texture_data.n_color_channels) ||
+                !read_value(container_data, offset, container_source_stamp.file_size) ||
+                !read_value(container_data, offset, container_source_stamp.last_write_time) ||
+                container_source_stamp != source_stamp ||
+                !read_value(container_data, offset, n_mip_levels) ||
+                n_mip_levels == 0)
+        {
+            return std::nullopt;
+        }
+
+        texture_data.mip_levels.resize(n_mip_levels);
+
+        for (MipLevel& mip_level : texture_data.mip_levels)
+        {
+            std::uint64_t data_size = 0;
+
+            if (!read_value(container_data, offset, mip_level.width) ||
+                    !read_value(container_data, offset, mip_level.height) ||
+                    !read_value(container_data, offset, data_size) ||
+                    data_size != static_cast<std::uint64_t>(mip_level.width) * mip_level.height * texture_data.n_color_channels ||
+                    container_data.size() - offset < data_size)
+            {
+                return std::nullopt;
+            }
+
+            mip_level.data.assign(container_data.begin() + offset, container_data.begin() + offset + data_size);
+            offset += data_size;
+        }
+
+        return texture_data;
+    }
+
+    std::optional<TextureData> read_texture_container(
+            const std::string& container_path,
+            const TextureSourceStamp& source_stamp)
+    {
+        std::error_code error_code;
+        const std::uintmax_t container_size = std::filesystem::file_size(container_path, error_code);
+
+        if (error_code)
+        {
+            return std::nullopt;
+        }
+
+        // Read in one go, the container is usually the hot path of texture loading.
+        std::vector<std::uint8_t> container_data(container_size);
+        std::ifstream file_stream(container_path, std::ios::in | std::ios::binary);
+        file_stream.read(reinterpret_cast<char*>(container_data.data()), static_cast<std::streamsize>(container_size));
+
+        if (!file_stream)
+        {
+            return std::nullopt;
+        }
+
+        return deserialize_texture_container(container_data, source_stamp);
+    }
+
+    bool write_texture_container(
+            const std::string& container_path,
+            const TextureData& texture_data,
+            const TextureSourceStamp& source_stamp)
+    {
+        const std::vector<std::uint8_t> container_data = serialize_texture_container(texture_data, source_stamp);
+        const std::string temporary_path = container_path + ".tmp";
+
+        {
+            std::ofstream file_stream(temporary_path, std::ios::out | std::ios::binary);
+            file_stream.write(reinterpret_cast<const char*>(container_data.data()), container_data.size());
+
+            if (!file_stream)
+            {
+                return false;
+            }
+        }
+
+        std::error_code error_code;
+        std::filesystem::rename(temporary_path, container_path, error_code);
+        return !error_code;
+    }
+}
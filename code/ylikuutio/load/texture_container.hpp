@@ -0,0 +1,82 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LOAD_TEXTURE_CONTAINER_HPP_INCLUDED
+#define YLIKUUTIO_LOAD_TEXTURE_CONTAINER_HPP_INCLUDED
+
+#include "texture_data.hpp"
+
+// Include standard headers
+#include <cstdint>  // std::int64_t, std::uint8_t, std::uint64_t
+#include <optional> // std::optional
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+// A texture container caches a decoded texture with its mip chain in a
+// binary file, so that later loads skip both image decoding and GPU mip
+// generation. The container records the size and modification time of
+// the source image and is ignored when the source has changed.
+//
+// Layout (little-endian on all supported platforms):
+// "YLTX", version, format, n_color_channels, source file size,
+// source write time, n_mip_levels, then for each mip level:
+// width, height, data size, data.
+
+namespace yli::load
+{
+    struct ImageLoaderStruct;
+
+    enum class TextureContainerFormat : std::uint32_t
+    {
+        UNCOMPRESSED_8_BITS_PER_CHANNEL = 0
+    };
+
+    struct TextureSourceStamp
+    {
+        std::uint64_t file_size { 0 };
+        std::int64_t last_write_time { 0 };
+
+        bool operator==(const TextureSourceStamp&) const = default;
+    };
+
+    // `std::nullopt` if the source file can not be accessed.
+    std::optional<TextureSourceStamp> get_texture_source_stamp(const std::string& filename);
+
+    // The container path depends on the image loading flags, because they change the decoded texels.
+    std::string get_texture_container_path(const std::string& filename, const ImageLoaderStruct& image_loader_struct);
+
+    std::vector<std::uint8_t> serialize_texture_container(
+            const TextureData& texture_data,
+            const TextureSourceStamp& source_stamp);
+
+    // `std::nullopt` if the data is malformed or `source_stamp` does not match.
+    std::optional<TextureData> deserialize_texture_container(
+            const std::vector<std::uint8_t>& container_data,
+            const TextureSourceStamp& source_stamp);
+
+    std::optional<TextureData> read_texture_container(
+            const std::string& container_path,
+            const TextureSourceStamp& source_stamp);
+
+    // Writes to a temporary file first, so that concurrent readers never see a partial container.
+    bool write_texture_container(
+            const std::string& container_path,
+            const TextureData& texture_data,
+            const TextureSourceStamp& source_stamp);
+}
+
+#endif
@@ -0,0 +1,42 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_LOAD_TEXTURE_DATA_HPP_INCLUDED
+#define YLIKUUTIO_LOAD_TEXTURE_DATA_HPP_INCLUDED
+
+// Include standard headers
+#include <cstdint>  // std::uint8_t, std::uint32_t
+#include <vector>   // std::vector
+
+namespace yli::load
+{
+    struct MipLevel
+    {
+        std::uint32_t width  { 0 };
+        std::uint32_t height { 0 };
+        std::vector<std::uint8_t> data; // `width * height * n_color_channels` bytes, rows tightly packed.
+    };
+
+    // A decoded texture with its full mip chain, level 0 being the full size image.
+    struct TextureData
+    {
+        std::uint32_t n_color_channels { 0 };
+        std::vector<MipLevel> mip_levels;
+    };
+}
+
+#endif
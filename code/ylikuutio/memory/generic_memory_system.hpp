@@ -36,6 +36,10 @@ namespace yli::memory
 
         [[nodiscard]] virtual std::size_t get_number_of_allocators() const = 0;
 
+        [[nodiscard]] virtual std::size_t get_number_of_storages() const = 0;
+
+        [[nodiscard]] virtual std::size_t get_number_of_instances() const = 0;
+
         virtual void destroy(const ConstructibleModule& constructible_module) = 0;
     };
 }
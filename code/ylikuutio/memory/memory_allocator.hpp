@@ -57,24 +57,35 @@ namespace yli::memory
         template<typename... Args>
         T1* build_in(Args&&... args)
         {
-            for (auto& storage : this->storages)
+            // Storages before `first_free_storage_i` are full,
+            // so they are not tried again for each instance.
+            for (; this->first_free_storage_i < this->storages.size(); this->first_free_storage_i++)
             {
-                T1* instance = storage->build_in(std::forward<Args>(args)...);
+                auto& storage = this->storages[this->first_free_storage_i];
 
-                if (instance != nullptr)
+                if (storage->get_number_of_instances() < DataSize)
                 {
-                    return instance;
+                    return storage->build_in(std::forward<Args>(args)...);
                 }
             }
 
-            // Pass number of storages to `MemoryStorage` constructor as the `storage_i`.
-            // This assumes that storages can not be deleted (except in `MemoryAllocator`'s destructor).
-            const std::size_t storage_i { this->storages.size() };
-            auto storage = std::make_unique<MemoryStorage<T1, DataSize>>(*this, storage_i);
-            this->storages.emplace_back(std::move(storage));
+            this->add_storage();
             return this->storages.back()->build_in(std::forward<Args>(args)...);
         }
 
+        // Create storages up front so that `n_instances` more instances can be built
+        // without creating storages in between, e.g. for bulk creation of `Entity`s.
+        void reserve(const std::size_t n_instances)
+        {
+            const std::size_t capacity = this->storages.size() * DataSize;
+            const std::size_t n_required = this->get_number_of_instances() + n_instances;
+
+            for (std::size_t n_available = capacity; n_available < n_required; n_available += DataSize)
+            {
+                this->add_storage();
+            }
+        }
+
         [[nodiscard]] std::size_t get_datatype() const override
         {
             return this->datatype;
@@ -157,12 +168,27 @@ namespace yli::memory
             if (storage != nullptr)
             {
                 storage->destroy(constructible_module.slot_i);
+
+                if (constructible_module.storage_i < this->first_free_storage_i)
+                {
+                    this->first_free_storage_i = constructible_module.storage_i;
+                }
             }
         }
 
     private:
+        void add_storage()
+        {
+            // Pass number of storages to `MemoryStorage` constructor as the `storage_i`.
+            // This assumes that storages can not be deleted (except in `MemoryAllocator`'s destructor).
+            const std::size_t storage_i { this->storages.size() };
+            auto storage = std::make_unique<MemoryStorage<T1, DataSize>>(*this, storage_i);
+            this->storages.emplace_back(std::move(storage));
+        }
+
         const int datatype;
         std::vector<std::unique_ptr<MemoryStorage<T1, DataSize>>> storages;
+        std::size_t first_free_storage_i { 0 }; // No storage before this has free slots.
     };
 
     template<std::size_t DataSize>
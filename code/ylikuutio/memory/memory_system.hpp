@@ -100,6 +100,30 @@ namespace yli::memory
             return this->memory_allocators.size();
         }
 
+        [[nodiscard]] std::size_t get_number_of_storages() const override
+        {
+            std::size_t count = 0;
+
+            for (const auto& [type, memory_allocator] : this->memory_allocators)
+            {
+                count += memory_allocator->get_number_of_storages();
+            }
+
+            return count;
+        }
+
+        [[nodiscard]] std::size_t get_number_of_instances() const override
+        {
+            std::size_t count = 0;
+
+            for (const auto& [type, memory_allocator] : this->memory_allocators)
+            {
+                count += memory_allocator->get_number_of_instances();
+            }
+
+            return count;
+        }
+
         template<typename T1, typename... Args>
         void create_allocator(TypeEnumType type, Args&&... args)
         {
@@ -37,16 +37,6 @@
 #include <glm/gtc/type_ptr.hpp> // glm::value_ptr
 #endif
 
-#ifndef __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
-#define __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
-#include <glm/gtc/matrix_transform.hpp>
-#endif
-
-#ifndef __GLM_GTC_QUATERNION_HPP_INCLUDED
-#define __GLM_GTC_QUATERNION_HPP_INCLUDED
-#include <glm/gtc/quaternion.hpp> // glm::quat
-#endif
-
 // Include standard headers
 #include <cstddef>   // std::size_t
 #include <cstdint>   // std::uint32_t
@@ -79,6 +69,7 @@ namespace yli::ontology
           apprentice_of_symbiont_species(symbiont_species_master_module, this)
     {
         this->biontID = biont_struct.biontID;
+        this->local_offset = biont_struct.local_offset;
         this->should_render = biont_struct.should_render;
 
         // `Entity` member variables begin here.
@@ -90,6 +81,24 @@ namespace yli::ontology
         return this->child_of_holobiont.get_parent();
     }
 
+    const glm::vec3& Biont::get_local_offset() const
+    {
+        return this->local_offset;
+    }
+
+    void Biont::set_local_offset(const glm::vec3& local_offset)
+    {
+        this->local_offset = local_offset;
+    }
+
+    glm::mat4 Biont::compute_model_matrix(const glm::mat4& holobiont_model_matrix) const
+    {
+        // `holobiont_model_matrix * glm::translate(glm::mat4(1.0f), this->local_offset)`.
+        glm::mat4 model_matrix = holobiont_model_matrix;
+        model_matrix[3] += holobiont_model_matrix * glm::vec4(this->local_offset, 0.0f);
+        return model_matrix;
+    }
+
     void Biont::render()
     {
         // Render this `Biont`.
@@ -148,30 +157,8 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `Biont::render_this_biont`: `symbiont_species_master` is `nullptr`!");
         }
 
-        this->model_matrix = glm::mat4(1.0f);
-
-        if (this->initial_rotate_vectors.size() == this->initial_rotate_angles.size())
-        {
-            for (std::size_t i = 0; i < this->initial_rotate_vectors.size() && i < this->initial_rotate_angles.size();
-                 i++)
-            {
-                this->model_matrix = glm::rotate(this->model_matrix, this->initial_rotate_angles[i],
-                                                 this->initial_rotate_vectors[i]);
-            }
-        }
-
-        this->model_matrix = glm::scale(this->model_matrix,
-                                        holobiont_parent->get_scale() * this->original_scale_vector);
-        const glm::vec3 euler_angles {
-            holobiont_parent->orientation.roll, -holobiont_parent->orientation.pitch, holobiont_parent->orientation.yaw
-        };
-        const auto my_quaternion = glm::quat(euler_angles);
-        const glm::mat4 rotation_matrix = glm::mat4_cast(my_quaternion);
-        this->model_matrix = rotation_matrix * this->model_matrix;
-        this->model_matrix[3][0] = holobiont_parent->location.get_x();
-        this->model_matrix[3][1] = holobiont_parent->location.get_y();
-        this->model_matrix[3][2] = holobiont_parent->location.get_z();
-
+        // The model matrix of the `Holobiont` is computed once per frame by the `Holobiont`.
+        this->model_matrix = this->compute_model_matrix(holobiont_parent->get_model_matrix());
         this->mvp_matrix = this->universe.get_projection_matrix() * this->universe.get_view_matrix() *
                            this->model_matrix;
 
@@ -295,7 +282,7 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `Biont::get_scene`: `holobiont_parent` is `nullptr`!");
         }
 
-        return holobiont_parent->get_scene();
+        return holobiont_parent->get_cached_scene();
     }
 
     std::size_t Biont::get_number_of_children() const
@@ -22,6 +22,12 @@
 #include "child_module.hpp"
 #include "apprentice_module.hpp"
 
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
 // Include standard headers
 #include <cstddef>  // std::size_t
 #include <limits>   // std::numeric_limits
@@ -70,13 +76,23 @@ namespace yli::ontology
         ChildModule child_of_holobiont;
         ApprenticeModule apprentice_of_symbiont_species;
 
-        // This method renders this `Biont`.
+        // A `Biont` stores only its offset relative to its `Holobiont`,
+        // its world transform follows from the model matrix of the `Holobiont`.
+        const glm::vec3& get_local_offset() const;
+
+        void set_local_offset(const glm::vec3& local_offset);
+
+        glm::mat4 compute_model_matrix(const glm::mat4& holobiont_model_matrix) const;
+
+        // This method renders this `Biont` with its own draw call.
+        // `Symbiosis::render` draws the `Biont`s instanced when the shader supports it.
         void render();
 
     protected:
         void render_this_biont();
 
         std::size_t biontID { std::numeric_limits<std::size_t>::max() };
+        glm::vec3 local_offset { 0.0f, 0.0f, 0.0f };
 
     public:
         Scene* get_scene() const override;
@@ -46,6 +46,7 @@ namespace yli::ontology
         Request<Holobiont> holobiont_parent              {};
         Request<SymbiontSpecies> symbiont_species_master {};
         std::size_t biontID { std::numeric_limits<std::size_t>::max() }; // `std::numeric_limits<std::size_t>::max()` means that `biontID` is not defined.
+        glm::vec3 local_offset { 0.0f, 0.0f, 0.0f }; // Location relative to the `Holobiont`, in the modelspace of the `Holobiont`.
         bool should_render { true };
     };
 }
@@ -0,0 +1,56 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_ONTOLOGY_CACHED_ANCESTOR_HPP_INCLUDED
+#define YLIKUUTIO_ONTOLOGY_CACHED_ANCESTOR_HPP_INCLUDED
+
+// Include standard headers
+#include <cstdint> // std::uint64_t
+
+// The generation of a `Universe` advances whenever any child is bound to
+// or unbound from a `GenericParentModule`, or any apprentice to or from
+// a `GenericMasterModule`, see `Registry::get_universe_generation`.
+// `CachedAncestor` stores an ancestor resolved by walking up the hierarchy,
+// e.g. the `Scene` or the `Pipeline` of an `Entity`, together with the
+// generation it was resolved in, and resolves it again only after the
+// generation has advanced.
+
+namespace yli::ontology
+{
+    template<typename T>
+    class CachedAncestor
+    {
+        public:
+            template<typename Resolver>
+            T* get(const std::uint64_t universe_generation, const Resolver& resolver) const
+            {
+                if (this->generation != universe_generation) [[unlikely]]
+                {
+                    this->ancestor = resolver();
+                    this->generation = universe_generation;
+                }
+
+                return this->ancestor;
+            }
+
+        private:
+            mutable T* ancestor { nullptr };
+            mutable std::uint64_t generation { 0 }; // 0 is never a valid generation.
+    };
+}
+
+#endif
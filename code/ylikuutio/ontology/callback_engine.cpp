@@ -17,22 +17,26 @@
 
 #include "callback_engine.hpp"
 #include "callback_object.hpp"
+#include "callback_parameter.hpp"
 #include "generic_entity_factory.hpp"
 #include "request.hpp"
 #include "generic_callback_engine_struct.hpp"
 #include "callback_object_struct.hpp"
 #include "get_number_of_descendants.hpp"
 #include "input_parameters_and_any_value_to_any_value_callback_with_universe.hpp"
+#include "movable_and_arguments_to_void_callback.hpp"
 #include "code/ylikuutio/core/application.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
 
 // Include standard headers
 #include <cstddef>  // std::size_t
 #include <optional> // std::optional
+#include <span>     // std::span
 
 namespace yli::ontology
 {
     class Universe;
+    class Movable;
     struct CallbackEngineStruct;
 
     CallbackEngine::CallbackEngine(
@@ -74,6 +78,17 @@ namespace yli::ontology
         return callback_object;
     }
 
+    CallbackObject* CallbackEngine::create_movable_callback_object(
+        const MovableAndArgumentsToVoidCallback movable_callback)
+    {
+        const GenericEntityFactory& entity_factory = this->get_application().get_generic_entity_factory();
+
+        const CallbackObjectStruct callback_object_struct { Request(this) };
+        const auto callback_object = entity_factory.create_callback_object(callback_object_struct);
+        callback_object->set_new_movable_callback(movable_callback);
+        return callback_object;
+    }
+
     std::optional<data::AnyValue> CallbackEngine::execute(const data::AnyValue& any_value)
     {
         std::optional<data::AnyValue> return_any_value;
@@ -107,6 +122,77 @@ namespace yli::ontology
         return std::nullopt;
     }
 
+    void CallbackEngine::execute(Movable& movable)
+    {
+        if (!this->are_thunks_compiled) [[unlikely]]
+        {
+            this->compile_thunks();
+        }
+
+        if (!this->are_all_callbacks_typed) [[unlikely]]
+        {
+            this->execute(data::AnyValue(movable));
+            return;
+        }
+
+        for (std::size_t thunk_i = 0; thunk_i < this->thunks.size() && this->are_thunks_compiled; thunk_i++)
+        {
+            // A callback may create or destroy `CallbackObject`s or `CallbackParameter`s.
+            // In that case the rest of the thunks may be stale and the loop ends.
+            const CallbackThunk& thunk = this->thunks[thunk_i];
+            thunk.movable_callback(
+                movable,
+                std::span<const data::AnyValue* const>(this->thunk_args.data() + thunk.first_arg_i, thunk.n_args));
+        }
+    }
+
+    void CallbackEngine::invalidate_thunks()
+    {
+        this->are_thunks_compiled = false;
+    }
+
+    void CallbackEngine::compile_thunks()
+    {
+        this->thunks.clear();
+        this->thunk_args.clear();
+        this->are_all_callbacks_typed = true;
+
+        for (Entity* const child : this->parent_of_callback_objects.child_pointer_vector)
+        {
+            const auto callback_object = static_cast<CallbackObject*>(child);
+
+            if (callback_object == nullptr)
+            {
+                continue;
+            }
+
+            if (callback_object->movable_callback == nullptr)
+            {
+                if (callback_object->callback != nullptr)
+                {
+                    // Untyped callbacks need the return value chain of `execute(const data::AnyValue&)`.
+                    this->are_all_callbacks_typed = false;
+                }
+
+                continue;
+            }
+
+            const std::size_t first_arg_i = this->thunk_args.size();
+
+            for (Entity* const callback_parameter : callback_object->parent_of_callback_parameters.child_pointer_vector)
+            {
+                if (callback_parameter != nullptr)
+                {
+                    this->thunk_args.emplace_back(&static_cast<CallbackParameter*>(callback_parameter)->get_any_value());
+                }
+            }
+
+            this->thunks.emplace_back(CallbackThunk { callback_object->movable_callback, first_arg_i, this->thunk_args.size() - first_arg_i });
+        }
+
+        this->are_thunks_compiled = true;
+    }
+
     std::size_t CallbackEngine::get_n_of_return_values() const
     {
         return this->return_values.size();
@@ -23,6 +23,7 @@
 #include "generic_parent_module.hpp"
 #include "generic_master_module.hpp"
 #include "input_parameters_and_any_value_to_any_value_callback_with_universe.hpp"
+#include "movable_and_arguments_to_void_callback.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
 
 // Include standard headers
@@ -46,6 +47,7 @@ namespace yli::ontology
     class Universe;
     class CallbackObject;
     class Scene;
+    class Movable;
     class MovableController;
     struct CallbackEngineStruct;
 
@@ -72,6 +74,13 @@ namespace yli::ontology
         // 3. If the callback has parameter[s], create a new
         //    `CallbackParameter` for each parameter, give `CallbackObject`
         //    as input parameter for the `CallbackParameter` constructor.
+        //
+        // `CallbackObject`s created with a `MovableAndArgumentsToVoidCallback`
+        // are executed by `execute(Movable&)` through a flat array of thunks,
+        // compiled on first use and recompiled after `CallbackObject`s or
+        // `CallbackParameter`s are created or destroyed. Each thunk is
+        // the callback with pointers to the values of its parameters bound,
+        // so that an execution is one indirect call per `CallbackObject`.
 
     protected:
         CallbackEngine(
@@ -88,9 +97,19 @@ namespace yli::ontology
         CallbackObject* create_callback_object(
             InputParametersAndAnyValueToAnyValueCallbackWithUniverse callback);
 
+        CallbackObject* create_movable_callback_object(
+            MovableAndArgumentsToVoidCallback movable_callback);
+
         // execute all callbacks with a parameter.
         std::optional<data::AnyValue> execute(const data::AnyValue& any_value) override;
 
+        // execute all callbacks for `movable`. Uses the compiled thunks if all
+        // `CallbackObject`s have a `MovableAndArgumentsToVoidCallback`,
+        // otherwise falls back to `execute(const data::AnyValue&)`.
+        void execute(Movable& movable);
+
+        void invalidate_thunks();
+
         std::size_t get_n_of_return_values() const;
 
         std::optional<data::AnyValue> get_nth_return_value(std::size_t n) const;
@@ -114,6 +133,24 @@ namespace yli::ontology
         template<typename T1, std::size_t DataSize>
         friend class memory::MemoryStorage;
 
+    private:
+        struct CallbackThunk
+        {
+            MovableAndArgumentsToVoidCallback movable_callback;
+            std::size_t first_arg_i;
+            std::size_t n_args;
+        };
+
+        void compile_thunks();
+
+        // The thunks are declared before the modules so that they outlive the
+        // `CallbackObject`s and `CallbackParameter`s destroyed by the modules.
+        std::vector<CallbackThunk> thunks;
+        std::vector<const data::AnyValue*> thunk_args;
+        bool are_thunks_compiled { false };
+        bool are_all_callbacks_typed { false };
+
+    public:
         ChildModule child_of_entity;
         GenericParentModule parent_of_callback_objects;
         GenericMasterModule master_of_movable_controllers;
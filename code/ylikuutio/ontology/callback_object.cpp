@@ -25,6 +25,7 @@
 #include "callback_parameter_struct.hpp"
 #include "get_number_of_descendants.hpp"
 #include "input_parameters_and_any_value_to_any_value_callback_with_universe.hpp"
+#include "movable_and_arguments_to_void_callback.hpp"
 #include "code/ylikuutio/core/application.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
 
@@ -34,6 +35,7 @@
 #include <optional> // std::optional
 #include <string>   // std::string
 #include <utility>  // std::move
+#include <vector>   // std::vector
 
 namespace yli::ontology
 {
@@ -53,6 +55,8 @@ namespace yli::ontology
     {
         // `Entity` member variables begin here.
         this->type_string = "yli::ontology::CallbackObject*";
+
+        this->invalidate_thunks_of_callback_engine();
     }
 
     CallbackObject::CallbackObject(
@@ -71,6 +75,13 @@ namespace yli::ontology
     {
         // `Entity` member variables begin here.
         this->type_string = "yli::ontology::CallbackObject*";
+
+        this->invalidate_thunks_of_callback_engine();
+    }
+
+    CallbackObject::~CallbackObject()
+    {
+        this->invalidate_thunks_of_callback_engine();
     }
 
     CallbackParameter* CallbackObject::create_callback_parameter(
@@ -127,6 +138,23 @@ namespace yli::ontology
     void CallbackObject::set_new_callback(const InputParametersAndAnyValueToAnyValueCallbackWithUniverse callback)
     {
         this->callback = callback;
+        this->movable_callback = nullptr;
+        this->invalidate_thunks_of_callback_engine();
+    }
+
+    void CallbackObject::set_new_movable_callback(const MovableAndArgumentsToVoidCallback movable_callback)
+    {
+        this->callback = nullptr;
+        this->movable_callback = movable_callback;
+        this->invalidate_thunks_of_callback_engine();
+    }
+
+    void CallbackObject::invalidate_thunks_of_callback_engine() const
+    {
+        if (CallbackEngine* const callback_engine = static_cast<CallbackEngine*>(this->get_parent()); callback_engine != nullptr)
+        {
+            callback_engine->invalidate_thunks();
+        }
     }
 
     std::optional<data::AnyValue> CallbackObject::execute(const data::AnyValue& any_value)
@@ -140,6 +168,22 @@ namespace yli::ontology
                 this->parent_of_callback_parameters, any_value);
         }
 
+        if (this->get_parent() != nullptr && this->movable_callback != nullptr && any_value.has_movable_ref())
+        {
+            // Typed callback executed through the untyped path, bind the arguments now.
+            std::vector<const data::AnyValue*> args;
+
+            for (Entity* const callback_parameter : this->parent_of_callback_parameters.child_pointer_vector)
+            {
+                if (callback_parameter != nullptr)
+                {
+                    args.emplace_back(&static_cast<CallbackParameter*>(callback_parameter)->get_any_value());
+                }
+            }
+
+            this->movable_callback(any_value.get_movable_ref(), args);
+        }
+
         return std::nullopt;
     }
 
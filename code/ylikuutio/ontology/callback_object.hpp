@@ -23,6 +23,7 @@
 #include "generic_parent_module.hpp"
 #include "callback_engine.hpp"
 #include "input_parameters_and_any_value_to_any_value_callback_with_universe.hpp"
+#include "movable_and_arguments_to_void_callback.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
 
 // Include standard headers
@@ -68,7 +69,7 @@ namespace yli::ontology
             InputParametersAndAnyValueToAnyValueCallbackWithUniverse callback,
             GenericParentModule* callback_engine_parent_module);
 
-        ~CallbackObject() override = default;
+        ~CallbackObject() override;
 
     public:
         CallbackParameter* create_callback_parameter(
@@ -78,6 +79,12 @@ namespace yli::ontology
         // this method changes the callback without changing the parameters of CallbackObject.
         void set_new_callback(const InputParametersAndAnyValueToAnyValueCallbackWithUniverse callback);
 
+        // this method replaces the callback with a typed callback, see `CallbackEngine::execute(Movable&)`.
+        void set_new_movable_callback(const MovableAndArgumentsToVoidCallback movable_callback);
+
+        // `CallbackEngine` needs to recompile its thunks when the parameters change.
+        void invalidate_thunks_of_callback_engine() const;
+
         std::optional<data::AnyValue> get_any_value(const std::string& name) const;
 
         std::optional<data::AnyValue> get_arg(std::size_t arg_i) const;
@@ -103,6 +110,7 @@ namespace yli::ontology
 
     protected:
         InputParametersAndAnyValueToAnyValueCallbackWithUniverse callback { nullptr };
+        MovableAndArgumentsToVoidCallback movable_callback                { nullptr };
 
     private:
         // execute this callback with a parameter.
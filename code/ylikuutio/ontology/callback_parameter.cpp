@@ -54,6 +54,13 @@ namespace yli::ontology
     {
         // `Entity` member variables begin here.
         this->type_string = "yli::ontology::CallbackParameter*";
+
+        this->invalidate_thunks_of_callback_engine();
+    }
+
+    CallbackParameter::~CallbackParameter()
+    {
+        this->invalidate_thunks_of_callback_engine();
     }
 
     const data::AnyValue& CallbackParameter::get_any_value() const
@@ -61,6 +68,15 @@ namespace yli::ontology
         return this->any_value;
     }
 
+    void CallbackParameter::invalidate_thunks_of_callback_engine() const
+    {
+        // The thunks of `CallbackEngine` point to the values of `CallbackParameter`s.
+        if (const CallbackObject* const callback_object = static_cast<CallbackObject*>(this->get_parent()); callback_object != nullptr)
+        {
+            callback_object->invalidate_thunks_of_callback_engine();
+        }
+    }
+
     Entity* CallbackParameter::get_parent() const
     {
         return this->child_of_callback_object.get_parent();
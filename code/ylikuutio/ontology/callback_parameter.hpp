@@ -53,7 +53,7 @@ namespace yli::ontology
             GenericParentModule* const callback_object_parent_module,
             data::AnyValue&& any_value);
 
-        ~CallbackParameter() override = default;
+        ~CallbackParameter() override;
 
     public:
         const data::AnyValue& get_any_value() const;
@@ -74,6 +74,8 @@ namespace yli::ontology
         friend class CallbackObject;
 
     private:
+        void invalidate_thunks_of_callback_engine() const;
+
         data::AnyValue any_value; // this is `private` to make sure that someone does not overwrite it.
     };
 }
@@ -105,6 +105,11 @@ namespace yli::ontology
         // Set the uniform values specific to a `Camera`.
         // This is a work in progress.
 
+        if (!this->universe.get_is_opengl_in_use())
+        {
+            return;
+        }
+
         glBindBufferBase(GL_UNIFORM_BUFFER, opengl::UboBlockIndices::CAMERA, this->camera_uniform_block);
     }
 
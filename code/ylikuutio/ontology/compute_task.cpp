@@ -438,7 +438,7 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `ComputeTask::get_scene`: `pipeline_parent` is `nullptr`!");
         }
 
-        return pipeline_parent->get_scene();
+        return pipeline_parent->get_cached_scene();
     }
 
     std::size_t ComputeTask::get_number_of_children() const
@@ -28,14 +28,17 @@
 #include "code/ylikuutio/console/text_input_type.hpp"
 #include "code/ylikuutio/console/text_input.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/lisp/legacy_executor.hpp"
+#include "code/ylikuutio/lisp/legacy_parser.hpp"
 #include "code/ylikuutio/sdl/ylikuutio_sdl.hpp"
 
 // Include standard headers
-#include <cstddef>   // std::size_t
-#include <iostream>  // std::cerr
-#include <optional>  // std::optional
-#include <string>    // std::string
-#include <vector>    // std::vector
+#include <cstddef>     // std::size_t
+#include <iostream>    // std::cout, std::cerr
+#include <optional>    // std::optional
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
 
 namespace yli::core
 {
@@ -103,16 +106,22 @@ namespace yli::ontology
           n_rows { this->console_top_y - this->console_bottom_y + 1 },
           new_input { TextInputType::NEW_INPUT },
           temp_input { TextInputType::TEMP_INPUT },
-          scrollback_buffer { this->n_columns, this->n_rows },
+          scrollback_buffer { this->n_columns, this->n_rows, console_struct.scrollback_buffer_max_n_lines },
           console_logic_module {
               this->new_input, this->temp_input, this->command_history, this->scrollback_buffer, this->n_columns,
               this->n_rows
           },
-          completion_module { *this }
+          completion_module { *this },
+          console_grid { this->n_columns, this->n_rows }
     {
         // `Entity` member variables begin here.
         this->type_string = "yli::ontology::Console*";
         this->can_be_erased = true;
+
+        if (!console_struct.history_filename.empty())
+        {
+            this->scrollback_buffer.set_history_file(console_struct.history_filename);
+        }
     }
 
     Console::~Console()
@@ -135,6 +144,28 @@ namespace yli::ontology
         // This function is to be called from console command callbacks to print text on console.
         // Please note that it is not necessary to be in console to be able to print in console.
         this->scrollback_buffer.add_to_buffer(text);
+
+        if (this->universe.get_is_headless_simulation_running())
+        {
+            // There is no screen to render the console on, print to stdout instead.
+            std::cout << text << "\n";
+        }
+    }
+
+    std::optional<data::AnyValue> Console::execute_command(const std::string& input_string)
+    {
+        // Store the input prefixed with prompt to scrollback buffer.
+        this->scrollback_buffer.add_to_buffer(this->get_prompt() + input_string);
+
+        std::vector<std::string> parameter_vector;
+        std::string command;
+
+        if (lisp::legacy_parse(input_string, command, parameter_vector))
+        {
+            return lisp::execute(*this, command, parameter_vector);
+        }
+
+        return std::nullopt;
     }
 
     void Console::print_help()
@@ -153,7 +184,7 @@ namespace yli::ontology
         this->enter_console();
     }
 
-    void Console::render(const Scene* const) const
+    void Console::render(const Scene* const)
     {
         if (!this->console_logic_module.get_active_in_console() ||
             !this->should_render ||
@@ -193,20 +224,31 @@ namespace yli::ontology
                                                           : this->n_rows);
         const std::size_t n_lines_of_scrollback_buffer_view = this->n_rows - n_lines_of_visible_input;
 
-        // Draw the console to screen using `font_2d::print_console`.
+        // Lay out the console into the character cell grid. Only changed cells are marked dirty.
         const bool is_in_scrollback_buffer = this->console_logic_module.get() & console::in_scrollback_buffer;
+
+        if (is_in_scrollback_buffer)
+        {
+            this->console_grid.set_text(
+                this->scrollback_buffer.get_view(this->scrollback_buffer.get_buffer_index(), this->n_rows),
+                std::string_view());
+        }
+        else
+        {
+            this->console_grid.set_text(
+                this->scrollback_buffer.get_view_to_last(n_lines_of_scrollback_buffer_view),
+                this->get_prompt() + this->console_logic_module.get_visible_input()->data());
+        }
+
+        // Draw the console to screen using `font_2d::print_console`.
         PrintConsoleStruct print_console_struct(
-            (is_in_scrollback_buffer
-                 ? (this->scrollback_buffer.get_view(this->scrollback_buffer.get_buffer_index(), this->n_rows))
-                 : (this->scrollback_buffer.get_view_to_last(n_lines_of_scrollback_buffer_view))),
-            (is_in_scrollback_buffer ? nullptr : this->console_logic_module.get_visible_input()),
-            this->universe.get_font_size(),
-            this->n_columns);
+            this->console_grid,
+            this->console_grid_mesh,
+            this->universe.get_font_size());
         print_console_struct.position.x = 0;
         print_console_struct.position.y = this->universe.get_window_height() - (2 * this->universe.get_text_size());
         print_console_struct.position.horizontal_alignment = LEFT;
         print_console_struct.position.vertical_alignment = TOP;
-        print_console_struct.prompt = this->get_prompt();
 
         font_2d->print_console(print_console_struct);
     }
@@ -25,10 +25,12 @@
 #include "master_of_input_modes_module.hpp"
 #include "code/ylikuutio/console/console_logic_module.hpp"
 #include "code/ylikuutio/console/completion_module.hpp"
+#include "code/ylikuutio/console/console_grid.hpp"
 #include "code/ylikuutio/console/text_input.hpp"
 #include "code/ylikuutio/console/text_input_history.hpp"
 #include "code/ylikuutio/console/scrollback_buffer.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/render/console_grid_mesh.hpp"
 #include "code/ylikuutio/sdl/ylikuutio_sdl.hpp"
 
 // Include standard headers
@@ -121,9 +123,13 @@ namespace yli::ontology
 
         void print_text(const std::string& text);
 
+        // Execute `input_string` as if it had been typed into this `Console`.
+        std::optional<data::AnyValue> execute_command(const std::string& input_string);
+
         void print_help();
 
-        void render(const Scene*) const;
+        // Only the changed cells of the console are uploaded to the GPU.
+        void render(const Scene*);
 
         bool enter_console();
 
@@ -201,6 +207,10 @@ namespace yli::ontology
         console::ScrollbackBuffer scrollback_buffer;
         console::ConsoleLogicModule console_logic_module;
         console::CompletionModule completion_module;
+
+    private:
+        console::ConsoleGrid console_grid;
+        render::ConsoleGridMesh console_grid_mesh;
     };
 
     template<>
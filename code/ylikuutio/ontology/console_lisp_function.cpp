@@ -22,11 +22,15 @@
 #include "console_lisp_function_struct.hpp"
 #include "get_number_of_descendants.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/lisp/parameter_class.hpp"
 
 // Include standard headers
-#include <cstddef> // std::size_t
+#include <array>    // std::array
+#include <cstddef>  // std::size_t
 #include <optional> // std::optional
+#include <span>     // std::span
 #include <string>   // std::string
+#include <variant>  // std::get
 #include <vector>   // std::vector
 
 namespace yli::core
@@ -87,15 +91,22 @@ namespace yli::ontology
     std::optional<data::AnyValue> ConsoleLispFunction::execute(const std::vector<std::string>& parameter_vector) const
     {
         // The execution of a `ConsoleLispFunction` proceeds as follows:
-        // The execution of `GenericConsoleLispFunctionOverload` children of
-        // this `ConsoleLispFunction` is attempted in ID order, in
-        // the order of the child pointer vector.
+        // Each parameter string is converted once, including the `Entity`
+        // lookup, and the conversion also determines its classes.
+        //
+        // Then the execution of those `GenericConsoleLispFunctionOverload`
+        // children of this `ConsoleLispFunction` whose signature matches
+        // the number and the classes of the parameters is attempted in ID
+        // order, in the order of the child pointer vector. After them, the
+        // overloads whose last parameter consumes all the remaining
+        // parameters are attempted, see `lisp::ParameterClass::REST`.
         //
         // If the variable binding succeeds, then that
         // `GenericConsoleLispFunctionOverload` is called and its return value
         // is returned.
         //
-        // If the variable binding fails, then next
+        // If the variable binding fails, e.g. because there is no `Entity`
+        // of the requested type with that name, then the next matching
         // `GenericConsoleLispFunctionOverload` in attempted etc.
         //
         // If variable binding fails for all `GenericConsoleLispFunctionOverload`s,
@@ -104,17 +115,107 @@ namespace yli::ontology
         // If there are no `GenericConsoleLispFunctionOverload`s,
         // then `std::nullopt` is returned as well.
 
-        for (const auto it : this->parent_of_generic_console_lisp_function_overloads.child_pointer_vector)
+        this->update_dispatch_table();
+
+        const std::vector<GenericConsoleLispFunctionOverload*>* const overloads =
+            (parameter_vector.size() < this->dispatch_table.size() ? &this->dispatch_table[parameter_vector.size()] : nullptr);
+
+        if ((overloads == nullptr || overloads->empty()) && this->rest_overloads.empty())
         {
-            Result result =
-                    static_cast<GenericConsoleLispFunctionOverload*>(it)->execute(parameter_vector);
+            return std::nullopt;
+        }
+
+        const std::vector<lisp::ConvertedArgument> arguments = lisp::convert_arguments(this->universe, parameter_vector);
+
+        const std::array<const std::vector<GenericConsoleLispFunctionOverload*>*, 2> candidate_lists { overloads, &this->rest_overloads };
 
-            if (result)
+        for (const std::vector<GenericConsoleLispFunctionOverload*>* const candidates : candidate_lists)
+        {
+            if (candidates == nullptr)
             {
-                return std::get<std::optional<data::AnyValue>>(result.data);
+                continue;
+            }
+
+            for (GenericConsoleLispFunctionOverload* const overload : *candidates)
+            {
+                const std::span<const lisp::ParameterClass> signature = overload->get_signature();
+
+                if (signature.size() > parameter_vector.size())
+                {
+                    continue;
+                }
+
+                bool is_match = true;
+
+                for (std::size_t i = 0; i < signature.size() && signature[i] != lisp::ParameterClass::REST && is_match; i++)
+                {
+                    is_match = (arguments[i].classes & lisp::get_parameter_class_bit(signature[i])) != 0;
+                }
+
+                if (!is_match)
+                {
+                    continue;
+                }
+
+                Result result = overload->execute(std::span<const lisp::ConvertedArgument>(arguments));
+
+                if (result)
+                {
+                    return std::get<std::optional<data::AnyValue>>(result.data);
+                }
             }
         }
 
         return std::nullopt;
     }
+
+    void ConsoleLispFunction::update_dispatch_table() const
+    {
+        const std::vector<Entity*>& overloads = this->parent_of_generic_console_lisp_function_overloads.child_pointer_vector;
+
+        bool is_up_to_date = (overloads.size() == this->dispatch_table_overloads.size());
+
+        for (std::size_t i = 0; i < overloads.size() && is_up_to_date; i++)
+        {
+            const auto overload = static_cast<const GenericConsoleLispFunctionOverload*>(overloads[i]);
+            is_up_to_date = (this->dispatch_table_overloads[i].first == overload &&
+                    (overload == nullptr || this->dispatch_table_overloads[i].second == overload->get_signature().data()));
+        }
+
+        if (is_up_to_date) [[likely]]
+        {
+            return;
+        }
+
+        this->dispatch_table.clear();
+        this->dispatch_table_overloads.clear();
+        this->rest_overloads.clear();
+
+        for (Entity* const it : overloads)
+        {
+            const auto overload = static_cast<GenericConsoleLispFunctionOverload*>(it);
+
+            if (overload == nullptr)
+            {
+                this->dispatch_table_overloads.emplace_back(nullptr, nullptr);
+                continue;
+            }
+
+            const std::span<const lisp::ParameterClass> signature = overload->get_signature();
+            this->dispatch_table_overloads.emplace_back(overload, signature.data());
+
+            if (!signature.empty() && signature.back() == lisp::ParameterClass::REST)
+            {
+                this->rest_overloads.push_back(overload);
+                continue;
+            }
+
+            if (signature.size() >= this->dispatch_table.size())
+            {
+                this->dispatch_table.resize(signature.size() + 1);
+            }
+
+            this->dispatch_table[signature.size()].push_back(overload);
+        }
+    }
 }
@@ -22,11 +22,13 @@
 #include "generic_parent_module.hpp"
 #include "lisp_function.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/lisp/parameter_class.hpp"
 
 // Include standard headers
 #include <cstddef> // std::size_t
 #include <optional> // std::optional
 #include <string>   // std::string
+#include <utility>  // std::pair
 #include <vector>   // std::vector
 
 namespace yli::core
@@ -46,6 +48,7 @@ namespace yli::ontology
     class Universe;
     class Scene;
     class Console;
+    class GenericConsoleLispFunctionOverload;
     struct ConsoleLispFunctionStruct;
 
     class ConsoleLispFunction final : public LispFunction
@@ -79,6 +82,15 @@ namespace yli::ontology
 
         ChildModule child_of_console;
         GenericParentModule parent_of_generic_console_lisp_function_overloads;
+
+    private:
+        void update_dispatch_table() const;
+
+        // Overloads grouped by the number of parameters they consume, in ID order.
+        // The table is rebuilt whenever the overloads or their signatures differ from `dispatch_table_overloads`.
+        mutable std::vector<std::vector<GenericConsoleLispFunctionOverload*>> dispatch_table;
+        mutable std::vector<GenericConsoleLispFunctionOverload*> rest_overloads; // Overloads ending in `ParameterClass::REST`.
+        mutable std::vector<std::pair<const Entity*, const lisp::ParameterClass*>> dispatch_table_overloads;
     };
 }
 
@@ -25,10 +25,12 @@
 #include "code/ylikuutio/data/any_value.hpp"
 #include "code/ylikuutio/data/wrap.hpp"
 #include "code/ylikuutio/lisp/lisp_templates.hpp"
+#include "code/ylikuutio/lisp/parameter_class.hpp"
 
 // Include standard headers
 #include <cstddef>    // std::size_t
 #include <optional>   // std::optional
+#include <span>       // std::span
 #include <stdexcept>  // std::runtime_error
 #include <string>     // std::string
 #include <tuple>      // std::apply, std::tuple, std::tuple_cat
@@ -85,6 +87,12 @@ namespace yli::ontology
         ConsoleLispFunctionOverload& operator=(const ConsoleLispFunctionOverload&) = delete; // Delete copy assignment.
 
         Result execute(const std::vector<std::string>& parameter_vector) override
+        {
+            const std::vector<lisp::ConvertedArgument> arguments = lisp::convert_arguments(this->universe, parameter_vector);
+            return this->execute(std::span<const lisp::ConvertedArgument>(arguments));
+        }
+
+        Result execute(std::span<const lisp::ConvertedArgument> arguments) override
         {
             const auto console_lisp_function_parent =
                     static_cast<ConsoleLispFunction*>(this->get_parent());
@@ -107,17 +115,17 @@ namespace yli::ontology
             // OK, all preconditions for a successful argument binding are met.
             // Now, process the arguments and call.
 
-            std::size_t parameter_i = 0; // Start from the first parameter.
+            std::size_t argument_i = 0; // Start from the first argument.
             Entity* environment = &this->universe; // `Universe` is the default environment.
 
-            std::optional<std::tuple<typename data::Wrap<Types>::type...>> arg_tuple = this->process_args<
+            std::optional<std::tuple<typename data::WrapAllButStrings<Types>::type...>> arg_tuple = this->process_args<
                 std::size_t, Types...>(
                 std::size_t {},
                 this->universe,
                 *console_parent_of_lisp_function,
                 environment,
-                parameter_vector,
-                parameter_i);
+                arguments,
+                argument_i);
 
             if (arg_tuple)
             {
@@ -127,20 +135,27 @@ namespace yli::ontology
             return Result(false);
         }
 
+        std::span<const lisp::ParameterClass> get_signature() const override
+        {
+            return ConsoleLispFunctionOverload::signature;
+        }
+
     private:
+        static constexpr auto signature = lisp::make_signature<Types...>();
+
         template<typename>
         static std::optional<std::tuple<>> process_args(
             std::size_t,
             Universe&,
             Console&,
             Entity*&,
-            const std::vector<std::string>& parameter_vector,
-            std::size_t& parameter_i)
+            std::span<const lisp::ConvertedArgument> arguments,
+            std::size_t& argument_i)
         {
             // This case ends the recursion.
             // No more arguments to bind.
 
-            if (parameter_i == parameter_vector.size())
+            if (argument_i == arguments.size())
             {
                 // All parameters were bound. Binding successful.
                 return std::tuple<>();
@@ -157,12 +172,12 @@ namespace yli::ontology
             Universe& universe,
             Console& context,
             Entity*& environment,
-            const std::vector<std::string>& parameter_vector,
-            std::size_t& parameter_i)
+            std::span<const lisp::ConvertedArgument> arguments,
+            std::size_t& argument_i)
         {
             std::optional<typename data::WrapAllButStrings<T1>::type> value =
-                    lisp::convert_string_to_value_and_advance_index<T1>(
-                        universe, context, environment, parameter_vector, parameter_i);
+                    lisp::convert_argument_to_value_and_advance_index<T1>(
+                        universe, context, environment, arguments, argument_i);
 
             if (!value.has_value())
             {
@@ -176,7 +191,7 @@ namespace yli::ontology
             std::optional<std::tuple<typename data::WrapAllButStrings<RestTypes>::type...>> arg_tuple = this->
                     process_args<
                         std::size_t, RestTypes...>(
-                        tag, universe, context, environment, parameter_vector, parameter_i);
+                        tag, universe, context, environment, arguments, argument_i);
 
             if (arg_tuple.has_value())
             {
@@ -20,9 +20,12 @@
 
 #include "lisp_context_struct.hpp"
 #include "request.hpp"
+#include "code/ylikuutio/console/scrollback_buffer.hpp"
 
 // Include standard headers
+#include <cstddef> // std::size_t
 #include <cstdint> // std::uint32_t
+#include <string>  // std::string
 
 namespace yli::ontology
 {
@@ -43,6 +46,8 @@ namespace yli::ontology
         std::uint32_t right_x;
         std::uint32_t top_y;
         std::uint32_t bottom_y;
+        std::size_t scrollback_buffer_max_n_lines { console::ScrollbackBuffer::default_max_n_lines };
+        std::string history_filename; // If not empty, all scrollback buffer lines are also appended to this file.
     };
 }
 
@@ -16,6 +16,7 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "ecosystem.hpp"
+#include "material.hpp"
 #include "ecosystem_struct.hpp"
 #include "get_number_of_descendants.hpp"
 
@@ -87,4 +88,15 @@ namespace yli::ontology
                ontology::get_number_of_descendants(this->parent_of_species.child_pointer_vector) +
                ontology::get_number_of_descendants(this->parent_of_symbioses.child_pointer_vector);
     }
+
+    void Ecosystem::animate(const double time)
+    {
+        for (Entity* const material_entity : this->parent_of_materials.child_pointer_vector)
+        {
+            if (auto* const material = static_cast<Material*>(material_entity); material != nullptr)
+            {
+                material->animate(time);
+            }
+        }
+    }
 }
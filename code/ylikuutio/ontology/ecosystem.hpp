@@ -82,6 +82,9 @@ namespace yli::ontology
         std::size_t get_number_of_children() const override;
 
         std::size_t get_number_of_descendants() const override;
+
+        // Blends the forms of the `ShapeshifterTransformation`s of the `Material`s of this `Ecosystem`.
+        void animate(double time);
     };
 
     template<>
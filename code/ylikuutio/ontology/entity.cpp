@@ -31,7 +31,6 @@
 // Include standard headers
 #include <cstddef>       // std::size_t
 #include <limits>        // std::numeric_limits
-#include <regex>         // std::regex, std::regex_match
 #include <string>        // std::string
 #include <utility>       // std::move
 
@@ -39,6 +38,34 @@ namespace yli::ontology
 {
     class Scene;
 
+    static bool is_letter(const char character)
+    {
+        return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z');
+    }
+
+    static bool is_valid_name(const std::string& name)
+    {
+        // Equivalent to matching `[a-zA-Z][a-zA-Z0-9_-]*`, without
+        // compiling a regular expression for each named `Entity`.
+
+        if (name.empty() || !is_letter(name.front()))
+        {
+            return false;
+        }
+
+        for (const char character : name)
+        {
+            const bool is_digit = (character >= '0' && character <= '9');
+
+            if (!is_letter(character) && !is_digit && character != '_' && character != '-')
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     bool Entity::operator==(const Entity& rhs) const noexcept
     {
         return this == &rhs;
@@ -60,6 +87,7 @@ namespace yli::ontology
         Universe& universe,
         const EntityStruct& entity_struct)
         : application { application },
+          registry(entity_struct.is_universe ? nullptr : &universe.registry),
           parent_of_variables(
               *this,
               this->registry,
@@ -78,12 +106,14 @@ namespace yli::ontology
         {
             this->should_render = !this->universe.get_is_headless();
 
-            VariableStruct should_render_variable_struct(this->universe, this);
-            should_render_variable_struct.local_name = "should_render";
-            should_render_variable_struct.activate_callback = &activate_should_render;
-            should_render_variable_struct.read_callback = &read_should_render;
-            should_render_variable_struct.should_call_activate_callback_now = true;
-            this->create_variable(should_render_variable_struct, yli::data::AnyValue(this->should_render));
+            if (this->application.get_generic_entity_factory().get_is_creating_in_bulk())
+            {
+                this->are_variables_deferred = true;
+            }
+            else
+            {
+                this->create_should_render_variable();
+            }
         }
     }
 
@@ -160,8 +190,14 @@ namespace yli::ontology
         return this->universe;
     }
 
+    Scene* Entity::get_cached_scene() const
+    {
+        return this->cached_scene.get(this->registry.get_universe_generation(), [this]() { return this->get_scene(); });
+    }
+
     bool Entity::has_child(const std::string& name) const
     {
+        this->create_deferred_variables();
         return this->registry.is_entity(name);
     }
 
@@ -177,6 +213,8 @@ namespace yli::ontology
             return nullptr;
         }
 
+        this->create_deferred_variables();
+
         std::size_t first_dot_pos = name.find_first_of('.');
 
         if (first_dot_pos == std::string::npos)
@@ -213,11 +251,13 @@ namespace yli::ontology
 
     std::string Entity::get_entity_names() const
     {
+        this->create_deferred_variables();
         return this->registry.get_entity_names();
     }
 
     std::string Entity::complete(const std::string& input) const
     {
+        this->create_deferred_variables();
         return this->registry.complete(input);
     }
 
@@ -233,6 +273,9 @@ namespace yli::ontology
 
     void Entity::create_variable(const VariableStruct& variable_struct, data::AnyValue&& any_value)
     {
+        // The deferred `Variable`s are created first so that their names are reserved.
+        this->create_deferred_variables();
+
         const GenericEntityFactory& entity_factory = this->application.get_generic_entity_factory();
 
         const VariableStruct new_variable_struct(this, variable_struct);
@@ -246,6 +289,7 @@ namespace yli::ontology
 
     Variable* Entity::get_variable(const std::string& variable_name) const
     {
+        this->create_deferred_variables();
         return dynamic_cast<Variable*>(this->registry.get_entity(variable_name));
     }
 
@@ -266,6 +310,35 @@ namespace yli::ontology
         return true;
     }
 
+    void Entity::create_deferred_variables() const
+    {
+        if (!this->are_variables_deferred) [[likely]]
+        {
+            return;
+        }
+
+        // The `Variable`s are a part of this `Entity` that just was not
+        // created yet, so they may be created through `const` lookups too.
+        Entity& entity = const_cast<Entity&>(*this);
+        entity.are_variables_deferred = false;
+        entity.create_variables();
+    }
+
+    void Entity::create_variables()
+    {
+        this->create_should_render_variable();
+    }
+
+    void Entity::create_should_render_variable()
+    {
+        VariableStruct should_render_variable_struct(this->universe, this);
+        should_render_variable_struct.local_name = "should_render";
+        should_render_variable_struct.activate_callback = &activate_should_render;
+        should_render_variable_struct.read_callback = &read_should_render;
+        should_render_variable_struct.should_call_activate_callback_now = true;
+        this->create_variable(should_render_variable_struct, yli::data::AnyValue(this->should_render));
+    }
+
     std::string Entity::help() const
     {
         std::string help_string = "TODO: create general helptext";
@@ -291,18 +364,24 @@ namespace yli::ontology
 
     std::size_t Entity::get_number_of_all_children() const
     {
+        this->create_deferred_variables();
+
         return this->parent_of_variables.get_number_of_children() +
                this->get_number_of_non_variable_children();
     }
 
     std::size_t Entity::get_number_of_all_descendants() const
     {
+        this->create_deferred_variables();
+
         return ontology::get_number_of_descendants(this->parent_of_variables.child_pointer_vector) +
                this->get_number_of_descendants();
     }
 
     std::size_t Entity::get_number_of_variables() const
     {
+        this->create_deferred_variables();
+
         return this->parent_of_variables.get_number_of_children();
     }
 
@@ -326,7 +405,7 @@ namespace yli::ontology
             return;
         }
 
-        if (!std::regex_match(global_name, std::regex("[a-zA-Z][a-zA-Z0-9_-]*")))
+        if (!is_valid_name(global_name))
         {
             return;
         }
@@ -360,7 +439,7 @@ namespace yli::ontology
             return;
         }
 
-        if (!std::regex_match(local_name, std::regex("[a-zA-Z][a-zA-Z0-9_-]*")))
+        if (!is_valid_name(local_name))
         {
             return;
         }
@@ -20,6 +20,7 @@
 
 #include "registry.hpp"
 #include "generic_parent_module.hpp"
+#include "cached_ancestor.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
 #include "code/ylikuutio/memory/constructible_module.hpp"
 
@@ -100,6 +101,9 @@ namespace yli::ontology
         // E.g. `Universe` may have many `Scene`s, but is descendant of none.
         virtual Scene* get_scene() const = 0;
 
+        // Returns `get_scene()`, resolved again only after the hierarchy has changed.
+        Scene* get_cached_scene() const;
+
         virtual Entity* get_parent() const = 0;
 
         std::size_t get_number_of_all_children() const;
@@ -138,6 +142,11 @@ namespace yli::ontology
 
         bool set_variable(const std::string& variable_name, const data::AnyValue& variable_new_any_value) const;
 
+        // `Entity`s created in bulk create their `Variable`s only on first use.
+        // The lookups of this class do that, other users of `registry` or
+        // `parent_of_variables` call this first. No-op if nothing is deferred.
+        void create_deferred_variables() const;
+
         virtual std::string help() const; // this function returns general help string.
         virtual std::string help_for_variable(const std::string& variable_name) const;
 
@@ -181,13 +190,22 @@ namespace yli::ontology
         template<typename T1, std::size_t DataSize>
         friend class memory::MemoryStorage;
 
+    protected:
+        // Creates the `Variable`s whose creation was deferred.
+        // `override`s must call the base class version too.
+        virtual void create_variables();
+
     private:
+        void create_should_render_variable();
+
         memory::ConstructibleModule constructible_module;
 
         core::Application& application;
 
         std::size_t childID { std::numeric_limits<std::size_t>::max() };
 
+        CachedAncestor<Scene> cached_scene;
+
     public:
         // Named entities are stored here so that they can be recalled, if needed.
         Registry registry;
@@ -204,6 +222,7 @@ namespace yli::ontology
         std::string local_name; // local name of this `Entity`.
 
         bool can_be_erased { false };
+        bool are_variables_deferred { false };
         const bool is_universe;
 
     public:
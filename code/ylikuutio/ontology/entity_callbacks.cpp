@@ -47,6 +47,7 @@ namespace yli::ontology
         const Entity& entity)
     {
         // OK, let's print the children of this `Entity`.
+        entity.create_deferred_variables();
         map::print_keys_to_console(entity.registry.get_entity_map(), console);
 
         return std::nullopt;
@@ -71,6 +72,7 @@ namespace yli::ontology
     {
         // Print the variable names of the `Entity`.
 
+        entity.create_deferred_variables();
         yli::map::print_keys_of_specific_type_to_console<Entity*, Variable*>(entity.registry.get_entity_map(), console);
 
         return std::nullopt;
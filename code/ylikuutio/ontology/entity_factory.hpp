@@ -108,13 +108,17 @@
 #include "code/ylikuutio/memory/memory_allocator_types.hpp"
 
 // Include standard headers
-#include <concepts>  // std::derived_from, std::same_as
-#include <iostream>  // std::cerr
-#include <optional>  // std::optional
-#include <stdexcept> // std::runtime_error
-#include <string>    // std::string
-#include <utility>   // std::forward, std::move
-#include <variant>   // std::holds_alternative, std::variant, std::visit
+#include <concepts>      // std::derived_from, std::same_as
+#include <cstddef>       // std::size_t
+#include <iostream>      // std::cerr
+#include <optional>      // std::optional
+#include <span>          // std::span
+#include <stdexcept>     // std::runtime_error
+#include <string>        // std::string
+#include <unordered_map> // std::unordered_map
+#include <utility>       // std::forward, std::move
+#include <variant>       // std::holds_alternative, std::variant, std::visit
+#include <vector>        // std::vector
 
 namespace yli::core
 {
@@ -453,6 +457,15 @@ namespace yli::ontology
                 object_struct);
         }
 
+        std::vector<Object*> create_objects(const std::span<const ObjectStruct> object_structs) const final
+        {
+            return this->create_in_bulk<Object, Scene, memory::ObjectMemoryAllocator>(
+                TypeEnumType::OBJECT,
+                object_structs,
+                [](const ObjectStruct& object_struct) -> const Request<Scene>& { return object_struct.scene; },
+                [this](const ObjectStruct& object_struct) { return this->create_object(object_struct); });
+        }
+
         // TODO: implement `create_heightmap` here!
 
         // TODO: implement `create_heightmap_sheet` here!
@@ -512,6 +525,18 @@ namespace yli::ontology
                 holobiont_struct);
         }
 
+        std::vector<Holobiont*> create_holobionts(const std::span<const HolobiontStruct> holobiont_structs) const final
+        {
+            return this->create_in_bulk<Holobiont, Scene, memory::HolobiontMemoryAllocator>(
+                TypeEnumType::HOLOBIONT,
+                holobiont_structs,
+                [](const HolobiontStruct& holobiont_struct) -> const Request<Scene>&
+                {
+                    return holobiont_struct.scene;
+                },
+                [this](const HolobiontStruct& holobiont_struct) { return this->create_holobiont(holobiont_struct); });
+        }
+
         Biont* create_biont(const BiontStruct& biont_struct) const final
         {
             memory::GenericMemoryAllocator& generic_allocator =
@@ -527,6 +552,18 @@ namespace yli::ontology
                 this->get_generic_master_module<Biont, SymbiontSpecies>(biont_struct.symbiont_species_master));
         }
 
+        std::vector<Biont*> create_bionts(const std::span<const BiontStruct> biont_structs) const final
+        {
+            return this->create_in_bulk<Biont, Holobiont, memory::BiontMemoryAllocator>(
+                TypeEnumType::BIONT,
+                biont_structs,
+                [](const BiontStruct& biont_struct) -> const Request<Holobiont>&
+                {
+                    return biont_struct.holobiont_parent;
+                },
+                [this](const BiontStruct& biont_struct) { return this->create_biont(biont_struct); });
+        }
+
         Skill* create_skill(const SkillStruct& skill_struct) const final
         {
             memory::GenericMemoryAllocator& generic_allocator =
@@ -635,8 +672,7 @@ namespace yli::ontology
                 TypeEnumType::GLYPH_OBJECT,
                 glyph_object_struct.scene_parent,
                 glyph_object_struct,
-                this->get_generic_master_module<GlyphObject, Glyph>(glyph_object_struct.glyph_master),
-                this->get_generic_master_module<GlyphObject, Text3d>(glyph_object_struct.text_3d_master));
+                this->get_generic_master_module<GlyphObject, Glyph>(glyph_object_struct.glyph_master));
         }
 
         Text3d* create_text_3d(const Text3dStruct& text_3d_struct) const final
@@ -733,6 +769,11 @@ namespace yli::ontology
                 compute_task_struct);
         }
 
+        bool get_is_creating_in_bulk() const final
+        {
+            return this->bulk_creation_depth > 0;
+        }
+
         ConsoleLispFunction* create_console_lisp_function(
             const ConsoleLispFunctionStruct& console_lisp_function_struct) const final
         {
@@ -982,6 +1023,94 @@ namespace yli::ontology
             return instance;
         }
 
+        template<EntityNotUniverse T, EntityNotUniverse ParentType, typename TypeAllocator, typename DataStruct,
+            typename GetParentRequest, typename CreateFunction>
+        std::vector<T*> create_in_bulk(
+            const TypeEnumType type,
+            const std::span<const DataStruct> data_structs,
+            const GetParentRequest& get_parent_request,
+            const CreateFunction& create) const
+        {
+            memory::GenericMemoryAllocator& generic_allocator =
+                    this->memory_system.template get_or_create_allocator<TypeAllocator>(type);
+            static_cast<TypeAllocator&>(generic_allocator).reserve(data_structs.size());
+
+            Registry& universe_registry = this->get_universe().registry;
+
+            // Count the children of each parent to reserve their child slots.
+            std::unordered_map<ParentType*, std::size_t> parent_to_n_children;
+
+            for (const DataStruct& data_struct : data_structs)
+            {
+                ParentType* const parent =
+                        resolve_request<ParentType>(get_parent_request(data_struct), universe_registry);
+
+                if (parent != nullptr)
+                {
+                    parent_to_n_children[parent]++;
+                }
+            }
+
+            for (const auto& [parent, n_children] : parent_to_n_children)
+            {
+                parent->template get_generic_parent_module<T>()->reserve(n_children);
+            }
+
+            // Ends the bulk creation also if `create` throws, so that the
+            // registries do not stay batched and completions get flushed.
+            struct BulkCreationGuard
+            {
+                BulkCreationGuard(
+                        std::size_t& bulk_creation_depth,
+                        Registry& universe_registry,
+                        const std::unordered_map<ParentType*, std::size_t>& parent_to_n_children)
+                    : bulk_creation_depth { bulk_creation_depth },
+                    universe_registry { universe_registry },
+                    parent_to_n_children { parent_to_n_children }
+                {
+                    this->universe_registry.begin_batch();
+
+                    for (const auto& [parent, n_children] : this->parent_to_n_children)
+                    {
+                        parent->registry.begin_batch();
+                    }
+
+                    this->bulk_creation_depth++;
+                }
+
+                ~BulkCreationGuard()
+                {
+                    this->bulk_creation_depth--;
+
+                    for (const auto& [parent, n_children] : this->parent_to_n_children)
+                    {
+                        parent->registry.end_batch();
+                    }
+
+                    this->universe_registry.end_batch();
+                }
+
+                BulkCreationGuard(const BulkCreationGuard&) = delete;            // Delete copy constructor.
+                BulkCreationGuard& operator=(const BulkCreationGuard&) = delete; // Delete copy assignment.
+
+                std::size_t& bulk_creation_depth;
+                Registry& universe_registry;
+                const std::unordered_map<ParentType*, std::size_t>& parent_to_n_children;
+            };
+
+            const BulkCreationGuard bulk_creation_guard(this->bulk_creation_depth, universe_registry, parent_to_n_children);
+
+            std::vector<T*> instances;
+            instances.reserve(data_structs.size());
+
+            for (const DataStruct& data_struct : data_structs)
+            {
+                instances.emplace_back(create(data_struct));
+            }
+
+            return instances;
+        }
+
         template<ObjectOrObjectDerivative T, typename ObjectDerivativeMemoryAllocator, typename... ModuleArgs>
         T* create_object_or_object_derivative(TypeEnumType object_derivative_type, const ObjectStruct& object_struct,
                                               ModuleArgs&&... module_args) const
@@ -1003,6 +1132,7 @@ namespace yli::ontology
         core::Application& application;
         memory::MemorySystem<TypeEnumType>& memory_system;
         Universe* universe { nullptr };
+        mutable std::size_t bulk_creation_depth { 0 };
     };
 }
 
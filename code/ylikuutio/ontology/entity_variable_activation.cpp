@@ -22,7 +22,6 @@
 
 // Include standard headers
 #include <optional> // std::optional
-#include <variant>  // std::holds_alternative
 
 namespace yli::ontology
 {
@@ -32,9 +31,9 @@ namespace yli::ontology
     {
         const data::AnyValue& should_render_any_value = variable.variable_value;
 
-        if (std::holds_alternative<bool>(should_render_any_value.data))
+        if (should_render_any_value.holds<bool>())
         {
-            entity.should_render = std::get<bool>(should_render_any_value.data);
+            entity.should_render = should_render_any_value.get<bool>();
         }
 
         return std::nullopt;
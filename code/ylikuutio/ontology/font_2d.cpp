@@ -29,6 +29,7 @@
 #include "code/ylikuutio/load/shader_loader.hpp"
 #include "code/ylikuutio/opengl/opengl.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+#include "code/ylikuutio/render/console_grid_mesh.hpp"
 #include "code/ylikuutio/render/render_system.hpp"
 #include "code/ylikuutio/render/render_text.hpp"
 
@@ -48,7 +49,6 @@
 #include <cstddef>   // std::size_t
 #include <cstdint>   // std::uint32_t
 #include <iostream>  // std::cout, std::cerr
-#include <span>      // std::span
 #include <stdexcept> // std::runtime_error
 #include <string>    // std::string
 #include <utility>   // std::pair
@@ -372,82 +372,25 @@ namespace yli::ontology
 
     void Font2d::print_console(const PrintConsoleStruct& print_console_struct) const
     {
-        if (!this->should_render)
+        if (!this->should_render || !this->universe.get_is_opengl_in_use())
         {
             return;
         }
 
         this->prepare_to_print();
 
-        std::uint32_t current_left_x = print_console_struct.position.x;
-        std::uint32_t current_top_y = print_console_struct.position.y;
-
-        // Fill buffers.
-        std::vector<glm::vec2> vertices;
-        std::vector<glm::vec2> uvs;
-
-        const std::span<const std::string> view = print_console_struct.buffer_text;
-
-        // Print to the right side of X (so far there is no check for input length).
-        // Print up of Y.
-
-        for (auto span_it = view.begin(); span_it != view.end(); ++span_it)
-        {
-            for (auto text_line_it = span_it->cbegin(); text_line_it != span_it->cend(); ++text_line_it)
-            {
-                const char character = *text_line_it;
-
-                this->compute_and_store_glyph_vertices(vertices, current_left_x, current_top_y);
-                current_left_x += this->text_size;
-
-                const float uv_x = (character % print_console_struct.font_size) /
-                                   static_cast<float>(print_console_struct.font_size);
-                const float uv_y = (character / print_console_struct.font_size) /
-                                   static_cast<float>(print_console_struct.font_size);
-
-                const auto uv_up_left = glm::vec2(uv_x, uv_y);
-                const auto uv_up_right = glm::vec2(uv_x + (1.0f / static_cast<float>(print_console_struct.font_size)),
-                                                   uv_y);
-                const auto uv_down_right = glm::vec2(uv_x + (1.0f / static_cast<float>(print_console_struct.font_size)),
-                                                     (uv_y + 1.0f / static_cast<float>(print_console_struct.
-                                                          font_size)));
-                const auto uv_down_left = glm::vec2(
-                    uv_x, (uv_y + 1.0f / static_cast<float>(print_console_struct.font_size)));
-
-                uvs.emplace_back(uv_up_left);
-                uvs.emplace_back(uv_down_left);
-                uvs.emplace_back(uv_up_right);
-
-                uvs.emplace_back(uv_down_right);
-                uvs.emplace_back(uv_up_right);
-                uvs.emplace_back(uv_down_left);
-            }
-
-            // Jump to the beginning of the next line.
-            current_left_x = print_console_struct.position.x;
-            current_top_y -= text_size;
-        }
-
-        render::render_text(
-            vertices,
-            uvs,
-            this->vao,
-            this->vertex_buffer,
-            this->uv_buffer,
+        // Only the cells that have changed since the previous frame are uploaded,
+        // and the whole console is drawn with one draw call.
+        const render::ConsoleGridLayout layout {
+            static_cast<std::uint32_t>(print_console_struct.position.x),
+            static_cast<std::uint32_t>(print_console_struct.position.y),
+            this->text_size,
+            print_console_struct.font_size };
+
+        print_console_struct.console_grid_mesh.render(
+            print_console_struct.console_grid,
+            layout,
             this->vertex_position_in_screenspace_id,
             this->vertex_uv_id);
-
-        if (print_console_struct.text_input != nullptr)
-        {
-            PrintTextStruct print_text_struct {
-                print_console_struct.font_size, this->universe.get_window_width() / this->text_size
-            };
-            print_text_struct.position.x = current_left_x;
-            print_text_struct.position.y = current_top_y;
-            print_text_struct.position.horizontal_alignment = LEFT;
-            print_text_struct.position.vertical_alignment = TOP;
-            print_text_struct.text = print_console_struct.prompt + print_console_struct.text_input->data();
-            this->print_text_2d(print_text_struct);
-        }
     }
 }
@@ -70,6 +70,6 @@ namespace yli::ontology
                 "ERROR: `GenericConsoleLispFunctionOverload::get_scene`: `console_lisp_function_parent` is `nullptr`!");
         }
 
-        return console_lisp_function_parent->get_scene();
+        return console_lisp_function_parent->get_cached_scene();
     }
 }
@@ -20,9 +20,12 @@
 
 #include "generic_lisp_function_overload.hpp"
 #include "child_module.hpp"
+#include "result.hpp"
+#include "code/ylikuutio/lisp/parameter_class.hpp"
 
 // Include standard headers
 #include <cstddef> // std::size_t
+#include <span>    // std::span
 
 namespace yli::core
 {
@@ -70,6 +73,16 @@ namespace yli::ontology
 
         Scene* get_scene() const override;
 
+        using GenericLispFunctionOverload::execute;
+
+        // Execute with arguments already converted by `lisp::convert_arguments`,
+        // so that `ConsoleLispFunction` converts each argument only once.
+        virtual Result execute(std::span<const lisp::ConvertedArgument> arguments) = 0;
+
+        // The classes of the parameters consumed from the parameter vector, in order.
+        // `ConsoleLispFunction` uses this to skip overloads that can not bind the arguments.
+        virtual std::span<const lisp::ParameterClass> get_signature() const = 0;
+
         ChildModule child_of_console_lisp_function;
     };
 }
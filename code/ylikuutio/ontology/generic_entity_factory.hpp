@@ -20,6 +20,10 @@
 
 #include "input_parameters_and_any_value_to_any_value_callback_with_universe.hpp"
 
+// Include standard headers
+#include <span>   // std::span
+#include <vector> // std::vector
+
 namespace yli::data
 {
         class AnyValue;
@@ -144,6 +148,11 @@ namespace yli::ontology
 
                 virtual Object* create_object(const ObjectStruct& object_struct) const = 0;
 
+                // Bulk creation: the memory and the child slots are reserved up front,
+                // the names are added to the completions once at the end, and
+                // the `Variable`s of the new `Entity`s are created on first use.
+                virtual std::vector<Object*> create_objects(std::span<const ObjectStruct> object_structs) const = 0;
+
                 virtual Symbiosis* create_symbiosis(const SymbiosisStruct& symbiosis_struct) const = 0;
 
                 virtual SymbiontMaterial* create_symbiont_material(
@@ -156,8 +165,13 @@ namespace yli::ontology
 
                 virtual Holobiont* create_holobiont(const HolobiontStruct& holobiont_struct) const = 0;
 
+                virtual std::vector<Holobiont*> create_holobionts(
+                        std::span<const HolobiontStruct> holobiont_structs) const = 0;
+
                 virtual Biont* create_biont(const BiontStruct& biont_struct) const = 0;
 
+                virtual std::vector<Biont*> create_bionts(std::span<const BiontStruct> biont_structs) const = 0;
+
                 virtual Skill* create_skill(const SkillStruct& skill_struct) const = 0;
 
                 virtual ShapeshifterTransformation* create_shapeshifter_transformation(
@@ -204,6 +218,9 @@ namespace yli::ontology
                         const ConsoleLispFunctionStruct& console_lisp_function_struct) const = 0;
 
                 virtual ComputeTask* create_compute_task(const ComputeTaskStruct& compute_task_struct) const = 0;
+
+                // `true` during the bulk creation functions above.
+                virtual bool get_is_creating_in_bulk() const = 0;
         };
 }
 
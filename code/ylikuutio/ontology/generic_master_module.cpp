@@ -40,6 +40,8 @@ namespace yli::ontology
                 this->apprentice_module_pointer_vector,
                 this->free_apprenticeID_queue,
                 this->number_of_apprentices);
+
+        this->generic_master.registry.advance_universe_generation();
     }
 
     void GenericMasterModule::unbind_apprentice_module(const std::size_t apprenticeID) noexcept
@@ -71,6 +73,7 @@ namespace yli::ontology
                 this->number_of_apprentices);
 
         apprentice_module->release();
+        this->generic_master.registry.advance_universe_generation();
     }
 
     void GenericMasterModule::unbind_all_apprentice_modules_belonging_to_other_scenes(const Scene* const scene) noexcept
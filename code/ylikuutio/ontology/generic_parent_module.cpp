@@ -41,6 +41,8 @@ namespace yli::ontology
                 this->free_childID_queue,
                 this->number_of_children,
                 this->entity.registry);
+
+        this->entity.registry.advance_universe_generation();
     }
 
     void GenericParentModule::unbind_child(const std::size_t childID) noexcept
@@ -75,6 +77,7 @@ namespace yli::ontology
                 this->entity.registry);
 
         child->release();
+        this->entity.registry.advance_universe_generation();
     }
 
     GenericParentModule::GenericParentModule(
@@ -132,7 +135,7 @@ namespace yli::ontology
 
     Scene* GenericParentModule::get_scene() const noexcept
     {
-        return this->entity.get_scene();
+        return this->entity.get_cached_scene();
     }
 
     Entity* GenericParentModule::get(const std::size_t index) const noexcept
@@ -144,4 +147,15 @@ namespace yli::ontology
 
         return nullptr;
     }
+
+    void GenericParentModule::reserve(const std::size_t n_children)
+    {
+        // Freed childIDs are reused before the vector grows.
+        const std::size_t n_free_childIDs = this->free_childID_queue.size();
+
+        if (n_children > n_free_childIDs)
+        {
+            this->child_pointer_vector.reserve(this->child_pointer_vector.size() + n_children - n_free_childIDs);
+        }
+    }
 }
@@ -64,6 +64,9 @@ namespace yli::ontology
 
             Entity* get(std::size_t index) const noexcept override;
 
+            // Make room for `n_children` more children without reallocations.
+            void reserve(std::size_t n_children);
+
             // Iterator functions.
             iterator begin()
             {
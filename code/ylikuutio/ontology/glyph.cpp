@@ -52,16 +52,10 @@ namespace yli::ontology
           mesh(universe, glyph_struct, this->get_pipeline()),
           glyph_vertex_data { glyph_struct.glyph_vertex_data },
           glyph_name_pointer { glyph_struct.glyph_name_pointer },
-          unicode_char_pointer { glyph_struct.unicode_char_pointer }
+          unicode_char_pointer { glyph_struct.unicode_char_pointer },
+          advance_width { glyph_struct.advance_width }
     {
-        // If software rendering is in use, the vertices and UVs can not be loaded into GPU memory,
-        // but they can still be loaded into CPU memory to be used by the software rendering.
-        const bool should_load_texture =
-                this->universe.get_is_opengl_in_use() ||
-                this->universe.get_is_vulkan_in_use() ||
-                this->universe.get_is_software_rendering_in_use();
-
-        // FIXME: implement mesh loading!
+        // The mesh is the triangulated outline of the glyph, provided by `VectorFont` in `glyph_struct`.
 
         // `Entity` member variables begin here.
         this->type_string = "yli::ontology::Glyph*";
@@ -81,7 +75,7 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `Glyph::get_scene`: `vector_font_parent` is `nullptr`!");
         }
 
-        return vector_font_parent->get_scene();
+        return vector_font_parent->get_cached_scene();
     }
 
     Pipeline* Glyph::get_pipeline() const
@@ -114,7 +108,7 @@ namespace yli::ontology
             return;
         }
 
-        Scene* const scene = this->get_scene();
+        Scene* const scene = this->get_cached_scene();
 
         if (target_scene != nullptr && scene != nullptr && scene != target_scene)
         {
@@ -138,4 +132,9 @@ namespace yli::ontology
     {
         return this->unicode_char_pointer;
     }
+
+    float Glyph::get_advance_width() const
+    {
+        return this->advance_width;
+    }
 }
@@ -73,6 +73,9 @@ namespace yli::ontology
 
         const char* get_unicode_char_pointer() const;
 
+        // Horizontal advance to the next character, from the horizontal advance metric of the font.
+        float get_advance_width() const;
+
         friend class VectorFont;
 
     private:
@@ -110,6 +113,7 @@ namespace yli::ontology
         std::vector<std::vector<glm::vec2>>* glyph_vertex_data { nullptr };
         const char* glyph_name_pointer { nullptr };
         const char* unicode_char_pointer { nullptr };
+        float advance_width { 1.0f };
     };
 
     template<>
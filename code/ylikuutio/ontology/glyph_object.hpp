@@ -47,8 +47,7 @@ namespace yli::ontology
             Universe& universe,
             const GlyphObjectStruct& glyph_object_struct,
             GenericParentModule* scene_parent_module,
-            GenericMasterModule* glyph_master_module,
-            GenericMasterModule* text_3d_master_module);
+            GenericMasterModule* glyph_master_module);
 
         GlyphObject(const GlyphObject&) = delete; // Delete copy constructor.
         GlyphObject& operator=(const GlyphObject&) = delete; // Delete copy assignment.
@@ -65,7 +64,6 @@ namespace yli::ontology
 
         ChildModule child_of_scene;
         ApprenticeModule apprentice_of_glyph;
-        ApprenticeModule apprentice_of_text_3d;
     };
 }
 
@@ -28,23 +28,19 @@ namespace yli::ontology
 {
     class Scene;
     class Glyph;
-    class Text3d;
 
     struct GlyphObjectStruct final : MovableStruct
     {
         GlyphObjectStruct(
                 Request<Scene>&& scene_parent,
-                Request<Glyph>&& glyph_master,
-                Request<Text3d>&& text_3d_master)
+                Request<Glyph>&& glyph_master)
             : MovableStruct(std::move(scene_parent)),
-            glyph_master { std::move(glyph_master) },
-            text_3d_master { std::move(text_3d_master) }
+            glyph_master { std::move(glyph_master) }
         {
         }
 
-        Request<Scene> scene_parent    {};
-        Request<Glyph> glyph_master    {};
-        Request<Text3d> text_3d_master {};
+        Request<Scene> scene_parent {};
+        Request<Glyph> glyph_master {};
     };
 }
 
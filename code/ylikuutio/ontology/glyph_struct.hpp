@@ -45,6 +45,7 @@ namespace yli::ontology
         std::vector<std::vector<glm::vec2>>* glyph_vertex_data { nullptr }; // For `Glyph`s.
         const char* glyph_name_pointer         { nullptr }; // We need only a pointer, because `Glyph`s are always created by the `VectorFont` constructor.
         const char* unicode_char_pointer       { nullptr }; // We need only a pointer, because `Glyph`s are always created by the `VectorFont` constructor.
+        float advance_width                    { 1.0f };    // The `horiz-adv-x` of the glyph in the font.
     };
 }
 
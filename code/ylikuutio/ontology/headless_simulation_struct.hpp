@@ -0,0 +1,41 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_ONTOLOGY_HEADLESS_SIMULATION_STRUCT_HPP_INCLUDED
+#define YLIKUUTIO_ONTOLOGY_HEADLESS_SIMULATION_STRUCT_HPP_INCLUDED
+
+// Include standard headers
+#include <cstdint> // std::uint32_t, std::uint64_t
+
+namespace yli::console
+{
+    class RemoteConsole;
+}
+
+namespace yli::ontology
+{
+    struct HeadlessSimulationStruct
+    {
+        std::uint64_t n_ticks { 0 };                         // 0 means run until exit is requested.
+        float ticks_per_second { 60.0f };                    // 0.0 means uncapped.
+        bool should_read_console_from_stdin { false };       // Execute lines read from stdin in the active `Console`.
+        console::RemoteConsole* remote_console { nullptr };  // Execute commands received from it in the active `Console`.
+        std::uint32_t metrics_interval_in_ticks { 60 };      // How often to send metrics to `remote_console`, 0 means never.
+    };
+}
+
+#endif
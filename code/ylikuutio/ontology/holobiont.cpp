@@ -32,6 +32,22 @@
 #include "code/ylikuutio/data/any_value.hpp"
 #include "code/ylikuutio/render/render_system.hpp"
 
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+#ifndef __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#define __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#include <glm/gtc/matrix_transform.hpp>
+#endif
+
+#ifndef __GLM_GTC_QUATERNION_HPP_INCLUDED
+#define __GLM_GTC_QUATERNION_HPP_INCLUDED
+#include <glm/gtc/quaternion.hpp> // glm::quat
+#endif
+
 // Include standard headers
 #include <cstdint>   // std::uintptr_t
 #include <cstddef>   // std::size_t
@@ -73,11 +89,24 @@ namespace yli::ontology
               "skills"),
           apprentice_of_symbiosis(symbiosis_master_module, this)
     {
+        if (Scene* const scene = this->get_scene(); scene != nullptr)
+        {
+            scene->add_to_spatial_index(*this);
+        }
+
         // `Entity` member variables begin here.
         this->type_string = "yli::ontology::Holobiont*";
         this->can_be_erased = true;
     }
 
+    Holobiont::~Holobiont()
+    {
+        if (Scene* const scene = this->get_scene(); scene != nullptr)
+        {
+            scene->remove_from_spatial_index(*this);
+        }
+    }
+
     Entity* Holobiont::get_parent() const
     {
         return this->child_of_scene.get_parent();
@@ -90,14 +119,14 @@ namespace yli::ontology
             return;
         }
 
-        if (const Scene* const scene = this->get_scene();
+        if (const Scene* const scene = this->get_cached_scene();
             target_scene != nullptr && scene != nullptr && scene != target_scene)
         {
             // Different `Scene`s, do not render.
             return;
         }
 
-        render::RenderSystem& render_system = this->universe.get_render_system();
+        this->update_model_matrix();
 
         // Every `Biont` is a child of a `Holobiont`, so they reside in the same `Scene`.
         render::RenderSystem::render_bionts(this->parent_of_bionts);
@@ -183,45 +212,47 @@ namespace yli::ontology
     {
         this->location.set_x(x);
         this->model_matrix[3][0] = x;
-
-        for (Entity* const biont_entity : this->parent_of_bionts.child_pointer_vector)
-        {
-            if (auto* const biont = static_cast<Biont*>(biont_entity); biont != nullptr)
-            {
-                biont->location.set_x(x);
-                biont->model_matrix[3][0] = x;
-            }
-        }
     }
 
     void Holobiont::update_y(const float y)
     {
         this->location.set_y(y);
         this->model_matrix[3][1] = y;
-
-        for (Entity* const biont_entity : this->parent_of_bionts.child_pointer_vector)
-        {
-            if (auto* const biont = static_cast<Biont*>(biont_entity); biont != nullptr)
-            {
-                biont->location.set_y(y);
-                biont->model_matrix[3][1] = y;
-            }
-        }
     }
 
     void Holobiont::update_z(const float z)
     {
         this->location.set_z(z);
         this->model_matrix[3][2] = z;
+    }
 
-        for (Entity* const biont_entity : this->parent_of_bionts.child_pointer_vector)
+    void Holobiont::update_model_matrix()
+    {
+        this->model_matrix = glm::mat4(1.0f);
+
+        if (this->initial_rotate_vectors.size() == this->initial_rotate_angles.size()) [[likely]]
         {
-            if (auto* const biont = static_cast<Biont*>(biont_entity); biont != nullptr)
+            for (std::size_t i = 0; i < this->initial_rotate_vectors.size() && i < this->initial_rotate_angles.size();
+                 i++)
             {
-                biont->location.set_z(z);
-                biont->model_matrix[3][2] = z;
+                this->model_matrix = glm::rotate(this->model_matrix, this->initial_rotate_angles[i],
+                                                 this->initial_rotate_vectors[i]);
             }
         }
+
+        this->model_matrix = glm::scale(this->model_matrix, this->scale * this->original_scale_vector);
+        const glm::vec3 euler_angles { this->orientation.roll, -this->orientation.pitch, this->orientation.yaw };
+        const auto my_quaternion = glm::quat(euler_angles);
+        const glm::mat4 rotation_matrix = glm::mat4_cast(my_quaternion);
+        this->model_matrix = rotation_matrix * this->model_matrix;
+        this->model_matrix[3][0] = this->location.get_x();
+        this->model_matrix[3][1] = this->location.get_y();
+        this->model_matrix[3][2] = this->location.get_z();
+    }
+
+    const glm::mat4& Holobiont::get_model_matrix() const
+    {
+        return this->model_matrix;
     }
 
     Scene* Holobiont::get_scene() const
@@ -294,54 +325,54 @@ namespace yli::ontology
         data::AnyValue yaw_any_value("float", yaw);
         data::AnyValue pitch_any_value("float", pitch);
 
-        if (!std::holds_alternative<float>(x_any_value.data))
+        if (!x_any_value.holds<float>())
         {
             std::cerr <<
                     "ERROR: `Holobiont::create_holobiont_with_parent_name_x_y_z_yaw_pitch`: invalid value for `x`!\n";
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<float>(y_any_value.data))
+        if (!y_any_value.holds<float>())
         {
             std::cerr <<
                     "ERROR: `Holobiont::create_holobiont_with_parent_name_x_y_z_yaw_pitch`: invalid value for `y`!\n";
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<float>(z_any_value.data))
+        if (!z_any_value.holds<float>())
         {
             std::cerr <<
                     "ERROR: `Holobiont::create_holobiont_with_parent_name_x_y_z_yaw_pitch`: invalid value for `z`!\n";
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<float>(roll_any_value.data))
+        if (!roll_any_value.holds<float>())
         {
             std::cerr <<
                     "ERROR: `Holobiont::create_holobiont_with_parent_name_x_y_z_roll_pitch`: invalid value for `roll`!\n";
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<float>(yaw_any_value.data))
+        if (!yaw_any_value.holds<float>())
         {
             std::cerr <<
                     "ERROR: `Holobiont::create_holobiont_with_parent_name_x_y_z_yaw_pitch`: invalid value for `yaw`!\n";
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<float>(pitch_any_value.data))
+        if (!pitch_any_value.holds<float>())
         {
             std::cerr <<
                     "ERROR: `Holobiont::create_holobiont_with_parent_name_x_y_z_yaw_pitch`: invalid value for `pitch`!\n";
             return std::nullopt;
         }
 
-        const float float_x = std::get<float>(x_any_value.data);
-        const float float_y = std::get<float>(y_any_value.data);
-        const float float_z = std::get<float>(z_any_value.data);
-        const float float_roll = std::get<float>(roll_any_value.data);
-        const float float_yaw = std::get<float>(yaw_any_value.data);
-        const float float_pitch = std::get<float>(pitch_any_value.data);
+        const float float_x = x_any_value.get<float>();
+        const float float_y = y_any_value.get<float>();
+        const float float_z = z_any_value.get<float>();
+        const float float_roll = roll_any_value.get<float>();
+        const float float_yaw = yaw_any_value.get<float>();
+        const float float_pitch = pitch_any_value.get<float>();
 
         HolobiontStruct holobiont_struct { Request(&parent), Request(&symbiosis) };
         holobiont_struct.cartesian_coordinates = CartesianCoordinatesModule(float_x, float_y, float_z);
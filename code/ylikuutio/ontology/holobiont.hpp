@@ -23,6 +23,12 @@
 #include "generic_parent_module.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
 
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
 // Include standard headers
 #include <cstddef>  // std::size_t
 #include <optional> // std::optional
@@ -70,16 +76,24 @@ namespace yli::ontology
         Holobiont(const Holobiont&) = delete; // Delete copy constructor.
         Holobiont& operator=(const Holobiont&) = delete; // Delete copy assignment.
 
-        ~Holobiont() override = default;
+        ~Holobiont() override;
 
         Entity* get_parent() const override;
 
+        // The `Biont`s store only their offsets relative to this `Holobiont`,
+        // so moving this `Holobiont` does not touch its `Biont`s.
         void update_x(float x);
 
         void update_y(float y);
 
         void update_z(float z);
 
+        // Computes the model matrix shared by the `Biont`s of this `Holobiont`.
+        // Called once per frame before the `Biont`s are drawn.
+        void update_model_matrix();
+
+        const glm::mat4& get_model_matrix() const;
+
         // Public callbacks.
 
         static std::optional<data::AnyValue> create_holobiont_with_parent_name_x_y_z(
@@ -135,7 +149,7 @@ namespace yli::ontology
 
         std::size_t get_number_of_descendants() const final;
 
-        // this method renders this `Holobiont`.
+        // this method renders the `Biont`s of this `Holobiont`, each with its own draw call.
         void render(const Scene* target_scene);
 
         static void create_skill(Holobiont& holobiont, const std::string& skill_name);
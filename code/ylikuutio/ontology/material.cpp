@@ -20,6 +20,7 @@
 #include "ecosystem.hpp"
 #include "scene.hpp"
 #include "pipeline.hpp"
+#include "shapeshifter_transformation.hpp"
 #include "material_struct.hpp"
 #include "texture_file_format.hpp"
 #include "get_number_of_descendants.hpp"
@@ -166,10 +167,11 @@ namespace yli::ontology
               &this->registry,
               material_struct.texture_filename,
               material_struct.texture_file_format,
-              load::ImageLoaderStruct(),
+              load::ImageLoaderStruct({ { load::ImageLoadingFlags::SHOULD_LOAD_ASYNCHRONOUSLY, material_struct.should_load_texture_asynchronously } }),
               "texture")
     {
-        if (this->texture.get_is_texture_loaded() && this->get_pipeline() != nullptr)
+        if ((this->texture.get_is_texture_loaded() || this->texture.get_is_loading()) && this->get_pipeline() != nullptr &&
+                this->universe.get_is_opengl_in_use())
         {
             // Get a handle for our "texture_sampler" uniform.
             const Pipeline* const pipeline = this->get_pipeline();
@@ -188,7 +190,7 @@ namespace yli::ontology
             return;
         }
 
-        const Scene* const scene = this->get_scene();
+        const Scene* const scene = this->get_cached_scene();
 
         if (target_scene != nullptr && scene != nullptr && scene != target_scene)
         {
@@ -208,9 +210,22 @@ namespace yli::ontology
         opengl::uniform_1i(this->opengl_texture_id, 0);
 
         render::RenderSystem::render_species(this->master_of_species, new_target_scene);
+        render::RenderSystem::render_shapeshifter_transformations(this->parent_of_shapeshifter_transformations, new_target_scene);
         render::RenderSystem::render_vector_fonts(this->parent_of_vector_fonts, new_target_scene);
     }
 
+    void Material::animate(const double time)
+    {
+        for (Entity* const shapeshifter_transformation_entity : this->parent_of_shapeshifter_transformations.child_pointer_vector)
+        {
+            if (auto* const shapeshifter_transformation = static_cast<ShapeshifterTransformation*>(shapeshifter_transformation_entity);
+                    shapeshifter_transformation != nullptr)
+            {
+                shapeshifter_transformation->animate(time);
+            }
+        }
+    }
+
     Entity* Material::get_parent() const
     {
         return this->child_of_ecosystem_or_scene.get_parent();
@@ -139,6 +139,9 @@ namespace yli::ontology
         std::size_t get_number_of_descendants() const override;
 
         void render(const Scene* target_scene);
+
+        // Blends the forms of all `ShapeshifterTransformation`s of this `Material` at `time`.
+        void animate(double time);
     };
 
     template<>
@@ -59,6 +59,7 @@ namespace yli::ontology
         Request<Pipeline> pipeline_master {};
         const TextureFileFormat texture_file_format; // Type of the texture file.
         std::string texture_filename;        // Filename of the model file.
+        bool should_load_texture_asynchronously { false }; // Load the texture in `AssetLoader` worker threads.
     };
 }
 
@@ -19,9 +19,13 @@
 #include "universe.hpp"
 #include "pipeline.hpp"
 #include "mesh_provider_struct.hpp"
+#include "code/ylikuutio/geometry/aabb.hpp"
+#include "code/ylikuutio/load/asset_loader.hpp"
 #include "code/ylikuutio/load/model_loader.hpp"
 #include "code/ylikuutio/load/model_loader_struct.hpp"
+#include "code/ylikuutio/opengl/vbo_indexer.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+#include "code/ylikuutio/render/graphics_api_backend.hpp"
 
 // Include GLM
 #ifndef __GLM_GLM_HPP_INCLUDED
@@ -30,13 +34,40 @@
 #endif
 
 // Include standard headers
-#include <cstddef>  // std::size_t
-#include <vector>   // std::vector
+#include <algorithm> // std::max
+#include <cmath>     // std::sqrt
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <future>    // std::promise, std::shared_future
+#include <iostream>  // std::cerr
+#include <memory>    // std::make_shared
+#include <utility>   // std::move
+#include <vector>    // std::vector
 
 namespace yli::ontology
 {
     class Scene;
 
+    // The state of an asynchronous load. It is shared with the `AssetLoader`
+    // jobs so that the `MeshModule` may be destroyed while loading.
+    struct MeshModule::AsyncMeshData
+    {
+        load::ModelLoaderStruct model_loader_struct;
+        std::vector<glm::vec3> vertices;
+        std::vector<glm::vec2> uvs;
+        std::vector<glm::vec3> normals;
+        std::vector<std::uint32_t> indices;
+        std::vector<glm::vec3> indexed_vertices;
+        std::vector<glm::vec2> indexed_uvs;
+        std::vector<glm::vec3> indexed_normals;
+        std::uint32_t image_width  { 0 };
+        std::uint32_t image_height { 0 };
+        render::GraphicsApiBackend graphics_api_backend;
+
+        // Only accessed on the upload thread. `nullptr` if the `MeshModule` has been destroyed.
+        MeshModule* mesh_module { nullptr };
+    };
+
     MeshModule::MeshModule(
             Universe& universe,
             const MeshProviderStruct& mesh_provider_struct,
@@ -49,6 +80,8 @@ namespace yli::ontology
             universe.get_is_vulkan_in_use() ||
             universe.get_is_software_rendering_in_use();
 
+        bool is_loading_successful = true;
+
         if (should_load_vertices_uvs_and_normals &&
                 universe.get_is_opengl_in_use() &&
                 pipeline != nullptr)
@@ -61,35 +94,112 @@ namespace yli::ontology
             this->vertex_uv_id = glGetAttribLocation(pipeline->get_program_id(), "vertex_uv");
             this->vertex_normal_modelspace_id = glGetAttribLocation(pipeline->get_program_id(), "vertex_normal_modelspace");
 
-            load::ModelLoaderStruct model_loader_struct = mesh_provider_struct.model_loader_struct;
-            model_loader_struct.image_width_pointer           = &this->image_width;
-            model_loader_struct.image_height_pointer          = &this->image_height;
-
             constexpr bool is_debug_mode = true;
 
-            yli::load::load_model(
-                    model_loader_struct,
-                    this->vertices,
-                    this->uvs,
-                    this->normals,
-                    this->indices,
-                    this->indexed_vertices,
-                    this->indexed_uvs,
-                    this->indexed_normals,
-                    this->vao,
-                    this->vertex_buffer,
-                    this->uv_buffer,
-                    this->normal_buffer,
-                    this->element_buffer,
-                    universe.get_graphics_api_backend(),
-                    is_debug_mode);
+            if (mesh_provider_struct.model_loader_struct.model_file_format.empty() &&
+                    !mesh_provider_struct.vertices.empty())
+            {
+                // The mesh was created in memory, eg. by triangulating the outlines of a `Glyph`.
+                this->vertices = mesh_provider_struct.vertices;
+                this->uvs      = mesh_provider_struct.uvs;
+                this->normals  = mesh_provider_struct.normals;
+
+                opengl::indexVBO(
+                        this->vertices,
+                        this->uvs,
+                        this->normals,
+                        this->indices,
+                        this->indexed_vertices,
+                        this->indexed_uvs,
+                        this->indexed_normals);
+
+                yli::load::upload_model_data(
+                        this->indices,
+                        this->indexed_vertices,
+                        this->indexed_uvs,
+                        this->indexed_normals,
+                        this->vao,
+                        this->vertex_buffer,
+                        this->uv_buffer,
+                        this->normal_buffer,
+                        this->element_buffer,
+                        universe.get_graphics_api_backend());
+            }
+            else if (mesh_provider_struct.should_load_asynchronously)
+            {
+                this->async_mesh_data = std::make_shared<AsyncMeshData>();
+                this->async_mesh_data->model_loader_struct = mesh_provider_struct.model_loader_struct;
+                this->async_mesh_data->model_loader_struct.image_width_pointer  = &this->async_mesh_data->image_width;
+                this->async_mesh_data->model_loader_struct.image_height_pointer = &this->async_mesh_data->image_height;
+                this->async_mesh_data->graphics_api_backend = universe.get_graphics_api_backend();
+                this->async_mesh_data->mesh_module = this;
+                this->is_loading = true;
+
+                this->loading_future = universe.get_asset_loader().enqueue(
+                        [async_mesh_data = this->async_mesh_data]()
+                        {
+                            return yli::load::load_model_data(
+                                    async_mesh_data->model_loader_struct,
+                                    async_mesh_data->vertices,
+                                    async_mesh_data->uvs,
+                                    async_mesh_data->normals,
+                                    async_mesh_data->indices,
+                                    async_mesh_data->indexed_vertices,
+                                    async_mesh_data->indexed_uvs,
+                                    async_mesh_data->indexed_normals,
+                                    is_debug_mode);
+                        },
+                        [async_mesh_data = this->async_mesh_data](const bool is_model_loaded)
+                        {
+                            if (async_mesh_data->mesh_module != nullptr)
+                            {
+                                async_mesh_data->mesh_module->finish_asynchronous_loading(*async_mesh_data, is_model_loaded);
+                            }
+                        });
+
+                return;
+            }
+            else
+            {
+                load::ModelLoaderStruct model_loader_struct = mesh_provider_struct.model_loader_struct;
+                model_loader_struct.image_width_pointer           = &this->image_width;
+                model_loader_struct.image_height_pointer          = &this->image_height;
+
+                is_loading_successful = yli::load::load_model(
+                        model_loader_struct,
+                        this->vertices,
+                        this->uvs,
+                        this->normals,
+                        this->indices,
+                        this->indexed_vertices,
+                        this->indexed_uvs,
+                        this->indexed_normals,
+                        this->vao,
+                        this->vertex_buffer,
+                        this->uv_buffer,
+                        this->normal_buffer,
+                        this->element_buffer,
+                        universe.get_graphics_api_backend(),
+                        is_debug_mode);
+            }
 
             this->are_opengl_buffers_initialized = true;
         }
+
+        this->compute_bounds();
+
+        std::promise<bool> loading_promise;
+        loading_promise.set_value(is_loading_successful);
+        this->loading_future = loading_promise.get_future().share();
     }
 
     MeshModule::~MeshModule()
     {
+        if (this->async_mesh_data != nullptr)
+        {
+            this->async_mesh_data->mesh_module = nullptr;
+        }
+
         if (this->are_opengl_buffers_initialized)
         {
             glDeleteBuffers(1, &this->vertex_buffer);
@@ -129,6 +239,93 @@ namespace yli::ontology
         return this->indices.size();
     }
 
+    bool MeshModule::get_is_loading() const
+    {
+        return this->is_loading;
+    }
+
+    std::shared_future<bool> MeshModule::get_loading_future() const
+    {
+        return this->loading_future;
+    }
+
+    const yli::geometry::Aabb& MeshModule::get_local_aabb() const
+    {
+        return this->local_aabb;
+    }
+
+    const glm::vec3& MeshModule::get_bounding_sphere_center() const
+    {
+        return this->bounding_sphere_center;
+    }
+
+    float MeshModule::get_bounding_sphere_radius() const
+    {
+        return this->bounding_sphere_radius;
+    }
+
+    void MeshModule::compute_bounds()
+    {
+        this->local_aabb = yli::geometry::Aabb::from_points(this->vertices);
+
+        if (this->local_aabb.is_empty())
+        {
+            return;
+        }
+
+        // The center of the `Aabb` gives a sphere that is not minimal, but it is cheap and tight enough for culling.
+        this->bounding_sphere_center = this->local_aabb.get_center();
+
+        float max_distance_squared = 0.0f;
+
+        for (const glm::vec3& vertex : this->vertices)
+        {
+            const glm::vec3 offset = vertex - this->bounding_sphere_center;
+            max_distance_squared = std::max(max_distance_squared, glm::dot(offset, offset));
+        }
+
+        this->bounding_sphere_radius = std::sqrt(max_distance_squared);
+    }
+
+    void MeshModule::finish_asynchronous_loading(AsyncMeshData& async_mesh_data, const bool is_loading_successful)
+    {
+        // Called by the `AssetLoader` on the thread which owns the GL context.
+        this->is_loading = false;
+        async_mesh_data.mesh_module = nullptr;
+        this->async_mesh_data = nullptr; // The upload job keeps `async_mesh_data` alive until it returns.
+
+        if (!is_loading_successful) [[unlikely]]
+        {
+            std::cerr << "ERROR: `MeshModule::finish_asynchronous_loading`: loading model failed!\n";
+            return;
+        }
+
+        this->vertices         = std::move(async_mesh_data.vertices);
+        this->uvs              = std::move(async_mesh_data.uvs);
+        this->normals          = std::move(async_mesh_data.normals);
+        this->indices          = std::move(async_mesh_data.indices);
+        this->indexed_vertices = std::move(async_mesh_data.indexed_vertices);
+        this->indexed_uvs      = std::move(async_mesh_data.indexed_uvs);
+        this->indexed_normals  = std::move(async_mesh_data.indexed_normals);
+        this->image_width      = async_mesh_data.image_width;
+        this->image_height     = async_mesh_data.image_height;
+
+        yli::load::upload_model_data(
+                this->indices,
+                this->indexed_vertices,
+                this->indexed_uvs,
+                this->indexed_normals,
+                this->vao,
+                this->vertex_buffer,
+                this->uv_buffer,
+                this->normal_buffer,
+                this->element_buffer,
+                async_mesh_data.graphics_api_backend);
+
+        this->are_opengl_buffers_initialized = true;
+        this->compute_bounds();
+    }
+
     GLint MeshModule::get_vertex_position_modelspace_id() const
     {
         return this->vertex_position_modelspace_id;
@@ -18,6 +18,7 @@
 #ifndef YLIKUUTIO_ONTOLOGY_MESH_MODULE_HPP_INCLUDED
 #define YLIKUUTIO_ONTOLOGY_MESH_MODULE_HPP_INCLUDED
 
+#include "code/ylikuutio/geometry/aabb.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
 
 // Include GLM
@@ -29,6 +30,8 @@
 // Include standard headers
 #include <cstddef>  // std::size_t
 #include <cstdint>  // std::uint32_t
+#include <future>   // std::shared_future
+#include <memory>   // std::shared_ptr
 #include <vector>   // std::vector
 
 namespace yli::ontology
@@ -63,6 +66,20 @@ namespace yli::ontology
 
         std::size_t get_indices_size() const;
 
+        // `true` while the mesh is being loaded asynchronously.
+        // A loading mesh has no vertices and should not be rendered.
+        bool get_is_loading() const;
+
+        // Becomes ready when loading has finished, holding `true` on success.
+        // Already ready if the mesh was loaded synchronously or there was nothing to load.
+        std::shared_future<bool> get_loading_future() const;
+
+        // Bounds in model space, computed once at load time.
+        // Empty if no vertices were loaded (e.g. headless).
+        const yli::geometry::Aabb& get_local_aabb() const;
+        const glm::vec3& get_bounding_sphere_center() const;
+        float get_bounding_sphere_radius() const;
+
         GLint get_vertex_position_modelspace_id() const;
 
         GLint get_vertex_uv_id() const;
@@ -99,6 +116,12 @@ namespace yli::ontology
         GLint vertex_normal_modelspace_id { 0 };   // Dummy value.
 
     private:
+        struct AsyncMeshData;
+
+        void compute_bounds();
+
+        void finish_asynchronous_loading(AsyncMeshData& async_mesh_data, bool is_loading_successful);
+
         std::vector<std::uint32_t> indices;
         std::vector<glm::vec3> indexed_vertices;
         std::vector<glm::vec2> indexed_uvs;
@@ -110,8 +133,16 @@ namespace yli::ontology
         GLuint normal_buffer { 0 };  // Dummy value.
         GLuint element_buffer { 0 }; // Dummy value.
 
+        yli::geometry::Aabb local_aabb;
+        glm::vec3 bounding_sphere_center { 0.0f };
+        float bounding_sphere_radius { 0.0f };
+
+        std::shared_ptr<AsyncMeshData> async_mesh_data { nullptr };
+        std::shared_future<bool> loading_future;
+
         bool use_real_texture_coordinates { true };
         bool are_opengl_buffers_initialized { false };
+        bool is_loading { false };
     };
 }
 
@@ -48,6 +48,9 @@ namespace yli::ontology
         std::vector<glm::vec2> uvs;
         std::vector<glm::vec3> normals;
         std::uint32_t vertex_count { std::numeric_limits<std::uint32_t>::max() };
+
+        // Load in `AssetLoader` worker threads instead of in the constructor.
+        bool should_load_asynchronously { false };
     };
 }
 
@@ -27,6 +27,9 @@
 #include "movable_struct.hpp"
 #include "variable_struct.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/geometry/heightmap_visibility.hpp"
+#include "code/ylikuutio/geometry/spatial_hash_grid.hpp"
+#include "code/ylikuutio/graph/path_cache.hpp"
 #include "code/ylikuutio/opengl/ubo_block_enums.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
 
@@ -37,9 +40,11 @@
 #endif
 
 // Include standard headers
+#include <cstdint>  // std::int32_t
 #include <iostream> // std::cerr
 #include <numbers>  // std::numbers::pi
 #include <optional> // std::optional
+#include <vector>   // std::vector
 
 // `Movable` is a mixin class, not intended to be instantiated.
 
@@ -99,6 +104,9 @@ namespace yli::ontology
           orientation(movable_struct.orientation.roll, movable_struct.orientation.yaw,
                       movable_struct.orientation.pitch),
           scale { movable_struct.scale },
+          allegiance { movable_struct.allegiance },
+          perception_radius { movable_struct.perception_radius },
+          is_static_observer { movable_struct.is_static_observer },
           input_method { movable_struct.input_method }
     {
         if (this->universe.get_is_opengl_in_use())
@@ -115,11 +123,22 @@ namespace yli::ontology
         // Initialize speed, angular speed and maximum speed variables.
         // These are to be used from the `MovableController` callbacks.
 
-        this->create_coordinate_and_angle_variables();
+        if (!this->are_variables_deferred)
+        {
+            this->create_coordinate_and_angle_variables();
+        }
 
         // `Entity` member variables begin here.
         this->type_string = "yli::ontology::Movable*";
         this->can_be_erased = true;
+
+        this->is_constructed = true;
+    }
+
+    void Movable::create_variables()
+    {
+        Entity::create_variables();
+        this->create_coordinate_and_angle_variables();
     }
 
     const glm::vec3& Movable::get_cartesian_coordinates() const
@@ -130,6 +149,7 @@ namespace yli::ontology
     void Movable::set_cartesian_coordinates(const glm::vec3& cartesian_coordinates)
     {
         this->location.xyz = cartesian_coordinates;
+        this->notify_moved();
     }
 
     float Movable::get_roll() const
@@ -180,6 +200,21 @@ namespace yli::ontology
     void Movable::set_scale(const float scale)
     {
         this->scale = scale;
+        this->notify_moved();
+    }
+
+    void Movable::notify_moved()
+    {
+        if (!this->is_constructed)
+        {
+            // The `Variable`s created by the constructor are activated before the `Scene` is known.
+            return;
+        }
+
+        if (Scene* const scene = this->get_cached_scene(); scene != nullptr)
+        {
+            scene->update_spatial_index(*this);
+        }
     }
 
     // Public callbacks (to be called from AI scripts written in YliLisp).
@@ -188,6 +223,7 @@ namespace yli::ontology
     {
         // Set target towards which to move.
         movable->location.xyz = glm::vec3(x, y, z);
+        movable->notify_moved();
     }
 
     float Movable::get_x(const Movable* const movable)
@@ -226,8 +262,266 @@ namespace yli::ontology
         return movable->dest_cartesian_coordinates.z;
     }
 
+    bool Movable::is_visible(const Movable* const movable, const float x, const float y, const float z)
+    {
+        // There are no radars yet.
+        return Movable::is_line_of_sight_for_any(movable, x, y, z);
+    }
+
+    bool Movable::is_line_of_sight_for_any(const Movable* const movable, const float x, const float y, const float z)
+    {
+        if (movable == nullptr)
+        {
+            return false;
+        }
+
+        Scene* const scene = movable->get_scene();
+
+        if (scene == nullptr)
+        {
+            return false;
+        }
+
+        const geometry::SpatialQueryFilter filter { movable->allegiance, geometry::GroupRelation::SAME };
+        return scene->is_line_of_sight_from_any(glm::vec3(x, y, z), movable->perception_radius, filter);
+    }
+
+    bool Movable::is_line_of_sight(const Movable* const movable, const float x, const float y, const float z)
+    {
+        if (movable == nullptr)
+        {
+            return false;
+        }
+
+        Scene* const scene = movable->get_scene();
+
+        if (scene == nullptr)
+        {
+            return false;
+        }
+
+        if (movable->is_static_observer)
+        {
+            return scene->get_viewshed(movable->location.xyz).is_visible(glm::vec3(x, y, z));
+        }
+
+        return scene->is_line_of_sight(movable->location.xyz, glm::vec3(x, y, z));
+    }
+
+    bool Movable::is_line_of_sight_between_from(
+            const Movable* const movable,
+            const float x1,
+            const float y1,
+            const float z1,
+            const float x2,
+            const float y2,
+            const float z2)
+    {
+        const Scene* const scene = (movable != nullptr ? movable->get_scene() : nullptr);
+
+        if (scene == nullptr || scene->get_terrain_visibility() == nullptr)
+        {
+            return false;
+        }
+
+        return scene->is_line_of_sight(glm::vec3(x1, y1, z1), glm::vec3(x2, y2, z2));
+    }
+
+    bool Movable::may_have_line_of_sight_between(
+            const Movable* const movable,
+            const float x1,
+            const float y1,
+            const float z1,
+            const float x2,
+            const float y2,
+            const float z2)
+    {
+        const Scene* const scene = (movable != nullptr ? movable->get_scene() : nullptr);
+
+        if (scene == nullptr)
+        {
+            return true;
+        }
+
+        return scene->is_line_of_sight(glm::vec3(x1, y1, z1), glm::vec3(x2, y2, z2));
+    }
+
+    bool Movable::is_ground_path_known(const Movable* const movable, const float x, const float y, const float z)
+    {
+        if (movable == nullptr)
+        {
+            return false;
+        }
+
+        return Movable::is_ground_path_known_between(
+                movable, movable->location.xyz.x, movable->location.xyz.y, movable->location.xyz.z, x, y, z);
+    }
+
+    bool Movable::is_rail_path_known(const Movable* const movable, const float x, const float y, const float z)
+    {
+        if (movable == nullptr)
+        {
+            return false;
+        }
+
+        return Movable::is_rail_path_known_between(
+                movable, movable->location.xyz.x, movable->location.xyz.y, movable->location.xyz.z, x, y, z);
+    }
+
+    bool Movable::is_air_path_known(const Movable* const movable, const float x, const float y, const float z)
+    {
+        if (movable == nullptr)
+        {
+            return false;
+        }
+
+        return Movable::is_air_path_known_between(
+                movable, movable->location.xyz.x, movable->location.xyz.y, movable->location.xyz.z, x, y, z);
+    }
+
+    bool Movable::is_ground_path_known_between(
+            const Movable* const movable,
+            const float x1,
+            const float y1,
+            const float z1,
+            const float x2,
+            const float y2,
+            const float z2)
+    {
+        Scene* const scene = (movable != nullptr ? movable->get_scene() : nullptr);
+
+        if (scene == nullptr)
+        {
+            return false;
+        }
+
+        return scene->is_path_known(graph::PathDomain::GRID, glm::vec3(x1, y1, z1), glm::vec3(x2, y2, z2));
+    }
+
+    bool Movable::is_rail_path_known_between(
+            const Movable* const movable,
+            const float x1,
+            const float y1,
+            const float z1,
+            const float x2,
+            const float y2,
+            const float z2)
+    {
+        Scene* const scene = (movable != nullptr ? movable->get_scene() : nullptr);
+
+        if (scene == nullptr)
+        {
+            return false;
+        }
+
+        return scene->is_path_known(graph::PathDomain::GRAPH, glm::vec3(x1, y1, z1), glm::vec3(x2, y2, z2));
+    }
+
+    bool Movable::is_air_path_known_between(
+            const Movable* const movable,
+            const float x1,
+            const float y1,
+            const float z1,
+            const float x2,
+            const float y2,
+            const float z2)
+    {
+        // Flying straight is the only known air path.
+        return Movable::is_line_of_sight_between_from(movable, x1, y1, z1, x2, y2, z2);
+    }
+
+    void* Movable::get_first_allied_movable(Movable& movable)
+    {
+        // point `allied_iterator` to the first movable, `nullptr` if N/A.
+        return movable.get_first_movable_within_perception(movable.allied_iterator, geometry::GroupRelation::SAME, true);
+    }
+
+    void* Movable::get_next_allied_movable(Movable& movable)
+    {
+        // advance `allied_iterator`, `nullptr` if N/A.
+        return movable.get_next_movable(movable.allied_iterator);
+    }
+
+    void* Movable::get_first_other_allied_movable(Movable& movable)
+    {
+        // point `allied_other_iterator` to the first other movable, `nullptr` if N/A.
+        return movable.get_first_movable_within_perception(movable.allied_other_iterator, geometry::GroupRelation::SAME, false);
+    }
+
+    void* Movable::get_next_other_allied_movable(Movable& movable)
+    {
+        // advance `allied_other_iterator`, `nullptr` if N/A.
+        return movable.get_next_movable(movable.allied_other_iterator);
+    }
+
+    void* Movable::get_first_opponent_movable(Movable& movable)
+    {
+        // point `opponent_iterator` to the first opponent, `nullptr` if N/A.
+        return movable.get_first_movable_within_perception(movable.opponent_iterator, geometry::GroupRelation::OTHER, false);
+    }
+
+    void* Movable::get_next_opponent_movable(Movable& movable)
+    {
+        // advance `opponent_iterator`, `nullptr` if N/A.
+        return movable.get_next_movable(movable.opponent_iterator);
+    }
+
     // Public callbacks end here.
 
+    void* Movable::get_first_movable_within_perception(
+        MovableCursor& cursor,
+        const geometry::GroupRelation relation,
+        const bool should_include_self)
+    {
+        cursor.neighbours.clear();
+        cursor.next_i = 0;
+
+        Scene* const scene = this->get_cached_scene();
+
+        if (scene == nullptr)
+        {
+            return nullptr;
+        }
+
+        // Sync this `Movable` so that the query agrees with its current location.
+        scene->update_spatial_index(*this);
+
+        const geometry::SpatialQueryFilter filter {
+            this->allegiance,
+            relation,
+            (should_include_self ? geometry::SpatialHashGrid::null_proxy : this->spatial_proxy_id) };
+        const geometry::SpatialHashGrid& spatial_index = scene->get_spatial_index();
+        spatial_index.query_radius(this->location.xyz, this->perception_radius, filter, cursor.neighbours);
+        geometry::SpatialHashGrid::sort_nearest_first(cursor.neighbours);
+
+        return this->get_next_movable(cursor);
+    }
+
+    void* Movable::get_next_movable(MovableCursor& cursor) const
+    {
+        const Scene* const scene = this->get_cached_scene();
+
+        if (scene == nullptr)
+        {
+            return nullptr;
+        }
+
+        const geometry::SpatialHashGrid& spatial_index = scene->get_spatial_index();
+
+        while (cursor.next_i < cursor.neighbours.size())
+        {
+            const std::int32_t proxy_id = cursor.neighbours[cursor.next_i++].proxy_id;
+
+            // Skip `Movable`s removed from the index after the query.
+            if (spatial_index.is_valid_proxy(proxy_id))
+            {
+                return spatial_index.get_user_data(proxy_id);
+            }
+        }
+
+        return nullptr;
+    }
+
     void Movable::create_coordinate_and_angle_variables()
     {
         float& float_x = this->location.xyz.x;
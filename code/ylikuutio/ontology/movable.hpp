@@ -25,6 +25,7 @@
 #include "rigid_body_module.hpp"
 #include "movable_struct.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/geometry/spatial_hash_grid.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
 
 // Include GLM
@@ -35,6 +36,8 @@
 
 // Include standard headers
 #include <cmath>    // NAN
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::int32_t, std::uint32_t
 #include <optional> // std::optional
 #include <vector>   // std::vector
 
@@ -83,6 +86,8 @@ namespace yli::ontology
                         const MovableStruct& movable_struct,
                         GenericMasterModule* movable_controller_master_module);
 
+                void create_variables() override;
+
         public:
                 Movable(const Movable&) = delete; // Delete copy constructor.
                 Movable& operator=(const Movable&) = delete; // Delete copy assignment.
@@ -113,6 +118,11 @@ namespace yli::ontology
 
                 void set_scale(float scale);
 
+                // Tells the `Scene` that `location` or `scale` has changed, so that its
+                // spatial index and culling tree follow. The setters call this,
+                // code that writes `location` or `scale` directly must call this too.
+                virtual void notify_moved();
+
                 // Public callbacks (to be called from AI scripts written in YliLisp).
                 // These are the functions that are available for AI scripts.
                 // Ylikuutio will support scripting of game agents using YliLisp.
@@ -148,21 +158,28 @@ namespace yli::ontology
 
                 // This method returns `true` if destination is visible, `false` otherwise.
                 // destination may be visible directly (line of sight) or eg. by radar (without line of sight).
-                static bool is_visible(float x, float y, float z);
+                // There are no radars yet, so this is the same as `is_line_of_sight_for_any`.
+                static bool is_visible(const Movable* movable, float x, float y, float z);
 
                 // This method returns `true` if destination is visible with a line of sight for any own `Movable`, `false` otherwise.
-                static bool is_line_of_sight_for_any(float x, float y, float z);
+                // Own `Movable`s are the indexed `Movable`s of the same `allegiance` within `perception_radius` of the destination.
+                static bool is_line_of_sight_for_any(const Movable* movable, float x, float y, float z);
 
-                // This method returns `true` if destination is visible with a line of sight for any own `Movable`, `false` otherwise.
+                // This method returns `true` if destination is visible with a line of sight for `movable`, `false` otherwise.
+                // The terrain of the `Scene` may block the line of sight, if it is known.
                 static bool is_line_of_sight(const Movable* movable, float x, float y, float z);
 
                 // This method returns `true` if there is any known ground path between `Movable` and (x, y, z),  `false` otherwise.
+                // Ground paths are planned over the navigation grid of the `Scene`. A path is known once it has been planned:
+                // the first call requests the path and returns `false` unless the path is already cached.
                 static bool is_ground_path_known(const Movable* movable, float x, float y, float z);
 
                 // This method returns `true` if there is any known rail path between `Movable` and (x, y, z),  `false` otherwise.
+                // Rail paths are planned over the navigation graph of the `Scene`, between the nodes nearest to the endpoints.
                 static bool is_rail_path_known(const Movable* movable, float x, float y, float z);
 
                 // This method returns `true` if there is known air path between movables, `false` otherwise.
+                // An air path is known if the terrain is known and does not block the straight path.
                 static bool is_air_path_known(const Movable* movable, float x, float y, float z);
 
                 // This method returns `true` if there is known ballistic path between `Movable` and (x, y, z), `false` otherwise.
@@ -258,7 +275,9 @@ namespace yli::ontology
                 // Coordinate-centric path and map information callbacks.
                 // The conditions for returning `true` match the conditions of the corresponding allied-movable-centric callbacks.
 
+                // `movable` provides the `Scene`. Line of sight is known if the terrain is known and does not block it.
                 static bool is_line_of_sight_between_from(
+                        const Movable* movable,
                         float x1,
                         float y1,
                         float z1,
@@ -266,7 +285,9 @@ namespace yli::ontology
                         float y2,
                         float z2);
 
+                // Line of sight is possible if the terrain is not known or does not block it.
                 static bool may_have_line_of_sight_between(
+                        const Movable* movable,
                         float x1,
                         float y1,
                         float z1,
@@ -275,6 +296,7 @@ namespace yli::ontology
                         float z2);
 
                 static bool is_ground_path_known_between(
+                        const Movable* movable,
                         float x1,
                         float y1,
                         float z1,
@@ -283,6 +305,7 @@ namespace yli::ontology
                         float z2);
 
                 static bool is_rail_path_known_between(
+                        const Movable* movable,
                         float x1,
                         float y1,
                         float z1,
@@ -291,6 +314,7 @@ namespace yli::ontology
                         float z2);
 
                 static bool is_air_path_known_between(
+                        const Movable* movable,
                         float x1,
                         float y1,
                         float z1,
@@ -407,14 +431,35 @@ namespace yli::ontology
                 // Public callbacks end here.
 
         private:
+                // Results of a neighbour query in the spatial index of the `Scene`, nearest first.
+                struct MovableCursor
+                {
+                        std::vector<geometry::SpatialNeighbour> neighbours;
+                        std::size_t next_i { 0 };
+                };
+
                 void create_coordinate_and_angle_variables();
 
+                // Query the `Movable`s within `perception_radius` into `cursor` and return the first one.
+                void* get_first_movable_within_perception(
+                        MovableCursor& cursor,
+                        geometry::GroupRelation relation,
+                        bool should_include_self);
+
+                void* get_next_movable(MovableCursor& cursor) const;
+
         public:
                 ApprenticeModule apprentice_of_movable_controller;
 
         private:
                 RigidBodyModule rigid_body_module;
 
+                MovableCursor allied_iterator;
+                MovableCursor allied_other_iterator;
+                MovableCursor opponent_iterator;
+
+                bool is_constructed { false }; // `notify_moved` does nothing until the end of the constructor.
+
         public:
                 std::vector<glm::vec3> initial_rotate_vectors;
                 std::vector<float> initial_rotate_angles;
@@ -437,6 +482,16 @@ namespace yli::ontology
                 float scale { 1.0f };
                 float speed { 1.0f };
 
+                // `Movable`s of the same `allegiance` are allies, others are opponents.
+                std::uint32_t allegiance { 0 };
+                float perception_radius { 100.0f }; // Radius of the allied and opponent queries.
+
+                // A static observer, e.g. a building, uses the cached viewshed of its location for the line of sight queries.
+                bool is_static_observer { false };
+
+                // Spatial index state, managed by the `Scene`.
+                std::int32_t spatial_proxy_id { -1 };
+
                 // The rest fields are created in the constructor.
                 glm::mat4 model_matrix { glm::mat4(1.0f) }; // model matrix (initialized with dummy value).
                 glm::mat4 mvp_matrix { glm::mat4(1.0f) };
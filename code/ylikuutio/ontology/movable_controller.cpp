@@ -22,7 +22,6 @@
 #include "scene.hpp"
 #include "request_resolver.hpp"
 #include "movable_controller_struct.hpp"
-#include "code/ylikuutio/data/any_value.hpp"
 
 // Include standard headers
 #include <cstddef>  // std::size_t
@@ -103,7 +102,7 @@ namespace yli::ontology
 
             if (auto* movable = static_cast<Movable*>(movable_apprentice_module->get_apprentice()); movable != nullptr)
             {
-                callback_engine_master->execute(data::AnyValue(*movable));
+                callback_engine_master->execute(*movable);
             }
         }
     }
@@ -33,6 +33,7 @@
 
 // Include standard headers
 #include <cmath>   // NAN
+#include <cstdint> // std::uint32_t
 #include <string>  // std::string
 #include <utility> // std::move
 #include <variant> // std::variant
@@ -106,6 +107,10 @@ namespace yli::ontology
 
         float scale { 1.0f };
 
+        std::uint32_t allegiance { 0 };     // `Movable`s of the same `allegiance` are allies.
+        float perception_radius { 100.0f }; // Radius of the allied and opponent queries.
+        bool is_static_observer { false };  // Use the cached viewshed for the line of sight queries.
+
         RigidBodyModuleStruct rigid_body_module_struct;
     };
 }
@@ -29,13 +29,11 @@
 #endif
 
 // Include standard headers
-#include <functional> // std::reference_wrapper
 #include <iostream>   // std::cerr
 #include <numbers>    // std::numbers::pi
 #include <optional>   // std::optional
 #include <stdexcept>  // std::runtime_error
 #include <utility>    // std::move
-#include <variant>    // std::holds_alternative
 
 namespace yli::ontology
 {
@@ -47,17 +45,12 @@ namespace yli::ontology
     {
         if (auto* const movable = dynamic_cast<Movable*>(&entity); movable != nullptr)
         {
-            if (const data::AnyValue& cartesian_coordinates_any_value = variable.variable_value; std::holds_alternative<std::reference_wrapper<glm::vec3>>(cartesian_coordinates_any_value.data))
+            if (const data::AnyValue& cartesian_coordinates_any_value = variable.variable_value; cartesian_coordinates_any_value.holds<glm::vec3>())
             {
                 const glm::vec3& cartesian_coordinates =
-                    std::get<std::reference_wrapper<glm::vec3>>(cartesian_coordinates_any_value.data);
-                movable->location.xyz = cartesian_coordinates;
-            }
-            else if (std::holds_alternative<std::reference_wrapper<const glm::vec3>>(cartesian_coordinates_any_value.data))
-            {
-                const glm::vec3& cartesian_coordinates =
-                    std::get<std::reference_wrapper<const glm::vec3>>(cartesian_coordinates_any_value.data);
+                    cartesian_coordinates_any_value.get<glm::vec3>();
                 movable->location.xyz = cartesian_coordinates;
+                movable->notify_moved();
             }
             else
             {
@@ -74,16 +67,10 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `activate_cartesian_coordinates`: `universe` is `nullptr`!");
         }
 
-        if (const data::AnyValue& cartesian_coordinates_any_value = variable.variable_value; std::holds_alternative<std::reference_wrapper<glm::vec3>>(cartesian_coordinates_any_value.data))
-        {
-            const glm::vec3 cartesian_coordinates =
-                std::get<std::reference_wrapper<glm::vec3>>(cartesian_coordinates_any_value.data);
-            universe->set_xyz(cartesian_coordinates);
-        }
-        else if (std::holds_alternative<std::reference_wrapper<const glm::vec3>>(cartesian_coordinates_any_value.data))
+        if (const data::AnyValue& cartesian_coordinates_any_value = variable.variable_value; cartesian_coordinates_any_value.holds<glm::vec3>())
         {
             const glm::vec3 cartesian_coordinates =
-                std::get<std::reference_wrapper<const glm::vec3>>(cartesian_coordinates_any_value.data);
+                cartesian_coordinates_any_value.get<glm::vec3>();
             universe->set_xyz(cartesian_coordinates);
         }
         else
@@ -102,20 +89,21 @@ namespace yli::ontology
         {
             const data::AnyValue& x_any_value = variable.variable_value;
 
-            if (!std::holds_alternative<float>(x_any_value.data))
+            if (!x_any_value.holds<float>())
             {
                 std::cerr << "ERROR: `activate_x`: data is of invalid type!\n";
                 return std::nullopt;
             }
 
-            movable->location.set_x(std::get<float>(x_any_value.data));
-            movable->model_matrix[3][0] = std::get<float>(x_any_value.data);
+            movable->location.set_x(x_any_value.get<float>());
+            movable->model_matrix[3][0] = x_any_value.get<float>();
 
             if (auto* const holobiont = dynamic_cast<Holobiont*>(movable); holobiont != nullptr)
             {
-                holobiont->update_x(std::get<float>(x_any_value.data));
+                holobiont->update_x(x_any_value.get<float>());
             }
 
+            movable->notify_moved();
             return std::nullopt;
         }
 
@@ -128,13 +116,13 @@ namespace yli::ontology
 
         const data::AnyValue& x_any_value = variable.variable_value;
 
-        if (!std::holds_alternative<float>(x_any_value.data))
+        if (!x_any_value.holds<float>())
         {
             std::cerr << "ERROR: `activate_x`: data is of invalid type!\n";
             return std::nullopt;
         }
 
-        universe->set_x(std::get<float>(x_any_value.data));
+        universe->set_x(x_any_value.get<float>());
         return std::nullopt;
     }
 
@@ -146,20 +134,21 @@ namespace yli::ontology
         {
             const data::AnyValue& y_any_value = variable.variable_value;
 
-            if (!std::holds_alternative<float>(y_any_value.data))
+            if (!y_any_value.holds<float>())
             {
                 std::cerr << "ERROR: `activate_y`: data is of invalid type!\n";
                 return std::nullopt;
             }
 
-            movable->location.set_y(std::get<float>(y_any_value.data));
-            movable->model_matrix[3][1] = std::get<float>(y_any_value.data);
+            movable->location.set_y(y_any_value.get<float>());
+            movable->model_matrix[3][1] = y_any_value.get<float>();
 
             if (auto* const holobiont = dynamic_cast<Holobiont*>(movable); holobiont != nullptr)
             {
-                holobiont->update_y(std::get<float>(y_any_value.data));
+                holobiont->update_y(y_any_value.get<float>());
             }
 
+            movable->notify_moved();
             return std::nullopt;
         }
 
@@ -172,13 +161,13 @@ namespace yli::ontology
 
         const data::AnyValue& y_any_value = variable.variable_value;
 
-        if (!std::holds_alternative<float>(y_any_value.data))
+        if (!y_any_value.holds<float>())
         {
             std::cerr << "ERROR: `activate_y`: data is of invalid type!\n";
             return std::nullopt;
         }
 
-        universe->set_y(std::get<float>(y_any_value.data));
+        universe->set_y(y_any_value.get<float>());
         return std::nullopt;
     }
 
@@ -190,20 +179,21 @@ namespace yli::ontology
         {
             const data::AnyValue& z_any_value = variable.variable_value;
 
-            if (!std::holds_alternative<float>(z_any_value.data))
+            if (!z_any_value.holds<float>())
             {
                 std::cerr << "ERROR: `activate_z`: data is of invalid type!\n";
                 return std::nullopt;
             }
 
-            movable->location.set_z(std::get<float>(z_any_value.data));
-            movable->model_matrix[3][2] = std::get<float>(z_any_value.data);
+            movable->location.set_z(z_any_value.get<float>());
+            movable->model_matrix[3][2] = z_any_value.get<float>();
 
             if (auto* const holobiont = dynamic_cast<Holobiont*>(movable); holobiont != nullptr)
             {
-                holobiont->update_z(std::get<float>(z_any_value.data));
+                holobiont->update_z(z_any_value.get<float>());
             }
 
+            movable->notify_moved();
             return std::nullopt;
         }
 
@@ -216,13 +206,13 @@ namespace yli::ontology
 
         const data::AnyValue& z_any_value = variable.variable_value;
 
-        if (!std::holds_alternative<float>(z_any_value.data))
+        if (!z_any_value.holds<float>())
         {
             std::cerr << "ERROR: `activate_z`: data is of invalid type!\n";
             return std::nullopt;
         }
 
-        universe->set_z(std::get<float>(z_any_value.data));
+        universe->set_z(z_any_value.get<float>());
         return std::nullopt;
     }
 
@@ -234,12 +224,12 @@ namespace yli::ontology
         {
             const data::AnyValue& roll_any_value = variable.variable_value;
 
-            if (!std::holds_alternative<float>(roll_any_value.data))
+            if (!roll_any_value.holds<float>())
             {
                 return std::nullopt;
             }
 
-            movable->orientation.roll = std::get<float>(roll_any_value.data);
+            movable->orientation.roll = roll_any_value.get<float>();
             return std::nullopt;
         }
 
@@ -252,12 +242,12 @@ namespace yli::ontology
 
         const data::AnyValue& roll_any_value = variable.variable_value;
 
-        if (!std::holds_alternative<float>(roll_any_value.data))
+        if (!roll_any_value.holds<float>())
         {
             return std::nullopt;
         }
 
-        universe->set_roll(std::get<float>(roll_any_value.data));
+        universe->set_roll(roll_any_value.get<float>());
         return std::nullopt;
     }
 
@@ -269,12 +259,12 @@ namespace yli::ontology
         {
             const data::AnyValue& yaw_any_value = variable.variable_value;
 
-            if (!std::holds_alternative<float>(yaw_any_value.data))
+            if (!yaw_any_value.holds<float>())
             {
                 return std::nullopt;
             }
 
-            movable->orientation.yaw = std::get<float>(yaw_any_value.data);
+            movable->orientation.yaw = yaw_any_value.get<float>();
             return std::nullopt;
         }
 
@@ -287,12 +277,12 @@ namespace yli::ontology
 
         const data::AnyValue& yaw_any_value = variable.variable_value;
 
-        if (!std::holds_alternative<float>(yaw_any_value.data))
+        if (!yaw_any_value.holds<float>())
         {
             return std::nullopt;
         }
 
-        universe->set_yaw(std::get<float>(yaw_any_value.data));
+        universe->set_yaw(yaw_any_value.get<float>());
         return std::nullopt;
     }
 
@@ -304,12 +294,12 @@ namespace yli::ontology
         {
             const data::AnyValue& pitch_any_value = variable.variable_value;
 
-            if (!std::holds_alternative<float>(pitch_any_value.data))
+            if (!pitch_any_value.holds<float>())
             {
                 return std::nullopt;
             }
 
-            movable->orientation.pitch = std::get<float>(pitch_any_value.data);
+            movable->orientation.pitch = pitch_any_value.get<float>();
             return std::nullopt;
         }
 
@@ -322,12 +312,12 @@ namespace yli::ontology
 
         const data::AnyValue& pitch_any_value = variable.variable_value;
 
-        if (!std::holds_alternative<float>(pitch_any_value.data))
+        if (!pitch_any_value.holds<float>())
         {
             return std::nullopt;
         }
 
-        universe->set_pitch(std::get<float>(pitch_any_value.data));
+        universe->set_pitch(pitch_any_value.get<float>());
         return std::nullopt;
     }
 
@@ -339,12 +329,12 @@ namespace yli::ontology
         {
             const data::AnyValue& azimuth_any_value = variable.variable_value;
 
-            if (!std::holds_alternative<float>(azimuth_any_value.data))
+            if (!azimuth_any_value.holds<float>())
             {
                 return std::nullopt;
             }
 
-            movable->orientation.yaw = 0.5f * static_cast<float>(std::numbers::pi) - std::get<float>(azimuth_any_value.data);
+            movable->orientation.yaw = 0.5f * static_cast<float>(std::numbers::pi) - azimuth_any_value.get<float>();
             return std::nullopt;
         }
 
@@ -357,12 +347,12 @@ namespace yli::ontology
 
         const data::AnyValue& azimuth_any_value = variable.variable_value;
 
-        if (!std::holds_alternative<float>(azimuth_any_value.data))
+        if (!azimuth_any_value.holds<float>())
         {
             return std::nullopt;
         }
 
-        universe->set_yaw(0.5f * static_cast<float>(std::numbers::pi) - std::get<float>(azimuth_any_value.data));
+        universe->set_yaw(0.5f * static_cast<float>(std::numbers::pi) - azimuth_any_value.get<float>());
         return std::nullopt;
     }
 
@@ -372,9 +362,10 @@ namespace yli::ontology
     {
         if (auto* const movable = dynamic_cast<Movable*>(&entity); movable != nullptr)
         {
-            if (const data::AnyValue& scale_any_value = variable.variable_value; std::holds_alternative<float>(scale_any_value.data))
+            if (const data::AnyValue& scale_any_value = variable.variable_value; scale_any_value.holds<float>())
             {
-                movable->scale = std::get<float>(scale_any_value.data);
+                movable->scale = scale_any_value.get<float>();
+                movable->notify_moved();
             }
         }
 
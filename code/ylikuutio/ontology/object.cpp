@@ -29,6 +29,7 @@
 #include "object_struct.hpp"
 #include "code/ylikuutio/core/application.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/geometry/aabb.hpp"
 #include "code/ylikuutio/opengl/opengl.hpp"
 #include "code/ylikuutio/opengl/ubo_block_enums.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
@@ -55,6 +56,8 @@
 #endif
 
 // Include standard headers
+#include <algorithm> // std::max
+#include <cmath>     // std::abs
 #include <cstddef>   // std::size_t
 #include <cstdint>   // std::uint32_t
 #include <iostream>  // std::cout, std::cerr
@@ -75,7 +78,7 @@ namespace yli::ontology
         // Set pointer to `object` to `nullptr`, set parent according to the input,
         // and request a new childID from `new_parent`.
 
-        const Scene* const old_scene_parent = object.get_scene();
+        Scene* const old_scene_parent = object.get_scene();
 
         if (old_scene_parent == nullptr) [[unlikely]]
         {
@@ -94,8 +97,12 @@ namespace yli::ontology
             return std::nullopt;
         }
 
+        old_scene_parent->remove_from_culling(object);
+        old_scene_parent->remove_from_spatial_index(object);
         object.apprentice_of_species.unbind_from_any_master_belonging_to_other_scene(new_parent);
         object.child_of_scene.unbind_and_bind_to_new_parent(&new_parent.parent_of_objects);
+        new_parent.add_to_spatial_index(object);
+        new_parent.mark_culling_dirty(object);
         return std::nullopt;
     }
 
@@ -114,6 +121,12 @@ namespace yli::ontology
         {
             object.apprentice_of_species.unbind_and_bind_to_new_generic_master_module(
                 &new_species.master_of_objects);
+
+            if (Scene* const scene = object.get_scene(); scene != nullptr)
+            {
+                // The mesh, and so the bounds, of `object` have changed.
+                scene->mark_culling_dirty(object);
+            }
         }
         else
         {
@@ -139,16 +152,73 @@ namespace yli::ontology
           child_of_scene(scene_parent_module, *this),
           apprentice_of_species(species_master_module, this)
     {
+        if (Scene* const scene = this->get_scene(); scene != nullptr)
+        {
+            scene->add_to_spatial_index(*this);
+            scene->mark_culling_dirty(*this);
+        }
+
         // `Entity` member variables begin here.
         this->type_string = "yli::ontology::Object*";
         this->can_be_erased = true;
     }
 
+    Object::~Object()
+    {
+        if (Scene* const scene = this->get_scene(); scene != nullptr)
+        {
+            scene->remove_from_culling(*this);
+            scene->remove_from_spatial_index(*this);
+        }
+    }
+
+    void Object::notify_moved()
+    {
+        Movable::notify_moved();
+
+        if (Scene* const scene = this->get_cached_scene(); scene != nullptr)
+        {
+            scene->mark_culling_dirty(*this);
+        }
+    }
+
     Entity* Object::get_parent() const
     {
         return this->child_of_scene.get_parent();
     }
 
+    geometry::Aabb Object::get_world_aabb() const
+    {
+        const auto* const species = static_cast<Species*>(this->apprentice_of_species.get_master());
+
+        if (species == nullptr) [[unlikely]]
+        {
+            return geometry::Aabb();
+        }
+
+        const MeshModule& mesh = species->mesh;
+
+        if (mesh.get_local_aabb().is_empty())
+        {
+            return geometry::Aabb();
+        }
+
+        // Rotations preserve distances from the origin of the model space,
+        // so a sphere around `location` bounds every orientation.
+        const float max_scale = this->scale * std::max(
+                std::abs(this->original_scale_vector.x),
+                std::max(std::abs(this->original_scale_vector.y), std::abs(this->original_scale_vector.z)));
+        const float radius = (glm::length(mesh.get_bounding_sphere_center()) + mesh.get_bounding_sphere_radius()) * max_scale;
+
+        return geometry::Aabb::from_sphere(this->location.xyz, radius);
+    }
+
+    bool Object::get_is_mesh_loading() const
+    {
+        const auto* const species = static_cast<Species*>(this->apprentice_of_species.get_master());
+        return species != nullptr && species->mesh.get_is_loading();
+    }
+
     void Object::render(const Scene* const target_scene)
     {
         // render this `Object`.
@@ -158,7 +228,7 @@ namespace yli::ontology
             return;
         }
 
-        Scene* const scene = this->get_scene();
+        Scene* const scene = this->get_cached_scene();
 
         if (target_scene != nullptr && scene != nullptr && scene != target_scene) [[unlikely]]
         {
@@ -166,7 +236,13 @@ namespace yli::ontology
             return;
         }
 
-        this->render_this_object(this->get_pipeline());
+        if (scene != nullptr && scene->is_culled(*this))
+        {
+            // Outside the view frustum.
+            return;
+        }
+
+        this->render_this_object(this->get_cached_pipeline());
     }
 
     void Object::render_this_object(const Pipeline* const pipeline)
@@ -319,6 +395,11 @@ namespace yli::ontology
         throw std::runtime_error("ERROR: `Object::get_pipeline`: `species` is `nullptr`!");
     }
 
+    Pipeline* Object::get_cached_pipeline() const
+    {
+        return this->cached_pipeline.get(this->registry.get_universe_generation(), [this]() { return this->get_pipeline(); });
+    }
+
     std::size_t Object::get_number_of_children() const
     {
         return 0; // `Object` has no children.
@@ -375,48 +456,48 @@ namespace yli::ontology
         data::AnyValue yaw_any_value("float", yaw);
         data::AnyValue pitch_any_value("float", pitch);
 
-        if (!std::holds_alternative<float>(x_any_value.data))
+        if (!x_any_value.holds<float>())
         {
             std::cerr << "ERROR: `Object::with_parent_name_x_y_z_yaw_pitch`: invalid value for `x`!\n";
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<float>(y_any_value.data))
+        if (!y_any_value.holds<float>())
         {
             std::cerr << "ERROR: `Object::with_parent_name_x_y_z_yaw_pitch`: invalid value for `y`!\n";
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<float>(z_any_value.data))
+        if (!z_any_value.holds<float>())
         {
             std::cerr << "ERROR: `Object::with_parent_name_x_y_z_yaw_pitch`: invalid value for `z`!\n";
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<float>(roll_any_value.data))
+        if (!roll_any_value.holds<float>())
         {
             std::cerr << "ERROR: `Object::with_parent_name_x_y_z_roll_pitch`: invalid value for `roll`!\n";
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<float>(yaw_any_value.data))
+        if (!yaw_any_value.holds<float>())
         {
             std::cerr << "ERROR: `Object::with_parent_name_x_y_z_yaw_pitch`: invalid value for `yaw`!\n";
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<float>(pitch_any_value.data))
+        if (!pitch_any_value.holds<float>())
         {
             std::cerr << "ERROR: `Object::with_parent_name_x_y_z_yaw_pitch`: invalid value for `pitch`!\n";
             return std::nullopt;
         }
 
-        const float float_x = std::get<float>(x_any_value.data);
-        const float float_y = std::get<float>(y_any_value.data);
-        const float float_z = std::get<float>(z_any_value.data);
-        const float float_roll = std::get<float>(roll_any_value.data);
-        const float float_yaw = std::get<float>(yaw_any_value.data);
-        const float float_pitch = std::get<float>(pitch_any_value.data);
+        const float float_x = x_any_value.get<float>();
+        const float float_y = y_any_value.get<float>();
+        const float float_z = z_any_value.get<float>();
+        const float float_roll = roll_any_value.get<float>();
+        const float float_yaw = yaw_any_value.get<float>();
+        const float float_pitch = pitch_any_value.get<float>();
 
         ObjectStruct object_struct { Request(&parent) };
         object_struct.species_master = Request(&species);
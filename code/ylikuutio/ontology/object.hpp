@@ -21,11 +21,14 @@
 #include "movable.hpp"
 #include "child_module.hpp"
 #include "apprentice_module.hpp"
+#include "cached_ancestor.hpp"
 #include "object_struct.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/geometry/aabb.hpp"
 
 // Include standard headers
 #include <cstddef>  // std::size_t
+#include <cstdint>  // std::int32_t, std::uint64_t
 #include <optional> // std::optional
 #include <string>   // std::string
 
@@ -74,7 +77,7 @@ namespace yli::ontology
             GenericMasterModule* movable_controller_master_module,
             GenericMasterModule* species_master_module);
 
-        ~Object() override = default;
+        ~Object() override;
 
     public:
         Object(const Object&) = delete; // Delete copy constructor.
@@ -119,10 +122,23 @@ namespace yli::ontology
 
         Pipeline* get_pipeline() const;
 
+        // Returns `get_pipeline()`, resolved again only after the hierarchy has changed.
+        Pipeline* get_cached_pipeline() const;
+
         std::size_t get_number_of_children() const final;
 
         std::size_t get_number_of_descendants() const final;
 
+        // Also queues this `Object` for syncing its culling proxy.
+        void notify_moved() override;
+
+        // Conservative world space bounds of this `Object`.
+        // Empty if the mesh of the `Species` has no bounds.
+        geometry::Aabb get_world_aabb() const;
+
+        // `true` while the mesh of the `Species` is being loaded asynchronously.
+        bool get_is_mesh_loading() const;
+
     public:
         // this method renders this `Object`.
         void render(const Scene* target_scene);
@@ -130,12 +146,19 @@ namespace yli::ontology
     private:
         void render_this_object(const Pipeline* pipeline);
 
+        CachedAncestor<Pipeline> cached_pipeline;
+
         template<typename T1, std::size_t DataSize>
         friend class memory::MemoryStorage;
 
     public:
         ChildModule child_of_scene;
         ApprenticeModule apprentice_of_species;
+
+        // Frustum culling state, managed by the `Scene`.
+        std::int32_t culling_proxy_id { -1 };
+        std::uint64_t last_visible_frame { 0 };
+        bool is_culling_dirty { false }; // Queued for the next `Scene::update_culling`.
     };
 }
 
@@ -177,7 +177,7 @@ namespace yli::ontology
             return;
         }
 
-        const Scene* const scene = this->get_scene();
+        const Scene* const scene = this->get_cached_scene();
 
         if (target_scene != nullptr && scene != nullptr && scene != target_scene)
         {
@@ -19,35 +19,38 @@
 #define YLIKUUTIO_ONTOLOGY_PRINT_CONSOLE_STRUCT_HPP_INCLUDED
 
 #include "position_struct.hpp"
-#include "code/ylikuutio/console/text_input.hpp"
 
 // Include standard headers
 #include <cstdint>  // std::uint32_t
-#include <span>     // std::span
-#include <string>   // std::string
+
+namespace yli::console
+{
+    class ConsoleGrid;
+}
+
+namespace yli::render
+{
+    class ConsoleGridMesh;
+}
 
 namespace yli::ontology
 {
     struct PrintConsoleStruct
     {
         PrintConsoleStruct(
-                const std::span<const std::string> buffer_text,
-                const console::TextInput* const text_input,
-                const std::uint32_t font_size,
-                const std::uint32_t n_columns)
-            : buffer_text { buffer_text },
-            text_input { text_input },
-            font_size { font_size },
-            n_columns { n_columns }
+                console::ConsoleGrid& console_grid,
+                render::ConsoleGridMesh& console_grid_mesh,
+                const std::uint32_t font_size)
+            : console_grid { console_grid },
+            console_grid_mesh { console_grid_mesh },
+            font_size { font_size }
         {
         }
 
-        const std::span<const std::string> buffer_text;
-        const console::TextInput* const text_input;
-        std::string prompt;
+        console::ConsoleGrid& console_grid;
+        render::ConsoleGridMesh& console_grid_mesh;
         PositionStruct position;
         std::uint32_t font_size;
-        std::uint32_t n_columns;
     };
 }
 
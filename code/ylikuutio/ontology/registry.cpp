@@ -20,13 +20,20 @@
 
 // Include standard headers
 #include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
 #include <string>  // std::string
+#include <utility> // std::move
 #include <vector>  // std::vector
 
 namespace yli::ontology
 {
     class Entity;
 
+    Registry::Registry(Registry* const universe_registry) noexcept
+        : universe_registry { universe_registry != nullptr ? universe_registry : this }
+    {
+    }
+
     bool Registry::is_name(const std::string& name) const
     {
         return (this->is_indexable(name) || this->is_entity(name));
@@ -47,7 +54,9 @@ namespace yli::ontology
         if (!name.empty() && !this->is_name(name))
         {
             this->indexable_map[name] = &indexable;
-            this->completable_string_set.add_string(name);
+            this->add_completion(name);
+            this->name_generations[name]++;
+            this->advance_universe_generation();
         }
     }
 
@@ -56,7 +65,9 @@ namespace yli::ontology
         if (!name.empty() && !this->is_name(name))
         {
             this->entity_map[name] = &entity;
-            this->completable_string_set.add_string(name);
+            this->add_completion(name);
+            this->name_generations[name]++;
+            this->advance_universe_generation();
         }
     }
 
@@ -64,23 +75,42 @@ namespace yli::ontology
     {
         if (!name.empty() && this->is_entity(name))
         {
+            this->flush_deferred_completions();
             this->completable_string_set.erase_string(name);
             this->entity_map.erase(name);
+            this->name_generations[name]++;
+            this->advance_universe_generation();
+        }
+    }
+
+    void Registry::begin_batch()
+    {
+        this->batch_depth++;
+    }
+
+    void Registry::end_batch()
+    {
+        if (this->batch_depth > 0 && --this->batch_depth == 0)
+        {
+            this->flush_deferred_completions();
         }
     }
 
     std::size_t Registry::get_number_of_completions(const std::string& input) const
     {
+        this->flush_deferred_completions();
         return this->completable_string_set.get_number_of_completions(input);
     }
 
     std::string Registry::complete(const std::string& input) const
     {
+        this->flush_deferred_completions();
         return this->completable_string_set.complete(input);
     }
 
     std::vector<std::string> Registry::get_completions(const std::string& input) const
     {
+        this->flush_deferred_completions();
         return this->completable_string_set.get_completions(input);
     }
 
@@ -152,4 +182,44 @@ namespace yli::ontology
     {
         return this->entity_map;
     }
+
+    void Registry::add_completion(const std::string& name)
+    {
+        if (this->batch_depth > 0)
+        {
+            this->deferred_completions.emplace_back(name);
+            return;
+        }
+
+        this->completable_string_set.add_string(name);
+    }
+
+    void Registry::flush_deferred_completions() const
+    {
+        if (!this->deferred_completions.empty())
+        {
+            this->completable_string_set.add_strings(std::move(this->deferred_completions));
+            this->deferred_completions.clear();
+        }
+    }
+
+    std::uint64_t Registry::get_universe_generation() const noexcept
+    {
+        return this->universe_registry->universe_generation;
+    }
+
+    void Registry::advance_universe_generation() noexcept
+    {
+        this->universe_registry->universe_generation++;
+    }
+
+    const std::size_t* Registry::get_name_generation(const std::string& name) const
+    {
+        if (const auto it = this->name_generations.find(name); it != this->name_generations.end())
+        {
+            return &it->second;
+        }
+
+        return nullptr;
+    }
 }
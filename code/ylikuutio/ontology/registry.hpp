@@ -22,6 +22,7 @@
 
 // Include standard headers
 #include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint64_t
 #include <string>        // std::string
 #include <unordered_map> // std::unordered_map
 #include <vector>        // std::vector
@@ -35,8 +36,12 @@ namespace yli::ontology
     class Registry final
     {
         public:
+            // The `Registry` of a `Universe`, or a standalone `Registry`.
             Registry() = default;
 
+            // The `Registry` of an `Entity` advances the generation of the `Registry` of its `Universe`.
+            explicit Registry(Registry* universe_registry) noexcept;
+
             Registry(const Registry&) = delete;            // Delete copy constructor.
             Registry& operator=(const Registry&) = delete; // Delete copy assignment.
 
@@ -51,6 +56,12 @@ namespace yli::ontology
 
             void erase_entity(const std::string& name);
 
+            // While a batch is open, names are bound at once but added to
+            // the completions only when the outermost batch ends, sorted.
+            // Batches may be nested.
+            void begin_batch();
+            void end_batch();
+
             std::size_t get_number_of_completions(const std::string& input) const;
             std::string complete(const std::string& input) const;
             std::vector<std::string> get_completions(const std::string& input) const;
@@ -64,16 +75,46 @@ namespace yli::ontology
             const std::unordered_map<std::string, Indexable*>& get_indexable_map() const;
             const std::unordered_map<std::string, Entity*>& get_entity_map() const;
 
+            // The generation of the `Universe`. It advances every time a name is
+            // bound or erased in any `Registry` of the `Universe`, and every time
+            // the hierarchy of the `Universe` changes, so that caches built over
+            // the whole `Universe` can be validated cheaply, see `CachedAncestor`.
+            std::uint64_t get_universe_generation() const noexcept;
+
+            void advance_universe_generation() noexcept;
+
+            // Incremented every time `name` is bound or erased. The pointer
+            // stays valid as long as this `Registry`, so a cached lookup of
+            // one name is validated without hashing the name again.
+            // `nullptr` if `name` has never been bound, as only binding
+            // creates the generation of a name. Such lookups are not cached.
+            const std::size_t* get_name_generation(const std::string& name) const;
+
         private:
+            void add_completion(const std::string& name);
+
+            // Completion queries also see the names deferred by an open batch.
+            void flush_deferred_completions() const;
+
             // Completable modules are stored here.
             // Everything stored in `indexable_map` or `entity_map` can be completed.
-            string::StringSet completable_string_set;
+            mutable string::StringSet completable_string_set;
+
+            // Names bound during an open batch, not yet in `completable_string_set`.
+            mutable std::vector<std::string> deferred_completions;
+            std::size_t batch_depth { 0 };
 
             // Indexable modules are stored here.
             std::unordered_map<std::string, Indexable*> indexable_map;
 
             // Named entities are stored here so that they can be recalled, if needed.
             std::unordered_map<std::string, Entity*> entity_map;
+
+            Registry* const universe_registry { this };
+            std::uint64_t universe_generation { 1 }; // Only that of `universe_registry` is used.
+
+            // `std::unordered_map` does not move its elements on rehash.
+            std::unordered_map<std::string, std::size_t> name_generations;
     };
 }
 
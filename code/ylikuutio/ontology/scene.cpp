@@ -22,7 +22,11 @@
 #include "scene.hpp"
 #include "universe.hpp"
 #include "pipeline.hpp"
+#include "material.hpp"
 #include "camera.hpp"
+#include "object.hpp"
+#include "holobiont.hpp"
+#include "movable.hpp"
 #include "movable_controller.hpp"
 #include "generic_entity_factory.hpp"
 #include "request.hpp"
@@ -30,6 +34,15 @@
 #include "camera_struct.hpp"
 #include "get_number_of_descendants.hpp"
 #include "code/ylikuutio/core/application.hpp"
+#include "code/ylikuutio/geometry/aabb.hpp"
+#include "code/ylikuutio/geometry/frustum.hpp"
+#include "code/ylikuutio/geometry/heightmap_visibility.hpp"
+#include "code/ylikuutio/geometry/spatial_hash_grid.hpp"
+#include "code/ylikuutio/graph/a_star.hpp"
+#include "code/ylikuutio/graph/navigation_graph.hpp"
+#include "code/ylikuutio/graph/navigation_grid.hpp"
+#include "code/ylikuutio/graph/path_cache.hpp"
+#include "code/ylikuutio/graph/path_planner.hpp"
 #include "code/ylikuutio/opengl/ubo_block_enums.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
 #include "code/ylikuutio/render/render_system.hpp"
@@ -48,8 +61,14 @@
 // Include standard headers
 #include <cmath>     // NAN
 #include <cstddef>   // std::size_t
+#include <chrono>    // std::chrono::seconds
+#include <cstdint>   // std::int32_t, std::uint8_t, std::uint32_t
+#include <future>    // std::future_status
 #include <iostream>  // std::cerr
+#include <memory>    // std::shared_ptr, std::unique_ptr
 #include <stdexcept> // std::runtime_error
+#include <utility>   // std::move
+#include <vector>    // std::erase, std::vector
 
 namespace yli::ontology
 {
@@ -111,6 +130,8 @@ namespace yli::ontology
               *this,
               this->registry,
               "glyph_objects"),
+          spatial_index(scene_struct.spatial_index_cell_size),
+          path_planner(0),
           gravity { scene_struct.gravity },
           light_position { scene_struct.light_position },
           water_level { scene_struct.water_level },
@@ -152,6 +173,25 @@ namespace yli::ontology
             // Set active `Scene` to `nullptr`.
             this->universe.set_active_scene(nullptr);
         }
+
+        // The culling tree is destroyed before the `Object`s, so forget the proxies now.
+        for (Entity* const object_entity : this->parent_of_objects.child_pointer_vector)
+        {
+            if (auto* const object = static_cast<Object*>(object_entity); object != nullptr)
+            {
+                object->culling_proxy_id = geometry::DynamicAabbTree::null_node;
+                object->is_culling_dirty = false;
+                object->spatial_proxy_id = geometry::SpatialHashGrid::null_proxy;
+            }
+        }
+
+        for (Entity* const holobiont_entity : this->parent_of_holobionts.child_pointer_vector)
+        {
+            if (auto* const holobiont = static_cast<Holobiont*>(holobiont_entity); holobiont != nullptr)
+            {
+                holobiont->spatial_proxy_id = geometry::SpatialHashGrid::null_proxy;
+            }
+        }
     }
 
     void Scene::do_physics()
@@ -159,8 +199,11 @@ namespace yli::ontology
         // TODO: implement physics!
     }
 
-    void Scene::update() const
+    void Scene::update()
     {
+        // The actors see the locations at the start of the tick in their neighbour queries.
+        this->update_spatial_index();
+
         // Intentional actors (AIs and keyboard controlled ones).
 
         for (Entity* const movable_controller_entity : this->parent_of_movable_controllers.child_pointer_vector)
@@ -172,6 +215,17 @@ namespace yli::ontology
         }
     }
 
+    void Scene::animate(const double time)
+    {
+        for (Entity* const material_entity : this->parent_of_materials.child_pointer_vector)
+        {
+            if (auto* const material = static_cast<Material*>(material_entity); material != nullptr)
+            {
+                material->animate(time);
+            }
+        }
+    }
+
     void Scene::activate()
     {
         // This function should be called upon `Camera::render`
@@ -206,10 +260,312 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `Scene::render`: Vulkan is not supported yet!");
         }
 
+        this->update_culling(this->universe.get_projection_matrix() * this->universe.get_view_matrix());
+
         render_system.render_pipelines_of_ecosystems(this->universe.get_parent_of_ecosystems(), this);
         render_system.render_pipelines(this->parent_of_pipelines, this);
     }
 
+    void Scene::update_culling(const glm::mat4& view_projection_matrix)
+    {
+        this->culling_frame++;
+
+        // `Object`s that have not moved keep their proxies as they are.
+        std::size_t n_kept_objects = 0;
+
+        for (Object* const object : this->culling_dirty_objects)
+        {
+            const geometry::Aabb world_aabb = object->get_world_aabb();
+
+            if (world_aabb.is_empty())
+            {
+                // No bounds (e.g. no vertices loaded), never culled.
+                if (object->culling_proxy_id != geometry::DynamicAabbTree::null_node)
+                {
+                    this->culling_tree.destroy_proxy(object->culling_proxy_id);
+                    object->culling_proxy_id = geometry::DynamicAabbTree::null_node;
+                }
+
+                if (object->get_is_mesh_loading())
+                {
+                    // Sync again once the mesh has been loaded and has bounds.
+                    this->culling_dirty_objects[n_kept_objects++] = object;
+                    continue;
+                }
+            }
+            else if (object->culling_proxy_id == geometry::DynamicAabbTree::null_node)
+            {
+                object->culling_proxy_id = this->culling_tree.create_proxy(world_aabb, object);
+            }
+            else
+            {
+                this->culling_tree.move_proxy(object->culling_proxy_id, world_aabb);
+            }
+
+            object->is_culling_dirty = false;
+        }
+
+        this->culling_dirty_objects.resize(n_kept_objects);
+
+        const geometry::Frustum frustum(view_projection_matrix);
+        const std::uint64_t culling_frame = this->culling_frame;
+
+        this->culling_tree.query(
+                frustum,
+                [culling_frame](void* const user_data)
+                {
+                    static_cast<Object*>(user_data)->last_visible_frame = culling_frame;
+                });
+    }
+
+    bool Scene::is_culled(const Object& object) const noexcept
+    {
+        return object.culling_proxy_id != geometry::DynamicAabbTree::null_node &&
+            object.last_visible_frame != this->culling_frame;
+    }
+
+    void Scene::mark_culling_dirty(Object& object)
+    {
+        if (!object.is_culling_dirty)
+        {
+            object.is_culling_dirty = true;
+            this->culling_dirty_objects.push_back(&object);
+        }
+    }
+
+    void Scene::remove_from_culling(Object& object)
+    {
+        if (object.is_culling_dirty)
+        {
+            std::erase(this->culling_dirty_objects, &object);
+            object.is_culling_dirty = false;
+        }
+
+        if (object.culling_proxy_id != geometry::DynamicAabbTree::null_node)
+        {
+            this->culling_tree.destroy_proxy(object.culling_proxy_id);
+            object.culling_proxy_id = geometry::DynamicAabbTree::null_node;
+        }
+    }
+
+    const geometry::DynamicAabbTree& Scene::get_culling_tree() const noexcept
+    {
+        return this->culling_tree;
+    }
+
+    void Scene::update_spatial_index()
+    {
+        // Locations are written directly in many places, so all indexed `Movable`s
+        // are synced once per tick. Only those that changed cell touch the grid.
+        for (Entity* const object_entity : this->parent_of_objects.child_pointer_vector)
+        {
+            if (auto* const object = static_cast<Object*>(object_entity); object != nullptr)
+            {
+                this->add_to_spatial_index(*object);
+            }
+        }
+
+        for (Entity* const holobiont_entity : this->parent_of_holobionts.child_pointer_vector)
+        {
+            if (auto* const holobiont = static_cast<Holobiont*>(holobiont_entity); holobiont != nullptr)
+            {
+                this->add_to_spatial_index(*holobiont);
+            }
+        }
+    }
+
+    void Scene::add_to_spatial_index(Movable& movable)
+    {
+        if (movable.spatial_proxy_id == geometry::SpatialHashGrid::null_proxy)
+        {
+            movable.spatial_proxy_id = this->spatial_index.create_proxy(movable.location.xyz, movable.allegiance, &movable);
+        }
+        else
+        {
+            this->spatial_index.move_proxy(movable.spatial_proxy_id, movable.location.xyz, movable.allegiance);
+        }
+    }
+
+    void Scene::update_spatial_index(Movable& movable)
+    {
+        if (movable.spatial_proxy_id != geometry::SpatialHashGrid::null_proxy)
+        {
+            this->spatial_index.move_proxy(movable.spatial_proxy_id, movable.location.xyz, movable.allegiance);
+        }
+    }
+
+    void Scene::remove_from_spatial_index(Movable& movable)
+    {
+        if (movable.spatial_proxy_id != geometry::SpatialHashGrid::null_proxy)
+        {
+            this->spatial_index.destroy_proxy(movable.spatial_proxy_id);
+            movable.spatial_proxy_id = geometry::SpatialHashGrid::null_proxy;
+        }
+    }
+
+    const geometry::SpatialHashGrid& Scene::get_spatial_index() const noexcept
+    {
+        return this->spatial_index;
+    }
+
+    void Scene::get_movables_within_radius(
+            const glm::vec3& center,
+            const float radius,
+            const geometry::SpatialQueryFilter& filter,
+            std::vector<Movable*>& movables) const
+    {
+        std::vector<geometry::SpatialNeighbour>& neighbours = this->spatial_neighbours;
+        neighbours.clear();
+        this->spatial_index.query_radius(center, radius, filter, neighbours);
+        geometry::SpatialHashGrid::sort_nearest_first(neighbours);
+
+        for (const geometry::SpatialNeighbour& neighbour : neighbours)
+        {
+            movables.emplace_back(static_cast<Movable*>(this->spatial_index.get_user_data(neighbour.proxy_id)));
+        }
+    }
+
+    void Scene::get_nearest_movables(
+            const glm::vec3& center,
+            const std::size_t k,
+            const geometry::SpatialQueryFilter& filter,
+            std::vector<Movable*>& movables) const
+    {
+        std::vector<geometry::SpatialNeighbour>& neighbours = this->spatial_neighbours;
+        this->spatial_index.query_nearest(center, k, filter, neighbours);
+
+        for (const geometry::SpatialNeighbour& neighbour : neighbours)
+        {
+            movables.emplace_back(static_cast<Movable*>(this->spatial_index.get_user_data(neighbour.proxy_id)));
+        }
+    }
+
+    void Scene::set_terrain_visibility(std::unique_ptr<geometry::HeightmapVisibility> terrain_visibility)
+    {
+        this->terrain_visibility = std::move(terrain_visibility);
+        this->viewsheds.clear();
+    }
+
+    const geometry::HeightmapVisibility* Scene::get_terrain_visibility() const noexcept
+    {
+        return this->terrain_visibility.get();
+    }
+
+    bool Scene::is_line_of_sight(const glm::vec3& from, const glm::vec3& to) const
+    {
+        if (this->terrain_visibility == nullptr)
+        {
+            return true;
+        }
+
+        return this->terrain_visibility->is_line_of_sight(from, to);
+    }
+
+    bool Scene::is_line_of_sight_from_any(
+            const glm::vec3& target,
+            const float radius,
+            const geometry::SpatialQueryFilter& filter) const
+    {
+        std::vector<geometry::SpatialNeighbour>& neighbours = this->spatial_neighbours;
+        neighbours.clear();
+        this->spatial_index.query_radius(target, radius, filter, neighbours);
+
+        if (neighbours.empty())
+        {
+            return false;
+        }
+
+        if (this->terrain_visibility == nullptr)
+        {
+            return true;
+        }
+
+        // Test all the rays as one batch.
+        this->line_of_sight_origins.clear();
+
+        for (const geometry::SpatialNeighbour& neighbour : neighbours)
+        {
+            this->line_of_sight_origins.emplace_back(this->spatial_index.get_point(neighbour.proxy_id));
+        }
+
+        this->line_of_sight_targets.assign(neighbours.size(), target);
+        this->line_of_sight_results.resize(neighbours.size());
+        this->terrain_visibility->are_lines_of_sight(
+                this->line_of_sight_origins.data(),
+                this->line_of_sight_targets.data(),
+                neighbours.size(),
+                this->line_of_sight_results.data());
+
+        for (const std::uint8_t result : this->line_of_sight_results)
+        {
+            if (result != 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    const geometry::Viewshed& Scene::get_viewshed(const glm::vec3& observer)
+    {
+        // There are few static observers, so a linear search is enough.
+        for (const geometry::Viewshed& viewshed : this->viewsheds)
+        {
+            if (viewshed.get_observer() == observer)
+            {
+                return viewshed;
+            }
+        }
+
+        if (this->terrain_visibility == nullptr)
+        {
+            static const geometry::Viewshed empty_viewshed;
+            return empty_viewshed;
+        }
+
+        return this->viewsheds.emplace_back(this->terrain_visibility->compute_viewshed(observer));
+    }
+
+    graph::PathPlanner& Scene::get_path_planner() noexcept
+    {
+        return this->path_planner;
+    }
+
+    bool Scene::is_path_known(const graph::PathDomain domain, const glm::vec3& from, const glm::vec3& to)
+    {
+        std::uint32_t start = graph::invalid_node;
+        std::uint32_t goal = graph::invalid_node;
+
+        if (domain == graph::PathDomain::GRID)
+        {
+            if (const std::shared_ptr<const graph::NavigationGrid> grid = this->path_planner.get_navigation_grid(); grid != nullptr)
+            {
+                start = grid->get_cell_at(from);
+                goal = grid->get_cell_at(to);
+            }
+        }
+        else if (const std::shared_ptr<const graph::NavigationGraph> graph = this->path_planner.get_navigation_graph(); graph != nullptr)
+        {
+            start = graph->get_nearest_node(from);
+            goal = graph->get_nearest_node(to);
+        }
+
+        if (start == graph::invalid_node || goal == graph::invalid_node)
+        {
+            return false;
+        }
+
+        const graph::PathPlanner::PathFuture future = this->path_planner.request_path(domain, start, goal);
+
+        if (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return false;
+        }
+
+        return future.get()->is_found();
+    }
+
     Camera* Scene::get_default_camera() const
     {
         return static_cast<Camera*>(this->parent_of_cameras.get(0));
@@ -22,6 +22,11 @@
 #include "child_module.hpp"
 #include "generic_parent_module.hpp"
 #include "parent_of_pipelines_module.hpp"
+#include "code/ylikuutio/geometry/dynamic_aabb_tree.hpp"
+#include "code/ylikuutio/geometry/heightmap_visibility.hpp"
+#include "code/ylikuutio/geometry/spatial_hash_grid.hpp"
+#include "code/ylikuutio/graph/path_cache.hpp"
+#include "code/ylikuutio/graph/path_planner.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
 
 // Include GLM
@@ -33,6 +38,9 @@
 // Include standard headers
 #include <cmath>   // NAN
 #include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t, std::uint64_t
+#include <memory>  // std::unique_ptr
+#include <vector>  // std::vector
 
 // How `Scene` class works:
 //
@@ -53,6 +61,16 @@
 //
 // When a `Scene` is deleted:
 // 1. Every child of `Scene` gets deleted as usual, including the `Camera`s.
+//
+// Frustum culling:
+// Every `Object` whose `Species` mesh has bounds gets a proxy in the
+// `DynamicAabbTree` of its `Scene`. `Object`s are queued for syncing when
+// they are created, rebound or moved, see `Movable::notify_moved`. At the
+// beginning of `Scene::render` only the proxies of the queued `Object`s
+// are synced (a proxy is only reinserted when its `Object` leaves its
+// fattened `Aabb`), then the tree is queried with the view frustum and
+// the visible `Object`s are stamped with the current culling frame.
+// `Object::render` skips the rest.
 
 namespace yli::core
 {
@@ -80,6 +98,7 @@ namespace yli::ontology
     class Shapeshifter;
     class Text3d;
     class GlyphObject;
+    class Movable;
     class RigidBodyModule;
     struct SceneStruct;
 
@@ -103,13 +122,80 @@ namespace yli::ontology
         void do_physics();
 
         // Intentional actors (AIs and keyboard controlled ones).
-        void update() const;
+        void update();
+
+        // Blends the forms of the `ShapeshifterTransformation`s of the `Material`s of this `Scene`.
+        void animate(double time);
 
         void activate() override;
 
         // this method renders all `Pipeline`s of this `Scene`.
         void render();
 
+        // Sync the proxies of the queued `Object`s and mark the `Object`s inside the view frustum.
+        void update_culling(const glm::mat4& view_projection_matrix);
+
+        // Queue `object` for syncing its culling proxy in the next `update_culling`.
+        void mark_culling_dirty(Object& object);
+
+        bool is_culled(const Object& object) const noexcept;
+
+        void remove_from_culling(Object& object);
+
+        const geometry::DynamicAabbTree& get_culling_tree() const noexcept;
+
+        // Sync the spatial index with the locations of the `Object`s and `Holobiont`s.
+        void update_spatial_index();
+
+        // Index `movable`, or sync it if it is already indexed.
+        void add_to_spatial_index(Movable& movable);
+
+        // Sync `movable` if it is indexed, e.g. after its location was set.
+        void update_spatial_index(Movable& movable);
+
+        void remove_from_spatial_index(Movable& movable);
+
+        const geometry::SpatialHashGrid& get_spatial_index() const noexcept;
+
+        // Append the indexed `Movable`s within `radius` of `center`, nearest first.
+        void get_movables_within_radius(
+                const glm::vec3& center,
+                float radius,
+                const geometry::SpatialQueryFilter& filter,
+                std::vector<Movable*>& movables) const;
+
+        // Append the `k` nearest indexed `Movable`s, nearest first.
+        void get_nearest_movables(
+                const glm::vec3& center,
+                std::size_t k,
+                const geometry::SpatialQueryFilter& filter,
+                std::vector<Movable*>& movables) const;
+
+        // Terrain for the line of sight queries, `nullptr` if the terrain is not known.
+        void set_terrain_visibility(std::unique_ptr<geometry::HeightmapVisibility> terrain_visibility);
+
+        const geometry::HeightmapVisibility* get_terrain_visibility() const noexcept;
+
+        // `true` if the terrain does not block the segment, also if the terrain is not known.
+        bool is_line_of_sight(const glm::vec3& from, const glm::vec3& to) const;
+
+        // `true` if any indexed `Movable` within `radius` of `target` accepted by `filter` has a line of sight to `target`.
+        bool is_line_of_sight_from_any(
+                const glm::vec3& target,
+                float radius,
+                const geometry::SpatialQueryFilter& filter) const;
+
+        // Viewshed of a static observer, computed on first use and cached until the terrain changes.
+        // Empty if the terrain is not known.
+        const geometry::Viewshed& get_viewshed(const glm::vec3& observer);
+
+        // Navigation data is given to the `PathPlanner` of this `Scene`.
+        graph::PathPlanner& get_path_planner() noexcept;
+
+        // `true` if a path from the node nearest to `from` to the node nearest to `to` has been found.
+        // Does not wait: if the path has not been planned yet, requests it and returns `false`.
+        bool is_path_known(graph::PathDomain domain, const glm::vec3& from, const glm::vec3& to);
+
         Camera* get_default_camera() const;
 
         Camera* get_active_camera() const;
@@ -168,6 +254,21 @@ namespace yli::ontology
     private:
         Camera* active_camera { nullptr };
 
+        geometry::DynamicAabbTree culling_tree;
+        std::uint64_t culling_frame { 0 };
+        std::vector<Object*> culling_dirty_objects;
+
+        geometry::SpatialHashGrid spatial_index;
+        mutable std::vector<geometry::SpatialNeighbour> spatial_neighbours;
+
+        std::unique_ptr<geometry::HeightmapVisibility> terrain_visibility;
+        std::vector<geometry::Viewshed> viewsheds;
+        mutable std::vector<glm::vec3> line_of_sight_origins;
+        mutable std::vector<glm::vec3> line_of_sight_targets;
+        mutable std::vector<std::uint8_t> line_of_sight_results;
+
+        graph::PathPlanner path_planner;
+
         // Variables related to location and orientation.
 
         // `cartesian_coordinates` can be accessed as a vector or as single coordinates `x`, `y`, `z`.
@@ -37,6 +37,7 @@ namespace yli::ontology
         glm::vec4 light_position { 0.0f, 0.0f, 0.0f, 1.0f }; // Default light position: origin.
         float water_level { 0.0f };                          // Default water level: 0.0 meters.
         bool is_flight_mode_in_use { true };
+        float spatial_index_cell_size { 16.0f };             // Cell size of the neighbour query grid.
     };
 }
 
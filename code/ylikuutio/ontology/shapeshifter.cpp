@@ -16,11 +16,38 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "shapeshifter.hpp"
+#include "universe.hpp"
 #include "scene.hpp"
+#include "shapeshifter_transformation.hpp"
 #include "shapeshifter_struct.hpp"
+#include "code/ylikuutio/opengl/ubo_block_enums.hpp"
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+#ifndef __GLM_GTC_TYPE_PTR_HPP_INCLUDED
+#define __GLM_GTC_TYPE_PTR_HPP_INCLUDED
+#include <glm/gtc/type_ptr.hpp> // glm::value_ptr
+#endif
+
+#ifndef __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#define __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#include <glm/gtc/matrix_transform.hpp>
+#endif
+
+#ifndef __GLM_GTC_QUATERNION_HPP_INCLUDED
+#define __GLM_GTC_QUATERNION_HPP_INCLUDED
+#include <glm/gtc/quaternion.hpp> // glm::quat
+#endif
 
 // Include standard headers
-#include <cstddef> // std::size_t
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <stdexcept> // std::runtime_error
 
 namespace yli::core
 {
@@ -52,7 +79,8 @@ namespace yli::ontology
               shapeshifter_struct,
               movable_controller_master_module),
           child_of_scene(scene_parent_module, *this),
-          apprentice_of_shapeshifter_sequence(shapeshifter_sequence_master_module, this)
+          apprentice_of_shapeshifter_sequence(shapeshifter_sequence_master_module, this),
+          morph_time_offset { shapeshifter_struct.morph_time_offset }
     {
         // `Entity` member variables begin here.
         this->type_string = "yli::ontology::Shapeshifter*";
@@ -73,4 +101,65 @@ namespace yli::ontology
     {
         return this->child_of_scene.get_scene();
     }
+
+    float Shapeshifter::get_morph_time_offset() const
+    {
+        return this->morph_time_offset;
+    }
+
+    std::uint32_t Shapeshifter::get_morph_slot() const
+    {
+        return this->morph_slot;
+    }
+
+    void Shapeshifter::set_morph_slot(const std::uint32_t morph_slot)
+    {
+        this->morph_slot = morph_slot;
+    }
+
+    void Shapeshifter::render_this_shapeshifter(const ShapeshifterTransformation& shapeshifter_transformation)
+    {
+        this->model_matrix = glm::mat4(1.0f);
+
+        if (this->initial_rotate_vectors.size() == this->initial_rotate_angles.size()) [[likely]]
+        {
+            for (std::size_t i = 0; i < this->initial_rotate_vectors.size() && i < this->initial_rotate_angles.size();
+                 i++)
+            {
+                this->model_matrix = glm::rotate(this->model_matrix, this->initial_rotate_angles[i],
+                                                 this->initial_rotate_vectors[i]);
+            }
+        }
+
+        this->model_matrix = glm::scale(this->model_matrix, this->scale * this->original_scale_vector);
+        const glm::vec3 euler_angles { this->orientation.roll, -this->orientation.pitch, this->orientation.yaw };
+        const auto my_quaternion = glm::quat(euler_angles);
+        const glm::mat4 rotation_matrix = glm::mat4_cast(my_quaternion);
+        this->model_matrix = rotation_matrix * this->model_matrix;
+        this->model_matrix[3][0] = this->location.get_x();
+        this->model_matrix[3][1] = this->location.get_y();
+        this->model_matrix[3][2] = this->location.get_z();
+
+        this->mvp_matrix = this->universe.get_projection_matrix() * this->universe.get_view_matrix() * this->
+                           model_matrix;
+
+        if (this->universe.get_is_opengl_in_use()) [[likely]]
+        {
+            // Send our transformation to the uniform buffer object (UBO).
+            glBindBuffer(GL_UNIFORM_BUFFER, this->movable_uniform_block);
+            glBufferSubData(GL_UNIFORM_BUFFER, opengl::movable_ubo::MovableUboBlockOffsets::MVP, sizeof(glm::mat4),
+                            glm::value_ptr(this->mvp_matrix)); // mat4
+            glBufferSubData(GL_UNIFORM_BUFFER, opengl::movable_ubo::MovableUboBlockOffsets::M, sizeof(glm::mat4),
+                            glm::value_ptr(this->model_matrix)); // mat4
+            glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+            glBindBufferBase(GL_UNIFORM_BUFFER, opengl::UboBlockIndices::MOVABLE, this->movable_uniform_block);
+
+            shapeshifter_transformation.render_morph_slot(this->morph_slot);
+        }
+        else if (this->universe.get_is_vulkan_in_use())
+        {
+            throw std::runtime_error("ERROR: `Shapeshifter::render_this_shapeshifter`: Vulkan is not supported yet!");
+        }
+    }
 }
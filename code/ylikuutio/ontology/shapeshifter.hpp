@@ -24,6 +24,7 @@
 
 // Include standard headers
 #include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t
 
 namespace yli::core
 {
@@ -37,6 +38,7 @@ namespace yli::ontology
     class Entity;
     class Universe;
     class Scene;
+    class ShapeshifterTransformation;
     struct ShapeshifterStruct;
 
     class Shapeshifter : public Movable
@@ -63,8 +65,23 @@ namespace yli::ontology
 
         Scene* get_scene() const final;
 
+        // Added to the animation time, so that `Shapeshifter`s of the same `ShapeshifterSequence` can be out of step.
+        float get_morph_time_offset() const;
+
+        // Slot of the blended mesh in the `animation::MorphEvaluator` of the `ShapeshifterTransformation`.
+        std::uint32_t get_morph_slot() const;
+
+        void set_morph_slot(const std::uint32_t morph_slot);
+
+        // Draws the blended mesh of the morph slot of this `Shapeshifter`.
+        void render_this_shapeshifter(const ShapeshifterTransformation& shapeshifter_transformation);
+
         ChildModule child_of_scene;
         ApprenticeModule apprentice_of_shapeshifter_sequence;
+
+    private:
+        float morph_time_offset;
+        std::uint32_t morph_slot { 0 };
     };
 }
 
@@ -63,7 +63,7 @@ namespace yli::ontology
                 "ERROR: `ShapeshifterForm::get_scene`: `shapeshifter_transformation_parent` is `nullptr`!");
         }
 
-        return shapeshifter_transformation_parent->get_scene();
+        return shapeshifter_transformation_parent->get_cached_scene();
     }
 
     Pipeline* ShapeshifterForm::get_pipeline() const
@@ -77,6 +77,11 @@ namespace yli::ontology
         return nullptr;
     }
 
+    const MeshModule& ShapeshifterForm::get_mesh() const
+    {
+        return this->mesh;
+    }
+
     std::size_t ShapeshifterForm::get_number_of_children() const
     {
         return 0; // `ShapeshifterForm` has no children.
@@ -73,6 +73,8 @@ namespace yli::ontology
 
         Pipeline* get_pipeline() const;
 
+        const MeshModule& get_mesh() const;
+
         std::size_t get_number_of_children() const override;
 
         std::size_t get_number_of_descendants() const override;
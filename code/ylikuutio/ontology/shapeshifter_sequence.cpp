@@ -18,8 +18,11 @@
 #include "shapeshifter_sequence.hpp"
 #include "entity.hpp"
 #include "shapeshifter_transformation.hpp"
+#include "shapeshifter.hpp"
+#include "apprentice_module.hpp"
 #include "shapeshifter_sequence_struct.hpp"
 #include "get_number_of_descendants.hpp"
+#include "code/ylikuutio/animation/morph_animation.hpp"
 
 // Include standard headers
 #include <cstddef>   // std::size_t
@@ -73,7 +76,7 @@ namespace yli::ontology
                 "ERROR: `ShapeshifterSequence::get_scene`: `shapeshifter_transformation_parent` is `nullptr`!");
         }
 
-        return shapeshifter_transformation_parent->get_scene();
+        return shapeshifter_transformation_parent->get_cached_scene();
     }
 
     Pipeline* ShapeshifterSequence::get_pipeline() const
@@ -100,10 +103,51 @@ namespace yli::ontology
         return 0; // `ShapeshifterSequence` has no children.
     }
 
-    void ShapeshifterSequence::render(const Scene* const /* target_scene */)
+    void ShapeshifterSequence::render(const Scene* const target_scene)
     {
-        // Render this `ShapeshifterSequence`.
+        // Render the `Shapeshifter`s of this `ShapeshifterSequence`,
+        // each with the blended mesh of its morph slot.
 
-        // TODO.
+        const auto* const shapeshifter_transformation = static_cast<const ShapeshifterTransformation*>(this->get_parent());
+
+        if (shapeshifter_transformation == nullptr) [[unlikely]]
+        {
+            return;
+        }
+
+        for (const ApprenticeModule* const apprentice_module :
+                this->master_of_shapeshifters.get_apprentice_module_pointer_vector_const_reference())
+        {
+            if (apprentice_module == nullptr)
+            {
+                continue;
+            }
+
+            auto* const shapeshifter = static_cast<Shapeshifter*>(apprentice_module->get_apprentice());
+
+            if (shapeshifter == nullptr || !shapeshifter->should_render)
+            {
+                continue;
+            }
+
+            if (const Scene* const scene = shapeshifter->get_cached_scene();
+                    target_scene != nullptr && scene != nullptr && scene != target_scene)
+            {
+                // Different `Scene`s, do not render.
+                continue;
+            }
+
+            shapeshifter->render_this_shapeshifter(*shapeshifter_transformation);
+        }
+    }
+
+    animation::MorphPlayback ShapeshifterSequence::get_morph_playback() const
+    {
+        return animation::MorphPlayback {
+            this->transformation_speed,
+            this->initial_offset,
+            this->is_repeating_transformation,
+            this->bounce_from_start,
+            this->bounce_from_end };
     }
 }
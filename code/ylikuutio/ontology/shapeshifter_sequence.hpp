@@ -21,6 +21,7 @@
 #include "entity.hpp"
 #include "child_module.hpp"
 #include "generic_master_module.hpp"
+#include "code/ylikuutio/animation/morph_animation.hpp"
 
 // Include standard headers
 #include <cstddef> // std::size_t
@@ -91,6 +92,8 @@ namespace yli::ontology
 
         void render(const Scene* const target_scene);
 
+        animation::MorphPlayback get_morph_playback() const;
+
     private:
         float transformation_speed; // Negative speed means inverse initial transition direction.
         std::size_t initial_offset; // Index of the `ShapeshifterForm` from which to begin the transition.
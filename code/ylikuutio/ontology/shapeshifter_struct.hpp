@@ -40,6 +40,7 @@ namespace yli::ontology
         }
 
         Request<ShapeshifterSequence> shapeshifter_sequence_master {};
+        float morph_time_offset { 0.0f }; // Seconds added to the animation time of this `Shapeshifter`.
     };
 }
 
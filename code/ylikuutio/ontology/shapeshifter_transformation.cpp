@@ -19,17 +19,32 @@
 #include "universe.hpp"
 #include "material.hpp"
 #include "shapeshifter_sequence.hpp"
+#include "shapeshifter_form.hpp"
+#include "shapeshifter.hpp"
+#include "mesh_module.hpp"
+#include "apprentice_module.hpp"
 #include "shapeshifter_transformation_struct.hpp"
 #include "get_number_of_descendants.hpp"
+#include "code/ylikuutio/animation/morph_animation.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/opengl/opengl.hpp"
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
 #include "code/ylikuutio/render/render_system.hpp"
 #include "code/ylikuutio/render/render_templates.hpp"
 
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
 // Include standard headers
 #include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
 #include <iostream>  // std::cout, std::cerr
 #include <optional>  // std::optional
 #include <stdexcept> // std::runtime_error
+#include <vector>    // std::vector
 
 namespace yli::core
 {
@@ -92,6 +107,17 @@ namespace yli::ontology
         this->can_be_erased = true;
     }
 
+    ShapeshifterTransformation::~ShapeshifterTransformation()
+    {
+        if (this->morph_vao != 0)
+        {
+            glDeleteBuffers(1, &this->morph_vertex_buffer);
+            glDeleteBuffers(1, &this->morph_uv_buffer);
+            glDeleteBuffers(1, &this->morph_normal_buffer);
+            glDeleteVertexArrays(1, &this->morph_vao);
+        }
+    }
+
     void ShapeshifterTransformation::render(const Scene* const target_scene)
     {
         if (!this->should_render)
@@ -99,7 +125,7 @@ namespace yli::ontology
             return;
         }
 
-        const Scene* const scene = this->get_scene();
+        const Scene* const scene = this->get_cached_scene();
 
         if (target_scene != nullptr && scene != nullptr && scene != target_scene)
         {
@@ -109,11 +135,301 @@ namespace yli::ontology
 
         const Scene* const new_target_scene = (target_scene != nullptr ? target_scene : scene);
 
+        if (this->universe.get_is_opengl_in_use())
+        {
+            this->upload_morph_slots();
+        }
+        else if (this->universe.get_is_vulkan_in_use())
+        {
+            throw std::runtime_error("ERROR: `ShapeshifterTransformation::render`: Vulkan is not supported yet!");
+        }
+
         render::RenderSystem& render_system = this->universe.get_render_system();
 
         render_system.render_shapeshifter_sequences(this->parent_of_shapeshifter_sequences, new_target_scene);
     }
 
+    void ShapeshifterTransformation::animate(const double time)
+    {
+        this->update_morph_target_buffer();
+        this->morph_evaluator.begin_frame();
+
+        const std::size_t n_forms = this->morph_target_buffer.get_number_of_forms();
+
+        for (Entity* const sequence_entity : this->parent_of_shapeshifter_sequences.child_pointer_vector)
+        {
+            if (sequence_entity == nullptr)
+            {
+                continue;
+            }
+
+            const ShapeshifterSequence& shapeshifter_sequence = static_cast<const ShapeshifterSequence&>(*sequence_entity);
+            const animation::MorphPlayback playback = shapeshifter_sequence.get_morph_playback();
+
+            for (const ApprenticeModule* const apprentice_module :
+                    shapeshifter_sequence.master_of_shapeshifters.get_apprentice_module_pointer_vector_const_reference())
+            {
+                if (apprentice_module == nullptr)
+                {
+                    continue;
+                }
+
+                if (auto* shapeshifter = static_cast<Shapeshifter*>(apprentice_module->get_apprentice()); shapeshifter != nullptr)
+                {
+                    const animation::MorphPhase phase = animation::get_morph_phase(
+                            playback, n_forms, time + shapeshifter->get_morph_time_offset());
+                    shapeshifter->set_morph_slot(this->morph_evaluator.request(phase));
+                }
+            }
+        }
+
+        this->morph_evaluator.evaluate(this->morph_target_buffer);
+        this->is_morph_upload_pending = true;
+    }
+
+    void ShapeshifterTransformation::render_morph_slot(const std::uint32_t morph_slot) const
+    {
+        const std::size_t n_vertices = this->morph_target_buffer.get_number_of_vertices();
+
+        if (!this->universe.get_is_opengl_in_use() ||
+                this->morph_vao == 0 ||
+                n_vertices == 0 ||
+                (static_cast<std::size_t>(morph_slot) + 1) * n_vertices > this->morph_vertices.size())
+        {
+            // Not animated yet, or the forms do not match.
+            return;
+        }
+
+        const MeshModule* mesh = nullptr;
+
+        for (const Entity* const form_entity : this->parent_of_shapeshifter_forms.child_pointer_vector)
+        {
+            if (form_entity != nullptr)
+            {
+                mesh = &static_cast<const ShapeshifterForm*>(form_entity)->get_mesh();
+                break;
+            }
+        }
+
+        if (mesh == nullptr) [[unlikely]]
+        {
+            return;
+        }
+
+        const GLint vertex_position_modelspace_id = mesh->get_vertex_position_modelspace_id();
+        const GLint vertex_uv_id = mesh->get_vertex_uv_id();
+        const GLint vertex_normal_modelspace_id = mesh->get_vertex_normal_modelspace_id();
+        const bool has_normals = !this->morph_normals.empty();
+
+        // The slots are back to back, so the slot is selected with the offsets of the blended attributes.
+        const std::size_t slot_offset = static_cast<std::size_t>(morph_slot) * n_vertices * sizeof(glm::vec3);
+
+        glBindVertexArray(this->morph_vao);
+
+        // 1st attribute buffer: blended vertices.
+        glBindBuffer(GL_ARRAY_BUFFER, this->morph_vertex_buffer);
+        glVertexAttribPointer(
+            vertex_position_modelspace_id, // The attribute we want to configure
+            3, // size
+            GL_FLOAT, // type
+            GL_FALSE, // normalized?
+            0, // stride
+            reinterpret_cast<const void*>(slot_offset) // array buffer offset
+        );
+        opengl::enable_vertex_attrib_array(vertex_position_modelspace_id);
+
+        // 2nd attribute buffer: UVs of the first form.
+        glBindBuffer(GL_ARRAY_BUFFER, this->morph_uv_buffer);
+        glVertexAttribPointer(
+            vertex_uv_id, // The attribute we want to configure
+            2, // size : U+V => 2
+            GL_FLOAT, // type
+            GL_FALSE, // normalized?
+            0, // stride
+            nullptr // array buffer offset
+        );
+        opengl::enable_vertex_attrib_array(vertex_uv_id);
+
+        if (has_normals)
+        {
+            // 3rd attribute buffer: blended normals.
+            glBindBuffer(GL_ARRAY_BUFFER, this->morph_normal_buffer);
+            glVertexAttribPointer(
+                vertex_normal_modelspace_id, // The attribute we want to configure
+                3, // size
+                GL_FLOAT, // type
+                GL_FALSE, // normalized?
+                0, // stride
+                reinterpret_cast<const void*>(slot_offset) // array buffer offset
+            );
+            opengl::enable_vertex_attrib_array(vertex_normal_modelspace_id);
+        }
+
+        // Draw the triangles!
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(n_vertices));
+
+        opengl::disable_vertex_attrib_array(vertex_position_modelspace_id);
+        opengl::disable_vertex_attrib_array(vertex_uv_id);
+
+        if (has_normals)
+        {
+            opengl::disable_vertex_attrib_array(vertex_normal_modelspace_id);
+        }
+    }
+
+    const animation::MorphTargetBuffer& ShapeshifterTransformation::get_morph_target_buffer() const
+    {
+        return this->morph_target_buffer;
+    }
+
+    const animation::MorphEvaluator& ShapeshifterTransformation::get_morph_evaluator() const
+    {
+        return this->morph_evaluator;
+    }
+
+    void ShapeshifterTransformation::update_morph_target_buffer()
+    {
+        std::size_t n_forms = 0;
+        std::size_t n_vertices = 0;
+
+        for (const Entity* const form_entity : this->parent_of_shapeshifter_forms.child_pointer_vector)
+        {
+            if (form_entity != nullptr)
+            {
+                n_vertices = static_cast<const ShapeshifterForm*>(form_entity)->get_mesh().get_vertices().size();
+                n_forms++;
+            }
+        }
+
+        if (n_forms == this->morph_target_buffer.get_number_of_forms() &&
+                n_vertices == this->morph_target_buffer.get_number_of_vertices())
+        {
+            return;
+        }
+
+        this->morph_target_buffer.clear();
+
+        for (const Entity* const form_entity : this->parent_of_shapeshifter_forms.child_pointer_vector)
+        {
+            if (form_entity == nullptr)
+            {
+                continue;
+            }
+
+            const MeshModule& mesh = static_cast<const ShapeshifterForm*>(form_entity)->get_mesh();
+            const bool has_normals = !mesh.get_normals().empty();
+
+            if (mesh.get_vertices().size() != n_vertices ||
+                    (has_normals && mesh.get_normals().size() != n_vertices) ||
+                    (this->morph_target_buffer.get_number_of_forms() > 0 &&
+                     has_normals != (this->morph_target_buffer.get_number_of_components() == 6)))
+            {
+                // The forms do not match, at least not until all of them are loaded.
+                this->morph_target_buffer.clear();
+                return;
+            }
+
+            this->morph_target_buffer.add_form(mesh.get_vertices(), mesh.get_normals());
+        }
+
+        this->is_morph_uv_upload_pending = true;
+    }
+
+    void ShapeshifterTransformation::upload_morph_slots()
+    {
+        if (!this->is_morph_upload_pending)
+        {
+            return;
+        }
+
+        this->is_morph_upload_pending = false;
+
+        const std::size_t n_vertices = this->morph_target_buffer.get_number_of_vertices();
+        const std::size_t n_slots = this->morph_evaluator.get_number_of_slots();
+
+        if (n_vertices == 0 || n_slots == 0)
+        {
+            this->morph_vertices.clear();
+            this->morph_normals.clear();
+            return;
+        }
+
+        const bool has_normals = (this->morph_target_buffer.get_number_of_components() == 6);
+
+        this->morph_vertices.resize(n_slots * n_vertices);
+        this->morph_normals.resize(has_normals ? n_slots * n_vertices : 0);
+
+        for (std::uint32_t slot = 0; slot < n_slots; slot++)
+        {
+            const float* const x = this->morph_evaluator.get_component(slot, 0);
+            const float* const y = this->morph_evaluator.get_component(slot, 1);
+            const float* const z = this->morph_evaluator.get_component(slot, 2);
+            glm::vec3* const slot_vertices = &this->morph_vertices[slot * n_vertices];
+
+            for (std::size_t i = 0; i < n_vertices; i++)
+            {
+                slot_vertices[i] = glm::vec3(x[i], y[i], z[i]);
+            }
+
+            if (has_normals)
+            {
+                const float* const nx = this->morph_evaluator.get_component(slot, 3);
+                const float* const ny = this->morph_evaluator.get_component(slot, 4);
+                const float* const nz = this->morph_evaluator.get_component(slot, 5);
+                glm::vec3* const slot_normals = &this->morph_normals[slot * n_vertices];
+
+                for (std::size_t i = 0; i < n_vertices; i++)
+                {
+                    slot_normals[i] = glm::vec3(nx[i], ny[i], nz[i]);
+                }
+            }
+        }
+
+        if (this->morph_vao == 0)
+        {
+            glGenVertexArrays(1, &this->morph_vao);
+            glGenBuffers(1, &this->morph_vertex_buffer);
+            glGenBuffers(1, &this->morph_uv_buffer);
+            glGenBuffers(1, &this->morph_normal_buffer);
+            this->is_morph_uv_upload_pending = true;
+        }
+
+        glBindVertexArray(this->morph_vao);
+
+        // The blended meshes change every frame, so the buffers are respecified.
+        glBindBuffer(GL_ARRAY_BUFFER, this->morph_vertex_buffer);
+        glBufferData(GL_ARRAY_BUFFER, this->morph_vertices.size() * sizeof(glm::vec3), this->morph_vertices.data(), GL_STREAM_DRAW);
+
+        if (has_normals)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, this->morph_normal_buffer);
+            glBufferData(GL_ARRAY_BUFFER, this->morph_normals.size() * sizeof(glm::vec3), this->morph_normals.data(), GL_STREAM_DRAW);
+        }
+
+        if (this->is_morph_uv_upload_pending)
+        {
+            // All forms share the UVs of the first form.
+            this->is_morph_uv_upload_pending = false;
+
+            for (const Entity* const form_entity : this->parent_of_shapeshifter_forms.child_pointer_vector)
+            {
+                if (form_entity == nullptr)
+                {
+                    continue;
+                }
+
+                std::vector<glm::vec2> uvs = static_cast<const ShapeshifterForm*>(form_entity)->get_mesh().get_uvs();
+                uvs.resize(n_vertices);
+
+                glBindBuffer(GL_ARRAY_BUFFER, this->morph_uv_buffer);
+                glBufferData(GL_ARRAY_BUFFER, uvs.size() * sizeof(glm::vec2), uvs.data(), GL_STATIC_DRAW);
+                break;
+            }
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
     Entity* ShapeshifterTransformation::get_parent() const
     {
         return this->child_of_material.get_parent();
@@ -128,7 +444,7 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `ShapeshifterTransformation::get_scene`: `material_parent` is `nullptr`!");
         }
 
-        return material_parent->get_scene();
+        return material_parent->get_cached_scene();
     }
 
     Pipeline* ShapeshifterTransformation::get_pipeline() const
@@ -21,15 +21,32 @@
 #include "entity.hpp"
 #include "child_module.hpp"
 #include "generic_parent_module.hpp"
+#include "code/ylikuutio/animation/morph_animation.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+
+// Include GLM
+#ifndef GLM_GLM_HPP_INCLUDED
+#define GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
 
 // Include standard headers
 #include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint32_t
 #include <optional> // std::optional
+#include <vector>   // std::vector
 
 // `ShapeshifterTransformation` is a series of `ShapeshifterForm`s that
 // make up the transition that may be e.g. a walk cycle or
 // a metamorphosis of some kind.
+//
+// The vertices and normals of the `ShapeshifterForm`s are packed into
+// one `animation::MorphTargetBuffer`. Each frame `animate` computes
+// the phase of each `Shapeshifter` from its `ShapeshifterSequence` and
+// blends each distinct phase once, shared by all `Shapeshifter`s in it.
+// `render` uploads the blended meshes once and each `Shapeshifter`
+// draws the blended mesh of its slot.
 
 namespace yli::core
 {
@@ -68,7 +85,7 @@ namespace yli::ontology
             const ShapeshifterTransformationStruct& shapeshifter_transformation_struct,
             GenericParentModule* material_parent_module);
 
-        ~ShapeshifterTransformation() override = default;
+        ~ShapeshifterTransformation() override;
 
     public:
         Entity* get_parent() const override;
@@ -95,8 +112,40 @@ namespace yli::ontology
 
         std::size_t get_number_of_descendants() const override;
 
-    private:
+        // Blends the forms of all `Shapeshifter`s of all `ShapeshifterSequence`s at `time`.
+        // Called once per frame from `Material::animate`, not from `render`,
+        // so that rendering the same `Scene` many times does not blend again.
+        void animate(double time);
+
+        const animation::MorphTargetBuffer& get_morph_target_buffer() const;
+
+        const animation::MorphEvaluator& get_morph_evaluator() const;
+
         void render(const Scene* target_scene);
+
+        // Draws the blended mesh of `morph_slot` with the current movable uniform block.
+        void render_morph_slot(std::uint32_t morph_slot) const;
+
+    private:
+        // Repacks the forms if the number of forms or of their vertices has changed.
+        void update_morph_target_buffer();
+
+        // Uploads the blended meshes of the latest `animate` to the GPU.
+        void upload_morph_slots();
+
+        animation::MorphTargetBuffer morph_target_buffer;
+        animation::MorphEvaluator morph_evaluator;
+
+        // The blended vertices and normals of all slots, slot after slot.
+        // The forms are drawn unindexed, as the indices of each form may differ.
+        std::vector<glm::vec3> morph_vertices;
+        std::vector<glm::vec3> morph_normals;
+        GLuint morph_vao { 0 };
+        GLuint morph_vertex_buffer { 0 };
+        GLuint morph_uv_buffer { 0 };
+        GLuint morph_normal_buffer { 0 };
+        bool is_morph_upload_pending { false };
+        bool is_morph_uv_upload_pending { false };
     };
 
     template<>
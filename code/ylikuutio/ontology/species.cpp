@@ -167,12 +167,12 @@ namespace yli::ontology
 
     void Species::render(const Scene* const target_scene)
     {
-        if (!this->should_render)
+        if (!this->should_render || this->mesh.get_is_loading())
         {
             return;
         }
 
-        Scene* const scene = this->get_scene();
+        Scene* const scene = this->get_cached_scene();
 
         if (target_scene != nullptr && scene != nullptr && scene != target_scene)
         {
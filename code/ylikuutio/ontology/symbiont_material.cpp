@@ -81,7 +81,7 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `SymbiontMaterial::get_scene`: `symbiosis_parent` is `nullptr`!");
         }
 
-        return symbiosis_parent->get_scene();
+        return symbiosis_parent->get_cached_scene();
     }
 
     Entity* SymbiontMaterial::get_parent() const
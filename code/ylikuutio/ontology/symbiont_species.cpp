@@ -74,7 +74,7 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `SymbiontSpecies::get_scene`: `symbiont_material_parent` is `nullptr`!");
         }
 
-        return symbiont_material_parent->get_scene();
+        return symbiont_material_parent->get_cached_scene();
     }
 
     Pipeline* SymbiontSpecies::get_pipeline() const
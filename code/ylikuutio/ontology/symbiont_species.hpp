@@ -23,6 +23,7 @@
 #include "apprentice_module.hpp"
 #include "generic_master_module.hpp"
 #include "mesh_module.hpp"
+#include "code/ylikuutio/render/mesh_instance_batch.hpp"
 
 // Include standard headers
 #include <cstddef>  // std::size_t
@@ -88,6 +89,7 @@ namespace yli::ontology
         ChildModule child_of_symbiont_material;
         GenericMasterModule master_of_bionts;
         MeshModule mesh;
+        render::MeshInstanceBatch biont_instances; // Model matrices of the `Biont`s to draw this frame.
 
     private:
         std::string model_file_format; // Type of the model file, eg. `"png"`.
@@ -22,6 +22,8 @@
 #include "pipeline.hpp"
 #include "symbiont_material.hpp"
 #include "symbiont_species.hpp"
+#include "holobiont.hpp"
+#include "biont.hpp"
 #include "generic_entity_factory.hpp"
 #include "request.hpp"
 #include "symbiosis_struct.hpp"
@@ -33,6 +35,8 @@
 #include "code/ylikuutio/data/any_value.hpp"
 #include "code/ylikuutio/load/symbiosis_loader.hpp"
 #include "code/ylikuutio/load/symbiosis_loader_struct.hpp"
+#include "code/ylikuutio/opengl/opengl.hpp"
+#include "code/ylikuutio/opengl/ubo_block_enums.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
 #include "code/ylikuutio/render/render_system.hpp"
 #include <ofbx.h>
@@ -43,6 +47,11 @@
 #include <glm/glm.hpp> // glm
 #endif
 
+#ifndef __GLM_GTC_TYPE_PTR_HPP_INCLUDED
+#define __GLM_GTC_TYPE_PTR_HPP_INCLUDED
+#include <glm/gtc/type_ptr.hpp> // glm::value_ptr
+#endif
+
 // Include standard headers
 #include <cstdint>   // std::uint32_t, std::uintptr_t
 #include <cstddef>   // std::size_t
@@ -123,6 +132,7 @@ namespace yli::ontology
         }
 
         symbiosis.apprentice_of_pipeline.unbind_from_any_master_belonging_to_other_scene(new_parent);
+        symbiosis.update_instance_model_matrix_id();
         symbiosis.child_of_ecosystem_or_scene.unbind_and_bind_to_new_parent(
             &new_parent.parent_of_symbioses);
 
@@ -143,6 +153,7 @@ namespace yli::ontology
         {
             symbiosis.apprentice_of_pipeline.unbind_and_bind_to_new_generic_master_module(
                 &new_pipeline.master_of_symbioses);
+            symbiosis.update_instance_model_matrix_id();
         }
         else
         {
@@ -175,12 +186,84 @@ namespace yli::ontology
           model_file_format { symbiosis_struct.model_file_format }
     {
         this->create_symbionts();
+        this->update_instance_model_matrix_id();
 
         // `Entity` member variables begin here.
         this->type_string = "yli::ontology::Symbiosis*";
         this->can_be_erased = true;
     }
 
+    Symbiosis::~Symbiosis()
+    {
+        if (this->instance_uniform_block != 0)
+        {
+            glDeleteBuffers(1, &this->instance_uniform_block);
+        }
+    }
+
+    static bool is_holobiont_rendered_in_scene(const Holobiont* const holobiont, const Scene* const scene)
+    {
+        if (holobiont == nullptr || !holobiont->should_render)
+        {
+            return false;
+        }
+
+        const Scene* const scene_of_holobiont = holobiont->get_cached_scene();
+        return scene == nullptr || scene_of_holobiont == nullptr || scene_of_holobiont == scene;
+    }
+
+    std::size_t Symbiosis::collect_biont_instances(const Scene* const target_scene)
+    {
+        for (Entity* const symbiont_material_entity : this->parent_of_symbiont_materials.child_pointer_vector)
+        {
+            if (auto* const symbiont_material = static_cast<SymbiontMaterial*>(symbiont_material_entity); symbiont_material != nullptr)
+            {
+                for (Entity* const symbiont_species_entity : symbiont_material->parent_of_symbiont_species.child_pointer_vector)
+                {
+                    if (auto* const symbiont_species = static_cast<SymbiontSpecies*>(symbiont_species_entity); symbiont_species != nullptr)
+                    {
+                        symbiont_species->biont_instances.clear();
+                    }
+                }
+            }
+        }
+
+        std::size_t n_instances = 0;
+
+        for (Entity* const holobiont_entity : this->master_of_holobionts)
+        {
+            auto* const holobiont = static_cast<Holobiont*>(holobiont_entity);
+
+            if (!is_holobiont_rendered_in_scene(holobiont, target_scene))
+            {
+                continue;
+            }
+
+            // The transform of the `Holobiont` is computed once, and shared by all of its `Biont`s.
+            holobiont->update_model_matrix();
+            const glm::mat4& holobiont_model_matrix = holobiont->get_model_matrix();
+
+            for (Entity* const biont_entity : holobiont->parent_of_bionts.child_pointer_vector)
+            {
+                const auto* const biont = static_cast<Biont*>(biont_entity);
+
+                if (biont == nullptr || !biont->should_render)
+                {
+                    continue;
+                }
+
+                if (auto* const symbiont_species = static_cast<SymbiontSpecies*>(biont->apprentice_of_symbiont_species.get_master());
+                    symbiont_species != nullptr) [[likely]]
+                {
+                    symbiont_species->biont_instances.add_instance(biont->compute_model_matrix(holobiont_model_matrix));
+                    n_instances++;
+                }
+            }
+        }
+
+        return n_instances;
+    }
+
     void Symbiosis::render(const Scene* const target_scene)
     {
         if (!this->should_render)
@@ -188,7 +271,7 @@ namespace yli::ontology
             return;
         }
 
-        Scene* const scene = this->get_scene();
+        Scene* const scene = this->get_cached_scene();
 
         if (target_scene != nullptr && scene != nullptr && scene != target_scene)
         {
@@ -198,9 +281,79 @@ namespace yli::ontology
 
         const Scene* const new_target_scene = (target_scene != nullptr ? target_scene : scene);
 
-        render::RenderSystem& render_system = this->universe.get_render_system();
+        if (this->collect_biont_instances(new_target_scene) == 0 || !this->universe.get_is_opengl_in_use())
+        {
+            return;
+        }
+
+        const Pipeline* const pipeline = this->get_pipeline();
+
+        if (pipeline == nullptr) [[unlikely]]
+        {
+            return;
+        }
+
+        if (this->instance_model_matrix_id < 0)
+        {
+            // The shader does not support instancing, draw each `Biont` separately.
+            // The model matrices of the `Holobiont`s are already up to date.
+            for (Entity* const holobiont_entity : this->master_of_holobionts)
+            {
+                if (auto* const holobiont = static_cast<Holobiont*>(holobiont_entity);
+                    is_holobiont_rendered_in_scene(holobiont, new_target_scene))
+                {
+                    render::RenderSystem::render_bionts(holobiont->parent_of_bionts);
+                }
+            }
+
+            return;
+        }
+
+        if (this->instance_uniform_block == 0)
+        {
+            glGenBuffers(1, &this->instance_uniform_block);
+            glBindBuffer(GL_UNIFORM_BUFFER, this->instance_uniform_block);
+            glBufferData(GL_UNIFORM_BUFFER, opengl::movable_ubo::MovableUboBlockOffsets::TOTAL_SIZE, nullptr,
+                         GL_STATIC_DRAW);
+        }
+
+        // The model matrix comes from the instance attribute,
+        // so `MVP` is the view projection matrix and `M` is identity.
+        const glm::mat4 view_projection_matrix = this->universe.get_projection_matrix() * this->universe.get_view_matrix();
+        const glm::mat4 identity_matrix { 1.0f };
+        glBindBuffer(GL_UNIFORM_BUFFER, this->instance_uniform_block);
+        glBufferSubData(GL_UNIFORM_BUFFER, opengl::movable_ubo::MovableUboBlockOffsets::MVP, sizeof(glm::mat4),
+                        glm::value_ptr(view_projection_matrix)); // mat4
+        glBufferSubData(GL_UNIFORM_BUFFER, opengl::movable_ubo::MovableUboBlockOffsets::M, sizeof(glm::mat4),
+                        glm::value_ptr(identity_matrix)); // mat4
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
 
-        render_system.render_holobionts(this->master_of_holobionts, new_target_scene);
+        glBindBufferBase(GL_UNIFORM_BUFFER, opengl::UboBlockIndices::MOVABLE, this->instance_uniform_block);
+
+        for (Entity* const symbiont_material_entity : this->parent_of_symbiont_materials.child_pointer_vector)
+        {
+            const auto* const symbiont_material = static_cast<SymbiontMaterial*>(symbiont_material_entity);
+
+            if (symbiont_material == nullptr)
+            {
+                continue;
+            }
+
+            // Bind our texture in Texture Unit 0.
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D, symbiont_material->texture.get_texture());
+            // Set our "texture_sampler" sampler to use Texture Unit 0.
+            opengl::uniform_1i(symbiont_material->get_openGL_textureID(), 0);
+
+            for (Entity* const symbiont_species_entity : symbiont_material->parent_of_symbiont_species.child_pointer_vector)
+            {
+                if (auto* const symbiont_species = static_cast<SymbiontSpecies*>(symbiont_species_entity); symbiont_species != nullptr)
+                {
+                    // One draw call for the `Biont`s of this `SymbiontSpecies` in all `Holobiont`s.
+                    symbiont_species->biont_instances.render(symbiont_species->mesh, this->instance_model_matrix_id);
+                }
+            }
+        }
     }
 
     std::size_t Symbiosis::get_number_of_symbiont_materials() const
@@ -252,6 +405,20 @@ namespace yli::ontology
         return this->model_file_format;
     }
 
+    void Symbiosis::update_instance_model_matrix_id()
+    {
+        const Pipeline* const pipeline = this->get_pipeline();
+
+        if (this->universe.get_is_opengl_in_use() && pipeline != nullptr)
+        {
+            this->instance_model_matrix_id = glGetAttribLocation(pipeline->get_program_id(), "instance_model_matrix");
+        }
+        else
+        {
+            this->instance_model_matrix_id = -1;
+        }
+    }
+
     void Symbiosis::create_symbionts()
     {
         load::SymbiosisLoaderStruct symbiosis_loader_struct(this->model_filename, model_file_format);
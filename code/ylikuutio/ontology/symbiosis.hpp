@@ -102,7 +102,7 @@ namespace yli::ontology
             GenericParentModule* ecosystem_or_scene_parent_module,
             GenericMasterModule* pipeline_master_module);
 
-        ~Symbiosis() override = default;
+        ~Symbiosis() override;
 
     public:
         Symbiosis(const Symbiosis&) = delete; // Delete copy constructor.
@@ -123,8 +123,15 @@ namespace yli::ontology
         std::size_t get_number_of_symbiont_species() const;
 
         // this method renders all `SymbiontMaterial`s belonging to this `Symbiosis`.
+        // The `Biont`s of each `SymbiontSpecies` are drawn with one instanced draw call
+        // if the vertex shader has the `instance_model_matrix` attribute.
         void render(const Scene* target_scene);
 
+        // Computes the model matrix of each `Holobiont` rendered in `target_scene`
+        // and collects the model matrices of their `Biont`s by `SymbiontSpecies`.
+        // Returns the number of `Biont`s collected.
+        std::size_t collect_biont_instances(const Scene* target_scene);
+
         const std::string& get_model_file_format() const;
 
         SymbiontMaterial* get_symbiont_material(std::size_t symbiont_material_i) const;
@@ -175,6 +182,10 @@ namespace yli::ontology
         std::size_t get_number_of_descendants() const override;
 
     private:
+        // Queries the location of the `instance_model_matrix` attribute
+        // of the current `Pipeline`, -1 if there is none.
+        void update_instance_model_matrix_id();
+
         void create_symbionts();
 
         const std::string model_filename; // filename of the model file.
@@ -198,6 +209,9 @@ namespace yli::ontology
         std::vector<const ofbx::Texture*> ofbx_normal_texture_vector; // currently not in use.
         std::vector<const ofbx::Texture*> ofbx_count_texture_vector; // currently not in use.
         std::size_t ofbx_mesh_count { 0 }; // the value of `ofbx_mesh_count` comes from OpenFBX.
+
+        GLuint instance_uniform_block { 0 }; // `movable_uniform_block` of the instanced draw calls.
+        GLint instance_model_matrix_id { -1 }; // Updated when the `Pipeline` changes.
     };
 
     template<>
@@ -83,7 +83,7 @@ namespace yli::ontology
                 this->universe.get_is_vulkan_in_use() ||
                 this->universe.get_is_software_rendering_in_use();
 
-        if (this->get_parent() != nullptr && should_load_vertices_and_uvs)
+        if (this->get_parent() != nullptr && should_load_vertices_and_uvs && this->universe.get_is_opengl_in_use())
         {
             // Initialize VAO.
             glGenVertexArrays(1, &this->vao);
@@ -145,7 +145,7 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `Text2d::get_scene`: `font_2d_parent` is `nullptr`!");
         }
 
-        return font_2d_parent->get_scene();
+        return font_2d_parent->get_cached_scene();
     }
 
     std::size_t Text2d::get_number_of_children() const
@@ -16,16 +16,42 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "text_3d.hpp"
+#include "universe.hpp"
 #include "scene.hpp"
+#include "pipeline.hpp"
 #include "vector_font.hpp"
 #include "text_3d_struct.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/opengl/ubo_block_enums.hpp"
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+#ifndef __GLM_GTC_TYPE_PTR_HPP_INCLUDED
+#define __GLM_GTC_TYPE_PTR_HPP_INCLUDED
+#include <glm/gtc/type_ptr.hpp> // glm::value_ptr
+#endif
+
+#ifndef __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#define __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#include <glm/gtc/matrix_transform.hpp>
+#endif
+
+#ifndef __GLM_GTC_QUATERNION_HPP_INCLUDED
+#define __GLM_GTC_QUATERNION_HPP_INCLUDED
+#include <glm/gtc/quaternion.hpp> // glm::quat
+#endif
 
 // Include standard headers
 #include <cstddef>   // std::size_t
 #include <iostream>  // std::cout, std::cerr
 #include <optional>  // std::optional
 #include <stdexcept> // std::runtime_error
+#include <string>    // std::string
 
 namespace yli::core
 {
@@ -43,12 +69,9 @@ namespace yli::ontology
         Text3d& text_3d,
         Scene& new_parent)
     {
-        // Disable all `GlyphObject`s of `text_3d`,
-        // set `parent` according to the input, request a new childID
-        // from the `new_parent`, and create and enable the needed
-        // `GlyphObject`s of `text_3d`.
-        // TODO: implement creation and enabling the `GlyphObject`s!
-        // Note: different fonts may provide glyphs for different Unicode code points!
+        // Set `parent` according to the input and request a new childID
+        // from the `new_parent`. The text is rendered by its `Text3dMesh`,
+        // so no per-character entities need to be rebound.
 
         const Entity* const scene_parent = text_3d.get_parent();
 
@@ -73,11 +96,9 @@ namespace yli::ontology
         Text3d& text_3d,
         VectorFont& new_master)
     {
-        // Disable all `GlyphObject`s of `text_3d`,
-        // set `master` according to the input, request a new apprenticeID
-        // from the `new_master`, and create and enable the needed
-        // `GlyphObject`s of `text_3d`.
-        // TODO: implement creation and enabling the `GlyphObject`s!
+        // Set `master` according to the input, request a new apprenticeID
+        // from the `new_master`, and lay out the text again using the
+        // `Glyph`s of `new_master`.
         // Note: different fonts may provide glyphs for different Unicode code points!
 
         if (VectorFont* const vector_font_master = text_3d.get_vector_font_master(); vector_font_master == nullptr)
@@ -95,6 +116,8 @@ namespace yli::ontology
 
         text_3d.apprentice_of_vector_font.unbind_and_bind_to_new_generic_master_module(
             &new_master.master_of_text_3ds);
+        text_3d.vertex_instance_offset_id = -1;
+        text_3d.lay_out_text();
 
         return std::nullopt;
     }
@@ -112,18 +135,13 @@ namespace yli::ontology
               text_3d_struct,
               movable_controller_master_module),
           child_of_scene(scene_parent_module, *this),
-          apprentice_of_vector_font(vector_font_master_module, this),
-          master_of_glyph_objects(*this, &this->registry, "glyph_objects")
+          apprentice_of_vector_font(vector_font_master_module, this)
     {
-        // TODO: `Text3d` constructor also creates each `GlyphObject`,
-        // and binds each to its corresponding `Glyph` for rendering hierarchy,
-        // and also binds each to this `Text3d` for ontological hierarchy.
+        // The characters are not entities: all of them are instances
+        // in `text_3d_mesh`, rendered together by this `Text3d`.
 
         this->text_string = text_3d_struct.text_string;
-
-        // Let's create each `GlyphObject` in a loop.
-
-        create_glyph_objects(this->text_string, *this);
+        this->lay_out_text();
 
         // `Entity` member variables begin here.
         this->type_string = "yli::ontology::Text3d*";
@@ -157,6 +175,99 @@ namespace yli::ontology
         return static_cast<VectorFont*>(this->apprentice_of_vector_font.get_master());
     }
 
+    const std::string& Text3d::get_text() const
+    {
+        return this->text_string;
+    }
+
+    void Text3d::set_text(const std::string& text_string)
+    {
+        this->text_string = text_string;
+        this->lay_out_text();
+    }
+
+    const render::Text3dMesh& Text3d::get_text_3d_mesh() const
+    {
+        return this->text_3d_mesh;
+    }
+
+    void Text3d::lay_out_text()
+    {
+        const VectorFont* const vector_font_master = this->get_vector_font_master();
+
+        if (vector_font_master == nullptr)
+        {
+            this->text_3d_mesh.clear();
+            return;
+        }
+
+        this->text_3d_mesh.set_text(this->text_string, *vector_font_master);
+    }
+
+    void Text3d::render(const Scene* const target_scene)
+    {
+        if (!this->should_render || !this->universe.get_is_opengl_in_use()) [[unlikely]]
+        {
+            return;
+        }
+
+        const Scene* const scene = this->get_cached_scene();
+
+        if (target_scene != nullptr && scene != nullptr && scene != target_scene)
+        {
+            // Different `Scene`s, do not render.
+            return;
+        }
+
+        const VectorFont* const vector_font_master = this->get_vector_font_master();
+
+        if (vector_font_master == nullptr)
+        {
+            // The `VectorFont` has been erased, there are no `Glyph`s to render.
+            return;
+        }
+
+        const Pipeline* const pipeline = vector_font_master->get_pipeline();
+
+        if (pipeline == nullptr) [[unlikely]]
+        {
+            return;
+        }
+
+        if (this->vertex_instance_offset_id < 0)
+        {
+            this->vertex_instance_offset_id = glGetAttribLocation(pipeline->get_program_id(), "vertex_instance_offset_modelspace");
+
+            if (this->vertex_instance_offset_id < 0)
+            {
+                // The shader does not support instanced glyphs, eg. it is not `instanced_glyph.vert`.
+                return;
+            }
+        }
+
+        // One model matrix for the whole text.
+        this->model_matrix = glm::scale(glm::mat4(1.0f), this->scale * this->original_scale_vector);
+        const glm::vec3 euler_angles { this->orientation.roll, -this->orientation.pitch, this->orientation.yaw };
+        this->model_matrix = glm::mat4_cast(glm::quat(euler_angles)) * this->model_matrix;
+        this->model_matrix[3][0] = this->location.get_x();
+        this->model_matrix[3][1] = this->location.get_y();
+        this->model_matrix[3][2] = this->location.get_z();
+
+        this->mvp_matrix = this->universe.get_projection_matrix() * this->universe.get_view_matrix() * this->model_matrix;
+
+        // Send our transformation to the uniform buffer object (UBO).
+        glBindBuffer(GL_UNIFORM_BUFFER, this->movable_uniform_block);
+        glBufferSubData(GL_UNIFORM_BUFFER, opengl::movable_ubo::MovableUboBlockOffsets::MVP, sizeof(glm::mat4),
+                        glm::value_ptr(this->mvp_matrix)); // mat4
+        glBufferSubData(GL_UNIFORM_BUFFER, opengl::movable_ubo::MovableUboBlockOffsets::M, sizeof(glm::mat4),
+                        glm::value_ptr(this->model_matrix)); // mat4
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+        glBindBufferBase(GL_UNIFORM_BUFFER, opengl::UboBlockIndices::MOVABLE, this->movable_uniform_block);
+
+        this->text_3d_mesh.render(this->vertex_instance_offset_id, *vector_font_master);
+    }
+
     std::size_t Text3d::get_number_of_children() const
     {
         return 0; // `Text3d` has no children.
@@ -21,8 +21,8 @@
 #include "movable.hpp"
 #include "child_module.hpp"
 #include "apprentice_module.hpp"
-#include "generic_master_module.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/render/text_3d_mesh.hpp"
 
 // Include standard headers
 #include <cstddef>  // std::size_t
@@ -43,27 +43,21 @@ namespace yli::ontology
     class Scene;
     class Pipeline;
     class VectorFont;
-    class GlyphObject;
     struct Text3dStruct;
 
     class Text3d final : public Movable
     {
     public:
-        // Disable all `GlyphObject`s of `text_3d`,
-        // set `parent` according to the input, request a new childID
-        // from the `new_parent`, and create and enable the needed
-        // `GlyphObject`s of `text_3d`.
-        // TODO: implement creation and enabling the `GlyphObject`s!
-        // Note: different fonts may provide glyphs for different Unicode code points!
+        // Set `parent` according to the input and request a new childID
+        // from the `new_parent`. The text is rendered by its `Text3dMesh`,
+        // so no per-character entities need to be rebound.
         static std::optional<data::AnyValue> bind_to_new_scene_parent(
             Text3d& text_3d,
             Scene& new_parent);
 
-        // Disable all `GlyphObject`s of `text_3d`,
-        // set `master` according to the input, request a new childID
-        // from the `new_master`, and create and enable the needed
-        // `GlyphObject`s of `text_3d`.
-        // TODO: implement creation and enabling the `GlyphObject`s!
+        // Set `master` according to the input, request a new apprenticeID
+        // from the `new_master`, and lay out the text again using the
+        // `Glyph`s of `new_master`.
         // Note: different fonts may provide glyphs for different Unicode code points!
         static std::optional<data::AnyValue> bind_to_new_vector_font_master(
             Text3d& text_3d,
@@ -90,28 +84,29 @@ namespace yli::ontology
 
         VectorFont* get_vector_font_master() const;
 
-        template<typename ApprenticeType>
-        GenericMasterModule* get_generic_master_module() = delete;
+        const std::string& get_text() const;
+
+        // Replaces the text and lays it out using the `Glyph`s of the `VectorFont` master.
+        void set_text(const std::string& text_string);
+
+        const render::Text3dMesh& get_text_3d_mesh() const;
 
-        friend void create_glyph_objects(const std::string& text_string, Text3d& text_3d);
+        void render(const Scene* target_scene);
 
         ChildModule child_of_scene;
         ApprenticeModule apprentice_of_vector_font;
-        GenericMasterModule master_of_glyph_objects;
 
         std::size_t get_number_of_children() const override;
 
         std::size_t get_number_of_descendants() const override;
 
     private:
+        void lay_out_text();
+
         std::string text_string;
+        render::Text3dMesh text_3d_mesh; // All characters, one instance per character.
+        GLint vertex_instance_offset_id { -1 };
     };
-
-    template<>
-    inline GenericMasterModule* Text3d::get_generic_master_module<GlyphObject>()
-    {
-        return &this->master_of_glyph_objects;
-    }
 }
 
 #endif
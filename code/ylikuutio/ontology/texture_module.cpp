@@ -18,21 +18,44 @@
 #include "texture_module.hpp"
 #include "texture_file_format.hpp"
 #include "universe.hpp"
-#include "code/ylikuutio/load/common_texture_loader.hpp"
+#include "code/ylikuutio/load/asset_loader.hpp"
 #include "code/ylikuutio/load/fbx_texture_loader.hpp"
 #include "code/ylikuutio/load/image_loader_struct.hpp"
+#include "code/ylikuutio/load/mipmapped_texture_loader.hpp"
+#include "code/ylikuutio/load/texture_cache.hpp"
+#include "code/ylikuutio/load/texture_data.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+#include "code/ylikuutio/render/graphics_api_backend.hpp"
 #include <ofbx.h>
 
 // Include standard headers
 #include <cstdint>  // std::uint32_t
+#include <future>   // std::promise, std::shared_future
 #include <iostream> // std::cout, std::cerr
+#include <memory>   // std::make_shared, std::shared_ptr
 #include <string>   // std::string
+#include <utility>  // std::move
 
 namespace yli::ontology
 {
     class Registry;
 
+    // The state of an asynchronous load. It is shared with the `AssetLoader`
+    // jobs so that the `TextureModule` may be destroyed while loading.
+    struct TextureModule::AsyncTextureData
+    {
+        std::string texture_filename;
+        std::string texture_cache_key;
+        load::ImageLoaderStruct image_loader_struct;
+        std::shared_ptr<load::TextureData> texture_data { nullptr };
+        load::TextureCache* texture_cache { nullptr };
+        render::GraphicsApiBackend graphics_api_backend;
+        bool should_use_texture_container { true };
+
+        // Only accessed on the upload thread. `nullptr` if the `TextureModule` has been destroyed.
+        TextureModule* texture_module { nullptr };
+    };
+
     TextureModule::TextureModule(
             Universe& universe,
             Registry* const /* registry */,
@@ -51,21 +74,68 @@ namespace yli::ontology
             universe.get_is_vulkan_in_use() ||
             universe.get_is_software_rendering_in_use();
 
-        if (should_load_texture)
+        bool is_texture_loading_successful = !should_load_texture;
+
+        load::TextureCache& texture_cache = universe.get_texture_cache();
+        const std::string texture_cache_key = load::TextureCache::get_key(this->texture_filename, image_loader_struct);
+
+        if (should_load_texture &&
+                texture_file_format == TextureFileFormat::PNG &&
+                image_loader_struct.should_load_asynchronously)
         {
-            bool is_texture_loading_successful = false;
+            if (std::shared_ptr<load::CachedTexture> cached_texture = texture_cache.find(texture_cache_key); cached_texture != nullptr)
+            {
+                // Already loaded by another user, nothing to do asynchronously.
+                this->use_cached_texture(std::move(cached_texture));
+                is_texture_loading_successful = true;
+            }
+            else
+            {
+                this->async_texture_data = std::make_shared<AsyncTextureData>();
+                this->async_texture_data->texture_filename = this->texture_filename;
+                this->async_texture_data->texture_cache_key = texture_cache_key;
+                this->async_texture_data->image_loader_struct = image_loader_struct;
+                this->async_texture_data->texture_cache = &texture_cache;
+                this->async_texture_data->graphics_api_backend = universe.get_graphics_api_backend();
+                this->async_texture_data->should_use_texture_container = texture_cache.get_should_use_texture_containers();
+                this->async_texture_data->texture_module = this;
+                this->is_loading = true;
+
+                this->loading_future = universe.get_asset_loader().enqueue(
+                        [async_texture_data = this->async_texture_data]()
+                        {
+                            async_texture_data->texture_data = yli::load::load_mipmapped_texture(
+                                    async_texture_data->texture_filename,
+                                    async_texture_data->image_loader_struct,
+                                    async_texture_data->should_use_texture_container);
+                            return async_texture_data->texture_data != nullptr;
+                        },
+                        [async_texture_data = this->async_texture_data](const bool is_image_loaded)
+                        {
+                            if (async_texture_data->texture_module != nullptr)
+                            {
+                                async_texture_data->texture_module->finish_asynchronous_loading(*async_texture_data, is_image_loaded);
+                            }
+                        });
 
+                return;
+            }
+        }
+        else if (should_load_texture)
+        {
             if (texture_file_format == TextureFileFormat::PNG)
             {
-                is_texture_loading_successful = yli::load::load_common_texture(
+                // `TextureModule`s loading the same image with the same flags share one texture.
+                std::shared_ptr<load::CachedTexture> cached_texture = texture_cache.load(
                         this->texture_filename,
                         image_loader_struct,
-                        this->image_width,
-                        this->image_height,
-                        this->image_size,
-                        n_color_channels,
-                        this->texture,
                         universe.get_graphics_api_backend());
+
+                if (cached_texture != nullptr)
+                {
+                    this->use_cached_texture(std::move(cached_texture));
+                    is_texture_loading_successful = true;
+                }
             }
             else
             {
@@ -77,6 +147,10 @@ namespace yli::ontology
                 std::cerr << "ERROR: `TextureModule::TextureModule`: loading texture failed!\n";
             }
         }
+
+        std::promise<bool> loading_promise;
+        loading_promise.set_value(is_texture_loading_successful);
+        this->loading_future = loading_promise.get_future().share();
     }
 
     TextureModule::TextureModule(
@@ -94,9 +168,11 @@ namespace yli::ontology
             universe.get_is_vulkan_in_use() ||
             universe.get_is_software_rendering_in_use();
 
+        bool is_texture_loading_successful = !should_load_texture;
+
         if (should_load_texture)
         {
-            bool is_texture_loading_successful = load::load_fbx_texture(
+            is_texture_loading_successful = load::load_fbx_texture(
                     this->ofbx_texture,
                     this->image_width,
                     this->image_height,
@@ -110,11 +186,21 @@ namespace yli::ontology
                 std::cerr << "ERROR: `TextureModule::TextureModule`: loading texture failed!\n";
             }
         }
+
+        std::promise<bool> loading_promise;
+        loading_promise.set_value(is_texture_loading_successful);
+        this->loading_future = loading_promise.get_future().share();
     }
 
     TextureModule::~TextureModule()
     {
-        if (this->get_is_texture_loaded())
+        if (this->async_texture_data != nullptr)
+        {
+            this->async_texture_data->texture_module = nullptr;
+        }
+
+        // A cached texture is deleted by the `CachedTexture` when its last user is gone.
+        if (this->cached_texture == nullptr && this->get_is_texture_loaded())
         {
             // Delete texture.
             glDeleteTextures(1, &this->texture);
@@ -160,4 +246,52 @@ namespace yli::ontology
     {
         return this->texture != GL_INVALID_VALUE;
     }
+
+    bool TextureModule::get_is_loading() const
+    {
+        return this->is_loading;
+    }
+
+    std::shared_future<bool> TextureModule::get_loading_future() const
+    {
+        return this->loading_future;
+    }
+
+    void TextureModule::finish_asynchronous_loading(AsyncTextureData& async_texture_data, const bool is_loading_successful)
+    {
+        // Called by the `AssetLoader` on the thread which owns the GL context.
+        this->is_loading = false;
+        async_texture_data.texture_module = nullptr;
+        this->async_texture_data = nullptr; // The upload job keeps `async_texture_data` alive until it returns.
+
+        if (!is_loading_successful) [[unlikely]]
+        {
+            std::cerr << "ERROR: `TextureModule::finish_asynchronous_loading`: loading texture failed!\n";
+            return;
+        }
+
+        // Another `TextureModule` may have loaded the same texture meanwhile, in which case it is reused.
+        std::shared_ptr<load::CachedTexture> cached_texture = async_texture_data.texture_cache->insert(
+                async_texture_data.texture_cache_key,
+                *async_texture_data.texture_data,
+                async_texture_data.graphics_api_backend);
+
+        if (cached_texture == nullptr) [[unlikely]]
+        {
+            std::cerr << "ERROR: `TextureModule::finish_asynchronous_loading`: uploading texture failed!\n";
+            return;
+        }
+
+        this->use_cached_texture(std::move(cached_texture));
+    }
+
+    void TextureModule::use_cached_texture(std::shared_ptr<load::CachedTexture> cached_texture)
+    {
+        this->texture          = cached_texture->texture;
+        this->image_width      = cached_texture->image_width;
+        this->image_height     = cached_texture->image_height;
+        this->image_size       = cached_texture->image_size;
+        this->n_color_channels = cached_texture->n_color_channels;
+        this->cached_texture   = std::move(cached_texture);
+    }
 }
@@ -24,10 +24,13 @@
 
 // Include standard headers
 #include <cstdint>  // std::uint32_t
+#include <future>   // std::shared_future
+#include <memory>   // std::shared_ptr
 #include <string>   // std::string
 
 namespace yli::load
 {
+    struct CachedTexture;
     struct ImageLoaderStruct;
 }
 
@@ -68,7 +71,19 @@ namespace yli::ontology
             GLuint get_texture() const;
             bool get_is_texture_loaded() const;
 
+            // `true` while the texture is being loaded asynchronously.
+            bool get_is_loading() const;
+
+            // Becomes ready when loading has finished, holding `true` on success.
+            std::shared_future<bool> get_loading_future() const;
+
         private:
+            struct AsyncTextureData;
+
+            void finish_asynchronous_loading(AsyncTextureData& async_texture_data, bool is_loading_successful);
+
+            void use_cached_texture(std::shared_ptr<load::CachedTexture> cached_texture);
+
             std::string texture_filename;
             TextureFileFormat texture_file_format;
             const ofbx::Texture* ofbx_texture { nullptr };
@@ -77,6 +92,10 @@ namespace yli::ontology
             std::uint32_t image_size          { 0 };
             std::uint32_t n_color_channels    { 0 };
             GLuint texture                    { GL_INVALID_VALUE };
+            std::shared_ptr<load::CachedTexture> cached_texture  { nullptr }; // Shared with other users of the same image.
+            std::shared_ptr<AsyncTextureData> async_texture_data { nullptr };
+            std::shared_future<bool> loading_future;
+            bool is_loading                   { false };
     };
 }
 
@@ -26,6 +26,7 @@
 
 #include "universe.hpp"
 #include "entity.hpp"
+#include "ecosystem.hpp"
 #include "scene.hpp"
 #include "font_2d.hpp"
 #include "text_2d.hpp"
@@ -38,10 +39,15 @@
 #include "horizontal_alignment.hpp"
 #include "vertical_alignment.hpp"
 #include "universe_struct.hpp"
+#include "headless_simulation_struct.hpp"
 #include "variable_struct.hpp"
 #include "text_struct.hpp"
 #include "get_number_of_descendants.hpp"
+#include "callback_magic_numbers.hpp"
 #include "code/ylikuutio/audio/audio_system.hpp"
+#include "code/ylikuutio/console/remote_command.hpp"
+#include "code/ylikuutio/console/remote_console.hpp"
+#include "code/ylikuutio/console/stdin_command_reader.hpp"
 #include "code/ylikuutio/core/application.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
 #include "code/ylikuutio/event/event_system.hpp"
@@ -52,6 +58,9 @@
 #include "code/ylikuutio/hierarchy/unbind_child_from_parent.hpp"
 #include "code/ylikuutio/input/input.hpp"
 #include "code/ylikuutio/input/input_system.hpp"
+#include "code/ylikuutio/load/asset_loader.hpp"
+#include "code/ylikuutio/load/texture_cache.hpp"
+#include "code/ylikuutio/memory/generic_memory_system.hpp"
 #include "code/ylikuutio/opengl/opengl.hpp"
 #include "code/ylikuutio/opengl/ubo_block_enums.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
@@ -74,18 +83,21 @@
 #endif
 
 // Include standard headers
-#include <cmath>     // std::cos, std::sin
+#include <chrono>    // std::chrono
+#include <cmath>     // std::cos, std::isnan, std::sin
 #include <cstddef>   // std::size_t
-#include <cstdint>   // std::int32_t, std::uint32_t
+#include <cstdint>   // std::int32_t, std::uint32_t, std::uint64_t
 #include <iomanip>   // std::setprecision
 #include <ios>       // std::fixed
 #include <iostream>  // std::cout, std::cerr
 #include <limits>    // std::numeric_limits
+#include <memory>    // std::make_unique, std::unique_ptr
 #include <numbers>   // std::numbers::pi
 #include <optional>  // std::nullopt, std::optional
 #include <sstream>   // std::stringstream
 #include <stdexcept> // std::runtime_error
 #include <string>    // std::string
+#include <thread>    // std::this_thread
 #include <utility>   // std::move
 #include <vector>    // std::vector
 
@@ -181,7 +193,11 @@ namespace yli::ontology
           aspect_ratio { static_cast<float>(this->window_width) / static_cast<float>(this->window_height) },
           text_size { universe_struct.text_size },
           font_size { universe_struct.font_size },
-          max_fps { universe_struct.max_fps }
+          max_fps { universe_struct.max_fps },
+          headless_ticks_per_second { universe_struct.headless_ticks_per_second },
+          should_run_headless_simulation { universe_struct.should_run_headless_simulation },
+          remote_console { universe_struct.remote_console },
+          asset_upload_time_budget { universe_struct.asset_upload_time_budget_in_microseconds }
     {
         // call `set_global_name` here because it can't be done in `Entity` constructor.
         this->set_global_name(universe_struct.global_name);
@@ -193,6 +209,10 @@ namespace yli::ontology
 
         this->create_should_render_variable();
 
+        this->asset_loader = std::make_unique<load::AssetLoader>(universe_struct.n_asset_loader_threads);
+        this->texture_cache = std::make_unique<load::TextureCache>();
+        this->texture_cache->set_should_use_texture_containers(universe_struct.should_use_texture_containers);
+
         if (this->graphics_api_backend == render::GraphicsApiBackend::HEADLESS)
         {
             this->is_exit_requested = true;
@@ -209,6 +229,11 @@ namespace yli::ontology
 
     Universe::~Universe()
     {
+        if (this->stdin_command_reader != nullptr)
+        {
+            this->stdin_command_reader->stop();
+        }
+
         SDL_Quit();
 
         this->unbind_entity(this->entityID);
@@ -239,14 +264,41 @@ namespace yli::ontology
 
     void Universe::update() const
     {
+        // The forms are blended once per frame, however many times the `Scene`s are rendered.
+        const double current_time = time::get_time();
+
+        for (Entity* const ecosystem_entity : this->parent_of_ecosystems.child_pointer_vector)
+        {
+            if (auto* const ecosystem = static_cast<Ecosystem*>(ecosystem_entity); ecosystem != nullptr)
+            {
+                ecosystem->animate(current_time);
+            }
+        }
+
         if (this->active_scene != nullptr)
         {
             this->active_scene->update();
+            this->active_scene->animate(current_time);
         }
     }
 
     void Universe::start_simulation()
     {
+        if (this->get_is_headless())
+        {
+            if (!this->should_run_headless_simulation)
+            {
+                return;
+            }
+
+            HeadlessSimulationStruct headless_simulation_struct;
+            headless_simulation_struct.ticks_per_second = this->headless_ticks_per_second;
+            headless_simulation_struct.should_read_console_from_stdin = true;
+            headless_simulation_struct.remote_console = this->remote_console;
+            this->start_headless_simulation(headless_simulation_struct);
+            return;
+        }
+
         if (this->parent_of_font_2ds.get_number_of_children() == 0)
         {
             return;
@@ -363,12 +415,13 @@ namespace yli::ontology
 
                     // `last_time_to_display_fps` needs to be incremented to avoid infinite loop.
                     this->increment_last_time_to_display_fps();
+                }
 
-                    // Update audio also (in case the sound has reached the end).
-                    if (audio::AudioSystem* const audio_system = this->get_audio_system(); audio_system != nullptr)
-                    {
-                        audio_system->update();
-                    }
+                // Update audio every frame: the playlist and the listener.
+                // The mixing itself runs on the audio thread.
+                if (audio::AudioSystem* const audio_system = this->get_audio_system(); audio_system != nullptr)
+                {
+                    audio_system->update();
                 }
 
                 // Clear the screen.
@@ -514,6 +567,9 @@ namespace yli::ontology
                     }
                 }
 
+                // Upload assets loaded in the background, within the time budget.
+                this->asset_loader->process_uploads(this->asset_upload_time_budget);
+
                 // 5. Render.
                 // Render the `Universe`.
                 this->render();
@@ -523,6 +579,188 @@ namespace yli::ontology
         }
     }
 
+    std::uint64_t Universe::start_headless_simulation(const HeadlessSimulationStruct& headless_simulation_struct)
+    {
+        if (!this->get_is_headless()) [[unlikely]]
+        {
+            throw std::runtime_error("ERROR: `Universe::start_headless_simulation`: `Universe` is not headless!");
+        }
+
+        using clock = std::chrono::steady_clock;
+
+        const bool is_capped = headless_simulation_struct.ticks_per_second > 0.0f;
+        const auto tick_duration = std::chrono::duration_cast<clock::duration>(
+                std::chrono::duration<double>(is_capped ? 1.0 / headless_simulation_struct.ticks_per_second : 0.0));
+
+        // If the simulation falls behind more than this, it does not try to catch up.
+        constexpr std::uint32_t max_n_ticks_behind = 10;
+
+        console::StdinCommandReader* stdin_command_reader = nullptr;
+        console::RemoteConsole* const remote_console = headless_simulation_struct.remote_console;
+
+        if (headless_simulation_struct.should_read_console_from_stdin)
+        {
+            // One reader per `Universe`, kept until the `Universe` is destroyed.
+            if (this->stdin_command_reader == nullptr)
+            {
+                this->stdin_command_reader = std::make_unique<console::StdinCommandReader>();
+            }
+
+            stdin_command_reader = this->stdin_command_reader.get();
+        }
+
+        // A headless `Universe` is created with exit requested, so that
+        // applications which do not run a simulation exit right away.
+        this->is_exit_requested = false;
+        this->is_headless_simulation_running = true;
+
+        std::uint64_t n_ticks_run = 0;
+        clock::time_point last_tick_time = clock::now();
+        clock::time_point next_tick_time = last_tick_time;
+
+        while (!this->is_exit_requested &&
+                (headless_simulation_struct.n_ticks == 0 || n_ticks_run < headless_simulation_struct.n_ticks))
+        {
+            // Commands received from outside are executed before the tick, never during it.
+            if (stdin_command_reader != nullptr)
+            {
+                for (const std::string& line : stdin_command_reader->take_lines())
+                {
+                    Console* const console = this->get_external_command_console();
+
+                    if (console == nullptr) [[unlikely]]
+                    {
+                        std::cerr << "ERROR: `Universe::start_headless_simulation`: there is no `Console`!\n";
+                        continue;
+                    }
+
+                    this->execute_external_command(*console, line);
+                }
+            }
+
+            if (remote_console != nullptr)
+            {
+                for (const console::RemoteCommand& remote_command : remote_console->take_commands())
+                {
+                    Console* const console = this->get_external_command_console();
+
+                    if (console == nullptr) [[unlikely]]
+                    {
+                        remote_console->send_result(remote_command.client_id, "ERROR: there is no `Console`!");
+                        continue;
+                    }
+
+                    const std::optional<data::AnyValue> any_value = this->execute_external_command(*console, remote_command.command);
+                    remote_console->send_result(remote_command.client_id, (any_value ? any_value->get_string() : ""));
+                }
+            }
+
+            if (is_capped)
+            {
+                std::this_thread::sleep_until(next_tick_time);
+
+                if (clock::now() - next_tick_time > max_n_ticks_behind * tick_duration)
+                {
+                    next_tick_time = clock::now();
+                }
+
+                next_tick_time += tick_duration;
+            }
+
+            // `delta_time` is in milliseconds, like in the rendering main loop.
+            const clock::time_point current_time = clock::now();
+            this->delta_time = std::chrono::duration<double, std::milli>(current_time - last_tick_time).count();
+            last_tick_time = current_time;
+
+            this->tick();
+            n_ticks_run++;
+
+            if (remote_console != nullptr &&
+                    headless_simulation_struct.metrics_interval_in_ticks > 0 &&
+                    n_ticks_run % headless_simulation_struct.metrics_interval_in_ticks == 0)
+            {
+                remote_console->send_metrics(this->get_metrics_string());
+            }
+        }
+
+        this->is_headless_simulation_running = false;
+        return n_ticks_run;
+    }
+
+    void Universe::tick()
+    {
+        // Upload assets loaded in the background, within the time budget.
+        this->asset_loader->process_uploads(this->asset_upload_time_budget);
+
+        // 2. Process AI.
+        this->update();
+
+        // 3. Process physics.
+        if (this->active_scene != nullptr)
+        {
+            this->active_scene->do_physics();
+        }
+
+        if (Camera* const camera = this->get_active_camera(); camera != nullptr)
+        {
+            camera->compute_and_update_matrices_from_inputs(this->initial_fov, this->aspect_ratio, this->znear, this->zfar);
+        }
+
+        this->number_of_ticks++;
+    }
+
+    std::uint64_t Universe::get_number_of_ticks() const
+    {
+        return this->number_of_ticks;
+    }
+
+    bool Universe::get_is_headless_simulation_running() const
+    {
+        return this->is_headless_simulation_running;
+    }
+
+    std::size_t Universe::get_number_of_entities() const
+    {
+        return this->number_of_entities;
+    }
+
+    std::string Universe::get_metrics_string() const
+    {
+        const memory::GenericMemorySystem& memory_system = this->get_application().get_generic_memory_system();
+
+        std::stringstream metrics_stringstream;
+        metrics_stringstream <<
+            "ticks=" << this->number_of_ticks <<
+            " frame_time_ms=" << std::fixed << std::setprecision(3) << (std::isnan(this->delta_time) ? 0.0 : this->delta_time) <<
+            " entities=" << this->number_of_entities <<
+            " scenes=" << this->get_number_of_scenes() <<
+            " allocators=" << memory_system.get_number_of_allocators() <<
+            " storages=" << memory_system.get_number_of_storages() <<
+            " instances=" << memory_system.get_number_of_instances();
+        return metrics_stringstream.str();
+    }
+
+    Console* Universe::get_external_command_console() const
+    {
+        return (this->active_console != nullptr ?
+                this->active_console :
+                static_cast<Console*>(this->parent_of_consoles.get(0)));
+    }
+
+    std::optional<data::AnyValue> Universe::execute_external_command(Console& console, const std::string& command)
+    {
+        std::optional<data::AnyValue> any_value = console.execute_command(command);
+
+        if (any_value &&
+                any_value->holds<std::uint32_t>() &&
+                any_value->get<std::uint32_t>() == CallbackMagicNumber::EXIT_PROGRAM)
+        {
+            this->request_exit();
+        }
+
+        return any_value;
+    }
+
     void Universe::update_mouse_x(const std::int32_t x_change)
     {
         this->mouse_x += x_change; // horizontal motion relative to screen center.
@@ -1353,6 +1591,16 @@ namespace yli::ontology
         throw std::runtime_error("ERROR: `Universe::get_input_system`: `input_system` is `nullptr`!");
     }
 
+    load::AssetLoader& Universe::get_asset_loader() const
+    {
+        return *this->asset_loader;
+    }
+
+    load::TextureCache& Universe::get_texture_cache() const
+    {
+        return *this->texture_cache;
+    }
+
     render::RenderSystem& Universe::get_render_system() const
     {
         if (this->render_system == nullptr) [[unlikely]]
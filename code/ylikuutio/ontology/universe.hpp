@@ -34,9 +34,10 @@
 #endif
 
 // Include standard headers
+#include <chrono>        // std::chrono::microseconds
 #include <cmath>         // NAN
 #include <cstddef>       // std::size_t
-#include <cstdint>       // std::int32_t, std::uint32_t
+#include <cstdint>       // std::int32_t, std::uint32_t, std::uint64_t
 #include <limits>        // std::numeric_limits
 #include <memory>        // std::unique_ptr
 #include <optional>      // std::optional
@@ -49,6 +50,12 @@ namespace yli::audio
     class AudioSystem;
 }
 
+namespace yli::console
+{
+    class RemoteConsole;
+    class StdinCommandReader;
+}
+
 namespace yli::core
 {
     class Application;
@@ -65,6 +72,12 @@ namespace yli::input
     enum class InputMethod;
 }
 
+namespace yli::load
+{
+    class AssetLoader;
+    class TextureCache;
+}
+
 namespace yli::memory
 {
     class GenericMemoryAllocator;
@@ -87,6 +100,7 @@ namespace yli::ontology
 
     struct UniverseStruct;
     struct InputModeStruct;
+    struct HeadlessSimulationStruct;
 
     class Universe final : public Entity
     {
@@ -107,8 +121,27 @@ namespace yli::ontology
         Universe& operator=(const Universe&) = delete; // Delete copy assignment.
 
         // This method contains the main loop.
+        // A headless `Universe` runs `start_headless_simulation` instead,
+        // driven by stdin, if `should_run_headless_simulation` is set.
         void start_simulation();
 
+        // This method contains the main loop of a headless `Universe`:
+        // no window, no inputs and no rendering, only AI and physics.
+        // Returns the number of ticks run.
+        std::uint64_t start_headless_simulation(const HeadlessSimulationStruct& headless_simulation_struct);
+
+        // This method runs one simulation tick (AI and physics).
+        void tick();
+
+        std::uint64_t get_number_of_ticks() const;
+
+        bool get_is_headless_simulation_running() const;
+
+        std::size_t get_number_of_entities() const;
+
+        // Returns `key=value` pairs: ticks, frame time, entity counts and memory stats.
+        std::string get_metrics_string() const;
+
         void update_mouse_x(std::int32_t x_change);
 
         void update_mouse_y(std::int32_t y_change);
@@ -220,6 +253,10 @@ namespace yli::ontology
 
         render::RenderSystem& get_render_system() const;
 
+        load::AssetLoader& get_asset_loader() const;
+
+        load::TextureCache& get_texture_cache() const;
+
         audio::AudioSystem* get_audio_system() const;
 
         GenericParentModule& get_parent_of_ecosystems();
@@ -416,6 +453,12 @@ namespace yli::ontology
     private:
         void create_should_render_variable();
 
+        // Returns the `Console` that executes commands received from outside, or `nullptr`.
+        Console* get_external_command_console() const;
+
+        // Executes a command received from outside, requesting exit if the command asks for it.
+        std::optional<data::AnyValue> execute_external_command(Console& console, const std::string& command);
+
         std::vector<Entity*> entity_pointer_vector;
         std::queue<std::size_t> free_entityID_queue;
         std::size_t number_of_entities { 0 };
@@ -424,6 +467,8 @@ namespace yli::ontology
         Console* active_console { nullptr };
 
         std::unique_ptr<render::RenderSystem> render_system { nullptr };
+        std::unique_ptr<load::AssetLoader> asset_loader    { nullptr };
+        std::unique_ptr<load::TextureCache> texture_cache  { nullptr };
 
         const std::string application_name;
 
@@ -472,6 +517,13 @@ namespace yli::ontology
 
         // variables related to timing of events.
         std::uint32_t max_fps;
+        float headless_ticks_per_second;
+        bool should_run_headless_simulation;
+        console::RemoteConsole* remote_console { nullptr };
+        std::unique_ptr<console::StdinCommandReader> stdin_command_reader { nullptr }; // Created on first use.
+        std::uint64_t number_of_ticks { 0 };
+        std::chrono::microseconds asset_upload_time_budget;
+        bool is_headless_simulation_running { false };
         double last_time_to_display_fps { time::get_time() };
         double last_time_for_display_sync { time::get_time() };
         double delta_time { NAN };
@@ -233,7 +233,7 @@ namespace yli::ontology
         Universe& universe,
         const std::string& filename)
     {
-        if (!universe.framebuffer_module.get_in_use())
+        if (!universe.framebuffer_module.get_in_use() || !universe.get_is_opengl_in_use())
         {
             return std::nullopt;
         }
@@ -27,6 +27,11 @@
 #include <cstdint>  // std::uint32_t
 #include <string>   // std::string
 
+namespace yli::console
+{
+    class RemoteConsole;
+}
+
 namespace yli::ontology
 {
     struct UniverseStruct : EntityStruct
@@ -49,6 +54,11 @@ namespace yli::ontology
         std::uint32_t text_size     { 40 };
         std::uint32_t font_size     { 16 };
         std::uint32_t max_fps       { 50000 };   // Default value max 50000 frames per second.
+        float headless_ticks_per_second { 60.0f }; // Headless simulation rate, 0.0 means uncapped.
+        bool should_run_headless_simulation { false }; // `start_simulation` of a headless `Universe` returns at once otherwise.
+        console::RemoteConsole* remote_console { nullptr }; // Commands and metrics of headless simulation, not owned.
+        std::uint32_t n_asset_loader_threads { 0 };      // 0 means hardware concurrency - 1.
+        std::uint32_t asset_upload_time_budget_in_microseconds { 2000 }; // GPU uploads per frame.
         float speed                { 0.1f };    // Default value 0.1 units / second.
         float turbo_factor         { 5.0f };    // Default value 5.0 x speed.
         float twin_turbo_factor    { 100.0f };  // Default value 100.0 x speed.
@@ -59,6 +69,7 @@ namespace yli::ontology
         bool is_silent             { false };
         bool is_physical           { true };    // Physics simulation in use.
         bool is_fullscreen         { false };   // Windowed mode in use.
+        bool should_use_texture_containers { true }; // Cache decoded textures with mip chains next to the image files.
         input::InputMethod input_method { input::InputMethod::KEYBOARD };
         FramebufferModuleStruct framebuffer_module_struct;
     };
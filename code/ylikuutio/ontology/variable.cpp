@@ -71,7 +71,7 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `Variable::get_scene`: `entity_parent` is `nullptr`!");
         }
 
-        return entity_parent->get_scene();
+        return entity_parent->get_cached_scene();
     }
 
     std::size_t Variable::get_number_of_children() const
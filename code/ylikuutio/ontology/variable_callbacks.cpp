@@ -26,7 +26,6 @@
 
 // Include standard headers
 #include <cstdint>       // std::uint32_t
-#include <variant>       // std::holds_alternative
 
 namespace yli::ontology
 {
@@ -37,12 +36,12 @@ namespace yli::ontology
         // framebuffer width.
         const data::AnyValue& framebuffer_width_any_value = variable.variable_value;
 
-        if (!std::holds_alternative<std::uint32_t>(framebuffer_width_any_value.data))
+        if (!framebuffer_width_any_value.holds<std::uint32_t>())
         {
             return std::nullopt;
         }
 
-        const std::uint32_t framebuffer_width = std::get<std::uint32_t>(framebuffer_width_any_value.data);
+        const std::uint32_t framebuffer_width = framebuffer_width_any_value.get<std::uint32_t>();
 
         Universe* const universe = dynamic_cast<Universe*>(&entity);
 
@@ -63,12 +62,12 @@ namespace yli::ontology
         // framebuffer height.
         const data::AnyValue& framebuffer_height_any_value = variable.variable_value;
 
-        if (!std::holds_alternative<std::uint32_t>(framebuffer_height_any_value.data))
+        if (!framebuffer_height_any_value.holds<std::uint32_t>())
         {
             return std::nullopt;
         }
 
-        const std::uint32_t framebuffer_height = std::get<std::uint32_t>(framebuffer_height_any_value.data);
+        const std::uint32_t framebuffer_height = framebuffer_height_any_value.get<std::uint32_t>();
 
         Universe* universe = dynamic_cast<Universe*>(&entity);
 
@@ -97,44 +96,47 @@ namespace yli::ontology
         // red.
         const data::AnyValue& red_any_value = entity.get_variable("red")->variable_value;
 
-        if (!std::holds_alternative<float>(red_any_value.data))
+        if (!red_any_value.holds<float>())
         {
             return std::nullopt;
         }
 
-        const float red = std::get<float>(red_any_value.data);
+        const float red = red_any_value.get<float>();
 
         // green.
         const data::AnyValue& green_any_value = entity.get_variable("green")->variable_value;
 
-        if (!std::holds_alternative<float>(green_any_value.data))
+        if (!green_any_value.holds<float>())
         {
             return std::nullopt;
         }
 
-        const float green = std::get<float>(green_any_value.data);
+        const float green = green_any_value.get<float>();
 
         // blue.
         const data::AnyValue& blue_any_value = entity.get_variable("blue")->variable_value;
 
-        if (!std::holds_alternative<float>(blue_any_value.data))
+        if (!blue_any_value.holds<float>())
         {
             return std::nullopt;
         }
 
-        const float blue = std::get<float>(blue_any_value.data);
+        const float blue = blue_any_value.get<float>();
 
         // alpha.
         const data::AnyValue& alpha_any_value = entity.get_variable("alpha")->variable_value;
 
-        if (!std::holds_alternative<float>(alpha_any_value.data))
+        if (!alpha_any_value.holds<float>())
         {
             return std::nullopt;
         }
 
-        const float alpha = std::get<float>(alpha_any_value.data);
+        const float alpha = alpha_any_value.get<float>();
 
-        opengl::set_background_color(red, green, blue, alpha);
+        if (entity.get_universe().get_is_opengl_in_use())
+        {
+            opengl::set_background_color(red, green, blue, alpha);
+        }
 
         Universe* const universe = dynamic_cast<Universe*>(&entity);
 
@@ -150,14 +152,14 @@ namespace yli::ontology
     }
 
     std::optional<data::AnyValue> Variable::activate_wireframe(
-            Entity& /* entity */,
+            Entity& entity,
             Variable& variable)
     {
         const data::AnyValue& wireframe_any_value = variable.variable_value;
 
-        if (std::holds_alternative<bool>(wireframe_any_value.data))
+        if (wireframe_any_value.holds<bool>() && entity.get_universe().get_is_opengl_in_use())
         {
-            opengl::set_wireframe(std::get<bool>(wireframe_any_value.data));
+            opengl::set_wireframe(wireframe_any_value.get<bool>());
         }
 
         return std::nullopt;
@@ -173,12 +175,12 @@ namespace yli::ontology
         {
             const data::AnyValue& speed_any_value = variable.variable_value;
 
-            if (!std::holds_alternative<float>(speed_any_value.data))
+            if (!speed_any_value.holds<float>())
             {
                 return std::nullopt;
             }
 
-            movable->speed = std::get<float>(speed_any_value.data);
+            movable->speed = speed_any_value.get<float>();
             return std::nullopt;
         }
 
@@ -191,9 +193,9 @@ namespace yli::ontology
 
         const data::AnyValue& speed_any_value = variable.variable_value;
 
-        if (std::holds_alternative<float>(speed_any_value.data))
+        if (speed_any_value.holds<float>())
         {
-            universe->speed = std::get<float>(speed_any_value.data);
+            universe->speed = speed_any_value.get<float>();
         }
 
         return std::nullopt;
@@ -212,9 +214,9 @@ namespace yli::ontology
 
         const data::AnyValue& turbo_factor_any_value = variable.variable_value;
 
-        if (std::holds_alternative<float>(turbo_factor_any_value.data))
+        if (turbo_factor_any_value.holds<float>())
         {
-            universe->turbo_factor = std::get<float>(turbo_factor_any_value.data);
+            universe->turbo_factor = turbo_factor_any_value.get<float>();
         }
 
         return std::nullopt;
@@ -233,9 +235,9 @@ namespace yli::ontology
 
         const data::AnyValue& twin_turbo_factor_any_value = variable.variable_value;
 
-        if (std::holds_alternative<float>(twin_turbo_factor_any_value.data))
+        if (twin_turbo_factor_any_value.holds<float>())
         {
-            universe->twin_turbo_factor = std::get<float>(twin_turbo_factor_any_value.data);
+            universe->twin_turbo_factor = twin_turbo_factor_any_value.get<float>();
         }
 
         return std::nullopt;
@@ -254,9 +256,9 @@ namespace yli::ontology
 
         const data::AnyValue& mouse_speed_any_value = variable.variable_value;
 
-        if (std::holds_alternative<float>(mouse_speed_any_value.data))
+        if (mouse_speed_any_value.holds<float>())
         {
-            universe->mouse_speed = std::get<float>(mouse_speed_any_value.data);
+            universe->mouse_speed = mouse_speed_any_value.get<float>();
         }
 
         return std::nullopt;
@@ -275,9 +277,9 @@ namespace yli::ontology
 
         const data::AnyValue& is_flight_mode_in_use_any_value = variable.variable_value;
 
-        if (std::holds_alternative<bool>(is_flight_mode_in_use_any_value.data))
+        if (is_flight_mode_in_use_any_value.holds<bool>())
         {
-            scene->set_is_flight_mode_in_use(std::get<bool>(is_flight_mode_in_use_any_value.data));
+            scene->set_is_flight_mode_in_use(is_flight_mode_in_use_any_value.get<bool>());
         }
 
         return std::nullopt;
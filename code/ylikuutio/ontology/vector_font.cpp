@@ -28,9 +28,12 @@
 #include "glyph_struct.hpp"
 #include "code/ylikuutio/core/application.hpp"
 #include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/load/svg_font_loader.hpp"
 #include "code/ylikuutio/render/render_system.hpp"
 #include "code/ylikuutio/render/render_templates.hpp"
 #include "code/ylikuutio/string/extract_value.hpp"
+#include "code/ylikuutio/triangulation/polygon_triangulation.hpp"
+#include "code/ylikuutio/triangulation/triangulate_polygons_struct.hpp"
 
 // Include standard headers
 #include <cstddef>   // std::size_t
@@ -85,6 +88,11 @@ namespace yli::ontology
         return nullptr;
     }
 
+    void VectorFont::set_glyph_for_unicode_value(const std::int32_t unicode_value, Glyph& glyph)
+    {
+        this->unicode_glyph_map[unicode_value] = &glyph;
+    }
+
     VectorFont::VectorFont(
         core::Application& application,
         Universe& universe,
@@ -109,7 +117,13 @@ namespace yli::ontology
 
         if (this->font_file_format == "svg" || this->font_file_format == "SVG")
         {
-            // TODO: implement SVG font loading!
+            font_loading_result = load::load_svg_font(
+                    this->font_filename,
+                    this->vertex_scaling_factor,
+                    this->glyph_vertex_data,
+                    this->glyph_names,
+                    this->unicode_strings,
+                    this->glyph_advance_widths);
         }
 
         // `Entity` member variables begin here.
@@ -162,6 +176,21 @@ namespace yli::ontology
                 glyph_struct.glyph_vertex_data = &this->glyph_vertex_data.at(glyph_i);
                 glyph_struct.glyph_name_pointer = this->glyph_names.at(glyph_i).c_str();
                 glyph_struct.unicode_char_pointer = unicode_char_pointer;
+                glyph_struct.advance_width = this->glyph_advance_widths.at(glyph_i);
+
+                // The mesh of the `Glyph` is its triangulated outlines, flat in the xy plane.
+                triangulation::TriangulatePolygonsStruct triangulate_polygons_struct;
+                triangulate_polygons_struct.input_vertices = &this->glyph_vertex_data.at(glyph_i);
+
+                if (!triangulation::triangulate_polygons(
+                            triangulate_polygons_struct,
+                            glyph_struct.vertices,
+                            glyph_struct.uvs,
+                            glyph_struct.normals))
+                {
+                    std::cerr << "ERROR: `VectorFont::VectorFont`: triangulating the outlines of a `Glyph` failed!\n";
+                    continue;
+                }
 
                 std::string glyph_name_string = glyph_struct.glyph_name_pointer;
                 std::string unicode_string = glyph_struct.unicode_char_pointer;
@@ -172,7 +201,10 @@ namespace yli::ontology
 
                 // So that each `Glyph` can be referred to,
                 // we need a hash map that points from Unicode string to `Glyph`.
-                this->unicode_glyph_map[*unicode_value] = glyph;
+                if (glyph != nullptr)
+                {
+                    this->set_glyph_for_unicode_value(*unicode_value, *glyph);
+                }
             }
         }
     }
@@ -186,7 +218,7 @@ namespace yli::ontology
 
         render::RenderSystem& render_system = this->universe.get_render_system();
 
-        const Scene* const scene = this->get_scene();
+        const Scene* const scene = this->get_cached_scene();
 
         if (target_scene != nullptr && scene != nullptr && scene != target_scene)
         {
@@ -197,6 +229,7 @@ namespace yli::ontology
         const Scene* const new_target_scene = (target_scene != nullptr ? target_scene : scene);
 
         render_system.render_glyphs(this->parent_of_glyphs, new_target_scene);
+        render_system.render_text_3ds(this->master_of_text_3ds, new_target_scene);
     }
 
     Entity* VectorFont::get_parent() const
@@ -213,7 +246,7 @@ namespace yli::ontology
             throw std::runtime_error("ERROR: `VectorFont::get_scene`: `material_parent` is `nullptr`!");
         }
 
-        return material_parent->get_scene();
+        return material_parent->get_cached_scene();
     }
 
     Pipeline* VectorFont::get_pipeline() const
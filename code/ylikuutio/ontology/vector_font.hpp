@@ -87,6 +87,9 @@ namespace yli::ontology
         // and `nullptr` if this `VectorFont` does not contain such a `Glyph`.
         Glyph* get_glyph_pointer(std::int32_t unicode_value) const;
 
+        // This method makes `glyph` the `Glyph` of `unicode_value`.
+        void set_glyph_for_unicode_value(std::int32_t unicode_value, Glyph& glyph);
+
         // The rest fields are created in the constructor.
 
         template<typename T1, std::size_t DataSize>
@@ -110,7 +113,7 @@ namespace yli::ontology
 
         std::size_t get_number_of_descendants() const override;
 
-        // This method renders all `Glyph`s of this `VectorFont`.
+        // This method renders all `Glyph`s and `Text3d`s of this `VectorFont`.
         void render(const Scene* target_scene);
 
     private:
@@ -123,6 +126,7 @@ namespace yli::ontology
         std::vector<std::vector<glm::vec2>> glyph_normal_data;
         std::vector<std::string> glyph_names;
         std::vector<std::string> unicode_strings;
+        std::vector<float> glyph_advance_widths;
 
         std::unordered_map<std::int32_t, Glyph*> unicode_glyph_map;
     };
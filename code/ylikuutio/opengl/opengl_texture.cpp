@@ -17,6 +17,7 @@
 
 #include "opengl_texture.hpp"
 #include "opengl.hpp"
+#include "code/ylikuutio/load/texture_data.hpp"
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
 
 // Include standard headers
@@ -56,4 +57,51 @@ namespace yli::opengl
 
         return true;
     }
+
+    bool prepare_opengl_mipmapped_texture(
+        const load::TextureData& texture_data,
+        GLuint& textureID)
+    {
+        GLenum format = GL_RGB;
+
+        if (texture_data.n_color_channels == 4)
+        {
+            format = GL_RGBA;
+        }
+        else if (texture_data.n_color_channels != 3)
+        {
+            std::cerr << "ERROR: `yli::opengl::prepare_opengl_mipmapped_texture`: unsupported number of color channels: " <<
+                texture_data.n_color_channels << "!\n";
+            return false;
+        }
+
+        if (texture_data.mip_levels.empty())
+        {
+            std::cerr << "ERROR: `yli::opengl::prepare_opengl_mipmapped_texture`: there are no mip levels!\n";
+            return false;
+        }
+
+        glGenTextures(1, &textureID);
+        glBindTexture(GL_TEXTURE_2D, textureID);
+
+        // Rows are tightly packed, also for RGB mip levels with odd widths.
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        for (std::size_t level = 0; level < texture_data.mip_levels.size(); level++)
+        {
+            const load::MipLevel& mip_level = texture_data.mip_levels[level];
+            glTexImage2D(GL_TEXTURE_2D, level, format, mip_level.width, mip_level.height, 0, format, GL_UNSIGNED_BYTE,
+                         mip_level.data.data());
+        }
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, texture_data.mip_levels.size() - 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        return true;
+    }
 }
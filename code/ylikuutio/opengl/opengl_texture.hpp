@@ -20,6 +20,11 @@
 
 #include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
 
+namespace yli::load
+{
+    struct TextureData;
+}
+
 // Include standard headers
 #include <cstdint>  // std::uint8_t
 #include <cstddef>  // std::size_t
@@ -33,6 +38,12 @@ namespace yli::opengl
         std::size_t image_width,
         std::size_t image_height,
         GLuint& textureID);
+
+    // Load texture with a precomputed mip chain from memory.
+    // Does not call `glGenerateMipmap`.
+    bool prepare_opengl_mipmapped_texture(
+        const load::TextureData& texture_data,
+        GLuint& textureID);
 }
 
 #endif
@@ -0,0 +1,183 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "console_grid_mesh.hpp"
+#include "code/ylikuutio/console/console_grid.hpp"
+#include "code/ylikuutio/opengl/opengl.hpp"
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+namespace yli::render
+{
+    // Each cell is drawn as 2 triangles.
+    static constexpr std::size_t n_vertices_per_cell = 6;
+
+    ConsoleGridMesh::~ConsoleGridMesh()
+    {
+        if (this->vao != 0)
+        {
+            // Delete buffers.
+            glDeleteBuffers(1, &this->vertex_buffer);
+            glDeleteBuffers(1, &this->uv_buffer);
+
+            // Delete vertex array.
+            glDeleteVertexArrays(1, &this->vao);
+        }
+    }
+
+    void ConsoleGridMesh::create_vertices(const console::ConsoleGrid& console_grid, const ConsoleGridLayout& layout)
+    {
+        const std::uint32_t n_columns = console_grid.get_n_columns();
+        const std::uint32_t n_rows = console_grid.get_n_rows();
+
+        std::vector<glm::vec2> vertices;
+        vertices.reserve(static_cast<std::size_t>(n_columns) * n_rows * n_vertices_per_cell);
+
+        for (std::uint32_t row_i = 0; row_i < n_rows; row_i++)
+        {
+            const float top_y = static_cast<float>(layout.top_y) - static_cast<float>(row_i * layout.text_size);
+            const float bottom_y = top_y - static_cast<float>(layout.text_size);
+
+            for (std::uint32_t column_i = 0; column_i < n_columns; column_i++)
+            {
+                const float left_x = static_cast<float>(layout.left_x + column_i * layout.text_size);
+                const float right_x = left_x + static_cast<float>(layout.text_size);
+
+                vertices.emplace_back(left_x, top_y);
+                vertices.emplace_back(left_x, bottom_y);
+                vertices.emplace_back(right_x, top_y);
+
+                vertices.emplace_back(right_x, bottom_y);
+                vertices.emplace_back(right_x, top_y);
+                vertices.emplace_back(left_x, bottom_y);
+            }
+        }
+
+        this->n_vertices = static_cast<GLsizei>(vertices.size());
+
+        glBindBuffer(GL_ARRAY_BUFFER, this->vertex_buffer);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(glm::vec2), vertices.data(), GL_STATIC_DRAW);
+
+        // Allocate the UVs, the cells are uploaded by `update_uvs`.
+        glBindBuffer(GL_ARRAY_BUFFER, this->uv_buffer);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(glm::vec2), nullptr, GL_DYNAMIC_DRAW);
+    }
+
+    void ConsoleGridMesh::update_uvs(const console::ConsoleGrid& console_grid, const ConsoleGridLayout& layout)
+    {
+        const std::uint32_t n_columns = console_grid.get_n_columns();
+        const float glyph_size = 1.0f / static_cast<float>(layout.font_size);
+
+        glBindBuffer(GL_ARRAY_BUFFER, this->uv_buffer);
+
+        for (std::uint32_t row_i = 0; row_i < console_grid.get_n_rows(); row_i++)
+        {
+            const console::DirtyColumns dirty_columns = console_grid.get_dirty_columns(row_i);
+
+            if (dirty_columns.empty())
+            {
+                continue;
+            }
+
+            const std::string_view row = console_grid.get_row(row_i);
+            this->uvs.clear();
+
+            for (std::uint32_t column_i = dirty_columns.first; column_i < dirty_columns.last; column_i++)
+            {
+                const char character = row[column_i];
+                const float uv_x = (character % static_cast<int>(layout.font_size)) * glyph_size;
+                const float uv_y = (character / static_cast<int>(layout.font_size)) * glyph_size;
+
+                this->uvs.emplace_back(uv_x, uv_y);
+                this->uvs.emplace_back(uv_x, uv_y + glyph_size);
+                this->uvs.emplace_back(uv_x + glyph_size, uv_y);
+
+                this->uvs.emplace_back(uv_x + glyph_size, uv_y + glyph_size);
+                this->uvs.emplace_back(uv_x + glyph_size, uv_y);
+                this->uvs.emplace_back(uv_x, uv_y + glyph_size);
+            }
+
+            const std::size_t first_vertex_i =
+                (static_cast<std::size_t>(row_i) * n_columns + dirty_columns.first) * n_vertices_per_cell;
+            glBufferSubData(
+                    GL_ARRAY_BUFFER,
+                    first_vertex_i * sizeof(glm::vec2),
+                    this->uvs.size() * sizeof(glm::vec2),
+                    this->uvs.data());
+        }
+    }
+
+    void ConsoleGridMesh::render(
+            console::ConsoleGrid& console_grid,
+            const ConsoleGridLayout& layout,
+            const GLint vertex_position_in_screenspace_id,
+            const GLint vertex_uv_id)
+    {
+        if (this->vao == 0)
+        {
+            // Initialize VAO.
+            glGenVertexArrays(1, &this->vao);
+
+            // Initialize VBOs.
+            glGenBuffers(1, &this->vertex_buffer);
+            glGenBuffers(1, &this->uv_buffer);
+        }
+
+        glBindVertexArray(this->vao);
+
+        if (this->n_vertices == 0 || layout != this->layout) [[unlikely]]
+        {
+            // First frame, or the `Font2d` or the window size has changed.
+            this->create_vertices(console_grid, layout);
+            this->layout = layout;
+            console_grid.mark_all_dirty();
+        }
+
+        if (console_grid.get_is_dirty())
+        {
+            this->update_uvs(console_grid, layout);
+            console_grid.clear_dirty();
+        }
+
+        // 1st attribute buffer: vertices.
+        glBindBuffer(GL_ARRAY_BUFFER, this->vertex_buffer);
+        glVertexAttribPointer(vertex_position_in_screenspace_id, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        opengl::enable_vertex_attrib_array(vertex_position_in_screenspace_id);
+
+        // 2nd attribute buffer: uvs.
+        glBindBuffer(GL_ARRAY_BUFFER, this->uv_buffer);
+        glVertexAttribPointer(vertex_uv_id, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        opengl::enable_vertex_attrib_array(vertex_uv_id);
+
+        // Draw call.
+        glDrawArrays(GL_TRIANGLES, 0, this->n_vertices);
+
+        opengl::disable_vertex_attrib_array(vertex_position_in_screenspace_id);
+        opengl::disable_vertex_attrib_array(vertex_uv_id);
+    }
+}
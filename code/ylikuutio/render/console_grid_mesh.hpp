@@ -0,0 +1,87 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef YLIKUUTIO_RENDER_CONSOLE_GRID_MESH_HPP_INCLUDED
+#define YLIKUUTIO_RENDER_CONSOLE_GRID_MESH_HPP_INCLUDED
+
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstdint> // std::uint32_t
+#include <vector>  // std::vector
+
+namespace yli::console
+{
+    class ConsoleGrid;
+}
+
+namespace yli::render
+{
+    struct ConsoleGridLayout
+    {
+        bool operator==(const ConsoleGridLayout& rhs) const = default;
+
+        std::uint32_t left_x    { 0 };
+        std::uint32_t top_y     { 0 };
+        std::uint32_t text_size { 0 };
+        std::uint32_t font_size { 0 };
+    };
+
+    // `ConsoleGridMesh` is the GPU mesh of a `console::ConsoleGrid`, one quad per cell.
+    // The vertex positions are uploaded only when the layout changes.
+    // Of the UVs only the cells that have changed are uploaded.
+    // The whole grid is drawn with one draw call.
+    class ConsoleGridMesh
+    {
+    public:
+        ConsoleGridMesh() = default;
+
+        ~ConsoleGridMesh();
+
+        ConsoleGridMesh(const ConsoleGridMesh&) = delete;
+
+        ConsoleGridMesh& operator=(const ConsoleGridMesh&) = delete;
+
+        // Uploads the dirty cells of `console_grid`, clears them and draws the grid.
+        void render(
+                console::ConsoleGrid& console_grid,
+                const ConsoleGridLayout& layout,
+                GLint vertex_position_in_screenspace_id,
+                GLint vertex_uv_id);
+
+    private:
+        void create_vertices(const console::ConsoleGrid& console_grid, const ConsoleGridLayout& layout);
+
+        void update_uvs(const console::ConsoleGrid& console_grid, const ConsoleGridLayout& layout);
+
+        GLuint vao           { 0 };
+        GLuint vertex_buffer { 0 }; // Buffer containing the vertices, uploaded only when the layout changes.
+        GLuint uv_buffer     { 0 }; // Buffer containing the UVs, uploaded for changed cells only.
+        GLsizei n_vertices   { 0 };
+
+        ConsoleGridLayout layout;
+        std::vector<glm::vec2> uvs; // Scratch buffer for the UVs of the changed cells of one row.
+    };
+}
+
+#endif
@@ -0,0 +1,154 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "mesh_instance_batch.hpp"
+#include "code/ylikuutio/ontology/mesh_module.hpp"
+#include "code/ylikuutio/opengl/opengl.hpp"
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uintptr_t
+#include <vector>  // std::vector
+
+namespace yli::render
+{
+    // A `mat4` attribute occupies one location per column.
+    static constexpr GLint n_locations_per_model_matrix = 4;
+
+    MeshInstanceBatch::~MeshInstanceBatch()
+    {
+        if (this->instance_buffer != 0)
+        {
+            // Delete buffer.
+            glDeleteBuffers(1, &this->instance_buffer);
+        }
+    }
+
+    void MeshInstanceBatch::clear()
+    {
+        this->model_matrices.clear();
+    }
+
+    void MeshInstanceBatch::add_instance(const glm::mat4& model_matrix)
+    {
+        this->model_matrices.push_back(model_matrix);
+    }
+
+    void MeshInstanceBatch::render(const ontology::MeshModule& mesh, const GLint instance_model_matrix_id)
+    {
+        if (this->model_matrices.empty() || instance_model_matrix_id < 0)
+        {
+            return;
+        }
+
+        if (this->instance_buffer == 0)
+        {
+            // Initialize VBO.
+            glGenBuffers(1, &this->instance_buffer);
+        }
+
+        glBindVertexArray(mesh.get_vao());
+
+        glBindBuffer(GL_ARRAY_BUFFER, this->instance_buffer);
+        const GLsizeiptr size = static_cast<GLsizeiptr>(this->model_matrices.size() * sizeof(glm::mat4));
+
+        if (size == this->instance_buffer_size)
+        {
+            glBufferSubData(GL_ARRAY_BUFFER, 0, size, this->model_matrices.data());
+        }
+        else
+        {
+            glBufferData(GL_ARRAY_BUFFER, size, this->model_matrices.data(), GL_STREAM_DRAW);
+            this->instance_buffer_size = size;
+        }
+
+        // Instance attribute: model matrix, one column per location, advanced once per instance.
+        for (GLint column_i = 0; column_i < n_locations_per_model_matrix; column_i++)
+        {
+            glVertexAttribPointer(
+                    instance_model_matrix_id + column_i,
+                    4,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    sizeof(glm::mat4),
+                    reinterpret_cast<const void*>(static_cast<std::uintptr_t>(column_i) * sizeof(glm::vec4)));
+            opengl::enable_vertex_attrib_array(instance_model_matrix_id + column_i);
+            glVertexAttribDivisor(instance_model_matrix_id + column_i, 1);
+        }
+
+        const GLint vertex_position_modelspace_id = mesh.get_vertex_position_modelspace_id();
+        const GLint vertex_uv_id = mesh.get_vertex_uv_id();
+        const GLint vertex_normal_modelspace_id = mesh.get_vertex_normal_modelspace_id();
+
+        // 1st attribute buffer: vertices.
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.get_vertex_buffer());
+        glVertexAttribPointer(vertex_position_modelspace_id, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+        opengl::enable_vertex_attrib_array(vertex_position_modelspace_id);
+
+        // 2nd attribute buffer: UVs.
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.get_uv_buffer());
+        glVertexAttribPointer(vertex_uv_id, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        opengl::enable_vertex_attrib_array(vertex_uv_id);
+
+        // 3rd attribute buffer: normals.
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.get_normal_buffer());
+        glVertexAttribPointer(vertex_normal_modelspace_id, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+        opengl::enable_vertex_attrib_array(vertex_normal_modelspace_id);
+
+        // Index buffer.
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.get_element_buffer());
+
+        // Draw call.
+        glDrawElementsInstanced(
+                GL_TRIANGLES,
+                static_cast<GLsizei>(mesh.get_indices_size()),
+                GL_UNSIGNED_INT,
+                nullptr,
+                static_cast<GLsizei>(this->model_matrices.size()));
+
+        for (GLint column_i = 0; column_i < n_locations_per_model_matrix; column_i++)
+        {
+            glVertexAttribDivisor(instance_model_matrix_id + column_i, 0);
+            opengl::disable_vertex_attrib_array(instance_model_matrix_id + column_i);
+        }
+
+        opengl::disable_vertex_attrib_array(vertex_position_modelspace_id);
+        opengl::disable_vertex_attrib_array(vertex_uv_id);
+        opengl::disable_vertex_attrib_array(vertex_normal_modelspace_id);
+    }
+
+    const std::vector<glm::mat4>& MeshInstanceBatch::get_model_matrices() const
+    {
+        return this->model_matrices;
+    }
+
+    std::size_t MeshInstanceBatch::size() const
+    {
+        return this->model_matrices.size();
+    }
+
+    bool MeshInstanceBatch::empty() const
+    {
+        return this->model_matrices.empty();
+    }
+}
@@ -0,0 +1,77 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#ifndef YLIKUUTIO_RENDER_MESH_INSTANCE_BATCH_HPP_INCLUDED
+#define YLIKUUTIO_RENDER_MESH_INSTANCE_BATCH_HPP_INCLUDED
+
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <vector>  // std::vector
+
+namespace yli::ontology
+{
+    class MeshModule;
+}
+
+namespace yli::render
+{
+    // `MeshInstanceBatch` collects the model matrices of the instances
+    // of one mesh for a frame, and draws all of them with one instanced
+    // draw call. The model matrices are uploaded once per frame into
+    // one instance buffer.
+    class MeshInstanceBatch
+    {
+    public:
+        MeshInstanceBatch() = default;
+
+        ~MeshInstanceBatch();
+
+        MeshInstanceBatch(const MeshInstanceBatch&) = delete;
+
+        MeshInstanceBatch& operator=(const MeshInstanceBatch&) = delete;
+
+        void clear();
+
+        void add_instance(const glm::mat4& model_matrix);
+
+        // Uploads the model matrices and draws `mesh` once per instance.
+        // `instance_model_matrix_id` is the attribute location of the `mat4`
+        // instance attribute, which uses it and the 3 following locations.
+        void render(const ontology::MeshModule& mesh, GLint instance_model_matrix_id);
+
+        const std::vector<glm::mat4>& get_model_matrices() const;
+
+        std::size_t size() const;
+
+        bool empty() const;
+
+    private:
+        GLuint instance_buffer { 0 }; // Buffer containing the model matrices, uploaded every frame.
+        GLsizeiptr instance_buffer_size { 0 };
+
+        std::vector<glm::mat4> model_matrices;
+    };
+}
+
+#endif
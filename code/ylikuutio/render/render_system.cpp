@@ -34,11 +34,13 @@
 #include "code/ylikuutio/ontology/symbiosis.hpp"
 #include "code/ylikuutio/ontology/holobiont.hpp"
 #include "code/ylikuutio/ontology/biont.hpp"
+#include "code/ylikuutio/ontology/shapeshifter_transformation.hpp"
 #include "code/ylikuutio/ontology/shapeshifter_sequence.hpp"
 #include "code/ylikuutio/ontology/font_2d.hpp"
 #include "code/ylikuutio/ontology/text_2d.hpp"
 #include "code/ylikuutio/ontology/vector_font.hpp"
 #include "code/ylikuutio/ontology/glyph.hpp"
+#include "code/ylikuutio/ontology/text_3d.hpp"
 #include "code/ylikuutio/ontology/console.hpp"
 #include "code/ylikuutio/ontology/compute_task.hpp"
 #include "code/ylikuutio/opengl/opengl.hpp"
@@ -273,6 +275,17 @@ namespace yli::render
         render_children<ontology::GenericParentModule&, ontology::Biont*>(parent);
     }
 
+    void RenderSystem::render_shapeshifter_transformations(
+        ontology::GenericParentModule& parent,
+        const ontology::Scene* const scene)
+    {
+        render_children_of_given_scene_or_of_all_scenes<
+            ontology::GenericParentModule&,
+            ontology::ShapeshifterTransformation*>(
+            parent,
+            scene);
+    }
+
     void RenderSystem::render_shapeshifter_sequences(
         ontology::GenericParentModule& parent,
         const ontology::Scene* const scene)
@@ -324,6 +337,15 @@ namespace yli::render
             scene);
     }
 
+    void RenderSystem::render_text_3ds(
+        ontology::GenericMasterModule& master,
+        const ontology::Scene* const scene)
+    {
+        render_apprentices<ontology::GenericMasterModule&, ontology::Text3d*>(
+            master,
+            scene);
+    }
+
     void RenderSystem::render_compute_tasks(
         ontology::GenericParentModule& parent,
         const ontology::Scene* const scene)
@@ -99,6 +99,10 @@ namespace yli::render
 
                 static void render_bionts(ontology::GenericParentModule& parent);
 
+                static void render_shapeshifter_transformations(
+                        ontology::GenericParentModule& parent,
+                        const ontology::Scene* scene);
+
                 static void render_shapeshifter_sequences(
                         ontology::GenericParentModule& parent,
                         const ontology::Scene* scene);
@@ -119,6 +123,10 @@ namespace yli::render
                         ontology::GenericParentModule& parent,
                         const ontology::Scene* scene);
 
+                static void render_text_3ds(
+                        ontology::GenericMasterModule& master,
+                        const ontology::Scene* scene);
+
                 static void render_compute_tasks(
                         ontology::GenericParentModule& parent,
                         const ontology::Scene* scene);
@@ -58,7 +58,7 @@ namespace yli::render
 
             if (child_pointer != nullptr && child_pointer->should_render)
             {
-                if (ontology::Scene* const scene_of_child = child_pointer->get_scene();
+                if (ontology::Scene* const scene_of_child = child_pointer->get_cached_scene();
                     scene_of_child == scene || scene == nullptr)
                 {
                     // Set `Scene` of the child as the chosen `Scene`.
@@ -85,7 +85,7 @@ namespace yli::render
 
                 if (apprentice_pointer != nullptr && apprentice_pointer->should_render)
                 {
-                    if (ontology::Scene* const scene_of_apprentice = apprentice_pointer->get_scene();
+                    if (ontology::Scene* const scene_of_apprentice = apprentice_pointer->get_cached_scene();
                         scene_of_apprentice == scene || scene == nullptr)
                     {
                         // Set `Scene` of the apprentice as the chosen `Scene`.
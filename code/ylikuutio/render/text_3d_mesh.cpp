@@ -0,0 +1,256 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "text_3d_mesh.hpp"
+#include "code/ylikuutio/ontology/vector_font.hpp"
+#include "code/ylikuutio/ontology/glyph.hpp"
+#include "code/ylikuutio/ontology/mesh_module.hpp"
+#include "code/ylikuutio/opengl/opengl.hpp"
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+#include "code/ylikuutio/string/extract_value.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::int32_t, std::uint32_t, std::uintptr_t
+#include <optional>      // std::optional
+#include <stdexcept>     // std::runtime_error
+#include <string>        // std::string
+#include <unordered_map> // std::unordered_map
+#include <vector>        // std::vector
+
+namespace yli::render
+{
+    Text3dMesh::~Text3dMesh()
+    {
+        if (this->instance_buffer != 0)
+        {
+            // Delete buffer.
+            glDeleteBuffers(1, &this->instance_buffer);
+        }
+    }
+
+    std::size_t Text3dMesh::set_text(const std::string& text, const ontology::VectorFont& vector_font)
+    {
+        this->clear();
+
+        // The batch and the offset of each character, in text order.
+        std::vector<std::uint32_t> character_batch_indices;
+        std::vector<glm::vec3> character_offsets;
+        std::unordered_map<std::int32_t, std::uint32_t> unicode_value_to_batch_index;
+
+        glm::vec3 pen_position { 0.0f, 0.0f, 0.0f };
+        const char* text_pointer = text.c_str();
+
+        while (*text_pointer != '\0')
+        {
+            const std::optional<std::int32_t> unicode_value = yli::string::extract_unicode_value_from_string<char>(text_pointer);
+
+            if (!unicode_value.has_value()) [[unlikely]]
+            {
+                throw std::runtime_error("ERROR: `Text3dMesh::set_text`: extracting Unicode value failed!");
+            }
+
+            if (*unicode_value == '\n')
+            {
+                pen_position.x = 0.0f;
+                pen_position.y -= 1.0f;
+                continue;
+            }
+
+            const ontology::Glyph* const glyph = vector_font.get_glyph_pointer(*unicode_value);
+
+            if (glyph == nullptr)
+            {
+                // No matching `Glyph`, leave an empty space.
+                this->n_missing_characters++;
+                pen_position.x += 1.0f;
+                continue;
+            }
+
+            const auto [it, is_new_unicode_value] = unicode_value_to_batch_index.try_emplace(
+                    *unicode_value,
+                    static_cast<std::uint32_t>(this->batches.size()));
+
+            if (is_new_unicode_value)
+            {
+                this->batches.push_back(GlyphBatch { *unicode_value, 0, 0 });
+            }
+
+            this->batches[it->second].n_instances++;
+            character_batch_indices.push_back(it->second);
+            character_offsets.push_back(pen_position);
+            pen_position.x += glyph->get_advance_width();
+        }
+
+        // Group the offsets by batch, keeping the text order within each batch.
+        std::vector<std::uint32_t> next_instance_of_batches;
+        next_instance_of_batches.reserve(this->batches.size());
+        std::uint32_t first_instance = 0;
+
+        for (GlyphBatch& batch : this->batches)
+        {
+            batch.first_instance = first_instance;
+            next_instance_of_batches.push_back(first_instance);
+            first_instance += batch.n_instances;
+        }
+
+        this->instance_offsets.resize(character_offsets.size());
+
+        for (std::size_t character_i = 0; character_i < character_offsets.size(); character_i++)
+        {
+            const std::uint32_t instance_i = next_instance_of_batches[character_batch_indices[character_i]]++;
+            this->instance_offsets[instance_i] = character_offsets[character_i];
+        }
+
+        this->is_dirty = true;
+        return this->instance_offsets.size();
+    }
+
+    void Text3dMesh::clear()
+    {
+        this->batches.clear();
+        this->instance_offsets.clear();
+        this->n_missing_characters = 0;
+        this->is_dirty = true;
+    }
+
+    void Text3dMesh::render(const GLint vertex_instance_offset_id, const ontology::VectorFont& vector_font)
+    {
+        if (this->instance_offsets.empty() || vertex_instance_offset_id < 0)
+        {
+            return;
+        }
+
+        if (this->instance_buffer == 0)
+        {
+            // Initialize VBO.
+            glGenBuffers(1, &this->instance_buffer);
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, this->instance_buffer);
+
+        if (this->is_dirty)
+        {
+            const GLsizeiptr size = static_cast<GLsizeiptr>(this->instance_offsets.size() * sizeof(glm::vec3));
+
+            if (size == this->instance_buffer_size)
+            {
+                glBufferSubData(GL_ARRAY_BUFFER, 0, size, this->instance_offsets.data());
+            }
+            else
+            {
+                glBufferData(GL_ARRAY_BUFFER, size, this->instance_offsets.data(), GL_STATIC_DRAW);
+                this->instance_buffer_size = size;
+            }
+
+            this->is_dirty = false;
+        }
+
+        for (const GlyphBatch& batch : this->batches)
+        {
+            const ontology::Glyph* const glyph = vector_font.get_glyph_pointer(batch.unicode_value);
+
+            if (glyph == nullptr)
+            {
+                continue;
+            }
+
+            const ontology::MeshModule& mesh = glyph->mesh;
+            const GLint vertex_position_modelspace_id = mesh.get_vertex_position_modelspace_id();
+            const GLint vertex_uv_id = mesh.get_vertex_uv_id();
+            const GLint vertex_normal_modelspace_id = mesh.get_vertex_normal_modelspace_id();
+
+            glBindVertexArray(mesh.get_vao());
+
+            // 1st attribute buffer: vertices.
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.get_vertex_buffer());
+            glVertexAttribPointer(vertex_position_modelspace_id, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+            opengl::enable_vertex_attrib_array(vertex_position_modelspace_id);
+
+            // 2nd attribute buffer: UVs.
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.get_uv_buffer());
+            glVertexAttribPointer(vertex_uv_id, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+            opengl::enable_vertex_attrib_array(vertex_uv_id);
+
+            // 3rd attribute buffer: normals.
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.get_normal_buffer());
+            glVertexAttribPointer(vertex_normal_modelspace_id, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+            opengl::enable_vertex_attrib_array(vertex_normal_modelspace_id);
+
+            // 4th attribute buffer: instance offsets of this batch, advanced once per instance.
+            glBindBuffer(GL_ARRAY_BUFFER, this->instance_buffer);
+            glVertexAttribPointer(
+                    vertex_instance_offset_id,
+                    3,
+                    GL_FLOAT,
+                    GL_FALSE,
+                    0,
+                    reinterpret_cast<const void*>(static_cast<std::uintptr_t>(batch.first_instance) * sizeof(glm::vec3)));
+            opengl::enable_vertex_attrib_array(vertex_instance_offset_id);
+            glVertexAttribDivisor(vertex_instance_offset_id, 1);
+
+            // Index buffer.
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.get_element_buffer());
+
+            // Draw call.
+            glDrawElementsInstanced(
+                    GL_TRIANGLES,
+                    static_cast<GLsizei>(mesh.get_indices_size()),
+                    GL_UNSIGNED_INT,
+                    nullptr,
+                    static_cast<GLsizei>(batch.n_instances));
+
+            glVertexAttribDivisor(vertex_instance_offset_id, 0);
+            opengl::disable_vertex_attrib_array(vertex_position_modelspace_id);
+            opengl::disable_vertex_attrib_array(vertex_uv_id);
+            opengl::disable_vertex_attrib_array(vertex_normal_modelspace_id);
+            opengl::disable_vertex_attrib_array(vertex_instance_offset_id);
+        }
+    }
+
+    const std::vector<GlyphBatch>& Text3dMesh::get_batches() const
+    {
+        return this->batches;
+    }
+
+    const std::vector<glm::vec3>& Text3dMesh::get_instance_offsets() const
+    {
+        return this->instance_offsets;
+    }
+
+    std::size_t Text3dMesh::get_number_of_characters() const
+    {
+        return this->instance_offsets.size();
+    }
+
+    std::size_t Text3dMesh::get_number_of_missing_characters() const
+    {
+        return this->n_missing_characters;
+    }
+
+    std::size_t Text3dMesh::get_memory_usage() const
+    {
+        return sizeof(Text3dMesh) +
+            this->batches.capacity() * sizeof(GlyphBatch) +
+            this->instance_offsets.capacity() * sizeof(glm::vec3);
+    }
+}
@@ -0,0 +1,103 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#ifndef YLIKUUTIO_RENDER_TEXT_3D_MESH_HPP_INCLUDED
+#define YLIKUUTIO_RENDER_TEXT_3D_MESH_HPP_INCLUDED
+
+#include "code/ylikuutio/opengl/ylikuutio_glew.hpp" // GLfloat, GLuint etc.
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int32_t, std::uint32_t
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+namespace yli::ontology
+{
+    class VectorFont;
+}
+
+namespace yli::render
+{
+    // The instances `[first_instance, first_instance + n_instances)` of one Unicode code point.
+    // The `Glyph` is looked up from the `VectorFont` when rendering, so that
+    // a batch never refers to a `Glyph` that has been destroyed.
+    struct GlyphBatch
+    {
+        std::int32_t unicode_value    { 0 };
+        std::uint32_t first_instance { 0 };
+        std::uint32_t n_instances    { 0 };
+    };
+
+    // `Text3dMesh` is the GPU representation of the text of a `Text3d`.
+    // Each character is an instance of the mesh of its `Glyph`, placed
+    // by its offset in the text's modelspace. The offsets are grouped by
+    // `Glyph` into one instance buffer, so the whole text is drawn with
+    // one instanced draw call per distinct `Glyph` and no per-character
+    // `Entity` is needed.
+    class Text3dMesh
+    {
+    public:
+        Text3dMesh() = default;
+
+        ~Text3dMesh();
+
+        Text3dMesh(const Text3dMesh&) = delete;
+
+        Text3dMesh& operator=(const Text3dMesh&) = delete;
+
+        // Lays out `text` using the `Glyph`s of `vector_font`. Characters without
+        // a `Glyph` are skipped, but they still advance by 1. A newline starts
+        // a new line 1 unit lower. Returns the number of characters laid out.
+        std::size_t set_text(const std::string& text, const ontology::VectorFont& vector_font);
+
+        void clear();
+
+        // Uploads the instance buffer if the text has changed, and draws the batches
+        // using the current `Glyph`s of `vector_font`. Batches without a `Glyph` are skipped.
+        // `vertex_instance_offset_id` is the attribute location of the instance offset.
+        void render(GLint vertex_instance_offset_id, const ontology::VectorFont& vector_font);
+
+        const std::vector<GlyphBatch>& get_batches() const;
+
+        // The offsets of the instances, grouped by batch.
+        const std::vector<glm::vec3>& get_instance_offsets() const;
+
+        std::size_t get_number_of_characters() const;
+
+        std::size_t get_number_of_missing_characters() const;
+
+        // CPU memory used by the layout, in bytes.
+        std::size_t get_memory_usage() const;
+
+    private:
+        GLuint instance_buffer { 0 }; // Buffer containing the instance offsets, uploaded only when the text changes.
+        GLsizeiptr instance_buffer_size { 0 };
+
+        std::vector<GlyphBatch> batches;
+        std::vector<glm::vec3> instance_offsets;
+        std::size_t n_missing_characters { 0 };
+        bool is_dirty { false };
+    };
+}
+
+#endif
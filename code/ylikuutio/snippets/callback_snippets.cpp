@@ -27,7 +27,6 @@
 #include <cstdint>  // std::int32_t, std::uint32_t
 #include <iostream> // std::cout, std::cerr
 #include <optional> // std::optional
-#include <variant>  // std::holds_alternative
 
 namespace yli::ontology
 {
@@ -51,30 +50,30 @@ namespace yli::snippets
 
         const data::AnyValue& any_value = static_cast<ontology::CallbackParameter*>(input_parameters.get(0))->get_any_value();
 
-        if (std::holds_alternative<std::int32_t>(any_value.data))
+        if (any_value.holds<std::int32_t>())
         {
-            const std::int32_t factor = std::get<std::int32_t>(any_value.data);
+            const std::int32_t factor = any_value.get<std::int32_t>();
             const std::int32_t squared = factor * factor;
             std::cout << "Square of (std::int32_t) " << factor << " is " << squared << ".\n";
             return data::AnyValue(squared);
         }
-        if (std::holds_alternative<std::uint32_t>(any_value.data))
+        if (any_value.holds<std::uint32_t>())
         {
-            const std::uint32_t factor = std::get<std::uint32_t>(any_value.data);
+            const std::uint32_t factor = any_value.get<std::uint32_t>();
             const std::uint32_t squared = factor * factor;
             std::cout << "Square of (std::uint32_t) " << factor << " is " << squared << ".\n";
             return data::AnyValue(squared);
         }
-        if (std::holds_alternative<float>(any_value.data))
+        if (any_value.holds<float>())
         {
-            const float factor = std::get<float>(any_value.data);
+            const float factor = any_value.get<float>();
             const float squared = factor * factor;
             std::cout << "Square of (float) " << factor << " is " << squared << ".\n";
             return data::AnyValue(squared);
         }
-        if (std::holds_alternative<double>(any_value.data))
+        if (any_value.holds<double>())
         {
-            const double factor = std::get<double>(any_value.data);
+            const double factor = any_value.get<double>();
             const double squared = factor * factor;
             std::cout << "Square of (double) " << factor << " is " << squared << ".\n";
             return data::AnyValue(squared);
@@ -103,30 +102,30 @@ namespace yli::snippets
             return std::nullopt;
         }
 
-        if (std::holds_alternative<std::int32_t>((*return_value_any_value).data))
+        if ((*return_value_any_value).holds<std::int32_t>())
         {
-            const std::int32_t factor = std::get<std::int32_t>((*return_value_any_value).data);
+            const std::int32_t factor = (*return_value_any_value).get<std::int32_t>();
             const std::int32_t squared = factor * factor;
             std::cout << "Square of (std::int32_t) " << factor << " is " << squared << ".\n";
             return data::AnyValue(squared);
         }
-        if (std::holds_alternative<std::uint32_t>((*return_value_any_value).data))
+        if ((*return_value_any_value).holds<std::uint32_t>())
         {
-            const std::uint32_t factor = std::get<std::uint32_t>((*return_value_any_value).data);
+            const std::uint32_t factor = (*return_value_any_value).get<std::uint32_t>();
             const std::uint32_t squared = factor * factor;
             std::cout << "Square of (std::uint32_t) " << factor << " is " << squared << ".\n";
             return data::AnyValue(squared);
         }
-        if (std::holds_alternative<float>((*return_value_any_value).data))
+        if ((*return_value_any_value).holds<float>())
         {
-            const float factor = std::get<float>((*return_value_any_value).data);
+            const float factor = (*return_value_any_value).get<float>();
             const float squared = factor * factor;
             std::cout << "Square of (float) " << factor << " is " << squared << ".\n";
             return data::AnyValue(squared);
         }
-        if (std::holds_alternative<double>((*return_value_any_value).data))
+        if ((*return_value_any_value).holds<double>())
         {
-            const double factor = std::get<double>((*return_value_any_value).data);
+            const double factor = (*return_value_any_value).get<double>();
             const double squared = factor * factor;
             std::cout << "Square of (double) " << factor << " is " << squared << ".\n";
             return data::AnyValue(squared);
@@ -150,28 +149,28 @@ namespace yli::snippets
         const data::AnyValue& base = static_cast<ontology::CallbackParameter*>(input_parameters.get(0))->get_any_value();
         const data::AnyValue& exponent = static_cast<ontology::CallbackParameter*>(input_parameters.get(1))->get_any_value();
 
-        if (std::holds_alternative<std::int32_t>(base.data) && std::holds_alternative<std::int32_t>(exponent.data))
+        if (base.holds<std::int32_t>() && exponent.holds<std::int32_t>())
         {
-            const std::int32_t power = std::pow(std::get<std::int32_t>(base.data), std::get<std::int32_t>(exponent.data));
-            std::cout << "(std::int32_t) " << std::get<std::int32_t>(base.data) << "^" << std::get<std::int32_t>(exponent.data) << " is " << power << ".\n";
+            const std::int32_t power = std::pow(base.get<std::int32_t>(), exponent.get<std::int32_t>());
+            std::cout << "(std::int32_t) " << base.get<std::int32_t>() << "^" << exponent.get<std::int32_t>() << " is " << power << ".\n";
             return data::AnyValue(power);
         }
-        if (std::holds_alternative<std::uint32_t>(base.data) && std::holds_alternative<std::uint32_t>(exponent.data))
+        if (base.holds<std::uint32_t>() && exponent.holds<std::uint32_t>())
         {
-            const std::uint32_t power = std::pow(std::get<std::uint32_t>(base.data), std::get<std::uint32_t>(exponent.data));
-            std::cout << "(std::uint32_t) " << std::get<std::uint32_t>(base.data) << "^" << std::get<std::uint32_t>(exponent.data) << " is " << power << ".\n";
+            const std::uint32_t power = std::pow(base.get<std::uint32_t>(), exponent.get<std::uint32_t>());
+            std::cout << "(std::uint32_t) " << base.get<std::uint32_t>() << "^" << exponent.get<std::uint32_t>() << " is " << power << ".\n";
             return data::AnyValue(power);
         }
-        if (std::holds_alternative<float>(base.data) && std::holds_alternative<float>(exponent.data))
+        if (base.holds<float>() && exponent.holds<float>())
         {
-            const float power = std::pow(std::get<float>(base.data), std::get<float>(exponent.data));
-            std::cout << "(float) " << std::get<float>(base.data) << "^" << std::get<float>(exponent.data) << " is " << power << ".\n";
+            const float power = std::pow(base.get<float>(), exponent.get<float>());
+            std::cout << "(float) " << base.get<float>() << "^" << exponent.get<float>() << " is " << power << ".\n";
             return data::AnyValue(power);
         }
-        if (std::holds_alternative<double>(base.data) && std::holds_alternative<double>(exponent.data))
+        if (base.holds<double>() && exponent.holds<double>())
         {
-            const double power = std::pow(std::get<double>(base.data), std::get<double>(exponent.data));
-            std::cout << "(double) " << std::get<double>(base.data) << "^" << std::get<double>(exponent.data) << " is " << power << ".\n";
+            const double power = std::pow(base.get<double>(), exponent.get<double>());
+            std::cout << "(double) " << base.get<double>() << "^" << exponent.get<double>() << " is " << power << ".\n";
             return data::AnyValue(power);
         }
         return std::nullopt;
@@ -202,28 +201,28 @@ namespace yli::snippets
             return std::nullopt;
         }
 
-        if (std::holds_alternative<std::int32_t>(base->data) && std::holds_alternative<std::int32_t>(exponent->data))
+        if (base->holds<std::int32_t>() && exponent->holds<std::int32_t>())
         {
-            const std::int32_t power = std::pow(std::get<std::int32_t>(base->data), std::get<std::int32_t>(exponent->data));
-            std::cout << "(std::int32_t) " << std::get<std::int32_t>(base->data) << "^" << std::get<std::int32_t>(exponent->data) << " is " << power << ".\n";
+            const std::int32_t power = std::pow(base->get<std::int32_t>(), exponent->get<std::int32_t>());
+            std::cout << "(std::int32_t) " << base->get<std::int32_t>() << "^" << exponent->get<std::int32_t>() << " is " << power << ".\n";
             return data::AnyValue(power);
         }
-        if (std::holds_alternative<std::uint32_t>(base->data) && std::holds_alternative<std::uint32_t>((*exponent).data))
+        if (base->holds<std::uint32_t>() && (*exponent).holds<std::uint32_t>())
         {
-            const std::uint32_t power = std::pow(std::get<std::uint32_t>(base->data), std::get<std::uint32_t>(exponent->data));
-            std::cout << "(std::uint32_t) " << std::get<std::uint32_t>(base->data) << "^" << std::get<std::uint32_t>((*exponent).data) << " is " << power << ".\n";
+            const std::uint32_t power = std::pow(base->get<std::uint32_t>(), exponent->get<std::uint32_t>());
+            std::cout << "(std::uint32_t) " << base->get<std::uint32_t>() << "^" << (*exponent).get<std::uint32_t>() << " is " << power << ".\n";
             return data::AnyValue(power);
         }
-        if (std::holds_alternative<float>(base->data) && std::holds_alternative<float>(exponent->data))
+        if (base->holds<float>() && exponent->holds<float>())
         {
-            const float power = std::pow(std::get<float>(base->data), std::get<float>(exponent->data));
-            std::cout << "(float) " << std::get<float>(base->data) << "^" << std::get<float>(exponent->data) << " is " << power << ".\n";
+            const float power = std::pow(base->get<float>(), exponent->get<float>());
+            std::cout << "(float) " << base->get<float>() << "^" << exponent->get<float>() << " is " << power << ".\n";
             return data::AnyValue(power);
         }
-        if (std::holds_alternative<double>(base->data) && std::holds_alternative<double>(exponent->data))
+        if (base->holds<double>() && exponent->holds<double>())
         {
-            const double power = std::pow(std::get<double>(base->data), std::get<double>(exponent->data));
-            std::cout << "(double) " << std::get<double>(base->data) << "^" << std::get<double>(exponent->data) << " is " << power << ".\n";
+            const double power = std::pow(base->get<double>(), exponent->get<double>());
+            std::cout << "(double) " << base->get<double>() << "^" << exponent->get<double>() << " is " << power << ".\n";
             return data::AnyValue(power);
         }
         return std::nullopt;
@@ -244,22 +243,22 @@ namespace yli::snippets
 
         const data::AnyValue& any_value = static_cast<ontology::CallbackParameter*>(input_parameters.get(0))->get_any_value();
 
-        if (std::holds_alternative<std::int32_t>(any_value.data))
+        if (any_value.holds<std::int32_t>())
         {
-            const std::int32_t product = -1 * std::get<std::int32_t>(any_value.data);
-            std::cout << "-1 * (std::int32_t) " << std::get<std::int32_t>(any_value.data) << " is " << product << ".\n";
+            const std::int32_t product = -1 * any_value.get<std::int32_t>();
+            std::cout << "-1 * (std::int32_t) " << any_value.get<std::int32_t>() << " is " << product << ".\n";
             return data::AnyValue(product);
         }
-        if (std::holds_alternative<float>(any_value.data))
+        if (any_value.holds<float>())
         {
-            const float product = -1.0 * std::get<float>(any_value.data);
-            std::cout << "-1 * (float) " << std::get<float>(any_value.data) << " is " << product << ".\n";
+            const float product = -1.0 * any_value.get<float>();
+            std::cout << "-1 * (float) " << any_value.get<float>() << " is " << product << ".\n";
             return data::AnyValue(product);
         }
-        if (std::holds_alternative<double>(any_value.data))
+        if (any_value.holds<double>())
         {
-            const double product = -1.0 * std::get<double>(any_value.data);
-            std::cout << "-1 * (double) " << std::get<double>(any_value.data) << " is " << product << ".\n";
+            const double product = -1.0 * any_value.get<double>();
+            std::cout << "-1 * (double) " << any_value.get<double>() << " is " << product << ".\n";
             return data::AnyValue(product);
         }
         return std::nullopt;
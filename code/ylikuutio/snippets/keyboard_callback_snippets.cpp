@@ -35,11 +35,9 @@
 
 // Include standard headers
 #include <cstdint>    // std::uint32_t
-#include <functional> // std::reference_wrapper
 #include <iostream>   // std::cerr
 #include <optional>   // std::optional
 #include <string>     // std::string
-#include <variant>    // std::holds_alternative
 
 // Callbacks' input parameters can be accessed either through
 // `yli::ontology::CallbackObject* callback_object`or
@@ -338,21 +336,20 @@ namespace yli::snippets
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<std::reference_wrapper<std::string>>(entity_name_string_any_value->data) &&
-                !std::holds_alternative<std::reference_wrapper<const std::string>>(entity_name_string_any_value->data))
+        if (!entity_name_string_any_value->holds<std::string>())
         {
             std::cerr << "ERROR: `yli::snippets::delete_entity`: invalid datatype.\n";
-            std::cerr << "Datatype should be `std::reference_wrapper<std::string>` or `std::reference_wrapper<const std::string>`\n";
+            std::cerr << "Datatype should be `std::string`\n";
             return std::nullopt;
         }
 
-        const std::string& entity_name_string_ref = entity_name_string_any_value->get_const_std_string_ref();
+        const std::string entity_name_string = entity_name_string_any_value->get_string();
 
-        const ontology::Entity* const entity = universe.get_entity(entity_name_string_ref);
+        const ontology::Entity* const entity = universe.get_entity(entity_name_string);
 
         if (entity == nullptr)
         {
-            std::cerr << "ERROR: `yli::snippets::delete_entity`: `Entity` with name `" << entity_name_string_ref << "` does not exist!\n";
+            std::cerr << "ERROR: `yli::snippets::delete_entity`: `Entity` with name `" << entity_name_string << "` does not exist!\n";
             return std::nullopt;
         }
 
@@ -377,21 +374,20 @@ namespace yli::snippets
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<std::reference_wrapper<std::string>>(species_entity_name_string_any_value->data) &&
-                !std::holds_alternative<std::reference_wrapper<const std::string>>(species_entity_name_string_any_value->data))
+        if (!species_entity_name_string_any_value->holds<std::string>())
         {
             std::cerr << "ERROR: `yli::snippets::switch_to_new_material`: invalid datatype.\n";
-            std::cerr << "Datatype should be `std::reference_wrapper<std::string>` or `std::reference_wrapper<const std::string>`\n";
+            std::cerr << "Datatype should be `std::string`\n";
             return std::nullopt;
         }
 
-        const std::string& species_entity_name_string_ref = species_entity_name_string_any_value->get_const_std_string_ref();
+        const std::string species_entity_name_string = species_entity_name_string_any_value->get_string();
 
-        ontology::Entity* const species_entity = universe.get_entity(species_entity_name_string_ref);
+        ontology::Entity* const species_entity = universe.get_entity(species_entity_name_string);
 
         if (species_entity == nullptr)
         {
-            std::cerr << "ERROR: `yli::snippets::switch_to_new_material`: `Entity` with name `" << species_entity_name_string_ref << "` (arg 0) does not exist!\n";
+            std::cerr << "ERROR: `yli::snippets::switch_to_new_material`: `Entity` with name `" << species_entity_name_string << "` (arg 0) does not exist!\n";
             return std::nullopt;
         }
 
@@ -399,7 +395,7 @@ namespace yli::snippets
 
         if (species == nullptr)
         {
-            std::cerr << "ERROR: `yli::snippets::switch_to_new_material`: `Entity` with name `" << species_entity_name_string_ref << "` (arg 0) is not `Species`!\n";
+            std::cerr << "ERROR: `yli::snippets::switch_to_new_material`: `Entity` with name `" << species_entity_name_string << "` (arg 0) is not `Species`!\n";
             return std::nullopt;
         }
 
@@ -411,21 +407,20 @@ namespace yli::snippets
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<std::reference_wrapper<std::string>>((*material_name_string_any_value).data) &&
-                !std::holds_alternative<std::reference_wrapper<const std::string>>((*material_name_string_any_value).data))
+        if (!(*material_name_string_any_value).holds<std::string>())
         {
             std::cerr << "ERROR: `yli::snippets::switch_to_new_material`: invalid datatype.\n";
-            std::cerr << "Datatype should be `std::reference_wrapper<std::string>` or `std::reference_wrapper<const std::string>`\n";
+            std::cerr << "Datatype should be `std::string`\n";
             return std::nullopt;
         }
 
-        const std::string& new_material_string_ref = material_name_string_any_value->get_const_std_string_ref();
+        const std::string new_material_string = material_name_string_any_value->get_string();
 
-        ontology::Entity* const new_material_entity = universe.get_entity(new_material_string_ref);
+        ontology::Entity* const new_material_entity = universe.get_entity(new_material_string);
 
         if (new_material_entity == nullptr)
         {
-            std::cerr << "ERROR: `yli::snippets::switch_to_new_material`: `Entity` with name `" << new_material_string_ref << "` (arg 1) does not exist!\n";
+            std::cerr << "ERROR: `yli::snippets::switch_to_new_material`: `Entity` with name `" << new_material_string << "` (arg 1) does not exist!\n";
             return std::nullopt;
         }
 
@@ -433,7 +428,7 @@ namespace yli::snippets
 
         if (new_material == nullptr)
         {
-            std::cerr << "ERROR: `yli::snippets::switch_to_new_material`: `Entity` with name `" << new_material_string_ref << "` (arg 1) is not `Material`!\n";
+            std::cerr << "ERROR: `yli::snippets::switch_to_new_material`: `Entity` with name `" << new_material_string << "` (arg 1) is not `Material`!\n";
             return std::nullopt;
         }
 
@@ -455,21 +450,20 @@ namespace yli::snippets
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<std::reference_wrapper<std::string>>(object_entity_name_string_any_value->data) &&
-                !std::holds_alternative<std::reference_wrapper<const std::string>>(object_entity_name_string_any_value->data))
+        if (!object_entity_name_string_any_value->holds<std::string>())
         {
             std::cerr << "ERROR: `yli::snippets::transform_into_new_species`: invalid datatype.\n";
-            std::cerr << "Datatype should be `std::reference_wrapper<std::string>` or `std::reference_wrapper<const std::string>`\n";
+            std::cerr << "Datatype should be `std::string`\n";
             return std::nullopt;
         }
 
-        const std::string& object_entity_name_string_ref = object_entity_name_string_any_value->get_const_std_string_ref();
+        const std::string object_entity_name_string = object_entity_name_string_any_value->get_string();
 
-        ontology::Entity* const object_entity = universe.get_entity(object_entity_name_string_ref);
+        ontology::Entity* const object_entity = universe.get_entity(object_entity_name_string);
 
         if (object_entity == nullptr)
         {
-            std::cerr << "ERROR: `yli::snippets::transform_into_new_species`: `Entity` with name `" << object_entity_name_string_ref << "` (arg 0) does not exist!\n";
+            std::cerr << "ERROR: `yli::snippets::transform_into_new_species`: `Entity` with name `" << object_entity_name_string << "` (arg 0) does not exist!\n";
             return std::nullopt;
         }
 
@@ -477,7 +471,7 @@ namespace yli::snippets
 
         if (object == nullptr)
         {
-            std::cerr << "ERROR: `yli::snippets::transform_into_new_species`: `Entity` with name `" << object_entity_name_string_ref << "` (arg 0) is not `Object`!\n";
+            std::cerr << "ERROR: `yli::snippets::transform_into_new_species`: `Entity` with name `" << object_entity_name_string << "` (arg 0) is not `Object`!\n";
             return std::nullopt;
         }
 
@@ -489,17 +483,16 @@ namespace yli::snippets
             return std::nullopt;
         }
 
-        if (!std::holds_alternative<std::reference_wrapper<std::string>>(species_name_string_any_value->data) &&
-                !std::holds_alternative<std::reference_wrapper<const std::string>>(species_name_string_any_value->data))
+        if (!species_name_string_any_value->holds<std::string>())
         {
             std::cerr << "ERROR: `yli::snippets::transform_into_new_species`: arg 1 is of invalid datatype.\n";
-            std::cerr << "Datatype should be `std::reference_wrapper<std::string>` or `std::reference_wrapper<const std::string>`\n";
+            std::cerr << "Datatype should be `std::string`\n";
             return std::nullopt;
         }
 
-        const std::string& new_species_string_ref = species_name_string_any_value->get_const_std_string_ref();
+        const std::string new_species_string = species_name_string_any_value->get_string();
 
-        ontology::Entity* const new_species_entity = universe.get_entity(new_species_string_ref);
+        ontology::Entity* const new_species_entity = universe.get_entity(new_species_string);
 
         if (new_species_entity == nullptr)
         {
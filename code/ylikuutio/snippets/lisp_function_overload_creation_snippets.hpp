@@ -154,6 +154,9 @@ namespace yli::snippets
             // Other callbacks.
             entity_factory.create_console_lisp_function_overload("help", ontology::Request(&console), &help);
             entity_factory.create_console_lisp_function_overload("clear", ontology::Request(&console), &console::ConsoleLogicModule::clear);
+            entity_factory.create_console_lisp_function_overload("search", ontology::Request(&console), &console::ConsoleLogicModule::search);
+            entity_factory.create_console_lisp_function_overload("source", ontology::Request(&console), &console::ConsoleLogicModule::source);
+            entity_factory.create_console_lisp_function_overload("exec-file", ontology::Request(&console), &console::ConsoleLogicModule::source);
             entity_factory.create_console_lisp_function_overload("screenshot", ontology::Request(&console), &ontology::Universe::screenshot);
         }
 
@@ -25,6 +25,7 @@
 #include <iostream> // std::cout, std::cerr
 #include <numbers>  // std::numbers::pi
 #include <optional> // std::optional
+#include <span>     // std::span
 
 namespace yli::ontology
 {
@@ -32,10 +33,98 @@ namespace yli::ontology
     class Universe;
     class CallbackEngine;
     class CallbackObject;
+    class Movable;
 }
 
 namespace yli::snippets
 {
+    // Typed `MovableController` callbacks begin here.
+
+    void rest(ontology::Movable&, std::span<const data::AnyValue* const>)
+    {
+        // Do nothing.
+    }
+
+    void go_east(ontology::Movable& movable, std::span<const data::AnyValue* const>)
+    {
+        movable.location.xyz.x += movable.speed;
+        movable.notify_moved();
+    }
+
+    void go_west(ontology::Movable& movable, std::span<const data::AnyValue* const>)
+    {
+        movable.location.xyz.x -= movable.speed;
+        movable.notify_moved();
+    }
+
+    void go_north(ontology::Movable& movable, std::span<const data::AnyValue* const>)
+    {
+        movable.location.xyz.y += movable.speed;
+        movable.notify_moved();
+    }
+
+    void go_south(ontology::Movable& movable, std::span<const data::AnyValue* const>)
+    {
+        movable.location.xyz.y -= movable.speed;
+        movable.notify_moved();
+    }
+
+    void orient_to_east(ontology::Movable& movable, std::span<const data::AnyValue* const>)
+    {
+        movable.orientation.yaw = 0.0f;
+    }
+
+    void orient_to_west(ontology::Movable& movable, std::span<const data::AnyValue* const>)
+    {
+        movable.orientation.yaw = static_cast<float>(std::numbers::pi);
+    }
+
+    void orient_to_north(ontology::Movable& movable, std::span<const data::AnyValue* const>)
+    {
+        movable.orientation.yaw = 0.5f * static_cast<float>(std::numbers::pi);
+    }
+
+    void orient_to_south(ontology::Movable& movable, std::span<const data::AnyValue* const>)
+    {
+        movable.orientation.yaw = -0.5f * static_cast<float>(std::numbers::pi);
+    }
+
+    void rotate_clockwise(ontology::Movable& movable, std::span<const data::AnyValue* const>)
+    {
+        movable.orientation.yaw -= 0.1f * static_cast<float>(std::numbers::pi);
+    }
+
+    void rotate_counterclockwise(ontology::Movable& movable, std::span<const data::AnyValue* const>)
+    {
+        movable.orientation.yaw += 0.1f * static_cast<float>(std::numbers::pi);
+    }
+
+    void orient_and_go_east(ontology::Movable& movable, std::span<const data::AnyValue* const> args)
+    {
+        orient_to_east(movable, args);
+        go_east(movable, args);
+    }
+
+    void orient_and_go_west(ontology::Movable& movable, std::span<const data::AnyValue* const> args)
+    {
+        orient_to_west(movable, args);
+        go_west(movable, args);
+    }
+
+    void orient_and_go_north(ontology::Movable& movable, std::span<const data::AnyValue* const> args)
+    {
+        orient_to_north(movable, args);
+        go_north(movable, args);
+    }
+
+    void orient_and_go_south(ontology::Movable& movable, std::span<const data::AnyValue* const> args)
+    {
+        orient_to_south(movable, args);
+        go_south(movable, args);
+    }
+
+    // Untyped `MovableController` callbacks begin here.
+
     std::optional<data::AnyValue> rest(
             ontology::Universe&,
             ontology::CallbackEngine*,
@@ -56,8 +145,7 @@ namespace yli::snippets
     {
         if (any_value.has_movable_ref())
         {
-            ontology::Movable& movable = any_value.get_movable_ref();
-            movable.location.xyz.x += movable.speed;
+            go_east(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -74,8 +162,7 @@ namespace yli::snippets
     {
         if (any_value.has_movable_ref())
         {
-            ontology::Movable& movable = any_value.get_movable_ref();
-            movable.location.xyz.x -= movable.speed;
+            go_west(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -92,8 +179,7 @@ namespace yli::snippets
     {
         if (any_value.has_movable_ref())
         {
-            ontology::Movable& movable = any_value.get_movable_ref();
-            movable.location.xyz.y += movable.speed;
+            go_north(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -110,8 +196,7 @@ namespace yli::snippets
     {
         if (any_value.has_movable_ref())
         {
-            ontology::Movable& movable = any_value.get_movable_ref();
-            movable.location.xyz.y -= movable.speed;
+            go_south(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -128,8 +213,7 @@ namespace yli::snippets
     {
         if (any_value.has_movable_ref())
         {
-            ontology::Movable& movable = any_value.get_movable_ref();
-            movable.orientation.yaw = 0.0f;
+            orient_to_east(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -146,8 +230,7 @@ namespace yli::snippets
     {
         if (any_value.has_movable_ref())
         {
-            ontology::Movable& movable = any_value.get_movable_ref();
-            movable.orientation.yaw = static_cast<float>(std::numbers::pi);
+            orient_to_west(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -164,8 +247,7 @@ namespace yli::snippets
     {
         if (any_value.has_movable_ref())
         {
-            ontology::Movable& movable = any_value.get_movable_ref();
-            movable.orientation.yaw = 0.5f * static_cast<float>(std::numbers::pi);
+            orient_to_north(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -182,8 +264,7 @@ namespace yli::snippets
     {
         if (any_value.has_movable_ref())
         {
-            ontology::Movable& movable = any_value.get_movable_ref();
-            movable.orientation.yaw = -0.5f * static_cast<float>(std::numbers::pi);
+            orient_to_south(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -192,16 +273,15 @@ namespace yli::snippets
     }
 
     std::optional<data::AnyValue> orient_and_go_east(
-            ontology::Universe& universe,
-            ontology::CallbackEngine* callback_engine,
-            ontology::CallbackObject* callback_object,
-            ontology::GenericParentModule& callback_parameters,
+            ontology::Universe&,
+            ontology::CallbackEngine*,
+            ontology::CallbackObject*,
+            ontology::GenericParentModule&,
             const data::AnyValue& any_value)
     {
         if (any_value.has_movable_ref())
         {
-            orient_to_east(universe, callback_engine, callback_object, callback_parameters, any_value);
-            go_east(universe, callback_engine, callback_object, callback_parameters, any_value);
+            orient_and_go_east(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -210,16 +290,15 @@ namespace yli::snippets
     }
 
     std::optional<data::AnyValue> orient_and_go_west(
-            ontology::Universe& universe,
-            ontology::CallbackEngine* callback_engine,
-            ontology::CallbackObject* callback_object,
-            ontology::GenericParentModule& callback_parameters,
+            ontology::Universe&,
+            ontology::CallbackEngine*,
+            ontology::CallbackObject*,
+            ontology::GenericParentModule&,
             const data::AnyValue& any_value)
     {
         if (any_value.has_movable_ref())
         {
-            orient_to_west(universe, callback_engine, callback_object, callback_parameters, any_value);
-            go_west(universe, callback_engine, callback_object, callback_parameters, any_value);
+            orient_and_go_west(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -228,16 +307,15 @@ namespace yli::snippets
     }
 
     std::optional<data::AnyValue> orient_and_go_north(
-            ontology::Universe& universe,
-            ontology::CallbackEngine* callback_engine,
-            ontology::CallbackObject* callback_object,
-            ontology::GenericParentModule& callback_parameters,
+            ontology::Universe&,
+            ontology::CallbackEngine*,
+            ontology::CallbackObject*,
+            ontology::GenericParentModule&,
             const data::AnyValue& any_value)
     {
         if (any_value.has_movable_ref())
         {
-            orient_to_north(universe, callback_engine, callback_object, callback_parameters, any_value);
-            go_north(universe, callback_engine, callback_object, callback_parameters, any_value);
+            orient_and_go_north(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -246,16 +324,15 @@ namespace yli::snippets
     }
 
     std::optional<data::AnyValue> orient_and_go_south(
-            ontology::Universe& universe,
-            ontology::CallbackEngine* callback_engine,
-            ontology::CallbackObject* callback_object,
-            ontology::GenericParentModule& callback_parameters,
+            ontology::Universe&,
+            ontology::CallbackEngine*,
+            ontology::CallbackObject*,
+            ontology::GenericParentModule&,
             const data::AnyValue& any_value)
     {
         if (any_value.has_movable_ref())
         {
-            orient_to_south(universe, callback_engine, callback_object, callback_parameters, any_value);
-            go_south(universe, callback_engine, callback_object, callback_parameters, any_value);
+            orient_and_go_south(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -272,8 +349,7 @@ namespace yli::snippets
     {
         if (any_value.has_movable_ref())
         {
-            ontology::Movable& movable = any_value.get_movable_ref();
-            movable.orientation.yaw -= 0.1f * static_cast<float>(std::numbers::pi);
+            rotate_clockwise(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
@@ -290,8 +366,7 @@ namespace yli::snippets
     {
         if (any_value.has_movable_ref())
         {
-            ontology::Movable& movable = any_value.get_movable_ref();
-            movable.orientation.yaw += 0.1f * static_cast<float>(std::numbers::pi);
+            rotate_counterclockwise(any_value.get_movable_ref(), {});
             return std::nullopt;
         }
 
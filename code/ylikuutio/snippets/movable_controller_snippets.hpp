@@ -22,6 +22,7 @@
 
 // Include standard headers
 #include <optional> // std::optional
+#include <span>     // std::span
 
 namespace yli::ontology
 {
@@ -29,10 +30,29 @@ namespace yli::ontology
     class Universe;
     class CallbackEngine;
     class CallbackObject;
+    class Movable;
 }
 
 namespace yli::snippets
 {
+    // Typed callbacks, see `CallbackEngine::create_movable_callback_object`.
+    void rest(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void go_east(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void go_west(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void go_north(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void go_south(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void orient_to_east(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void orient_to_west(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void orient_to_north(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void orient_to_south(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void rotate_clockwise(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void rotate_counterclockwise(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void orient_and_go_east(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void orient_and_go_west(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void orient_and_go_north(ontology::Movable&, std::span<const data::AnyValue* const>);
+    void orient_and_go_south(ontology::Movable&, std::span<const data::AnyValue* const>);
+
+    // Untyped callbacks, see `CallbackEngine::create_callback_object`.
     std::optional<data::AnyValue> rest(
             ontology::Universe&,
             ontology::CallbackEngine*,
@@ -19,13 +19,15 @@
 #define YLIKUUTIO_STRING_CONVERT_STRING_TO_VALUE_HPP_INCLUDED
 
 // Include standard headers
-#include <cstdint>     // std::int8_t, std::int16_t, std::int32_t, std::int64_t, std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
-#include <cstdlib>     // std::strtod, std::strtof, std::strtoll, std::strtoull
-#include <iostream>    // std::cerr
-#include <limits>      // std::numeric_limits
-#include <optional>    // std::nullopt, std::optional
-#include <string>      // std::string
-#include <string_view> // std::string_view
+#include <charconv>     // std::from_chars
+#include <cstdint>      // std::int8_t, std::int16_t, std::int32_t, std::int64_t, std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
+#include <cstdlib>      // std::strtod, std::strtof, std::strtoll, std::strtoull
+#include <iostream>     // std::cerr
+#include <limits>       // std::numeric_limits
+#include <optional>     // std::nullopt, std::optional
+#include <string>       // std::string
+#include <string_view>  // std::string_view
+#include <system_error> // std::errc
 
 namespace yli::string
 {
@@ -65,6 +67,23 @@ namespace yli::string
         return static_cast<T>(value);
     }
 
+    // Unlike `convert_string_to_value`, this requires the whole string
+    // to be a number and fails also if the value is out of range of `T`.
+    template<typename T>
+    std::optional<T> convert_string_to_number(const std::string_view string)
+    {
+        T value {};
+        const char* const end = string.data() + string.size();
+        const auto [pointer, error_code] = std::from_chars(string.data(), end, value);
+
+        if (error_code != std::errc() || pointer != end)
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+
     template<typename T>
     std::optional<T> convert_string_to_value(std::string_view string) = delete;
 
@@ -18,9 +18,12 @@
 #include "string_set.hpp"
 
 // Include standard headers
-#include <cstddef> // std::size_t
-#include <string>  // std::string
-#include <vector>  // std::vector
+#include <algorithm> // std::sort
+#include <cstddef>   // std::size_t
+#include <iterator>  // std::next
+#include <string>    // std::string
+#include <utility>   // std::move
+#include <vector>    // std::vector
 
 namespace yli::string
 {
@@ -34,6 +37,19 @@ namespace yli::string
         this->strings.insert(string);
     }
 
+    void StringSet::add_strings(std::vector<std::string>&& strings)
+    {
+        std::sort(strings.begin(), strings.end());
+
+        auto hint = this->strings.begin();
+
+        for (std::string& string : strings)
+        {
+            // Duplicates are ignored by `std::set::insert`.
+            hint = std::next(this->strings.insert(hint, std::move(string)));
+        }
+    }
+
     void StringSet::erase_string(const std::string& string)
     {
         this->strings.erase(string);
@@ -48,12 +64,10 @@ namespace yli::string
     {
         std::size_t n_matches = 0;
 
-        for (const std::string& string : this->strings)
+        // The strings are sorted, so the completions are consecutive, starting from the first string >= `input`.
+        for (auto it = this->strings.lower_bound(input); it != this->strings.end() && it->starts_with(input); ++it)
         {
-            if (string.compare(0, input.size(), input) == 0)
-            {
-                n_matches++;
-            }
+            n_matches++;
         }
 
         return n_matches;
@@ -96,12 +110,9 @@ namespace yli::string
     {
         std::vector<std::string> completions;
 
-        for (const std::string& string : this->strings)
+        for (auto it = this->strings.lower_bound(input); it != this->strings.end() && it->starts_with(input); ++it)
         {
-            if (string.compare(0, input.size(), input) == 0)
-            {
-                completions.emplace_back(string);
-            }
+            completions.emplace_back(*it);
         }
 
         return completions;
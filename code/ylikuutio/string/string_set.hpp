@@ -38,6 +38,10 @@ namespace yli::string
 
         void add_string(const std::string& string);
 
+        // Adds many strings at once. Sorting them first lets
+        // each insertion start from where the previous one ended.
+        void add_strings(std::vector<std::string>&& strings);
+
         void erase_string(const std::string& string);
 
         [[nodiscard]] bool contains(const std::string& string) const;
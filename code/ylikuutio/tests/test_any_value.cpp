@@ -59,24 +59,24 @@
 #include <cmath>      // NAN, std::isnan
 #include <cstdint>    // std::int8_t, std::int16_t, std::int32_t, std::int64_t, std::uint8_t, std::uint16_t, std::uint32_t, std::uint64_t
 #include <cstring>    // std::strcmp
-#include <functional> // std::reference_wrapper
 #include <limits>     // std::numeric_limits
 #include <string>     // std::string
-#include <variant>    // std::holds_alternative, std::monostate
+#include <utility>    // std::move
+#include <variant>    // std::monostate
 #include <vector>     // std::vector
 
 TEST(any_value_must_be_initialized_appropriately, default_constructor)
 {
     constexpr auto default_value = yli::data::AnyValue();
-    ASSERT_TRUE(std::holds_alternative<std::monostate>(default_value.data));
+    ASSERT_TRUE(default_value.holds<std::monostate>());
 }
 
 TEST(any_value_must_be_initialized_appropriately, bool_true)
 {
     constexpr bool bool_true = true;
     const auto true_value = yli::data::AnyValue(bool_true);
-    ASSERT_TRUE(std::holds_alternative<bool>(true_value.data));
-    ASSERT_TRUE(std::get<bool>(true_value.data));
+    ASSERT_TRUE(true_value.holds<bool>());
+    ASSERT_TRUE(true_value.get<bool>());
     ASSERT_EQ(std::char_traits<char>::length(true_value.get_datatype().c_str()), std::char_traits<char>::length("bool"));
     ASSERT_EQ(std::strcmp(true_value.get_datatype().c_str(), "bool"), 0);
     ASSERT_EQ(std::char_traits<char>::length(true_value.get_string().c_str()), std::char_traits<char>::length("true"));
@@ -87,8 +87,8 @@ TEST(any_value_must_be_initialized_appropriately, bool_false)
 {
     constexpr bool bool_false = false;
     const auto false_value = yli::data::AnyValue(bool_false);
-    ASSERT_TRUE(std::holds_alternative<bool>(false_value.data));
-    ASSERT_FALSE(std::get<bool>(false_value.data));
+    ASSERT_TRUE(false_value.holds<bool>());
+    ASSERT_FALSE(false_value.get<bool>());
     ASSERT_EQ(std::char_traits<char>::length(false_value.get_datatype().c_str()), std::char_traits<char>::length("bool"));
     ASSERT_EQ(std::strcmp(false_value.get_datatype().c_str(), "bool"), 0);
     ASSERT_EQ(std::char_traits<char>::length(false_value.get_string().c_str()), std::char_traits<char>::length("false"));
@@ -99,8 +99,8 @@ TEST(any_value_must_be_initialized_appropriately, char_lowercase_a)
 {
     constexpr char char_lowercase_a = 'a';
     const auto lowercase_a_value = yli::data::AnyValue(char_lowercase_a);
-    ASSERT_TRUE(std::holds_alternative<char>(lowercase_a_value.data));
-    ASSERT_EQ(std::get<char>(lowercase_a_value.data), 'a');
+    ASSERT_TRUE(lowercase_a_value.holds<char>());
+    ASSERT_EQ(lowercase_a_value.get<char>(), 'a');
     ASSERT_EQ(std::char_traits<char>::length(lowercase_a_value.get_datatype().c_str()), std::char_traits<char>::length("char"));
     ASSERT_EQ(std::strcmp(lowercase_a_value.get_datatype().c_str(), "char"), 0);
     ASSERT_EQ(std::char_traits<char>::length(lowercase_a_value.get_string().c_str()), std::char_traits<char>::length("a"));
@@ -111,8 +111,8 @@ TEST(any_value_must_be_initialized_appropriately, char_lowercase_b)
 {
     constexpr char char_lowercase_b = 'b';
     const auto lowercase_b_value = yli::data::AnyValue(char_lowercase_b);
-    ASSERT_TRUE(std::holds_alternative<char>(lowercase_b_value.data));
-    ASSERT_EQ(std::get<char>(lowercase_b_value.data), 'b');
+    ASSERT_TRUE(lowercase_b_value.holds<char>());
+    ASSERT_EQ(lowercase_b_value.get<char>(), 'b');
     ASSERT_EQ(std::char_traits<char>::length(lowercase_b_value.get_datatype().c_str()), std::char_traits<char>::length("char"));
     ASSERT_EQ(std::strcmp(lowercase_b_value.get_datatype().c_str(), "char"), 0);
     ASSERT_EQ(std::char_traits<char>::length(lowercase_b_value.get_string().c_str()), std::char_traits<char>::length("b"));
@@ -123,8 +123,8 @@ TEST(any_value_must_be_initialized_appropriately, char_space)
 {
     constexpr char char_space = ' ';
     const auto space_value = yli::data::AnyValue(char_space);
-    ASSERT_TRUE(std::holds_alternative<char>(space_value.data));
-    ASSERT_EQ(std::get<char>(space_value.data), ' ');
+    ASSERT_TRUE(space_value.holds<char>());
+    ASSERT_EQ(space_value.get<char>(), ' ');
     ASSERT_EQ(std::char_traits<char>::length(space_value.get_datatype().c_str()), std::char_traits<char>::length("char"));
     ASSERT_EQ(std::strcmp(space_value.get_datatype().c_str(), "char"), 0);
     ASSERT_EQ(std::char_traits<char>::length(space_value.get_string().c_str()), std::char_traits<char>::length(" "));
@@ -135,8 +135,8 @@ TEST(any_value_must_be_initialized_appropriately, char_newline)
 {
     constexpr char char_newline = '\n';
     const auto newline_value = yli::data::AnyValue(char_newline);
-    ASSERT_TRUE(std::holds_alternative<char>(newline_value.data));
-    ASSERT_EQ(std::get<char>(newline_value.data), '\n');
+    ASSERT_TRUE(newline_value.holds<char>());
+    ASSERT_EQ(newline_value.get<char>(), '\n');
     ASSERT_EQ(std::char_traits<char>::length(newline_value.get_datatype().c_str()), std::char_traits<char>::length("char"));
     ASSERT_EQ(std::strcmp(newline_value.get_datatype().c_str(), "char"), 0);
     ASSERT_EQ(std::char_traits<char>::length(newline_value.get_string().c_str()), std::char_traits<char>::length("\n"));
@@ -147,8 +147,8 @@ TEST(any_value_must_be_initialized_appropriately, float_0)
 {
     constexpr float float_zero = 0.0f;
     const auto float_zero_value = yli::data::AnyValue(float_zero);
-    ASSERT_TRUE(std::holds_alternative<float>(float_zero_value.data));
-    ASSERT_EQ(std::get<float>(float_zero_value.data), 0.0f);
+    ASSERT_TRUE(float_zero_value.holds<float>());
+    ASSERT_EQ(float_zero_value.get<float>(), 0.0f);
     ASSERT_EQ(std::char_traits<char>::length(float_zero_value.get_datatype().c_str()), std::char_traits<char>::length("float"));
     ASSERT_EQ(std::strcmp(float_zero_value.get_datatype().c_str(), "float"), 0);
     ASSERT_EQ(std::char_traits<char>::length(float_zero_value.get_string().c_str()), std::char_traits<char>::length("0.000000"));
@@ -160,8 +160,8 @@ TEST(any_value_must_be_initialized_appropriately, float_positive_infinity)
 {
     const float float_positive_infinity = std::numeric_limits<float>::infinity();
     const auto float_positive_infinity_value = yli::data::AnyValue(float_positive_infinity);
-    ASSERT_TRUE(std::holds_alternative<float>(float_positive_infinity_value.data));
-    ASSERT_EQ(std::get<float>(float_positive_infinity_value.data), std::numeric_limits<float>::infinity());
+    ASSERT_TRUE(float_positive_infinity_value.holds<float>());
+    ASSERT_EQ(float_positive_infinity_value.get<float>(), std::numeric_limits<float>::infinity());
     ASSERT_EQ(std::char_traits<char>::length(float_positive_infinity_value.get_datatype().c_str()), std::char_traits<char>::length("float"));
     ASSERT_EQ(std::strcmp(float_positive_infinity_value.get_datatype().c_str(), "float"), 0);
     ASSERT_EQ(std::char_traits<char>::length(float_positive_infinity_value.get_string().c_str()), std::char_traits<char>::length("inf"));
@@ -172,8 +172,8 @@ TEST(any_value_must_be_initialized_appropriately, float_negative_infinity)
 {
     const float float_negative_infinity = -1.0f * std::numeric_limits<float>::infinity();
     const auto float_negative_infinity_value = yli::data::AnyValue(float_negative_infinity);
-    ASSERT_TRUE(std::holds_alternative<float>(float_negative_infinity_value.data));
-    ASSERT_EQ(std::get<float>(float_negative_infinity_value.data), float_negative_infinity);
+    ASSERT_TRUE(float_negative_infinity_value.holds<float>());
+    ASSERT_EQ(float_negative_infinity_value.get<float>(), float_negative_infinity);
     ASSERT_EQ(std::char_traits<char>::length(float_negative_infinity_value.get_datatype().c_str()), std::char_traits<char>::length("float"));
     ASSERT_EQ(std::strcmp(float_negative_infinity_value.get_datatype().c_str(), "float"), 0);
     ASSERT_EQ(std::char_traits<char>::length(float_negative_infinity_value.get_string().c_str()), std::char_traits<char>::length("-inf"));
@@ -184,8 +184,8 @@ TEST(any_value_must_be_initialized_appropriately, float_nan)
 {
     constexpr float float_nan = NAN;
     const auto float_nan_value = yli::data::AnyValue(float_nan);
-    ASSERT_TRUE(std::holds_alternative<float>(float_nan_value.data));
-    ASSERT_TRUE(std::isnan(std::get<float>(float_nan_value.data)));
+    ASSERT_TRUE(float_nan_value.holds<float>());
+    ASSERT_TRUE(std::isnan(float_nan_value.get<float>()));
     ASSERT_EQ(std::char_traits<char>::length(float_nan_value.get_datatype().c_str()), std::char_traits<char>::length("float"));
     ASSERT_EQ(std::strcmp(float_nan_value.get_datatype().c_str(), "float"), 0);
     ASSERT_EQ(std::char_traits<char>::length(float_nan_value.get_string().c_str()), std::char_traits<char>::length("nan"));
@@ -196,8 +196,8 @@ TEST(any_value_must_be_initialized_appropriately, double_0)
 {
     constexpr double double_zero = 0.0f;
     const auto double_zero_value = yli::data::AnyValue(double_zero);
-    ASSERT_TRUE(std::holds_alternative<double>(double_zero_value.data));
-    ASSERT_EQ(std::get<double>(double_zero_value.data), 0.0f);
+    ASSERT_TRUE(double_zero_value.holds<double>());
+    ASSERT_EQ(double_zero_value.get<double>(), 0.0f);
     ASSERT_EQ(std::char_traits<char>::length(double_zero_value.get_datatype().c_str()), std::char_traits<char>::length("double"));
     ASSERT_EQ(std::strcmp(double_zero_value.get_datatype().c_str(), "double"), 0);
     ASSERT_EQ(std::char_traits<char>::length(double_zero_value.get_string().c_str()), std::char_traits<char>::length("0.000000"));
@@ -209,8 +209,8 @@ TEST(any_value_must_be_initialized_appropriately, double_positive_infinity)
 {
     const double double_positive_infinity = std::numeric_limits<double>::infinity();
     const auto double_positive_infinity_value = yli::data::AnyValue(double_positive_infinity);
-    ASSERT_TRUE(std::holds_alternative<double>(double_positive_infinity_value.data));
-    ASSERT_EQ(std::get<double>(double_positive_infinity_value.data), std::numeric_limits<double>::infinity());
+    ASSERT_TRUE(double_positive_infinity_value.holds<double>());
+    ASSERT_EQ(double_positive_infinity_value.get<double>(), std::numeric_limits<double>::infinity());
     ASSERT_EQ(std::char_traits<char>::length(double_positive_infinity_value.get_datatype().c_str()), std::char_traits<char>::length("double"));
     ASSERT_EQ(std::strcmp(double_positive_infinity_value.get_datatype().c_str(), "double"), 0);
     ASSERT_EQ(std::char_traits<char>::length(double_positive_infinity_value.get_string().c_str()), std::char_traits<char>::length("inf"));
@@ -221,8 +221,8 @@ TEST(any_value_must_be_initialized_appropriately, double_negative_infinity)
 {
     const double double_negative_infinity = -1 * std::numeric_limits<double>::infinity();
     const auto double_negative_infinity_value = yli::data::AnyValue(double_negative_infinity);
-    ASSERT_TRUE(std::holds_alternative<double>(double_negative_infinity_value.data));
-    ASSERT_EQ(std::get<double>(double_negative_infinity_value.data), double_negative_infinity);
+    ASSERT_TRUE(double_negative_infinity_value.holds<double>());
+    ASSERT_EQ(double_negative_infinity_value.get<double>(), double_negative_infinity);
     ASSERT_EQ(std::char_traits<char>::length(double_negative_infinity_value.get_datatype().c_str()), std::char_traits<char>::length("double"));
     ASSERT_EQ(std::strcmp(double_negative_infinity_value.get_datatype().c_str(), "double"), 0);
     ASSERT_EQ(std::char_traits<char>::length(double_negative_infinity_value.get_string().c_str()), std::char_traits<char>::length("-inf"));
@@ -233,8 +233,8 @@ TEST(any_value_must_be_initialized_appropriately, double_nan)
 {
     constexpr double double_nan = NAN;
     const auto double_nan_value = yli::data::AnyValue(double_nan);
-    ASSERT_TRUE(std::holds_alternative<double>(double_nan_value.data));
-    ASSERT_TRUE(std::isnan(std::get<double>(double_nan_value.data)));
+    ASSERT_TRUE(double_nan_value.holds<double>());
+    ASSERT_TRUE(std::isnan(double_nan_value.get<double>()));
     ASSERT_EQ(std::char_traits<char>::length(double_nan_value.get_datatype().c_str()), std::char_traits<char>::length("double"));
     ASSERT_EQ(std::strcmp(double_nan_value.get_datatype().c_str(), "double"), 0);
     ASSERT_EQ(std::char_traits<char>::length(double_nan_value.get_string().c_str()), std::char_traits<char>::length("nan"));
@@ -245,8 +245,8 @@ TEST(any_value_must_be_initialized_appropriately, int32_t_zero)
 {
     constexpr std::int32_t int32_t_zero = 0;
     const auto int32_t_zero_value = yli::data::AnyValue(int32_t_zero);
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(int32_t_zero_value.data));
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_zero_value.data), 0);
+    ASSERT_TRUE(int32_t_zero_value.holds<std::int32_t>());
+    ASSERT_EQ(int32_t_zero_value.get<std::int32_t>(), 0);
     ASSERT_EQ(std::char_traits<char>::length(int32_t_zero_value.get_datatype().c_str()), std::char_traits<char>::length("std::int32_t"));
     ASSERT_EQ(std::strcmp(int32_t_zero_value.get_datatype().c_str(), "std::int32_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(int32_t_zero_value.get_string().c_str()), std::char_traits<char>::length("0"));
@@ -257,8 +257,8 @@ TEST(any_value_must_be_initialized_appropriately, int32_t_plus_1)
 {
     constexpr std::int32_t int32_t_plus_1 = 1;
     const auto int32_t_plus_1_value = yli::data::AnyValue(int32_t_plus_1);
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(int32_t_plus_1_value.data));
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_plus_1_value.data), 1);
+    ASSERT_TRUE(int32_t_plus_1_value.holds<std::int32_t>());
+    ASSERT_EQ(int32_t_plus_1_value.get<std::int32_t>(), 1);
     ASSERT_EQ(std::char_traits<char>::length(int32_t_plus_1_value.get_datatype().c_str()), std::char_traits<char>::length("std::int32_t"));
     ASSERT_EQ(std::strcmp(int32_t_plus_1_value.get_datatype().c_str(), "std::int32_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(int32_t_plus_1_value.get_string().c_str()), std::char_traits<char>::length("1"));
@@ -269,8 +269,8 @@ TEST(any_value_must_be_initialized_appropriately, int32_t_minus_1)
 {
     constexpr std::int32_t int32_t_minus_1 = -1;
     const auto int32_t_minus_1_value = yli::data::AnyValue(int32_t_minus_1);
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(int32_t_minus_1_value.data));
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_minus_1_value.data), -1);
+    ASSERT_TRUE(int32_t_minus_1_value.holds<std::int32_t>());
+    ASSERT_EQ(int32_t_minus_1_value.get<std::int32_t>(), -1);
     ASSERT_EQ(std::char_traits<char>::length(int32_t_minus_1_value.get_datatype().c_str()), std::char_traits<char>::length("std::int32_t"));
     ASSERT_EQ(std::strcmp(int32_t_minus_1_value.get_datatype().c_str(), "std::int32_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(int32_t_minus_1_value.get_string().c_str()), std::char_traits<char>::length("-1"));
@@ -281,14 +281,14 @@ TEST(any_value_must_be_initialized_appropriately, int32_t_max)
 {
     const std::int32_t int32_t_max = std::numeric_limits<std::int32_t>::max();
     const auto int32_t_max_value = yli::data::AnyValue(int32_t_max);
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(int32_t_max_value.data));
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_max_value.data), 2147483647);
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_max_value.data), std::numeric_limits<std::int32_t>::max());
+    ASSERT_TRUE(int32_t_max_value.holds<std::int32_t>());
+    ASSERT_EQ(int32_t_max_value.get<std::int32_t>(), 2147483647);
+    ASSERT_EQ(int32_t_max_value.get<std::int32_t>(), std::numeric_limits<std::int32_t>::max());
 #ifdef __linux__
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_max_value.data), std::numeric_limits<int>::max());
+    ASSERT_EQ(int32_t_max_value.get<std::int32_t>(), std::numeric_limits<int>::max());
 #elif defined(_WIN32) || defined(WIN32)
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_max_value.data), std::numeric_limits<int>::max());
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_max_value.data), std::numeric_limits<long>::max());
+    ASSERT_EQ(int32_t_max_value.get<std::int32_t>(), std::numeric_limits<int>::max());
+    ASSERT_EQ(int32_t_max_value.get<std::int32_t>(), std::numeric_limits<long>::max());
 #endif
     ASSERT_EQ(std::char_traits<char>::length(int32_t_max_value.get_datatype().c_str()), std::char_traits<char>::length("std::int32_t"));
     ASSERT_EQ(std::strcmp(int32_t_max_value.get_datatype().c_str(), "std::int32_t"), 0);
@@ -300,14 +300,14 @@ TEST(any_value_must_be_initialized_appropriately, int32_t_min)
 {
     const std::int32_t int32_t_min = std::numeric_limits<std::int32_t>::min();
     const auto int32_t_min_value = yli::data::AnyValue(int32_t_min);
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(int32_t_min_value.data));
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_min_value.data), -2147483648);
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_min_value.data), std::numeric_limits<std::int32_t>::min());
+    ASSERT_TRUE(int32_t_min_value.holds<std::int32_t>());
+    ASSERT_EQ(int32_t_min_value.get<std::int32_t>(), -2147483648);
+    ASSERT_EQ(int32_t_min_value.get<std::int32_t>(), std::numeric_limits<std::int32_t>::min());
 #ifdef __linux__
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_min_value.data), std::numeric_limits<int>::min());
+    ASSERT_EQ(int32_t_min_value.get<std::int32_t>(), std::numeric_limits<int>::min());
 #elif defined(_WIN32) || defined(WIN32)
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_min_value.data), std::numeric_limits<int>::min());
-    ASSERT_EQ(std::get<std::int32_t>(int32_t_min_value.data), std::numeric_limits<long>::min());
+    ASSERT_EQ(int32_t_min_value.get<std::int32_t>(), std::numeric_limits<int>::min());
+    ASSERT_EQ(int32_t_min_value.get<std::int32_t>(), std::numeric_limits<long>::min());
 #endif
     ASSERT_EQ(std::char_traits<char>::length(int32_t_min_value.get_datatype().c_str()), std::char_traits<char>::length("std::int32_t"));
     ASSERT_EQ(std::strcmp(int32_t_min_value.get_datatype().c_str(), "std::int32_t"), 0);
@@ -319,8 +319,8 @@ TEST(any_value_must_be_initialized_appropriately, uint32_t_zero)
 {
     constexpr std::uint32_t uint32_t_zero = 0;
     const auto uint32_t_zero_value = yli::data::AnyValue(uint32_t_zero);
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(uint32_t_zero_value.data));
-    ASSERT_EQ(std::get<std::uint32_t>(uint32_t_zero_value.data), 0);
+    ASSERT_TRUE(uint32_t_zero_value.holds<std::uint32_t>());
+    ASSERT_EQ(uint32_t_zero_value.get<std::uint32_t>(), 0);
     ASSERT_EQ(std::char_traits<char>::length(uint32_t_zero_value.get_datatype().c_str()), std::char_traits<char>::length("std::uint32_t"));
     ASSERT_EQ(std::strcmp(uint32_t_zero_value.get_datatype().c_str(), "std::uint32_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(uint32_t_zero_value.get_string().c_str()), std::char_traits<char>::length("0"));
@@ -331,8 +331,8 @@ TEST(any_value_must_be_initialized_appropriately, uint32_t_plus_1)
 {
     constexpr std::uint32_t uint32_t_plus_1 = 1;
     const auto uint32_t_plus_1_value = yli::data::AnyValue(uint32_t_plus_1);
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(uint32_t_plus_1_value.data));
-    ASSERT_EQ(std::get<std::uint32_t>(uint32_t_plus_1_value.data), 1);
+    ASSERT_TRUE(uint32_t_plus_1_value.holds<std::uint32_t>());
+    ASSERT_EQ(uint32_t_plus_1_value.get<std::uint32_t>(), 1);
     ASSERT_EQ(std::char_traits<char>::length(uint32_t_plus_1_value.get_datatype().c_str()), std::char_traits<char>::length("std::uint32_t"));
     ASSERT_EQ(std::strcmp(uint32_t_plus_1_value.get_datatype().c_str(), "std::uint32_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(uint32_t_plus_1_value.get_string().c_str()), std::char_traits<char>::length("1"));
@@ -343,13 +343,13 @@ TEST(any_value_must_be_initialized_appropriately, uint32_t_max)
 {
     const std::uint32_t uint32_t_max = std::numeric_limits<std::uint32_t>::max();
     const auto uint32_t_max_value = yli::data::AnyValue(uint32_t_max);
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(uint32_t_max_value.data));
-    ASSERT_EQ(std::get<std::uint32_t>(uint32_t_max_value.data), std::numeric_limits<std::uint32_t>::max());
+    ASSERT_TRUE(uint32_t_max_value.holds<std::uint32_t>());
+    ASSERT_EQ(uint32_t_max_value.get<std::uint32_t>(), std::numeric_limits<std::uint32_t>::max());
 #ifdef __linux__
-    ASSERT_EQ(std::get<std::uint32_t>(uint32_t_max_value.data), std::numeric_limits<unsigned int>::max());
+    ASSERT_EQ(uint32_t_max_value.get<std::uint32_t>(), std::numeric_limits<unsigned int>::max());
 #elif defined(_WIN32) || defined(WIN32)
-    ASSERT_EQ(std::get<std::uint32_t>(uint32_t_max_value.data), std::numeric_limits<unsigned int>::max());
-    ASSERT_EQ(std::get<std::uint32_t>(uint32_t_max_value.data), std::numeric_limits<unsigned long>::max());
+    ASSERT_EQ(uint32_t_max_value.get<std::uint32_t>(), std::numeric_limits<unsigned int>::max());
+    ASSERT_EQ(uint32_t_max_value.get<std::uint32_t>(), std::numeric_limits<unsigned long>::max());
 #endif
     ASSERT_EQ(std::char_traits<char>::length(uint32_t_max_value.get_datatype().c_str()), std::char_traits<char>::length("std::uint32_t"));
     ASSERT_EQ(std::strcmp(uint32_t_max_value.get_datatype().c_str(), "std::uint32_t"), 0);
@@ -361,8 +361,8 @@ TEST(any_value_must_be_initialized_appropriately, int64_t_zero)
 {
     constexpr std::int64_t int64_t_zero = 0;
     const auto int64_t_zero_value = yli::data::AnyValue(int64_t_zero);
-    ASSERT_TRUE(std::holds_alternative<std::int64_t>(int64_t_zero_value.data));
-    ASSERT_EQ(std::get<std::int64_t>(int64_t_zero_value.data), 0);
+    ASSERT_TRUE(int64_t_zero_value.holds<std::int64_t>());
+    ASSERT_EQ(int64_t_zero_value.get<std::int64_t>(), 0);
     ASSERT_EQ(std::char_traits<char>::length(int64_t_zero_value.get_datatype().c_str()), std::char_traits<char>::length("std::int64_t"));
     ASSERT_EQ(std::strcmp(int64_t_zero_value.get_datatype().c_str(), "std::int64_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(int64_t_zero_value.get_string().c_str()), std::char_traits<char>::length("0"));
@@ -373,8 +373,8 @@ TEST(any_value_must_be_initialized_appropriately, int64_t_plus_1)
 {
     constexpr std::int64_t int64_t_plus_1 = 1;
     const auto int64_t_plus_1_value = yli::data::AnyValue(int64_t_plus_1);
-    ASSERT_TRUE(std::holds_alternative<std::int64_t>(int64_t_plus_1_value.data));
-    ASSERT_EQ(std::get<std::int64_t>(int64_t_plus_1_value.data), 1);
+    ASSERT_TRUE(int64_t_plus_1_value.holds<std::int64_t>());
+    ASSERT_EQ(int64_t_plus_1_value.get<std::int64_t>(), 1);
     ASSERT_EQ(std::char_traits<char>::length(int64_t_plus_1_value.get_datatype().c_str()), std::char_traits<char>::length("std::int64_t"));
     ASSERT_EQ(std::strcmp(int64_t_plus_1_value.get_datatype().c_str(), "std::int64_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(int64_t_plus_1_value.get_string().c_str()), std::char_traits<char>::length("1"));
@@ -385,8 +385,8 @@ TEST(any_value_must_be_initialized_appropriately, int64_t_minus_1)
 {
     constexpr std::int64_t int64_t_minus_1 = -1;
     const auto int64_t_minus_1_value = yli::data::AnyValue(int64_t_minus_1);
-    ASSERT_TRUE(std::holds_alternative<std::int64_t>(int64_t_minus_1_value.data));
-    ASSERT_EQ(std::get<std::int64_t>(int64_t_minus_1_value.data), -1);
+    ASSERT_TRUE(int64_t_minus_1_value.holds<std::int64_t>());
+    ASSERT_EQ(int64_t_minus_1_value.get<std::int64_t>(), -1);
     ASSERT_EQ(std::char_traits<char>::length(int64_t_minus_1_value.get_datatype().c_str()), std::char_traits<char>::length("std::int64_t"));
     ASSERT_EQ(std::strcmp(int64_t_minus_1_value.get_datatype().c_str(), "std::int64_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(int64_t_minus_1_value.get_string().c_str()), std::char_traits<char>::length("-1"));
@@ -397,9 +397,9 @@ TEST(any_value_must_be_initialized_appropriately, int64_t_max)
 {
     const std::int64_t int64_t_max = std::numeric_limits<std::int64_t>::max();
     const auto int64_t_max_value = yli::data::AnyValue(int64_t_max);
-    ASSERT_TRUE(std::holds_alternative<std::int64_t>(int64_t_max_value.data));
-    ASSERT_EQ(std::get<std::int64_t>(int64_t_max_value.data), 9223372036854775807);
-    ASSERT_EQ(std::get<std::int64_t>(int64_t_max_value.data), std::numeric_limits<std::int64_t>::max());
+    ASSERT_TRUE(int64_t_max_value.holds<std::int64_t>());
+    ASSERT_EQ(int64_t_max_value.get<std::int64_t>(), 9223372036854775807);
+    ASSERT_EQ(int64_t_max_value.get<std::int64_t>(), std::numeric_limits<std::int64_t>::max());
     ASSERT_EQ(std::char_traits<char>::length(int64_t_max_value.get_datatype().c_str()), std::char_traits<char>::length("std::int64_t"));
     ASSERT_EQ(std::strcmp(int64_t_max_value.get_datatype().c_str(), "std::int64_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(int64_t_max_value.get_string().c_str()), std::char_traits<char>::length("9223372036854775807"));
@@ -410,9 +410,9 @@ TEST(any_value_must_be_initialized_appropriately, int64_t_min)
 {
     const std::int64_t int64_t_min = std::numeric_limits<std::int64_t>::min();
     const auto int64_t_min_value = yli::data::AnyValue(int64_t_min);
-    ASSERT_TRUE(std::holds_alternative<std::int64_t>(int64_t_min_value.data));
-    ASSERT_EQ(std::get<std::int64_t>(int64_t_min_value.data), -9223372036854775808u);
-    ASSERT_EQ(std::get<std::int64_t>(int64_t_min_value.data), std::numeric_limits<std::int64_t>::min());
+    ASSERT_TRUE(int64_t_min_value.holds<std::int64_t>());
+    ASSERT_EQ(int64_t_min_value.get<std::int64_t>(), -9223372036854775808u);
+    ASSERT_EQ(int64_t_min_value.get<std::int64_t>(), std::numeric_limits<std::int64_t>::min());
     ASSERT_EQ(std::char_traits<char>::length(int64_t_min_value.get_datatype().c_str()), std::char_traits<char>::length("std::int64_t"));
     ASSERT_EQ(std::strcmp(int64_t_min_value.get_datatype().c_str(), "std::int64_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(int64_t_min_value.get_string().c_str()), std::char_traits<char>::length("-9223372036854775808"));
@@ -423,8 +423,8 @@ TEST(any_value_must_be_initialized_appropriately, uint64_t_zero)
 {
     constexpr std::uint64_t uint64_t_zero = 0;
     const auto uint64_t_zero_value = yli::data::AnyValue(uint64_t_zero);
-    ASSERT_TRUE(std::holds_alternative<std::uint64_t>(uint64_t_zero_value.data));
-    ASSERT_EQ(std::get<std::uint64_t>(uint64_t_zero_value.data), 0);
+    ASSERT_TRUE(uint64_t_zero_value.holds<std::uint64_t>());
+    ASSERT_EQ(uint64_t_zero_value.get<std::uint64_t>(), 0);
     ASSERT_EQ(std::char_traits<char>::length(uint64_t_zero_value.get_datatype().c_str()), std::char_traits<char>::length("std::uint64_t"));
     ASSERT_EQ(std::strcmp(uint64_t_zero_value.get_datatype().c_str(), "std::uint64_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(uint64_t_zero_value.get_string().c_str()), std::char_traits<char>::length("0"));
@@ -435,8 +435,8 @@ TEST(any_value_must_be_initialized_appropriately, uint64_t_plus_1)
 {
     constexpr std::uint64_t uint64_t_plus_1 = 1;
     const auto uint64_t_plus_1_value = yli::data::AnyValue(uint64_t_plus_1);
-    ASSERT_TRUE(std::holds_alternative<std::uint64_t>(uint64_t_plus_1_value.data));
-    ASSERT_EQ(std::get<std::uint64_t>(uint64_t_plus_1_value.data), 1);
+    ASSERT_TRUE(uint64_t_plus_1_value.holds<std::uint64_t>());
+    ASSERT_EQ(uint64_t_plus_1_value.get<std::uint64_t>(), 1);
     ASSERT_EQ(std::char_traits<char>::length(uint64_t_plus_1_value.get_datatype().c_str()), std::char_traits<char>::length("std::uint64_t"));
     ASSERT_EQ(std::strcmp(uint64_t_plus_1_value.get_datatype().c_str(), "std::uint64_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(uint64_t_plus_1_value.get_string().c_str()), std::char_traits<char>::length("1"));
@@ -447,8 +447,8 @@ TEST(any_value_must_be_initialized_appropriately, uint64_t_max)
 {
     const std::uint64_t uint64_t_max = std::numeric_limits<std::uint64_t>::max();
     const auto uint64_t_max_value = yli::data::AnyValue(uint64_t_max);
-    ASSERT_TRUE(std::holds_alternative<std::uint64_t>(uint64_t_max_value.data));
-    ASSERT_EQ(std::get<std::uint64_t>(uint64_t_max_value.data), std::numeric_limits<std::uint64_t>::max());
+    ASSERT_TRUE(uint64_t_max_value.holds<std::uint64_t>());
+    ASSERT_EQ(uint64_t_max_value.get<std::uint64_t>(), std::numeric_limits<std::uint64_t>::max());
     ASSERT_EQ(std::char_traits<char>::length(uint64_t_max_value.get_datatype().c_str()), std::char_traits<char>::length("std::uint64_t"));
     ASSERT_EQ(std::strcmp(uint64_t_max_value.get_datatype().c_str(), "std::uint64_t"), 0);
     ASSERT_EQ(std::char_traits<char>::length(uint64_t_max_value.get_string().c_str()), std::char_traits<char>::length("18446744073709551615"));
@@ -460,8 +460,8 @@ TEST(any_value_must_be_initialized_appropriately, universe_as_entity)
     const mock::MockApplication application;
     yli::ontology::Entity* const universe_entity = &application.get_universe();
     const auto entity_any_value = yli::data::AnyValue(*universe_entity);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Entity>>(entity_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Entity>>(entity_any_value.data).get(), *universe_entity);
+    ASSERT_TRUE(entity_any_value.holds<yli::ontology::Entity>());
+    ASSERT_EQ(entity_any_value.get<yli::ontology::Entity>(), *universe_entity);
     ASSERT_EQ(std::strcmp(entity_any_value.get_datatype().c_str(), "yli::ontology::Entity&"), 0);
     ASSERT_EQ(entity_any_value.get_entity_ref(), *universe_entity);
 }
@@ -474,8 +474,8 @@ TEST(any_value_must_be_initialized_appropriately, object_as_movable)
             object_struct);
 
     const auto movable_any_value = yli::data::AnyValue(*object_movable);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Movable>>(movable_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Movable>>(movable_any_value.data).get(), *object_movable);
+    ASSERT_TRUE(movable_any_value.holds<yli::ontology::Movable>());
+    ASSERT_EQ(movable_any_value.get<yli::ontology::Movable>(), *object_movable);
     ASSERT_EQ(std::strcmp(movable_any_value.get_datatype().c_str(), "yli::ontology::Movable&"), 0);
     ASSERT_EQ(movable_any_value.get_entity_ref(), *object_movable);
     ASSERT_EQ(movable_any_value.get_const_entity_ref(), *object_movable);
@@ -489,8 +489,8 @@ TEST(any_value_must_be_initialized_appropriately, object_as_const_movable)
             object_struct);
 
     const auto const_movable_any_value = yli::data::AnyValue(*const_object_movable);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<const yli::ontology::Movable>>(const_movable_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<const yli::ontology::Movable>>(const_movable_any_value.data).get(), *const_object_movable);
+    ASSERT_TRUE(const_movable_any_value.holds<const yli::ontology::Movable>());
+    ASSERT_EQ(const_movable_any_value.get<const yli::ontology::Movable>(), *const_object_movable);
     ASSERT_EQ(std::strcmp(const_movable_any_value.get_datatype().c_str(), "const yli::ontology::Movable&"), 0);
     ASSERT_EQ(const_movable_any_value.get_const_entity_ref(), *const_object_movable);
 }
@@ -501,8 +501,8 @@ TEST(any_value_must_be_initialized_appropriately, universe)
     yli::ontology::Universe* const universe = &application.get_universe();
 
     const auto universe_any_value = yli::data::AnyValue(*universe);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Universe>>(universe_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Universe>>(universe_any_value.data).get(), *universe);
+    ASSERT_TRUE(universe_any_value.holds<yli::ontology::Universe>());
+    ASSERT_EQ(universe_any_value.get<yli::ontology::Universe>(), *universe);
     ASSERT_EQ(std::strcmp(universe_any_value.get_datatype().c_str(), "yli::ontology::Universe&"), 0);
     ASSERT_EQ(universe_any_value.get_entity_ref(), *universe);
     ASSERT_EQ(universe_any_value.get_const_entity_ref(), *universe);
@@ -517,8 +517,8 @@ TEST(any_value_must_be_initialized_appropriately, ecosystem)
             ecosystem_struct);
 
     const auto ecosystem_any_value = yli::data::AnyValue(*ecosystem);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Ecosystem>>(ecosystem_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Ecosystem>>(ecosystem_any_value.data).get(), *ecosystem);
+    ASSERT_TRUE(ecosystem_any_value.holds<yli::ontology::Ecosystem>());
+    ASSERT_EQ(ecosystem_any_value.get<yli::ontology::Ecosystem>(), *ecosystem);
     ASSERT_EQ(std::strcmp(ecosystem_any_value.get_datatype().c_str(), "yli::ontology::Ecosystem&"), 0);
     ASSERT_EQ(ecosystem_any_value.get_entity_ref(), *ecosystem);
     ASSERT_EQ(ecosystem_any_value.get_const_entity_ref(), *ecosystem);
@@ -532,8 +532,8 @@ TEST(any_value_must_be_initialized_appropriately, scene)
             scene_struct);
 
     const auto scene_any_value = yli::data::AnyValue(*scene);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Scene>>(scene_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Scene>>(scene_any_value.data).get(), *scene);
+    ASSERT_TRUE(scene_any_value.holds<yli::ontology::Scene>());
+    ASSERT_EQ(scene_any_value.get<yli::ontology::Scene>(), *scene);
     ASSERT_EQ(std::strcmp(scene_any_value.get_datatype().c_str(), "yli::ontology::Scene&"), 0);
     ASSERT_EQ(scene_any_value.get_entity_ref(), *scene);
     ASSERT_EQ(scene_any_value.get_const_entity_ref(), *scene);
@@ -551,8 +551,8 @@ TEST(any_value_must_be_initialized_appropriately, pipeline)
             pipeline_struct);
 
     const auto pipeline_any_value = yli::data::AnyValue(*pipeline);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Pipeline>>(pipeline_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Pipeline>>(pipeline_any_value.data).get(), *pipeline);
+    ASSERT_TRUE(pipeline_any_value.holds<yli::ontology::Pipeline>());
+    ASSERT_EQ(pipeline_any_value.get<yli::ontology::Pipeline>(), *pipeline);
     ASSERT_EQ(std::strcmp(pipeline_any_value.get_datatype().c_str(), "yli::ontology::Pipeline&"), 0);
     ASSERT_EQ(pipeline_any_value.get_entity_ref(), *pipeline);
     ASSERT_EQ(pipeline_any_value.get_const_entity_ref(), *pipeline);
@@ -573,8 +573,8 @@ TEST(any_value_must_be_initialized_appropriately, material)
             material_struct);
 
     const auto material_any_value = yli::data::AnyValue(*material);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Material>>(material_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Material>>(material_any_value.data).get(), *material);
+    ASSERT_TRUE(material_any_value.holds<yli::ontology::Material>());
+    ASSERT_EQ(material_any_value.get<yli::ontology::Material>(), *material);
     ASSERT_EQ(std::strcmp(material_any_value.get_datatype().c_str(), "yli::ontology::Material&"), 0);
     ASSERT_EQ(material_any_value.get_entity_ref(), *material);
     ASSERT_EQ(material_any_value.get_const_entity_ref(), *material);
@@ -590,8 +590,8 @@ TEST(any_value_must_be_initialized_appropriately, species)
             species_struct);
 
     const auto species_any_value = yli::data::AnyValue(*species);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Species>>(species_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Species>>(species_any_value.data).get(), *species);
+    ASSERT_TRUE(species_any_value.holds<yli::ontology::Species>());
+    ASSERT_EQ(species_any_value.get<yli::ontology::Species>(), *species);
     ASSERT_EQ(std::strcmp(species_any_value.get_datatype().c_str(), "yli::ontology::Species&"), 0);
     ASSERT_EQ(species_any_value.get_entity_ref(), *species);
     ASSERT_EQ(species_any_value.get_const_entity_ref(), *species);
@@ -605,8 +605,8 @@ TEST(any_value_must_be_initialized_appropriately, object)
             object_struct);
 
     const auto object_any_value = yli::data::AnyValue(*object);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Object>>(object_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Object>>(object_any_value.data).get(), *object);
+    ASSERT_TRUE(object_any_value.holds<yli::ontology::Object>());
+    ASSERT_EQ(object_any_value.get<yli::ontology::Object>(), *object);
     ASSERT_EQ(std::strcmp(object_any_value.get_datatype().c_str(), "yli::ontology::Object&"), 0);
     ASSERT_EQ(object_any_value.get_entity_ref(), *object);
     ASSERT_EQ(object_any_value.get_const_entity_ref(), *object);
@@ -626,8 +626,8 @@ TEST(any_value_must_be_initialized_appropriately, symbiosis)
             symbiosis_struct);
 
     auto symbiosis_any_value = yli::data::AnyValue(*symbiosis);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Symbiosis>>(symbiosis_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Symbiosis>>(symbiosis_any_value.data).get(), *symbiosis);
+    ASSERT_TRUE(symbiosis_any_value.holds<yli::ontology::Symbiosis>());
+    ASSERT_EQ(symbiosis_any_value.get<yli::ontology::Symbiosis>(), *symbiosis);
     ASSERT_EQ(std::strcmp(symbiosis_any_value.get_datatype().c_str(), "yli::ontology::Symbiosis&"), 0);
     ASSERT_EQ(symbiosis_any_value.get_entity_ref(), *symbiosis);
     ASSERT_EQ(symbiosis_any_value.get_const_entity_ref(), *symbiosis);
@@ -653,8 +653,8 @@ TEST(any_value_must_be_initialized_appropriately, holobiont)
             holobiont_struct);
 
     const auto holobiont_any_value = yli::data::AnyValue(*holobiont);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Holobiont>>(holobiont_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Holobiont>>(holobiont_any_value.data).get(), *holobiont);
+    ASSERT_TRUE(holobiont_any_value.holds<yli::ontology::Holobiont>());
+    ASSERT_EQ(holobiont_any_value.get<yli::ontology::Holobiont>(), *holobiont);
     ASSERT_EQ(std::strcmp(holobiont_any_value.get_datatype().c_str(), "yli::ontology::Holobiont&"), 0);
     ASSERT_EQ(holobiont_any_value.get_entity_ref(), *holobiont);
     ASSERT_EQ(holobiont_any_value.get_const_entity_ref(), *holobiont);
@@ -668,8 +668,8 @@ TEST(any_value_must_be_initialized_appropriately, font_2d)
             font_struct);
 
     const auto font_2d_any_value = yli::data::AnyValue(*font_2d);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Font2d>>(font_2d_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Font2d>>(font_2d_any_value.data).get(), *font_2d);
+    ASSERT_TRUE(font_2d_any_value.holds<yli::ontology::Font2d>());
+    ASSERT_EQ(font_2d_any_value.get<yli::ontology::Font2d>(), *font_2d);
     ASSERT_EQ(std::strcmp(font_2d_any_value.get_datatype().c_str(), "yli::ontology::Font2d&"), 0);
     ASSERT_EQ(font_2d_any_value.get_entity_ref(), *font_2d);
     ASSERT_EQ(font_2d_any_value.get_const_entity_ref(), *font_2d);
@@ -683,8 +683,8 @@ TEST(any_value_must_be_initialized_appropriately, text_2d)
             text_struct);
 
     const auto text_2d_any_value = yli::data::AnyValue(*text_2d);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Text2d>>(text_2d_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Text2d>>(text_2d_any_value.data).get(), *text_2d);
+    ASSERT_TRUE(text_2d_any_value.holds<yli::ontology::Text2d>());
+    ASSERT_EQ(text_2d_any_value.get<yli::ontology::Text2d>(), *text_2d);
     ASSERT_EQ(std::strcmp(text_2d_any_value.get_datatype().c_str(), "yli::ontology::Text2d&"), 0);
     ASSERT_EQ(text_2d_any_value.get_entity_ref(), *text_2d);
     ASSERT_EQ(text_2d_any_value.get_const_entity_ref(), *text_2d);
@@ -698,8 +698,8 @@ TEST(any_value_must_be_initialized_appropriately, vector_font)
             vector_font_struct);
 
     const auto vector_font_any_value = yli::data::AnyValue(*vector_font);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::VectorFont>>(vector_font_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::VectorFont>>(vector_font_any_value.data).get(), *vector_font);
+    ASSERT_TRUE(vector_font_any_value.holds<yli::ontology::VectorFont>());
+    ASSERT_EQ(vector_font_any_value.get<yli::ontology::VectorFont>(), *vector_font);
     ASSERT_EQ(std::strcmp(vector_font_any_value.get_datatype().c_str(), "yli::ontology::VectorFont&"), 0);
     ASSERT_EQ(vector_font_any_value.get_entity_ref(), *vector_font);
     ASSERT_EQ(vector_font_any_value.get_const_entity_ref(), *vector_font);
@@ -723,8 +723,8 @@ TEST(any_value_must_be_initialized_appropriately, text_3d)
             text_3d_struct);
 
     const auto text_3d_any_value = yli::data::AnyValue(*text_3d);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Text3d>>(text_3d_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Text3d>>(text_3d_any_value.data).get(), *text_3d);
+    ASSERT_TRUE(text_3d_any_value.holds<yli::ontology::Text3d>());
+    ASSERT_EQ(text_3d_any_value.get<yli::ontology::Text3d>(), *text_3d);
     ASSERT_EQ(std::strcmp(text_3d_any_value.get_datatype().c_str(), "yli::ontology::Text3d&"), 0);
     ASSERT_EQ(text_3d_any_value.get_entity_ref(), *text_3d);
     ASSERT_EQ(text_3d_any_value.get_const_entity_ref(), *text_3d);
@@ -738,8 +738,8 @@ TEST(any_value_must_be_initialized_appropriately, console)
             console_struct);
 
     const auto console_any_value = yli::data::AnyValue(*console);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::Console>>(console_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::Console>>(console_any_value.data).get(), *console);
+    ASSERT_TRUE(console_any_value.holds<yli::ontology::Console>());
+    ASSERT_EQ(console_any_value.get<yli::ontology::Console>(), *console);
     ASSERT_EQ(std::strcmp(console_any_value.get_datatype().c_str(), "yli::ontology::Console&"), 0);
     ASSERT_EQ(console_any_value.get_entity_ref(), *console);
     ASSERT_EQ(console_any_value.get_const_entity_ref(), *console);
@@ -761,8 +761,8 @@ TEST(any_value_must_be_initialized_appropriately, compute_task)
             compute_task_struct);
 
     const auto compute_task_any_value = yli::data::AnyValue(*compute_task);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<yli::ontology::ComputeTask>>(compute_task_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<yli::ontology::ComputeTask>>(compute_task_any_value.data).get(), *compute_task);
+    ASSERT_TRUE(compute_task_any_value.holds<yli::ontology::ComputeTask>());
+    ASSERT_EQ(compute_task_any_value.get<yli::ontology::ComputeTask>(), *compute_task);
     ASSERT_EQ(std::strcmp(compute_task_any_value.get_datatype().c_str(), "yli::ontology::ComputeTask&"), 0);
     ASSERT_EQ(compute_task_any_value.get_entity_ref(), *compute_task);
     ASSERT_EQ(compute_task_any_value.get_const_entity_ref(), *compute_task);
@@ -771,124 +771,179 @@ TEST(any_value_must_be_initialized_appropriately, compute_task)
 TEST(any_value_must_be_initialized_appropriately, std_string)
 {
     std::string foo_string = "foo";
-    auto std_string_ref_any_value = yli::data::AnyValue(foo_string);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<std::string>>(std_string_ref_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<std::string>>(std_string_ref_any_value.data).get(), foo_string);
-    ASSERT_EQ(std::strcmp(std_string_ref_any_value.get_datatype().c_str(), "std::string&"), 0);
-    ASSERT_EQ(std::strcmp(std_string_ref_any_value.get_string().c_str(), "foo"), 0);
+    const auto std_string_any_value = yli::data::AnyValue(foo_string);
+    foo_string = "bar";
+    ASSERT_TRUE(std_string_any_value.holds<std::string>());
+    ASSERT_EQ(std_string_any_value.get<std::string>(), "foo");
+    ASSERT_EQ(std::strcmp(std_string_any_value.get_datatype().c_str(), "std::string"), 0);
+    ASSERT_EQ(std::strcmp(std_string_any_value.get_string().c_str(), "foo"), 0);
 }
 
 TEST(any_value_must_be_initialized_appropriately, const_std_string)
 {
     const std::string foo_string = "foo";
-    auto const_std_string_ref_any_value = yli::data::AnyValue(foo_string);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<const std::string>>(const_std_string_ref_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<const std::string>>(const_std_string_ref_any_value.data).get(), foo_string);
-    ASSERT_EQ(std::strcmp(const_std_string_ref_any_value.get_datatype().c_str(), "const std::string&"), 0);
-    ASSERT_EQ(std::strcmp(const_std_string_ref_any_value.get_string().c_str(), "foo"), 0);
+    const auto std_string_any_value = yli::data::AnyValue(foo_string);
+    ASSERT_TRUE(std_string_any_value.holds<std::string>());
+    ASSERT_EQ(std_string_any_value.get<std::string>(), foo_string);
+    ASSERT_EQ(std::strcmp(std_string_any_value.get_datatype().c_str(), "std::string"), 0);
+}
+
+TEST(any_value_must_be_initialized_appropriately, std_string_longer_than_small_string_capacity)
+{
+    const std::string long_string(yli::data::AnyValue::small_string_capacity + 1, 'a');
+    const auto std_string_any_value = yli::data::AnyValue(long_string);
+    ASSERT_TRUE(std_string_any_value.holds<std::string>());
+    ASSERT_EQ(std_string_any_value.get<std::string>(), long_string);
+    ASSERT_EQ(std_string_any_value.get_string(), long_string);
+}
+
+TEST(any_value_must_be_initialized_appropriately, std_string_from_type_and_value_string)
+{
+    const auto std_string_any_value = yli::data::AnyValue("std::string", "foo");
+    ASSERT_TRUE(std_string_any_value.holds<std::string>());
+    ASSERT_EQ(std_string_any_value.get<std::string>(), "foo");
 }
 
 TEST(any_value_must_be_initialized_appropriately, std_vector_int8_t)
 {
-    std::vector<std::int8_t> std_vector_int8_t;
+    std::vector<std::int8_t> std_vector_int8_t { 1, 2, 3 };
     const auto std_vector_int8_t_any_value = yli::data::AnyValue(std_vector_int8_t);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<std::vector<std::int8_t>>>(std_vector_int8_t_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<std::vector<std::int8_t>>>(std_vector_int8_t_any_value.data).get(), std_vector_int8_t);
-    ASSERT_EQ(std::strcmp(std_vector_int8_t_any_value.get_datatype().c_str(), "std::vector<std::int8_t>&"), 0);
+    std_vector_int8_t.clear();
+    ASSERT_TRUE(std_vector_int8_t_any_value.holds<std::vector<std::int8_t>>());
+    ASSERT_EQ(std_vector_int8_t_any_value.get<std::vector<std::int8_t>>(), std::vector<std::int8_t>({ 1, 2, 3 }));
+    ASSERT_EQ(std::strcmp(std_vector_int8_t_any_value.get_datatype().c_str(), "std::vector<std::int8_t>"), 0);
 }
 
 TEST(any_value_must_be_initialized_appropriately, std_vector_uint8_t)
 {
-    std::vector<std::uint8_t> std_vector_uint8_t;
+    std::vector<std::uint8_t> std_vector_uint8_t { 1, 2, 3 };
     const auto std_vector_uint8_t_any_value = yli::data::AnyValue(std_vector_uint8_t);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<std::vector<std::uint8_t>>>(std_vector_uint8_t_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<std::vector<std::uint8_t>>>(std_vector_uint8_t_any_value.data).get(), std_vector_uint8_t);
-    ASSERT_EQ(std::strcmp(std_vector_uint8_t_any_value.get_datatype().c_str(), "std::vector<std::uint8_t>&"), 0);
+    std_vector_uint8_t.clear();
+    ASSERT_TRUE(std_vector_uint8_t_any_value.holds<std::vector<std::uint8_t>>());
+    ASSERT_EQ(std_vector_uint8_t_any_value.get<std::vector<std::uint8_t>>(), std::vector<std::uint8_t>({ 1, 2, 3 }));
+    ASSERT_EQ(std::strcmp(std_vector_uint8_t_any_value.get_datatype().c_str(), "std::vector<std::uint8_t>"), 0);
 }
 
 TEST(any_value_must_be_initialized_appropriately, std_vector_int16_t)
 {
-    std::vector<std::int16_t> std_vector_int16_t;
+    std::vector<std::int16_t> std_vector_int16_t { 1, 2, 3 };
     const auto std_vector_int16_t_any_value = yli::data::AnyValue(std_vector_int16_t);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<std::vector<std::int16_t>>>(std_vector_int16_t_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<std::vector<std::int16_t>>>(std_vector_int16_t_any_value.data).get(), std_vector_int16_t);
-    ASSERT_EQ(std::strcmp(std_vector_int16_t_any_value.get_datatype().c_str(), "std::vector<std::int16_t>&"), 0);
+    std_vector_int16_t.clear();
+    ASSERT_TRUE(std_vector_int16_t_any_value.holds<std::vector<std::int16_t>>());
+    ASSERT_EQ(std_vector_int16_t_any_value.get<std::vector<std::int16_t>>(), std::vector<std::int16_t>({ 1, 2, 3 }));
+    ASSERT_EQ(std::strcmp(std_vector_int16_t_any_value.get_datatype().c_str(), "std::vector<std::int16_t>"), 0);
 }
 
 TEST(any_value_must_be_initialized_appropriately, std_vector_uint16_t)
 {
-    std::vector<std::uint16_t> std_vector_uint16_t;
+    std::vector<std::uint16_t> std_vector_uint16_t { 1, 2, 3 };
     const auto std_vector_uint16_t_any_value = yli::data::AnyValue(std_vector_uint16_t);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<std::vector<std::uint16_t>>>(std_vector_uint16_t_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<std::vector<std::uint16_t>>>(std_vector_uint16_t_any_value.data).get(), std_vector_uint16_t);
-    ASSERT_EQ(std::strcmp(std_vector_uint16_t_any_value.get_datatype().c_str(), "std::vector<std::uint16_t>&"), 0);
+    std_vector_uint16_t.clear();
+    ASSERT_TRUE(std_vector_uint16_t_any_value.holds<std::vector<std::uint16_t>>());
+    ASSERT_EQ(std_vector_uint16_t_any_value.get<std::vector<std::uint16_t>>(), std::vector<std::uint16_t>({ 1, 2, 3 }));
+    ASSERT_EQ(std::strcmp(std_vector_uint16_t_any_value.get_datatype().c_str(), "std::vector<std::uint16_t>"), 0);
 }
 
 TEST(any_value_must_be_initialized_appropriately, std_vector_int32_t)
 {
-    std::vector<std::int32_t> std_vector_int32_t;
+    std::vector<std::int32_t> std_vector_int32_t { 1, 2, 3 };
     const auto std_vector_int32_t_any_value = yli::data::AnyValue(std_vector_int32_t);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<std::vector<std::int32_t>>>(std_vector_int32_t_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<std::vector<std::int32_t>>>(std_vector_int32_t_any_value.data).get(), std_vector_int32_t);
-    ASSERT_EQ(std::strcmp(std_vector_int32_t_any_value.get_datatype().c_str(), "std::vector<std::int32_t>&"), 0);
+    std_vector_int32_t.clear();
+    ASSERT_TRUE(std_vector_int32_t_any_value.holds<std::vector<std::int32_t>>());
+    ASSERT_EQ(std_vector_int32_t_any_value.get<std::vector<std::int32_t>>(), std::vector<std::int32_t>({ 1, 2, 3 }));
+    ASSERT_EQ(std::strcmp(std_vector_int32_t_any_value.get_datatype().c_str(), "std::vector<std::int32_t>"), 0);
 }
 
 TEST(any_value_must_be_initialized_appropriately, std_vector_uint32_t)
 {
-    std::vector<std::uint32_t> std_vector_uint32_t;
+    std::vector<std::uint32_t> std_vector_uint32_t { 1, 2, 3 };
     const auto std_vector_uint32_t_any_value = yli::data::AnyValue(std_vector_uint32_t);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<std::vector<std::uint32_t>>>(std_vector_uint32_t_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<std::vector<std::uint32_t>>>(std_vector_uint32_t_any_value.data).get(), std_vector_uint32_t);
-    ASSERT_EQ(std::strcmp(std_vector_uint32_t_any_value.get_datatype().c_str(), "std::vector<std::uint32_t>&"), 0);
+    std_vector_uint32_t.clear();
+    ASSERT_TRUE(std_vector_uint32_t_any_value.holds<std::vector<std::uint32_t>>());
+    ASSERT_EQ(std_vector_uint32_t_any_value.get<std::vector<std::uint32_t>>(), std::vector<std::uint32_t>({ 1, 2, 3 }));
+    ASSERT_EQ(std::strcmp(std_vector_uint32_t_any_value.get_datatype().c_str(), "std::vector<std::uint32_t>"), 0);
+}
+
+TEST(any_value_must_be_initialized_appropriately, std_vector_int64_t)
+{
+    std::vector<std::int64_t> std_vector_int64_t { 1, 2, 3 };
+    const auto std_vector_int64_t_any_value = yli::data::AnyValue(std_vector_int64_t);
+    std_vector_int64_t.clear();
+    ASSERT_TRUE(std_vector_int64_t_any_value.holds<std::vector<std::int64_t>>());
+    ASSERT_EQ(std_vector_int64_t_any_value.get<std::vector<std::int64_t>>(), std::vector<std::int64_t>({ 1, 2, 3 }));
+    ASSERT_EQ(std::strcmp(std_vector_int64_t_any_value.get_datatype().c_str(), "std::vector<std::int64_t>"), 0);
+}
+
+TEST(any_value_must_be_initialized_appropriately, std_vector_uint64_t)
+{
+    std::vector<std::uint64_t> std_vector_uint64_t { 1, 2, 3 };
+    const auto std_vector_uint64_t_any_value = yli::data::AnyValue(std_vector_uint64_t);
+    std_vector_uint64_t.clear();
+    ASSERT_TRUE(std_vector_uint64_t_any_value.holds<std::vector<std::uint64_t>>());
+    ASSERT_EQ(std_vector_uint64_t_any_value.get<std::vector<std::uint64_t>>(), std::vector<std::uint64_t>({ 1, 2, 3 }));
+    ASSERT_EQ(std::strcmp(std_vector_uint64_t_any_value.get_datatype().c_str(), "std::vector<std::uint64_t>"), 0);
 }
 
 TEST(any_value_must_be_initialized_appropriately, std_vector_float)
 {
-    std::vector<float> std_vector_float;
+    std::vector<float> std_vector_float { 1.0f, 2.0f, 3.0f };
     const auto std_vector_float_any_value = yli::data::AnyValue(std_vector_float);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<std::vector<float>>>(std_vector_float_any_value.data));
-    ASSERT_EQ(std::get<std::reference_wrapper<std::vector<float>>>(std_vector_float_any_value.data).get(), std_vector_float);
-    ASSERT_EQ(std::strcmp(std_vector_float_any_value.get_datatype().c_str(), "std::vector<float>&"), 0);
+    std_vector_float.clear();
+    ASSERT_TRUE(std_vector_float_any_value.holds<std::vector<float>>());
+    ASSERT_EQ(std_vector_float_any_value.get<std::vector<float>>(), std::vector<float>({ 1.0f, 2.0f, 3.0f }));
+    ASSERT_EQ(std::strcmp(std_vector_float_any_value.get_datatype().c_str(), "std::vector<float>"), 0);
 }
 
 TEST(any_value_must_be_initialized_appropriately, glm_vec3)
 {
     glm::vec3 glm_vec3(1.0f, 2.0f, 3.0f);
     const auto glm_vec3_any_value = yli::data::AnyValue(glm_vec3);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<glm::vec3>>(glm_vec3_any_value.data));
-    ASSERT_EQ(&std::get<std::reference_wrapper<glm::vec3>>(glm_vec3_any_value.data).get(), &glm_vec3);
-    ASSERT_EQ(std::strcmp(glm_vec3_any_value.get_datatype().c_str(), "glm::vec3&"), 0);
-    // TODO: add assertions for `AnyValue::get_string` for `glm::vec3*`!
-}
-
-TEST(any_value_must_be_initialized_appropriately, const_glm_vec3)
-{
-    const glm::vec3 const_glm_vec3(1.0f, 2.0f, 3.0f);
-    const auto const_glm_vec3_any_value = yli::data::AnyValue(const_glm_vec3);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<const glm::vec3>>(const_glm_vec3_any_value.data));
-    ASSERT_EQ(&std::get<std::reference_wrapper<const glm::vec3>>(const_glm_vec3_any_value.data).get(), &const_glm_vec3);
-    ASSERT_EQ(std::strcmp(const_glm_vec3_any_value.get_datatype().c_str(), "const glm::vec3&"), 0);
-    // TODO: add assertions for `AnyValue::get_string` for `glm::vec3*`!
+    glm_vec3.x = 5.0f;
+    ASSERT_TRUE(glm_vec3_any_value.holds<glm::vec3>());
+    ASSERT_EQ(glm_vec3_any_value.get<glm::vec3>(), glm::vec3(1.0f, 2.0f, 3.0f));
+    ASSERT_EQ(std::strcmp(glm_vec3_any_value.get_datatype().c_str(), "glm::vec3"), 0);
+    ASSERT_EQ(glm_vec3_any_value.get_string(), "{ 1.000000, 2.000000, 3.000000 }");
 }
 
 TEST(any_value_must_be_initialized_appropriately, glm_vec4)
 {
     glm::vec4 glm_vec4(1.0f, 2.0f, 3.0f, 4.0f);
     const auto glm_vec4_any_value = yli::data::AnyValue(glm_vec4);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<glm::vec4>>(glm_vec4_any_value.data));
-    ASSERT_EQ(&std::get<std::reference_wrapper<glm::vec4>>(glm_vec4_any_value.data).get(), &glm_vec4);
-    ASSERT_EQ(std::strcmp(glm_vec4_any_value.get_datatype().c_str(), "glm::vec4&"), 0);
-    // TODO: add assertions for `AnyValue::get_string` for `glm::vec4*`!
+    glm_vec4.x = 5.0f;
+    ASSERT_TRUE(glm_vec4_any_value.holds<glm::vec4>());
+    ASSERT_EQ(glm_vec4_any_value.get<glm::vec4>(), glm::vec4(1.0f, 2.0f, 3.0f, 4.0f));
+    ASSERT_EQ(std::strcmp(glm_vec4_any_value.get_datatype().c_str(), "glm::vec4"), 0);
+    ASSERT_EQ(glm_vec4_any_value.get_string(), "{ 1.000000, 2.000000, 3.000000, 4.000000 }");
+}
+
+TEST(any_value_must_be_copied_appropriately, std_string_longer_than_small_string_capacity)
+{
+    const std::string long_string(yli::data::AnyValue::small_string_capacity + 1, 'a');
+    auto any_value = yli::data::AnyValue(long_string);
+    const yli::data::AnyValue copy = any_value;
+    ASSERT_TRUE(any_value.set_new_value("b"));
+    ASSERT_EQ(any_value.get<std::string>(), "b");
+    ASSERT_EQ(copy.get<std::string>(), long_string);
+    ASSERT_NE(copy, any_value);
+}
+
+TEST(any_value_must_be_copied_appropriately, std_vector_float)
+{
+    auto any_value = yli::data::AnyValue(std::vector<float> { 1.0f, 2.0f, 3.0f });
+    yli::data::AnyValue copy;
+    copy = any_value;
+    ASSERT_EQ(copy, any_value);
+    any_value = yli::data::AnyValue(1.0f);
+    ASSERT_TRUE(copy.holds<std::vector<float>>());
+    ASSERT_EQ(copy.get<std::vector<float>>(), std::vector<float>({ 1.0f, 2.0f, 3.0f }));
 }
 
-TEST(any_value_must_be_initialized_appropriately, const_glm_vec4)
+TEST(any_value_must_be_moved_appropriately, std_vector_float)
 {
-    const glm::vec4 const_glm_vec4(1.0f, 2.0f, 3.0f, 4.0f);
-    const auto const_glm_vec4_any_value = yli::data::AnyValue(const_glm_vec4);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<const glm::vec4>>(const_glm_vec4_any_value.data));
-    ASSERT_EQ(&std::get<std::reference_wrapper<const glm::vec4>>(const_glm_vec4_any_value.data).get(), &const_glm_vec4);
-    ASSERT_EQ(std::strcmp(const_glm_vec4_any_value.get_datatype().c_str(), "const glm::vec4&"), 0);
-    // TODO: add assertions for `AnyValue::get_string` for `glm::vec4*`!
+    auto any_value = yli::data::AnyValue(std::vector<float> { 1.0f, 2.0f, 3.0f });
+    const yli::data::AnyValue moved_to = std::move(any_value);
+    ASSERT_TRUE(moved_to.holds<std::vector<float>>());
+    ASSERT_EQ(moved_to.get<std::vector<float>>(), std::vector<float>({ 1.0f, 2.0f, 3.0f }));
 }
 
 TEST(set_new_value_must_function_properly, originally_bool_true_new_value_bool_true)
@@ -896,8 +951,8 @@ TEST(set_new_value_must_function_properly, originally_bool_true_new_value_bool_t
     constexpr bool bool_true = true;
     auto any_value = yli::data::AnyValue(bool_true);
     ASSERT_TRUE(any_value.set_new_value("true"));
-    ASSERT_TRUE(std::holds_alternative<bool>(any_value.data));
-    ASSERT_TRUE(std::get<bool>(any_value.data));
+    ASSERT_TRUE(any_value.holds<bool>());
+    ASSERT_TRUE(any_value.get<bool>());
 }
 
 TEST(set_new_value_must_function_properly, originally_bool_true_new_value_bool_false)
@@ -905,8 +960,8 @@ TEST(set_new_value_must_function_properly, originally_bool_true_new_value_bool_f
     constexpr bool bool_true = true;
     auto any_value = yli::data::AnyValue(bool_true);
     ASSERT_TRUE(any_value.set_new_value("false"));
-    ASSERT_TRUE(std::holds_alternative<bool>(any_value.data));
-    ASSERT_FALSE(std::get<bool>(any_value.data));
+    ASSERT_TRUE(any_value.holds<bool>());
+    ASSERT_FALSE(any_value.get<bool>());
 }
 
 TEST(set_new_value_must_function_properly, originally_bool_true_new_value_foo)
@@ -914,8 +969,8 @@ TEST(set_new_value_must_function_properly, originally_bool_true_new_value_foo)
     constexpr bool bool_true = true;
     auto any_value = yli::data::AnyValue(bool_true);
     ASSERT_FALSE(any_value.set_new_value("foo")); // `"foo"` is invalid value and should not change the current value.
-    ASSERT_TRUE(std::holds_alternative<bool>(any_value.data));
-    ASSERT_TRUE(std::get<bool>(any_value.data));
+    ASSERT_TRUE(any_value.holds<bool>());
+    ASSERT_TRUE(any_value.get<bool>());
 }
 
 TEST(set_new_value_must_function_properly, originally_bool_false_new_value_bool_true)
@@ -923,8 +978,8 @@ TEST(set_new_value_must_function_properly, originally_bool_false_new_value_bool_
     constexpr bool bool_false = false;
     auto any_value = yli::data::AnyValue(bool_false);
     ASSERT_TRUE(any_value.set_new_value("true"));
-    ASSERT_TRUE(std::holds_alternative<bool>(any_value.data));
-    ASSERT_TRUE(std::get<bool>(any_value.data));
+    ASSERT_TRUE(any_value.holds<bool>());
+    ASSERT_TRUE(any_value.get<bool>());
 }
 
 TEST(set_new_value_must_function_properly, originally_bool_false_new_value_bool_false)
@@ -932,8 +987,8 @@ TEST(set_new_value_must_function_properly, originally_bool_false_new_value_bool_
     constexpr bool bool_false = false;
     auto any_value = yli::data::AnyValue(bool_false);
     ASSERT_TRUE(any_value.set_new_value("false"));
-    ASSERT_TRUE(std::holds_alternative<bool>(any_value.data));
-    ASSERT_FALSE(std::get<bool>(any_value.data));
+    ASSERT_TRUE(any_value.holds<bool>());
+    ASSERT_FALSE(any_value.get<bool>());
 }
 
 TEST(set_new_value_must_function_properly, originally_bool_false_new_value_foo)
@@ -941,8 +996,8 @@ TEST(set_new_value_must_function_properly, originally_bool_false_new_value_foo)
     constexpr bool bool_false = false;
     auto any_value = yli::data::AnyValue(bool_false);
     ASSERT_FALSE(any_value.set_new_value("foo")); // `"foo"` is invalid value and should not change the current value.
-    ASSERT_TRUE(std::holds_alternative<bool>(any_value.data));
-    ASSERT_FALSE(std::get<bool>(any_value.data));
+    ASSERT_TRUE(any_value.holds<bool>());
+    ASSERT_FALSE(any_value.get<bool>());
 }
 
 TEST(set_new_value_must_function_properly, originally_char_lowercase_a_new_value_a)
@@ -950,8 +1005,8 @@ TEST(set_new_value_must_function_properly, originally_char_lowercase_a_new_value
     constexpr char char_lowercase_a = 'a';
     auto any_value = yli::data::AnyValue(char_lowercase_a);
     ASSERT_TRUE(any_value.set_new_value("a"));
-    ASSERT_TRUE(std::holds_alternative<char>(any_value.data));
-    ASSERT_EQ(std::get<char>(any_value.data), 'a');
+    ASSERT_TRUE(any_value.holds<char>());
+    ASSERT_EQ(any_value.get<char>(), 'a');
 }
 
 TEST(set_new_value_must_function_properly, originally_char_lowercase_a_new_value_b)
@@ -959,8 +1014,8 @@ TEST(set_new_value_must_function_properly, originally_char_lowercase_a_new_value
     constexpr char char_lowercase_a = 'a';
     auto any_value = yli::data::AnyValue(char_lowercase_a);
     ASSERT_TRUE(any_value.set_new_value("b"));
-    ASSERT_TRUE(std::holds_alternative<char>(any_value.data));
-    ASSERT_EQ(std::get<char>(any_value.data), 'b');
+    ASSERT_TRUE(any_value.holds<char>());
+    ASSERT_EQ(any_value.get<char>(), 'b');
 }
 
 TEST(set_new_value_must_function_properly, originally_char_lowercase_a_new_value_bb)
@@ -968,8 +1023,8 @@ TEST(set_new_value_must_function_properly, originally_char_lowercase_a_new_value
     constexpr char char_lowercase_a = 'a';
     auto any_value = yli::data::AnyValue(char_lowercase_a);
     ASSERT_FALSE(any_value.set_new_value("bb")); // `"bb"` is invalid value and should not change the current value.
-    ASSERT_TRUE(std::holds_alternative<char>(any_value.data));
-    ASSERT_EQ(std::get<char>(any_value.data), 'a');
+    ASSERT_TRUE(any_value.holds<char>());
+    ASSERT_EQ(any_value.get<char>(), 'a');
 }
 
 TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_0)
@@ -977,8 +1032,8 @@ TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_0)
     constexpr float float_zero = 0.0f;
     auto any_value = yli::data::AnyValue(float_zero);
     ASSERT_TRUE(any_value.set_new_value("0"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 0.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 0.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_0_dot_0)
@@ -986,8 +1041,8 @@ TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_0_
     constexpr float float_zero = 0.0f;
     auto any_value = yli::data::AnyValue(float_zero);
     ASSERT_TRUE(any_value.set_new_value("0.0"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 0.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 0.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_plus_1)
@@ -995,8 +1050,8 @@ TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_pl
     constexpr float float_zero = 0.0f;
     auto any_value = yli::data::AnyValue(float_zero);
     ASSERT_TRUE(any_value.set_new_value("1"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 1.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 1.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_plus_1_dot_0)
@@ -1004,8 +1059,8 @@ TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_pl
     constexpr float float_zero = 0.0f;
     auto any_value = yli::data::AnyValue(float_zero);
     ASSERT_TRUE(any_value.set_new_value("1.0"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 1.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 1.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_minus_1_dot_0)
@@ -1013,8 +1068,8 @@ TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_mi
     constexpr float float_zero = 0.0f;
     auto any_value = yli::data::AnyValue(float_zero);
     ASSERT_TRUE(any_value.set_new_value("-1.0"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), -1.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), -1.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_plus_1234)
@@ -1022,8 +1077,8 @@ TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_pl
     constexpr float float_zero = 0.0f;
     auto any_value = yli::data::AnyValue(float_zero);
     ASSERT_TRUE(any_value.set_new_value("1234"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 1234.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 1234.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_plus_1234_dot_0)
@@ -1031,8 +1086,8 @@ TEST(set_new_value_must_function_properly, originally_float_0_new_value_float_pl
     constexpr float float_zero = 0.0f;
     auto any_value = yli::data::AnyValue(float_zero);
     ASSERT_TRUE(any_value.set_new_value("1234.0"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 1234.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 1234.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_float_0)
@@ -1040,8 +1095,8 @@ TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_flo
     constexpr float float_plus_1 = 1.0f;
     auto any_value = yli::data::AnyValue(float_plus_1);
     ASSERT_TRUE(any_value.set_new_value("0"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 0.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 0.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_float_0_dot_0)
@@ -1049,8 +1104,8 @@ TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_flo
     constexpr float float_plus_1 = 1.0f;
     auto any_value = yli::data::AnyValue(float_plus_1);
     ASSERT_TRUE(any_value.set_new_value("0.0"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 0.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 0.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_float_plus_1)
@@ -1058,8 +1113,8 @@ TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_flo
     constexpr float float_plus_1 = 1.0f;
     auto any_value = yli::data::AnyValue(float_plus_1);
     ASSERT_TRUE(any_value.set_new_value("1"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 1.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 1.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_float_plus_1_dot_0)
@@ -1067,8 +1122,8 @@ TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_flo
     constexpr float float_plus_1 = 1.0f;
     auto any_value = yli::data::AnyValue(float_plus_1);
     ASSERT_TRUE(any_value.set_new_value("1.0"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 1.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 1.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_float_minus_1_dot_0)
@@ -1076,8 +1131,8 @@ TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_flo
     constexpr float float_plus_1 = 1.0f;
     auto any_value = yli::data::AnyValue(float_plus_1);
     ASSERT_TRUE(any_value.set_new_value("-1.0"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), -1.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), -1.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_float_plus_1234)
@@ -1085,8 +1140,8 @@ TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_flo
     constexpr float float_plus_1 = 1.0f;
     auto any_value = yli::data::AnyValue(float_plus_1);
     ASSERT_TRUE(any_value.set_new_value("1234"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 1234.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 1234.0f);
 }
 
 TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_float_plus_1234_dot_0)
@@ -1094,6 +1149,33 @@ TEST(set_new_value_must_function_properly, originally_float_plus_1_new_value_flo
     constexpr float float_plus_1 = 1.0f;
     auto any_value = yli::data::AnyValue(float_plus_1);
     ASSERT_TRUE(any_value.set_new_value("1234.0"));
-    ASSERT_TRUE(std::holds_alternative<float>(any_value.data));
-    ASSERT_EQ(std::get<float>(any_value.data), 1234.0f);
+    ASSERT_TRUE(any_value.holds<float>());
+    ASSERT_EQ(any_value.get<float>(), 1234.0f);
+}
+
+TEST(set_new_value_must_function_properly, originally_int32_t_0_new_value_out_of_range)
+{
+    constexpr std::int32_t int32_t_zero = 0;
+    auto any_value = yli::data::AnyValue(int32_t_zero);
+    ASSERT_FALSE(any_value.set_new_value("2147483648"));
+    ASSERT_TRUE(any_value.holds<std::int32_t>());
+    ASSERT_EQ(any_value.get<std::int32_t>(), 0);
+}
+
+TEST(set_new_value_must_function_properly, originally_double_0_new_value_get_string_round_trip)
+{
+    constexpr double double_zero = 0.0;
+    auto any_value = yli::data::AnyValue(double_zero);
+    ASSERT_TRUE(any_value.set_new_value("-1234.5"));
+    ASSERT_TRUE(any_value.holds<double>());
+    ASSERT_EQ(any_value.get<double>(), -1234.5);
+    ASSERT_EQ(any_value.get_string(), "-1234.500000");
+}
+
+TEST(set_new_value_must_function_properly, originally_std_string_foo_new_value_bar)
+{
+    auto any_value = yli::data::AnyValue(std::string("foo"));
+    ASSERT_TRUE(any_value.set_new_value("bar"));
+    ASSERT_TRUE(any_value.holds<std::string>());
+    ASSERT_EQ(any_value.get<std::string>(), "bar");
 }
@@ -0,0 +1,154 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/load/asset_loader.hpp"
+
+// Include standard headers
+#include <chrono>    // std::chrono::microseconds
+#include <cstddef>   // std::size_t
+#include <future>    // std::future_status, std::shared_future
+#include <stdexcept> // std::runtime_error
+#include <thread>    // std::this_thread
+#include <vector>    // std::vector
+
+TEST(asset_loader_must_be_initialized_appropriately, one_worker_thread)
+{
+    yli::load::AssetLoader asset_loader(1);
+    ASSERT_EQ(asset_loader.get_number_of_worker_threads(), 1);
+    ASSERT_EQ(asset_loader.get_number_of_pending_jobs(), 0);
+}
+
+TEST(asset_loader_must_be_initialized_appropriately, default_number_of_worker_threads)
+{
+    yli::load::AssetLoader asset_loader(0);
+    ASSERT_GE(asset_loader.get_number_of_worker_threads(), 1);
+    ASSERT_EQ(asset_loader.get_number_of_pending_jobs(), 0);
+}
+
+TEST(asset_loader_must_run_upload_jobs_on_the_calling_thread, one_job)
+{
+    yli::load::AssetLoader asset_loader(1);
+
+    std::thread::id cpu_job_thread_id;
+    std::thread::id upload_job_thread_id;
+    bool upload_job_result = false;
+
+    std::shared_future<bool> future = asset_loader.enqueue(
+            [&cpu_job_thread_id]()
+            {
+                cpu_job_thread_id = std::this_thread::get_id();
+                return true;
+            },
+            [&upload_job_thread_id, &upload_job_result](const bool result)
+            {
+                upload_job_thread_id = std::this_thread::get_id();
+                upload_job_result = result;
+            });
+
+    ASSERT_EQ(asset_loader.get_number_of_pending_jobs(), 1);
+
+    asset_loader.finish();
+
+    ASSERT_EQ(asset_loader.get_number_of_pending_jobs(), 0);
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    ASSERT_TRUE(future.get());
+    ASSERT_TRUE(upload_job_result);
+    ASSERT_NE(cpu_job_thread_id, std::this_thread::get_id());
+    ASSERT_EQ(upload_job_thread_id, std::this_thread::get_id());
+}
+
+TEST(asset_loader_must_run_upload_jobs_on_the_calling_thread, many_jobs)
+{
+    yli::load::AssetLoader asset_loader(4);
+
+    constexpr std::size_t n_jobs = 100;
+    std::vector<std::size_t> upload_counts(n_jobs, 0);
+    std::vector<std::shared_future<bool>> futures;
+
+    for (std::size_t i = 0; i < n_jobs; i++)
+    {
+        futures.emplace_back(asset_loader.enqueue(
+                    [i]()
+                    {
+                        return i % 2 == 0;
+                    },
+                    [&upload_counts, i](const bool /* result */)
+                    {
+                        upload_counts.at(i)++;
+                    }));
+    }
+
+    asset_loader.finish();
+
+    ASSERT_EQ(asset_loader.get_number_of_pending_jobs(), 0);
+
+    for (std::size_t i = 0; i < n_jobs; i++)
+    {
+        ASSERT_EQ(upload_counts.at(i), 1);
+        ASSERT_EQ(futures.at(i).get(), i % 2 == 0);
+    }
+}
+
+TEST(asset_loader_process_uploads_must_run_at_least_one_upload, zero_time_budget)
+{
+    yli::load::AssetLoader asset_loader(1);
+
+    std::shared_future<bool> first_future = asset_loader.enqueue([]() { return true; }, nullptr);
+    std::shared_future<bool> second_future = asset_loader.enqueue([]() { return true; }, nullptr);
+
+    std::size_t n_uploads = 0;
+
+    while (n_uploads < 2)
+    {
+        const std::size_t n_uploads_now = asset_loader.process_uploads(std::chrono::microseconds(0));
+        ASSERT_LE(n_uploads_now, 1);
+        n_uploads += n_uploads_now;
+    }
+
+    ASSERT_EQ(asset_loader.get_number_of_pending_jobs(), 0);
+    ASSERT_TRUE(first_future.get());
+    ASSERT_TRUE(second_future.get());
+}
+
+TEST(asset_loader_process_uploads_must_not_block, no_jobs)
+{
+    yli::load::AssetLoader asset_loader(1);
+    ASSERT_EQ(asset_loader.process_uploads(std::chrono::microseconds(1000)), 0);
+}
+
+TEST(asset_loader_must_report_failure, cpu_job_throws)
+{
+    yli::load::AssetLoader asset_loader(1);
+
+    bool upload_job_result = true;
+
+    std::shared_future<bool> future = asset_loader.enqueue(
+            []() -> bool
+            {
+                throw std::runtime_error("failure");
+            },
+            [&upload_job_result](const bool result)
+            {
+                upload_job_result = result;
+            });
+
+    asset_loader.finish();
+
+    ASSERT_FALSE(future.get());
+    ASSERT_FALSE(upload_job_result);
+}
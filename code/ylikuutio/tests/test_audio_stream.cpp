@@ -0,0 +1,132 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "gtest/gtest.h"
+#include "code/ylikuutio/audio/audio_stream.hpp"
+#include "code/ylikuutio/audio/audio_decoder.hpp"
+
+// Include standard headers
+#include <algorithm> // std::min
+#include <cstddef>   // std::size_t
+#include <memory>    // std::make_unique, std::unique_ptr
+#include <span>      // std::span
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+namespace
+{
+    // Decodes `n_frames` frames, at most `max_n_frames_per_call` at a time.
+    // Both samples of frame `i` are `i`.
+    class CountingDecoder final : public yli::audio::AudioDecoder
+    {
+        public:
+            CountingDecoder(const std::size_t n_frames, const std::size_t max_n_frames_per_call)
+                : n_frames { n_frames },
+                  max_n_frames_per_call { max_n_frames_per_call }
+            {
+            }
+
+            std::size_t decode(std::span<float> samples) override
+            {
+                const std::size_t n_frames_to_decode = std::min({ samples.size() / 2, this->max_n_frames_per_call, this->n_frames - this->frame_i });
+
+                for (std::size_t i = 0; i < n_frames_to_decode; i++, this->frame_i++)
+                {
+                    samples[2 * i] = static_cast<float>(this->frame_i);
+                    samples[2 * i + 1] = static_cast<float>(this->frame_i);
+                }
+
+                this->n_calls++;
+                return n_frames_to_decode;
+            }
+
+            std::size_t n_calls { 0 };
+
+        private:
+            const std::size_t n_frames;
+            const std::size_t max_n_frames_per_call;
+            std::size_t frame_i { 0 };
+    };
+}
+
+TEST(audio_stream_must_be_initialized_appropriately, no_decoder)
+{
+    yli::audio::AudioStream audio_stream(nullptr, 16, 4);
+    ASSERT_EQ(audio_stream.get_capacity(), 64);
+    ASSERT_EQ(audio_stream.refill(), 0);
+    ASSERT_EQ(audio_stream.get_n_buffered_frames(), 0);
+    ASSERT_TRUE(audio_stream.get_is_finished());
+}
+
+TEST(audio_stream_refill_must_work_properly, only_whole_chunks_are_decoded)
+{
+    auto decoder = std::make_unique<CountingDecoder>(1000, 1000);
+    yli::audio::AudioStream audio_stream(std::move(decoder), 16, 4);
+
+    ASSERT_EQ(audio_stream.refill(), 64);
+    ASSERT_EQ(audio_stream.get_n_buffered_frames(), 64);
+    ASSERT_FALSE(audio_stream.get_is_finished());
+
+    // A full ring buffer is not refilled.
+    ASSERT_EQ(audio_stream.refill(), 0);
+
+    // Less than one chunk of free space is not refilled either.
+    std::vector<float> samples(2 * 10);
+    ASSERT_EQ(audio_stream.read(samples), 10);
+    ASSERT_EQ(audio_stream.refill(), 0);
+
+    ASSERT_EQ(audio_stream.read(samples), 10);
+    ASSERT_EQ(audio_stream.refill(), 16);
+    ASSERT_EQ(audio_stream.get_n_buffered_frames(), 60);
+    ASSERT_EQ(audio_stream.get_n_decoded_frames(), 80);
+}
+
+TEST(audio_stream_read_must_work_properly, frames_are_read_in_order_across_the_end_of_the_ring_buffer)
+{
+    auto decoder = std::make_unique<CountingDecoder>(100, 7);
+    yli::audio::AudioStream audio_stream(std::move(decoder), 16, 2);
+    std::vector<float> samples(2 * 12);
+    std::size_t expected_frame_i = 0;
+
+    while (!audio_stream.get_is_finished())
+    {
+        audio_stream.refill();
+        const std::size_t n_frames = audio_stream.read(samples);
+
+        for (std::size_t i = 0; i < n_frames; i++, expected_frame_i++)
+        {
+            ASSERT_EQ(samples[2 * i], static_cast<float>(expected_frame_i));
+            ASSERT_EQ(samples[2 * i + 1], static_cast<float>(expected_frame_i));
+        }
+    }
+
+    ASSERT_EQ(expected_frame_i, 100);
+    ASSERT_EQ(audio_stream.get_n_decoded_frames(), 100);
+}
+
+TEST(audio_stream_read_must_work_properly, stream_is_not_finished_before_all_frames_are_read)
+{
+    auto decoder = std::make_unique<CountingDecoder>(20, 1000);
+    yli::audio::AudioStream audio_stream(std::move(decoder), 16, 4);
+    audio_stream.refill();
+    ASSERT_EQ(audio_stream.get_n_buffered_frames(), 20);
+    ASSERT_FALSE(audio_stream.get_is_finished());
+
+    std::vector<float> samples(2 * 64);
+    ASSERT_EQ(audio_stream.read(samples), 20);
+    ASSERT_TRUE(audio_stream.get_is_finished());
+    ASSERT_EQ(audio_stream.read(samples), 0);
+}
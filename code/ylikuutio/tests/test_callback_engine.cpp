@@ -20,17 +20,67 @@
 #include "code/ylikuutio/ontology/universe.hpp"
 #include "code/ylikuutio/ontology/callback_engine.hpp"
 #include "code/ylikuutio/ontology/callback_engine_struct.hpp"
+#include "code/ylikuutio/ontology/callback_object.hpp"
+#include "code/ylikuutio/ontology/callback_parameter.hpp"
+#include "code/ylikuutio/ontology/scene.hpp"
+#include "code/ylikuutio/ontology/object.hpp"
+#include "code/ylikuutio/ontology/request.hpp"
+#include "code/ylikuutio/ontology/scene_struct.hpp"
+#include "code/ylikuutio/ontology/object_struct.hpp"
+#include "code/ylikuutio/ontology/movable_and_arguments_to_void_callback.hpp"
+#include "code/ylikuutio/data/any_value.hpp"
 
 // Include standard headers
-#include <cstdint> // uintptr_t
+#include <cstdint>  // uintptr_t
+#include <optional> // std::optional
+#include <span>     // std::span
+#include <variant>  // std::get
 
 namespace yli::ontology
 {
     class GenericParentModule;
-    class CallbackObject;
     class MovableController;
 }
 
+namespace
+{
+    void add_args_to_x(yli::ontology::Movable& movable, std::span<const yli::data::AnyValue* const> args)
+    {
+        for (const yli::data::AnyValue* const arg : args)
+        {
+            movable.location.xyz.x += arg->get<float>();
+        }
+    }
+
+    void double_x(yli::ontology::Movable& movable, std::span<const yli::data::AnyValue* const>)
+    {
+        movable.location.xyz.x *= 2.0f;
+    }
+
+    std::optional<yli::data::AnyValue> add_1_to_y(
+            yli::ontology::Universe&,
+            yli::ontology::CallbackEngine*,
+            yli::ontology::CallbackObject*,
+            yli::ontology::GenericParentModule&,
+            const yli::data::AnyValue& any_value)
+    {
+        any_value.get_movable_ref().location.xyz.y += 1.0f;
+        return std::nullopt;
+    }
+
+    yli::ontology::Object* create_object(mock::MockApplication& application)
+    {
+        yli::ontology::SceneStruct scene_struct;
+        yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+                scene_struct);
+
+        yli::ontology::ObjectStruct object_struct { yli::ontology::Request(scene) };
+        object_struct.cartesian_coordinates = { 1.0f, 2.0f, 3.0f }; // Whatever except NANs.
+        object_struct.orientation =           { 4.0f, 5.0f, 6.0f }; // Whatever except NANs.
+        return application.get_generic_entity_factory().create_object(object_struct);
+    }
+}
+
 TEST(callback_engine_must_be_initialized_appropriately, headless_universe)
 {
     mock::MockApplication application;
@@ -57,3 +107,65 @@ TEST(callback_engine_must_be_initialized_appropriately, headless_universe)
     ASSERT_EQ(callback_engine->get_parent(), &application.get_universe());
     ASSERT_EQ(callback_engine->get_number_of_non_variable_children(), 0);
 }
+
+TEST(callback_engine_must_execute_typed_callbacks, callbacks_in_order_with_bound_args)
+{
+    mock::MockApplication application;
+    yli::ontology::Object* const object = create_object(application);
+
+    yli::ontology::CallbackEngineStruct callback_engine_struct;
+    yli::ontology::CallbackEngine* const callback_engine = application.get_generic_entity_factory().create_callback_engine(
+            callback_engine_struct);
+
+    yli::ontology::CallbackObject* const add_callback_object = callback_engine->create_movable_callback_object(&add_args_to_x);
+    add_callback_object->create_callback_parameter("foo", yli::data::AnyValue(10.0f));
+    callback_engine->create_movable_callback_object(&double_x);
+
+    callback_engine->execute(*object);
+    ASSERT_EQ(object->location.xyz.x, 22.0f); // (1 + 10) * 2
+    ASSERT_EQ(object->location.xyz.y, 2.0f);
+
+    // New `CallbackParameter`s are bound on the next execution.
+    add_callback_object->create_callback_parameter("bar", yli::data::AnyValue(5.0f));
+    callback_engine->execute(*object);
+    ASSERT_EQ(object->location.xyz.x, 74.0f); // (22 + 10 + 5) * 2
+}
+
+TEST(callback_engine_must_execute_typed_callbacks, destroyed_callback_object_is_not_executed)
+{
+    mock::MockApplication application;
+    yli::ontology::Object* const object = create_object(application);
+
+    yli::ontology::CallbackEngineStruct callback_engine_struct;
+    yli::ontology::CallbackEngine* const callback_engine = application.get_generic_entity_factory().create_callback_engine(
+            callback_engine_struct);
+
+    yli::ontology::CallbackObject* const add_callback_object = callback_engine->create_movable_callback_object(&add_args_to_x);
+    add_callback_object->create_callback_parameter("foo", yli::data::AnyValue(10.0f));
+    callback_engine->create_movable_callback_object(&double_x);
+
+    callback_engine->execute(*object);
+    ASSERT_EQ(object->location.xyz.x, 22.0f);
+
+    application.get_generic_memory_system().destroy(add_callback_object->get_constructible_module());
+    callback_engine->execute(*object);
+    ASSERT_EQ(object->location.xyz.x, 44.0f);
+}
+
+TEST(callback_engine_must_execute_typed_callbacks, together_with_untyped_callbacks)
+{
+    mock::MockApplication application;
+    yli::ontology::Object* const object = create_object(application);
+
+    yli::ontology::CallbackEngineStruct callback_engine_struct;
+    yli::ontology::CallbackEngine* const callback_engine = application.get_generic_entity_factory().create_callback_engine(
+            callback_engine_struct);
+
+    yli::ontology::CallbackObject* const add_callback_object = callback_engine->create_movable_callback_object(&add_args_to_x);
+    add_callback_object->create_callback_parameter("foo", yli::data::AnyValue(10.0f));
+    callback_engine->create_callback_object(&add_1_to_y);
+
+    callback_engine->execute(*object);
+    ASSERT_EQ(object->location.xyz.x, 11.0f);
+    ASSERT_EQ(object->location.xyz.y, 3.0f);
+}
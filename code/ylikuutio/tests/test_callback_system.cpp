@@ -63,8 +63,8 @@ TEST(callback_engine_must_function_properly, return_uint32_t_deadbeef)
     callback_object->set_new_callback(&yli::snippets::return_uint32_t_deadbeef);
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>((*result).data));
-    ASSERT_EQ(std::get<std::uint32_t>((*result).data), 0xdeadbeef);
+    ASSERT_TRUE((*result).holds<std::uint32_t>());
+    ASSERT_EQ((*result).get<std::uint32_t>(), 0xdeadbeef);
 }
 
 TEST(callback_engine_must_function_properly, int32_t_zero_negated_equals_zero)
@@ -82,8 +82,8 @@ TEST(callback_engine_must_function_properly, int32_t_zero_negated_equals_zero)
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
     ASSERT_TRUE(result);
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>((*result).data));
-    ASSERT_EQ(std::get<std::int32_t>((*result).data), 0);
+    ASSERT_TRUE((*result).holds<std::int32_t>());
+    ASSERT_EQ((*result).get<std::int32_t>(), 0);
 }
 
 TEST(callback_engine_must_function_properly, int32_t_one_negated_equals_minus_one)
@@ -101,8 +101,8 @@ TEST(callback_engine_must_function_properly, int32_t_one_negated_equals_minus_on
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
     ASSERT_TRUE(result);
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>((*result).data));
-    ASSERT_EQ(std::get<std::int32_t>((*result).data), -1);
+    ASSERT_TRUE((*result).holds<std::int32_t>());
+    ASSERT_EQ((*result).get<std::int32_t>(), -1);
 }
 
 TEST(callback_engine_must_function_properly, int32_t_two_negated_equals_minus_two)
@@ -120,8 +120,8 @@ TEST(callback_engine_must_function_properly, int32_t_two_negated_equals_minus_tw
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
     ASSERT_TRUE(result);
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>((*result).data));
-    ASSERT_EQ(std::get<std::int32_t>((*result).data), -2);
+    ASSERT_TRUE((*result).holds<std::int32_t>());
+    ASSERT_EQ((*result).get<std::int32_t>(), -2);
 }
 
 TEST(callback_engine_must_function_properly, int32_t_minus_one_negated_equals_one)
@@ -139,8 +139,8 @@ TEST(callback_engine_must_function_properly, int32_t_minus_one_negated_equals_on
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
     ASSERT_TRUE(result);
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>((*result).data));
-    ASSERT_EQ(std::get<std::int32_t>((*result).data), 1);
+    ASSERT_TRUE((*result).holds<std::int32_t>());
+    ASSERT_EQ((*result).get<std::int32_t>(), 1);
 }
 
 TEST(callback_engine_must_function_properly, int32_t_minus_two_negated_equals_two)
@@ -158,8 +158,8 @@ TEST(callback_engine_must_function_properly, int32_t_minus_two_negated_equals_tw
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
     ASSERT_TRUE(result);
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>((*result).data));
-    ASSERT_EQ(std::get<std::int32_t>((*result).data), 2);
+    ASSERT_TRUE((*result).holds<std::int32_t>());
+    ASSERT_EQ((*result).get<std::int32_t>(), 2);
 }
 
 TEST(callback_engine_must_function_properly, int32_t_three_squared_equals_nine)
@@ -177,8 +177,8 @@ TEST(callback_engine_must_function_properly, int32_t_three_squared_equals_nine)
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
     ASSERT_TRUE(result);
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>((*result).data));
-    ASSERT_EQ(std::get<std::int32_t>((*result).data), 9);
+    ASSERT_TRUE((*result).holds<std::int32_t>());
+    ASSERT_EQ((*result).get<std::int32_t>(), 9);
 }
 
 TEST(callback_engine_must_function_properly, uint32_t_three_squared_equals_nine)
@@ -196,8 +196,8 @@ TEST(callback_engine_must_function_properly, uint32_t_three_squared_equals_nine)
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
     ASSERT_TRUE(result);
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>((*result).data));
-    ASSERT_EQ(std::get<std::uint32_t>((*result).data), 9);
+    ASSERT_TRUE((*result).holds<std::uint32_t>());
+    ASSERT_EQ((*result).get<std::uint32_t>(), 9);
 }
 
 TEST(callback_engine_must_function_properly, uint32_t_5_expt_7_equals_78125)
@@ -219,8 +219,8 @@ TEST(callback_engine_must_function_properly, uint32_t_5_expt_7_equals_78125)
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
     ASSERT_TRUE(result);
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>((*result).data));
-    ASSERT_EQ(std::get<std::uint32_t>((*result).data), 78125);
+    ASSERT_TRUE((*result).holds<std::uint32_t>());
+    ASSERT_EQ((*result).get<std::uint32_t>(), 78125);
 }
 
 TEST(callback_engine_must_function_properly, uint32_t_5_expt_7_equals_78125_with_named_inputs)
@@ -236,7 +236,7 @@ TEST(callback_engine_must_function_properly, uint32_t_5_expt_7_equals_78125_with
     yli::data::AnyValue five_value(five);
     callback_object->create_callback_parameter("base", std::move(five_value));
     std::optional<yli::data::AnyValue> anyvalue_base = callback_object->get_any_value("base");
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>((*anyvalue_base).data));
+    ASSERT_TRUE((*anyvalue_base).holds<std::uint32_t>());
 
     const std::uint32_t seven = 7;
     yli::data::AnyValue seven_value(seven);
@@ -244,8 +244,8 @@ TEST(callback_engine_must_function_properly, uint32_t_5_expt_7_equals_78125_with
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
     ASSERT_TRUE(result);
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>((*result).data));
-    ASSERT_EQ(std::get<std::uint32_t>((*result).data), 78125);
+    ASSERT_TRUE((*result).holds<std::uint32_t>());
+    ASSERT_EQ((*result).get<std::uint32_t>(), 78125);
 }
 
 TEST(callback_engine_must_function_properly, uint32_t_7_expt_5_then_squared_equals_282475249)
@@ -269,8 +269,8 @@ TEST(callback_engine_must_function_properly, uint32_t_7_expt_5_then_squared_equa
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
     ASSERT_TRUE(result);
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>((*result).data));
-    ASSERT_EQ(std::get<std::uint32_t>((*result).data), 282475249);
+    ASSERT_TRUE((*result).holds<std::uint32_t>());
+    ASSERT_EQ((*result).get<std::uint32_t>(), 282475249);
 }
 
 TEST(callback_engine_must_function_properly, two_squared_four_times_equals_65536)
@@ -295,6 +295,6 @@ TEST(callback_engine_must_function_properly, two_squared_four_times_equals_65536
 
     std::optional<yli::data::AnyValue> result = callback_engine->execute(yli::data::AnyValue());
     ASSERT_TRUE(result);
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>((*result).data));
-    ASSERT_EQ(std::get<std::uint32_t>((*result).data), 65536);
+    ASSERT_TRUE((*result).holds<std::uint32_t>());
+    ASSERT_EQ((*result).get<std::uint32_t>(), 65536);
 }
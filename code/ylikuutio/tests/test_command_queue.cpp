@@ -0,0 +1,112 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "gtest/gtest.h"
+#include "code/ylikuutio/audio/command_queue.hpp"
+
+// Include standard headers
+#include <cstddef> // std::size_t
+#include <thread>  // std::thread
+
+TEST(command_queue_must_be_initialized_appropriately, capacity_8)
+{
+    const yli::audio::CommandQueue<int, 8> command_queue;
+    ASSERT_TRUE(command_queue.empty());
+    ASSERT_EQ(command_queue.get_capacity(), 7);
+}
+
+TEST(command_queue_must_work_properly, values_are_popped_in_the_order_they_were_pushed)
+{
+    yli::audio::CommandQueue<int, 8> command_queue;
+    ASSERT_TRUE(command_queue.try_push(1));
+    ASSERT_TRUE(command_queue.try_push(2));
+    ASSERT_TRUE(command_queue.try_push(3));
+    ASSERT_FALSE(command_queue.empty());
+
+    int value = 0;
+    ASSERT_TRUE(command_queue.try_pop(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_TRUE(command_queue.try_pop(value));
+    ASSERT_EQ(value, 2);
+    ASSERT_TRUE(command_queue.try_pop(value));
+    ASSERT_EQ(value, 3);
+    ASSERT_FALSE(command_queue.try_pop(value));
+    ASSERT_TRUE(command_queue.empty());
+}
+
+TEST(command_queue_must_work_properly, push_to_full_queue_fails_and_wraparound_works)
+{
+    yli::audio::CommandQueue<int, 4> command_queue;
+    int value = 0;
+
+    for (int round_i = 0; round_i < 5; round_i++)
+    {
+        ASSERT_TRUE(command_queue.try_push(10 * round_i + 1));
+        ASSERT_TRUE(command_queue.try_push(10 * round_i + 2));
+        ASSERT_TRUE(command_queue.try_push(10 * round_i + 3));
+        ASSERT_FALSE(command_queue.try_push(10 * round_i + 4));
+
+        ASSERT_TRUE(command_queue.try_pop(value));
+        ASSERT_EQ(value, 10 * round_i + 1);
+        ASSERT_TRUE(command_queue.try_pop(value));
+        ASSERT_EQ(value, 10 * round_i + 2);
+        ASSERT_TRUE(command_queue.try_pop(value));
+        ASSERT_EQ(value, 10 * round_i + 3);
+        ASSERT_TRUE(command_queue.empty());
+    }
+}
+
+TEST(command_queue_must_work_properly, one_producer_thread_and_one_consumer_thread)
+{
+    constexpr std::size_t n_values = 100000;
+    yli::audio::CommandQueue<std::size_t, 64> command_queue;
+
+    std::thread producer_thread([&command_queue]()
+            {
+                for (std::size_t value = 0; value < n_values; )
+                {
+                    if (command_queue.try_push(value))
+                    {
+                        value++;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+    std::size_t n_values_in_order = 0;
+
+    for (std::size_t expected_value = 0; expected_value < n_values; )
+    {
+        std::size_t value = 0;
+
+        if (command_queue.try_pop(value))
+        {
+            n_values_in_order += (value == expected_value ? 1 : 0);
+            expected_value++;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer_thread.join();
+    ASSERT_EQ(n_values_in_order, n_values);
+    ASSERT_TRUE(command_queue.empty());
+}
@@ -0,0 +1,127 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/console/completion_engine.hpp"
+
+// Include standard headers
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+TEST(completion_engine_must_be_initialized_appropriately, no_candidates)
+{
+    yli::console::CompletionEngine completion_engine;
+    ASSERT_EQ(completion_engine.get_number_of_candidates(), 0);
+    ASSERT_EQ(completion_engine.update(""), 0);
+    ASSERT_EQ(completion_engine.update("foo"), 0);
+    ASSERT_EQ(completion_engine.complete(), "foo");
+    ASSERT_TRUE(completion_engine.get_page(0, 10).empty());
+}
+
+TEST(completion_engine_must_complete_prefix_matches, common_prefix)
+{
+    yli::console::CompletionEngine completion_engine;
+    completion_engine.set_candidates({ "foo_bar", "foo_baz", "qux" });
+
+    ASSERT_EQ(completion_engine.update(""), 3);
+    ASSERT_EQ(completion_engine.get_number_of_prefix_matches(), 3);
+    ASSERT_EQ(completion_engine.complete(), "");
+
+    ASSERT_EQ(completion_engine.update("f"), 2);
+    ASSERT_EQ(completion_engine.complete(), "foo_ba");
+
+    ASSERT_EQ(completion_engine.update("foo_baz"), 1);
+    ASSERT_EQ(completion_engine.complete(), "foo_baz");
+}
+
+TEST(completion_engine_must_complete_fuzzy_matches, subsequence)
+{
+    yli::console::CompletionEngine completion_engine;
+    completion_engine.set_candidates({ "turbo_polizei", "helsinki", "joensuu" });
+
+    ASSERT_EQ(completion_engine.update("tpol"), 1);
+    ASSERT_EQ(completion_engine.get_number_of_prefix_matches(), 0);
+    ASSERT_EQ(completion_engine.complete(), "turbo_polizei");
+
+    ASSERT_EQ(completion_engine.update("xyz"), 0);
+    ASSERT_EQ(completion_engine.complete(), "xyz");
+}
+
+TEST(completion_engine_must_rank_matches, prefix_matches_first_then_by_score)
+{
+    yli::console::CompletionEngine completion_engine;
+    completion_engine.set_candidates({ "scene.cat", "cat_and_dog", "cat", "charlotte", "concat" });
+
+    ASSERT_EQ(completion_engine.update("cat"), 5);
+    const std::vector<std::string_view> page = completion_engine.get_page(0, 10);
+    ASSERT_EQ(page.size(), 5);
+    ASSERT_EQ(page[0], "cat");
+    ASSERT_EQ(page[1], "cat_and_dog");
+    ASSERT_EQ(page[2], "scene.cat");  // Consecutive characters at the start of a name part.
+    ASSERT_EQ(page[3], "concat");     // Consecutive characters.
+    ASSERT_EQ(page[4], "charlotte");  // Gaps.
+}
+
+TEST(completion_engine_must_rank_matches, pages)
+{
+    yli::console::CompletionEngine completion_engine;
+    completion_engine.set_candidates({ "e", "d", "c", "b", "a" });
+
+    ASSERT_EQ(completion_engine.update(""), 5);
+    ASSERT_EQ(completion_engine.get_page(0, 2), (std::vector<std::string_view> { "a", "b" }));
+    ASSERT_EQ(completion_engine.get_page(2, 2), (std::vector<std::string_view> { "e" }));
+    ASSERT_EQ(completion_engine.get_page(1, 2), (std::vector<std::string_view> { "c", "d" }));
+    ASSERT_TRUE(completion_engine.get_page(3, 2).empty());
+}
+
+TEST(completion_engine_must_narrow_matches, extending_and_shortening_the_input)
+{
+    yli::console::CompletionEngine completion_engine;
+    completion_engine.set_candidates({ "foo", "fob", "bar" });
+
+    ASSERT_EQ(completion_engine.update("f"), 2);
+    ASSERT_EQ(completion_engine.update("fo"), 2);
+    ASSERT_EQ(completion_engine.update("foo"), 1);
+    ASSERT_EQ(completion_engine.get_page(0, 10), (std::vector<std::string_view> { "foo" }));
+
+    // Shortening the input recomputes the matches from all candidates.
+    ASSERT_EQ(completion_engine.update("b"), 2);
+    ASSERT_EQ(completion_engine.get_page(0, 10), (std::vector<std::string_view> { "bar", "fob" }));
+}
+
+TEST(completion_engine_must_rank_matches, nested_names_with_shared_prefixes)
+{
+    yli::console::CompletionEngine completion_engine;
+    completion_engine.set_candidates({
+            "scene.turbo_polizei_1.cartesian_coordinates",
+            "scene.turbo_polizei_1",
+            "scene.turbo_polizei_2",
+            "scene.turbo_polizei_2.cartesian_coordinates",
+            "scene.tank" });
+
+    ASSERT_EQ(completion_engine.update("tp2"), 2);
+    ASSERT_EQ(completion_engine.get_page(0, 10), (std::vector<std::string_view> {
+            "scene.turbo_polizei_2",
+            "scene.turbo_polizei_2.cartesian_coordinates" }));
+
+    ASSERT_EQ(completion_engine.update("tp2c"), 1);
+    ASSERT_EQ(completion_engine.complete(), "scene.turbo_polizei_2.cartesian_coordinates");
+
+    ASSERT_EQ(completion_engine.update("scene.t"), 5);
+    ASSERT_EQ(completion_engine.complete(), "scene.t");
+}
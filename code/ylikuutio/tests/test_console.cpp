@@ -22,11 +22,18 @@
 #include "code/ylikuutio/ontology/request.hpp"
 #include "code/ylikuutio/ontology/input_mode_struct.hpp"
 #include "code/ylikuutio/ontology/console_struct.hpp"
+#include "code/ylikuutio/ontology/callback_magic_numbers.hpp"
+#include "code/ylikuutio/console/console_logic_module.hpp"
+#include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/snippets/console_callback_snippets.hpp"
 
 // Include standard headers
-#include <cstdint> // uintptr_t
-#include <cstddef> // std::size_t
-#include <limits>  // std::numeric_limits
+#include <cstdint>  // uintptr_t, std::uint32_t
+#include <cstddef>  // std::size_t
+#include <limits>   // std::numeric_limits
+#include <optional> // std::optional
+#include <string>   // std::string
+#include <variant>  // std::get, std::holds_alternative
 
 namespace yli::ontology
 {
@@ -117,3 +124,72 @@ TEST(exit_console_must_function_appropriately, no_font)
     console->exit_console();
     ASSERT_FALSE(console->console_logic_module.get_active_in_console());
 }
+
+TEST(execute_command_must_function_appropriately, no_font)
+{
+    mock::MockApplication application;
+    yli::ontology::ConsoleStruct console_struct(0, 39, 15, 0); // Some dummy dimensions.
+    yli::ontology::Console* const console = application.get_generic_entity_factory().create_console(
+            console_struct);
+
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "quit",
+            yli::ontology::Request<yli::ontology::Console>(console),
+            &yli::snippets::quit);
+
+    const std::optional<yli::data::AnyValue> quit_value = console->execute_command("quit");
+    ASSERT_TRUE(quit_value);
+    ASSERT_TRUE(quit_value->holds<std::uint32_t>());
+    ASSERT_EQ(quit_value->get<std::uint32_t>(), yli::ontology::CallbackMagicNumber::EXIT_PROGRAM);
+
+    ASSERT_FALSE(console->execute_command("no-such-command"));
+}
+
+TEST(search_command_must_function_appropriately, no_font)
+{
+    mock::MockApplication application;
+    yli::ontology::ConsoleStruct console_struct(0, 39, 15, 0); // Some dummy dimensions.
+    yli::ontology::Console* const console = application.get_generic_entity_factory().create_console(
+            console_struct);
+
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "search",
+            yli::ontology::Request<yli::ontology::Console>(console),
+            &yli::console::ConsoleLogicModule::search);
+
+    console->print_text("foo 1");
+    console->print_text("bar");
+    console->print_text("foo 2");
+    console->execute_command("search foo");
+
+    // The command itself is stored in the scrollback buffer before it is executed, so it matches too.
+    const std::string command_line = console->get_prompt() + "search foo";
+    ASSERT_EQ(console->scrollback_buffer.size(), 7);
+    ASSERT_EQ(console->scrollback_buffer.at(3), command_line);
+    ASSERT_EQ(console->scrollback_buffer.at(4), "foo 1");
+    ASSERT_EQ(console->scrollback_buffer.at(5), "foo 2");
+    ASSERT_EQ(console->scrollback_buffer.at(6), command_line);
+}
+
+TEST(search_command_must_function_appropriately, needle_of_several_words)
+{
+    mock::MockApplication application;
+    yli::ontology::ConsoleStruct console_struct(0, 39, 15, 0); // Some dummy dimensions.
+    yli::ontology::Console* const console = application.get_generic_entity_factory().create_console(
+            console_struct);
+
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "search",
+            yli::ontology::Request<yli::ontology::Console>(console),
+            &yli::console::ConsoleLogicModule::search);
+
+    console->print_text("foo 1");
+    console->print_text("foo 2");
+    console->execute_command("search foo 2");
+
+    const std::string command_line = console->get_prompt() + "search foo 2";
+    ASSERT_EQ(console->scrollback_buffer.size(), 5);
+    ASSERT_EQ(console->scrollback_buffer.at(2), command_line);
+    ASSERT_EQ(console->scrollback_buffer.at(3), "foo 2");
+    ASSERT_EQ(console->scrollback_buffer.at(4), command_line);
+}
@@ -0,0 +1,111 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/console/console_grid.hpp"
+#include "code/ylikuutio/console/scrollback_buffer.hpp"
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <string_view> // std::string_view
+
+TEST(console_grid_must_be_initialized_appropriately, n_columns_4_n_rows_3)
+{
+    const yli::console::ConsoleGrid console_grid(4, 3);
+    ASSERT_EQ(console_grid.get_n_columns(), 4);
+    ASSERT_EQ(console_grid.get_n_rows(), 3);
+    ASSERT_TRUE(console_grid.get_is_dirty());
+
+    for (std::size_t row_i = 0; row_i < 3; row_i++)
+    {
+        ASSERT_EQ(console_grid.get_row(row_i), "    ");
+        ASSERT_EQ(console_grid.get_dirty_columns(row_i).first, 0);
+        ASSERT_EQ(console_grid.get_dirty_columns(row_i).last, 4);
+    }
+}
+
+TEST(console_grid_must_be_initialized_appropriately, n_columns_0_n_rows_0)
+{
+    const yli::console::ConsoleGrid console_grid(0, 0);
+    ASSERT_EQ(console_grid.get_n_columns(), 1);
+    ASSERT_EQ(console_grid.get_n_rows(), 1);
+    ASSERT_EQ(console_grid.get_row(0), " ");
+}
+
+TEST(console_grid_set_row_must_work_properly, short_row_is_padded_and_long_row_is_truncated)
+{
+    yli::console::ConsoleGrid console_grid(4, 2);
+    console_grid.set_row(0, "ab");
+    console_grid.set_row(1, "abcdef");
+    ASSERT_EQ(console_grid.get_row(0), "ab  ");
+    ASSERT_EQ(console_grid.get_row(1), "abcd");
+}
+
+TEST(console_grid_set_row_must_work_properly, only_changed_columns_are_dirty)
+{
+    yli::console::ConsoleGrid console_grid(8, 2);
+    console_grid.set_row(0, "foo bar");
+    console_grid.clear_dirty();
+    ASSERT_FALSE(console_grid.get_is_dirty());
+
+    console_grid.set_row(0, "foo bar");
+    ASSERT_FALSE(console_grid.get_is_dirty());
+    ASSERT_TRUE(console_grid.get_dirty_columns(0).empty());
+
+    console_grid.set_row(0, "fox baz");
+    ASSERT_TRUE(console_grid.get_is_dirty());
+    ASSERT_EQ(console_grid.get_dirty_columns(0).first, 2);
+    ASSERT_EQ(console_grid.get_dirty_columns(0).last, 7);
+    ASSERT_TRUE(console_grid.get_dirty_columns(1).empty());
+
+    console_grid.set_row(0, "zox baz");
+    ASSERT_EQ(console_grid.get_dirty_columns(0).first, 0);
+    ASSERT_EQ(console_grid.get_dirty_columns(0).last, 7);
+}
+
+TEST(console_grid_set_text_must_work_properly, scrollback_lines_followed_by_wrapped_input)
+{
+    yli::console::ScrollbackBuffer scrollback_buffer(4, 4);
+    scrollback_buffer.add_to_buffer("foo");
+    scrollback_buffer.add_to_buffer("bar");
+
+    yli::console::ConsoleGrid console_grid(4, 5);
+    console_grid.set_text(scrollback_buffer.get_view_to_last(2), "$ abcd");
+    ASSERT_EQ(console_grid.get_row(0), "foo ");
+    ASSERT_EQ(console_grid.get_row(1), "bar ");
+    ASSERT_EQ(console_grid.get_row(2), "$ ab");
+    ASSERT_EQ(console_grid.get_row(3), "cd  ");
+    ASSERT_EQ(console_grid.get_row(4), "    ");
+
+    console_grid.clear_dirty();
+    console_grid.set_text(scrollback_buffer.get_view_to_last(2), "$ abc");
+    ASSERT_TRUE(console_grid.get_dirty_columns(0).empty());
+    ASSERT_TRUE(console_grid.get_dirty_columns(2).empty());
+    ASSERT_EQ(console_grid.get_dirty_columns(3).first, 1);
+    ASSERT_EQ(console_grid.get_dirty_columns(3).last, 2);
+}
+
+TEST(console_grid_set_text_must_work_properly, rows_beyond_the_grid_are_clipped)
+{
+    yli::console::ScrollbackBuffer scrollback_buffer(2, 2);
+    scrollback_buffer.add_to_buffer("aabbcc");
+
+    yli::console::ConsoleGrid console_grid(2, 2);
+    console_grid.set_text(scrollback_buffer.get_view_to_last(3), "dd");
+    ASSERT_EQ(console_grid.get_row(0), "aa");
+    ASSERT_EQ(console_grid.get_row(1), "bb");
+}
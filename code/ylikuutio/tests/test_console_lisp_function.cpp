@@ -21,13 +21,51 @@
 #include "code/ylikuutio/ontology/console.hpp"
 #include "code/ylikuutio/ontology/request.hpp"
 #include "code/ylikuutio/ontology/console_lisp_function_struct.hpp"
+#include "code/ylikuutio/ontology/console_struct.hpp"
+#include "code/ylikuutio/data/any_value.hpp"
 
 // Include standard headers
-#include <cstdint> // uintptr_t
-#include <limits>  // std::numeric_limits
+#include <cstdint>  // std::uint32_t, uintptr_t
+#include <limits>   // std::numeric_limits
+#include <optional> // std::optional
+#include <string>   // std::string
+#include <variant>  // std::get, std::holds_alternative
 
 using yli::ontology::Console;
 
+namespace
+{
+    std::optional<yli::data::AnyValue> overload_float(const float)
+    {
+        return yli::data::AnyValue(static_cast<std::uint32_t>(1));
+    }
+
+    std::optional<yli::data::AnyValue> overload_string(const std::string&)
+    {
+        return yli::data::AnyValue(static_cast<std::uint32_t>(2));
+    }
+
+    std::optional<yli::data::AnyValue> overload_uint32_uint32(const std::uint32_t, const std::uint32_t)
+    {
+        return yli::data::AnyValue(static_cast<std::uint32_t>(3));
+    }
+
+    std::optional<yli::data::AnyValue> overload_console_bool(Console&, const bool)
+    {
+        return yli::data::AnyValue(static_cast<std::uint32_t>(4));
+    }
+
+    std::uint32_t get_overload_number(const std::optional<yli::data::AnyValue>& value)
+    {
+        if (value.has_value() && value->holds<std::uint32_t>())
+        {
+            return value->get<std::uint32_t>();
+        }
+
+        return 0;
+    }
+}
+
 TEST(console_lisp_function_must_be_initialized_appropriately, console_provided_as_valid_pointer)
 {
     mock::MockApplication application;
@@ -119,3 +157,32 @@ TEST(console_lisp_function_must_be_initialized_appropriately, console_provided_a
     ASSERT_EQ(console_lisp_function->get_parent(), nullptr);
     ASSERT_EQ(console_lisp_function->get_number_of_non_variable_children(), 0);
 }
+
+TEST(console_lisp_function_must_dispatch_to_matching_overload, arity_and_argument_class)
+{
+    mock::MockApplication application;
+    yli::ontology::ConsoleStruct console_struct(0, 39, 15, 0); // Some dummy dimensions.
+    yli::ontology::Console* const console = application.get_generic_entity_factory().create_console(
+            console_struct);
+
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "f", yli::ontology::Request<Console>(console), &overload_float);
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "f", yli::ontology::Request<Console>(console), &overload_string);
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "f", yli::ontology::Request<Console>(console), &overload_uint32_uint32);
+
+    ASSERT_EQ(get_overload_number(console->execute_command("f 1.5")), 1);
+    ASSERT_EQ(get_overload_number(console->execute_command("f foo")), 2);
+    ASSERT_EQ(get_overload_number(console->execute_command("f 1 2")), 3);
+    ASSERT_FALSE(console->execute_command("f 1 foo"));
+    ASSERT_FALSE(console->execute_command("f 1 2 3"));
+    ASSERT_FALSE(console->execute_command("f"));
+
+    // Overloads created later are dispatched to as well. Overloads are tried in ID order,
+    // so the `std::string` overload comes first for `true`.
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "f", yli::ontology::Request<Console>(console), &overload_console_bool);
+    ASSERT_EQ(get_overload_number(console->execute_command("f true")), 2);
+    ASSERT_EQ(get_overload_number(console->execute_command("f 1 2")), 3);
+}
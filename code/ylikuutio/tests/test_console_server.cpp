@@ -0,0 +1,144 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/console/console_server.hpp"
+#include "code/ylikuutio/console/console_server_struct.hpp"
+#include "code/ylikuutio/console/remote_command.hpp"
+
+// Include asio
+#include <asio.hpp>
+
+// Include standard headers
+#include <chrono>     // std::chrono::milliseconds
+#include <cstddef>    // std::size_t
+#include <filesystem> // std::filesystem::exists, std::filesystem::temp_directory_path
+#include <string>     // std::string
+#include <thread>     // std::this_thread
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+namespace
+{
+    // Plays the part of the main loop.
+    std::vector<yli::console::RemoteCommand> wait_for_commands(yli::console::ConsoleServer& console_server, const std::size_t n_commands)
+    {
+        std::vector<yli::console::RemoteCommand> commands;
+
+        for (std::size_t i = 0; i < 5000 && commands.size() < n_commands; i++)
+        {
+            for (yli::console::RemoteCommand& command : console_server.take_commands())
+            {
+                commands.emplace_back(std::move(command));
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return commands;
+    }
+
+    template<typename Socket>
+    std::string read_line(Socket& socket, std::string& buffer)
+    {
+        const std::size_t line_length = asio::read_until(socket, asio::dynamic_buffer(buffer), '\n');
+        std::string line = buffer.substr(0, line_length - 1);
+        buffer.erase(0, line_length);
+        return line;
+    }
+}
+
+TEST(console_server_must_serve_clients, tcp)
+{
+    yli::console::ConsoleServerStruct console_server_struct;
+    yli::console::ConsoleServer console_server(console_server_struct);
+    ASSERT_NE(console_server.get_tcp_port(), 0);
+
+    asio::io_context io_context;
+    asio::ip::tcp::socket socket(io_context);
+    socket.connect(asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), console_server.get_tcp_port()));
+    asio::write(socket, asio::buffer(std::string(":metrics on\nfoo bar\r\n\nbaz\n")));
+
+    const std::vector<yli::console::RemoteCommand> commands = wait_for_commands(console_server, 2);
+    ASSERT_EQ(commands.size(), 2);
+    ASSERT_EQ(commands[0].command, "foo bar");
+    ASSERT_EQ(commands[1].command, "baz");
+    ASSERT_EQ(commands[0].client_id, commands[1].client_id);
+
+    console_server.send_metrics("ticks=1");
+    console_server.send_result(commands[0].client_id, "first\nline");
+    console_server.send_result(commands[1].client_id, "");
+
+    std::string buffer;
+    ASSERT_EQ(read_line(socket, buffer), "metrics ticks=1");
+    ASSERT_EQ(read_line(socket, buffer), "result first line");
+    ASSERT_EQ(read_line(socket, buffer), "result ");
+
+    // Sending to a client that has gone is not an error.
+    socket.close();
+    console_server.send_result(commands[0].client_id, "gone");
+}
+
+TEST(console_server_must_serve_clients, metrics_only_to_subscribers)
+{
+    yli::console::ConsoleServerStruct console_server_struct;
+    yli::console::ConsoleServer console_server(console_server_struct);
+
+    asio::io_context io_context;
+    asio::ip::tcp::socket socket(io_context);
+    socket.connect(asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), console_server.get_tcp_port()));
+    asio::write(socket, asio::buffer(std::string("ping\n")));
+
+    const std::vector<yli::console::RemoteCommand> commands = wait_for_commands(console_server, 1);
+    ASSERT_EQ(commands.size(), 1);
+
+    console_server.send_metrics("ticks=1");
+    console_server.send_result(commands[0].client_id, "pong");
+
+    std::string buffer;
+    ASSERT_EQ(read_line(socket, buffer), "result pong");
+}
+
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+TEST(console_server_must_serve_clients, unix_domain_socket)
+{
+    const std::string socket_path = (std::filesystem::temp_directory_path() / "test_console_server.sock").string();
+
+    {
+        yli::console::ConsoleServerStruct console_server_struct;
+        console_server_struct.unix_socket_path = socket_path;
+        yli::console::ConsoleServer console_server(console_server_struct);
+        ASSERT_EQ(console_server.get_tcp_port(), 0);
+
+        asio::io_context io_context;
+        asio::local::stream_protocol::socket socket(io_context);
+        socket.connect(asio::local::stream_protocol::endpoint(socket_path));
+        asio::write(socket, asio::buffer(std::string("foo\n")));
+
+        const std::vector<yli::console::RemoteCommand> commands = wait_for_commands(console_server, 1);
+        ASSERT_EQ(commands.size(), 1);
+        ASSERT_EQ(commands[0].command, "foo");
+
+        console_server.send_result(commands[0].client_id, "bar");
+
+        std::string buffer;
+        ASSERT_EQ(read_line(socket, buffer), "result bar");
+    }
+
+    ASSERT_FALSE(std::filesystem::exists(socket_path));
+}
+#endif
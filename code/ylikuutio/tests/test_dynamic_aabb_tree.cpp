@@ -0,0 +1,190 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/geometry/aabb.hpp"
+#include "code/ylikuutio/geometry/dynamic_aabb_tree.hpp"
+#include "code/ylikuutio/geometry/frustum.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+#ifndef __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#define __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#include <glm/gtc/matrix_transform.hpp>
+#endif
+
+// Include standard headers
+#include <algorithm> // std::sort
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int32_t, std::uintptr_t
+#include <vector>    // std::vector
+
+namespace
+{
+    void* to_user_data(const std::uintptr_t value)
+    {
+        return reinterpret_cast<void*>(value);
+    }
+
+    yli::geometry::Aabb unit_box_at(const glm::vec3& center)
+    {
+        return yli::geometry::Aabb(center - glm::vec3(0.5f), center + glm::vec3(0.5f));
+    }
+}
+
+TEST(aabb_must_be_defined_as_expected, default_aabb_is_empty)
+{
+    const yli::geometry::Aabb aabb;
+    ASSERT_TRUE(aabb.is_empty());
+}
+
+TEST(aabb_must_be_defined_as_expected, aabb_from_points)
+{
+    const yli::geometry::Aabb aabb = yli::geometry::Aabb::from_points(
+            std::vector<glm::vec3> { glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(-1.0f, 5.0f, 0.0f) });
+    ASSERT_FALSE(aabb.is_empty());
+    ASSERT_EQ(aabb.min, glm::vec3(-1.0f, 2.0f, 0.0f));
+    ASSERT_EQ(aabb.max, glm::vec3(1.0f, 5.0f, 3.0f));
+    ASSERT_TRUE(yli::geometry::Aabb::from_points(std::vector<glm::vec3>()).is_empty());
+}
+
+TEST(aabb_must_be_defined_as_expected, merge_and_contains)
+{
+    const yli::geometry::Aabb a = unit_box_at(glm::vec3(0.0f));
+    const yli::geometry::Aabb b = unit_box_at(glm::vec3(4.0f, 0.0f, 0.0f));
+    const yli::geometry::Aabb merged = yli::geometry::Aabb::merge(a, b);
+    ASSERT_TRUE(merged.contains(a));
+    ASSERT_TRUE(merged.contains(b));
+    ASSERT_FALSE(a.contains(merged));
+    ASSERT_FALSE(a.overlaps(b));
+    ASSERT_TRUE(merged.overlaps(a));
+}
+
+TEST(dynamic_aabb_tree_must_be_initialized_appropriately, empty_tree)
+{
+    const yli::geometry::DynamicAabbTree tree;
+    ASSERT_EQ(tree.get_number_of_proxies(), 0);
+    ASSERT_EQ(tree.get_height(), 0);
+    ASSERT_TRUE(tree.validate());
+}
+
+TEST(dynamic_aabb_tree_must_work_appropriately, create_and_destroy_proxies)
+{
+    yli::geometry::DynamicAabbTree tree;
+    std::vector<std::int32_t> proxy_ids;
+
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        proxy_ids.emplace_back(tree.create_proxy(unit_box_at(glm::vec3(static_cast<float>(i) * 3.0f, 0.0f, 0.0f)), to_user_data(i + 1)));
+        ASSERT_TRUE(tree.validate());
+    }
+
+    ASSERT_EQ(tree.get_number_of_proxies(), 100);
+
+    // A balanced tree of 100 leaves should not be much higher than log2(100).
+    ASSERT_LE(tree.get_height(), 14);
+
+    for (std::size_t i = 0; i < 100; i += 2)
+    {
+        tree.destroy_proxy(proxy_ids[i]);
+        ASSERT_TRUE(tree.validate());
+    }
+
+    ASSERT_EQ(tree.get_number_of_proxies(), 50);
+    ASSERT_EQ(tree.get_user_data(proxy_ids[1]), to_user_data(2));
+
+    for (std::size_t i = 1; i < 100; i += 2)
+    {
+        tree.destroy_proxy(proxy_ids[i]);
+    }
+
+    ASSERT_EQ(tree.get_number_of_proxies(), 0);
+    ASSERT_TRUE(tree.validate());
+}
+
+TEST(dynamic_aabb_tree_must_work_appropriately, move_proxy_inside_fat_aabb_does_not_reinsert)
+{
+    yli::geometry::DynamicAabbTree tree(1.0f);
+    const std::int32_t proxy_id = tree.create_proxy(unit_box_at(glm::vec3(0.0f)), to_user_data(1));
+
+    ASSERT_FALSE(tree.move_proxy(proxy_id, unit_box_at(glm::vec3(0.5f, 0.0f, 0.0f))));
+    ASSERT_TRUE(tree.move_proxy(proxy_id, unit_box_at(glm::vec3(10.0f, 0.0f, 0.0f))));
+    ASSERT_TRUE(tree.get_fat_aabb(proxy_id).contains(unit_box_at(glm::vec3(10.0f, 0.0f, 0.0f))));
+    ASSERT_TRUE(tree.validate());
+}
+
+TEST(dynamic_aabb_tree_must_work_appropriately, aabb_query)
+{
+    yli::geometry::DynamicAabbTree tree(0.0f);
+
+    for (std::size_t i = 0; i < 10; i++)
+    {
+        tree.create_proxy(unit_box_at(glm::vec3(static_cast<float>(i) * 10.0f, 0.0f, 0.0f)), to_user_data(i + 1));
+    }
+
+    std::vector<void*> found;
+    tree.query(
+            yli::geometry::Aabb(glm::vec3(15.0f, -1.0f, -1.0f), glm::vec3(35.0f, 1.0f, 1.0f)),
+            [&found](void* const user_data)
+            {
+                found.emplace_back(user_data);
+            });
+
+    std::sort(found.begin(), found.end());
+    ASSERT_EQ(found.size(), 2);
+    ASSERT_EQ(found[0], to_user_data(3));
+    ASSERT_EQ(found[1], to_user_data(4));
+}
+
+TEST(dynamic_aabb_tree_must_work_appropriately, frustum_query)
+{
+    yli::geometry::DynamicAabbTree tree(0.0f);
+
+    // 5 boxes in front of the camera, 5 boxes behind it.
+    for (std::size_t i = 0; i < 5; i++)
+    {
+        tree.create_proxy(unit_box_at(glm::vec3(0.0f, 0.0f, -10.0f - static_cast<float>(i) * 10.0f)), to_user_data(i + 1));
+        tree.create_proxy(unit_box_at(glm::vec3(0.0f, 0.0f, 10.0f + static_cast<float>(i) * 10.0f)), to_user_data(i + 101));
+    }
+
+    const glm::mat4 projection_matrix = glm::perspective(glm::radians(90.0f), 1.0f, 1.0f, 100.0f);
+    const glm::mat4 view_matrix = glm::lookAt(
+            glm::vec3(0.0f, 0.0f, 0.0f),
+            glm::vec3(0.0f, 0.0f, -1.0f),
+            glm::vec3(0.0f, 1.0f, 0.0f));
+    const yli::geometry::Frustum frustum(projection_matrix * view_matrix);
+
+    std::vector<void*> found;
+    tree.query(
+            frustum,
+            [&found](void* const user_data)
+            {
+                found.emplace_back(user_data);
+            });
+
+    std::sort(found.begin(), found.end());
+    ASSERT_EQ(found.size(), 5);
+
+    for (std::size_t i = 0; i < 5; i++)
+    {
+        ASSERT_EQ(found[i], to_user_data(i + 1));
+    }
+}
@@ -0,0 +1,250 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/lisp/flat_parser.hpp"
+#include "code/ylikuutio/lisp/flat_syntax_tree.hpp"
+#include "code/ylikuutio/lisp/flat_expr.hpp"
+#include "code/ylikuutio/lisp/flat_expr_visitor.hpp"
+#include "code/ylikuutio/lisp/scanner.hpp"
+#include "code/ylikuutio/lisp/parser.hpp"
+#include "code/ylikuutio/lisp/syntax_tree_list.hpp"
+#include "code/ylikuutio/lisp/error_log.hpp"
+#include "code/ylikuutio/lisp/error.hpp"
+#include "code/ylikuutio/lisp/error_type.hpp"
+#include "code/ylikuutio/lisp/expr.hpp"
+#include "code/ylikuutio/lisp/expr_type.hpp"
+#include "code/ylikuutio/lisp/token.hpp"
+#include "code/ylikuutio/lisp/token_type.hpp"
+
+// Include standard headers
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int64_t, std::uint64_t
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
+
+using yli::lisp::FlatParser;
+using yli::lisp::FlatSyntaxTree;
+using yli::lisp::FlatExpr;
+using yli::lisp::FlatExprVisitor;
+using yli::lisp::Scanner;
+using yli::lisp::Parser;
+using yli::lisp::SyntaxTreeList;
+using yli::lisp::ErrorLog;
+using yli::lisp::ErrorType;
+using yli::lisp::Expr;
+using yli::lisp::ExprType;
+using yli::lisp::Token;
+using yli::lisp::TokenType;
+
+namespace
+{
+    void expect_same_expr(const FlatSyntaxTree& flat_syntax_tree, const FlatExpr& flat_expr, const Expr& expr)
+    {
+        const Token& token = expr.get_token();
+        ASSERT_EQ(flat_expr.type, expr.get_type());
+        ASSERT_EQ(flat_expr.token_type, token.get_type());
+        ASSERT_EQ(flat_expr.lexeme, token.get_lexeme());
+        ASSERT_EQ(flat_expr.line, token.get_line());
+        ASSERT_EQ(flat_expr.column, token.get_column());
+        ASSERT_EQ(flat_expr.get_numeric_value<std::uint64_t>(), token.get_numeric_value<std::uint64_t>());
+        ASSERT_EQ(flat_expr.get_numeric_value<std::int64_t>(), token.get_numeric_value<std::int64_t>());
+        ASSERT_EQ(flat_expr.get_numeric_value<double>(), token.get_numeric_value<double>());
+        ASSERT_EQ(flat_expr.number_of_children, expr.get_number_of_children());
+
+        const FlatExpr* flat_child = flat_syntax_tree.get_first_child(flat_expr);
+
+        for (std::size_t child_i = 0; child_i < expr.get_number_of_children(); child_i++)
+        {
+            ASSERT_NE(flat_child, nullptr);
+            expect_same_expr(flat_syntax_tree, *flat_child, expr.at(child_i));
+            flat_child = flat_syntax_tree.get_next_sibling(*flat_child);
+        }
+
+        ASSERT_EQ(flat_child, nullptr);
+    }
+
+    void expect_same_as_scanner_and_parser(const std::string_view source)
+    {
+        SCOPED_TRACE(source);
+        const Scanner scanner(source);
+        const Parser parser(scanner.get_token_list());
+        const FlatParser flat_parser(source);
+
+        ASSERT_EQ(flat_parser.get_is_success(), scanner.get_is_success() && parser.get_is_success());
+
+        const SyntaxTreeList& syntax_tree_list = parser.get_syntax_tree_list();
+        const FlatSyntaxTree& flat_syntax_tree = flat_parser.get_syntax_tree();
+        ASSERT_EQ(flat_syntax_tree.size(), syntax_tree_list.size());
+
+        for (std::size_t i = 0; i < syntax_tree_list.size(); i++)
+        {
+            expect_same_expr(flat_syntax_tree, flat_syntax_tree.at(i), syntax_tree_list.at(i));
+        }
+
+        // `FlatParser` reports scanner errors and parser errors in the order they occur in the source,
+        // so only compare the sets of errors.
+        const ErrorLog& scanner_error_log = scanner.get_error_log();
+        const ErrorLog& parser_error_log = parser.get_error_log();
+        const ErrorLog& flat_error_log = flat_parser.get_error_log();
+        ASSERT_EQ(flat_error_log.size(), scanner_error_log.size() + parser_error_log.size());
+
+        std::vector<std::size_t> matched(flat_error_log.size(), 0);
+
+        for (const ErrorLog* error_log : { &scanner_error_log, &parser_error_log })
+        {
+            for (std::size_t error_i = 0; error_i < error_log->size(); error_i++)
+            {
+                const yli::lisp::Error& error = error_log->at(error_i);
+                bool is_found = false;
+
+                for (std::size_t flat_error_i = 0; flat_error_i < flat_error_log.size() && !is_found; flat_error_i++)
+                {
+                    const yli::lisp::Error& flat_error = flat_error_log.at(flat_error_i);
+
+                    if (matched[flat_error_i] == 0 &&
+                            flat_error.get_type() == error.get_type() &&
+                            flat_error.get_line() == error.get_line() &&
+                            flat_error.get_column() == error.get_column())
+                    {
+                        matched[flat_error_i] = 1;
+                        is_found = true;
+                    }
+                }
+
+                ASSERT_TRUE(is_found);
+            }
+        }
+    }
+
+    class LexemeCollector final : public FlatExprVisitor
+    {
+        public:
+            void visit_identifier_expr(const FlatSyntaxTree&, const FlatExpr& identifier_expr) override
+            {
+                this->lexemes.emplace_back("identifier " + std::string(identifier_expr.lexeme));
+            }
+
+            void visit_literal_expr(const FlatSyntaxTree&, const FlatExpr& literal_expr) override
+            {
+                this->lexemes.emplace_back("literal " + std::string(literal_expr.lexeme));
+            }
+
+            void visit_function_call_expr(const FlatSyntaxTree& syntax_tree, const FlatExpr& function_call_expr) override
+            {
+                this->lexemes.emplace_back("call " + std::string(function_call_expr.lexeme));
+
+                for (const FlatExpr* child = syntax_tree.get_first_child(function_call_expr); child != nullptr; child = syntax_tree.get_next_sibling(*child))
+                {
+                    syntax_tree.accept(*child, *this);
+                }
+            }
+
+            void visit_defun_expr(const FlatSyntaxTree&, const FlatExpr&) override
+            {
+            }
+
+            void visit_lambda_expr(const FlatSyntaxTree&, const FlatExpr&) override
+            {
+            }
+
+            std::vector<std::string> lexemes;
+    };
+}
+
+TEST(flat_parser_must_produce_the_same_syntax_trees_as_parser, valid_sources)
+{
+    expect_same_as_scanner_and_parser("");
+    expect_same_as_scanner_and_parser(R"("foo")");
+    expect_same_as_scanner_and_parser(R"("foo" "bar")");
+    expect_same_as_scanner_and_parser("foo");
+    expect_same_as_scanner_and_parser("foo bar");
+    expect_same_as_scanner_and_parser("123");
+    expect_same_as_scanner_and_parser("-123");
+    expect_same_as_scanner_and_parser("1.5 -2.25");
+    expect_same_as_scanner_and_parser("(foo)");
+    expect_same_as_scanner_and_parser("(foo) (bar)");
+    expect_same_as_scanner_and_parser("(foo bar baz)");
+    expect_same_as_scanner_and_parser("(foo (bar baz) qux)");
+    expect_same_as_scanner_and_parser("(foo (bar (baz)))");
+    expect_same_as_scanner_and_parser("(+ 1 2)");
+    expect_same_as_scanner_and_parser("(* pi (* r r))");
+    expect_same_as_scanner_and_parser("((foo bar))");
+    expect_same_as_scanner_and_parser("(defun square (x) (mul x x))\n; comment\n(square 3)");
+    expect_same_as_scanner_and_parser(R"((print "foo, bar" 1,2,3))");
+}
+
+TEST(flat_parser_must_produce_the_same_syntax_trees_as_parser, invalid_sources)
+{
+    expect_same_as_scanner_and_parser("(");
+    expect_same_as_scanner_and_parser(")");
+    expect_same_as_scanner_and_parser("()");
+    expect_same_as_scanner_and_parser("()()");
+    expect_same_as_scanner_and_parser("() () ()");
+    expect_same_as_scanner_and_parser("(foo]");
+    expect_same_as_scanner_and_parser("[foo)");
+    expect_same_as_scanner_and_parser("{foo)");
+    expect_same_as_scanner_and_parser("(foo}");
+    expect_same_as_scanner_and_parser("(1 2)");
+    expect_same_as_scanner_and_parser("('foo)");
+    expect_same_as_scanner_and_parser("1-2");
+    expect_same_as_scanner_and_parser(R"("foo)");
+}
+
+TEST(flat_parser_lexemes_must_be_views_into_the_source, identifiers_and_strings)
+{
+    const std::string_view source { R"((foo "bar"))" };
+    const FlatParser flat_parser(source);
+    ASSERT_TRUE(flat_parser.get_is_success());
+
+    const FlatSyntaxTree& flat_syntax_tree = flat_parser.get_syntax_tree();
+    ASSERT_EQ(flat_syntax_tree.size(), 1);
+    ASSERT_EQ(flat_syntax_tree.get_number_of_nodes(), 2);
+
+    const FlatExpr& foo = flat_syntax_tree.at(0);
+    ASSERT_EQ(foo.lexeme.data(), source.data() + 1);
+    const FlatExpr& bar = flat_syntax_tree.at(foo, 0);
+    ASSERT_EQ(bar.lexeme, "bar");
+    ASSERT_EQ(bar.lexeme.data(), source.data() + 6);
+}
+
+TEST(flat_parser_must_decode_escape_sequences, newline_tab_backslash_and_double_quote)
+{
+    const std::string_view source { R"("a\nb\tc\\d\"e")" };
+    const FlatParser flat_parser(source);
+    ASSERT_TRUE(flat_parser.get_is_success());
+
+    const FlatSyntaxTree& flat_syntax_tree = flat_parser.get_syntax_tree();
+    ASSERT_EQ(flat_syntax_tree.size(), 1);
+    ASSERT_EQ(flat_syntax_tree.at(0).lexeme, "a\nb\tc\\d\"e");
+
+    expect_same_as_scanner_and_parser(source);
+}
+
+TEST(flat_syntax_tree_must_be_visitable, nested_function_calls)
+{
+    const FlatParser flat_parser("(foo (bar 1 \"baz\") qux)");
+    ASSERT_TRUE(flat_parser.get_is_success());
+
+    LexemeCollector lexeme_collector;
+    const FlatSyntaxTree& flat_syntax_tree = flat_parser.get_syntax_tree();
+    flat_syntax_tree.accept(flat_syntax_tree.at(0), lexeme_collector);
+
+    const std::vector<std::string> expected { "call foo", "call bar", "literal 1", "literal baz", "identifier qux" };
+    ASSERT_EQ(lexeme_collector.lexemes, expected);
+}
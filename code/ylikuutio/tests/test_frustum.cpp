@@ -0,0 +1,107 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/geometry/aabb.hpp"
+#include "code/ylikuutio/geometry/frustum.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+#ifndef __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#define __GLM_GTC_MATRIX_TRANSFORM_HPP_INCLUDED
+#include <glm/gtc/matrix_transform.hpp>
+#endif
+
+namespace
+{
+    // Camera at origin looking towards negative z, near 1.0, far 100.0.
+    yli::geometry::Frustum make_frustum()
+    {
+        const glm::mat4 projection_matrix = glm::perspective(glm::radians(90.0f), 1.0f, 1.0f, 100.0f);
+        const glm::mat4 view_matrix = glm::lookAt(
+                glm::vec3(0.0f, 0.0f, 0.0f),
+                glm::vec3(0.0f, 0.0f, -1.0f),
+                glm::vec3(0.0f, 1.0f, 0.0f));
+        return yli::geometry::Frustum(projection_matrix * view_matrix);
+    }
+}
+
+TEST(frustum_must_be_defined_as_expected, planes_are_normalized)
+{
+    const yli::geometry::Frustum frustum = make_frustum();
+
+    for (const glm::vec4& plane : frustum.planes)
+    {
+        ASSERT_NEAR(glm::length(glm::vec3(plane)), 1.0f, 1e-5f);
+    }
+}
+
+TEST(frustum_must_intersect_as_expected, aabb_in_front_of_camera)
+{
+    const yli::geometry::Frustum frustum = make_frustum();
+    const yli::geometry::Aabb aabb(glm::vec3(-1.0f, -1.0f, -11.0f), glm::vec3(1.0f, 1.0f, -9.0f));
+    ASSERT_TRUE(frustum.intersects(aabb));
+    ASSERT_TRUE(frustum.contains(aabb));
+}
+
+TEST(frustum_must_intersect_as_expected, aabb_behind_camera)
+{
+    const yli::geometry::Frustum frustum = make_frustum();
+    const yli::geometry::Aabb aabb(glm::vec3(-1.0f, -1.0f, 9.0f), glm::vec3(1.0f, 1.0f, 11.0f));
+    ASSERT_FALSE(frustum.intersects(aabb));
+    ASSERT_FALSE(frustum.contains(aabb));
+}
+
+TEST(frustum_must_intersect_as_expected, aabb_beyond_far_plane)
+{
+    const yli::geometry::Frustum frustum = make_frustum();
+    const yli::geometry::Aabb aabb(glm::vec3(-1.0f, -1.0f, -120.0f), glm::vec3(1.0f, 1.0f, -110.0f));
+    ASSERT_FALSE(frustum.intersects(aabb));
+}
+
+TEST(frustum_must_intersect_as_expected, aabb_left_of_frustum)
+{
+    const yli::geometry::Frustum frustum = make_frustum();
+    const yli::geometry::Aabb aabb(glm::vec3(-30.0f, -1.0f, -11.0f), glm::vec3(-20.0f, 1.0f, -9.0f));
+    ASSERT_FALSE(frustum.intersects(aabb));
+}
+
+TEST(frustum_must_intersect_as_expected, aabb_straddling_left_plane)
+{
+    const yli::geometry::Frustum frustum = make_frustum();
+    const yli::geometry::Aabb aabb(glm::vec3(-12.0f, -1.0f, -11.0f), glm::vec3(-8.0f, 1.0f, -9.0f));
+    ASSERT_TRUE(frustum.intersects(aabb));
+    ASSERT_FALSE(frustum.contains(aabb));
+}
+
+TEST(frustum_must_intersect_as_expected, empty_aabb)
+{
+    const yli::geometry::Frustum frustum = make_frustum();
+    ASSERT_FALSE(frustum.intersects(yli::geometry::Aabb()));
+}
+
+TEST(frustum_must_intersect_as_expected, spheres)
+{
+    const yli::geometry::Frustum frustum = make_frustum();
+    ASSERT_TRUE(frustum.intersects_sphere(glm::vec3(0.0f, 0.0f, -50.0f), 1.0f));
+    ASSERT_FALSE(frustum.intersects_sphere(glm::vec3(0.0f, 0.0f, 50.0f), 1.0f));
+    ASSERT_TRUE(frustum.intersects_sphere(glm::vec3(0.0f, 0.0f, 1.0f), 2.5f));
+}
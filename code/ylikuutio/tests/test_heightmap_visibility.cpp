@@ -0,0 +1,246 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "gtest/gtest.h"
+#include "code/ylikuutio/geometry/heightmap_visibility.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::max, std::min
+#include <cmath>     // std::cos, std::isnan, std::sin
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint8_t, std::uint32_t
+#include <random>    // std::mt19937, std::uniform_real_distribution
+#include <stdexcept> // std::runtime_error
+#include <vector>    // std::vector
+
+namespace
+{
+    constexpr std::uint32_t width { 33 };
+    constexpr std::uint32_t height { 29 };
+    const glm::vec2 origin { -10.0f, 5.0f };
+    const glm::vec2 spacing { 2.0f, 3.0f };
+
+    std::vector<float> create_hills()
+    {
+        std::vector<float> altitudes;
+
+        for (std::uint32_t j = 0; j < height; j++)
+        {
+            for (std::uint32_t i = 0; i < width; i++)
+            {
+                altitudes.emplace_back(10.0f * std::sin(0.4f * static_cast<float>(i)) * std::cos(0.3f * static_cast<float>(j)) + 0.5f * static_cast<float>(i % 3));
+            }
+        }
+
+        return altitudes;
+    }
+
+    // The lowest clearance of the segment above the terrain, by dense sampling.
+    float get_sampled_clearance(const yli::geometry::HeightmapVisibility& heightmap_visibility, const glm::vec3& from, const glm::vec3& to)
+    {
+        constexpr std::size_t n_samples { 4000 };
+        float clearance = 1e9f;
+
+        for (std::size_t sample_i = 0; sample_i <= n_samples; sample_i++)
+        {
+            const float t = static_cast<float>(sample_i) / static_cast<float>(n_samples);
+            const glm::vec3 point = from + t * (to - from);
+            const float altitude = heightmap_visibility.get_altitude(point.x, point.z);
+
+            if (!std::isnan(altitude))
+            {
+                clearance = std::min(clearance, point.y - altitude);
+            }
+        }
+
+        return clearance;
+    }
+}
+
+TEST(heightmap_visibility_must_be_initialized_appropriately, pyramid)
+{
+    yli::geometry::HeightmapVisibility heightmap_visibility(create_hills(), width, height, origin, spacing);
+    ASSERT_EQ(heightmap_visibility.get_width(), width);
+    ASSERT_EQ(heightmap_visibility.get_height(), height);
+
+    // 32 x 28 quads: 6 levels, down to 1 x 1.
+    ASSERT_EQ(heightmap_visibility.get_number_of_levels(), 6);
+
+    const std::vector<float> altitudes = create_hills();
+    float max_altitude = altitudes.front();
+
+    for (const float altitude : altitudes)
+    {
+        max_altitude = std::max(max_altitude, altitude);
+    }
+
+    ASSERT_EQ(heightmap_visibility.get_max_altitude(5, 0, 0), max_altitude);
+    ASSERT_EQ(heightmap_visibility.get_max_altitude(0, 0, 0), std::max(std::max(altitudes[0], altitudes[1]), std::max(altitudes[width], altitudes[width + 1])));
+
+    ASSERT_FLOAT_EQ(heightmap_visibility.get_altitude(origin.x + 4.0f * spacing.x, origin.y + 3.0f * spacing.y), altitudes[3 * width + 4]);
+    ASSERT_TRUE(std::isnan(heightmap_visibility.get_altitude(origin.x - 1.0f, origin.y)));
+}
+
+TEST(heightmap_visibility_must_be_initialized_appropriately, invalid_heightmaps)
+{
+    ASSERT_THROW(yli::geometry::HeightmapVisibility(std::vector<float>(3, 0.0f), 3, 1), std::runtime_error);
+    ASSERT_THROW(yli::geometry::HeightmapVisibility(std::vector<float>(5, 0.0f), 2, 2), std::runtime_error);
+    ASSERT_THROW(yli::geometry::HeightmapVisibility(std::vector<float>(4, 0.0f), 2, 2, glm::vec2(0.0f, 0.0f), glm::vec2(0.0f, 1.0f)), std::runtime_error);
+}
+
+TEST(heightmap_visibility_must_work_appropriately, ridge_blocks_line_of_sight)
+{
+    // Flat terrain at altitude 0 with a ridge of altitude 10 at x = 5.
+    std::vector<float> altitudes(11 * 11, 0.0f);
+
+    for (std::uint32_t j = 0; j < 11; j++)
+    {
+        altitudes[j * 11 + 5] = 10.0f;
+    }
+
+    yli::geometry::HeightmapVisibility heightmap_visibility(std::move(altitudes), 11, 11);
+
+    ASSERT_FALSE(heightmap_visibility.is_line_of_sight(glm::vec3(1.0f, 2.0f, 5.0f), glm::vec3(9.0f, 2.0f, 5.0f)));
+    ASSERT_TRUE(heightmap_visibility.is_line_of_sight(glm::vec3(1.0f, 11.0f, 5.0f), glm::vec3(9.0f, 11.0f, 5.0f)));
+    ASSERT_TRUE(heightmap_visibility.is_line_of_sight(glm::vec3(1.0f, 2.0f, 5.0f), glm::vec3(4.0f, 0.0f, 8.0f)));
+
+    // Along the ground, and around the grid.
+    ASSERT_TRUE(heightmap_visibility.is_line_of_sight(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(4.0f, 0.0f, 10.0f)));
+    ASSERT_TRUE(heightmap_visibility.is_line_of_sight(glm::vec3(-5.0f, 2.0f, -5.0f), glm::vec3(15.0f, 2.0f, -5.0f)));
+
+    // Grazing the top of the ridge does not block.
+    ASSERT_TRUE(heightmap_visibility.is_line_of_sight(glm::vec3(0.0f, 10.0f, 5.0f), glm::vec3(10.0f, 10.0f, 5.0f)));
+
+    const yli::geometry::Viewshed viewshed = heightmap_visibility.compute_viewshed(glm::vec3(0.0f, 5.0f, 5.0f));
+    ASSERT_FLOAT_EQ(viewshed.get_min_visible_altitude(3, 5), 0.0f);
+    ASSERT_FLOAT_EQ(viewshed.get_min_visible_altitude(10, 5), 15.0f);
+    ASSERT_TRUE(viewshed.is_visible(glm::vec3(3.0f, 0.0f, 5.0f)));
+    ASSERT_FALSE(viewshed.is_visible(glm::vec3(10.0f, 14.0f, 5.0f)));
+    ASSERT_TRUE(viewshed.is_visible(glm::vec3(10.0f, 15.5f, 5.0f)));
+    ASSERT_TRUE(viewshed.is_visible(glm::vec3(20.0f, 0.0f, 5.0f)));
+}
+
+TEST(heightmap_visibility_must_work_appropriately, random_rays_match_sampling)
+{
+    yli::geometry::HeightmapVisibility heightmap_visibility(create_hills(), width, height, origin, spacing);
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> x_distribution(origin.x - 10.0f, origin.x + spacing.x * (width - 1) + 10.0f);
+    std::uniform_real_distribution<float> y_distribution(-12.0f, 16.0f);
+    std::uniform_real_distribution<float> z_distribution(origin.y - 10.0f, origin.y + spacing.y * (height - 1) + 10.0f);
+
+    std::vector<glm::vec3> from;
+    std::vector<glm::vec3> to;
+    std::vector<bool> expected;
+
+    while (from.size() < 1000)
+    {
+        const glm::vec3 ray_from(x_distribution(generator), y_distribution(generator), z_distribution(generator));
+        const glm::vec3 ray_to(x_distribution(generator), y_distribution(generator), z_distribution(generator));
+        const float clearance = get_sampled_clearance(heightmap_visibility, ray_from, ray_to);
+
+        // Skip the rays too close to the terrain for the sampling to decide.
+        if (clearance > -0.05f && clearance < 0.05f)
+        {
+            continue;
+        }
+
+        from.emplace_back(ray_from);
+        to.emplace_back(ray_to);
+        expected.emplace_back(clearance > 0.0f);
+    }
+
+    std::vector<std::uint8_t> results(from.size(), 2);
+    heightmap_visibility.are_lines_of_sight(from.data(), to.data(), from.size(), results.data());
+
+    std::size_t n_visible = 0;
+
+    for (std::size_t ray_i = 0; ray_i < from.size(); ray_i++)
+    {
+        ASSERT_EQ(heightmap_visibility.is_line_of_sight(from[ray_i], to[ray_i]), expected[ray_i]) << "ray " << ray_i;
+        ASSERT_EQ(results[ray_i], expected[ray_i] ? 1 : 0) << "ray " << ray_i;
+        n_visible += (expected[ray_i] ? 1 : 0);
+    }
+
+    // Both outcomes are covered.
+    ASSERT_GT(n_visible, 100);
+    ASSERT_LT(n_visible, 900);
+}
+
+TEST(heightmap_visibility_must_work_appropriately, batched_queries_match_single_queries)
+{
+    yli::geometry::HeightmapVisibility heightmap_visibility(create_hills(), width, height, origin, spacing);
+    std::mt19937 generator(4);
+    std::uniform_real_distribution<float> x_distribution(origin.x - 10.0f, origin.x + 80.0f);
+    std::uniform_real_distribution<float> y_distribution(-12.0f, 14.0f);
+    std::uniform_real_distribution<float> z_distribution(origin.y - 10.0f, origin.y + 100.0f);
+
+    std::vector<glm::vec3> from;
+    std::vector<glm::vec3> to;
+
+    for (std::size_t ray_i = 0; ray_i < 5000; ray_i++)
+    {
+        from.emplace_back(x_distribution(generator), y_distribution(generator), z_distribution(generator));
+
+        if (ray_i % 50 == 0)
+        {
+            // Vertical segments.
+            to.emplace_back(from.back().x, y_distribution(generator), from.back().z);
+        }
+        else
+        {
+            to.emplace_back(x_distribution(generator), y_distribution(generator), z_distribution(generator));
+        }
+    }
+
+    std::vector<std::uint8_t> results(from.size(), 2);
+    heightmap_visibility.are_lines_of_sight(from.data(), to.data(), from.size(), results.data());
+
+    for (std::size_t ray_i = 0; ray_i < from.size(); ray_i++)
+    {
+        ASSERT_EQ(results[ray_i], heightmap_visibility.is_line_of_sight(from[ray_i], to[ray_i]) ? 1 : 0) << "ray " << ray_i;
+    }
+}
+
+TEST(heightmap_visibility_must_work_appropriately, viewshed_matches_line_of_sight)
+{
+    yli::geometry::HeightmapVisibility heightmap_visibility(create_hills(), width, height, origin, spacing);
+    const glm::vec3 observer(origin.x + 31.0f, 12.0f, origin.y + 40.0f);
+    const yli::geometry::Viewshed viewshed = heightmap_visibility.compute_viewshed(observer);
+    ASSERT_FALSE(viewshed.empty());
+
+    for (std::uint32_t j = 0; j < height; j++)
+    {
+        for (std::uint32_t i = 0; i < width; i++)
+        {
+            const float min_visible_altitude = viewshed.get_min_visible_altitude(i, j);
+            const float x = origin.x + spacing.x * static_cast<float>(i);
+            const float z = origin.y + spacing.y * static_cast<float>(j);
+            ASSERT_GE(min_visible_altitude, heightmap_visibility.get_altitude(x, z) - 1e-4f);
+
+            ASSERT_FALSE(heightmap_visibility.is_line_of_sight(observer, glm::vec3(x, min_visible_altitude - 0.05f, z))) << i << ", " << j;
+            ASSERT_TRUE(heightmap_visibility.is_line_of_sight(observer, glm::vec3(x, min_visible_altitude + 0.05f, z))) << i << ", " << j;
+            ASSERT_FALSE(viewshed.is_visible(glm::vec3(x, min_visible_altitude - 0.05f, z)));
+            ASSERT_TRUE(viewshed.is_visible(glm::vec3(x, min_visible_altitude + 0.05f, z)));
+        }
+    }
+}
@@ -22,16 +22,30 @@
 #include "code/ylikuutio/ontology/pipeline.hpp"
 #include "code/ylikuutio/ontology/symbiosis.hpp"
 #include "code/ylikuutio/ontology/holobiont.hpp"
+#include "code/ylikuutio/ontology/biont.hpp"
+#include "code/ylikuutio/ontology/cartesian_coordinates_module.hpp"
+#include "code/ylikuutio/ontology/symbiont_material.hpp"
+#include "code/ylikuutio/ontology/symbiont_species.hpp"
 #include "code/ylikuutio/ontology/request.hpp"
 #include "code/ylikuutio/ontology/scene_struct.hpp"
 #include "code/ylikuutio/ontology/pipeline_struct.hpp"
 #include "code/ylikuutio/ontology/symbiosis_struct.hpp"
 #include "code/ylikuutio/ontology/holobiont_struct.hpp"
+#include "code/ylikuutio/ontology/biont_struct.hpp"
+#include "code/ylikuutio/ontology/symbiont_material_struct.hpp"
+#include "code/ylikuutio/ontology/symbiont_species_struct.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
 
 // Include standard headers
 #include <cstdint> // uintptr_t
 #include <cstddef> // std::size_t
 #include <limits>  // std::numeric_limits
+#include <vector>  // std::vector
 
 namespace yli::ontology
 {
@@ -244,3 +258,146 @@ TEST(adding_skills_to_holobiont_must_work_properly, headless_turbo_polizei)
     ASSERT_EQ(holobiont->get_parent(), scene);
     ASSERT_EQ(holobiont->get_number_of_non_variable_children(), 6);     // 5 `Biont`s and 1 `Skill`.
 }
+
+TEST(bionts_of_holobionts_must_be_collected_by_symbiont_species, headless_two_holobionts_two_symbiont_species)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(scene) };
+    yli::ontology::Pipeline* const pipeline = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+
+    yli::ontology::SymbiosisStruct symbiosis_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(pipeline) };
+    yli::ontology::Symbiosis* const symbiosis = application.get_generic_entity_factory().create_symbiosis(
+            symbiosis_struct);
+
+    yli::ontology::SymbiontMaterialStruct symbiont_material_struct { yli::ontology::Request(symbiosis) };
+    yli::ontology::SymbiontMaterial* const symbiont_material = application.get_generic_entity_factory().create_symbiont_material(
+            symbiont_material_struct);
+
+    yli::ontology::SymbiontSpeciesStruct body_species_struct { yli::ontology::Request(symbiont_material) };
+    yli::ontology::SymbiontSpecies* const body_species = application.get_generic_entity_factory().create_symbiont_species(
+            body_species_struct);
+    yli::ontology::SymbiontSpeciesStruct wheel_species_struct { yli::ontology::Request(symbiont_material) };
+    yli::ontology::SymbiontSpecies* const wheel_species = application.get_generic_entity_factory().create_symbiont_species(
+            wheel_species_struct);
+
+    std::vector<yli::ontology::Holobiont*> holobionts;
+
+    for (std::size_t holobiont_i = 0; holobiont_i < 2; holobiont_i++)
+    {
+        yli::ontology::HolobiontStruct holobiont_struct {
+                yli::ontology::Request(scene),
+                yli::ontology::Request(symbiosis) };
+        holobiont_struct.cartesian_coordinates = yli::ontology::CartesianCoordinatesModule(10.0f * holobiont_i, 0.0f, 0.0f);
+        yli::ontology::Holobiont* const holobiont = application.get_generic_entity_factory().create_holobiont(
+                holobiont_struct);
+        holobiont->should_render = true; // Headless `Entity`s are not rendered by default.
+        holobionts.push_back(holobiont);
+
+        yli::ontology::BiontStruct body_struct {
+                yli::ontology::Request(holobiont),
+                yli::ontology::Request(scene),
+                yli::ontology::Request(body_species) };
+        application.get_generic_entity_factory().create_biont(body_struct);
+
+        yli::ontology::BiontStruct wheel_struct {
+                yli::ontology::Request(holobiont),
+                yli::ontology::Request(scene),
+                yli::ontology::Request(wheel_species) };
+        wheel_struct.local_offset = glm::vec3(1.0f, -0.5f, 2.0f);
+        yli::ontology::Biont* const wheel = application.get_generic_entity_factory().create_biont(wheel_struct);
+        ASSERT_EQ(wheel->get_local_offset(), glm::vec3(1.0f, -0.5f, 2.0f));
+    }
+
+    ASSERT_EQ(symbiosis->collect_biont_instances(scene), 4);
+    ASSERT_EQ(body_species->biont_instances.size(), 2);
+    ASSERT_EQ(wheel_species->biont_instances.size(), 2);
+    ASSERT_EQ(body_species->biont_instances.get_model_matrices()[0][3], glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+    ASSERT_EQ(body_species->biont_instances.get_model_matrices()[1][3], glm::vec4(10.0f, 0.0f, 0.0f, 1.0f));
+    ASSERT_EQ(wheel_species->biont_instances.get_model_matrices()[0][3], glm::vec4(1.0f, -0.5f, 2.0f, 1.0f));
+    ASSERT_EQ(wheel_species->biont_instances.get_model_matrices()[1][3], glm::vec4(11.0f, -0.5f, 2.0f, 1.0f));
+
+    // Moving a `Holobiont` moves its `Biont`s on the next frame.
+    holobionts[1]->update_y(5.0f);
+    holobionts[1]->set_scale(2.0f);
+    ASSERT_EQ(symbiosis->collect_biont_instances(scene), 4);
+    ASSERT_EQ(body_species->biont_instances.get_model_matrices()[1][3], glm::vec4(10.0f, 5.0f, 0.0f, 1.0f));
+    ASSERT_EQ(wheel_species->biont_instances.get_model_matrices()[1][3], glm::vec4(12.0f, 4.0f, 4.0f, 1.0f));
+
+    // `Holobiont`s that are not rendered are not collected.
+    holobionts[0]->should_render = false;
+    ASSERT_EQ(symbiosis->collect_biont_instances(scene), 2);
+    ASSERT_EQ(body_species->biont_instances.size(), 1);
+    ASSERT_EQ(wheel_species->biont_instances.size(), 1);
+}
+
+TEST(holobionts_and_bionts_must_be_created_in_bulk_appropriately, headless_two_holobionts_two_symbiont_species)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(scene) };
+    yli::ontology::Pipeline* const pipeline = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+
+    yli::ontology::SymbiosisStruct symbiosis_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(pipeline) };
+    yli::ontology::Symbiosis* const symbiosis = application.get_generic_entity_factory().create_symbiosis(
+            symbiosis_struct);
+
+    yli::ontology::SymbiontMaterialStruct symbiont_material_struct { yli::ontology::Request(symbiosis) };
+    yli::ontology::SymbiontMaterial* const symbiont_material = application.get_generic_entity_factory().create_symbiont_material(
+            symbiont_material_struct);
+
+    yli::ontology::SymbiontSpeciesStruct body_species_struct { yli::ontology::Request(symbiont_material) };
+    yli::ontology::SymbiontSpecies* const body_species = application.get_generic_entity_factory().create_symbiont_species(
+            body_species_struct);
+    yli::ontology::SymbiontSpeciesStruct wheel_species_struct { yli::ontology::Request(symbiont_material) };
+    yli::ontology::SymbiontSpecies* const wheel_species = application.get_generic_entity_factory().create_symbiont_species(
+            wheel_species_struct);
+
+    const std::vector<yli::ontology::HolobiontStruct> holobiont_structs(
+            2,
+            yli::ontology::HolobiontStruct { yli::ontology::Request(scene), yli::ontology::Request(symbiosis) });
+    const std::vector<yli::ontology::Holobiont*> holobionts = application.get_generic_entity_factory().create_holobionts(
+            holobiont_structs);
+    ASSERT_EQ(holobionts.size(), 2);
+    ASSERT_EQ(scene->get_number_of_non_variable_children(), 5); // Default `Camera`, `pipeline`, `symbiosis`, 2 `Holobiont`s.
+
+    std::vector<yli::ontology::BiontStruct> biont_structs;
+
+    for (yli::ontology::Holobiont* const holobiont : holobionts)
+    {
+        holobiont->should_render = true; // Headless `Entity`s are not rendered by default.
+
+        for (yli::ontology::SymbiontSpecies* const symbiont_species : { body_species, wheel_species })
+        {
+            biont_structs.emplace_back(
+                    yli::ontology::Request(holobiont),
+                    yli::ontology::Request(scene),
+                    yli::ontology::Request(symbiont_species));
+        }
+    }
+
+    const std::vector<yli::ontology::Biont*> bionts = application.get_generic_entity_factory().create_bionts(
+            biont_structs);
+    ASSERT_EQ(bionts.size(), 4);
+    ASSERT_EQ(bionts[2]->get_parent(), holobionts[1]);
+    ASSERT_EQ(holobionts[0]->get_number_of_non_variable_children(), 2);
+    ASSERT_EQ(holobionts[1]->get_number_of_non_variable_children(), 2);
+    ASSERT_EQ(symbiosis->collect_biont_instances(scene), 4);
+
+    // The `Variable`s are created on first use.
+    ASSERT_EQ(bionts[3]->parent_of_variables.get_number_of_children(), 0);
+    ASSERT_TRUE(bionts[3]->has_variable("z"));
+    ASSERT_TRUE(holobionts[1]->has_variable("should_render"));
+}
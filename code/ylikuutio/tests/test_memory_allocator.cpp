@@ -18,9 +18,82 @@
 #include "gtest/gtest.h"
 #include "code/ylikuutio/data/datatype.hpp"
 #include "code/ylikuutio/memory/memory_allocator.hpp"
+#include "code/ylikuutio/memory/constructible_module.hpp"
+
+// Include standard headers
+#include <cstddef> // std::size_t
+
+namespace
+{
+    struct Foo
+    {
+        yli::memory::ConstructibleModule constructible_module;
+    };
+}
 
 TEST(memory_allocator_must_be_initialized_appropriately, default_memory_allocator_universe_datatype)
 {
     yli::memory::MemoryAllocator memory_allocator(yli::data::Datatype::UNIVERSE);
     ASSERT_EQ(memory_allocator.get_datatype(), yli::data::Datatype::UNIVERSE);
 }
+
+TEST(memory_allocator_must_create_storages_appropriately, build_in_fills_storages_in_order)
+{
+    yli::memory::MemoryAllocator<Foo, 4> memory_allocator(yli::data::Datatype::UNIVERSE);
+
+    for (std::size_t i = 0; i < 9; i++)
+    {
+        Foo* const foo = memory_allocator.build_in();
+        ASSERT_EQ(foo->constructible_module.storage_i, i / 4);
+        ASSERT_EQ(foo->constructible_module.slot_i, i % 4);
+    }
+
+    ASSERT_EQ(memory_allocator.get_number_of_storages(), 3);
+    ASSERT_EQ(memory_allocator.get_number_of_instances(), 9);
+}
+
+TEST(memory_allocator_must_create_storages_appropriately, build_in_reuses_freed_slot_of_full_storage)
+{
+    yli::memory::MemoryAllocator<Foo, 4> memory_allocator(yli::data::Datatype::UNIVERSE);
+
+    Foo* second_foo { nullptr };
+
+    for (std::size_t i = 0; i < 8; i++)
+    {
+        Foo* const foo = memory_allocator.build_in();
+
+        if (i == 1)
+        {
+            second_foo = foo;
+        }
+    }
+
+    memory_allocator.destroy(second_foo->constructible_module);
+    ASSERT_EQ(memory_allocator.get_number_of_instances(), 7);
+
+    Foo* const foo = memory_allocator.build_in();
+    ASSERT_EQ(foo->constructible_module.storage_i, 0);
+    ASSERT_EQ(foo->constructible_module.slot_i, 1);
+    ASSERT_EQ(memory_allocator.get_number_of_storages(), 2);
+}
+
+TEST(memory_allocator_must_create_storages_appropriately, reserve_creates_storages_up_front)
+{
+    yli::memory::MemoryAllocator<Foo, 4> memory_allocator(yli::data::Datatype::UNIVERSE);
+    memory_allocator.build_in();
+
+    memory_allocator.reserve(8);
+    ASSERT_EQ(memory_allocator.get_number_of_storages(), 3);
+    ASSERT_EQ(memory_allocator.get_number_of_instances(), 1);
+
+    memory_allocator.reserve(3);
+    ASSERT_EQ(memory_allocator.get_number_of_storages(), 3);
+
+    for (std::size_t i = 0; i < 8; i++)
+    {
+        memory_allocator.build_in();
+    }
+
+    ASSERT_EQ(memory_allocator.get_number_of_storages(), 3);
+    ASSERT_EQ(memory_allocator.get_number_of_instances(), 9);
+}
@@ -0,0 +1,96 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/load/mipmap_generator.hpp"
+#include "code/ylikuutio/load/texture_data.hpp"
+
+// Include standard headers
+#include <cstdint>  // std::uint8_t
+#include <vector>   // std::vector
+
+TEST(mip_chain_must_be_generated_appropriately, invalid_image_data)
+{
+    const std::vector<std::uint8_t> image_data { 1, 2, 3 };
+    ASSERT_TRUE(yli::load::generate_mip_chain(image_data, 2, 2, 3).empty());
+    ASSERT_TRUE(yli::load::generate_mip_chain(image_data, 0, 1, 3).empty());
+}
+
+TEST(mip_chain_must_be_generated_appropriately, 1x1_rgb)
+{
+    const std::vector<std::uint8_t> image_data { 10, 20, 30 };
+    const std::vector<yli::load::MipLevel> mip_levels = yli::load::generate_mip_chain(image_data, 1, 1, 3);
+    ASSERT_EQ(mip_levels.size(), 1);
+    ASSERT_EQ(mip_levels.at(0).width, 1);
+    ASSERT_EQ(mip_levels.at(0).height, 1);
+    ASSERT_EQ(mip_levels.at(0).data, image_data);
+}
+
+TEST(mip_chain_must_be_generated_appropriately, 2x2_grayscale)
+{
+    const std::vector<std::uint8_t> image_data { 0, 100, 200, 101 };
+    const std::vector<yli::load::MipLevel> mip_levels = yli::load::generate_mip_chain(image_data, 2, 2, 1);
+    ASSERT_EQ(mip_levels.size(), 2);
+    ASSERT_EQ(mip_levels.at(1).width, 1);
+    ASSERT_EQ(mip_levels.at(1).height, 1);
+    ASSERT_EQ(mip_levels.at(1).data, std::vector<std::uint8_t>({ 100 })); // (0 + 100 + 200 + 101 + 2) / 4 = 100.
+}
+
+TEST(mip_chain_must_be_generated_appropriately, 4x2_rgb)
+{
+    // Left half red, right half blue.
+    const std::vector<std::uint8_t> image_data {
+        255, 0, 0, 255, 0, 0, 0, 0, 255, 0, 0, 255,
+        255, 0, 0, 255, 0, 0, 0, 0, 255, 0, 0, 255 };
+    const std::vector<yli::load::MipLevel> mip_levels = yli::load::generate_mip_chain(image_data, 4, 2, 3);
+    ASSERT_EQ(mip_levels.size(), 3);
+
+    ASSERT_EQ(mip_levels.at(1).width, 2);
+    ASSERT_EQ(mip_levels.at(1).height, 1);
+    ASSERT_EQ(mip_levels.at(1).data, std::vector<std::uint8_t>({ 255, 0, 0, 0, 0, 255 }));
+
+    ASSERT_EQ(mip_levels.at(2).width, 1);
+    ASSERT_EQ(mip_levels.at(2).height, 1);
+    ASSERT_EQ(mip_levels.at(2).data, std::vector<std::uint8_t>({ 128, 0, 128 }));
+}
+
+TEST(mip_chain_must_be_generated_appropriately, 3x1_odd_width)
+{
+    const std::vector<std::uint8_t> image_data { 0, 40, 80 };
+    const std::vector<yli::load::MipLevel> mip_levels = yli::load::generate_mip_chain(image_data, 3, 1, 1);
+    ASSERT_EQ(mip_levels.size(), 2);
+    ASSERT_EQ(mip_levels.at(1).width, 1);
+    ASSERT_EQ(mip_levels.at(1).height, 1);
+    ASSERT_EQ(mip_levels.at(1).data, std::vector<std::uint8_t>({ 20 })); // The last column is not used.
+}
+
+TEST(mip_chain_must_be_generated_appropriately, 256x16_rgba)
+{
+    const std::vector<std::uint8_t> image_data(256 * 16 * 4, 7);
+    const std::vector<yli::load::MipLevel> mip_levels = yli::load::generate_mip_chain(image_data, 256, 16, 4);
+    ASSERT_EQ(mip_levels.size(), 9); // 256, 128, 64, 32, 16, 8, 4, 2, 1.
+
+    for (const yli::load::MipLevel& mip_level : mip_levels)
+    {
+        ASSERT_EQ(mip_level.data.size(), mip_level.width * mip_level.height * 4);
+        ASSERT_EQ(mip_level.data.front(), 7);
+        ASSERT_EQ(mip_level.data.back(), 7);
+    }
+
+    ASSERT_EQ(mip_levels.back().width, 1);
+    ASSERT_EQ(mip_levels.back().height, 1);
+}
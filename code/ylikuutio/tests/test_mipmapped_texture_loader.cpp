@@ -0,0 +1,88 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/load/mipmapped_texture_loader.hpp"
+#include "code/ylikuutio/load/texture_container.hpp"
+#include "code/ylikuutio/load/texture_data.hpp"
+#include "code/ylikuutio/load/image_loader_struct.hpp"
+
+// Include standard headers
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint8_t
+#include <filesystem> // std::filesystem
+#include <memory>     // std::shared_ptr
+#include <optional>   // std::optional
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+TEST(mipmapped_texture_must_be_loaded_appropriately, test3x3_png_without_texture_container)
+{
+    const yli::load::ImageLoaderStruct image_loader_struct;
+    const std::shared_ptr<yli::load::TextureData> texture_data = yli::load::load_mipmapped_texture("test3x3.png", image_loader_struct, false);
+    ASSERT_NE(texture_data, nullptr);
+    ASSERT_EQ(texture_data->n_color_channels, 1);
+    ASSERT_EQ(texture_data->mip_levels.size(), 2);
+
+    ASSERT_EQ(texture_data->mip_levels.at(0).width, 3);
+    ASSERT_EQ(texture_data->mip_levels.at(0).height, 3);
+    ASSERT_EQ(texture_data->mip_levels.at(0).data, std::vector<std::uint8_t>({ 32, 64, 128, 4, 8, 16, 0, 1, 2 }));
+
+    ASSERT_EQ(texture_data->mip_levels.at(1).width, 1);
+    ASSERT_EQ(texture_data->mip_levels.at(1).height, 1);
+    ASSERT_EQ(texture_data->mip_levels.at(1).data, std::vector<std::uint8_t>({ 27 })); // (32 + 64 + 4 + 8 + 2) / 4 = 27.
+}
+
+TEST(mipmapped_texture_must_not_be_loaded, nonexistent_file)
+{
+    const yli::load::ImageLoaderStruct image_loader_struct;
+    ASSERT_EQ(yli::load::load_mipmapped_texture("nonexistent.png", image_loader_struct, false), nullptr);
+}
+
+TEST(mipmapped_texture_must_be_loaded_appropriately, test3x3_png_with_texture_container)
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "ylikuutio_test_mipmapped_texture_loader";
+    std::filesystem::create_directories(directory);
+    const std::string image_path = (directory / "test3x3.png").string();
+    std::filesystem::copy_file("test3x3.png", image_path, std::filesystem::copy_options::overwrite_existing);
+
+    const yli::load::ImageLoaderStruct image_loader_struct;
+    const std::string container_path = yli::load::get_texture_container_path(image_path, image_loader_struct);
+    std::filesystem::remove(container_path);
+
+    // Cold load: decode the image and write the texture container.
+    const std::shared_ptr<yli::load::TextureData> decoded_texture_data = yli::load::load_mipmapped_texture(image_path, image_loader_struct, true);
+    ASSERT_NE(decoded_texture_data, nullptr);
+    ASSERT_TRUE(std::filesystem::exists(container_path));
+
+    const std::optional<yli::load::TextureSourceStamp> source_stamp = yli::load::get_texture_source_stamp(image_path);
+    ASSERT_TRUE(source_stamp);
+    ASSERT_TRUE(yli::load::read_texture_container(container_path, *source_stamp));
+
+    // Warm load: read the texture container.
+    const std::shared_ptr<yli::load::TextureData> cached_texture_data = yli::load::load_mipmapped_texture(image_path, image_loader_struct, true);
+    ASSERT_NE(cached_texture_data, nullptr);
+    ASSERT_EQ(cached_texture_data->n_color_channels, decoded_texture_data->n_color_channels);
+    ASSERT_EQ(cached_texture_data->mip_levels.size(), decoded_texture_data->mip_levels.size());
+
+    for (std::size_t i = 0; i < cached_texture_data->mip_levels.size(); i++)
+    {
+        ASSERT_EQ(cached_texture_data->mip_levels.at(i).data, decoded_texture_data->mip_levels.at(i).data);
+    }
+
+    std::filesystem::remove_all(directory);
+}
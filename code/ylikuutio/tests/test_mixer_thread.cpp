@@ -0,0 +1,145 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "gtest/gtest.h"
+#include "code/ylikuutio/audio/mixer_thread.hpp"
+#include "code/ylikuutio/audio/audio_command.hpp"
+#include "code/ylikuutio/audio/audio_output.hpp"
+#include "code/ylikuutio/audio/sound_buffer.hpp"
+
+// Include standard headers
+#include <chrono>  // std::chrono::milliseconds, std::chrono::seconds, std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <limits>  // std::numeric_limits
+#include <span>    // std::span
+#include <thread>  // std::this_thread::sleep_for
+#include <vector>  // std::vector
+
+namespace
+{
+    // Plays nothing: the test decides how many frames are still queued.
+    // After `max_n_frames` frames the output reports itself as full.
+    class RecordingAudioOutput final : public yli::audio::AudioOutput
+    {
+        public:
+            explicit RecordingAudioOutput(const std::size_t max_n_frames)
+                : max_n_frames { max_n_frames }
+            {
+            }
+
+            std::size_t get_n_queued_frames() const override
+            {
+                return (this->samples.size() / 2 >= this->max_n_frames ? std::numeric_limits<std::size_t>::max() : this->n_queued_frames);
+            }
+
+            bool put(std::span<const float> samples) override
+            {
+                this->samples.insert(this->samples.end(), samples.begin(), samples.end());
+                this->n_queued_frames += samples.size() / 2;
+                return true;
+            }
+
+            std::vector<float> samples;
+            std::size_t n_queued_frames { 0 };
+
+        private:
+            const std::size_t max_n_frames;
+    };
+
+    yli::audio::AudioCommand create_play_command(const yli::audio::VoiceId voice_id, const yli::audio::SoundBuffer* const sound_buffer)
+    {
+        yli::audio::AudioCommand command;
+        command.type = yli::audio::AudioCommandType::PLAY_VOICE;
+        command.voice_id = voice_id;
+        command.sound_buffer = sound_buffer;
+        return command;
+    }
+}
+
+TEST(mixer_thread_must_be_initialized_appropriately, not_running)
+{
+    RecordingAudioOutput audio_output(1000000);
+    const yli::audio::MixerThread mixer_thread(audio_output, 8, 64, 256);
+    ASSERT_FALSE(mixer_thread.get_is_running());
+    ASSERT_EQ(mixer_thread.get_software_mixer().get_max_n_voices(), 8);
+    ASSERT_EQ(mixer_thread.get_software_mixer().get_n_playing_voices(), 0);
+}
+
+TEST(mixer_thread_run_once_must_work_properly, output_is_kept_filled_to_target_latency)
+{
+    RecordingAudioOutput audio_output(1000000);
+    yli::audio::MixerThread mixer_thread(audio_output, 8, 64, 256);
+
+    yli::audio::SoundBuffer sound_buffer;
+    sound_buffer.samples.assign(2 * 100, 0.5f);
+    ASSERT_TRUE(mixer_thread.push_command(create_play_command(1, &sound_buffer)));
+
+    ASSERT_EQ(mixer_thread.run_once(), 256);
+    ASSERT_EQ(audio_output.samples.size(), 2 * 256);
+    ASSERT_FLOAT_EQ(audio_output.samples[2 * 99], 0.5f);
+    ASSERT_FLOAT_EQ(audio_output.samples[2 * 100], 0.0f);
+
+    yli::audio::AudioEvent event;
+    ASSERT_TRUE(mixer_thread.pop_event(event));
+    ASSERT_EQ(event.voice_id, 1);
+
+    // Nothing is mixed while the output queue is at the target.
+    ASSERT_EQ(mixer_thread.run_once(), 0);
+
+    // Only what has been played is replaced.
+    audio_output.n_queued_frames -= 100;
+    ASSERT_EQ(mixer_thread.run_once(), 128);
+}
+
+TEST(mixer_thread_must_work_properly, voice_is_played_and_reported_as_finished_by_the_audio_thread)
+{
+    RecordingAudioOutput audio_output(4096);
+    yli::audio::MixerThread mixer_thread(audio_output, 8, 64, 1000000);
+
+    yli::audio::SoundBuffer sound_buffer;
+    sound_buffer.samples.assign(2 * 100, 0.5f);
+
+    // The command is pushed first, so that the voice is not
+    // started after the output has already been filled.
+    ASSERT_TRUE(mixer_thread.push_command(create_play_command(1, &sound_buffer)));
+    mixer_thread.start();
+    ASSERT_TRUE(mixer_thread.get_is_running());
+
+    yli::audio::AudioEvent event;
+    bool is_finished = false;
+    const auto start_time = std::chrono::steady_clock::now();
+
+    while (!is_finished && std::chrono::steady_clock::now() - start_time < std::chrono::seconds(10))
+    {
+        is_finished = mixer_thread.pop_event(event);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    mixer_thread.stop();
+    ASSERT_FALSE(mixer_thread.get_is_running());
+    ASSERT_TRUE(is_finished);
+    ASSERT_EQ(event.voice_id, 1);
+    ASSERT_GE(audio_output.samples.size(), 2 * 4096);
+
+    std::size_t n_nonzero_frames = 0;
+
+    for (std::size_t frame_i = 0; frame_i < audio_output.samples.size() / 2; frame_i++)
+    {
+        n_nonzero_frames += (audio_output.samples[2 * frame_i] != 0.0f ? 1 : 0);
+    }
+
+    ASSERT_EQ(n_nonzero_frames, 100);
+}
@@ -0,0 +1,158 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "gtest/gtest.h"
+#include "code/ylikuutio/animation/morph_animation.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <stdexcept> // std::runtime_error
+#include <vector>    // std::vector
+
+static void assert_phase(
+        const yli::animation::MorphPhase& phase,
+        const std::uint32_t current_form,
+        const std::uint32_t next_form,
+        const float blend)
+{
+    ASSERT_EQ(phase.current_form, current_form);
+    ASSERT_EQ(phase.next_form, next_form);
+    ASSERT_NEAR(phase.blend, blend, 1e-5f);
+}
+
+TEST(morph_phase_must_be_computed_appropriately, repeating_without_bouncing)
+{
+    yli::animation::MorphPlayback playback;
+    playback.speed = 2.0f;
+    playback.initial_offset = 1;
+
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 0.0), 1, 2, 0.0f);
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 0.25), 1, 2, 0.5f);
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 1.25), 3, 0, 0.5f); // The last form blends into the first one.
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 2.25), 1, 2, 0.5f);
+
+    playback.speed = -2.0f;
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 0.75), 3, 0, 0.5f);
+}
+
+TEST(morph_phase_must_be_computed_appropriately, non_repeating_without_bouncing)
+{
+    yli::animation::MorphPlayback playback;
+    playback.speed = 1.0f;
+    playback.is_repeating = false;
+
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 1.5), 1, 2, 0.5f);
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 10.0), 3, 3, 0.0f);
+}
+
+TEST(morph_phase_must_be_computed_appropriately, bouncing_from_start_and_end)
+{
+    yli::animation::MorphPlayback playback;
+    playback.speed = 1.0f;
+    playback.bounce_from_start = true;
+    playback.bounce_from_end = true;
+
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 2.5), 2, 3, 0.5f);
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 3.5), 2, 3, 0.5f); // On the way back from the end.
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 5.5), 0, 1, 0.5f);
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 6.5), 0, 1, 0.5f); // On the way again from the start.
+}
+
+TEST(morph_phase_must_be_computed_appropriately, bouncing_from_end_only)
+{
+    yli::animation::MorphPlayback playback;
+    playback.speed = 1.0f;
+    playback.initial_offset = 1;
+    playback.bounce_from_end = true;
+
+    // 2 forms to the end, 3 back to the start, then again from `initial_offset`.
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 2.5), 2, 3, 0.5f);
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 4.5), 0, 1, 0.5f);
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 5.5), 1, 2, 0.5f);
+
+    playback.is_repeating = false;
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 5.5), 0, 1, 0.0f);
+}
+
+TEST(morph_phase_must_be_computed_appropriately, no_forms_or_no_speed)
+{
+    yli::animation::MorphPlayback playback;
+    playback.initial_offset = 10;
+
+    assert_phase(yli::animation::get_morph_phase(playback, 0, 1.0), 0, 0, 0.0f);
+    assert_phase(yli::animation::get_morph_phase(playback, 4, 1.0), 3, 3, 0.0f);
+}
+
+TEST(morph_target_buffer_must_pack_forms_appropriately, forms_with_normals)
+{
+    yli::animation::MorphTargetBuffer morph_target_buffer;
+    morph_target_buffer.add_form({ glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(4.0f, 5.0f, 6.0f) }, { glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f) });
+    morph_target_buffer.add_form({ glm::vec3(7.0f, 8.0f, 9.0f), glm::vec3(10.0f, 11.0f, 12.0f) }, { glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f) });
+
+    ASSERT_EQ(morph_target_buffer.get_number_of_forms(), 2);
+    ASSERT_EQ(morph_target_buffer.get_number_of_vertices(), 2);
+    ASSERT_EQ(morph_target_buffer.get_number_of_components(), 6);
+    ASSERT_EQ(morph_target_buffer.get_component(0, 1)[1], 5.0f);
+    ASSERT_EQ(morph_target_buffer.get_component(1, 0)[0], 7.0f);
+    ASSERT_EQ(morph_target_buffer.get_component(1, 3)[0], 1.0f);
+    ASSERT_EQ(morph_target_buffer.get_component(0, 0) + 12, morph_target_buffer.get_component(1, 0)); // Contiguous.
+
+    ASSERT_THROW(morph_target_buffer.add_form({ glm::vec3(0.0f) }, { glm::vec3(0.0f) }), std::runtime_error);
+    ASSERT_THROW(morph_target_buffer.add_form({ glm::vec3(0.0f), glm::vec3(0.0f) }, {}), std::runtime_error);
+    ASSERT_THROW(morph_target_buffer.get_component(2, 0), std::runtime_error);
+}
+
+TEST(morph_evaluator_must_share_and_blend_phases_appropriately, blends_of_2_forms)
+{
+    yli::animation::MorphTargetBuffer morph_target_buffer;
+    morph_target_buffer.add_form({ glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(2.0f, 0.0f, 0.0f) }, { glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, 1.0f) });
+    morph_target_buffer.add_form({ glm::vec3(4.0f, 8.0f, 0.0f), glm::vec3(2.0f, 4.0f, 0.0f) }, { glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f) });
+
+    yli::animation::MorphEvaluator morph_evaluator(4);
+    morph_evaluator.begin_frame();
+
+    const std::uint32_t half = morph_evaluator.request({ 0, 1, 0.5f });
+    const std::uint32_t almost_half = morph_evaluator.request({ 0, 1, 0.51f }); // The same quantized blend.
+    const std::uint32_t start = morph_evaluator.request({ 0, 1, 0.0f });
+    const std::uint32_t end = morph_evaluator.request({ 0, 1, 1.0f });
+    const std::uint32_t form_1 = morph_evaluator.request({ 1, 1, 0.0f }); // The same as `end`.
+
+    ASSERT_EQ(half, almost_half);
+    ASSERT_EQ(end, form_1);
+    ASSERT_NE(half, start);
+    ASSERT_NE(start, end);
+    ASSERT_EQ(morph_evaluator.get_number_of_requests(), 5);
+    ASSERT_EQ(morph_evaluator.get_number_of_slots(), 3);
+
+    morph_evaluator.evaluate(morph_target_buffer);
+
+    ASSERT_EQ(morph_evaluator.get_vertex(half, 0), glm::vec3(2.0f, 4.0f, 0.0f));
+    ASSERT_EQ(morph_evaluator.get_vertex(half, 1), glm::vec3(2.0f, 2.0f, 0.0f));
+    ASSERT_EQ(morph_evaluator.get_normal(half, 0), glm::vec3(0.5f, 0.0f, 0.5f));
+    ASSERT_EQ(morph_evaluator.get_vertex(start, 0), glm::vec3(0.0f, 0.0f, 0.0f));
+    ASSERT_EQ(morph_evaluator.get_vertex(end, 0), glm::vec3(4.0f, 8.0f, 0.0f));
+
+    morph_evaluator.begin_frame();
+    ASSERT_EQ(morph_evaluator.request({ 0, 1, 0.75f }), 0);
+    ASSERT_EQ(morph_evaluator.get_number_of_slots(), 1);
+}
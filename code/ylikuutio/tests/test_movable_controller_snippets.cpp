@@ -27,6 +27,7 @@
 #include "code/ylikuutio/ontology/object_struct.hpp"
 #include "code/ylikuutio/ontology/movable_controller_struct.hpp"
 #include "code/ylikuutio/ontology/input_parameters_and_any_value_to_any_value_callback_with_universe.hpp"
+#include "code/ylikuutio/ontology/movable_and_arguments_to_void_callback.hpp"
 #include "code/ylikuutio/snippets/movable_controller_snippets.hpp"
 
 // Include GLM
@@ -1377,3 +1378,49 @@ TEST(rotate_counterclockwise_movable_controller_must_rotate_counterclockwise, ob
     ASSERT_EQ(object->location, original_location);
     ASSERT_EQ(object->orientation.get(), expected_orientation);
 }
+
+TEST(go_east_movable_controller_must_go_east, typed_callback_object_with_speed_2)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::MovableAndArgumentsToVoidCallback movable_callback = &yli::snippets::go_east;
+
+    yli::ontology::CallbackEngineStruct go_east_callback_engine_struct;
+    yli::ontology::CallbackEngine* const go_east_callback_engine = application.get_generic_entity_factory().create_callback_engine(
+            go_east_callback_engine_struct);
+
+    go_east_callback_engine->create_movable_callback_object(movable_callback);
+
+    yli::ontology::MovableControllerStruct go_east_movable_controller_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(go_east_callback_engine) };
+    yli::ontology::MovableController* const go_east_movable_controller = application.get_generic_entity_factory().create_movable_controller(
+            go_east_movable_controller_struct);
+
+    yli::ontology::ObjectStruct object_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(go_east_movable_controller) };
+    object_struct.cartesian_coordinates = { 1.0f, 2.0f, 3.0f }; // Whatever except NANs.
+    object_struct.orientation =           { 4.0f, 5.0f, 6.0f }; // Whatever except NANs.
+    yli::ontology::Object* const object = application.get_generic_entity_factory().create_object(
+            object_struct);
+    object->speed = 2.0f;
+
+    yli::ontology::OrientationModule original_orientation(object->orientation);
+
+    glm::vec3 expected_coordinates { object->location.xyz + glm::vec3(2.0f, 0.0f, 0.0f) };
+
+    go_east_movable_controller->update();
+
+    ASSERT_EQ(object->location.xyz, expected_coordinates);
+    ASSERT_EQ(object->orientation, original_orientation);
+
+    expected_coordinates += glm::vec3(2.0f, 0.0f, 0.0f);
+
+    go_east_movable_controller->update();
+
+    ASSERT_EQ(object->location.xyz, expected_coordinates);
+}
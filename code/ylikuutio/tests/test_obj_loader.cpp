@@ -25,9 +25,25 @@
 #endif
 
 // Include standard headers
-#include <cstdint>  // std::int32_t
-#include <string>   // std::string
-#include <vector>   // std::vector
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::int32_t
+#include <filesystem> // std::filesystem
+#include <fstream>    // std::ofstream
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+namespace
+{
+    std::string write_temporary_obj_file(const std::string& filename, const std::string& file_content)
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "ylikuutio_test_obj_loader";
+        std::filesystem::create_directories(directory);
+        const std::string path = (directory / filename).string();
+        std::ofstream file_stream(path, std::ios::binary);
+        file_stream << file_content;
+        return path;
+    }
+}
 
 TEST(obj_files_must_be_loaded_approriately, suzanne_obj)
 {
@@ -238,3 +254,149 @@ TEST(obj_files_must_be_loaded_approriately, suzanne_obj)
     ASSERT_GT(out_vertices[3 * 966].z, 0.7578125);
     ASSERT_LT(out_vertices[3 * 966].z, 0.76171875);
 }
+
+TEST(obj_files_must_be_loaded_approriately, grid_obj_with_several_threads)
+{
+    // A grid of 100 x 100 quads is large enough to be split into several chunks.
+    const std::size_t grid_size = 100;
+    std::string file_content;
+
+    for (std::size_t y = 0; y <= grid_size; y++)
+    {
+        for (std::size_t x = 0; x <= grid_size; x++)
+        {
+            file_content += "v " + std::to_string(x) + ".5 " + std::to_string(y) + ".25 -1.0\n";
+            file_content += "vt " + std::to_string(x) + ".0 " + std::to_string(y) + ".0\n";
+        }
+    }
+
+    file_content += "vn 0.0 0.0 1.0\n";
+
+    for (std::size_t y = 0; y < grid_size; y++)
+    {
+        for (std::size_t x = 0; x < grid_size; x++)
+        {
+            const std::string i1 = std::to_string(y * (grid_size + 1) + x + 1);
+            const std::string i2 = std::to_string(y * (grid_size + 1) + x + 2);
+            const std::string i3 = std::to_string((y + 1) * (grid_size + 1) + x + 2);
+            const std::string i4 = std::to_string((y + 1) * (grid_size + 1) + x + 1);
+            file_content += "f " + i1 + "/" + i1 + "/1 " + i2 + "/" + i2 + "/1 " + i3 + "/" + i3 + "/1 " + i4 + "/" + i4 + "/1\n";
+        }
+    }
+
+    const std::string obj_path = write_temporary_obj_file("grid.obj", file_content);
+
+    std::vector<glm::vec3> single_thread_vertices;
+    std::vector<glm::vec2> single_thread_uvs;
+    std::vector<glm::vec3> single_thread_normals;
+    ASSERT_TRUE(yli::load::load_obj(obj_path, single_thread_vertices, single_thread_uvs, single_thread_normals, 1));
+    ASSERT_EQ(single_thread_vertices.size(), 3 * 2 * grid_size * grid_size);
+
+    // Last quad: vertices (99, 99), (100, 99), (100, 100), (99, 99), (100, 100), (99, 100).
+    ASSERT_EQ(single_thread_vertices.back(), glm::vec3(99.5f, 100.25f, -1.0f));
+    ASSERT_EQ(single_thread_uvs.back(), glm::vec2(99.0f, 100.0f));
+
+    for (const std::size_t n_threads : { 2, 3, 8 })
+    {
+        std::vector<glm::vec3> out_vertices;
+        std::vector<glm::vec2> out_uvs;
+        std::vector<glm::vec3> out_normals;
+        ASSERT_TRUE(yli::load::load_obj(obj_path, out_vertices, out_uvs, out_normals, n_threads));
+        ASSERT_EQ(out_vertices, single_thread_vertices);
+        ASSERT_EQ(out_uvs, single_thread_uvs);
+        ASSERT_EQ(out_normals, single_thread_normals);
+    }
+}
+
+TEST(obj_files_must_be_loaded_approriately, quad_with_relative_indices_and_crlf_line_endings)
+{
+    const std::string obj_path = write_temporary_obj_file(
+            "quad.obj",
+            "# quad\r\n"
+            "v 0.0 0.0 0.0\r\n"
+            "v 1.0 0.0 0.0\r\n"
+            "v 1.0 1.0 0.0\r\n"
+            "  v 0.0 1.0 0.0\r\n"
+            "vt 0.0 0.0\r\n"
+            "vt 1.0 0.0\r\n"
+            "vt 1.0 1.0\r\n"
+            "vt 0.0 1.0\r\n"
+            "vn 0.0 0.0 1.0\r\n"
+            "s off\r\n"
+            "f -4/-4/-1 -3/-3/-1 -2/-2/-1 -1/-1/-1\r\n");
+
+    std::vector<glm::vec3> out_vertices;
+    std::vector<glm::vec2> out_uvs;
+    std::vector<glm::vec3> out_normals;
+    ASSERT_TRUE(yli::load::load_obj(obj_path, out_vertices, out_uvs, out_normals));
+
+    // The quad is triangulated as a fan: (1, 2, 3), (1, 3, 4).
+    ASSERT_EQ(out_vertices, std::vector<glm::vec3>({
+                glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f),
+                glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 1.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f) }));
+    ASSERT_EQ(out_uvs, std::vector<glm::vec2>({
+                glm::vec2(0.0f, 0.0f), glm::vec2(1.0f, 0.0f), glm::vec2(1.0f, 1.0f),
+                glm::vec2(0.0f, 0.0f), glm::vec2(1.0f, 1.0f), glm::vec2(0.0f, 1.0f) }));
+    ASSERT_EQ(out_normals, std::vector<glm::vec3>(6, glm::vec3(0.0f, 0.0f, 1.0f)));
+}
+
+TEST(obj_files_must_be_loaded_approriately, loading_stops_at_object_line)
+{
+    const std::string obj_path = write_temporary_obj_file(
+            "two_objects.obj",
+            "v 0.0 0.0 0.0\n"
+            "v 1.0 0.0 0.0\n"
+            "v 1.0 1.0 0.0\n"
+            "vt 0.0 0.0\n"
+            "vn 0.0 0.0 1.0\n"
+            "f 1/1/1 2/1/1 3/1/1\n"
+            "o second\n"
+            "f 3/1/1 2/1/1 1/1/1\n");
+
+    std::vector<glm::vec3> out_vertices;
+    std::vector<glm::vec2> out_uvs;
+    std::vector<glm::vec3> out_normals;
+    ASSERT_TRUE(yli::load::load_obj(obj_path, out_vertices, out_uvs, out_normals));
+    ASSERT_EQ(out_vertices.size(), 3);
+    ASSERT_EQ(out_vertices[0], glm::vec3(0.0f, 0.0f, 0.0f));
+}
+
+TEST(obj_files_must_not_be_loaded, face_index_out_of_range)
+{
+    const std::string obj_path = write_temporary_obj_file(
+            "index_out_of_range.obj",
+            "v 0.0 0.0 0.0\n"
+            "vt 0.0 0.0\n"
+            "vn 0.0 0.0 1.0\n"
+            "f 1/1/1 1/1/1 2/1/1\n");
+
+    std::vector<glm::vec3> out_vertices;
+    std::vector<glm::vec2> out_uvs;
+    std::vector<glm::vec3> out_normals;
+    ASSERT_FALSE(yli::load::load_obj(obj_path, out_vertices, out_uvs, out_normals));
+    ASSERT_TRUE(out_vertices.empty());
+    ASSERT_TRUE(out_uvs.empty());
+    ASSERT_TRUE(out_normals.empty());
+}
+
+TEST(obj_files_must_not_be_loaded, face_without_normal_indices)
+{
+    const std::string obj_path = write_temporary_obj_file(
+            "face_without_normal_indices.obj",
+            "v 0.0 0.0 0.0\n"
+            "vt 0.0 0.0\n"
+            "f 1/1 1/1 1/1\n");
+
+    std::vector<glm::vec3> out_vertices;
+    std::vector<glm::vec2> out_uvs;
+    std::vector<glm::vec3> out_normals;
+    ASSERT_FALSE(yli::load::load_obj(obj_path, out_vertices, out_uvs, out_normals));
+}
+
+TEST(obj_files_must_not_be_loaded, nonexistent_file)
+{
+    std::vector<glm::vec3> out_vertices;
+    std::vector<glm::vec2> out_uvs;
+    std::vector<glm::vec3> out_normals;
+    ASSERT_FALSE(yli::load::load_obj("nonexistent.obj", out_vertices, out_uvs, out_normals));
+}
@@ -24,6 +24,7 @@
 #include "code/ylikuutio/ontology/material.hpp"
 #include "code/ylikuutio/ontology/species.hpp"
 #include "code/ylikuutio/ontology/object.hpp"
+#include "code/ylikuutio/ontology/variable.hpp"
 #include "code/ylikuutio/ontology/request.hpp"
 #include "code/ylikuutio/ontology/texture_file_format.hpp"
 #include "code/ylikuutio/ontology/movable_controller_struct.hpp"
@@ -32,11 +33,20 @@
 #include "code/ylikuutio/ontology/material_struct.hpp"
 #include "code/ylikuutio/ontology/species_struct.hpp"
 #include "code/ylikuutio/ontology/object_struct.hpp"
+#include "code/ylikuutio/ontology/cartesian_coordinates_module.hpp"
+#include "code/ylikuutio/geometry/dynamic_aabb_tree.hpp"
+#include "code/ylikuutio/geometry/heightmap_visibility.hpp"
+#include "code/ylikuutio/geometry/spatial_hash_grid.hpp"
+#include "code/ylikuutio/graph/navigation_graph.hpp"
+#include "code/ylikuutio/graph/navigation_grid.hpp"
 
 // Include standard headers
 #include <cstdint> // uintptr_t
 #include <cstddef> // std::size_t
 #include <limits>  // std::numeric_limits
+#include <memory>  // std::make_shared, std::make_unique
+#include <string>  // std::string, std::to_string
+#include <vector>  // std::vector
 
 namespace yli::ontology
 {
@@ -449,6 +459,138 @@ TEST(object_must_bind_to_species_appropriately, headless_with_parent_provided_as
     ASSERT_EQ(species2->get_number_of_apprentices(), 0);
 }
 
+TEST(object_must_keep_cached_scene_and_pipeline_up_to_date, headless_with_parent_provided_as_valid_pointer_rebinding_scene_and_species)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct1;
+    yli::ontology::Scene* const scene1 = application.get_generic_entity_factory().create_scene(
+            scene_struct1);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(scene1) };
+    yli::ontology::Pipeline* const pipeline1 = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+    yli::ontology::Pipeline* const pipeline2 = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+
+    yli::ontology::MaterialStruct material_struct1 {
+            yli::ontology::Request(scene1),
+            yli::ontology::Request(pipeline1),
+            yli::ontology::TextureFileFormat::PNG };
+    yli::ontology::Material* const material1 = application.get_generic_entity_factory().create_material(
+            material_struct1);
+
+    yli::ontology::MaterialStruct material_struct2 {
+            yli::ontology::Request(scene1),
+            yli::ontology::Request(pipeline2),
+            yli::ontology::TextureFileFormat::PNG };
+    yli::ontology::Material* const material2 = application.get_generic_entity_factory().create_material(
+            material_struct2);
+
+    yli::ontology::SpeciesStruct species_struct1 {
+            yli::ontology::Request(scene1),
+            yli::ontology::Request(material1) };
+    yli::ontology::Species* const species1 = application.get_generic_entity_factory().create_species(
+            species_struct1);
+
+    yli::ontology::SpeciesStruct species_struct2 {
+            yli::ontology::Request(scene1),
+            yli::ontology::Request(material2) };
+    yli::ontology::Species* const species2 = application.get_generic_entity_factory().create_species(
+            species_struct2);
+
+    yli::ontology::ObjectStruct object_struct { yli::ontology::Request(scene1) };
+    object_struct.species_master = yli::ontology::Request(species1);
+    yli::ontology::Object* const object = application.get_generic_entity_factory().create_object(
+            object_struct);
+    ASSERT_EQ(object->get_cached_scene(), scene1);
+    ASSERT_EQ(object->get_cached_pipeline(), pipeline1);
+    ASSERT_EQ(material2->get_cached_scene(), scene1);
+
+    yli::ontology::Object::bind_to_new_species_master(*object, *species2);
+    ASSERT_EQ(object->get_cached_pipeline(), pipeline2);
+
+    yli::ontology::Object::bind_to_new_species_master(*object, *species1);
+    ASSERT_EQ(object->get_cached_pipeline(), pipeline1);
+
+    yli::ontology::SceneStruct scene_struct2;
+    yli::ontology::Scene* const scene2 = application.get_generic_entity_factory().create_scene(
+            scene_struct2);
+    yli::ontology::Object::bind_to_new_scene_parent(*object, *scene2);
+    ASSERT_EQ(object->get_cached_scene(), scene2);
+    ASSERT_EQ(object->get_cached_scene(), object->get_scene());
+}
+
+TEST(objects_must_be_created_in_bulk_appropriately, headless_with_parent_provided_as_valid_pointer_objects_with_local_names)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    std::vector<yli::ontology::ObjectStruct> object_structs;
+
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        yli::ontology::ObjectStruct object_struct { yli::ontology::Request(scene) };
+        object_struct.local_name = "foo" + std::to_string(i);
+        object_structs.emplace_back(object_struct);
+    }
+
+    object_structs[2].global_name = "bar";
+
+    const std::vector<yli::ontology::Object*> objects = application.get_generic_entity_factory().create_objects(
+            object_structs);
+    ASSERT_FALSE(application.get_generic_entity_factory().get_is_creating_in_bulk());
+    ASSERT_EQ(objects.size(), 3);
+
+    for (std::size_t i = 0; i < objects.size(); i++)
+    {
+        ASSERT_NE(objects[i], nullptr);
+        ASSERT_EQ(objects[i]->get_childID(), i);
+        ASSERT_EQ(objects[i]->get_parent(), scene);
+        ASSERT_EQ(objects[i]->get_local_name(), "foo" + std::to_string(i));
+        ASSERT_EQ(scene->get_entity("foo" + std::to_string(i)), objects[i]);
+    }
+
+    ASSERT_EQ(scene->get_number_of_non_variable_children(), 4); // Default `Camera`, 3 `Object`s.
+    ASSERT_EQ(scene->registry.get_number_of_completions("foo"), 3);
+    ASSERT_EQ(application.get_universe().get_entity("bar"), objects[2]);
+}
+
+TEST(objects_created_in_bulk_must_create_variables_on_first_use, headless_with_parent_provided_as_valid_pointer)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::ObjectStruct object_struct { yli::ontology::Request(scene) };
+    object_struct.cartesian_coordinates = { 1.0f, 2.0f, 3.0f };
+    yli::ontology::Object* const eager_object = application.get_generic_entity_factory().create_object(
+            object_struct);
+
+    const std::vector<yli::ontology::ObjectStruct> object_structs(2, object_struct);
+    const std::vector<yli::ontology::Object*> objects = application.get_generic_entity_factory().create_objects(
+            object_structs);
+    ASSERT_EQ(objects.size(), 2);
+
+    // Nothing is created before the first use.
+    ASSERT_EQ(objects[0]->parent_of_variables.get_number_of_children(), 0);
+    ASSERT_EQ(objects[0]->registry.get_entity_map().size(), 0);
+
+    yli::ontology::Variable* const x_variable = objects[0]->get_variable("x");
+    ASSERT_NE(x_variable, nullptr);
+    ASSERT_EQ(x_variable->get_parent(), objects[0]);
+    ASSERT_EQ(objects[0]->get_number_of_variables(), eager_object->get_number_of_variables());
+    ASSERT_TRUE(objects[0]->has_variable("should_render"));
+    ASSERT_EQ(objects[0]->get_cartesian_coordinates(), eager_object->get_cartesian_coordinates());
+
+    // Each `Object` creates its own `Variable`s.
+    ASSERT_EQ(objects[1]->parent_of_variables.get_number_of_children(), 0);
+    ASSERT_TRUE(objects[1]->has_child("yaw"));
+    ASSERT_EQ(objects[1]->get_number_of_variables(), eager_object->get_number_of_variables());
+}
+
 TEST(object_must_maintain_the_local_name_after_binding_to_a_new_parent, headless_with_parent_provided_as_valid_pointer_object_with_only_local_name)
 {
     mock::MockApplication application;
@@ -573,3 +715,220 @@ TEST(object_must_not_bind_to_a_new_parent_when_local_name_is_already_in_use, hea
     ASSERT_TRUE(scene1->has_child("baz"));
     ASSERT_TRUE(scene2->has_child("baz"));
 }
+
+TEST(object_must_be_found_by_neighbour_queries, headless_allies_and_opponents)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    auto create_object = [&](const float x, const std::uint32_t allegiance)
+    {
+        yli::ontology::ObjectStruct object_struct { yli::ontology::Request(scene) };
+        object_struct.cartesian_coordinates = yli::ontology::CartesianCoordinatesModule(x, 0.0f, 0.0f);
+        object_struct.allegiance = allegiance;
+        return static_cast<yli::ontology::Movable*>(application.get_generic_entity_factory().create_object(object_struct));
+    };
+
+    yli::ontology::Movable* const ally1 = create_object(0.0f, 0);
+    yli::ontology::Movable* const ally2 = create_object(5.0f, 0);
+    yli::ontology::Movable* const opponent1 = create_object(3.0f, 1);
+    yli::ontology::Movable* const opponent2 = create_object(500.0f, 1); // Beyond the default perception radius.
+    ASSERT_EQ(scene->get_spatial_index().get_number_of_proxies(), 4);
+
+    std::vector<yli::ontology::Movable*> movables;
+    scene->get_nearest_movables(glm::vec3(0.0f, 0.0f, 0.0f), 2, yli::geometry::SpatialQueryFilter(), movables);
+    ASSERT_EQ(movables, std::vector<yli::ontology::Movable*>({ ally1, opponent1 }));
+
+    movables.clear();
+    scene->get_movables_within_radius(
+            glm::vec3(0.0f, 0.0f, 0.0f),
+            10.0f,
+            yli::geometry::SpatialQueryFilter { 1, yli::geometry::GroupRelation::SAME, -1 },
+            movables);
+    ASSERT_EQ(movables, std::vector<yli::ontology::Movable*>({ opponent1 }));
+
+    // Allies include the `Movable` itself, other allies do not.
+    ASSERT_EQ(yli::ontology::Movable::get_first_allied_movable(*ally1), ally1);
+    ASSERT_EQ(yli::ontology::Movable::get_next_allied_movable(*ally1), ally2);
+    ASSERT_EQ(yli::ontology::Movable::get_next_allied_movable(*ally1), nullptr);
+    ASSERT_EQ(yli::ontology::Movable::get_first_other_allied_movable(*ally1), ally2);
+    ASSERT_EQ(yli::ontology::Movable::get_next_other_allied_movable(*ally1), nullptr);
+    ASSERT_EQ(yli::ontology::Movable::get_first_opponent_movable(*ally1), opponent1);
+    ASSERT_EQ(yli::ontology::Movable::get_next_opponent_movable(*ally1), nullptr);
+
+    // Setting the location updates the index right away.
+    opponent2->set_cartesian_coordinates(glm::vec3(4.0f, 0.0f, 0.0f));
+    ASSERT_EQ(yli::ontology::Movable::get_first_opponent_movable(*ally1), opponent1);
+    ASSERT_EQ(yli::ontology::Movable::get_next_opponent_movable(*ally1), opponent2);
+    ASSERT_EQ(yli::ontology::Movable::get_next_opponent_movable(*ally1), nullptr);
+
+    // Locations written directly are synced on the next update.
+    ally2->location.xyz = glm::vec3(1000.0f, 0.0f, 0.0f);
+    scene->update();
+    ASSERT_EQ(yli::ontology::Movable::get_first_other_allied_movable(*ally1), nullptr);
+    ASSERT_TRUE(scene->get_spatial_index().validate());
+}
+
+TEST(object_must_be_found_by_neighbour_queries, headless_after_binding_to_a_new_scene_parent)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene1 = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+    yli::ontology::Scene* const scene2 = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::ObjectStruct object_struct { yli::ontology::Request(scene1) };
+    object_struct.cartesian_coordinates = yli::ontology::CartesianCoordinatesModule(1.0f, 2.0f, 3.0f);
+    yli::ontology::Object* const object = application.get_generic_entity_factory().create_object(
+            object_struct);
+    ASSERT_EQ(scene1->get_spatial_index().get_number_of_proxies(), 1);
+    ASSERT_EQ(scene2->get_spatial_index().get_number_of_proxies(), 0);
+
+    yli::ontology::Object::bind_to_new_scene_parent(*object, *scene2);
+    ASSERT_EQ(scene1->get_spatial_index().get_number_of_proxies(), 0);
+    ASSERT_EQ(scene2->get_spatial_index().get_number_of_proxies(), 1);
+
+    std::vector<yli::ontology::Movable*> movables;
+    scene2->get_nearest_movables(glm::vec3(0.0f, 0.0f, 0.0f), 1, yli::geometry::SpatialQueryFilter(), movables);
+    ASSERT_EQ(movables, std::vector<yli::ontology::Movable*>({ object }));
+}
+
+TEST(object_must_be_queued_for_culling_only_when_moved, headless)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::ObjectStruct object_struct { yli::ontology::Request(scene) };
+    yli::ontology::Object* const object = application.get_generic_entity_factory().create_object(
+            object_struct);
+    ASSERT_TRUE(object->is_culling_dirty);
+
+    scene->update_culling(glm::mat4(1.0f));
+    ASSERT_FALSE(object->is_culling_dirty);
+    ASSERT_EQ(object->culling_proxy_id, yli::geometry::DynamicAabbTree::null_node); // No `Species`, no bounds.
+
+    object->set_cartesian_coordinates(glm::vec3(1.0f, 2.0f, 3.0f));
+    ASSERT_TRUE(object->is_culling_dirty);
+
+    object->set_scale(2.0f);
+    ASSERT_TRUE(object->is_culling_dirty);
+
+    scene->update_culling(glm::mat4(1.0f));
+    ASSERT_FALSE(object->is_culling_dirty);
+
+    // Locations written directly are queued by `notify_moved`.
+    object->location.xyz = glm::vec3(4.0f, 5.0f, 6.0f);
+    object->notify_moved();
+    ASSERT_TRUE(object->is_culling_dirty);
+
+    // A queued `Object` can be erased before the next update.
+    application.get_generic_memory_system().destroy(object->get_constructible_module());
+    scene->update_culling(glm::mat4(1.0f));
+}
+
+TEST(object_must_have_line_of_sight_over_terrain, headless_ridge)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    auto create_object = [&](const float x, const std::uint32_t allegiance, const bool is_static_observer)
+    {
+        yli::ontology::ObjectStruct object_struct { yli::ontology::Request(scene) };
+        object_struct.cartesian_coordinates = yli::ontology::CartesianCoordinatesModule(x, 2.0f, 5.0f);
+        object_struct.allegiance = allegiance;
+        object_struct.is_static_observer = is_static_observer;
+        return static_cast<yli::ontology::Movable*>(application.get_generic_entity_factory().create_object(object_struct));
+    };
+
+    yli::ontology::Movable* const west = create_object(1.0f, 0, false);
+    yli::ontology::Movable* const east = create_object(9.0f, 0, false);
+    yli::ontology::Movable* const control_center = create_object(2.0f, 0, true);
+
+    // Without terrain nothing blocks, but line of sight is not known.
+    ASSERT_TRUE(yli::ontology::Movable::is_line_of_sight(west, 9.0f, 2.0f, 5.0f));
+    ASSERT_TRUE(yli::ontology::Movable::may_have_line_of_sight_between(west, 1.0f, 2.0f, 5.0f, 9.0f, 2.0f, 5.0f));
+    ASSERT_FALSE(yli::ontology::Movable::is_line_of_sight_between_from(west, 1.0f, 2.0f, 5.0f, 9.0f, 2.0f, 5.0f));
+
+    // Flat terrain at altitude 0 with a ridge of altitude 10 at x = 5.
+    std::vector<float> altitudes(11 * 11, 0.0f);
+
+    for (std::size_t j = 0; j < 11; j++)
+    {
+        altitudes[j * 11 + 5] = 10.0f;
+    }
+
+    scene->set_terrain_visibility(std::make_unique<yli::geometry::HeightmapVisibility>(std::move(altitudes), 11, 11));
+
+    ASSERT_FALSE(yli::ontology::Movable::is_line_of_sight(west, 9.0f, 2.0f, 5.0f));
+    ASSERT_TRUE(yli::ontology::Movable::is_line_of_sight(west, 4.0f, 2.0f, 5.0f));
+    ASSERT_FALSE(yli::ontology::Movable::is_line_of_sight(control_center, 9.0f, 2.0f, 5.0f));
+    ASSERT_TRUE(yli::ontology::Movable::is_line_of_sight(control_center, 3.0f, 0.1f, 5.0f));
+    ASSERT_FALSE(yli::ontology::Movable::may_have_line_of_sight_between(west, 1.0f, 2.0f, 5.0f, 9.0f, 2.0f, 5.0f));
+    ASSERT_TRUE(yli::ontology::Movable::is_line_of_sight_between_from(west, 1.0f, 12.0f, 5.0f, 9.0f, 12.0f, 5.0f));
+
+    // `east` sees the east side of the ridge for the whole allegiance.
+    ASSERT_TRUE(yli::ontology::Movable::is_line_of_sight_for_any(west, 8.0f, 0.0f, 5.0f));
+    ASSERT_TRUE(yli::ontology::Movable::is_visible(west, 8.0f, 0.0f, 5.0f));
+    east->set_cartesian_coordinates(glm::vec3(3.0f, 2.0f, 5.0f));
+    ASSERT_FALSE(yli::ontology::Movable::is_line_of_sight_for_any(west, 8.0f, 0.0f, 5.0f));
+}
+
+TEST(object_must_know_paths_over_terrain, headless_wall)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::ObjectStruct object_struct { yli::ontology::Request(scene) };
+    object_struct.cartesian_coordinates = yli::ontology::CartesianCoordinatesModule(1.0f, 0.0f, 1.0f);
+    const yli::ontology::Movable* const object = application.get_generic_entity_factory().create_object(object_struct);
+
+    // Without navigation data no path is known.
+    ASSERT_FALSE(yli::ontology::Movable::is_ground_path_known(object, 9.0f, 0.0f, 1.0f));
+    ASSERT_FALSE(yli::ontology::Movable::is_rail_path_known(object, 9.0f, 0.0f, 1.0f));
+    ASSERT_FALSE(yli::ontology::Movable::is_air_path_known(object, 9.0f, 0.0f, 1.0f));
+
+    // A wall at x = 5 with a gap at z = 9.
+    std::vector<float> costs(11 * 11, 1.0f);
+    std::vector<float> altitudes(11 * 11, 0.0f);
+
+    for (std::size_t j = 0; j < 11; j++)
+    {
+        costs[j * 11 + 5] = (j == 9 ? 1.0f : std::numeric_limits<float>::infinity());
+        altitudes[j * 11 + 5] = (j == 9 ? 0.0f : 10.0f);
+    }
+
+    yli::graph::PathPlanner& path_planner = scene->get_path_planner();
+    path_planner.set_navigation_grid(std::make_shared<const yli::graph::NavigationGrid>(std::move(costs), 11, 11), 4);
+    scene->set_terrain_visibility(std::make_unique<yli::geometry::HeightmapVisibility>(std::move(altitudes), 11, 11));
+
+    // The first query requests the path.
+    yli::ontology::Movable::is_ground_path_known(object, 9.0f, 0.0f, 1.0f);
+    path_planner.finish();
+    ASSERT_TRUE(yli::ontology::Movable::is_ground_path_known(object, 9.0f, 0.0f, 1.0f));
+    ASSERT_FALSE(yli::ontology::Movable::is_ground_path_known(object, 11.5f, 0.0f, 1.0f));
+    ASSERT_FALSE(yli::ontology::Movable::is_air_path_known(object, 9.0f, 0.0f, 1.0f));
+    ASSERT_TRUE(yli::ontology::Movable::is_air_path_known(object, 9.0f, 25.0f, 1.0f));
+
+    // Rails from (1, 0, 1) to (9, 0, 1) but not back.
+    std::shared_ptr<yli::graph::NavigationGraph> rails = std::make_shared<yli::graph::NavigationGraph>();
+    const std::uint32_t west = rails->add_node(glm::vec3(1.0f, 0.0f, 1.0f));
+    const std::uint32_t east = rails->add_node(glm::vec3(9.0f, 0.0f, 1.0f));
+    rails->add_edge(west, east);
+    rails->finalize();
+    path_planner.set_navigation_graph(std::move(rails));
+
+    yli::ontology::Movable::is_rail_path_known(object, 8.0f, 0.0f, 2.0f);
+    yli::ontology::Movable::is_rail_path_known_between(object, 9.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f);
+    path_planner.finish();
+    ASSERT_TRUE(yli::ontology::Movable::is_rail_path_known(object, 8.0f, 0.0f, 2.0f));
+    ASSERT_FALSE(yli::ontology::Movable::is_rail_path_known_between(object, 9.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f));
+}
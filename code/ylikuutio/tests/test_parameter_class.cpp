@@ -0,0 +1,144 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/mock/mock_application.hpp"
+#include "code/ylikuutio/lisp/parameter_class.hpp"
+#include "code/ylikuutio/ontology/universe.hpp"
+
+// Include standard headers
+#include <cstdint> // std::int32_t, std::uint32_t
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+namespace yli::ontology
+{
+    class Console;
+    class Entity;
+    class Object;
+}
+
+using yli::lisp::ParameterClass;
+using yli::lisp::ParameterClassMask;
+using yli::lisp::ConvertedArgument;
+using yli::lisp::convert_argument;
+using yli::lisp::convert_arguments;
+using yli::lisp::get_parameter_class_bit;
+using yli::lisp::make_signature;
+
+TEST(signature_must_consist_of_consumed_parameters, types)
+{
+    constexpr auto empty_signature = make_signature<>();
+    ASSERT_EQ(empty_signature.size(), 0);
+
+    constexpr auto context_only_signature = make_signature<yli::ontology::Universe&, yli::ontology::Console&>();
+    ASSERT_EQ(context_only_signature.size(), 0);
+
+    constexpr auto signature = make_signature<
+        yli::ontology::Console&,
+        const yli::ontology::Entity&,
+        yli::ontology::Object*,
+        bool,
+        char,
+        float,
+        double,
+        std::int32_t,
+        std::uint32_t,
+        const std::string&>();
+    ASSERT_EQ(signature.size(), 9);
+    ASSERT_EQ(signature[0], ParameterClass::ENTITY);
+    ASSERT_EQ(signature[1], ParameterClass::ENTITY);
+    ASSERT_EQ(signature[2], ParameterClass::BOOL);
+    ASSERT_EQ(signature[3], ParameterClass::CHAR);
+    ASSERT_EQ(signature[4], ParameterClass::FLOATING_POINT);
+    ASSERT_EQ(signature[5], ParameterClass::FLOATING_POINT);
+    ASSERT_EQ(signature[6], ParameterClass::SIGNED_INTEGER);
+    ASSERT_EQ(signature[7], ParameterClass::UNSIGNED_INTEGER);
+    ASSERT_EQ(signature[8], ParameterClass::STRING);
+
+    constexpr auto rest_signature = make_signature<yli::ontology::Console&, bool, const std::vector<std::string>&>();
+    ASSERT_EQ(rest_signature.size(), 2);
+    ASSERT_EQ(rest_signature[0], ParameterClass::BOOL);
+    ASSERT_EQ(rest_signature[1], ParameterClass::REST);
+}
+
+TEST(arguments_must_be_classified_appropriately, arguments)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    const ParameterClassMask string = get_parameter_class_bit(ParameterClass::STRING);
+
+    ASSERT_EQ(convert_argument(universe, "foo").classes, string);
+    ASSERT_EQ(convert_argument(universe, "true").classes, string | get_parameter_class_bit(ParameterClass::BOOL));
+    ASSERT_EQ(convert_argument(universe, "x").classes, string | get_parameter_class_bit(ParameterClass::CHAR));
+    ASSERT_EQ(convert_argument(universe, "1.5").classes, string | get_parameter_class_bit(ParameterClass::FLOATING_POINT));
+    ASSERT_EQ(convert_argument(universe, "-15").classes,
+            string |
+            get_parameter_class_bit(ParameterClass::FLOATING_POINT) |
+            get_parameter_class_bit(ParameterClass::SIGNED_INTEGER));
+    ASSERT_EQ(convert_argument(universe, "15").classes,
+            string |
+            get_parameter_class_bit(ParameterClass::FLOATING_POINT) |
+            get_parameter_class_bit(ParameterClass::SIGNED_INTEGER) |
+            get_parameter_class_bit(ParameterClass::UNSIGNED_INTEGER));
+    ASSERT_EQ(convert_argument(universe, "7").classes,
+            string |
+            get_parameter_class_bit(ParameterClass::CHAR) |
+            get_parameter_class_bit(ParameterClass::FLOATING_POINT) |
+            get_parameter_class_bit(ParameterClass::SIGNED_INTEGER) |
+            get_parameter_class_bit(ParameterClass::UNSIGNED_INTEGER));
+}
+
+TEST(arguments_must_be_converted_appropriately, arguments)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    const ConvertedArgument boolean = convert_argument(universe, "true");
+    ASSERT_TRUE(boolean.boolean);
+    ASSERT_EQ(boolean.entity, nullptr);
+
+    const ConvertedArgument floating_point = convert_argument(universe, "1.5");
+    ASSERT_EQ(floating_point.floating_point, 1.5);
+
+    const ConvertedArgument signed_integer = convert_argument(universe, "-15");
+    ASSERT_EQ(signed_integer.signed_integer, -15);
+
+    const ConvertedArgument unsigned_integer = convert_argument(universe, "15");
+    ASSERT_EQ(unsigned_integer.unsigned_integer, 15);
+}
+
+TEST(only_bound_names_must_be_classified_as_entities, universe_foo)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    const std::string foo = "foo";
+    ASSERT_EQ(convert_argument(universe, foo).classes & get_parameter_class_bit(ParameterClass::ENTITY), 0);
+
+    universe.set_global_name(foo);
+
+    const std::vector<std::string> parameter_vector { foo, "bar" };
+    const std::vector<ConvertedArgument> arguments = convert_arguments(universe, parameter_vector);
+    ASSERT_EQ(arguments.size(), 2);
+    ASSERT_NE(arguments[0].classes & get_parameter_class_bit(ParameterClass::ENTITY), 0);
+    ASSERT_EQ(arguments[0].entity, &universe);
+    ASSERT_EQ(*arguments[0].string, foo);
+    ASSERT_EQ(arguments[1].classes & get_parameter_class_bit(ParameterClass::ENTITY), 0);
+    ASSERT_EQ(arguments[1].entity, nullptr);
+}
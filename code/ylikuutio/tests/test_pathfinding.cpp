@@ -0,0 +1,342 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "gtest/gtest.h"
+#include "code/ylikuutio/graph/a_star.hpp"
+#include "code/ylikuutio/graph/hierarchical_pathfinder.hpp"
+#include "code/ylikuutio/graph/navigation_graph.hpp"
+#include "code/ylikuutio/graph/navigation_grid.hpp"
+#include "code/ylikuutio/graph/path_cache.hpp"
+#include "code/ylikuutio/graph/path_planner.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cmath>     // std::abs
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <limits>    // std::numeric_limits
+#include <memory>    // std::make_shared, std::shared_ptr
+#include <random>    // std::mt19937, std::uniform_int_distribution, std::uniform_real_distribution
+#include <stdexcept> // std::runtime_error
+#include <thread>    // std::thread
+#include <vector>    // std::vector
+
+namespace
+{
+    constexpr std::uint32_t width { 67 };
+    constexpr std::uint32_t height { 53 };
+
+    // Random costs with about 20% of the cells blocked and a wall with 2 gaps.
+    std::shared_ptr<const yli::graph::NavigationGrid> create_random_grid(const std::uint32_t seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+        std::vector<float> costs(static_cast<std::size_t>(width) * height);
+
+        for (std::uint32_t j = 0; j < height; j++)
+        {
+            for (std::uint32_t i = 0; i < width; i++)
+            {
+                const float random = distribution(generator);
+                const bool is_wall = (i == width / 2 && j != 5 && j != height - 7);
+                costs[j * width + i] = (is_wall || random < 0.2f ? std::numeric_limits<float>::infinity() : 1.0f + 4.0f * random);
+            }
+        }
+
+        return std::make_shared<const yli::graph::NavigationGrid>(std::move(costs), width, height);
+    }
+
+    // Checks that consecutive cells are neighbours and returns the sum of the step costs.
+    float get_path_cost(const yli::graph::NavigationGrid& grid, const std::vector<std::uint32_t>& path)
+    {
+        float cost = 0.0f;
+
+        for (std::size_t node_i = 1; node_i < path.size(); node_i++)
+        {
+            float step_cost = std::numeric_limits<float>::infinity();
+
+            grid.for_each_neighbour(path[node_i - 1], [&](const std::uint32_t neighbour, const float neighbour_cost)
+                    {
+                        if (neighbour == path[node_i])
+                        {
+                            step_cost = neighbour_cost;
+                        }
+                    });
+
+            cost += step_cost;
+        }
+
+        return cost;
+    }
+}
+
+TEST(navigation_grid_must_be_initialized_appropriately, heightmap)
+{
+    // Flat, then a slope of 0.5 and a cliff.
+    const std::vector<float> altitudes {
+        0.0f, 0.0f, 0.5f, 1.0f, 9.0f,
+        0.0f, 0.0f, 0.5f, 1.0f, 9.0f };
+
+    const yli::graph::NavigationGrid grid = yli::graph::NavigationGrid::create_from_heightmap(
+            altitudes, 5, 2, glm::vec2(10.0f, 20.0f), glm::vec2(1.0f, 2.0f), 1.0f);
+    ASSERT_EQ(grid.get_width(), 5);
+    ASSERT_EQ(grid.get_height(), 2);
+    ASSERT_EQ(grid.get_number_of_nodes(), 10);
+    ASSERT_TRUE(grid.is_walkable(grid.get_cell(0, 0)));
+    ASSERT_TRUE(grid.is_walkable(grid.get_cell(2, 1)));
+    ASSERT_FALSE(grid.is_walkable(grid.get_cell(3, 1)));
+    ASSERT_FALSE(grid.is_walkable(grid.get_cell(4, 0)));
+    ASSERT_FLOAT_EQ(grid.get_cost(grid.get_cell(0, 0)), 1.0f);
+    ASSERT_GT(grid.get_cost(grid.get_cell(2, 0)), 1.0f);
+    ASSERT_EQ(grid.get_cell_at(glm::vec3(12.2f, 0.0f, 21.8f)), grid.get_cell(2, 1));
+    ASSERT_EQ(grid.get_cell_at(glm::vec3(9.0f, 0.0f, 20.0f)), yli::graph::invalid_node);
+    ASSERT_EQ(grid.get_position(grid.get_cell(3, 1)), glm::vec3(13.0f, 1.0f, 22.0f));
+
+    ASSERT_THROW(yli::graph::NavigationGrid(std::vector<float>(9, 1.0f), 5, 2), std::runtime_error);
+    ASSERT_THROW(yli::graph::NavigationGrid(std::vector<float>(10, 0.5f), 5, 2), std::runtime_error);
+}
+
+TEST(a_star_must_find_cheapest_paths, navigation_graph)
+{
+    yli::graph::NavigationGraph graph;
+    const std::uint32_t a = graph.add_node(glm::vec3(0.0f, 0.0f, 0.0f));
+    const std::uint32_t b = graph.add_node(glm::vec3(1.0f, 0.0f, 0.0f));
+    const std::uint32_t c = graph.add_node(glm::vec3(2.0f, 0.0f, 0.0f));
+    const std::uint32_t d = graph.add_node(glm::vec3(1.0f, 0.0f, 5.0f));
+    graph.add_bidirectional_edge(a, b, 10.0f);
+    graph.add_bidirectional_edge(b, c);
+    graph.add_bidirectional_edge(a, d);
+    graph.add_edge(d, c);
+    graph.finalize();
+    ASSERT_TRUE(graph.get_is_finalized());
+    ASSERT_EQ(graph.get_number_of_nodes(), 4);
+    ASSERT_EQ(graph.get_number_of_edges(), 7);
+    ASSERT_EQ(graph.get_nearest_node(glm::vec3(1.1f, 0.0f, 4.0f)), d);
+
+    yli::graph::AStarWorkspace workspace;
+    std::vector<std::uint32_t> path;
+    float cost = 0.0f;
+
+    // `a` -> `d` -> `c` is cheaper than the short edge of cost 10.
+    ASSERT_TRUE(yli::graph::find_path(graph, a, c, workspace, path, cost));
+    ASSERT_EQ(path, std::vector<std::uint32_t>({ a, d, c }));
+    ASSERT_FLOAT_EQ(cost, 2.0f * std::sqrt(26.0f));
+
+    // `d` -> `c` is one way.
+    ASSERT_TRUE(yli::graph::find_path(graph, c, a, workspace, path, cost));
+    ASSERT_EQ(path, std::vector<std::uint32_t>({ c, b, a }));
+    ASSERT_FLOAT_EQ(cost, 11.0f);
+
+    ASSERT_FALSE(yli::graph::find_path(graph, a, 4, workspace, path, cost));
+    ASSERT_TRUE(path.empty());
+}
+
+TEST(a_star_must_find_cheapest_paths, random_grid)
+{
+    const std::shared_ptr<const yli::graph::NavigationGrid> grid = create_random_grid(1);
+    yli::graph::AStarWorkspace a_star_workspace;
+    yli::graph::AStarWorkspace dijkstra_workspace;
+    std::mt19937 generator(2);
+    std::uniform_int_distribution<std::uint32_t> distribution(0, width * height - 1);
+    std::size_t n_found = 0;
+
+    for (std::size_t query_i = 0; query_i < 200; query_i++)
+    {
+        const std::uint32_t start = distribution(generator);
+        const std::uint32_t goal = distribution(generator);
+
+        std::vector<std::uint32_t> path;
+        float cost = 0.0f;
+        const bool is_found = yli::graph::find_path(*grid, start, goal, a_star_workspace, path, cost);
+
+        yli::graph::search(*grid, start, yli::graph::invalid_node, dijkstra_workspace);
+        const float dijkstra_cost = dijkstra_workspace.get_cost(goal);
+
+        ASSERT_EQ(is_found, dijkstra_cost < std::numeric_limits<float>::infinity());
+
+        if (is_found)
+        {
+            n_found++;
+            ASSERT_EQ(path.front(), start);
+            ASSERT_EQ(path.back(), goal);
+            ASSERT_NEAR(cost, dijkstra_cost, 1e-3f * dijkstra_cost);
+            ASSERT_NEAR(get_path_cost(*grid, path), cost, 1e-3f * cost);
+            ASSERT_LE(a_star_workspace.get_number_of_expanded_nodes(), dijkstra_workspace.get_number_of_expanded_nodes());
+        }
+    }
+
+    ASSERT_GT(n_found, 50);
+}
+
+TEST(hierarchical_pathfinder_must_find_near_optimal_paths, random_grid)
+{
+    const std::shared_ptr<const yli::graph::NavigationGrid> grid = create_random_grid(3);
+    const yli::graph::HierarchicalPathfinder hierarchical_pathfinder(grid, 8);
+    ASSERT_EQ(hierarchical_pathfinder.get_cluster_size(), 8);
+    ASSERT_EQ(hierarchical_pathfinder.get_number_of_clusters(), 9 * 7);
+    ASSERT_GT(hierarchical_pathfinder.get_number_of_abstract_nodes(), 0);
+    ASSERT_GT(hierarchical_pathfinder.get_number_of_abstract_edges(), 0);
+
+    yli::graph::AStarWorkspace workspace;
+    std::mt19937 generator(4);
+    std::uniform_int_distribution<std::uint32_t> distribution(0, width * height - 1);
+    std::size_t n_found = 0;
+    float total_cost = 0.0f;
+    float total_optimal_cost = 0.0f;
+
+    for (std::size_t query_i = 0; query_i < 300; query_i++)
+    {
+        const std::uint32_t start = distribution(generator);
+        const std::uint32_t goal = distribution(generator);
+
+        std::vector<std::uint32_t> optimal_path;
+        float optimal_cost = 0.0f;
+        const bool is_found = yli::graph::find_path(*grid, start, goal, workspace, optimal_path, optimal_cost);
+
+        std::vector<std::uint32_t> path;
+        float cost = 0.0f;
+        ASSERT_EQ(hierarchical_pathfinder.find_path(start, goal, workspace, path, cost), is_found);
+
+        if (is_found)
+        {
+            n_found++;
+            ASSERT_EQ(path.front(), start);
+            ASSERT_EQ(path.back(), goal);
+            ASSERT_NEAR(get_path_cost(*grid, path), cost, 1e-3f * cost);
+            ASSERT_GE(cost, optimal_cost * (1.0f - 1e-5f));
+            total_cost += cost;
+            total_optimal_cost += optimal_cost;
+        }
+        else
+        {
+            ASSERT_TRUE(path.empty());
+        }
+    }
+
+    ASSERT_GT(n_found, 50);
+    ASSERT_LT(total_cost, 1.15f * total_optimal_cost);
+}
+
+TEST(path_cache_must_evict_least_recently_used_paths, capacity_2)
+{
+    yli::graph::PathCache cache(2);
+    const yli::graph::PathKey key_a { yli::graph::PathDomain::GRID, 1, 2, 0 };
+    const yli::graph::PathKey key_b { yli::graph::PathDomain::GRID, 2, 1, 0 };
+    const yli::graph::PathKey key_c { yli::graph::PathDomain::GRAPH, 1, 2, 0 };
+    const yli::graph::PathKey key_d { yli::graph::PathDomain::GRID, 1, 2, 1 };
+
+    cache.insert(key_a, std::make_shared<const yli::graph::Path>());
+    cache.insert(key_b, std::make_shared<const yli::graph::Path>());
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_NE(cache.find(key_a), nullptr);
+    ASSERT_EQ(cache.find(key_c), nullptr);
+    ASSERT_EQ(cache.find(key_d), nullptr);
+
+    // `key_b` is now the least recently used.
+    cache.insert(key_c, std::make_shared<const yli::graph::Path>());
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_EQ(cache.find(key_b), nullptr);
+    ASSERT_NE(cache.find(key_a), nullptr);
+    ASSERT_NE(cache.find(key_c), nullptr);
+    ASSERT_EQ(cache.get_number_of_hits(), 3);
+    ASSERT_EQ(cache.get_number_of_misses(), 3);
+
+    cache.clear();
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(cache.find(key_a), nullptr);
+}
+
+TEST(path_planner_must_serve_requests_asynchronously, random_grid)
+{
+    const std::shared_ptr<const yli::graph::NavigationGrid> grid = create_random_grid(5);
+    yli::graph::PathPlanner path_planner(2, 64);
+
+    // Without navigation data no path is found.
+    ASSERT_FALSE(path_planner.find_path(yli::graph::PathDomain::GRID, 0, 1)->is_found());
+
+    path_planner.set_navigation_grid(grid, 8);
+    ASSERT_EQ(path_planner.get_navigation_grid(), grid);
+
+    std::mt19937 generator(6);
+    std::uniform_int_distribution<std::uint32_t> distribution(0, width * height - 1);
+    std::vector<std::uint32_t> starts;
+    std::vector<std::uint32_t> goals;
+    std::vector<yli::graph::PathPlanner::PathFuture> futures;
+
+    for (std::size_t query_i = 0; query_i < 40; query_i++)
+    {
+        starts.emplace_back(distribution(generator));
+        goals.emplace_back(distribution(generator));
+        futures.emplace_back(path_planner.request_path(yli::graph::PathDomain::GRID, starts.back(), goals.back()));
+    }
+
+    // Repeated requests share the search or hit the cache.
+    const yli::graph::PathPlanner::PathFuture repeated_future = path_planner.request_path(yli::graph::PathDomain::GRID, starts[0], goals[0]);
+    path_planner.finish();
+    ASSERT_EQ(path_planner.get_number_of_pending_requests(), 0);
+    ASSERT_EQ(path_planner.get_number_of_searches(), 41);
+    ASSERT_EQ(repeated_future.get(), futures[0].get());
+
+    const yli::graph::HierarchicalPathfinder hierarchical_pathfinder(grid, 8);
+    yli::graph::AStarWorkspace workspace;
+
+    for (std::size_t query_i = 0; query_i < futures.size(); query_i++)
+    {
+        const std::shared_ptr<const yli::graph::Path> path = futures[query_i].get();
+        ASSERT_NE(path, nullptr);
+
+        std::vector<std::uint32_t> expected_path;
+        float expected_cost = 0.0f;
+        ASSERT_EQ(hierarchical_pathfinder.find_path(starts[query_i], goals[query_i], workspace, expected_path, expected_cost), path->is_found());
+        ASSERT_EQ(path->nodes, expected_path);
+
+        // Served from the cache.
+        ASSERT_EQ(path_planner.find_path(yli::graph::PathDomain::GRID, starts[query_i], goals[query_i]), path);
+    }
+
+    ASSERT_GE(path_planner.get_number_of_cache_hits(), futures.size());
+
+    // New navigation data invalidates the cached paths.
+    const std::uint64_t n_searches = path_planner.get_number_of_searches();
+    path_planner.set_navigation_grid(create_random_grid(7), 8);
+    const std::shared_ptr<const yli::graph::Path> path = path_planner.find_path(yli::graph::PathDomain::GRID, starts[0], goals[0]);
+    ASSERT_NE(path, futures[0].get());
+    ASSERT_EQ(path_planner.get_number_of_searches(), n_searches + 1);
+}
+
+TEST(path_planner_must_keep_concurrently_set_navigation_data, random_grid)
+{
+    const std::shared_ptr<const yli::graph::NavigationGrid> grid = create_random_grid(8);
+    const std::shared_ptr<const yli::graph::NavigationGraph> graph = std::make_shared<const yli::graph::NavigationGraph>();
+
+    for (std::size_t round_i = 0; round_i < 20; round_i++)
+    {
+        yli::graph::PathPlanner path_planner(1, 64);
+
+        // Neither setter may overwrite what the other one has set.
+        std::thread grid_thread([&] { path_planner.set_navigation_grid(grid, 8); });
+        path_planner.set_navigation_graph(graph);
+        grid_thread.join();
+
+        ASSERT_EQ(path_planner.get_navigation_grid(), grid);
+        ASSERT_EQ(path_planner.get_navigation_graph(), graph);
+    }
+}
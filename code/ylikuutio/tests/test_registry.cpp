@@ -24,6 +24,8 @@
 #include "code/ylikuutio/ontology/entity_factory.hpp"
 
 // Include standard headers
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint64_t
 #include <string>        // std::string
 #include <unordered_map> // std::unordered_map
 #include <vector>        // std::vector
@@ -93,6 +95,110 @@ TEST(uninitialized_registry_must_return_an_empty_entity_map, registry)
     ASSERT_EQ(entity_map.size(), 0);
 }
 
+TEST(registry_generation_must_change_when_names_change, universe_foo)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    yli::ontology::Registry registry;
+    const std::uint64_t initial_generation = registry.get_universe_generation();
+
+    registry.add_entity(universe, "foo");
+    const std::uint64_t generation_after_add = registry.get_universe_generation();
+    ASSERT_NE(generation_after_add, initial_generation);
+
+    registry.add_entity(universe, "foo"); // Already bound, nothing changes.
+    ASSERT_EQ(registry.get_universe_generation(), generation_after_add);
+
+    registry.erase_entity("foo");
+    ASSERT_NE(registry.get_universe_generation(), generation_after_add);
+}
+
+TEST(registry_generation_must_be_shared_by_the_registries_of_a_universe, universe_foo)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    yli::ontology::Registry registry(&universe.registry);
+    const std::uint64_t initial_generation = universe.registry.get_universe_generation();
+    ASSERT_EQ(registry.get_universe_generation(), initial_generation);
+
+    registry.add_entity(universe, "foo");
+    ASSERT_NE(universe.registry.get_universe_generation(), initial_generation);
+    ASSERT_EQ(registry.get_universe_generation(), universe.registry.get_universe_generation());
+
+    // Other `Universe`s have generations of their own.
+    const yli::ontology::Registry other_registry;
+    ASSERT_EQ(other_registry.get_universe_generation(), 1);
+}
+
+TEST(registry_name_generation_must_change_only_when_that_name_changes, universe_foo_bar)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    yli::ontology::Registry registry;
+
+    // Querying a name that has never been bound does not create its generation.
+    ASSERT_EQ(registry.get_name_generation("foo"), nullptr);
+    ASSERT_EQ(registry.get_name_generation("foo"), nullptr);
+
+    registry.add_entity(universe, "foo");
+    const std::size_t* const foo_generation = registry.get_name_generation("foo");
+    ASSERT_NE(foo_generation, nullptr);
+    const std::size_t foo_generation_after_add = *foo_generation;
+
+    // Binding other names does not invalidate the lookups of "foo".
+    registry.add_entity(universe, "bar");
+    registry.erase_entity("bar");
+    ASSERT_EQ(*foo_generation, foo_generation_after_add);
+    ASSERT_EQ(registry.get_name_generation("foo"), foo_generation);
+
+    registry.erase_entity("foo");
+    ASSERT_NE(*foo_generation, foo_generation_after_add);
+
+    // The generation of an erased name remains, so that its cached lookups are invalidated.
+    ASSERT_EQ(registry.get_name_generation("foo"), foo_generation);
+}
+
+TEST(registry_batch_must_bind_names_at_once_and_complete_them, universe_foo_bar_baz)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    yli::ontology::Registry registry;
+    registry.begin_batch();
+    registry.begin_batch(); // Batches may be nested.
+    registry.add_entity(universe, "foo");
+    registry.add_entity(universe, "baz");
+    registry.add_entity(universe, "foo"); // Already bound, nothing changes.
+    ASSERT_TRUE(registry.is_entity("foo"));
+    ASSERT_TRUE(registry.is_entity("baz"));
+    ASSERT_EQ(registry.get_entity("foo"), &universe);
+
+    registry.end_batch();
+    registry.add_entity(universe, "bar");
+    registry.erase_entity("baz");
+    ASSERT_FALSE(registry.is_entity("baz"));
+    registry.end_batch();
+
+    ASSERT_EQ(registry.get_completions(""), std::vector<std::string>({ "bar", "foo" }));
+    ASSERT_EQ(registry.complete("f"), "foo");
+}
+
+TEST(registry_batch_must_not_hide_names_from_completion_queries, universe_foo)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    yli::ontology::Registry registry;
+    registry.begin_batch();
+    registry.add_entity(universe, "foo");
+    ASSERT_EQ(registry.get_number_of_completions("f"), 1);
+    registry.end_batch();
+    ASSERT_EQ(registry.get_number_of_completions("f"), 1);
+}
+
 TEST(generic_parent_module_must_bind_to_registry_appropriately, generic_parent_module_foo)
 {
     mock::MockApplication application;
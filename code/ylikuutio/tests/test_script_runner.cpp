@@ -0,0 +1,159 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/mock/mock_application.hpp"
+#include "code/ylikuutio/console/script_runner.hpp"
+#include "code/ylikuutio/console/console_logic_module.hpp"
+#include "code/ylikuutio/ontology/console.hpp"
+#include "code/ylikuutio/ontology/request.hpp"
+#include "code/ylikuutio/ontology/console_struct.hpp"
+#include "code/ylikuutio/ontology/callback_magic_numbers.hpp"
+#include "code/ylikuutio/data/any_value.hpp"
+
+// Include standard headers
+#include <cstdint>  // std::uint32_t
+#include <cstdio>   // std::remove
+#include <fstream>  // std::ofstream
+#include <optional> // std::optional
+#include <string>   // std::string
+#include <variant>  // std::get, std::holds_alternative
+
+using yli::ontology::Console;
+
+namespace
+{
+    std::uint32_t sum = 0;
+
+    std::optional<yli::data::AnyValue> add(const std::uint32_t value)
+    {
+        sum += value;
+        return std::nullopt;
+    }
+
+    std::optional<yli::data::AnyValue> stop()
+    {
+        return yli::data::AnyValue(static_cast<std::uint32_t>(yli::ontology::CallbackMagicNumber::EXIT_PROGRAM));
+    }
+
+    Console* create_console_with_commands(mock::MockApplication& application)
+    {
+        yli::ontology::ConsoleStruct console_struct(0, 39, 15, 0); // Some dummy dimensions.
+        Console* const console = application.get_generic_entity_factory().create_console(console_struct);
+        application.get_entity_factory().create_console_lisp_function_overload(
+                "add", yli::ontology::Request<Console>(console), &add);
+        application.get_entity_factory().create_console_lisp_function_overload(
+                "stop", yli::ontology::Request<Console>(console), &stop);
+        return console;
+    }
+}
+
+TEST(script_runner_must_run_commands, comments_and_empty_lines_are_skipped)
+{
+    mock::MockApplication application;
+    Console* const console = create_console_with_commands(application);
+    sum = 0;
+
+    yli::console::ScriptRunner script_runner(*console);
+    ASSERT_FALSE(script_runner.run("; a comment\nadd 1\n\r\nadd 2\r\n\nadd 3"));
+    ASSERT_EQ(sum, 6);
+    ASSERT_EQ(script_runner.get_n_lines(), 6);
+    ASSERT_EQ(script_runner.get_n_commands(), 3);
+    ASSERT_EQ(script_runner.get_n_unknown_commands(), 0);
+}
+
+TEST(script_runner_must_run_commands, unknown_commands_are_counted_and_skipped)
+{
+    mock::MockApplication application;
+    Console* const console = create_console_with_commands(application);
+    sum = 0;
+
+    yli::console::ScriptRunner script_runner(*console);
+    ASSERT_FALSE(script_runner.run("add 1\nfoo 2\nadd 4"));
+    ASSERT_EQ(sum, 5);
+    ASSERT_EQ(script_runner.get_n_commands(), 3);
+    ASSERT_EQ(script_runner.get_n_unknown_commands(), 1);
+}
+
+TEST(script_runner_must_run_commands, commands_created_between_runs_are_found)
+{
+    mock::MockApplication application;
+    yli::ontology::ConsoleStruct console_struct(0, 39, 15, 0); // Some dummy dimensions.
+    Console* const console = application.get_generic_entity_factory().create_console(console_struct);
+    sum = 0;
+
+    yli::console::ScriptRunner script_runner(*console);
+    ASSERT_FALSE(script_runner.run("add 1"));
+    ASSERT_EQ(sum, 0);
+    ASSERT_EQ(script_runner.get_n_unknown_commands(), 1);
+
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "add", yli::ontology::Request<Console>(console), &add);
+    ASSERT_FALSE(script_runner.run("add 1"));
+    ASSERT_EQ(sum, 1);
+    ASSERT_EQ(script_runner.get_n_unknown_commands(), 1);
+}
+
+TEST(script_runner_must_stop, at_exit_program)
+{
+    mock::MockApplication application;
+    Console* const console = create_console_with_commands(application);
+    sum = 0;
+
+    yli::console::ScriptRunner script_runner(*console);
+    const std::optional<yli::data::AnyValue> exit_value = script_runner.run("add 1\nstop\nadd 2");
+    ASSERT_TRUE(exit_value);
+    ASSERT_TRUE(exit_value->holds<std::uint32_t>());
+    ASSERT_EQ(exit_value->get<std::uint32_t>(), yli::ontology::CallbackMagicNumber::EXIT_PROGRAM);
+    ASSERT_EQ(sum, 1);
+    ASSERT_EQ(script_runner.get_n_commands(), 2);
+}
+
+TEST(script_runner_must_run_file, source_runs_file_contents)
+{
+    mock::MockApplication application;
+    Console* const console = create_console_with_commands(application);
+    sum = 0;
+
+    const std::string filename = "test_script_runner_source.txt";
+    {
+        std::ofstream file(filename);
+        file << "; set up\nadd 10\nadd 20\n";
+    }
+
+    ASSERT_FALSE(yli::console::ConsoleLogicModule::source(*console, filename));
+    ASSERT_EQ(sum, 30);
+
+    // The same file through the `source` console command.
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "source", yli::ontology::Request<Console>(console), &yli::console::ConsoleLogicModule::source);
+    ASSERT_FALSE(console->execute_command("source " + filename));
+    ASSERT_EQ(sum, 60);
+
+    std::remove(filename.c_str());
+}
+
+TEST(script_runner_must_run_file, nonexistent_file_is_not_loaded)
+{
+    mock::MockApplication application;
+    Console* const console = create_console_with_commands(application);
+
+    yli::console::ScriptRunner script_runner(*console);
+    ASSERT_FALSE(script_runner.run_file("this_file_does_not_exist.txt"));
+    ASSERT_FALSE(script_runner.get_is_file_loaded());
+    ASSERT_EQ(script_runner.get_n_commands(), 0);
+}
@@ -17,14 +17,17 @@
 
 #include "gtest/gtest.h"
 #include "code/ylikuutio/console/scrollback_buffer.hpp"
+#include "code/ylikuutio/console/scrollback_buffer_view.hpp"
 #include "code/ylikuutio/console/text_input.hpp"
 
 // Include standard headers
-#include <cstddef>  // std::size_t
-#include <limits>   // std::numeric_limits
-#include <optional> // std::optional
-#include <span>     // std::span
-#include <string>   // std::string
+#include <cstddef>     // std::size_t
+#include <filesystem>  // std::filesystem
+#include <limits>      // std::numeric_limits
+#include <optional>    // std::optional
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <vector>      // std::vector
 
 TEST(scrollback_buffer_must_be_initialized_appropriately, n_columns_0_n_rows_0)
 {
@@ -171,40 +174,40 @@ TEST(adding_a_line_of_n_columns_of_1_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(0), text_line);
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
@@ -214,16 +217,16 @@ TEST(adding_a_line_of_n_columns_of_1_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
 }
@@ -242,40 +245,40 @@ TEST(adding_a_line_of_n_columns_of_1_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(0), text_line);
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
@@ -285,16 +288,16 @@ TEST(adding_a_line_of_n_columns_of_1_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
 }
@@ -313,40 +316,40 @@ TEST(adding_a_line_of_n_columns_of_1_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(0), text_line);
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
@@ -356,16 +359,16 @@ TEST(adding_a_line_of_n_columns_of_1_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
 }
@@ -385,44 +388,44 @@ TEST(adding_a_line_of_n_columns_of_2_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(1), std::string("b"));
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("a"));
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("a"));
-        const std::string& text_line_1_from_buffer = buffer_view_top_index_0_max_size_2.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_top_index_0_max_size_2[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("b"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("b"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("a"));
-        const std::string& text_line_1_from_buffer = buffer_view_bottom_max_size_2.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_bottom_max_size_2[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("b"));
     }
     {
@@ -432,16 +435,16 @@ TEST(adding_a_line_of_n_columns_of_2_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("b"));
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("b"));
     }
 }
@@ -460,40 +463,40 @@ TEST(adding_a_line_of_n_columns_of_2_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(0), text_line);
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
@@ -503,16 +506,16 @@ TEST(adding_a_line_of_n_columns_of_2_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
 }
@@ -531,40 +534,40 @@ TEST(adding_a_line_of_n_columns_of_2_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(0), text_line);
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
@@ -574,16 +577,16 @@ TEST(adding_a_line_of_n_columns_of_2_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
 }
@@ -604,55 +607,55 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(2), std::string("c"));
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("a"));
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("a"));
-        const std::string& text_line_1_from_buffer = buffer_view_top_index_0_max_size_2.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_top_index_0_max_size_2[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("b"));
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 3 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 3);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 3);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 3);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("a"));
-        const std::string& text_line_1_from_buffer = buffer_view_top_index_0_max_size_2.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_top_index_0_max_size_2[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("b"));
-        const std::string& text_line_2_from_buffer = buffer_view_top_index_0_max_size_2.data()[2];
+        const std::string_view text_line_2_from_buffer = buffer_view_top_index_0_max_size_2[2];
         ASSERT_EQ(text_line_2_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("b"));
-        const std::string& text_line_1_from_buffer = buffer_view_bottom_max_size_2.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_bottom_max_size_2[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("c"));
     }
     {
@@ -662,16 +665,16 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
 }
@@ -691,58 +694,58 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(1), std::string("c"));
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("ab"));
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("ab"));
-        const std::string& text_line_1_from_buffer = buffer_view_top_index_0_max_size_2.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_top_index_0_max_size_2[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 3 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_3 = scrollback_buffer.get_view(0, 3);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_3 = scrollback_buffer.get_view(0, 3);
         ASSERT_EQ(buffer_view_top_index_0_max_size_3.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_3.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_3[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("ab"));
-        const std::string& text_line_1_from_buffer = buffer_view_top_index_0_max_size_3.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_top_index_0_max_size_3[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("ab"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 3 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_3 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_3 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_3.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_3.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_3[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("ab"));
     }
     {
@@ -752,16 +755,16 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
 }
@@ -780,40 +783,40 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(0), text_line);
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
@@ -823,16 +826,16 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
 }
@@ -856,66 +859,66 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(2), std::string("c"));
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("a"));
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("a"));
-        const std::string& text_line_1_from_buffer = buffer_view_top_index_0_max_size_2.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_top_index_0_max_size_2[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("b"));
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 3 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 3);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 3);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 3);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("a"));
-        const std::string& text_line_1_from_buffer = buffer_view_top_index_0_max_size_2.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_top_index_0_max_size_2[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("b"));
-        const std::string& text_line_2_from_buffer = buffer_view_top_index_0_max_size_2.data()[2];
+        const std::string_view text_line_2_from_buffer = buffer_view_top_index_0_max_size_2[2];
         ASSERT_EQ(text_line_2_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("b"));
-        const std::string& text_line_1_from_buffer = buffer_view_bottom_max_size_2.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_bottom_max_size_2[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 3 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_3 = scrollback_buffer.get_view_to_last(3);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_3 = scrollback_buffer.get_view_to_last(3);
         ASSERT_EQ(buffer_view_bottom_max_size_3.size(), 3);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_3.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_3[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("a"));
-        const std::string& text_line_1_from_buffer = buffer_view_bottom_max_size_3.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_bottom_max_size_3[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("b"));
-        const std::string& text_line_2_from_buffer = buffer_view_bottom_max_size_3.data()[2];
+        const std::string_view text_line_2_from_buffer = buffer_view_bottom_max_size_3[2];
         ASSERT_EQ(text_line_2_from_buffer, std::string("c"));
     }
     {
@@ -925,16 +928,16 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
 }
@@ -957,44 +960,44 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(1), std::string("c"));
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("ab"));
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("ab"));
-        const std::string& text_line_1_from_buffer = buffer_view_top_index_0_max_size_2.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_top_index_0_max_size_2[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 2);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("ab"));
-        const std::string& text_line_1_from_buffer = buffer_view_bottom_max_size_2.data()[1];
+        const std::string_view text_line_1_from_buffer = buffer_view_bottom_max_size_2[1];
         ASSERT_EQ(text_line_1_from_buffer, std::string("c"));
     }
     {
@@ -1004,16 +1007,16 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, std::string("c"));
     }
 }
@@ -1035,40 +1038,40 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.at(0), text_line);
     {
         // Get view to scrollback buffer from the top (start index = 0), max 0 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_0 = scrollback_buffer.get_view(0, 0);
         ASSERT_TRUE(buffer_view_top_index_0_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 1 line.
-        std::span<const std::string> buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_1 = scrollback_buffer.get_view(0, 1);
         ASSERT_EQ(buffer_view_top_index_0_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the top (start index = 0), max 2 lines.
-        std::span<const std::string> buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
+        const yli::console::ScrollbackBufferView buffer_view_top_index_0_max_size_2 = scrollback_buffer.get_view(0, 2);
         ASSERT_EQ(buffer_view_top_index_0_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_top_index_0_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_top_index_0_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 0 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_0 = scrollback_buffer.get_view_to_last(0);
         ASSERT_TRUE(buffer_view_bottom_max_size_0.empty());
     }
     {
         // Get view to scrollback buffer from the bottom, max 1 line.
-        std::span<const std::string> buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_1 = scrollback_buffer.get_view_to_last(1);
         ASSERT_EQ(buffer_view_bottom_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the bottom, max 2 lines.
-        std::span<const std::string> buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
+        const yli::console::ScrollbackBufferView buffer_view_bottom_max_size_2 = scrollback_buffer.get_view_to_last(2);
         ASSERT_EQ(buffer_view_bottom_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_bottom_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_bottom_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
@@ -1078,16 +1081,16 @@ TEST(adding_a_line_of_n_columns_of_3_must_work_properly, scrollback_buffer_with_
     }
     {
         // Get view to scrollback buffer from the current index, max 1 line.
-        std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 1);
         ASSERT_EQ(buffer_view_max_size_1.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_1.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_1[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
     {
         // Get view to scrollback buffer from the current index, max 2 lines.
-        std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
+        const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view(scrollback_buffer.get_buffer_index(), 2);
         ASSERT_EQ(buffer_view_max_size_2.size(), 1);
-        const std::string& text_line_0_from_buffer = buffer_view_max_size_2.data()[0];
+        const std::string_view text_line_0_from_buffer = buffer_view_max_size_2[0];
         ASSERT_EQ(text_line_0_from_buffer, text_line);
     }
 }
@@ -1116,11 +1119,11 @@ TEST(scrollback_buffer_begin_iterator_must_work_appropriately, scrollback_buffer
     }
 
     auto it = scrollback_buffer.begin();
-    ASSERT_EQ((*it).data(), abc_char_container);
+    ASSERT_EQ(*it, abc_char_container);
     ++it;
-    ASSERT_EQ((*it).data(), def_char_container);
+    ASSERT_EQ(*it, def_char_container);
     ++it;
-    ASSERT_EQ((*it).data(), ghi_char_container);
+    ASSERT_EQ(*it, ghi_char_container);
     ++it;
     ASSERT_EQ(it, scrollback_buffer.end());
 }
@@ -1149,11 +1152,11 @@ TEST(scrollback_buffer_cbegin_iterator_must_work_appropriately, scrollback_buffe
     }
 
     auto it = scrollback_buffer.cbegin();
-    ASSERT_EQ((*it).data(), abc_char_container);
+    ASSERT_EQ(*it, abc_char_container);
     ++it;
-    ASSERT_EQ((*it).data(), def_char_container);
+    ASSERT_EQ(*it, def_char_container);
     ++it;
-    ASSERT_EQ((*it).data(), ghi_char_container);
+    ASSERT_EQ(*it, ghi_char_container);
     ++it;
     ASSERT_EQ(it, scrollback_buffer.cend());
 }
@@ -1183,11 +1186,11 @@ TEST(scrollback_buffer_end_iterator_must_work_appropriately, scrollback_buffer_n
 
     auto it = scrollback_buffer.end();
     --it;
-    ASSERT_EQ((*it).data(), ghi_char_container);
+    ASSERT_EQ(*it, ghi_char_container);
     --it;
-    ASSERT_EQ((*it).data(), def_char_container);
+    ASSERT_EQ(*it, def_char_container);
     --it;
-    ASSERT_EQ((*it).data(), abc_char_container);
+    ASSERT_EQ(*it, abc_char_container);
     ASSERT_EQ(it, scrollback_buffer.begin());
 }
 
@@ -1216,11 +1219,11 @@ TEST(scrollback_buffer_cend_iterator_must_work_appropriately, scrollback_buffer_
 
     auto it = scrollback_buffer.cend();
     --it;
-    ASSERT_EQ((*it).data(), ghi_char_container);
+    ASSERT_EQ(*it, ghi_char_container);
     --it;
-    ASSERT_EQ((*it).data(), def_char_container);
+    ASSERT_EQ(*it, def_char_container);
     --it;
-    ASSERT_EQ((*it).data(), abc_char_container);
+    ASSERT_EQ(*it, abc_char_container);
     ASSERT_EQ(it, scrollback_buffer.cbegin());
 }
 
@@ -1234,10 +1237,10 @@ TEST(emplacing_back_a_n_columns_of_1_must_work_properly, scrollback_buffer_with_
     ASSERT_EQ(scrollback_buffer.get_n_columns(), 1);
     ASSERT_EQ(scrollback_buffer.get_n_rows(), 2);
     ASSERT_EQ(scrollback_buffer.get_buffer_index(), std::numeric_limits<std::size_t>::max());
-    std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view_to_last(1);
+    const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view_to_last(1);
     ASSERT_EQ(buffer_view_max_size_1.size(), 1);
     ASSERT_EQ(buffer_view_max_size_1[0], text_line);
-    std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view_to_last(2);
+    const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view_to_last(2);
     ASSERT_EQ(buffer_view_max_size_2.size(), 1);
     ASSERT_EQ(buffer_view_max_size_2[0], text_line);
     ASSERT_EQ(scrollback_buffer.at(0), text_line);
@@ -1253,11 +1256,179 @@ TEST(pushing_back_a_n_columns_of_1_must_work_properly, scrollback_buffer_with_n_
     ASSERT_EQ(scrollback_buffer.get_n_columns(), 1);
     ASSERT_EQ(scrollback_buffer.get_n_rows(), 2);
     ASSERT_EQ(scrollback_buffer.get_buffer_index(), std::numeric_limits<std::size_t>::max());
-    std::span<const std::string> buffer_view_max_size_1 = scrollback_buffer.get_view_to_last(1);
+    const yli::console::ScrollbackBufferView buffer_view_max_size_1 = scrollback_buffer.get_view_to_last(1);
     ASSERT_EQ(buffer_view_max_size_1.size(), 1);
     ASSERT_EQ(buffer_view_max_size_1[0], text_line);
-    std::span<const std::string> buffer_view_max_size_2 = scrollback_buffer.get_view_to_last(2);
+    const yli::console::ScrollbackBufferView buffer_view_max_size_2 = scrollback_buffer.get_view_to_last(2);
     ASSERT_EQ(buffer_view_max_size_2.size(), 1);
     ASSERT_EQ(buffer_view_max_size_2[0], text_line);
     ASSERT_EQ(scrollback_buffer.at(0), text_line);
 }
+
+TEST(scrollback_buffer_must_evict_oldest_lines, max_n_lines_3)
+{
+    yli::console::ScrollbackBuffer scrollback_buffer(4, 2, 3);
+    ASSERT_EQ(scrollback_buffer.get_max_n_lines(), 3);
+
+    for (const std::string text : { "a", "bb", "ccc", "dddd", "ee" })
+    {
+        scrollback_buffer.add_to_buffer(text);
+    }
+
+    ASSERT_EQ(scrollback_buffer.size(), 3);
+    ASSERT_EQ(scrollback_buffer.at(0), "ccc");
+    ASSERT_EQ(scrollback_buffer.at(1), "dddd");
+    ASSERT_EQ(scrollback_buffer.at(2), "ee");
+
+    // The view wraps around the end of the line ring.
+    const yli::console::ScrollbackBufferView view = scrollback_buffer.get_view_to_last(3);
+    ASSERT_EQ(view.size(), 3);
+    ASSERT_EQ(view[0], "ccc");
+    ASSERT_EQ(view[1], "dddd");
+    ASSERT_EQ(view[2], "ee");
+
+    std::vector<std::string_view> lines;
+
+    for (auto it = scrollback_buffer.cbegin(); it != scrollback_buffer.cend(); ++it)
+    {
+        lines.emplace_back(*it);
+    }
+
+    ASSERT_EQ(lines, std::vector<std::string_view>({ "ccc", "dddd", "ee" }));
+}
+
+TEST(scrollback_buffer_must_evict_oldest_lines, arena_full)
+{
+    // The arena has 3 * 4 = 12 bytes.
+    yli::console::ScrollbackBuffer scrollback_buffer(4, 2, 3);
+    scrollback_buffer.emplace_back("aaaa");
+    scrollback_buffer.emplace_back("bbbb");
+    scrollback_buffer.emplace_back("cc");
+
+    // 10 bytes are used, "ddd" does not fit in the end of the arena.
+    // It is written to the beginning of the arena, so "aaaa" is evicted.
+    scrollback_buffer.emplace_back("ddd");
+    ASSERT_EQ(scrollback_buffer.size(), 3);
+    ASSERT_EQ(scrollback_buffer.at(0), "bbbb");
+    ASSERT_EQ(scrollback_buffer.at(1), "cc");
+    ASSERT_EQ(scrollback_buffer.at(2), "ddd");
+
+    // "eeee" overwrites the first byte of "bbbb".
+    scrollback_buffer.emplace_back("eeee");
+    ASSERT_EQ(scrollback_buffer.size(), 3);
+    ASSERT_EQ(scrollback_buffer.at(0), "cc");
+    ASSERT_EQ(scrollback_buffer.at(1), "ddd");
+    ASSERT_EQ(scrollback_buffer.at(2), "eeee");
+
+    // A line longer than the arena is truncated to the arena size.
+    scrollback_buffer.emplace_back("0123456789abcdef");
+    ASSERT_EQ(scrollback_buffer.size(), 3);
+    ASSERT_EQ(scrollback_buffer.at(0), "0123");
+    ASSERT_EQ(scrollback_buffer.at(2), "89ab");
+    ASSERT_EQ(scrollback_buffer.line_at(2), "0123456789ab");
+}
+
+TEST(scrollback_buffer_must_evict_oldest_lines, empty_lines)
+{
+    yli::console::ScrollbackBuffer scrollback_buffer(2, 2, 2);
+    scrollback_buffer.emplace_back("");
+    scrollback_buffer.emplace_back("ab");
+    scrollback_buffer.emplace_back("");
+    ASSERT_EQ(scrollback_buffer.size(), 2);
+    ASSERT_EQ(scrollback_buffer.at(0), "ab");
+    ASSERT_EQ(scrollback_buffer.at(1), "");
+
+    scrollback_buffer.emplace_back("cd");
+    ASSERT_EQ(scrollback_buffer.size(), 2);
+    ASSERT_EQ(scrollback_buffer.at(0), "");
+    ASSERT_EQ(scrollback_buffer.at(1), "cd");
+}
+
+TEST(scrollback_buffer_must_evict_oldest_lines, while_active_in_buffer)
+{
+    // The arena has 3 * 2 = 6 bytes.
+    yli::console::ScrollbackBuffer scrollback_buffer(2, 1, 3);
+    scrollback_buffer.add_to_buffer("ab");
+    scrollback_buffer.add_to_buffer("cdef");
+    ASSERT_EQ(scrollback_buffer.size(), 3);
+    ASSERT_TRUE(scrollback_buffer.enter_buffer());
+    scrollback_buffer.move_to_previous();
+    ASSERT_EQ(scrollback_buffer.get_buffer_index(), 1);
+    ASSERT_EQ(scrollback_buffer.at(scrollback_buffer.get_buffer_index()), "cd");
+
+    // "ab" is evicted, buffer index keeps pointing to the same row.
+    scrollback_buffer.add_to_buffer("g");
+    ASSERT_EQ(scrollback_buffer.size(), 3);
+    ASSERT_EQ(scrollback_buffer.get_buffer_index(), 0);
+    ASSERT_EQ(scrollback_buffer.at(scrollback_buffer.get_buffer_index()), "cd");
+
+    // When the line is evicted, buffer index points to the oldest row.
+    scrollback_buffer.add_to_buffer("h");
+    scrollback_buffer.add_to_buffer("i");
+    ASSERT_EQ(scrollback_buffer.size(), 3);
+    ASSERT_EQ(scrollback_buffer.get_buffer_index(), 0);
+    ASSERT_EQ(scrollback_buffer.at(scrollback_buffer.get_buffer_index()), "g");
+}
+
+TEST(scrollback_buffer_find_must_work_properly, n_columns_5_n_rows_2)
+{
+    yli::console::ScrollbackBuffer scrollback_buffer(5, 2, 3);
+    scrollback_buffer.add_to_buffer("foo");
+    scrollback_buffer.add_to_buffer("bar");
+    scrollback_buffer.add_to_buffer("foo bar");
+
+    // Rows: "foo", "bar", "foo b", "ar".
+    ASSERT_EQ(scrollback_buffer.size(), 4);
+    ASSERT_EQ(scrollback_buffer.find("foo"), std::vector<std::size_t>({ 0, 2 }));
+    ASSERT_EQ(scrollback_buffer.find("ar"), std::vector<std::size_t>({ 1, 2 }));
+    ASSERT_EQ(scrollback_buffer.find("o b"), std::vector<std::size_t>({ 2 })); // Crosses the wrap.
+    ASSERT_TRUE(scrollback_buffer.find("baz").empty());
+    ASSERT_EQ(scrollback_buffer.line_at(3), "foo bar");
+    ASSERT_EQ(scrollback_buffer.line_at(1), "bar");
+}
+
+TEST(scrollback_buffer_history_must_work_properly, search_history_after_eviction)
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "ylikuutio_test_scrollback_buffer";
+    std::filesystem::create_directories(directory);
+    const std::string history_filename = (directory / "history.txt").string();
+    std::filesystem::remove(history_filename);
+
+    yli::console::ScrollbackBuffer scrollback_buffer(80, 24, 2);
+    ASSERT_TRUE(scrollback_buffer.search_history("foo", 10).empty()); // No history file.
+    ASSERT_TRUE(scrollback_buffer.set_history_file(history_filename));
+    ASSERT_EQ(scrollback_buffer.get_history_filename(), history_filename);
+    ASSERT_TRUE(scrollback_buffer.search_history("foo", 10).empty()); // Empty history file.
+
+    scrollback_buffer.add_to_buffer("foo 1");
+    scrollback_buffer.add_to_buffer("bar 2");
+    scrollback_buffer.add_to_buffer("foo 3 foo");
+    scrollback_buffer.add_to_buffer("baz 4");
+
+    ASSERT_EQ(scrollback_buffer.size(), 2);
+    ASSERT_EQ(scrollback_buffer.find("foo"), std::vector<std::size_t>({ 0 }));
+    ASSERT_EQ(scrollback_buffer.search_history("foo", 10), std::vector<std::string>({ "foo 1", "foo 3 foo" }));
+    ASSERT_EQ(scrollback_buffer.search_history("foo", 1), std::vector<std::string>({ "foo 1" }));
+    ASSERT_EQ(scrollback_buffer.search_history("4", 10), std::vector<std::string>({ "baz 4" }));
+    ASSERT_TRUE(scrollback_buffer.search_history("qux", 10).empty());
+
+    // Clearing the scrollback buffer does not clear the history.
+    scrollback_buffer.clear();
+    ASSERT_EQ(scrollback_buffer.search_history("bar", 10), std::vector<std::string>({ "bar 2" }));
+}
+
+TEST(scrollback_buffer_history_must_work_properly, search_history_across_wrap)
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "ylikuutio_test_scrollback_buffer";
+    std::filesystem::create_directories(directory);
+    const std::string history_filename = (directory / "history_across_wrap.txt").string();
+    std::filesystem::remove(history_filename);
+
+    yli::console::ScrollbackBuffer scrollback_buffer(4, 2, 2);
+    ASSERT_TRUE(scrollback_buffer.set_history_file(history_filename));
+    scrollback_buffer.add_to_buffer("foo bar");
+
+    // Rows: "foo ", "bar". The history has the whole line.
+    ASSERT_EQ(scrollback_buffer.size(), 2);
+    ASSERT_EQ(scrollback_buffer.search_history("o b", 10), std::vector<std::string>({ "foo bar" }));
+}
@@ -876,3 +876,106 @@ TEST(shapeshifter_must_be_initialized_appropriately, headless)
     ASSERT_EQ(shapeshifter->get_parent(), scene);
     ASSERT_EQ(shapeshifter->get_number_of_non_variable_children(), 0);
 }
+
+TEST(shapeshifters_must_share_morph_slots_appropriately, headless)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(scene) };
+    yli::ontology::Pipeline* const pipeline = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+
+    yli::ontology::MaterialStruct material_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(pipeline),
+            yli::ontology::TextureFileFormat::PNG };
+    yli::ontology::Material* const material = application.get_generic_entity_factory().create_material(
+            material_struct);
+
+    yli::ontology::ShapeshifterTransformationStruct shapeshifter_transformation_struct { yli::ontology::Request(material) };
+    yli::ontology::ShapeshifterTransformation* const shapeshifter_transformation = application.get_generic_entity_factory().create_shapeshifter_transformation(
+            shapeshifter_transformation_struct);
+
+    yli::ontology::ShapeshifterFormStruct shapeshifter_form_struct { yli::ontology::Request(shapeshifter_transformation) };
+    application.get_generic_entity_factory().create_shapeshifter_form(
+            shapeshifter_form_struct);
+
+    yli::ontology::ShapeshifterSequenceStruct shapeshifter_sequence_struct { yli::ontology::Request(shapeshifter_transformation) };
+    shapeshifter_sequence_struct.transformation_speed = 1.0f;
+    yli::ontology::ShapeshifterSequence* const shapeshifter_sequence = application.get_generic_entity_factory().create_shapeshifter_sequence(
+            shapeshifter_sequence_struct);
+
+    yli::ontology::ShapeshifterStruct shapeshifter_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(shapeshifter_sequence) };
+    yli::ontology::Shapeshifter* const shapeshifter1 = application.get_generic_entity_factory().create_shapeshifter(
+            shapeshifter_struct);
+
+    yli::ontology::ShapeshifterStruct shapeshifter_struct2 {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(shapeshifter_sequence) };
+    shapeshifter_struct2.morph_time_offset = 0.5f;
+    yli::ontology::Shapeshifter* const shapeshifter2 = application.get_generic_entity_factory().create_shapeshifter(
+            shapeshifter_struct2);
+    ASSERT_EQ(shapeshifter2->get_morph_time_offset(), 0.5f);
+
+    shapeshifter_transformation->animate(1.25);
+
+    // Headless forms have no vertices, and with only 1 form all `Shapeshifter`s are in the same phase.
+    ASSERT_EQ(shapeshifter_transformation->get_morph_target_buffer().get_number_of_forms(), 1);
+    ASSERT_EQ(shapeshifter_transformation->get_morph_target_buffer().get_number_of_vertices(), 0);
+    ASSERT_EQ(shapeshifter_transformation->get_morph_evaluator().get_number_of_requests(), 2);
+    ASSERT_EQ(shapeshifter_transformation->get_morph_evaluator().get_number_of_slots(), 1);
+    ASSERT_EQ(shapeshifter1->get_morph_slot(), 0);
+    ASSERT_EQ(shapeshifter2->get_morph_slot(), 0);
+}
+
+TEST(shapeshifters_must_be_animated_by_the_scene_of_their_material, headless)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(scene) };
+    yli::ontology::Pipeline* const pipeline = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+
+    yli::ontology::MaterialStruct material_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(pipeline),
+            yli::ontology::TextureFileFormat::PNG };
+    yli::ontology::Material* const material = application.get_generic_entity_factory().create_material(
+            material_struct);
+
+    yli::ontology::ShapeshifterTransformationStruct shapeshifter_transformation_struct { yli::ontology::Request(material) };
+    yli::ontology::ShapeshifterTransformation* const shapeshifter_transformation = application.get_generic_entity_factory().create_shapeshifter_transformation(
+            shapeshifter_transformation_struct);
+
+    yli::ontology::ShapeshifterFormStruct shapeshifter_form_struct { yli::ontology::Request(shapeshifter_transformation) };
+    application.get_generic_entity_factory().create_shapeshifter_form(
+            shapeshifter_form_struct);
+
+    yli::ontology::ShapeshifterSequenceStruct shapeshifter_sequence_struct { yli::ontology::Request(shapeshifter_transformation) };
+    yli::ontology::ShapeshifterSequence* const shapeshifter_sequence = application.get_generic_entity_factory().create_shapeshifter_sequence(
+            shapeshifter_sequence_struct);
+
+    yli::ontology::ShapeshifterStruct shapeshifter_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(shapeshifter_sequence) };
+    application.get_generic_entity_factory().create_shapeshifter(
+            shapeshifter_struct);
+
+    ASSERT_EQ(shapeshifter_transformation->get_morph_evaluator().get_number_of_requests(), 0);
+
+    scene->animate(1.25);
+    ASSERT_EQ(shapeshifter_transformation->get_morph_target_buffer().get_number_of_forms(), 1);
+    ASSERT_EQ(shapeshifter_transformation->get_morph_evaluator().get_number_of_requests(), 1);
+
+    // Each frame begins anew.
+    scene->animate(1.5);
+    ASSERT_EQ(shapeshifter_transformation->get_morph_evaluator().get_number_of_requests(), 1);
+}
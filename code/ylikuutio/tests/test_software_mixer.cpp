@@ -0,0 +1,393 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "gtest/gtest.h"
+#include "code/ylikuutio/audio/software_mixer.hpp"
+#include "code/ylikuutio/audio/audio_command.hpp"
+#include "code/ylikuutio/audio/audio_decoder.hpp"
+#include "code/ylikuutio/audio/audio_stream.hpp"
+#include "code/ylikuutio/audio/sound_buffer.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::min
+#include <cmath>     // std::sqrt
+#include <cstddef>   // std::size_t
+#include <memory>    // std::make_unique
+#include <span>      // std::span
+#include <vector>    // std::vector
+
+namespace
+{
+    yli::audio::SoundBuffer create_constant_sound_buffer(const std::size_t n_frames, const float left, const float right)
+    {
+        yli::audio::SoundBuffer sound_buffer;
+
+        for (std::size_t frame_i = 0; frame_i < n_frames; frame_i++)
+        {
+            sound_buffer.samples.push_back(left);
+            sound_buffer.samples.push_back(right);
+        }
+
+        return sound_buffer;
+    }
+
+    yli::audio::AudioCommand create_play_command(
+            const yli::audio::VoiceId voice_id,
+            const yli::audio::SoundBuffer* const sound_buffer,
+            const bool is_positional,
+            const glm::vec3& position)
+    {
+        yli::audio::AudioCommand command;
+        command.type = yli::audio::AudioCommandType::PLAY_VOICE;
+        command.voice_id = voice_id;
+        command.sound_buffer = sound_buffer;
+        command.is_positional = is_positional;
+        command.position = position;
+        return command;
+    }
+
+    class ConstantDecoder final : public yli::audio::AudioDecoder
+    {
+        public:
+            explicit ConstantDecoder(const std::size_t n_frames)
+                : n_frames { n_frames }
+            {
+            }
+
+            std::size_t decode(std::span<float> samples) override
+            {
+                const std::size_t n_frames_to_decode = std::min(samples.size() / 2, this->n_frames - this->frame_i);
+
+                for (std::size_t i = 0; i < 2 * n_frames_to_decode; i++)
+                {
+                    samples[i] = 0.25f;
+                }
+
+                this->frame_i += n_frames_to_decode;
+                return n_frames_to_decode;
+            }
+
+        private:
+            const std::size_t n_frames;
+            std::size_t frame_i { 0 };
+    };
+}
+
+TEST(software_mixer_must_be_initialized_appropriately, max_n_voices_4_n_block_frames_16)
+{
+    yli::audio::SoftwareMixer software_mixer(4, 16);
+    yli::audio::AudioEventQueue event_queue;
+    ASSERT_EQ(software_mixer.get_max_n_voices(), 4);
+    ASSERT_EQ(software_mixer.get_n_playing_voices(), 0);
+
+    std::vector<float> samples(2 * 40, 1.0f);
+    software_mixer.mix(samples, event_queue);
+
+    for (const float sample : samples)
+    {
+        ASSERT_EQ(sample, 0.0f);
+    }
+
+    ASSERT_TRUE(event_queue.empty());
+}
+
+TEST(software_mixer_distance_gain_must_be_computed_appropriately, clamped_inverse_distance)
+{
+    yli::audio::SoftwareMixer software_mixer(4, 16);
+    ASSERT_FLOAT_EQ(software_mixer.compute_distance_gain(0.0f), 1.0f);
+    ASSERT_FLOAT_EQ(software_mixer.compute_distance_gain(1.0f), 1.0f);
+    ASSERT_FLOAT_EQ(software_mixer.compute_distance_gain(2.0f), 0.5f);
+    ASSERT_FLOAT_EQ(software_mixer.compute_distance_gain(4.0f), 0.25f);
+
+    software_mixer.max_distance = 4.0f;
+    ASSERT_FLOAT_EQ(software_mixer.compute_distance_gain(100.0f), 0.25f);
+
+    software_mixer.rolloff_factor = 0.5f;
+    ASSERT_FLOAT_EQ(software_mixer.compute_distance_gain(3.0f), 0.5f);
+}
+
+TEST(software_mixer_pan_gains_must_be_computed_appropriately, constant_power)
+{
+    const float half_sqrt_2 = 0.5f * std::sqrt(2.0f);
+    const glm::vec2 center_gains = yli::audio::SoftwareMixer::compute_pan_gains(0.0f);
+    ASSERT_NEAR(center_gains.x, half_sqrt_2, 1e-6f);
+    ASSERT_NEAR(center_gains.y, half_sqrt_2, 1e-6f);
+
+    const glm::vec2 left_gains = yli::audio::SoftwareMixer::compute_pan_gains(-1.0f);
+    ASSERT_NEAR(left_gains.x, 1.0f, 1e-6f);
+    ASSERT_NEAR(left_gains.y, 0.0f, 1e-6f);
+
+    const glm::vec2 right_gains = yli::audio::SoftwareMixer::compute_pan_gains(1.0f);
+    ASSERT_NEAR(right_gains.x, 0.0f, 1e-6f);
+    ASSERT_NEAR(right_gains.y, 1.0f, 1e-6f);
+
+    for (float pan = -1.0f; pan <= 1.0f; pan += 0.125f)
+    {
+        const glm::vec2 gains = yli::audio::SoftwareMixer::compute_pan_gains(pan);
+        ASSERT_NEAR(gains.x * gains.x + gains.y * gains.y, 1.0f, 1e-5f);
+    }
+}
+
+TEST(software_mixer_must_mix_voices_appropriately, two_non_positional_voices_are_summed_and_finished_voices_are_reported)
+{
+    yli::audio::SoftwareMixer software_mixer(4, 16);
+    yli::audio::AudioEventQueue event_queue;
+    const yli::audio::SoundBuffer short_sound_buffer = create_constant_sound_buffer(10, 0.25f, 0.125f);
+    const yli::audio::SoundBuffer long_sound_buffer = create_constant_sound_buffer(100, 0.25f, 0.25f);
+
+    software_mixer.apply(create_play_command(1, &short_sound_buffer, false, glm::vec3(0.0f)), event_queue);
+    yli::audio::AudioCommand long_command = create_play_command(2, &long_sound_buffer, false, glm::vec3(0.0f));
+    long_command.gain = 0.5f;
+    software_mixer.apply(long_command, event_queue);
+    ASSERT_EQ(software_mixer.get_n_playing_voices(), 2);
+
+    std::vector<float> samples(2 * 16);
+    software_mixer.mix(samples, event_queue);
+
+    for (std::size_t frame_i = 0; frame_i < 10; frame_i++)
+    {
+        ASSERT_FLOAT_EQ(samples[2 * frame_i], 0.375f);
+        ASSERT_FLOAT_EQ(samples[2 * frame_i + 1], 0.25f);
+    }
+
+    for (std::size_t frame_i = 10; frame_i < 16; frame_i++)
+    {
+        ASSERT_FLOAT_EQ(samples[2 * frame_i], 0.125f);
+        ASSERT_FLOAT_EQ(samples[2 * frame_i + 1], 0.125f);
+    }
+
+    yli::audio::AudioEvent event;
+    ASSERT_TRUE(event_queue.try_pop(event));
+    ASSERT_EQ(event.type, yli::audio::AudioEventType::VOICE_FINISHED);
+    ASSERT_EQ(event.voice_id, 1);
+    ASSERT_TRUE(event_queue.empty());
+    ASSERT_EQ(software_mixer.get_n_playing_voices(), 1);
+}
+
+TEST(software_mixer_must_mix_voices_appropriately, finished_voices_are_reported_when_the_event_queue_has_room)
+{
+    yli::audio::SoftwareMixer software_mixer(4, 16);
+    yli::audio::AudioEventQueue event_queue;
+    const yli::audio::SoundBuffer short_sound_buffer = create_constant_sound_buffer(10, 0.25f, 0.125f);
+    const yli::audio::SoundBuffer long_sound_buffer = create_constant_sound_buffer(100, 0.25f, 0.25f);
+
+    // Fill the event queue.
+    std::size_t n_filler_events = 0;
+
+    while (event_queue.try_push(yli::audio::AudioEvent { yli::audio::AudioEventType::VOICE_FINISHED, 1000 }))
+    {
+        n_filler_events++;
+    }
+
+    software_mixer.apply(create_play_command(1, &short_sound_buffer, false, glm::vec3(0.0f)), event_queue);
+    software_mixer.apply(create_play_command(2, &long_sound_buffer, false, glm::vec3(0.0f)), event_queue);
+
+    std::vector<float> samples(2 * 16);
+    software_mixer.mix(samples, event_queue);
+
+    yli::audio::AudioCommand stop_command;
+    stop_command.type = yli::audio::AudioCommandType::STOP_VOICE;
+    stop_command.voice_id = 2;
+    software_mixer.apply(stop_command, event_queue);
+    ASSERT_EQ(software_mixer.get_n_playing_voices(), 0);
+    ASSERT_EQ(software_mixer.get_n_pending_events(), 2);
+
+    software_mixer.push_pending_events(event_queue);
+    ASSERT_EQ(software_mixer.get_n_pending_events(), 2);
+
+    yli::audio::AudioEvent event;
+    ASSERT_TRUE(event_queue.try_pop(event));
+    software_mixer.push_pending_events(event_queue);
+    ASSERT_EQ(software_mixer.get_n_pending_events(), 1);
+
+    for (std::size_t event_i = 1; event_i < n_filler_events; event_i++)
+    {
+        ASSERT_TRUE(event_queue.try_pop(event));
+        ASSERT_EQ(event.voice_id, 1000);
+    }
+
+    software_mixer.push_pending_events(event_queue);
+    ASSERT_EQ(software_mixer.get_n_pending_events(), 0);
+
+    // The events arrive in order.
+    ASSERT_TRUE(event_queue.try_pop(event));
+    ASSERT_EQ(event.voice_id, 1);
+    ASSERT_TRUE(event_queue.try_pop(event));
+    ASSERT_EQ(event.voice_id, 2);
+    ASSERT_TRUE(event_queue.empty());
+}
+
+TEST(software_mixer_must_mix_voices_appropriately, positional_voice_is_attenuated_and_panned_relative_to_listener)
+{
+    yli::audio::SoftwareMixer software_mixer(4, 16);
+    yli::audio::AudioEventQueue event_queue;
+    const yli::audio::SoundBuffer sound_buffer = create_constant_sound_buffer(1000, 0.5f, 0.5f);
+
+    yli::audio::AudioCommand listener_command;
+    listener_command.type = yli::audio::AudioCommandType::SET_LISTENER;
+    listener_command.position = glm::vec3(10.0f, 0.0f, 0.0f);
+    listener_command.right = glm::vec3(2.0f, 0.0f, 0.0f); // Not normalized.
+    software_mixer.apply(listener_command, event_queue);
+
+    // 2 units to the right of the listener.
+    software_mixer.apply(create_play_command(1, &sound_buffer, true, glm::vec3(12.0f, 0.0f, 0.0f)), event_queue);
+
+    std::vector<float> samples(2 * 16);
+    software_mixer.mix(samples, event_queue);
+    ASSERT_NEAR(samples[0], 0.0f, 1e-6f);
+    ASSERT_NEAR(samples[1], 0.25f, 1e-6f);
+
+    // When the listener turns around, the voice is on the left.
+    listener_command.right = glm::vec3(-1.0f, 0.0f, 0.0f);
+    software_mixer.apply(listener_command, event_queue);
+    software_mixer.mix(samples, event_queue);
+    software_mixer.mix(samples, event_queue);
+    ASSERT_NEAR(samples[0], 0.25f, 1e-6f);
+    ASSERT_NEAR(samples[1], 0.0f, 1e-6f);
+
+    // In front of the listener, 4 units away.
+    yli::audio::AudioCommand position_command;
+    position_command.type = yli::audio::AudioCommandType::SET_VOICE_POSITION;
+    position_command.voice_id = 1;
+    position_command.position = glm::vec3(10.0f, 0.0f, 4.0f);
+    software_mixer.apply(position_command, event_queue);
+    software_mixer.mix(samples, event_queue);
+    software_mixer.mix(samples, event_queue);
+    ASSERT_NEAR(samples[0], 0.5f * 0.25f * 0.5f * std::sqrt(2.0f), 1e-6f);
+    ASSERT_NEAR(samples[1], 0.5f * 0.25f * 0.5f * std::sqrt(2.0f), 1e-6f);
+}
+
+TEST(software_mixer_must_mix_voices_appropriately, gain_change_is_ramped_over_one_block)
+{
+    yli::audio::SoftwareMixer software_mixer(4, 4);
+    yli::audio::AudioEventQueue event_queue;
+    const yli::audio::SoundBuffer sound_buffer = create_constant_sound_buffer(1000, 1.0f, 1.0f);
+    software_mixer.apply(create_play_command(1, &sound_buffer, false, glm::vec3(0.0f)), event_queue);
+
+    std::vector<float> samples(2 * 4);
+    software_mixer.mix(samples, event_queue);
+    ASSERT_FLOAT_EQ(samples[0], 1.0f);
+    ASSERT_FLOAT_EQ(samples[6], 1.0f);
+
+    yli::audio::AudioCommand gain_command;
+    gain_command.type = yli::audio::AudioCommandType::SET_VOICE_GAIN;
+    gain_command.voice_id = 1;
+    gain_command.gain = 0.0f;
+    software_mixer.apply(gain_command, event_queue);
+
+    software_mixer.mix(samples, event_queue);
+    ASSERT_FLOAT_EQ(samples[0], 0.75f);
+    ASSERT_FLOAT_EQ(samples[2], 0.5f);
+    ASSERT_FLOAT_EQ(samples[4], 0.25f);
+    ASSERT_FLOAT_EQ(samples[6], 0.0f);
+
+    software_mixer.mix(samples, event_queue);
+    ASSERT_FLOAT_EQ(samples[0], 0.0f);
+}
+
+TEST(software_mixer_must_mix_voices_appropriately, looping_voice_plays_until_stopped)
+{
+    yli::audio::SoftwareMixer software_mixer(4, 16);
+    yli::audio::AudioEventQueue event_queue;
+    const yli::audio::SoundBuffer sound_buffer = create_constant_sound_buffer(3, 0.5f, 0.5f);
+    yli::audio::AudioCommand play_command = create_play_command(7, &sound_buffer, false, glm::vec3(0.0f));
+    play_command.loop = true;
+    software_mixer.apply(play_command, event_queue);
+
+    std::vector<float> samples(2 * 64);
+    software_mixer.mix(samples, event_queue);
+    software_mixer.mix(samples, event_queue);
+    ASSERT_FLOAT_EQ(samples[2 * 63], 0.5f);
+    ASSERT_TRUE(event_queue.empty());
+
+    yli::audio::AudioCommand stop_command;
+    stop_command.type = yli::audio::AudioCommandType::STOP_VOICE;
+    stop_command.voice_id = 7;
+    software_mixer.apply(stop_command, event_queue);
+    ASSERT_EQ(software_mixer.get_n_playing_voices(), 0);
+
+    yli::audio::AudioEvent event;
+    ASSERT_TRUE(event_queue.try_pop(event));
+    ASSERT_EQ(event.voice_id, 7);
+
+    software_mixer.mix(samples, event_queue);
+    ASSERT_FLOAT_EQ(samples[0], 0.0f);
+}
+
+TEST(software_mixer_must_mix_voices_appropriately, voice_is_dropped_when_all_voices_are_in_use)
+{
+    yli::audio::SoftwareMixer software_mixer(2, 16);
+    yli::audio::AudioEventQueue event_queue;
+    const yli::audio::SoundBuffer sound_buffer = create_constant_sound_buffer(100, 0.25f, 0.25f);
+
+    software_mixer.apply(create_play_command(1, &sound_buffer, false, glm::vec3(0.0f)), event_queue);
+    software_mixer.apply(create_play_command(2, &sound_buffer, false, glm::vec3(0.0f)), event_queue);
+    software_mixer.apply(create_play_command(3, &sound_buffer, false, glm::vec3(0.0f)), event_queue);
+    ASSERT_EQ(software_mixer.get_n_playing_voices(), 2);
+
+    yli::audio::AudioEvent event;
+    ASSERT_TRUE(event_queue.try_pop(event));
+    ASSERT_EQ(event.voice_id, 3);
+    ASSERT_TRUE(event_queue.empty());
+
+    yli::audio::AudioCommand stop_all_command;
+    stop_all_command.type = yli::audio::AudioCommandType::STOP_ALL_VOICES;
+    software_mixer.apply(stop_all_command, event_queue);
+    ASSERT_EQ(software_mixer.get_n_playing_voices(), 0);
+    ASSERT_TRUE(event_queue.try_pop(event));
+    ASSERT_TRUE(event_queue.try_pop(event));
+    ASSERT_TRUE(event_queue.empty());
+}
+
+TEST(software_mixer_must_mix_voices_appropriately, streamed_voice_is_decoded_in_chunks_and_finishes_at_its_end)
+{
+    yli::audio::SoftwareMixer software_mixer(4, 16);
+    yli::audio::AudioEventQueue event_queue;
+    yli::audio::AudioStream audio_stream(std::make_unique<ConstantDecoder>(100), 16, 2);
+    audio_stream.refill();
+
+    yli::audio::AudioCommand play_command;
+    play_command.type = yli::audio::AudioCommandType::PLAY_VOICE;
+    play_command.voice_id = 5;
+    play_command.audio_stream = &audio_stream;
+    software_mixer.apply(play_command, event_queue);
+
+    std::vector<float> samples(2 * 16);
+    std::size_t n_blocks = 0;
+
+    while (event_queue.empty() && n_blocks < 100)
+    {
+        software_mixer.mix(samples, event_queue);
+        software_mixer.refill_streams();
+        n_blocks++;
+    }
+
+    // 100 frames are 7 blocks of 16 frames, the last one partly silent.
+    ASSERT_EQ(n_blocks, 7);
+    ASSERT_FLOAT_EQ(samples[2 * 3], 0.25f);
+    ASSERT_FLOAT_EQ(samples[2 * 4], 0.0f);
+    ASSERT_EQ(audio_stream.get_n_decoded_frames(), 100);
+
+    yli::audio::AudioEvent event;
+    ASSERT_TRUE(event_queue.try_pop(event));
+    ASSERT_EQ(event.voice_id, 5);
+}
@@ -0,0 +1,292 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#include "gtest/gtest.h"
+#include "code/ylikuutio/geometry/spatial_hash_grid.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <algorithm> // std::min, std::sort
+#include <cmath>     // NAN
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::int32_t, std::uint32_t, std::uintptr_t
+#include <random>    // std::mt19937, std::uniform_int_distribution, std::uniform_real_distribution
+#include <vector>    // std::vector
+
+namespace
+{
+    void* to_user_data(const std::uintptr_t value)
+    {
+        return reinterpret_cast<void*>(value);
+    }
+
+    std::vector<std::int32_t> get_sorted_proxy_ids(const std::vector<yli::geometry::SpatialNeighbour>& neighbours)
+    {
+        std::vector<std::int32_t> proxy_ids;
+
+        for (const yli::geometry::SpatialNeighbour& neighbour : neighbours)
+        {
+            proxy_ids.emplace_back(neighbour.proxy_id);
+        }
+
+        std::sort(proxy_ids.begin(), proxy_ids.end());
+        return proxy_ids;
+    }
+
+    bool is_accepted(const yli::geometry::SpatialQueryFilter& filter, const std::uint32_t group, const std::int32_t proxy_id)
+    {
+        if (proxy_id == filter.excluded_proxy_id)
+        {
+            return false;
+        }
+
+        return filter.relation == yli::geometry::GroupRelation::ANY ||
+            (filter.relation == yli::geometry::GroupRelation::SAME && group == filter.group) ||
+            (filter.relation == yli::geometry::GroupRelation::OTHER && group != filter.group);
+    }
+
+    // Distances squared of all accepted points, nearest first.
+    std::vector<float> get_brute_force_distances(
+            const std::vector<glm::vec3>& points,
+            const std::vector<std::uint32_t>& groups,
+            const std::vector<bool>& is_alive,
+            const glm::vec3& center,
+            const yli::geometry::SpatialQueryFilter& filter)
+    {
+        std::vector<float> distances;
+
+        for (std::size_t i = 0; i < points.size(); i++)
+        {
+            if (is_alive[i] && is_accepted(filter, groups[i], static_cast<std::int32_t>(i)))
+            {
+                const glm::vec3 difference = points[i] - center;
+                distances.emplace_back(glm::dot(difference, difference));
+            }
+        }
+
+        std::sort(distances.begin(), distances.end());
+        return distances;
+    }
+}
+
+TEST(spatial_hash_grid_must_be_initialized_appropriately, empty_grid)
+{
+    const yli::geometry::SpatialHashGrid grid(4.0f);
+    ASSERT_EQ(grid.get_number_of_proxies(), 0);
+    ASSERT_EQ(grid.get_number_of_cells(), 0);
+    ASSERT_EQ(grid.get_cell_size(), 4.0f);
+    ASSERT_TRUE(grid.validate());
+
+    std::vector<yli::geometry::SpatialNeighbour> neighbours;
+    grid.query_radius(glm::vec3(0.0f), 100.0f, yli::geometry::SpatialQueryFilter(), neighbours);
+    ASSERT_TRUE(neighbours.empty());
+    grid.query_nearest(glm::vec3(0.0f), 5, yli::geometry::SpatialQueryFilter(), neighbours);
+    ASSERT_TRUE(neighbours.empty());
+}
+
+TEST(spatial_hash_grid_must_work_appropriately, create_move_and_destroy_proxies)
+{
+    yli::geometry::SpatialHashGrid grid(4.0f);
+    const std::int32_t first_proxy_id = grid.create_proxy(glm::vec3(1.0f, 1.0f, 1.0f), 0, to_user_data(1));
+    const std::int32_t second_proxy_id = grid.create_proxy(glm::vec3(2.0f, 1.0f, 1.0f), 1, to_user_data(2));
+    ASSERT_EQ(grid.get_number_of_proxies(), 2);
+    ASSERT_EQ(grid.get_number_of_cells(), 1);
+    ASSERT_EQ(grid.get_user_data(second_proxy_id), to_user_data(2));
+    ASSERT_EQ(grid.get_group(second_proxy_id), 1);
+
+    // Moving inside the cell does not change the cell.
+    ASSERT_FALSE(grid.move_proxy(first_proxy_id, glm::vec3(3.0f, 1.0f, 1.0f), 0));
+    ASSERT_EQ(grid.get_point(first_proxy_id), glm::vec3(3.0f, 1.0f, 1.0f));
+    ASSERT_TRUE(grid.move_proxy(first_proxy_id, glm::vec3(-3.0f, 1.0f, 1.0f), 0));
+    ASSERT_EQ(grid.get_number_of_cells(), 2);
+    ASSERT_TRUE(grid.validate());
+
+    grid.destroy_proxy(first_proxy_id);
+    ASSERT_FALSE(grid.is_valid_proxy(first_proxy_id));
+    ASSERT_TRUE(grid.is_valid_proxy(second_proxy_id));
+    ASSERT_EQ(grid.get_number_of_proxies(), 1);
+    ASSERT_EQ(grid.get_number_of_cells(), 1);
+    ASSERT_TRUE(grid.validate());
+
+    // The freed proxy ID is reused.
+    ASSERT_EQ(grid.create_proxy(glm::vec3(0.0f), 0, to_user_data(3)), first_proxy_id);
+    ASSERT_TRUE(grid.validate());
+}
+
+TEST(spatial_hash_grid_must_work_appropriately, proxies_without_finite_points_are_not_found)
+{
+    yli::geometry::SpatialHashGrid grid(4.0f);
+    const std::int32_t proxy_id = grid.create_proxy(glm::vec3(NAN, NAN, NAN), 0, to_user_data(1));
+    ASSERT_EQ(grid.get_number_of_proxies(), 1);
+    ASSERT_EQ(grid.get_number_of_cells(), 0);
+
+    std::vector<yli::geometry::SpatialNeighbour> neighbours;
+    grid.query_nearest(glm::vec3(0.0f), 1, yli::geometry::SpatialQueryFilter(), neighbours);
+    ASSERT_TRUE(neighbours.empty());
+
+    ASSERT_TRUE(grid.move_proxy(proxy_id, glm::vec3(1.0f, 2.0f, 3.0f), 0));
+    grid.query_nearest(glm::vec3(0.0f), 1, yli::geometry::SpatialQueryFilter(), neighbours);
+    ASSERT_EQ(neighbours.size(), 1);
+    ASSERT_EQ(neighbours[0].proxy_id, proxy_id);
+    ASSERT_EQ(neighbours[0].distance_squared, 14.0f);
+    ASSERT_TRUE(grid.validate());
+}
+
+TEST(spatial_hash_grid_must_work_appropriately, radius_query_with_filters)
+{
+    yli::geometry::SpatialHashGrid grid(2.0f);
+
+    // Groups alternate along the x axis: 0, 1, 0, 1, ...
+    for (std::uint32_t i = 0; i < 10; i++)
+    {
+        grid.create_proxy(glm::vec3(static_cast<float>(i), 0.0f, 0.0f), i % 2, to_user_data(i + 1));
+    }
+
+    std::vector<yli::geometry::SpatialNeighbour> neighbours;
+    grid.query_radius(glm::vec3(4.0f, 0.0f, 0.0f), 2.0f, yli::geometry::SpatialQueryFilter(), neighbours);
+    ASSERT_EQ(get_sorted_proxy_ids(neighbours), std::vector<std::int32_t>({ 2, 3, 4, 5, 6 }));
+
+    neighbours.clear();
+    grid.query_radius(glm::vec3(4.0f, 0.0f, 0.0f), 2.0f, yli::geometry::SpatialQueryFilter { 0, yli::geometry::GroupRelation::SAME, 4 }, neighbours);
+    ASSERT_EQ(get_sorted_proxy_ids(neighbours), std::vector<std::int32_t>({ 2, 6 }));
+
+    neighbours.clear();
+    grid.query_radius(glm::vec3(4.0f, 0.0f, 0.0f), 2.0f, yli::geometry::SpatialQueryFilter { 0, yli::geometry::GroupRelation::OTHER, -1 }, neighbours);
+    ASSERT_EQ(get_sorted_proxy_ids(neighbours), std::vector<std::int32_t>({ 3, 5 }));
+}
+
+TEST(spatial_hash_grid_must_work_appropriately, nearest_query_is_sorted_and_limited)
+{
+    yli::geometry::SpatialHashGrid grid(2.0f);
+
+    for (std::uint32_t i = 0; i < 10; i++)
+    {
+        grid.create_proxy(glm::vec3(0.0f, 0.0f, static_cast<float>(i) * 3.0f), 0, to_user_data(i + 1));
+    }
+
+    std::vector<yli::geometry::SpatialNeighbour> neighbours;
+    grid.query_nearest(glm::vec3(0.0f, 0.0f, 10.0f), 3, yli::geometry::SpatialQueryFilter(), neighbours);
+    ASSERT_EQ(neighbours.size(), 3);
+    ASSERT_EQ(neighbours[0].proxy_id, 3); // z = 9
+    ASSERT_EQ(neighbours[1].proxy_id, 4); // z = 12
+    ASSERT_EQ(neighbours[2].proxy_id, 2); // z = 6
+
+    // Points farther than `max_distance` are not reported.
+    grid.query_nearest(glm::vec3(0.0f, 0.0f, 10.0f), 3, yli::geometry::SpatialQueryFilter(), neighbours, 2.5f);
+    ASSERT_EQ(neighbours.size(), 2);
+
+    // A query point far outside the occupied cells.
+    grid.query_nearest(glm::vec3(1000.0f, 0.0f, 0.0f), 1, yli::geometry::SpatialQueryFilter(), neighbours);
+    ASSERT_EQ(neighbours.size(), 1);
+    ASSERT_EQ(neighbours[0].proxy_id, 0);
+}
+
+TEST(spatial_hash_grid_must_work_appropriately, random_queries_match_brute_force)
+{
+    std::mt19937 generator(2026);
+    std::uniform_real_distribution<float> coordinate_distribution(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> step_distribution(-8.0f, 8.0f);
+    std::uniform_int_distribution<std::uint32_t> group_distribution(0, 2);
+    std::uniform_int_distribution<std::uint32_t> percent_distribution(0, 99);
+
+    yli::geometry::SpatialHashGrid grid(5.0f);
+    std::vector<glm::vec3> points;
+    std::vector<std::uint32_t> groups;
+    std::vector<bool> is_alive;
+    std::vector<yli::geometry::SpatialNeighbour> neighbours;
+
+    for (std::size_t round_i = 0; round_i < 200; round_i++)
+    {
+        // Create, move and destroy some proxies. Proxy IDs are reused, so they index the test arrays.
+        for (std::size_t change_i = 0; change_i < 20; change_i++)
+        {
+            const std::uint32_t percent = percent_distribution(generator);
+            const std::size_t proxy_i = (points.empty() ? 0 : generator() % points.size());
+
+            if (percent < 30 || points.empty())
+            {
+                const glm::vec3 point(coordinate_distribution(generator), coordinate_distribution(generator) * 0.1f, coordinate_distribution(generator));
+                const std::uint32_t group = group_distribution(generator);
+                const std::int32_t proxy_id = grid.create_proxy(point, group, to_user_data(1));
+
+                if (static_cast<std::size_t>(proxy_id) == points.size())
+                {
+                    points.emplace_back(point);
+                    groups.emplace_back(group);
+                    is_alive.emplace_back(true);
+                }
+                else
+                {
+                    points[proxy_id] = point;
+                    groups[proxy_id] = group;
+                    is_alive[proxy_id] = true;
+                }
+            }
+            else if (percent < 40 && is_alive[proxy_i])
+            {
+                grid.destroy_proxy(static_cast<std::int32_t>(proxy_i));
+                is_alive[proxy_i] = false;
+            }
+            else if (is_alive[proxy_i])
+            {
+                points[proxy_i] += glm::vec3(step_distribution(generator), 0.0f, step_distribution(generator));
+                grid.move_proxy(static_cast<std::int32_t>(proxy_i), points[proxy_i], groups[proxy_i]);
+            }
+        }
+
+        ASSERT_TRUE(grid.validate());
+
+        const glm::vec3 center(coordinate_distribution(generator), 0.0f, coordinate_distribution(generator));
+        const yli::geometry::SpatialQueryFilter filter {
+            group_distribution(generator),
+            static_cast<yli::geometry::GroupRelation>(group_distribution(generator)),
+            static_cast<std::int32_t>(generator() % (points.size() + 1)) };
+        const std::vector<float> expected = get_brute_force_distances(points, groups, is_alive, center, filter);
+
+        const float radius = step_distribution(generator) * 4.0f + 32.0f;
+        neighbours.clear();
+        grid.query_radius(center, radius, filter, neighbours);
+        const std::size_t n_expected_in_radius = static_cast<std::size_t>(
+                std::upper_bound(expected.begin(), expected.end(), radius * radius) - expected.begin());
+        ASSERT_EQ(neighbours.size(), n_expected_in_radius);
+
+        const std::size_t k = 1 + generator() % 16;
+        grid.query_nearest(center, k, filter, neighbours);
+        ASSERT_EQ(neighbours.size(), std::min(k, expected.size()));
+
+        for (std::size_t neighbour_i = 0; neighbour_i < neighbours.size(); neighbour_i++)
+        {
+            ASSERT_EQ(neighbours[neighbour_i].distance_squared, expected[neighbour_i]);
+        }
+    }
+
+    // Move everything far away, so that most cells become empty and are removed.
+    for (std::size_t proxy_i = 0; proxy_i < points.size(); proxy_i++)
+    {
+        if (is_alive[proxy_i])
+        {
+            grid.move_proxy(static_cast<std::int32_t>(proxy_i), glm::vec3(10000.0f, 0.0f, 0.0f), groups[proxy_i]);
+        }
+    }
+
+    ASSERT_EQ(grid.get_number_of_cells(), 1);
+    ASSERT_TRUE(grid.validate());
+}
@@ -34,8 +34,10 @@
 #include "code/ylikuutio/ontology/object_struct.hpp"
 
 // Include standard headers
+#include <chrono>  // std::chrono::seconds
 #include <cstdint> // uintptr_t
 #include <cstddef> // std::size_t
+#include <future>  // std::future_status
 #include <limits>  // std::numeric_limits
 
 namespace yli::ontology
@@ -433,6 +435,42 @@ TEST(species_must_be_initialized_appropriately, headless)
     ASSERT_EQ(species->get_number_of_non_variable_children(), 0);
 }
 
+TEST(species_must_be_ready_after_creation, headless_asynchronous_loading)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(scene) };
+    yli::ontology::Pipeline* const pipeline = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+
+    yli::ontology::MaterialStruct material_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(pipeline),
+            yli::ontology::TextureFileFormat::PNG };
+    material_struct.should_load_texture_asynchronously = true;
+    yli::ontology::Material* const material = application.get_generic_entity_factory().create_material(
+            material_struct);
+
+    yli::ontology::SpeciesStruct species_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(material) };
+    species_struct.should_load_asynchronously = true;
+    yli::ontology::Species* const species = application.get_generic_entity_factory().create_species(
+            species_struct);
+
+    // A headless `Universe` has nothing to load, so loading finishes right away.
+    ASSERT_FALSE(material->texture.get_is_loading());
+    ASSERT_EQ(material->texture.get_loading_future().wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    ASSERT_TRUE(material->texture.get_loading_future().get());
+
+    ASSERT_FALSE(species->mesh.get_is_loading());
+    ASSERT_EQ(species->mesh.get_loading_future().wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    ASSERT_TRUE(species->mesh.get_loading_future().get());
+}
+
 TEST(species_must_bind_to_ecosystem_appropriately, ecosystem)
 {
     mock::MockApplication application;
@@ -0,0 +1,175 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/load/svg_font_loader.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
+
+// Include standard headers
+#include <cstddef>    // std::size_t
+#include <filesystem> // std::filesystem
+#include <fstream>    // std::ofstream
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+namespace
+{
+    std::string write_temporary_svg_file(const std::string& filename, const std::string& file_content)
+    {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / "ylikuutio_test_svg_font_loader";
+        std::filesystem::create_directories(directory);
+        const std::string path = (directory / filename).string();
+        std::ofstream file_stream(path, std::ios::binary);
+        file_stream << file_content;
+        return path;
+    }
+}
+
+TEST(svg_fonts_must_be_loaded_appropriately, kongtext_svg)
+{
+    std::vector<std::vector<std::vector<glm::vec2>>> glyph_vertex_data;
+    std::vector<std::string> glyph_names;
+    std::vector<std::string> unicode_strings;
+    std::vector<float> advance_widths;
+
+    const bool result = yli::load::load_svg_font(
+            "kongtext.svg",
+            1.0f,
+            glyph_vertex_data,
+            glyph_names,
+            unicode_strings,
+            advance_widths);
+    ASSERT_TRUE(result);
+
+    // 221 glyphs, of which `.notdef`, 2 x `.null` and 1 `nonmarkingreturn` have no `unicode`.
+    ASSERT_EQ(glyph_vertex_data.size(), 217);
+    ASSERT_EQ(glyph_names.size(), 217);
+    ASSERT_EQ(unicode_strings.size(), 217);
+    ASSERT_EQ(advance_widths.size(), 217);
+
+    std::size_t a_i = 0;
+
+    while (a_i < unicode_strings.size() && unicode_strings[a_i] != "A")
+    {
+        a_i++;
+    }
+
+    ASSERT_LT(a_i, unicode_strings.size());
+    ASSERT_EQ(glyph_names[a_i], "A");
+
+    // The glyph has no `horiz-adv-x`, so the advance width is that of the font.
+    ASSERT_EQ(advance_widths[a_i], 1024.0f);
+
+    // d="M256 768h512v-128h128v-640h-256v256h-256v-256h-256v640h128v128zM384 640v-256h256v256h-256z"
+    const std::vector<std::vector<glm::vec2>>& a_outlines = glyph_vertex_data[a_i];
+    ASSERT_EQ(a_outlines.size(), 2);
+    ASSERT_EQ(a_outlines[0].size(), 12); // The closing vertex is not repeated.
+    ASSERT_EQ(a_outlines[0][0], glm::vec2(256.0f, 768.0f));
+    ASSERT_EQ(a_outlines[0][1], glm::vec2(768.0f, 768.0f));
+    ASSERT_EQ(a_outlines[0][2], glm::vec2(768.0f, 640.0f));
+    ASSERT_EQ(a_outlines[0][11], glm::vec2(256.0f, 640.0f));
+    ASSERT_EQ(a_outlines[1].size(), 4);
+    ASSERT_EQ(a_outlines[1][0], glm::vec2(384.0f, 640.0f));
+    ASSERT_EQ(a_outlines[1][1], glm::vec2(384.0f, 384.0f));
+    ASSERT_EQ(a_outlines[1][2], glm::vec2(640.0f, 384.0f));
+    ASSERT_EQ(a_outlines[1][3], glm::vec2(640.0f, 640.0f));
+
+    // The space has no outline.
+    std::size_t space_i = 0;
+
+    while (space_i < unicode_strings.size() && unicode_strings[space_i] != " ")
+    {
+        space_i++;
+    }
+
+    ASSERT_LT(space_i, unicode_strings.size());
+    ASSERT_TRUE(glyph_vertex_data[space_i].empty());
+    ASSERT_EQ(advance_widths[space_i], 1024.0f);
+}
+
+TEST(svg_fonts_must_be_loaded_appropriately, glyph_advance_widths_relative_commands_and_curves)
+{
+    const std::string svg_font_path = write_temporary_svg_file(
+            "test_font.svg",
+            "<svg><defs>\n"
+            "<font id=\"TestFont\" horiz-adv-x=\"1000\" >\n"
+            "  <font-face units-per-em=\"1000\" />\n"
+            "  <glyph glyph-name=\"narrow\" unicode=\"i\" horiz-adv-x=\"500\"\n"
+            "d=\"m100,0 l200 0 100 100 V200 H100 z\" />\n"
+            "  <glyph glyph-name=\"curved\" unicode=\"o\" d=\"M0 0q500 500 1000 0z\" />\n"
+            "  <glyph glyph-name=\"ampersand\" unicode=\"&#x26;\" d=\"M0 0h1000v1000h-1000z\" />\n"
+            "</font>\n"
+            "</defs></svg>\n");
+
+    std::vector<std::vector<std::vector<glm::vec2>>> glyph_vertex_data;
+    std::vector<std::string> glyph_names;
+    std::vector<std::string> unicode_strings;
+    std::vector<float> advance_widths;
+
+    const bool result = yli::load::load_svg_font(
+            svg_font_path,
+            0.001f,
+            glyph_vertex_data,
+            glyph_names,
+            unicode_strings,
+            advance_widths);
+    ASSERT_TRUE(result);
+
+    // The glyph with a curve is skipped.
+    ASSERT_EQ(glyph_names, std::vector<std::string>({ "narrow", "ampersand" }));
+    ASSERT_EQ(unicode_strings, std::vector<std::string>({ "i", "&#x26;" }));
+    ASSERT_FLOAT_EQ(advance_widths[0], 0.5f);
+    ASSERT_FLOAT_EQ(advance_widths[1], 1.0f);
+
+    // The relative `l` continues with an implicit relative lineto.
+    ASSERT_EQ(glyph_vertex_data[0].size(), 1);
+    const std::vector<glm::vec2>& narrow_outline = glyph_vertex_data[0][0];
+    ASSERT_EQ(narrow_outline.size(), 5);
+    ASSERT_FLOAT_EQ(narrow_outline[0].x, 0.1f);
+    ASSERT_FLOAT_EQ(narrow_outline[0].y, 0.0f);
+    ASSERT_FLOAT_EQ(narrow_outline[1].x, 0.3f);
+    ASSERT_FLOAT_EQ(narrow_outline[1].y, 0.0f);
+    ASSERT_FLOAT_EQ(narrow_outline[2].x, 0.4f);
+    ASSERT_FLOAT_EQ(narrow_outline[2].y, 0.1f);
+    ASSERT_FLOAT_EQ(narrow_outline[3].x, 0.4f);
+    ASSERT_FLOAT_EQ(narrow_outline[3].y, 0.2f);
+    ASSERT_FLOAT_EQ(narrow_outline[4].x, 0.1f);
+    ASSERT_FLOAT_EQ(narrow_outline[4].y, 0.2f);
+}
+
+TEST(svg_fonts_must_be_loaded_appropriately, nonexistent_file)
+{
+    std::vector<std::vector<std::vector<glm::vec2>>> glyph_vertex_data;
+    std::vector<std::string> glyph_names;
+    std::vector<std::string> unicode_strings;
+    std::vector<float> advance_widths;
+
+    ASSERT_FALSE(yli::load::load_svg_font(
+                "this_file_does_not_exist.svg",
+                1.0f,
+                glyph_vertex_data,
+                glyph_names,
+                unicode_strings,
+                advance_widths));
+    ASSERT_TRUE(glyph_vertex_data.empty());
+}
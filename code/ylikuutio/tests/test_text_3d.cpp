@@ -24,6 +24,7 @@
 #include "code/ylikuutio/ontology/pipeline.hpp"
 #include "code/ylikuutio/ontology/material.hpp"
 #include "code/ylikuutio/ontology/vector_font.hpp"
+#include "code/ylikuutio/ontology/glyph.hpp"
 #include "code/ylikuutio/ontology/text_3d.hpp"
 #include "code/ylikuutio/ontology/request.hpp"
 #include "code/ylikuutio/ontology/texture_file_format.hpp"
@@ -32,10 +33,19 @@
 #include "code/ylikuutio/ontology/pipeline_struct.hpp"
 #include "code/ylikuutio/ontology/material_struct.hpp"
 #include "code/ylikuutio/ontology/vector_font_struct.hpp"
+#include "code/ylikuutio/ontology/glyph_struct.hpp"
 #include "code/ylikuutio/ontology/text_3d_struct.hpp"
+#include "code/ylikuutio/render/text_3d_mesh.hpp"
+
+// Include GLM
+#ifndef __GLM_GLM_HPP_INCLUDED
+#define __GLM_GLM_HPP_INCLUDED
+#include <glm/glm.hpp> // glm
+#endif
 
 // Include standard headers
 #include <cstdint> // uintptr_t
+#include <vector>  // std::vector
 
 namespace yli::ontology
 {
@@ -79,8 +89,6 @@ TEST(text_3d_must_be_initialized_and_must_bind_to_material_appropriately, headle
     ASSERT_NE(text_3d, nullptr);
     ASSERT_EQ(reinterpret_cast<uintptr_t>(text_3d) % alignof(yli::ontology::Text3d), 0);
 
-    ASSERT_NE(text_3d->get_generic_master_module<yli::ontology::GlyphObject>(), nullptr);
-
     // `Entity` member functions of `Universe`.
     ASSERT_EQ(application.get_universe().get_number_of_non_variable_children(), 2);  // `ecosystem`, `scene`.
 
@@ -162,3 +170,91 @@ TEST(text_3d_must_be_initialized_and_must_bind_to_material_appropriately, headle
     ASSERT_EQ(text_3d->get_parent(), scene);
     ASSERT_EQ(text_3d->get_number_of_non_variable_children(), 0);
 }
+
+TEST(text_3d_must_lay_out_its_text_as_glyph_instances, headless_two_glyphs_and_a_missing_character)
+{
+    mock::MockApplication application;
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(
+            scene_struct);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(scene) };
+    yli::ontology::Pipeline* const pipeline = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+
+    yli::ontology::MaterialStruct material_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(pipeline),
+            yli::ontology::TextureFileFormat::PNG };
+    yli::ontology::Material* const material = application.get_generic_entity_factory().create_material(
+            material_struct);
+
+    yli::ontology::VectorFontStruct vector_font_struct { yli::ontology::Request(material) };
+    yli::ontology::VectorFont* const vector_font = application.get_generic_entity_factory().create_vector_font(
+            vector_font_struct);
+
+    // `a` advances by 0.5 although its outline ends at 0.75, `b` has the default advance of 1.
+    std::vector<std::vector<glm::vec2>> a_vertex_data { { glm::vec2(0.0f, 0.0f), glm::vec2(0.75f, 0.0f), glm::vec2(0.75f, 1.0f) } };
+    yli::ontology::GlyphStruct a_glyph_struct {
+            yli::ontology::Request(vector_font),
+            yli::ontology::Request(material) };
+    a_glyph_struct.glyph_vertex_data = &a_vertex_data;
+    a_glyph_struct.advance_width = 0.5f;
+    yli::ontology::Glyph* const a_glyph = application.get_generic_entity_factory().create_glyph(
+            a_glyph_struct);
+    ASSERT_EQ(a_glyph->get_advance_width(), 0.5f);
+    vector_font->set_glyph_for_unicode_value('a', *a_glyph);
+
+    yli::ontology::GlyphStruct b_glyph_struct {
+            yli::ontology::Request(vector_font),
+            yli::ontology::Request(material) };
+    yli::ontology::Glyph* const b_glyph = application.get_generic_entity_factory().create_glyph(
+            b_glyph_struct);
+    ASSERT_EQ(b_glyph->get_advance_width(), 1.0f);
+    vector_font->set_glyph_for_unicode_value('b', *b_glyph);
+
+    yli::ontology::Text3dStruct text_3d_struct {
+            yli::ontology::Request(scene),
+            yli::ontology::Request(vector_font) };
+    text_3d_struct.text_string = "abxa\nb";
+    yli::ontology::Text3d* const text_3d = application.get_generic_entity_factory().create_text_3d(
+            text_3d_struct);
+    ASSERT_EQ(text_3d->get_text(), "abxa\nb");
+
+    // The characters are not entities.
+    ASSERT_EQ(text_3d->get_number_of_non_variable_children(), 0);
+    ASSERT_EQ(a_glyph->get_generic_master_module<yli::ontology::GlyphObject>()->get_number_of_apprentices(), 0);
+    ASSERT_EQ(b_glyph->get_generic_master_module<yli::ontology::GlyphObject>()->get_number_of_apprentices(), 0);
+    ASSERT_EQ(vector_font->get_generic_master_module<yli::ontology::Text3d>()->get_number_of_apprentices(), 1);
+
+    const yli::render::Text3dMesh& text_3d_mesh = text_3d->get_text_3d_mesh();
+    ASSERT_EQ(text_3d_mesh.get_number_of_characters(), 4);
+    ASSERT_EQ(text_3d_mesh.get_number_of_missing_characters(), 1);
+
+    const std::vector<yli::render::GlyphBatch>& batches = text_3d_mesh.get_batches();
+    ASSERT_EQ(batches.size(), 2);
+    ASSERT_EQ(batches[0].unicode_value, 'a');
+    ASSERT_EQ(vector_font->get_glyph_pointer(batches[0].unicode_value), a_glyph);
+    ASSERT_EQ(batches[0].first_instance, 0);
+    ASSERT_EQ(batches[0].n_instances, 2);
+    ASSERT_EQ(batches[1].unicode_value, 'b');
+    ASSERT_EQ(vector_font->get_glyph_pointer(batches[1].unicode_value), b_glyph);
+    ASSERT_EQ(batches[1].first_instance, 2);
+    ASSERT_EQ(batches[1].n_instances, 2);
+
+    // `a`, `a`, `b`, `b`; the missing `x` advances by 1, the newline starts a new line.
+    const std::vector<glm::vec3>& instance_offsets = text_3d_mesh.get_instance_offsets();
+    ASSERT_EQ(instance_offsets.size(), 4);
+    ASSERT_EQ(instance_offsets[0], glm::vec3(0.0f, 0.0f, 0.0f));
+    ASSERT_EQ(instance_offsets[1], glm::vec3(2.5f, 0.0f, 0.0f));
+    ASSERT_EQ(instance_offsets[2], glm::vec3(0.5f, 0.0f, 0.0f));
+    ASSERT_EQ(instance_offsets[3], glm::vec3(0.0f, -1.0f, 0.0f));
+
+    text_3d->set_text("bb");
+    ASSERT_EQ(text_3d->get_text(), "bb");
+    ASSERT_EQ(text_3d_mesh.get_number_of_characters(), 2);
+    ASSERT_EQ(text_3d_mesh.get_number_of_missing_characters(), 0);
+    ASSERT_EQ(text_3d_mesh.get_batches().size(), 1);
+    ASSERT_EQ(text_3d_mesh.get_batches()[0].unicode_value, 'b');
+    ASSERT_EQ(text_3d_mesh.get_instance_offsets()[1], glm::vec3(1.0f, 0.0f, 0.0f));
+}
@@ -0,0 +1,111 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/load/texture_cache.hpp"
+#include "code/ylikuutio/load/texture_data.hpp"
+#include "code/ylikuutio/load/image_loader_struct.hpp"
+#include "code/ylikuutio/render/graphics_api_backend.hpp"
+
+// Include standard headers
+#include <memory>   // std::shared_ptr
+#include <string>   // std::string
+
+namespace
+{
+    yli::load::TextureData get_test_texture_data()
+    {
+        yli::load::TextureData texture_data;
+        texture_data.n_color_channels = 3;
+        texture_data.mip_levels.push_back({ 2, 1, { 1, 2, 3, 4, 5, 6 } });
+        texture_data.mip_levels.push_back({ 1, 1, { 3, 4, 5 } });
+        return texture_data;
+    }
+}
+
+TEST(texture_cache_key_must_depend_on_filename_and_image_loading_flags, different_flags)
+{
+    const yli::load::ImageLoaderStruct image_loader_struct;
+    const yli::load::ImageLoaderStruct grayscale_image_loader_struct({ std::pair(yli::load::ImageLoadingFlags::SHOULD_CONVERT_GRAYSCALE_TO_RGB, true) });
+    const yli::load::ImageLoaderStruct asynchronous_image_loader_struct({ std::pair(yli::load::ImageLoadingFlags::SHOULD_LOAD_ASYNCHRONOUSLY, true) });
+
+    ASSERT_EQ(
+            yli::load::TextureCache::get_key("foo.png", image_loader_struct),
+            yli::load::TextureCache::get_key("foo.png", image_loader_struct));
+    ASSERT_NE(
+            yli::load::TextureCache::get_key("foo.png", image_loader_struct),
+            yli::load::TextureCache::get_key("bar.png", image_loader_struct));
+    ASSERT_NE(
+            yli::load::TextureCache::get_key("foo.png", image_loader_struct),
+            yli::load::TextureCache::get_key("foo.png", grayscale_image_loader_struct));
+
+    // Asynchronous loading does not change the texels.
+    ASSERT_EQ(
+            yli::load::TextureCache::get_key("foo.png", image_loader_struct),
+            yli::load::TextureCache::get_key("foo.png", asynchronous_image_loader_struct));
+}
+
+TEST(texture_cache_must_share_textures, headless)
+{
+    yli::load::TextureCache texture_cache;
+    ASSERT_EQ(texture_cache.find("foo.png|0"), nullptr);
+    ASSERT_EQ(texture_cache.get_number_of_textures(), 0);
+
+    const std::shared_ptr<yli::load::CachedTexture> first = texture_cache.insert(
+            "foo.png|0",
+            get_test_texture_data(),
+            yli::render::GraphicsApiBackend::HEADLESS);
+    ASSERT_NE(first, nullptr);
+    ASSERT_EQ(first->image_width, 2);
+    ASSERT_EQ(first->image_height, 1);
+    ASSERT_EQ(first->image_size, 2);
+    ASSERT_EQ(first->n_color_channels, 3);
+    ASSERT_EQ(first->n_mip_levels, 2);
+    ASSERT_EQ(texture_cache.get_number_of_textures(), 1);
+
+    const std::shared_ptr<yli::load::CachedTexture> second = texture_cache.find("foo.png|0");
+    ASSERT_EQ(second, first);
+
+    const std::shared_ptr<yli::load::CachedTexture> third = texture_cache.insert(
+            "foo.png|0",
+            get_test_texture_data(),
+            yli::render::GraphicsApiBackend::HEADLESS);
+    ASSERT_EQ(third, first);
+    ASSERT_EQ(first.use_count(), 3);
+}
+
+TEST(texture_cache_must_release_textures, headless)
+{
+    yli::load::TextureCache texture_cache;
+
+    std::shared_ptr<yli::load::CachedTexture> cached_texture = texture_cache.insert(
+            "foo.png|0",
+            get_test_texture_data(),
+            yli::render::GraphicsApiBackend::HEADLESS);
+    ASSERT_EQ(texture_cache.get_number_of_textures(), 1);
+
+    cached_texture = nullptr;
+    ASSERT_EQ(texture_cache.get_number_of_textures(), 0);
+    ASSERT_EQ(texture_cache.find("foo.png|0"), nullptr);
+}
+
+TEST(texture_cache_must_not_insert_empty_texture_data, headless)
+{
+    yli::load::TextureCache texture_cache;
+    ASSERT_EQ(texture_cache.insert("foo.png|0", yli::load::TextureData(), yli::render::GraphicsApiBackend::HEADLESS), nullptr);
+    ASSERT_EQ(texture_cache.get_number_of_textures(), 0);
+}
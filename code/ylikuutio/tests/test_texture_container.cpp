@@ -0,0 +1,115 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/ylikuutio/load/texture_container.hpp"
+#include "code/ylikuutio/load/texture_data.hpp"
+#include "code/ylikuutio/load/image_loader_struct.hpp"
+
+// Include standard headers
+#include <cstdint>    // std::uint8_t
+#include <filesystem> // std::filesystem
+#include <optional>   // std::optional
+#include <string>     // std::string
+#include <vector>     // std::vector
+
+namespace
+{
+    yli::load::TextureData get_test_texture_data()
+    {
+        yli::load::TextureData texture_data;
+        texture_data.n_color_channels = 3;
+        texture_data.mip_levels.push_back({ 2, 1, { 1, 2, 3, 4, 5, 6 } });
+        texture_data.mip_levels.push_back({ 1, 1, { 3, 4, 5 } });
+        return texture_data;
+    }
+}
+
+TEST(texture_container_must_be_deserialized_appropriately, matching_source_stamp)
+{
+    const yli::load::TextureData texture_data = get_test_texture_data();
+    const yli::load::TextureSourceStamp source_stamp { 1234, 5678 };
+
+    const std::vector<std::uint8_t> container_data = yli::load::serialize_texture_container(texture_data, source_stamp);
+    const std::optional<yli::load::TextureData> result = yli::load::deserialize_texture_container(container_data, source_stamp);
+
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->n_color_channels, 3);
+    ASSERT_EQ(result->mip_levels.size(), 2);
+    ASSERT_EQ(result->mip_levels.at(0).width, 2);
+    ASSERT_EQ(result->mip_levels.at(0).height, 1);
+    ASSERT_EQ(result->mip_levels.at(0).data, texture_data.mip_levels.at(0).data);
+    ASSERT_EQ(result->mip_levels.at(1).width, 1);
+    ASSERT_EQ(result->mip_levels.at(1).height, 1);
+    ASSERT_EQ(result->mip_levels.at(1).data, texture_data.mip_levels.at(1).data);
+}
+
+TEST(texture_container_must_not_be_deserialized, different_source_stamp)
+{
+    const std::vector<std::uint8_t> container_data = yli::load::serialize_texture_container(
+            get_test_texture_data(),
+            yli::load::TextureSourceStamp { 1234, 5678 });
+
+    ASSERT_FALSE(yli::load::deserialize_texture_container(container_data, yli::load::TextureSourceStamp { 1234, 5679 }));
+    ASSERT_FALSE(yli::load::deserialize_texture_container(container_data, yli::load::TextureSourceStamp { 1235, 5678 }));
+}
+
+TEST(texture_container_must_not_be_deserialized, truncated_data)
+{
+    const yli::load::TextureSourceStamp source_stamp { 1234, 5678 };
+    std::vector<std::uint8_t> container_data = yli::load::serialize_texture_container(get_test_texture_data(), source_stamp);
+    container_data.pop_back();
+
+    ASSERT_FALSE(yli::load::deserialize_texture_container(container_data, source_stamp));
+    ASSERT_FALSE(yli::load::deserialize_texture_container(std::vector<std::uint8_t>(), source_stamp));
+}
+
+TEST(texture_container_must_not_be_deserialized, invalid_magic)
+{
+    const yli::load::TextureSourceStamp source_stamp { 1234, 5678 };
+    std::vector<std::uint8_t> container_data = yli::load::serialize_texture_container(get_test_texture_data(), source_stamp);
+    container_data.at(0) = 'X';
+
+    ASSERT_FALSE(yli::load::deserialize_texture_container(container_data, source_stamp));
+}
+
+TEST(texture_container_path_must_depend_on_image_loading_flags, flip_vertically)
+{
+    const yli::load::ImageLoaderStruct image_loader_struct;
+    const yli::load::ImageLoaderStruct flip_image_loader_struct({ std::pair(yli::load::ImageLoadingFlags::SHOULD_FLIP_VERTICALLY, true) });
+
+    ASSERT_NE(
+            yli::load::get_texture_container_path("foo.png", image_loader_struct),
+            yli::load::get_texture_container_path("foo.png", flip_image_loader_struct));
+}
+
+TEST(texture_container_must_be_written_and_read_appropriately, temporary_directory)
+{
+    const std::string container_path = (std::filesystem::temp_directory_path() / "ylikuutio_test_texture_container.yltx").string();
+    const yli::load::TextureData texture_data = get_test_texture_data();
+    const yli::load::TextureSourceStamp source_stamp { 1234, 5678 };
+
+    ASSERT_TRUE(yli::load::write_texture_container(container_path, texture_data, source_stamp));
+
+    const std::optional<yli::load::TextureData> result = yli::load::read_texture_container(container_path, source_stamp);
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->mip_levels.size(), 2);
+    ASSERT_EQ(result->mip_levels.at(0).data, texture_data.mip_levels.at(0).data);
+
+    std::filesystem::remove(container_path);
+    ASSERT_FALSE(yli::load::read_texture_container(container_path, source_stamp));
+}
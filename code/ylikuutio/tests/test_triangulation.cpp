@@ -17,6 +17,8 @@
 
 #include "gtest/gtest.h"
 #include "code/ylikuutio/triangulation/face_normals.hpp"
+#include "code/ylikuutio/triangulation/polygon_triangulation.hpp"
+#include "code/ylikuutio/triangulation/triangulate_polygons_struct.hpp"
 #include "code/ylikuutio/triangulation/triangulation_templates.hpp"
 
 // Include GLM
@@ -231,3 +233,54 @@ TEST(vertices_must_be_defined_and_interpolated_appropriately, a_3x3_terrain)
     ASSERT_TRUE(glm::all(glm::equal(face_normal_vector_vec3[10], glm::normalize(glm::cross(i6_x0_y2 - i11_x0_5_y1_5, i7_x1_y2 - i11_x0_5_y1_5)))));
     ASSERT_TRUE(glm::all(glm::equal(face_normal_vector_vec3[11], glm::normalize(glm::cross(i7_x1_y2 - i11_x0_5_y1_5, i4_x1_y1 - i11_x0_5_y1_5)))));
 }
+
+TEST(polygons_must_be_triangulated_appropriately, a_square_with_a_hole_and_a_triangle)
+{
+    // The inner square is a hole of the outer square.
+    std::vector<std::vector<glm::vec2>> outlines {
+        { glm::vec2(0.0f, 0.0f), glm::vec2(3.0f, 0.0f), glm::vec2(3.0f, 3.0f), glm::vec2(0.0f, 3.0f) },
+        { glm::vec2(1.0f, 1.0f), glm::vec2(1.0f, 2.0f), glm::vec2(2.0f, 2.0f), glm::vec2(2.0f, 1.0f) },
+        { glm::vec2(4.0f, 0.0f), glm::vec2(6.0f, 0.0f), glm::vec2(5.0f, 2.0f) } };
+
+    yli::triangulation::TriangulatePolygonsStruct triangulate_polygons_struct;
+    triangulate_polygons_struct.input_vertices = &outlines;
+
+    std::vector<glm::vec3> vertices;
+    std::vector<glm::vec2> uvs;
+    std::vector<glm::vec3> normals;
+    ASSERT_TRUE(yli::triangulation::triangulate_polygons(triangulate_polygons_struct, vertices, uvs, normals));
+
+    // The slabs are between y = 0, 1, 2, 3. The square: 2 + 4 + 2 triangles.
+    // The triangle: 2 triangles below y = 1 and 1 triangle narrowing into its apex.
+    ASSERT_EQ(vertices.size(), 11 * 3);
+    ASSERT_EQ(uvs.size(), vertices.size());
+    ASSERT_EQ(normals.size(), vertices.size());
+
+    float area = 0.0f;
+
+    for (std::size_t vertex_i = 0; vertex_i < vertices.size(); vertex_i += 3)
+    {
+        const glm::vec3 cross = glm::cross(vertices[vertex_i + 1] - vertices[vertex_i], vertices[vertex_i + 2] - vertices[vertex_i]);
+
+        // Counterclockwise when seen from +z.
+        ASSERT_GT(cross.z, 0.0f);
+        area += 0.5f * cross.z;
+
+        for (std::size_t corner_i = vertex_i; corner_i < vertex_i + 3; corner_i++)
+        {
+            ASSERT_EQ(vertices[corner_i].z, 0.0f);
+            ASSERT_EQ(normals[corner_i], glm::vec3(0.0f, 0.0f, 1.0f));
+
+            // No triangle covers the hole.
+            ASSERT_FALSE(vertices[corner_i].x > 1.0f && vertices[corner_i].x < 2.0f);
+
+            // The UVs cover the bounding box.
+            ASSERT_EQ(uvs[corner_i], glm::vec2(vertices[corner_i].x / 6.0f, vertices[corner_i].y / 3.0f));
+        }
+    }
+
+    ASSERT_EQ(area, 8.0f + 2.0f);
+
+    triangulate_polygons_struct.input_vertices = nullptr;
+    ASSERT_FALSE(yli::triangulation::triangulate_polygons(triangulate_polygons_struct, vertices, uvs, normals));
+}
@@ -18,11 +18,74 @@
 #include "gtest/gtest.h"
 #include "code/mock/mock_application.hpp"
 #include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/ontology/scene.hpp"
+#include "code/ylikuutio/ontology/scene_struct.hpp"
+#include "code/ylikuutio/ontology/headless_simulation_struct.hpp"
+#include "code/ylikuutio/ontology/console.hpp"
+#include "code/ylikuutio/ontology/console_struct.hpp"
+#include "code/ylikuutio/ontology/request.hpp"
+#include "code/ylikuutio/ontology/callback_magic_numbers.hpp"
+#include "code/ylikuutio/console/remote_command.hpp"
+#include "code/ylikuutio/console/remote_console.hpp"
+#include "code/ylikuutio/data/any_value.hpp"
 
 // Include standard headers
-#include <cstdint> // uintptr_t
-#include <cstddef> // std::size_t
-#include <limits>  // std::numeric_limits
+#include <cstdint>     // uintptr_t, std::uint32_t, std::uint64_t
+#include <cstddef>     // std::size_t
+#include <deque>       // std::deque
+#include <limits>      // std::numeric_limits
+#include <optional>    // std::nullopt, std::optional
+#include <string>      // std::string
+#include <string_view> // std::string_view
+#include <utility>     // std::move, std::pair
+#include <vector>      // std::vector
+
+namespace
+{
+    // Stands in for a `ConsoleServer` and its clients.
+    class StandInRemoteConsole final : public yli::console::RemoteConsole
+    {
+        public:
+            std::vector<yli::console::RemoteCommand> take_commands() override
+            {
+                if (this->received_commands.empty())
+                {
+                    return {};
+                }
+
+                std::vector<yli::console::RemoteCommand> commands = std::move(this->received_commands.front());
+                this->received_commands.pop_front();
+                return commands;
+            }
+
+            void send_result(const std::uint64_t client_id, const std::string_view result) override
+            {
+                this->results.emplace_back(client_id, std::string(result));
+            }
+
+            void send_metrics(const std::string_view metrics) override
+            {
+                this->metrics.emplace_back(metrics);
+            }
+
+            std::deque<std::vector<yli::console::RemoteCommand>> received_commands; // One element per tick.
+            std::vector<std::pair<std::uint64_t, std::string>> results;
+            std::vector<std::string> metrics;
+    };
+
+    std::uint32_t remote_sum = 0;
+
+    std::optional<yli::data::AnyValue> remote_add(const std::uint32_t value)
+    {
+        remote_sum += value;
+        return yli::data::AnyValue(remote_sum);
+    }
+
+    std::optional<yli::data::AnyValue> remote_stop()
+    {
+        return yli::data::AnyValue(static_cast<std::uint32_t>(yli::ontology::CallbackMagicNumber::EXIT_PROGRAM));
+    }
+}
 
 TEST(universe_must_be_initialized_appropriately, headless)
 {
@@ -90,3 +153,113 @@ TEST(universe_must_not_accept_a_local_name_after_setting_a_global_name, headless
     ASSERT_EQ(universe.get_global_name(), "foo");
     ASSERT_EQ(universe.get_local_name(), "");
 }
+
+TEST(start_simulation_of_headless_universe_must_return_at_once, should_run_headless_simulation_not_set)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+    universe.start_simulation();
+    ASSERT_EQ(universe.get_number_of_ticks(), 0);
+    ASSERT_FALSE(universe.get_is_headless_simulation_running());
+}
+
+TEST(headless_simulation_must_run_the_given_number_of_ticks, no_scene)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+    ASSERT_EQ(universe.get_number_of_ticks(), 0);
+
+    yli::ontology::HeadlessSimulationStruct headless_simulation_struct;
+    headless_simulation_struct.n_ticks = 10;
+    headless_simulation_struct.ticks_per_second = 0.0f; // Uncapped.
+    ASSERT_EQ(universe.start_headless_simulation(headless_simulation_struct), 10);
+    ASSERT_EQ(universe.get_number_of_ticks(), 10);
+    ASSERT_FALSE(universe.get_is_headless_simulation_running());
+}
+
+TEST(headless_simulation_must_run_the_given_number_of_ticks, active_scene)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    yli::ontology::SceneStruct scene_struct;
+    yli::ontology::Scene* const scene = application.get_generic_entity_factory().create_scene(scene_struct);
+    universe.set_active_scene(scene);
+
+    yli::ontology::HeadlessSimulationStruct headless_simulation_struct;
+    headless_simulation_struct.n_ticks = 5;
+    headless_simulation_struct.ticks_per_second = 1000.0f;
+    ASSERT_EQ(universe.start_headless_simulation(headless_simulation_struct), 5);
+    ASSERT_EQ(universe.get_number_of_ticks(), 5);
+}
+
+TEST(headless_simulation_must_execute_remote_commands, no_console)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    StandInRemoteConsole remote_console;
+    remote_console.received_commands.push_back({ { 7, "add 1" } });
+
+    yli::ontology::HeadlessSimulationStruct headless_simulation_struct;
+    headless_simulation_struct.n_ticks = 3;
+    headless_simulation_struct.ticks_per_second = 0.0f; // Uncapped.
+    headless_simulation_struct.remote_console = &remote_console;
+    ASSERT_EQ(universe.start_headless_simulation(headless_simulation_struct), 3);
+
+    ASSERT_EQ(remote_console.results.size(), 1);
+    ASSERT_EQ(remote_console.results[0].first, 7);
+    ASSERT_EQ(remote_console.results[0].second, "ERROR: there is no `Console`!");
+}
+
+TEST(headless_simulation_must_execute_remote_commands, commands_are_executed_in_order_before_the_tick)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    yli::ontology::ConsoleStruct console_struct(0, 39, 15, 0); // Some dummy dimensions.
+    yli::ontology::Console* const console = application.get_generic_entity_factory().create_console(console_struct);
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "add", yli::ontology::Request<yli::ontology::Console>(console), &remote_add);
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "stop", yli::ontology::Request<yli::ontology::Console>(console), &remote_stop);
+    remote_sum = 0;
+
+    // Small `std::uint32_t` results are `CallbackMagicNumber`s, so keep the sums above them.
+    StandInRemoteConsole remote_console;
+    remote_console.received_commands.push_back({ { 1, "add 10" }, { 2, "add 20" } });
+    remote_console.received_commands.push_back({ { 1, "stop" } });
+
+    yli::ontology::HeadlessSimulationStruct headless_simulation_struct;
+    headless_simulation_struct.n_ticks = 0; // Until exit is requested.
+    headless_simulation_struct.ticks_per_second = 0.0f;
+    headless_simulation_struct.remote_console = &remote_console;
+    ASSERT_EQ(universe.start_headless_simulation(headless_simulation_struct), 2);
+
+    ASSERT_EQ(remote_sum, 30);
+    ASSERT_EQ(remote_console.results.size(), 3);
+    ASSERT_EQ(remote_console.results[0], (std::pair<std::uint64_t, std::string>(1, "10")));
+    ASSERT_EQ(remote_console.results[1], (std::pair<std::uint64_t, std::string>(2, "30")));
+    ASSERT_EQ(remote_console.results[2].first, 1);
+}
+
+TEST(headless_simulation_must_send_metrics, every_n_ticks)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+
+    StandInRemoteConsole remote_console;
+
+    yli::ontology::HeadlessSimulationStruct headless_simulation_struct;
+    headless_simulation_struct.n_ticks = 6;
+    headless_simulation_struct.ticks_per_second = 0.0f;
+    headless_simulation_struct.remote_console = &remote_console;
+    headless_simulation_struct.metrics_interval_in_ticks = 2;
+    ASSERT_EQ(universe.start_headless_simulation(headless_simulation_struct), 6);
+
+    ASSERT_EQ(remote_console.metrics.size(), 3);
+    ASSERT_TRUE(remote_console.metrics[0].starts_with("ticks=2 frame_time_ms="));
+    ASSERT_TRUE(remote_console.metrics[2].starts_with("ticks=6 frame_time_ms="));
+    ASSERT_NE(remote_console.metrics[2].find(" entities=" + std::to_string(universe.get_number_of_entities())), std::string::npos);
+    ASSERT_NE(remote_console.metrics[2].find(" instances="), std::string::npos);
+}
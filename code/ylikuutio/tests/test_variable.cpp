@@ -82,8 +82,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_TRUE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_TRUE(variable_value->get<bool>());
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_bool_false_no_activate_callback_no_read_callback)
@@ -115,8 +115,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_FALSE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_FALSE(variable_value->get<bool>());
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_char_lowercase_a_no_activate_callback_no_read_callback)
@@ -148,8 +148,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), 'a');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), 'a');
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_char_lowercase_b_no_activate_callback_no_read_callback)
@@ -181,8 +181,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), 'b');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), 'b');
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_char_space_no_activate_callback_no_read_callback)
@@ -214,8 +214,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), ' ');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), ' ');
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_char_newline_no_activate_callback_no_read_callback)
@@ -247,8 +247,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), '\n');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), '\n');
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_float_0_no_activate_callback_no_read_callback)
@@ -280,8 +280,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), 0.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), 0.0f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_named_variable_float_positive_infinity_no_activate_callback_no_read_callback)
@@ -302,8 +302,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), std::numeric_limits<float>::infinity());
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), std::numeric_limits<float>::infinity());
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_named_variable_float_negative_infinity_no_activate_callback_no_read_callback)
@@ -324,8 +324,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), -1.0f * std::numeric_limits<float>::infinity());
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), -1.0f * std::numeric_limits<float>::infinity());
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_named_variable_float_nan_no_activate_callback_no_read_callback)
@@ -344,11 +344,11 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     yli::ontology::Variable* const variable = application.get_universe().get_variable("foo");
     ASSERT_NE(variable, nullptr);
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_TRUE(std::isnan(std::get<float>(variable_value->data)));
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_TRUE(std::isnan(variable_value->get<float>()));
     ASSERT_NE(variable->get(), std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(variable->get()->data));
-    ASSERT_TRUE(std::isnan(std::get<float>(variable->get()->data)));
+    ASSERT_TRUE(variable->get()->holds<float>());
+    ASSERT_TRUE(std::isnan(variable->get()->get<float>()));
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_double_0_no_activate_callback_no_read_callback)
@@ -380,8 +380,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), 0.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), 0.0);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_named_variable_double_positive_infinity_no_activate_callback_no_read_callback)
@@ -402,8 +402,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), std::numeric_limits<double>::infinity());
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), std::numeric_limits<double>::infinity());
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_named_variable_double_negative_infinity_no_activate_callback_no_read_callback)
@@ -424,8 +424,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), -1.0 * std::numeric_limits<double>::infinity());
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), -1.0 * std::numeric_limits<double>::infinity());
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_named_variable_double_nan_no_activate_callback_no_read_callback)
@@ -444,11 +444,11 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     yli::ontology::Variable* const variable = application.get_universe().get_variable("foo");
     ASSERT_NE(variable, nullptr);
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_TRUE(std::isnan(std::get<double>(variable_value->data)));
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_TRUE(std::isnan(variable_value->get<double>()));
     ASSERT_NE(variable->get(), std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<double>(variable->get()->data));
-    ASSERT_TRUE(std::isnan(std::get<double>(variable->get()->data)));
+    ASSERT_TRUE(variable->get()->holds<double>());
+    ASSERT_TRUE(std::isnan(variable->get()->get<double>()));
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_int32_t_0_no_activate_callback_no_read_callback)
@@ -480,8 +480,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 0);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_int32_t_plus_1_no_activate_callback_no_read_callback)
@@ -513,8 +513,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 1);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_int32_t_minus_1_no_activate_callback_no_read_callback)
@@ -546,8 +546,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), -1);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), -1);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_int32_t_max_no_activate_callback_no_read_callback)
@@ -579,8 +579,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), std::numeric_limits<std::int32_t>::max());
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), std::numeric_limits<std::int32_t>::max());
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_int32_t_min_no_activate_callback_no_read_callback)
@@ -612,8 +612,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), std::numeric_limits<std::int32_t>::min());
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), std::numeric_limits<std::int32_t>::min());
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_uint32_t_0_no_activate_callback_no_read_callback)
@@ -645,8 +645,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 0);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_uint32_t_plus_1_no_activate_callback_no_read_callback)
@@ -678,8 +678,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 1);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_uint32_t_max_no_activate_callback_no_read_callback)
@@ -711,8 +711,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_named_variabl
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), std::numeric_limits<std::uint32_t>::max());
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), std::numeric_limits<std::uint32_t>::max());
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_x_float_1234_dot_25_with_activate_callback_and_read_callback)
@@ -738,8 +738,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
 
     std::optional<yli::data::AnyValue> x_value = x_variable->get();
     ASSERT_NE(x_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(x_value->data));
-    ASSERT_EQ(std::get<float>(x_value->data), 1234.25f);
+    ASSERT_TRUE(x_value->holds<float>());
+    ASSERT_EQ(x_value->get<float>(), 1234.25f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_y_float_1234_dot_25_with_activate_callback_and_read_callback)
@@ -765,8 +765,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
 
     std::optional<yli::data::AnyValue> y_value = y_variable->get();
     ASSERT_NE(y_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(y_value->data));
-    ASSERT_EQ(std::get<float>(y_value->data), 1234.25f);
+    ASSERT_TRUE(y_value->holds<float>());
+    ASSERT_EQ(y_value->get<float>(), 1234.25f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_z_float_1234_dot_25_with_activate_callback_and_read_callback)
@@ -792,8 +792,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
 
     std::optional<yli::data::AnyValue> z_value = z_variable->get();
     ASSERT_NE(z_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(z_value->data));
-    ASSERT_EQ(std::get<float>(z_value->data), 1234.25f);
+    ASSERT_TRUE(z_value->holds<float>());
+    ASSERT_EQ(z_value->get<float>(), 1234.25f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_red_float_0_dot_0_with_activate_callback)
@@ -815,8 +815,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
     ASSERT_EQ(red_variable->variable_value, *red_variable->get());
     std::optional<yli::data::AnyValue> red_value = red_variable->get();
     ASSERT_NE(red_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(red_value->data));
-    ASSERT_EQ(std::get<float>(red_value->data), 0.0f);
+    ASSERT_TRUE(red_value->holds<float>());
+    ASSERT_EQ(red_value->get<float>(), 0.0f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_red_float_1_dot_0_with_activate_callback)
@@ -838,8 +838,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
     ASSERT_EQ(red_variable->variable_value, *red_variable->get());
     std::optional<yli::data::AnyValue> red_value = red_variable->get();
     ASSERT_NE(red_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(red_value->data));
-    ASSERT_EQ(std::get<float>(red_value->data), 1.0f);
+    ASSERT_TRUE(red_value->holds<float>());
+    ASSERT_EQ(red_value->get<float>(), 1.0f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_red_float_0_dot_875_with_activate_callback)
@@ -861,8 +861,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
     ASSERT_EQ(red_variable->variable_value, *red_variable->get());
     std::optional<yli::data::AnyValue> red_value = red_variable->get();
     ASSERT_NE(red_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(red_value->data));
-    ASSERT_EQ(std::get<float>(red_value->data), 0.875f);
+    ASSERT_TRUE(red_value->holds<float>());
+    ASSERT_EQ(red_value->get<float>(), 0.875f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_green_float_0_dot_0_with_activate_callback)
@@ -884,8 +884,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
     ASSERT_EQ(green_variable->variable_value, *green_variable->get());
     std::optional<yli::data::AnyValue> green_value = green_variable->get();
     ASSERT_NE(green_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(green_value->data));
-    ASSERT_EQ(std::get<float>(green_value->data), 0.0f);
+    ASSERT_TRUE(green_value->holds<float>());
+    ASSERT_EQ(green_value->get<float>(), 0.0f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_green_float_1_dot_0_with_activate_callback)
@@ -907,8 +907,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
     ASSERT_EQ(green_variable->variable_value, *green_variable->get());
     std::optional<yli::data::AnyValue> green_value = green_variable->get();
     ASSERT_NE(green_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(green_value->data));
-    ASSERT_EQ(std::get<float>(green_value->data), 1.0f);
+    ASSERT_TRUE(green_value->holds<float>());
+    ASSERT_EQ(green_value->get<float>(), 1.0f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_green_float_0_dot_875_with_activate_callback)
@@ -930,8 +930,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
     ASSERT_EQ(green_variable->variable_value, *green_variable->get());
     std::optional<yli::data::AnyValue> green_value = green_variable->get();
     ASSERT_NE(green_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(green_value->data));
-    ASSERT_EQ(std::get<float>(green_value->data), 0.875f);
+    ASSERT_TRUE(green_value->holds<float>());
+    ASSERT_EQ(green_value->get<float>(), 0.875f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_blue_float_0_dot_0_with_activate_callback)
@@ -953,8 +953,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
     ASSERT_EQ(blue_variable->variable_value, *blue_variable->get());
     std::optional<yli::data::AnyValue> blue_value = blue_variable->get();
     ASSERT_NE(blue_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(blue_value->data));
-    ASSERT_EQ(std::get<float>(blue_value->data), 0.0f);
+    ASSERT_TRUE(blue_value->holds<float>());
+    ASSERT_EQ(blue_value->get<float>(), 0.0f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_blue_float_1_dot_0_with_activate_callback)
@@ -976,8 +976,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
     ASSERT_EQ(blue_variable->variable_value, *blue_variable->get());
     std::optional<yli::data::AnyValue> blue_value = blue_variable->get();
     ASSERT_NE(blue_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(blue_value->data));
-    ASSERT_EQ(std::get<float>(blue_value->data), 1.0f);
+    ASSERT_TRUE(blue_value->holds<float>());
+    ASSERT_EQ(blue_value->get<float>(), 1.0f);
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_variable_universe_blue_float_0_dot_875_with_activate_callback)
@@ -999,8 +999,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_variable_univ
     ASSERT_EQ(blue_variable->variable_value, *blue_variable->get());
     std::optional<yli::data::AnyValue> blue_value = blue_variable->get();
     ASSERT_NE(blue_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(blue_value->data));
-    ASSERT_EQ(std::get<float>(blue_value->data), 0.875f);
+    ASSERT_TRUE(blue_value->holds<float>());
+    ASSERT_EQ(blue_value->get<float>(), 0.875f);
 }
 
 TEST(variables_must_be_initialized_appropriately, headless_universe_variable_universe_cartesian_coordinates_x_y_z_activate_callbacks_and_read_callbacks)
@@ -1048,32 +1048,32 @@ TEST(variables_must_be_initialized_appropriately, headless_universe_variable_uni
     ASSERT_NE(x_variable, nullptr);
     std::optional<yli::data::AnyValue> x_value = x_variable->get();
     ASSERT_NE(x_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(x_value->data));
-    ASSERT_EQ(std::get<float>(x_value->data), 1234.25f);
+    ASSERT_TRUE(x_value->holds<float>());
+    ASSERT_EQ(x_value->get<float>(), 1234.25f);
 
     ASSERT_NE(application.get_universe().get_variable("y"), nullptr);
     yli::ontology::Variable* y_variable = application.get_universe().get_variable("y");
     ASSERT_NE(y_variable, nullptr);
     std::optional<yli::data::AnyValue> y_value = y_variable->get();
     ASSERT_NE(y_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(y_value->data));
-    ASSERT_EQ(std::get<float>(y_value->data), 2345.50f);
+    ASSERT_TRUE(y_value->holds<float>());
+    ASSERT_EQ(y_value->get<float>(), 2345.50f);
 
     ASSERT_NE(application.get_universe().get_variable("z"), nullptr);
     yli::ontology::Variable* z_variable = application.get_universe().get_variable("z");
     ASSERT_NE(z_variable, nullptr);
     std::optional<yli::data::AnyValue> z_value = z_variable->get();
     ASSERT_NE(z_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(z_value->data));
-    ASSERT_EQ(std::get<float>(z_value->data), 3456.75f);
+    ASSERT_TRUE(z_value->holds<float>());
+    ASSERT_EQ(z_value->get<float>(), 3456.75f);
 
     ASSERT_NE(application.get_universe().get_variable("cartesian"), nullptr);
     yli::ontology::Variable* cartesian_coordinates_variable = application.get_universe().get_variable("cartesian");
     ASSERT_NE(cartesian_coordinates_variable, nullptr);
     std::optional<yli::data::AnyValue> cartesian_coordinates_value = cartesian_coordinates_variable->get();
     ASSERT_NE(cartesian_coordinates_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<const glm::vec3>>(cartesian_coordinates_value->data));
-    ASSERT_EQ(std::get<std::reference_wrapper<const glm::vec3>>(cartesian_coordinates_value->data).get(), glm::vec3(1234.25f, 2345.50f, 3456.75f));
+    ASSERT_TRUE(cartesian_coordinates_value->holds<glm::vec3>());
+    ASSERT_EQ(cartesian_coordinates_value->get<glm::vec3>(), glm::vec3(1234.25f, 2345.50f, 3456.75f));
 }
 
 TEST(variables_must_be_initialized_appropriately, headless_universe_variable_universe_x_y_z_cartesian_coordinates_activate_callbacks_and_read_callbacks)
@@ -1121,32 +1121,32 @@ TEST(variables_must_be_initialized_appropriately, headless_universe_variable_uni
     ASSERT_NE(x_variable, nullptr);
     std::optional<yli::data::AnyValue> x_value = x_variable->get();
     ASSERT_NE(x_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(x_value->data));
-    ASSERT_EQ(std::get<float>(x_value->data), 1234.25f);
+    ASSERT_TRUE(x_value->holds<float>());
+    ASSERT_EQ(x_value->get<float>(), 1234.25f);
 
     ASSERT_NE(application.get_universe().get_variable("y"), nullptr);
     yli::ontology::Variable* y_variable = application.get_universe().get_variable("y");
     ASSERT_NE(y_variable, nullptr);
     std::optional<yli::data::AnyValue> y_value = y_variable->get();
     ASSERT_NE(y_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(y_value->data));
-    ASSERT_EQ(std::get<float>(y_value->data), 2345.50f);
+    ASSERT_TRUE(y_value->holds<float>());
+    ASSERT_EQ(y_value->get<float>(), 2345.50f);
 
     ASSERT_NE(application.get_universe().get_variable("z"), nullptr);
     yli::ontology::Variable* z_variable = application.get_universe().get_variable("z");
     ASSERT_NE(z_variable, nullptr);
     std::optional<yli::data::AnyValue> z_value = z_variable->get();
     ASSERT_NE(z_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(z_value->data));
-    ASSERT_EQ(std::get<float>(z_value->data), 3456.75f);
+    ASSERT_TRUE(z_value->holds<float>());
+    ASSERT_EQ(z_value->get<float>(), 3456.75f);
 
     ASSERT_NE(application.get_universe().get_variable("cartesian"), nullptr);
     yli::ontology::Variable* cartesian_coordinates_variable = application.get_universe().get_variable("cartesian");
     ASSERT_NE(cartesian_coordinates_variable, nullptr);
     std::optional<yli::data::AnyValue> cartesian_coordinates_value = cartesian_coordinates_variable->get();
     ASSERT_NE(cartesian_coordinates_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<std::reference_wrapper<const glm::vec3>>(cartesian_coordinates_value->data));
-    ASSERT_EQ(std::get<std::reference_wrapper<const glm::vec3>>(cartesian_coordinates_value->data).get(), glm::vec3(1234.25f, 2345.50f, 3456.75f));
+    ASSERT_TRUE(cartesian_coordinates_value->holds<glm::vec3>());
+    ASSERT_EQ(cartesian_coordinates_value->get<glm::vec3>(), glm::vec3(1234.25f, 2345.50f, 3456.75f));
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_variable_universe_x_y_z_cartesian_coordinates_activate_callbacks_and_read_callbacks)
@@ -1197,23 +1197,23 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_variable_u
     x_variable->set("0.875");
     std::optional<yli::data::AnyValue> x_value = x_variable->get();
     ASSERT_NE(x_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(x_value->data));
-    ASSERT_EQ(std::get<float>(x_value->data), 0.875f);
-    ASSERT_EQ(std::get<std::reference_wrapper<const glm::vec3>>(cartesian_coordinates_variable->get()->data).get(), glm::vec3(0.875f, 2345.50f, 3456.75f));
+    ASSERT_TRUE(x_value->holds<float>());
+    ASSERT_EQ(x_value->get<float>(), 0.875f);
+    ASSERT_EQ(cartesian_coordinates_variable->get()->get<glm::vec3>(), glm::vec3(0.875f, 2345.50f, 3456.75f));
 
     y_variable->set("0.9375");
     std::optional<yli::data::AnyValue> y_value = y_variable->get();
     ASSERT_NE(y_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(y_value->data));
-    ASSERT_EQ(std::get<float>(y_value->data), 0.9375f);
-    ASSERT_EQ(std::get<std::reference_wrapper<const glm::vec3>>(cartesian_coordinates_variable->get()->data).get(), glm::vec3(0.875f, 0.9375f, 3456.75f));
+    ASSERT_TRUE(y_value->holds<float>());
+    ASSERT_EQ(y_value->get<float>(), 0.9375f);
+    ASSERT_EQ(cartesian_coordinates_variable->get()->get<glm::vec3>(), glm::vec3(0.875f, 0.9375f, 3456.75f));
 
     z_variable->set("0.96875");
     std::optional<yli::data::AnyValue> z_value = z_variable->get();
     ASSERT_NE(z_value, std::nullopt);
-    ASSERT_TRUE(std::holds_alternative<float>(z_value->data));
-    ASSERT_EQ(std::get<float>(z_value->data), 0.96875f);
-    ASSERT_EQ(std::get<std::reference_wrapper<const glm::vec3>>(cartesian_coordinates_variable->get()->data).get(), glm::vec3(0.875f, 0.9375f, 0.96875f));
+    ASSERT_TRUE(z_value->holds<float>());
+    ASSERT_EQ(z_value->get<float>(), 0.96875f);
+    ASSERT_EQ(cartesian_coordinates_variable->get()->get<glm::vec3>(), glm::vec3(0.875f, 0.9375f, 0.96875f));
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_bool_true_new_value_true_no_activate_callback_no_read_callback)
@@ -1230,8 +1230,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_TRUE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_TRUE(variable_value->get<bool>());
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_bool_true_new_value_false_no_activate_callback_no_read_callback)
@@ -1248,8 +1248,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_FALSE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_FALSE(variable_value->get<bool>());
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_bool_false_new_value_true_no_activate_callback_no_read_callback)
@@ -1266,8 +1266,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_TRUE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_TRUE(variable_value->get<bool>());
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_bool_false_new_value_false_no_activate_callback_no_read_callback)
@@ -1284,8 +1284,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_FALSE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_FALSE(variable_value->get<bool>());
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_bool_true_new_value_foo_no_activate_callback_no_read_callback)
@@ -1302,8 +1302,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_TRUE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_TRUE(variable_value->get<bool>());
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_bool_false_new_value_foo_no_activate_callback_no_read_callback)
@@ -1320,8 +1320,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_FALSE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_FALSE(variable_value->get<bool>());
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_char_lowercase_a_new_value_a_no_activate_callback_no_read_callback)
@@ -1338,8 +1338,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), 'a');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), 'a');
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_char_lowercase_a_new_value_b_no_activate_callback_no_read_callback)
@@ -1356,8 +1356,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), 'b');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), 'b');
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_char_lowercase_a_new_value_A_no_activate_callback_no_read_callback)
@@ -1374,8 +1374,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), 'A');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), 'A');
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_char_lowercase_a_new_value_space_no_activate_callback_no_read_callback)
@@ -1392,8 +1392,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), ' ');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), ' ');
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_char_lowercase_a_new_value_newline_no_activate_callback_no_read_callback)
@@ -1410,8 +1410,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), '\n');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), '\n');
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_char_lowercase_a_new_value_ba_no_activate_callback_no_read_callback)
@@ -1428,8 +1428,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), 'a');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), 'a');
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_char_lowercase_a_new_value_bb_no_activate_callback_no_read_callback)
@@ -1446,8 +1446,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), 'a');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), 'a');
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_char_lowercase_a_new_value_bc_no_activate_callback_no_read_callback)
@@ -1464,8 +1464,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<char>(variable_value->data));
-    ASSERT_EQ(std::get<char>(variable_value->data), 'a');
+    ASSERT_TRUE(variable_value->holds<char>());
+    ASSERT_EQ(variable_value->get<char>(), 'a');
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_0_new_value_0_no_activate_callback_no_read_callback)
@@ -1482,8 +1482,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), 0.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), 0.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_0_new_value_0_dot_0_no_activate_callback_no_read_callback)
@@ -1500,8 +1500,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), 0.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), 0.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_0_new_value_plus_1_no_activate_callback_no_read_callback)
@@ -1518,8 +1518,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), 1.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), 1.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_0_new_value_plus_1_dot_0_no_activate_callback_no_read_callback)
@@ -1536,8 +1536,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), 1.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), 1.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_0_new_value_minus_1_no_activate_callback_no_read_callback)
@@ -1554,8 +1554,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), -1.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), -1.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_0_new_value_minus_1_dot_0_no_activate_callback_no_read_callback)
@@ -1572,8 +1572,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), -1.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), -1.0f);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_float_0_new_value_foo_no_activate_callback_no_read_callback)
@@ -1590,8 +1590,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), 0.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), 0.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_plus_1_new_value_0_no_activate_callback_no_read_callback)
@@ -1608,8 +1608,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), 0.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), 0.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_plus_1_new_value_0_dot_0_no_activate_callback_no_read_callback)
@@ -1626,8 +1626,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), 0.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), 0.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_plus_1_new_value_plus_1_no_activate_callback_no_read_callback)
@@ -1644,8 +1644,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), 1.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), 1.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_plus_1_new_value_plus_1_dot_0_no_activate_callback_no_read_callback)
@@ -1662,8 +1662,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), 1.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), 1.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_plus_1_new_value_minus_1_no_activate_callback_no_read_callback)
@@ -1680,8 +1680,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), -1.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), -1.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_float_plus_1_new_value_minus_1_dot_0_no_activate_callback_no_read_callback)
@@ -1698,8 +1698,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), -1.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), -1.0f);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_float_plus_1_new_value_foo_no_activate_callback_no_read_callback)
@@ -1716,8 +1716,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<float>(variable_value->data));
-    ASSERT_EQ(std::get<float>(variable_value->data), 1.0f);
+    ASSERT_TRUE(variable_value->holds<float>());
+    ASSERT_EQ(variable_value->get<float>(), 1.0f);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_0_new_value_0_no_activate_callback_no_read_callback)
@@ -1734,8 +1734,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), 0.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), 0.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_0_new_value_0_dot_0_no_activate_callback_no_read_callback)
@@ -1752,8 +1752,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), 0.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), 0.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_0_new_value_plus_1_no_activate_callback_no_read_callback)
@@ -1770,8 +1770,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), 1.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), 1.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_0_new_value_plus_1_dot_0_no_activate_callback_no_read_callback)
@@ -1788,8 +1788,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), 1.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), 1.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_0_new_value_minus_1_no_activate_callback_no_read_callback)
@@ -1806,8 +1806,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), -1.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), -1.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_0_new_value_minus_1_dot_0_no_activate_callback_no_read_callback)
@@ -1824,8 +1824,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), -1.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), -1.0);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_double_0_new_value_foo_no_activate_callback_no_read_callback)
@@ -1842,8 +1842,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), 0.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), 0.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_plus_1_new_value_0_no_activate_callback_no_read_callback)
@@ -1860,8 +1860,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), 0.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), 0.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_plus_1_new_value_0_dot_0_no_activate_callback_no_read_callback)
@@ -1878,8 +1878,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), 0.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), 0.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_plus_1_new_value_plus_1_no_activate_callback_no_read_callback)
@@ -1896,8 +1896,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), 1.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), 1.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_plus_1_new_value_plus_1_dot_0_no_activate_callback_no_read_callback)
@@ -1914,8 +1914,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), 1.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), 1.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_plus_1_new_value_minus_1_no_activate_callback_no_read_callback)
@@ -1932,8 +1932,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), -1.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), -1.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_double_plus_1_new_value_minus_1_dot_0_no_activate_callback_no_read_callback)
@@ -1950,8 +1950,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), -1.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), -1.0);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_double_plus_1_new_value_foo_no_activate_callback_no_read_callback)
@@ -1968,8 +1968,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<double>(variable_value->data));
-    ASSERT_EQ(std::get<double>(variable_value->data), 1.0);
+    ASSERT_TRUE(variable_value->holds<double>());
+    ASSERT_EQ(variable_value->get<double>(), 1.0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_int32_t_0_new_value_0_no_activate_callback_no_read_callback)
@@ -1986,8 +1986,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_int32_t_0_new_value_plus_1_no_activate_callback_no_read_callback)
@@ -2004,8 +2004,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 1);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_int32_t_0_new_value_minus_1_no_activate_callback_no_read_callback)
@@ -2022,8 +2022,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), -1);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), -1);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_int32_t_0_new_value_0_dot_0_no_activate_callback_no_read_callback)
@@ -2040,8 +2040,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 0);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_int32_t_0_new_value_plus_1_dot_0_no_activate_callback_no_read_callback)
@@ -2058,8 +2058,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 0);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_int32_t_0_new_value_minus_1_dot_0_no_activate_callback_no_read_callback)
@@ -2076,8 +2076,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 0);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_int32_t_0_new_value_foo_no_activate_callback_no_read_callback)
@@ -2094,8 +2094,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_int32_t_plus_1_new_value_0_no_activate_callback_no_read_callback)
@@ -2112,8 +2112,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_int32_t_plus_1_new_value_plus_1_no_activate_callback_no_read_callback)
@@ -2130,8 +2130,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 1);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_int32_t_plus_1_new_value_minus_1_no_activate_callback_no_read_callback)
@@ -2148,8 +2148,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), -1);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), -1);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_int32_t_plus_1_new_value_0_dot_0_no_activate_callback_no_read_callback)
@@ -2166,8 +2166,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 1);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_int32_t_plus_1_new_value_plus_1_dot_0_no_activate_callback_no_read_callback)
@@ -2184,8 +2184,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 1);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_int32_t_plus_1_new_value_foo_no_activate_callback_no_read_callback)
@@ -2202,8 +2202,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::int32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::int32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::int32_t>());
+    ASSERT_EQ(variable_value->get<std::int32_t>(), 1);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_uint32_t_0_new_value_0_no_activate_callback_no_read_callback)
@@ -2220,8 +2220,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_uint32_t_0_new_value_plus_1_no_activate_callback_no_read_callback)
@@ -2238,8 +2238,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 1);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_uint32_t_0_new_value_minus_1_no_activate_callback_no_read_callback)
@@ -2256,8 +2256,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 0);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_uint32_t_0_new_value_0_dot_0_no_activate_callback_no_read_callback)
@@ -2274,8 +2274,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 0);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_uint32_t_0_new_value_plus_1_dot_0_no_activate_callback_no_read_callback)
@@ -2292,8 +2292,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 0);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_uint32_t_0_new_value_minus_1_dot_0_no_activate_callback_no_read_callback)
@@ -2310,8 +2310,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 0);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_uint32_t_0_new_value_foo_no_activate_callback_no_read_callback)
@@ -2328,8 +2328,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_uint32_t_plus_1_new_value_0_no_activate_callback_no_read_callback)
@@ -2346,8 +2346,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 0);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 0);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_uint32_t_plus_1_new_value_plus_1_no_activate_callback_no_read_callback)
@@ -2364,8 +2364,8 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 1);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_uint32_t_plus_1_new_value_minus_1_no_activate_callback_no_read_callback)
@@ -2382,8 +2382,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 1);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_uint32_t_plus_1_new_value_0_dot_0_no_activate_callback_no_read_callback)
@@ -2400,8 +2400,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 1);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_uint32_t_plus_1_new_value_plus_1_dot_0_no_activate_callback_no_read_callback)
@@ -2418,8 +2418,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 1);
 }
 
 TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_named_variable_originally_uint32_t_plus_1_new_value_foo_no_activate_callback_no_read_callback)
@@ -2436,8 +2436,8 @@ TEST(variable_value_must_not_be_modified_for_invalid_value, headless_universe_na
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<std::uint32_t>(variable_value->data));
-    ASSERT_EQ(std::get<std::uint32_t>(variable_value->data), 1);
+    ASSERT_TRUE(variable_value->holds<std::uint32_t>());
+    ASSERT_EQ(variable_value->get<std::uint32_t>(), 1);
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_bool_true_copy_value_true_no_activate_callback_no_read_callback)
@@ -2455,11 +2455,11 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_TRUE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_TRUE(variable_value->get<bool>());
 
-    bool_true_any_value.data = false;
-    ASSERT_TRUE(std::get<bool>(variable_value->data)); // Must do a deep copy, that is, changing the source value after copying must not affect the dest value.
+    bool_true_any_value = yli::data::AnyValue(false);
+    ASSERT_TRUE(variable_value->get<bool>()); // Must do a deep copy, that is, changing the source value after copying must not affect the dest value.
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_bool_true_copy_value_false_no_activate_callback_no_read_callback)
@@ -2477,11 +2477,11 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_FALSE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_FALSE(variable_value->get<bool>());
 
-    bool_false_any_value.data = true;
-    ASSERT_FALSE(std::get<bool>(variable_value->data)); // Must do a deep copy, that is, changing the source value after copying must not affect the dest value.
+    bool_false_any_value = yli::data::AnyValue(true);
+    ASSERT_FALSE(variable_value->get<bool>()); // Must do a deep copy, that is, changing the source value after copying must not affect the dest value.
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_bool_false_copy_value_true_no_activate_callback_no_read_callback)
@@ -2499,11 +2499,11 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_TRUE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_TRUE(variable_value->get<bool>());
 
-    bool_true_any_value.data = false;
-    ASSERT_TRUE(std::get<bool>(variable_value->data)); // Must do a deep copy, that is, changing the source value after copying must not affect the dest value.
+    bool_true_any_value = yli::data::AnyValue(false);
+    ASSERT_TRUE(variable_value->get<bool>()); // Must do a deep copy, that is, changing the source value after copying must not affect the dest value.
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_named_variable_originally_bool_false_copy_value_false_no_activate_callback_no_read_callback)
@@ -2521,11 +2521,11 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_named_vari
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_FALSE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_FALSE(variable_value->get<bool>());
 
-    bool_false_any_value.data = true;
-    ASSERT_FALSE(std::get<bool>(variable_value->data)); // Must do a deep copy, that is, changing the source value after copying must not affect the dest value.
+    bool_false_any_value = yli::data::AnyValue(true);
+    ASSERT_FALSE(variable_value->get<bool>()); // Must do a deep copy, that is, changing the source value after copying must not affect the dest value.
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_variable_with_global_name_bool_true_set_to_false_no_activate_callback_no_read_callback)
@@ -2539,12 +2539,12 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_variable_w
     yli::ontology::Variable* const variable = application.get_universe().get_variable("foo");
 
     yli::ontology::Variable::set_variable_const_std_string(*variable, "false");
-    ASSERT_TRUE(std::holds_alternative<bool>(variable->variable_value.data));
-    ASSERT_FALSE(std::get<bool>(variable->variable_value.data));
+    ASSERT_TRUE(variable->variable_value.holds<bool>());
+    ASSERT_FALSE(variable->variable_value.get<bool>());
 
     yli::ontology::Variable::set_variable_const_std_string(*variable, "true");
-    ASSERT_TRUE(std::holds_alternative<bool>(variable->variable_value.data));
-    ASSERT_TRUE(std::get<bool>(variable->variable_value.data));
+    ASSERT_TRUE(variable->variable_value.holds<bool>());
+    ASSERT_TRUE(variable->variable_value.get<bool>());
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_variable_with_global_name_bool_false_set_to_true_no_activate_callback_no_read_callback)
@@ -2558,12 +2558,12 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_variable_w
     yli::ontology::Variable* const variable = application.get_universe().get_variable("foo");
 
     yli::ontology::Variable::set_variable_const_std_string(*variable, "true");
-    ASSERT_TRUE(std::holds_alternative<bool>(variable->variable_value.data));
-    ASSERT_TRUE(std::get<bool>(variable->variable_value.data));
+    ASSERT_TRUE(variable->variable_value.holds<bool>());
+    ASSERT_TRUE(variable->variable_value.get<bool>());
 
     yli::ontology::Variable::set_variable_const_std_string(*variable, "false");
-    ASSERT_TRUE(std::holds_alternative<bool>(variable->variable_value.data));
-    ASSERT_FALSE(std::get<bool>(variable->variable_value.data));
+    ASSERT_TRUE(variable->variable_value.holds<bool>());
+    ASSERT_FALSE(variable->variable_value.get<bool>());
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_variable_with_global_name_bool_true_set_to_true_no_activate_callback_no_read_callback)
@@ -2577,12 +2577,12 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_variable_w
     yli::ontology::Variable* const variable = application.get_universe().get_variable("foo");
 
     yli::ontology::Variable::set_variable_const_std_string(*variable, "true");
-    ASSERT_TRUE(std::holds_alternative<bool>(variable->variable_value.data));
-    ASSERT_TRUE(std::get<bool>(variable->variable_value.data));
+    ASSERT_TRUE(variable->variable_value.holds<bool>());
+    ASSERT_TRUE(variable->variable_value.get<bool>());
 
     yli::ontology::Variable::set_variable_const_std_string(*variable, "false");
-    ASSERT_TRUE(std::holds_alternative<bool>(variable->variable_value.data));
-    ASSERT_FALSE(std::get<bool>(variable->variable_value.data));
+    ASSERT_TRUE(variable->variable_value.holds<bool>());
+    ASSERT_FALSE(variable->variable_value.get<bool>());
 }
 
 TEST(variable_value_must_be_modified_appropriately, headless_universe_variable_with_global_name_bool_false_set_to_false_no_activate_callback_no_read_callback)
@@ -2596,12 +2596,12 @@ TEST(variable_value_must_be_modified_appropriately, headless_universe_variable_w
     yli::ontology::Variable* const variable = application.get_universe().get_variable("foo");
 
     yli::ontology::Variable::set_variable_const_std_string(*variable, "false");
-    ASSERT_TRUE(std::holds_alternative<bool>(variable->variable_value.data));
-    ASSERT_FALSE(std::get<bool>(variable->variable_value.data));
+    ASSERT_TRUE(variable->variable_value.holds<bool>());
+    ASSERT_FALSE(variable->variable_value.get<bool>());
 
     yli::ontology::Variable::set_variable_const_std_string(*variable, "true");
-    ASSERT_TRUE(std::holds_alternative<bool>(variable->variable_value.data));
-    ASSERT_TRUE(std::get<bool>(variable->variable_value.data));
+    ASSERT_TRUE(variable->variable_value.holds<bool>());
+    ASSERT_TRUE(variable->variable_value.get<bool>());
 }
 
 TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_variable_bool_true_no_activate_callback_no_read_callback_ecosystem_given_as_valid_pointer)
@@ -2620,8 +2620,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_varia
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_TRUE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_TRUE(variable_value->get<bool>());
 
     ASSERT_FALSE(application.get_universe().has_variable("foo"));
     ASSERT_EQ(application.get_universe().get_variable("foo"), nullptr);
@@ -2657,8 +2657,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_varia
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_TRUE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_TRUE(variable_value->get<bool>());
 
     ASSERT_FALSE(application.get_universe().has_variable("foo"));
     ASSERT_EQ(application.get_universe().get_variable("foo"), nullptr);
@@ -2693,8 +2693,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_varia
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_TRUE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_TRUE(variable_value->get<bool>());
 
     ASSERT_FALSE(application.get_universe().has_variable("bar"));
     ASSERT_EQ(application.get_universe().get_variable("bar"), nullptr);
@@ -2731,8 +2731,8 @@ TEST(variable_must_be_initialized_appropriately, headless_universe_unnamed_varia
     ASSERT_NE(variable->get(), std::nullopt);
     ASSERT_EQ(variable->variable_value, *variable->get());
     std::optional<yli::data::AnyValue> variable_value = variable->get();
-    ASSERT_TRUE(std::holds_alternative<bool>(variable_value->data));
-    ASSERT_TRUE(std::get<bool>(variable_value->data));
+    ASSERT_TRUE(variable_value->holds<bool>());
+    ASSERT_TRUE(variable_value->get<bool>());
 
     ASSERT_FALSE(application.get_universe().has_variable("baz"));
     ASSERT_EQ(application.get_universe().get_variable("baz"), nullptr);
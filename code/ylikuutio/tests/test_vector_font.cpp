@@ -23,6 +23,7 @@
 #include "code/ylikuutio/ontology/pipeline.hpp"
 #include "code/ylikuutio/ontology/material.hpp"
 #include "code/ylikuutio/ontology/vector_font.hpp"
+#include "code/ylikuutio/ontology/glyph.hpp"
 #include "code/ylikuutio/ontology/request.hpp"
 #include "code/ylikuutio/ontology/texture_file_format.hpp"
 #include "code/ylikuutio/ontology/ecosystem_struct.hpp"
@@ -39,7 +40,6 @@
 namespace yli::ontology
 {
     class GenericParentModule;
-    class Glyph;
 }
 
 TEST(vector_font_must_be_initialized_and_must_bind_to_material_appropriately, headless_pipeline_and_material_are_children_of_an_ecosystem_material_parent_provided_as_valid_pointer)
@@ -298,3 +298,46 @@ TEST(vector_font_must_be_initialized_and_must_bind_to_material_appropriately, he
     ASSERT_EQ(vector_font->get_parent(), nullptr);
     ASSERT_EQ(vector_font->get_number_of_non_variable_children(), 0);
 }
+
+TEST(vector_font_must_load_its_glyphs_appropriately, headless_kongtext_svg)
+{
+    mock::MockApplication application;
+    yli::ontology::EcosystemStruct ecosystem_struct;
+    yli::ontology::Ecosystem* const ecosystem = application.get_generic_entity_factory().create_ecosystem(
+            ecosystem_struct);
+
+    yli::ontology::PipelineStruct pipeline_struct { yli::ontology::Request(ecosystem) };
+    yli::ontology::Pipeline* const pipeline = application.get_generic_entity_factory().create_pipeline(
+            pipeline_struct);
+
+    yli::ontology::MaterialStruct material_struct {
+            yli::ontology::Request(ecosystem),
+            yli::ontology::Request(pipeline),
+            yli::ontology::TextureFileFormat::PNG };
+    yli::ontology::Material* const material = application.get_generic_entity_factory().create_material(
+            material_struct);
+
+    yli::ontology::VectorFontStruct vector_font_struct { yli::ontology::Request(material) };
+    vector_font_struct.font_file_format = "svg";
+    vector_font_struct.font_filename = "kongtext.svg";
+    vector_font_struct.vertex_scaling_factor = 1.0f / 1024.0f;
+    yli::ontology::VectorFont* const vector_font = application.get_generic_entity_factory().create_vector_font(
+            vector_font_struct);
+
+    // Every glyph with a Unicode value, from U+000D to U+2122.
+    ASSERT_EQ(vector_font->get_number_of_non_variable_children(), 217);
+
+    const yli::ontology::Glyph* const a_glyph = vector_font->get_glyph_pointer('A');
+    ASSERT_NE(a_glyph, nullptr);
+    ASSERT_EQ(a_glyph->get_parent(), vector_font);
+
+    // The advance width is the `horiz-adv-x` of the font, not the right edge of the outline (896).
+    ASSERT_EQ(a_glyph->get_advance_width(), 1.0f);
+
+    const yli::ontology::Glyph* const space_glyph = vector_font->get_glyph_pointer(' ');
+    ASSERT_NE(space_glyph, nullptr);
+    ASSERT_EQ(space_glyph->get_advance_width(), 1.0f);
+
+    ASSERT_NE(vector_font->get_glyph_pointer(0x20ac), nullptr); // Euro sign.
+    ASSERT_EQ(vector_font->get_glyph_pointer(0x263a), nullptr); // Not in the font.
+}
@@ -0,0 +1,257 @@
+// Ylikuutio - A 3D game and simulation engine.
+//
+// Copyright (C) 2015-2026 Antti Nuortimo.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "gtest/gtest.h"
+#include "code/mock/mock_application.hpp"
+#include "code/ylikuutio/data/any_value.hpp"
+#include "code/ylikuutio/lisp/value.hpp"
+#include "code/ylikuutio/lisp/virtual_machine.hpp"
+#include "code/ylikuutio/ontology/universe.hpp"
+#include "code/ylikuutio/ontology/console.hpp"
+#include "code/ylikuutio/ontology/variable.hpp"
+#include "code/ylikuutio/ontology/request.hpp"
+#include "code/ylikuutio/ontology/console_struct.hpp"
+#include "code/ylikuutio/ontology/variable_struct.hpp"
+
+// Include standard headers
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::int64_t, std::uint64_t
+#include <optional> // std::optional
+#include <span>     // std::span
+#include <vector>   // std::vector
+
+using yli::lisp::Value;
+using yli::lisp::ValueType;
+using yli::lisp::VirtualMachine;
+
+namespace
+{
+    std::optional<Value> load_and_run(VirtualMachine& virtual_machine, std::string_view source)
+    {
+        const std::optional<std::size_t> program_i = virtual_machine.load(source);
+
+        if (!program_i.has_value())
+        {
+            return std::nullopt;
+        }
+
+        return virtual_machine.run(*program_i);
+    }
+
+    std::optional<yli::data::AnyValue> scale(const float value, const float factor)
+    {
+        return yli::data::AnyValue(value * factor);
+    }
+}
+
+TEST(virtual_machine_must_evaluate_literals_appropriately, literals)
+{
+    VirtualMachine virtual_machine;
+
+    const std::optional<Value> unsigned_value = load_and_run(virtual_machine, "42");
+    ASSERT_TRUE(unsigned_value.has_value());
+    ASSERT_EQ(unsigned_value->type, ValueType::UNSIGNED_INTEGER);
+    ASSERT_EQ(unsigned_value->unsigned_integer, 42);
+
+    const std::optional<Value> signed_value = load_and_run(virtual_machine, "-42");
+    ASSERT_TRUE(signed_value.has_value());
+    ASSERT_EQ(signed_value->type, ValueType::SIGNED_INTEGER);
+    ASSERT_EQ(signed_value->signed_integer, -42);
+
+    const std::optional<Value> string_value = load_and_run(virtual_machine, R"("foo")");
+    ASSERT_TRUE(string_value.has_value());
+    ASSERT_EQ(string_value->type, ValueType::STRING);
+    ASSERT_EQ(virtual_machine.to_string(*string_value), "foo");
+
+    const std::optional<Value> symbol_value = load_and_run(virtual_machine, "foo");
+    ASSERT_TRUE(symbol_value.has_value());
+    ASSERT_EQ(symbol_value->type, ValueType::SYMBOL);
+    ASSERT_EQ(symbol_value->symbol, string_value->symbol);
+
+    const std::optional<Value> nil_value = load_and_run(virtual_machine, "nil");
+    ASSERT_TRUE(nil_value.has_value());
+    ASSERT_EQ(nil_value->type, ValueType::NIL);
+
+    const std::optional<Value> true_value = load_and_run(virtual_machine, "#t");
+    ASSERT_TRUE(true_value.has_value());
+    ASSERT_EQ(true_value->type, ValueType::BOOL);
+    ASSERT_TRUE(true_value->bool_value);
+}
+
+TEST(virtual_machine_must_evaluate_arithmetic_appropriately, nested_calls)
+{
+    VirtualMachine virtual_machine;
+
+    const std::optional<Value> sum = load_and_run(virtual_machine, "(add 1 (mul 2 3))");
+    ASSERT_TRUE(sum.has_value());
+    ASSERT_EQ(sum->type, ValueType::UNSIGNED_INTEGER);
+    ASSERT_EQ(sum->unsigned_integer, 7);
+
+    const std::optional<Value> difference = load_and_run(virtual_machine, "(sub 1 -2)");
+    ASSERT_TRUE(difference.has_value());
+    ASSERT_EQ(difference->type, ValueType::SIGNED_INTEGER);
+    ASSERT_EQ(difference->signed_integer, 3);
+
+    const std::optional<Value> product = load_and_run(virtual_machine, "(mul 2 1.5)");
+    ASSERT_TRUE(product.has_value());
+    ASSERT_EQ(product->type, ValueType::FLOATING_POINT);
+    ASSERT_EQ(product->floating_point, 3.0);
+
+    const std::optional<Value> comparison = load_and_run(virtual_machine, "(lt 1 2.5)");
+    ASSERT_TRUE(comparison.has_value());
+    ASSERT_EQ(comparison->type, ValueType::BOOL);
+    ASSERT_TRUE(comparison->bool_value);
+
+    ASSERT_FALSE(load_and_run(virtual_machine, "(div 1 0)").has_value());
+    ASSERT_FALSE(load_and_run(virtual_machine, "(add 1 foo)").has_value());
+}
+
+TEST(virtual_machine_must_evaluate_if_appropriately, if_then_else)
+{
+    VirtualMachine virtual_machine;
+
+    const std::optional<Value> then_value = load_and_run(virtual_machine, R"((if (lt 1 2) "yes" "no"))");
+    ASSERT_TRUE(then_value.has_value());
+    ASSERT_EQ(virtual_machine.to_string(*then_value), "yes");
+
+    const std::optional<Value> else_value = load_and_run(virtual_machine, R"((if (gt 1 2) "yes" "no"))");
+    ASSERT_TRUE(else_value.has_value());
+    ASSERT_EQ(virtual_machine.to_string(*else_value), "no");
+
+    const std::optional<Value> missing_else_value = load_and_run(virtual_machine, R"((if #f "yes"))");
+    ASSERT_TRUE(missing_else_value.has_value());
+    ASSERT_EQ(missing_else_value->type, ValueType::NIL);
+
+    // `if` as an argument is not in tail position.
+    const std::optional<Value> nested_value = load_and_run(virtual_machine, "(add 1 (if (eq 1 1) 10 20))");
+    ASSERT_TRUE(nested_value.has_value());
+    ASSERT_EQ(nested_value->unsigned_integer, 11);
+}
+
+TEST(virtual_machine_must_call_defined_functions_appropriately, defun)
+{
+    VirtualMachine virtual_machine;
+
+    const std::optional<Value> square = load_and_run(virtual_machine, "(defun square (x) (mul x x)) (square 7)");
+    ASSERT_TRUE(square.has_value());
+    ASSERT_EQ(square->unsigned_integer, 49);
+    ASSERT_TRUE(virtual_machine.is_function("square"));
+
+    const std::vector<Value> arguments { Value::from_signed_integer(-3) };
+    const std::optional<Value> host_call = virtual_machine.call("square", arguments);
+    ASSERT_TRUE(host_call.has_value());
+    ASSERT_EQ(host_call->type, ValueType::SIGNED_INTEGER);
+    ASSERT_EQ(host_call->signed_integer, 9);
+
+    const std::optional<Value> answer = load_and_run(virtual_machine, "(defun answer nil 42) (progn (answer) (answer))");
+    ASSERT_TRUE(answer.has_value());
+    ASSERT_EQ(answer->unsigned_integer, 42);
+
+    const std::optional<Value> two_parameters = load_and_run(virtual_machine, "(defun hypot2 (x y) (add (square x) (square y))) (hypot2 3 4)");
+    ASSERT_TRUE(two_parameters.has_value());
+    ASSERT_EQ(two_parameters->unsigned_integer, 25);
+
+    ASSERT_FALSE(load_and_run(virtual_machine, "(square 1 2)").has_value());
+    ASSERT_FALSE(load_and_run(virtual_machine, "(no-such-function 1)").has_value());
+    ASSERT_FALSE(load_and_run(virtual_machine, "(add 1 (defun foo (x) x))").has_value());
+}
+
+TEST(virtual_machine_must_reuse_frames_in_tail_calls, deep_tail_recursion)
+{
+    VirtualMachine virtual_machine;
+
+    const std::optional<Value> count = load_and_run(
+            virtual_machine,
+            "(defun count (n acc) (if (eq n 0) acc (count (sub n 1) (add acc 1)))) (count 100000 0)");
+    ASSERT_TRUE(count.has_value());
+    ASSERT_EQ(count->unsigned_integer, 100000);
+}
+
+TEST(virtual_machine_must_fail_gracefully_when_call_depth_is_exceeded, deep_non_tail_recursion)
+{
+    VirtualMachine virtual_machine;
+
+    ASSERT_FALSE(load_and_run(
+                virtual_machine,
+                "(defun depth (n) (if (eq n 0) 0 (add 1 (depth (sub n 1))))) (depth 100000)").has_value());
+
+    // The `VirtualMachine` must remain usable after a runtime error.
+    const std::optional<Value> depth = load_and_run(virtual_machine, "(depth 100)");
+    ASSERT_TRUE(depth.has_value());
+    ASSERT_EQ(depth->unsigned_integer, 100);
+}
+
+TEST(virtual_machine_must_call_native_functions_appropriately, native_function)
+{
+    VirtualMachine virtual_machine;
+    std::size_t n_calls = 0;
+
+    virtual_machine.define_native_function(
+            "count-calls",
+            [&n_calls](VirtualMachine&, std::span<const Value> arguments) -> std::optional<Value>
+            {
+                n_calls++;
+                return Value::from_unsigned_integer(arguments.size());
+            });
+
+    const std::optional<Value> value = load_and_run(virtual_machine, "(count-calls (count-calls) 1 2)");
+    ASSERT_TRUE(value.has_value());
+    ASSERT_EQ(value->unsigned_integer, 3);
+    ASSERT_EQ(n_calls, 2);
+}
+
+TEST(virtual_machine_must_call_console_lisp_functions_appropriately, scale)
+{
+    mock::MockApplication application;
+    yli::ontology::ConsoleStruct console_struct(0, 39, 15, 0); // Some dummy dimensions.
+    yli::ontology::Console* const console = application.get_generic_entity_factory().create_console(
+            console_struct);
+
+    application.get_entity_factory().create_console_lisp_function_overload(
+            "scale",
+            yli::ontology::Request<yli::ontology::Console>(console),
+            &scale);
+
+    VirtualMachine virtual_machine(application.get_universe());
+    virtual_machine.define_console_lisp_function(*console, "scale");
+
+    const std::optional<Value> value = load_and_run(virtual_machine, "(scale (add 1 0.5) 4)");
+    ASSERT_TRUE(value.has_value());
+    ASSERT_EQ(value->type, ValueType::FLOATING_POINT);
+    ASSERT_EQ(value->floating_point, 6.0);
+
+    virtual_machine.define_console_lisp_function(*console, "no-such-function");
+    ASSERT_FALSE(load_and_run(virtual_machine, "(no-such-function 1)").has_value());
+}
+
+TEST(virtual_machine_must_resolve_entities_appropriately, universe_variable)
+{
+    mock::MockApplication application;
+    yli::ontology::Universe& universe = application.get_universe();
+    VirtualMachine virtual_machine(universe);
+
+    const Value foo = Value::from_symbol(virtual_machine.intern("foo"));
+    ASSERT_EQ(virtual_machine.resolve_entity(foo), nullptr);
+
+    // Binding a new name invalidates the cached lookup.
+    yli::ontology::VariableStruct variable_struct(universe, &universe);
+    variable_struct.local_name = "foo";
+    universe.create_variable(variable_struct, yli::data::AnyValue(true));
+    ASSERT_NE(universe.get_entity("foo"), nullptr);
+    ASSERT_EQ(virtual_machine.resolve_entity(foo), universe.get_entity("foo"));
+    ASSERT_EQ(virtual_machine.resolve_entity(Value::from_unsigned_integer(1)), nullptr);
+}
@@ -25,53 +25,158 @@
 #endif
 
 // Include standard headers
-#include <cstddef>  // std::size_t
-#include <vector>   // std::vector
+#include <algorithm> // std::max, std::min, std::sort, std::unique
+#include <cstddef>   // std::size_t
+#include <vector>    // std::vector
 
 namespace yli::triangulation
 {
+    // The part of a polygon edge that crosses a horizontal slab.
+    struct SlabCrossing
+    {
+        float bottom_x;
+        float top_x;
+    };
+
     bool triangulate_simple_polygon(
-            const yli::triangulation::TriangulatePolygonsStruct& /* triangulate_polygons_struct */,
-            std::vector<glm::vec3>& /* out_vertices */,
-            std::vector<glm::vec2>& /* out_uvs */,
-            std::vector<glm::vec3>& /* out_normals */)
+            const yli::triangulation::TriangulatePolygonsStruct& triangulate_polygons_struct,
+            std::vector<glm::vec3>& out_vertices,
+            std::vector<glm::vec2>& out_uvs,
+            std::vector<glm::vec3>& out_normals)
     {
-        // TODO: implement this function!
-        return false;
+        // A simple polygon is a set of one outline.
+        return triangulate_polygons(triangulate_polygons_struct, out_vertices, out_uvs, out_normals);
     }
 
     bool triangulate_polygons(
             const yli::triangulation::TriangulatePolygonsStruct& triangulate_polygons_struct,
-            std::vector<glm::vec3>& /* out_vertices */,
-            std::vector<glm::vec2>& /* out_uvs */,
-            std::vector<glm::vec3>& /* out_normals */)
+            std::vector<glm::vec3>& out_vertices,
+            std::vector<glm::vec2>& out_uvs,
+            std::vector<glm::vec3>& out_normals)
     {
-        // TODO: implement this function!
+        // The outlines are filled using the even-odd rule, so the inner outlines
+        // are holes. The outlines must not intersect each other or themselves.
+        //
+        // The polygons are split into horizontal slabs at the y coordinates of
+        // the vertices. No vertex lies inside a slab, so each edge crossing a slab
+        // crosses it completely, and the crossings sorted by x pair up into
+        // trapezoids that cover the filled area of the slab.
+        const std::vector<std::vector<glm::vec2>>* const vertex_data = triangulate_polygons_struct.input_vertices;
 
-        // Find hidden vertices using `get_intersection_point(yli::geometry::LineSegment2D* line_segment1, yli::geometry::LineSegment2D* line_segment2)`.
-        std::vector<std::vector<glm::vec2>>* vertex_data = triangulate_polygons_struct.input_vertices;
+        if (vertex_data == nullptr)
+        {
+            return false;
+        }
 
-        // Each edge may have intersections with any other intersections
-        // except immediately previous and immediately next intersections.
-        // TODO: write the code!
+        std::vector<float> slab_ys;
+        glm::vec2 min_vertex { 0.0f, 0.0f };
+        glm::vec2 max_vertex { 0.0f, 0.0f };
 
-        for (std::size_t vertex_i = 0; vertex_i < vertex_data->size(); vertex_i++)
+        for (const std::vector<glm::vec2>& outline : *vertex_data)
         {
+            for (const glm::vec2& vertex : outline)
+            {
+                if (slab_ys.empty())
+                {
+                    min_vertex = vertex;
+                    max_vertex = vertex;
+                }
+
+                min_vertex.x = std::min(min_vertex.x, vertex.x);
+                min_vertex.y = std::min(min_vertex.y, vertex.y);
+                max_vertex.x = std::max(max_vertex.x, vertex.x);
+                max_vertex.y = std::max(max_vertex.y, vertex.y);
+                slab_ys.push_back(vertex.y);
+            }
         }
 
-        // All vertices (3D, explicitly defined and hidden) should be known now.
+        std::sort(slab_ys.begin(), slab_ys.end());
+        slab_ys.erase(std::unique(slab_ys.begin(), slab_ys.end()), slab_ys.end());
 
-        // Divide complex polygons into simple polygons. Each vertex belongs to 1 or more simple polygons.
-        // TODO: write the code!
-        std::vector<std::vector<glm::vec3>> simple_polygons;
+        const glm::vec2 extent = max_vertex - min_vertex;
+        const glm::vec3 normal { 0.0f, 0.0f, 1.0f };
 
-        for (std::size_t  vertex_i = 0; vertex_i < vertex_data->size(); vertex_i++)
+        auto output_vertex = [&](const float x, const float y)
         {
-        }
+            out_vertices.emplace_back(x, y, 0.0f);
+            out_normals.push_back(normal);
+
+            if (triangulate_polygons_struct.use_real_texture_coordinates)
+            {
+                // The texture covers the bounding box of the polygons.
+                out_uvs.emplace_back(
+                        extent.x > 0.0f ? (x - min_vertex.x) / extent.x : 0.0f,
+                        extent.y > 0.0f ? (y - min_vertex.y) / extent.y : 0.0f);
+            }
+            else
+            {
+                out_uvs.emplace_back(x, y);
+            }
+        };
 
-        // Loop through simple polygons and triangulate them.
-        // TODO: write the code!
+        std::vector<SlabCrossing> crossings;
+
+        for (std::size_t slab_i = 1; slab_i < slab_ys.size(); slab_i++)
+        {
+            const float bottom_y = slab_ys[slab_i - 1];
+            const float top_y = slab_ys[slab_i];
+            crossings.clear();
+
+            for (const std::vector<glm::vec2>& outline : *vertex_data)
+            {
+                for (std::size_t vertex_i = 0; vertex_i < outline.size(); vertex_i++)
+                {
+                    const glm::vec2& a = outline[vertex_i];
+                    const glm::vec2& b = outline[(vertex_i + 1) % outline.size()];
+
+                    if (std::min(a.y, b.y) > bottom_y || std::max(a.y, b.y) < top_y)
+                    {
+                        // Horizontal edges and edges outside of the slab do not cross it.
+                        continue;
+                    }
+
+                    const float inverse_slope = (b.x - a.x) / (b.y - a.y);
+                    crossings.push_back(SlabCrossing {
+                            a.x + (bottom_y - a.y) * inverse_slope,
+                            a.x + (top_y - a.y) * inverse_slope });
+                }
+            }
+
+            if (crossings.size() % 2 != 0) [[unlikely]]
+            {
+                // Each closed outline crosses a slab an even number of times.
+                return false;
+            }
+
+            std::sort(crossings.begin(), crossings.end(),
+                    [](const SlabCrossing& lhs, const SlabCrossing& rhs)
+                    {
+                        return lhs.bottom_x + lhs.top_x < rhs.bottom_x + rhs.top_x;
+                    });
+
+            for (std::size_t crossing_i = 0; crossing_i < crossings.size(); crossing_i += 2)
+            {
+                const SlabCrossing& left = crossings[crossing_i];
+                const SlabCrossing& right = crossings[crossing_i + 1];
+
+                // Counterclockwise when seen from +z. A trapezoid narrowing
+                // into a point has only one triangle.
+                if (right.bottom_x > left.bottom_x)
+                {
+                    output_vertex(left.bottom_x, bottom_y);
+                    output_vertex(right.bottom_x, bottom_y);
+                    output_vertex(right.top_x, top_y);
+                }
+
+                if (right.top_x > left.top_x)
+                {
+                    output_vertex(left.bottom_x, bottom_y);
+                    output_vertex(right.top_x, top_y);
+                    output_vertex(left.top_x, top_y);
+                }
+            }
+        }
 
-        return false;
+        return true;
     }
 }